@@ -0,0 +1,122 @@
+# Path/name of the C compiler
+CC=gcc
+# C compiler flags
+CFLAGS=-W -Wall -Wextra -O2 -ggdb -D_FORTIFY_SOURCE=2 -std=gnu99
+# Disable implicit fallthrough warnings
+CFLAGS_WNIF=-Wimplicit-fallthrough=0
+# Linker flags
+LDFLAGS=
+# Version of the SDL library "1" or "2"
+LIBSDL_VERSION=
+# Path/name of python interpreter
+PYTHON_BIN=python
+# Simplified Wrapper and Interface Generator
+SWIG=
+# Python config helper
+PYTHON_CONFIG=python-config
+# Python version (derived from python config)
+PYTHON_VER=3.11
+# Path to the system headers
+include_path=
+# Installation prefix
+prefix=/usr/local/
+# Where to install binaries
+bindir=/usr/local/bin
+# Where to install libraries
+libdir=/usr/local/lib64
+# Where to install headers
+includedir=/usr/local/include
+# Where to install man pages
+mandir=/usr/local/share/man
+# Where to install documentation
+docdir=/usr/local/share/doc/
+# Where to install info pages
+infodir=/usr/local/share/info
+# Where to place readonly arch independend datafiles
+datadir=/usr/local/share
+# Where to place configuration
+sysconfdir=/usr/local/etc
+# Where to place runtime modified datafiles
+localstatedir=/usr/local/local/var/
+# WARNING not used
+build=
+# WARNING not used
+host=
+# Build static libs
+static-libs=yes
+# Build dynamic libs
+dynamic-libs=yes
+# Build tests
+build-tests=yes
+# Build demos
+build-demos=yes
+# OS to build the library for
+os=linux
+# libpng - Portable Network Graphics Library
+HAVE_LIBPNG=yes
+# libsdl - Simple Direct Media Layer
+HAVE_LIBSDL=no
+# jpeg - Library to load, handle and manipulate images in the JPEG format
+HAVE_JPEG=yes
+# webp - A lossy image compression format
+HAVE_WEBP=no
+# openjpeg - An open-source JPEG 2000 library
+HAVE_OPENJPEG=no
+# giflib - Library to handle, display and manipulate GIF images
+HAVE_GIFLIB=no
+# tiff - Tag Image File Format (TIFF) library
+HAVE_TIFF=no
+# zlib - Standard (de)compression library
+HAVE_ZLIB=yes
+# libarchive - http://www.libarchive.org/
+HAVE_LIBARCHIVE=no
+# libXrandr - Xrandr library
+HAVE_LIBXRANDR=no
+# libX11 - X11 library
+HAVE_LIBX11=yes
+# libxcb - XCB library
+HAVE_LIBXCB=no
+# xcb-util-errors - XCB errors library
+HAVE_XCB-UTIL-ERRORS=no
+# X_SHM - MIT-SHM X Extension
+HAVE_X_SHM=yes
+# aalib - Portable ascii art GFX library
+HAVE_AALIB=no
+# freetype - A high-quality and portable font engine
+HAVE_FREETYPE=yes
+# fontconfig - A library for configuring and customizing font access
+HAVE_FONTCONFIG=yes
+# dl - Dynamic linker
+HAVE_DL=yes
+# V4L2 - Video for linux 2
+HAVE_V4L2=yes
+# pthread - Posix Threads
+HAVE_PTHREAD=yes
+# mmap - mmap() call
+HAVE_MMAP=yes
+# drm/drm.h - an UAPI drm/drm.h header
+HAVE_DRM/DRM.H=no
+# libdrm/drm.h - fallback for UAPI drm.h in libdrm/drm.h
+HAVE_LIBDRM/DRM.H=no
+# xkbcommon - Keymap handling library for toolkits and window systems
+HAVE_XKBCOMMON=no
+# wayland - Wayland windowing system
+HAVE_WAYLAND=no
+# backtrace - C stack trace writeout
+HAVE_BACKTRACE=yes
+# freetype cflags
+FREETYPE_CFLAGS=-I/usr/include/freetype2 -I/usr/include/libpng16
+# pthread cflags
+PTHREAD_CFLAGS=-pthread
+# loaders linker flags
+LDLIBS_loaders=-lpng -ljpeg -lz -pthread
+# backends linker flags
+LDLIBS_backends=-lX11 -lXfixes -lXext
+# core linker flags
+LDLIBS_core=-lfreetype -lfontconfig -ldl -pthread
+# widgets linker flags
+LDLIBS_widgets=-ldl
+# grabbers linker flags
+LDLIBS_grabbers=
+# utils linker flags
+LDLIBS_utils=
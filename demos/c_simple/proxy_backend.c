@@ -72,6 +72,35 @@ static void shm_update(gp_proxy_cli *self, gp_coord x, gp_coord y, gp_size w, gp
 	gp_backend_update_rect_xywh(backend, x, y, w, h);
 }
 
+static void shm_present(gp_proxy_cli *self, struct gp_proxy_present_ *present)
+{
+	gp_bbox rects[GP_PROXY_PRESENT_RECTS];
+	gp_pixmap src;
+	uint32_t i;
+
+	if (self != cli_shown)
+		goto release;
+
+	if (gp_proxy_shm_buf(shm, present->buf, &src)) {
+		GP_WARN("Invalid buffer %u", present->buf);
+		return;
+	}
+
+	for (i = 0; i < present->cnt; i++) {
+		struct gp_proxy_rect_ *r = &present->rects[i];
+
+		gp_blit_xywh_clipped(&src, r->x, r->y, r->w, r->h,
+		                     backend->pixmap, r->x, r->y);
+
+		rects[i] = gp_bbox_pack(r->x, r->y, r->w, r->h);
+	}
+
+	gp_backend_update_rects(backend, rects, present->cnt);
+
+release:
+	gp_proxy_cli_release(self, present->buf);
+}
+
 static void do_exit(void)
 {
 	gp_backend_exit(backend);
@@ -245,6 +274,9 @@ static enum gp_poll_event_ret client_event(gp_fd *self)
 			           msg->rect.rect.x, msg->rect.rect.y,
 			           msg->rect.rect.w, msg->rect.rect.h);
 		break;
+		case GP_PROXY_PRESENT:
+			shm_present(self->priv, &msg->present.present);
+		break;
 		case GP_PROXY_NAME:
 			if (!cli_shown)
 				redraw();
@@ -279,6 +311,7 @@ static enum gp_poll_event_ret server_event(gp_fd *self)
 		struct gp_proxy_cli_init_ init = {
 			.pixel_type = backend->pixmap->pixel_type,
 			.dpi = backend->dpi,
+			.buffers = shm->buf_cnt,
 		};
 		gp_proxy_send(fd, GP_PROXY_CLI_INIT, &init);
 
@@ -332,7 +365,8 @@ int main(int argc, char *argv[])
 	gp_size w = backend->pixmap->w;
 	gp_size h = backend->pixmap->h;
 
-	shm = gp_proxy_shm_init("/dev/shm/.proxy_backend", w, h, backend->pixmap->pixel_type);
+	shm = gp_proxy_shm_init_bufs("/dev/shm/.proxy_backend", w, h,
+	                             backend->pixmap->pixel_type, 2);
 	if (!shm) {
 		gp_backend_exit(backend);
 		return 1;
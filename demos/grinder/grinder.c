@@ -16,6 +16,8 @@
 
 static gp_progress_cb *progress_callback = NULL;
 
+static gp_save_opts save_opts;
+
 static const char *progress_prefix = NULL;
 
 static int show_progress(gp_progress_cb *self)
@@ -416,7 +418,7 @@ static int save_jpg(gp_pixmap **c, const char *params)
 		return EINVAL;
 	}
 
-	gp_save_jpg(*c, file, progress_callback);
+	gp_save_jpg_ex(*c, file, &save_opts, progress_callback);
 
 	return 0;
 }
@@ -440,7 +442,7 @@ static int save_png(gp_pixmap **c, const char *params)
 		return EINVAL;
 	}
 
-	gp_save_png(*c, file, progress_callback);
+	gp_save_png_ex(*c, file, &save_opts, progress_callback);
 
 	return 0;
 }
@@ -716,6 +718,70 @@ static void print_filter_help(void)
 	}
 }
 
+/* encoder options */
+
+static const char *save_presets[] = {
+	"default",
+	"fastest",
+	"smallest",
+	NULL
+};
+
+static const char *save_subsamplings[] = {
+	"default",
+	"444",
+	"422",
+	"420",
+	NULL
+};
+
+static int save_check_level(const struct param *self __attribute__((unused)),
+                            void *val, int count __attribute__((unused)))
+{
+	int i = *((int*)val);
+
+	if (i < 1 || i > 9)
+		return 1;
+
+	return 0;
+}
+
+static int save_check_quality(const struct param *self __attribute__((unused)),
+                              void *val, int count __attribute__((unused)))
+{
+	int i = *((int*)val);
+
+	if (i < 1 || i > 100)
+		return 1;
+
+	return 0;
+}
+
+static struct param save_params[] = {
+	{"preset", PARAM_ENUM, "speed/size trade-off", save_presets, NULL},
+	{"level", PARAM_INT, "compression level 1 - 9 (png)", NULL, save_check_level},
+	{"quality", PARAM_INT, "quality 1 - 100 (jpg)", NULL, save_check_quality},
+	{"subsampling", PARAM_ENUM, "chroma subsampling (jpg)", save_subsamplings, NULL},
+	{"progressive", PARAM_BOOL, "progressive encoding (jpg)", NULL, NULL},
+	{NULL,  0, NULL, NULL, NULL}
+};
+
+static void set_save_opts(const char *params)
+{
+	int preset = 0, subsampling = 0, progressive = 0;
+
+	if (param_parse(params, save_params, "save", param_err, &preset,
+	                &save_opts.compress_level, &save_opts.quality,
+	                &subsampling, &progressive))
+		exit(1);
+
+	save_opts.preset = preset;
+	save_opts.subsampling = subsampling;
+
+	if (progressive)
+		save_opts.flags |= GP_SAVE_PROGRESSIVE;
+}
+
 /* application */
 
 #define FILTERS_MAX 255
@@ -786,6 +852,7 @@ static const char *app_help = {
 	"-v int    - sets gfxprim verbosity level              \n"
 	"-o fmt    - output format, ppm, jpg, png              \n"
 	"-f params - apply filter, multiple filters may be used\n"
+	"-s params - encoder options, used for all saved images\n"
 	"                                                      \n"
 	"                  Example usage                       \n"
 	"                  =============                       \n"
@@ -805,6 +872,8 @@ static void print_help(void)
 {
 	puts(app_help);
 	print_filter_help();
+	puts("Encoder options\n---------------\n");
+	param_describe(save_params, " ");
 }
 
 static const char *out_fmts[] = {
@@ -835,9 +904,9 @@ static void save_by_fmt(struct gp_pixmap *bitmap, const char *name, const char *
 	if (!strcmp(fmt, "ppm"))
 		ret = gp_save_ppm(bitmap, name, progress_callback);
 	else if (!strcmp(fmt, "jpg"))
-		ret = gp_save_jpg(bitmap, name, progress_callback);
+		ret = gp_save_jpg_ex(bitmap, name, &save_opts, progress_callback);
 	else if (!strcmp(fmt, "png"))
-		ret = gp_save_png(bitmap, name, progress_callback);
+		ret = gp_save_png_ex(bitmap, name, &save_opts, progress_callback);
 	else {
 		printf("Invalid format %s\n", fmt);
 		exit(1);
@@ -863,7 +932,7 @@ int main(int argc, char *argv[])
 		.callback = show_progress,
 	};
 
-	while ((opt = getopt(argc, argv, "f:ho:pv:")) != -1) {
+	while ((opt = getopt(argc, argv, "f:ho:ps:v:")) != -1) {
 		switch (opt) {
 		case 'h':
 			print_help();
@@ -891,6 +960,9 @@ int main(int argc, char *argv[])
 		case 'p':
 			progress_callback = &callback;
 		break;
+		case 's':
+			set_save_opts(optarg);
+		break;
 		default:
 			print_help();
 			return 1;
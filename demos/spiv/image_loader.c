@@ -59,6 +59,10 @@ gp_pixmap *image_loader_get_image(gp_progress_cb *callback, int elevate)
 
 	path = image_list_img_path(img_list);
 
+	/* Drop meta data loaded by image_loader_get_size() */
+	gp_storage_destroy(cur_meta_data);
+	cur_meta_data = NULL;
+
 	if (!image_cache_get(img_cache, &cur_img, &cur_meta_data, elevate, path))
 		return cur_img;
 
@@ -102,6 +106,73 @@ gp_pixmap *image_loader_get_image(gp_progress_cb *callback, int elevate)
 	return img;
 }
 
+int image_loader_get_size(gp_size *w, gp_size *h)
+{
+	gp_data_node *width, *height;
+	const char *path;
+
+	if (cur_cont)
+		return 1;
+
+	path = image_list_img_path(img_list);
+
+	if (!cur_img && !cur_meta_data)
+		image_cache_get(img_cache, &cur_img, &cur_meta_data, 0, path);
+
+	if (cur_img) {
+		*w = cur_img->w;
+		*h = cur_img->h;
+		return 0;
+	}
+
+	if (!cur_meta_data) {
+		cur_meta_data = gp_storage_create();
+		if (!cur_meta_data)
+			return 1;
+
+		if (gp_load_meta_data(path, cur_meta_data))
+			return 1;
+	}
+
+	width = gp_storage_get_by_path(cur_meta_data, NULL, "/Width");
+	height = gp_storage_get_by_path(cur_meta_data, NULL, "/Height");
+
+	if (!width || !height ||
+	    width->type != GP_DATA_INT || height->type != GP_DATA_INT)
+		return 1;
+
+	*w = width->value.i;
+	*h = height->value.i;
+
+	return 0;
+}
+
+gp_pixmap *image_loader_get_image_scaled(gp_progress_cb *callback,
+                                         gp_size w, gp_size h)
+{
+	const char *path = image_list_img_path(img_list);
+	const gp_loader *loader;
+	struct cpu_timer timer;
+	gp_pixmap *img;
+
+	if (cur_img || cur_cont)
+		return NULL;
+
+	/*
+	 * Other loaders return the image in full size, which has to be loaded
+	 * by image_loader_get_image() so that it ends up in the cache.
+	 */
+	loader = gp_loader_by_filename(path);
+	if (!loader || !loader->read_scaled)
+		return NULL;
+
+	cpu_timer_start(&timer, "Loading scaled");
+	img = gp_load_image_scaled(path, w, h, callback);
+	cpu_timer_stop(&timer);
+
+	return img;
+}
+
 gp_storage *image_loader_get_meta_data(void)
 {
 	return cur_meta_data;
@@ -31,6 +31,22 @@ int image_loader_init(const char *args[], unsigned int cache_max_bytes);
  */
 gp_pixmap *image_loader_get_image(gp_progress_cb *callback, int elevate);
 
+/*
+ * Returns current image size, loads only the image meta data if the image is
+ * not loaded yet. Returns non-zero if the size is not known.
+ */
+int image_loader_get_size(gp_size *w, gp_size *h);
+
+/*
+ * Loads current image downscaled to at least w x h, the result is not cached
+ * and has to be freed by the caller.
+ *
+ * Returns NULL if the full size image is already loaded or if the image format
+ * cannot be decoded downscaled, image_loader_get_image() has to be used then.
+ */
+gp_pixmap *image_loader_get_image_scaled(gp_progress_cb *callback,
+                                         gp_size w, gp_size h);
+
 /*
  * Retruns current image meta data or NULL there are none.
  */
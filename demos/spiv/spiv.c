@@ -230,7 +230,7 @@ static unsigned int print_meta_data(gp_data_node *node, gp_pixmap *pixmap,
 }
 
 static void show_info(struct loader_params *params, gp_pixmap *img,
-                      gp_pixmap *orig_img)
+                      gp_size orig_w, gp_size orig_h)
 {
 	gp_pixmap *pixmap = backend->pixmap;
 	const char *img_path = image_loader_img_path();
@@ -243,7 +243,7 @@ static void show_info(struct loader_params *params, gp_pixmap *img,
 	gp_size th = gp_text_height(config.style), y = 10;
 
 	info_printf(pixmap, 10, y, "%ux%u (%ux%u) 1:%3.3f %3.1f%% %s",
-	         img->w, img->h, orig_img->w, orig_img->h, params->zoom_rat,
+	         img->w, img->h, orig_w, orig_h, params->zoom_rat,
 		 params->zoom_rat * 100, gp_pixel_type_name(img->pixel_type));
 	y += th + 2;
 
@@ -292,7 +292,7 @@ static void show_info(struct loader_params *params, gp_pixmap *img,
 }
 
 static void update_display(struct loader_params *params, gp_pixmap *img,
-                           gp_pixmap *orig_img)
+                           gp_size orig_w, gp_size orig_h)
 {
 	gp_pixmap *pixmap = backend->pixmap;
 	struct cpu_timer timer;
@@ -379,7 +379,7 @@ static void update_display(struct loader_params *params, gp_pixmap *img,
 	if (h > 0)
 		gp_fill_rect_xywh(pixmap, 0, img->h + cy, pixmap->w, h, black_pixel);
 
-	show_info(params, img, orig_img);
+	show_info(params, img, orig_w, orig_h);
 
 	if (config.combined_orientation)
 		gp_pixmap_free(img);
@@ -391,10 +391,12 @@ static void update_display(struct loader_params *params, gp_pixmap *img,
 	gp_backend_flip(backend);
 }
 
-gp_pixmap *load_resized_image(struct loader_params *params, gp_size w, gp_size h)
+gp_pixmap *load_resized_image(struct loader_params *params, gp_size w, gp_size h,
+                              gp_size orig_w, gp_size orig_h)
 {
-	gp_pixmap *img, *res = NULL;
+	gp_pixmap *img, *res = NULL, *scaled = NULL;
 	struct cpu_timer timer;
+	float rat;
 	gp_progress_cb callback = {.callback = image_loader_callback};
 
 	const char *img_path = image_loader_img_path();
@@ -407,29 +409,43 @@ gp_pixmap *load_resized_image(struct loader_params *params, gp_size w, gp_size h
 	if (img != NULL)
 		return img;
 
+	/*
+	 * Downscaling at least by half, let the loader decode smaller image
+	 * if possible, e.g. JPEG DCT scaling, and finish it with the filters.
+	 */
+	if (params->zoom_rat <= 0.5) {
+		callback.priv = "Loading image";
+		scaled = image_loader_get_image_scaled(&callback, w, h);
+	}
+
 	/* Otherwise load image and resize it */
-	if ((img = load_image(1)) == NULL)
+	if (scaled)
+		img = scaled;
+	else if ((img = load_image(1)) == NULL)
 		return NULL;
 
+	rat = 1.00 * w / img->w;
+
 	if (params->show_nn_first) {
 		/* Do simple interpolation and blit the result */
 		gp_pixmap *nn = gp_filter_resize_nn_alloc(img, w, h, NULL);
 		if (nn != NULL) {
-			update_display(params, nn, img);
+			update_display(params, nn, orig_w, orig_h);
 			gp_pixmap_free(nn);
 		}
 	}
 
 	/* Do low pass filter */
-	if (params->use_low_pass && params->zoom_rat < 1) {
+	if (params->use_low_pass && rat < 1) {
 		cpu_timer_start(&timer, "Blur");
 		callback.priv = "Blurring Image";
 
-		res = gp_filter_gaussian_blur_alloc(img, 0.4/params->zoom_rat,
-		                                 0.4/params->zoom_rat, &callback);
+		res = gp_filter_gaussian_blur_alloc(img, 0.4/rat, 0.4/rat, &callback);
 
-		if (res == NULL)
+		if (res == NULL) {
+			gp_pixmap_free(scaled);
 			return NULL;
+		}
 
 		img = res;
 
@@ -453,8 +469,9 @@ gp_pixmap *load_resized_image(struct loader_params *params, gp_size w, gp_size h
 	}
 */
 
-	/* Free low passed pixmap if needed */
+	/* Free low passed and scaled pixmap if needed */
 	gp_pixmap_free(res);
+	gp_pixmap_free(scaled);
 
 	if (img == NULL)
 		return NULL;
@@ -592,34 +609,44 @@ static void *image_loader(void *ptr)
 {
 	struct loader_params *params = ptr;
 	struct cpu_timer sum_timer;
-	gp_pixmap *img, *orig_img, *pixmap = backend->pixmap;
+	gp_pixmap *img, *pixmap = backend->pixmap;
+	gp_size orig_w, orig_h;
 
 	cpu_timer_start(&sum_timer, "sum");
 
 	show_progress = config.show_progress || params->show_progress_once;
 	params->show_progress_once = 0;
 
-	if ((orig_img = load_image(0)) == NULL) {
-		loader_running = 0;
-		return NULL;
+	/* Get the size from meta data if possible, the image may not be needed */
+	if (image_loader_get_size(&orig_w, &orig_h)) {
+		if ((img = load_image(0)) == NULL) {
+			loader_running = 0;
+			return NULL;
+		}
+
+		orig_w = img->w;
+		orig_h = img->h;
 	}
 
 	/* Figure zoom */
 	gp_size w, h;
 
-	params->zoom_rat = calc_img_size(params, orig_img->w, orig_img->h,
+	params->zoom_rat = calc_img_size(params, orig_w, orig_h,
 	                                 pixmap->w, pixmap->h);
 
-	w = orig_img->w * params->zoom_rat + 0.5;
-	h = orig_img->h * params->zoom_rat + 0.5;
+	w = orig_w * params->zoom_rat + 0.5;
+	h = orig_h * params->zoom_rat + 0.5;
 
 	/* Special case => no need to resize */
-	if (w == orig_img->w && h == orig_img->h) {
-		img = orig_img;
+	if (w == orig_w && h == orig_h) {
+		if ((img = load_image(0)) == NULL) {
+			loader_running = 0;
+			return NULL;
+		}
 		goto update;
 	}
 
-	img = load_resized_image(params, w, h);
+	img = load_resized_image(params, w, h, orig_w, orig_h);
 
 	if (img == NULL) {
 		loader_running = 0;
@@ -627,7 +654,7 @@ static void *image_loader(void *ptr)
 	}
 
 update:
-	update_display(params, img, orig_img);
+	update_display(params, img, orig_w, orig_h);
 	cpu_timer_stop(&sum_timer);
 
 	loader_running = 0;
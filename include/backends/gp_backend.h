@@ -26,6 +26,7 @@
 #include <core/gp_types.h>
 
 #include <utils/gp_timer.h>
+#include <utils/gp_bbox.h>
 #include <utils/gp_list.h>
 #include <utils/gp_poll.h>
 
@@ -105,6 +106,18 @@ struct gp_backend {
 	                    gp_coord x0, gp_coord y0,
 	                    gp_coord x1, gp_coord y1);
 
+	/**
+	 * @brief Updates several display rectangles at once.
+	 *
+	 * The rectangles are already transformed and clipped to the pixmap.
+	 * Backends that have to do an expensive operation, such as a round
+	 * trip to a server, after each update should implement this.
+	 *
+	 * If NULL update_rect() is called for each rectangle.
+	 */
+	void (*update_rects)(gp_backend *self, const gp_bbox *rects,
+	                     unsigned int cnt);
+
 	/*
 	 * Attribute change callback.
 	 *
@@ -265,6 +278,20 @@ static inline void gp_backend_update_rect_xywh(gp_backend *self,
 	gp_backend_update_rect_xyxy(self, x, y, x + w - 1, y + h - 1);
 }
 
+/**
+ * @brief Copies several rectangles from backend pixmap to a display.
+ *
+ * This is more effective than calling gp_backend_update_rect() for each
+ * rectangle since backends can send all the rectangles in one go, e.g.
+ * gp_damage::rects after the damaged region was drawn.
+ *
+ * @param self A backend.
+ * @param rects An array of rectangles, empty rectangles are ignored.
+ * @param cnt A number of rectangles in the array.
+ */
+void gp_backend_update_rects(gp_backend *self, const gp_bbox *rects,
+                             unsigned int cnt);
+
 static inline void gp_backend_poll_add(gp_backend *self, gp_fd *fd)
 {
 	gp_poll_add(&self->fds, fd);
@@ -48,4 +48,32 @@ enum gp_linux_fb_flags {
  */
 gp_backend *gp_linux_fb_init(const char *path, enum gp_linux_fb_flags flags);
 
+/**
+ * @brief Linux framebuffer shadow flush statistics.
+ *
+ * With GP_FB_SHADOW the shadow buffer is compared with the last written
+ * framebuffer content and only changed spans are written to the framebuffer.
+ */
+typedef struct gp_linux_fb_stats {
+	/** @brief Number of flips and rectangle updates. */
+	unsigned long flushes;
+	/** @brief Number of spans written to the framebuffer. */
+	unsigned long spans;
+	/** @brief Number of bytes written to the framebuffer. */
+	uint64_t bytes_written;
+	/** @brief Number of bytes that were not written since they did not change. */
+	uint64_t bytes_skipped;
+} gp_linux_fb_stats;
+
+/**
+ * @brief Returns Linux framebuffer shadow flush statistics.
+ *
+ * @param self A Linux framebuffer backend.
+ * @param stats A structure to store the statistics to.
+ *
+ * @return Zero on success, non-zero and errno set to ENOSYS if the backend
+ *         does not use GP_FB_SHADOW.
+ */
+int gp_linux_fb_stats_get(gp_backend *self, gp_linux_fb_stats *stats);
+
 #endif /* BACKENDS_GP_LINUX_FB_H */
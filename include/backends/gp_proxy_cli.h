@@ -115,6 +115,21 @@ static inline void gp_proxy_cli_event(gp_proxy_cli *self, gp_event *ev)
 		GP_WARN("Dropping event");
 }
 
+/**
+ * @brief Returns a buffer presented by the application.
+ *
+ * Has to be called for each GP_PROXY_PRESENT message once the server is done
+ * reading the buffer.
+ *
+ * @param self A client (application).
+ * @param buf A buffer index from the GP_PROXY_PRESENT message.
+ */
+static inline void gp_proxy_cli_release(gp_proxy_cli *self, uint32_t buf)
+{
+	if (gp_proxy_send(self->fd.fd, GP_PROXY_RELEASE, &buf))
+		GP_WARN("Failed to release buffer %u", buf);
+}
+
 /**
  * @brief A function to fill the proxy client buffer.
  *
@@ -121,6 +121,9 @@ enum gp_proxy_msg_types {
 	 * it.
 	 *
 	 * The payload is the struct gp_proxy_rect.
+	 *
+	 * The rectangle is always in the first buffer, applications that
+	 * render into a buffer ring use GP_PROXY_PRESENT instead.
 	 */
 	GP_PROXY_UPDATE,
 	/**
@@ -130,6 +133,26 @@ enum gp_proxy_msg_types {
 	 * position.
 	 */
 	GP_PROXY_CURSOR_POS,
+	/**
+	 * @brief Application asks server to show a rendered buffer.
+	 *
+	 * Send by the application when it finished rendering into a buffer
+	 * from the buffer ring. The payload is struct gp_proxy_present_ with
+	 * the buffer index and a list of damaged rectangles, the message size
+	 * depends on the number of rectangles.
+	 *
+	 * The buffer is owned by the server until it's released by the
+	 * GP_PROXY_RELEASE message and the application must not render into
+	 * it in the meantime.
+	 */
+	GP_PROXY_PRESENT,
+	/**
+	 * @brief Server returns a buffer to the application.
+	 *
+	 * Send by the server once it finished reading a buffer passed by
+	 * GP_PROXY_PRESENT. The payload is a 32bit buffer index.
+	 */
+	GP_PROXY_RELEASE,
 	/** @brief Last message type + 1. */
 	GP_PROXY_MAX,
 };
@@ -166,6 +189,54 @@ struct gp_proxy_rect_ {
 	uint32_t h;
 };
 
+/**
+ * @brief Maximal number of rectangles in a GP_PROXY_PRESENT message.
+ */
+#define GP_PROXY_PRESENT_RECTS 8
+
+/**
+ * @brief A present payload.
+ */
+struct gp_proxy_present_ {
+	/** @brief A buffer index. */
+	uint32_t buf;
+	/** @brief Number of rectangles. */
+	uint32_t cnt;
+	/** @brief Damaged rectangles, only first cnt are send. */
+	struct gp_proxy_rect_ rects[GP_PROXY_PRESENT_RECTS];
+};
+
+/**
+ * @brief A present request.
+ *
+ * Send by the application to pass a rendered buffer to the server.
+ */
+struct gp_proxy_present {
+	/** @brief Event type is set to GP_PROXY_PRESENT. */
+	uint32_t type;
+	/**
+	 * @brief Size is set to header size + 8 + number of rectangles
+	 *        times sizeof(struct gp_proxy_rect_).
+	 */
+	uint32_t size;
+	/** @brief The present payload. */
+	struct gp_proxy_present_ present;
+};
+
+/**
+ * @brief A buffer release.
+ *
+ * Send by the server to return a buffer back to the application.
+ */
+struct gp_proxy_release {
+	/** @brief Event type is set to GP_PROXY_RELEASE. */
+	uint32_t type;
+	/** @brief Size is set to header size + 4. */
+	uint32_t size;
+	/** @brief A buffer index. */
+	uint32_t buf;
+};
+
 /**
  * @brief A mmap() request.
  *
@@ -220,6 +291,17 @@ struct gp_proxy_cli_init_ {
 	gp_pixel_type pixel_type;
 	/** @brief A display DPI. */
 	unsigned int dpi;
+	/**
+	 * @brief Number of buffers in the SHM buffer ring.
+	 *
+	 * The mapped SHM segment is split into this many buffers of equal
+	 * size. With a single buffer the application renders directly into
+	 * memory the server composites from and sends GP_PROXY_UPDATE.
+	 *
+	 * Older servers do not send this field, the application checks the
+	 * message size and falls back to a single buffer.
+	 */
+	unsigned int buffers;
 };
 
 /**
@@ -271,6 +353,8 @@ typedef union gp_proxy_msg {
 	struct gp_proxy_rect rect;
 	struct gp_proxy_cli_init cli_init;
 	struct gp_proxy_cursor cursor;
+	struct gp_proxy_present present;
+	struct gp_proxy_release release;
 } gp_proxy_msg;
 
 /**
@@ -278,7 +362,7 @@ typedef union gp_proxy_msg {
  *
  * Must be bigger than maximal message size!
  */
-#define GP_PROXY_BUF_SIZE 128
+#define GP_PROXY_BUF_SIZE 256
 
 /** @brief A proxy message buffer. */
 typedef struct gp_proxy_buf {
@@ -15,25 +15,38 @@
 #include <backends/gp_proxy_proto.h>
 #include <core/gp_pixmap.h>
 
+/**
+ * @brief Maximal number of buffers in a SHM segment.
+ */
+#define GP_PROXY_SHM_BUFS 3
+
 /**
  * @brief A SHM pixmap.
+ *
+ * The SHM segment is split into a ring of equally sized page aligned buffers
+ * so that application can render into one buffer while the server reads
+ * another one.
  */
 typedef struct gp_proxy_shm {
 	/** @brief A file descriptor for the SHM file. */
 	int fd;
 	/** @brief A SHM segment size. */
 	size_t size;
-	/** @brief A pixmap with the SHM segment as a pixels. */
+	/** @brief A pixmap with the first SHM buffer as a pixels. */
 	gp_pixmap pixmap;
 	/** @brief A path to the SHM segment. */
 	struct gp_proxy_path path;
+	/** @brief A size of a single buffer, rounded to PAGE_SIZE. */
+	size_t buf_size;
+	/** @brief Number of buffers in the SHM segment. */
+	unsigned int buf_cnt;
 } gp_proxy_shm;
 
 /**
  * @brief Creates an SHM pixmap.
  *
  * This is called by the server to initialize a SHM pixmap for the application
- * to render to. The SHM segment size is rounded to PAGE_SIZE.
+ * to render to. The size is rounded to PAGE_SIZE.
  *
  * @param path in the /dev/shm/ filesystem, 64 bytes at max.
  * @param w Image width.
@@ -42,7 +55,46 @@ typedef struct gp_proxy_shm {
  *
  * @return Newly created SHM pixmap.
  */
-gp_proxy_shm *gp_proxy_shm_init(const char *path, gp_size w, gp_size h, gp_pixel_type type);
+gp_proxy_shm *gp_proxy_shm_init(const char *path, gp_size w, gp_size h,
+                                gp_pixel_type type);
+
+/**
+ * @brief Creates an SHM pixmap split into a buffer ring.
+ *
+ * Same as gp_proxy_shm_init() but the SHM segment holds buf_cnt buffers. Each
+ * buffer size is rounded to PAGE_SIZE.
+ *
+ * @param path in the /dev/shm/ filesystem, 64 bytes at max.
+ * @param w Image width.
+ * @param h Image height.
+ * @param type Image pixel type.
+ * @param buf_cnt Number of buffers, between 1 and GP_PROXY_SHM_BUFS.
+ *
+ * @return Newly created SHM pixmap.
+ */
+gp_proxy_shm *gp_proxy_shm_init_bufs(const char *path, gp_size w, gp_size h,
+                                     gp_pixel_type type, unsigned int buf_cnt);
+
+/**
+ * @brief Returns a pixmap for a SHM buffer.
+ *
+ * @param self A SHM pixmap.
+ * @param buf A buffer index.
+ * @param pixmap A pixmap to be initialized with the buffer.
+ *
+ * @return Zero on success, non-zero if buffer index is out of range.
+ */
+static inline int gp_proxy_shm_buf(gp_proxy_shm *self, unsigned int buf,
+                                   gp_pixmap *pixmap)
+{
+	if (buf >= self->buf_cnt)
+		return 1;
+
+	*pixmap = self->pixmap;
+	pixmap->pixels = (uint8_t*)self->pixmap.pixels + buf * self->buf_size;
+
+	return 0;
+}
 
 /**
  * @brief Resizes a SHM pixmap.
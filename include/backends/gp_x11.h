@@ -48,4 +48,34 @@ gp_backend *gp_x11_init(const char *display, int x, int y,
 			const char *caption,
 			enum gp_x11_flags flags);
 
+/**
+ * @brief X11 MIT-SHM presentation statistics.
+ *
+ * The latency is measured from the XShmPutImage() request to the
+ * ShmCompletion event, i.e. until the X server finished copying the frame.
+ */
+typedef struct gp_x11_present_stats {
+	/** @brief Number of presented frames. */
+	unsigned long frames;
+	/** @brief Number of times all images were busy and present was deferred. */
+	unsigned long stalls;
+	/** @brief Latency of the last frame in microseconds. */
+	uint32_t last_us;
+	/** @brief Average latency in microseconds. */
+	uint32_t avg_us;
+	/** @brief Maximal latency in microseconds. */
+	uint32_t max_us;
+} gp_x11_present_stats;
+
+/**
+ * @brief Returns X11 MIT-SHM presentation statistics.
+ *
+ * @param self A X11 backend.
+ * @param stats A structure to store the statistics to.
+ *
+ * @return Zero on success, non-zero and errno set to ENOSYS if the backend
+ *         does not use MIT-SHM.
+ */
+int gp_x11_present_stats_get(gp_backend *self, gp_x11_present_stats *stats);
+
 #endif /* BACKENDS_GP_X11_H */
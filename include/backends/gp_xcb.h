@@ -7,6 +7,7 @@
 #define BACKENDS_GP_XCB_H
 
 #include <backends/gp_backend.h>
+#include <backends/gp_x11.h>
 
 /*
  * Initalize XCB backend.
@@ -22,4 +23,15 @@ gp_backend *gp_xcb_init(const char *display, int x, int y,
                         unsigned int w, unsigned int h,
 			const char *caption);
 
+/**
+ * @brief Returns XCB MIT-SHM presentation statistics.
+ *
+ * @param self A XCB backend.
+ * @param stats A structure to store the statistics to.
+ *
+ * @return Zero on success, non-zero and errno set to ENOSYS if the backend
+ *         does not use MIT-SHM.
+ */
+int gp_xcb_present_stats_get(gp_backend *self, gp_x11_present_stats *stats);
+
 #endif /* BACKENDS_GP_XCB_H */
@@ -222,7 +222,9 @@ extern uint8_t gp_lin10_to_srgb8_tbl[1024];
  */
 static inline uint8_t gp_lin16_to_srgb8(uint16_t val)
 {
-	return gp_lin10_to_srgb8_tbl[(val + (1<<3))>>6];
+	unsigned int idx = (val + (1<<3))>>6;
+
+	return gp_lin10_to_srgb8_tbl[idx > 1023 ? 1023 : idx];
 }
 
 /**
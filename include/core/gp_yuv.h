@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/**
+ * @file gp_yuv.h
+ * @brief YUV to RGB conversions.
+ *
+ * YUV buffers as produced by cameras and video decoders do not map to gfxprim
+ * pixel types, since chroma is shared between several pixels and may be
+ * stored in separate planes, so these are converted from a raw memory buffer
+ * into a RGB pixmap instead.
+ *
+ * The buffer is described by the format and a stride, i.e. the number of
+ * bytes per row of the first plane. Planar formats store planes one after
+ * another in the same buffer, the chroma planes use stride/2 for I420 and
+ * stride for NV12, which is the layout used by V4L2 single planar formats.
+ *
+ * The conversion works on four pixels at a time with fixed point math and
+ * splits the image into horizontal stripes that are converted in parallel,
+ * see gp_nr_threads().
+ */
+
+#ifndef CORE_GP_YUV_H
+#define CORE_GP_YUV_H
+
+#include <stddef.h>
+#include <core/gp_types.h>
+
+/**
+ * @brief YUV buffer formats.
+ */
+enum gp_yuv_fmt {
+	/** @brief Packed 4:2:2, bytes Y0 U Y1 V */
+	GP_YUV_YUYV,
+	/** @brief Packed 4:2:2, bytes U Y0 V Y1 */
+	GP_YUV_UYVY,
+	/** @brief Y plane followed by an interleaved UV plane, 4:2:0 */
+	GP_YUV_NV12,
+	/** @brief Y plane followed by U and V planes, 4:2:0 */
+	GP_YUV_I420,
+};
+
+/**
+ * @brief YUV color encoding.
+ */
+enum gp_yuv_flags {
+	/** @brief ITU-R BT.601 coefficients, SD video and JPEG. */
+	GP_YUV_BT601 = 0x00,
+	/** @brief ITU-R BT.709 coefficients, HD video. */
+	GP_YUV_BT709 = 0x01,
+	/** @brief Values use full 0-255 range instead of 16-235 and 16-240. */
+	GP_YUV_FULL_RANGE = 0x02,
+};
+
+/**
+ * @brief Returns a YUV format name.
+ *
+ * @param fmt A YUV format.
+ *
+ * @return A format name.
+ */
+const char *gp_yuv_fmt_name(enum gp_yuv_fmt fmt);
+
+/**
+ * @brief Returns a minimal YUV buffer size.
+ *
+ * @param fmt A YUV format.
+ * @param w An image width.
+ * @param h An image height.
+ * @param stride Bytes per row of the first plane, 0 for the minimal one.
+ *
+ * @return A buffer size in bytes.
+ */
+size_t gp_yuv_buf_size(enum gp_yuv_fmt fmt, gp_size w, gp_size h, size_t stride);
+
+/**
+ * @brief Converts a YUV buffer into a pixmap.
+ *
+ * The whole pixmap is filled, i.e. the buffer has to hold an image with the
+ * pixmap size. The pixmap rotation flags are ignored.
+ *
+ * @param buf A YUV buffer.
+ * @param stride Bytes per row of the first plane, 0 for the minimal one.
+ * @param fmt A YUV buffer format.
+ * @param flags A YUV color encoding.
+ * @param dst A RGB888, BGR888 or xRGB8888 pixmap.
+ *
+ * @return Zero on success, non-zero and errno set to EINVAL for unsupported
+ *         pixel types.
+ */
+int gp_yuv_convert(const void *buf, size_t stride, enum gp_yuv_fmt fmt,
+                   enum gp_yuv_flags flags, gp_pixmap *dst);
+
+#endif /* CORE_GP_YUV_H */
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_vline.gen.h
+ *
+ * GENERATED on 2026 10 19 15:07:31 from gp_vline.gen.h.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+#ifndef GP_VLINE_GEN_H
+#define GP_VLINE_GEN_H
+
+/*
+ * VLine generated header
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+void gp_vline_raw_1BPP_DB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_1BPP_DB_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_1BPP_UB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_1BPP_UB_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_2BPP_DB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_2BPP_DB_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_2BPP_UB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_2BPP_UB_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_4BPP_DB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_4BPP_DB_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_4BPP_UB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_4BPP_UB_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_8BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_8BPP_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_16BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_16BPP_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_24BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_24BPP_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_32BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_32BPP_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_18BPP_DB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_18BPP_DB_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+#endif /* GP_VLINE_GEN_H */
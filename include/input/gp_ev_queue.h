@@ -58,6 +58,14 @@ struct gp_ev_queue {
 	 */
 	gp_events_state state;
 
+	/** @brief Number of events dropped because the queue was full. */
+	unsigned long dropped;
+	/** @brief Number of motion events merged into an already queued event. */
+	unsigned long coalesced;
+
+	/* Set by GP_EVENT_QUEUE_COALESCE_MOTION */
+	uint8_t coalesce_motion:1;
+
 	/** @brief A circular buffer for input events. */
 	gp_event events[GP_EVENT_QUEUE_SIZE];
 };
@@ -72,6 +80,18 @@ enum gp_ev_queue_flags {
 	 * etc.
 	 */
 	GP_EVENT_QUEUE_LOAD_KEYMAP = 0x01,
+	/**
+	 * @brief Merge consecutive motion events.
+	 *
+	 * Relative motion, wheel and absolute position events are merged into
+	 * the last queued event of the same kind if the application did not
+	 * fetch it yet. This is used by backends that read raw input devices
+	 * where a touchscreen or a mouse generates bursts of motion events.
+	 *
+	 * Regardless of this flag motion events are merged rather than dropped
+	 * when the queue is full.
+	 */
+	GP_EVENT_QUEUE_COALESCE_MOTION = 0x02,
 };
 
 /**
@@ -80,7 +100,8 @@ enum gp_ev_queue_flags {
  * The queue has to be allocatedpassed as a pointer. The events array must be
  * queue_size long.
  *
- * If queue_size is set to zero, default value is expected.
+ * If queue_size is set to zero, default value is expected. The size cannot
+ * exceed #GP_EVENT_QUEUE_SIZE.
  *
  * @param self A pointer to newly allocated event queue structure.
  * @param screen_w A width of the display/window.
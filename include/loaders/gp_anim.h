@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/**
+ * @file gp_anim.h
+ * @brief Animated image reader.
+ *
+ * Animation frames are decoded one at a time and composited onto a persistent
+ * canvas according to the frame blend and disposal methods, so that the
+ * canvas always holds the complete image that should be shown. Each frame
+ * reports the canvas rectangle that has changed since the previous frame,
+ * which allows the application to update only that part of the screen.
+ *
+ * Supported formats are APNG, decoded by the internal PNG decoder, and GIF if
+ * giflib is available.
+ *
+ * @code
+ *	gp_anim *anim = gp_anim_open(path);
+ *	gp_anim_frame frame;
+ *
+ *	for (;;) {
+ *		if (gp_anim_next(anim, &frame, NULL)) {
+ *			if (errno != ENOENT || gp_anim_rewind(anim))
+ *				break;
+ *			continue;
+ *		}
+ *
+ *		gp_blit_xywh(anim->canvas, frame.x, frame.y, frame.w, frame.h,
+ *		             backend->pixmap, frame.x, frame.y);
+ *		gp_backend_update_rect_xywh(backend, frame.x, frame.y, frame.w, frame.h);
+ *
+ *		usleep(1000 * frame.delay_ms);
+ *	}
+ *
+ *	gp_anim_close(anim);
+ * @endcode
+ */
+
+#ifndef LOADERS_GP_ANIM_H
+#define LOADERS_GP_ANIM_H
+
+#include <stdint.h>
+#include <core/gp_types.h>
+#include <core/gp_progress_callback.h>
+#include <loaders/gp_types.h>
+
+typedef struct gp_anim gp_anim;
+
+/**
+ * @brief What happens with the frame area before the next frame is rendered.
+ */
+enum gp_anim_dispose {
+	/** @brief The frame is left on the canvas. */
+	GP_ANIM_DISPOSE_NONE,
+	/** @brief The frame area is cleared to transparent black. */
+	GP_ANIM_DISPOSE_BG,
+	/** @brief The frame area is restored to the state before the frame. */
+	GP_ANIM_DISPOSE_PREV,
+};
+
+/**
+ * @brief How is the frame combined with the canvas.
+ */
+enum gp_anim_blend {
+	/** @brief The frame replaces the canvas area including alpha. */
+	GP_ANIM_BLEND_SRC,
+	/** @brief The frame is alpha blended over the canvas. */
+	GP_ANIM_BLEND_OVER,
+};
+
+/**
+ * @brief A decoded frame description.
+ */
+typedef struct gp_anim_frame {
+	/** @brief How long should be the frame shown in miliseconds. */
+	uint32_t delay_ms;
+	/** @brief Canvas rectangle that changed since the previous frame. */
+	gp_coord x, y;
+	gp_size w, h;
+} gp_anim_frame;
+
+typedef struct gp_anim_ops {
+	/*
+	 * Decodes next frame into the canvas.
+	 *
+	 * Returns non-zero and sets errno to ENOENT after the last frame.
+	 */
+	int (*next)(gp_anim *self, gp_anim_frame *frame,
+	            gp_progress_cb *callback);
+
+	/*
+	 * Restarts decoding from the first frame.
+	 */
+	int (*rewind)(gp_anim *self);
+
+	/*
+	 * Frees the private data and closes the I/O.
+	 */
+	void (*close)(gp_anim *self);
+
+	int (*match)(const void *buf);
+
+	/*
+	 * Initializes the reader, the I/O is closed by close().
+	 */
+	gp_anim *(*init)(gp_io *io);
+
+	/* Short format name */
+	const char *fmt_name;
+} gp_anim_ops;
+
+struct gp_anim {
+	/** @brief RGBA8888 canvas with the current frame, owned by the reader. */
+	gp_pixmap *canvas;
+	/** @brief Number of frames, 0 if not known before the whole file is read. */
+	unsigned int frame_cnt;
+	/** @brief Number of times the animation should be played, 0 = forever. */
+	unsigned int loop_cnt;
+	/** @brief Number of frames decoded since start or the last rewind. */
+	unsigned int cur_frame;
+
+	const gp_anim_ops *ops;
+
+	/* Library private, compositing state */
+	gp_pixmap *saved;
+	gp_coord dispose_x, dispose_y;
+	gp_size dispose_w, dispose_h;
+	enum gp_anim_dispose dispose;
+
+	char priv[];
+};
+
+#define GP_ANIM_PRIV(a) ((void*)(a)->priv)
+
+/**
+ * @brief Opens an animated image.
+ *
+ * A still image in a supported format is an animation with a single frame.
+ *
+ * @param path A path to the image.
+ *
+ * @return An animation reader or NULL on a failure.
+ */
+gp_anim *gp_anim_open(const char *path);
+
+/**
+ * @brief Initializes an animation reader from an I/O.
+ *
+ * @param io A readable and seekable I/O, closed by gp_anim_close().
+ *
+ * @return An animation reader or NULL on a failure, the I/O is not closed
+ *         on a failure.
+ */
+gp_anim *gp_anim_init(gp_io *io);
+
+/**
+ * @brief Decodes next frame onto the canvas.
+ *
+ * @param self An animation reader.
+ * @param frame Filled in with the frame timing and the changed rectangle.
+ * @param callback An optional progress callback.
+ *
+ * @return Zero on success, non-zero and errno set to ENOENT after the last
+ *         frame, other errno values on a failure.
+ */
+int gp_anim_next(gp_anim *self, gp_anim_frame *frame, gp_progress_cb *callback);
+
+/**
+ * @brief Restarts the animation from the first frame.
+ *
+ * The canvas is cleared and the first frame reports the whole canvas as
+ * changed.
+ *
+ * @param self An animation reader.
+ *
+ * @return Zero on success, non-zero and errno on a failure.
+ */
+int gp_anim_rewind(gp_anim *self);
+
+/**
+ * @brief Closes the reader and frees the canvas.
+ *
+ * @param self An animation reader.
+ */
+void gp_anim_close(gp_anim *self);
+
+#endif /* LOADERS_GP_ANIM_H */
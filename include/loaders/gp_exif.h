@@ -25,6 +25,18 @@
  */
 int gp_read_exif(gp_io *io, gp_storage *storage, gp_correction_desc *corr_desc);
 
+/**
+ * @brief Reads the JPEG thumbnail stored in the EXIF IFD1.
+ *
+ * @io An input I/O stream starting at the EXIF signature.
+ * @img A pointer to store the decoded thumbnail to.
+ * @callback An optional progress callback.
+ *
+ * @return Zero on success, non-zero and errno set to ENOENT if there is no
+ *         thumbnail.
+ */
+int gp_read_exif_thumbnail(gp_io *io, gp_pixmap **img, gp_progress_cb *callback);
+
 /*
  * Looks for EXIF file signature. Returns non-zero if found.
  */
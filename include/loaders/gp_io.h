@@ -13,6 +13,8 @@
 #define LOADERS_GP_IO_H
 
 #include <stdint.h>
+#include <string.h>
+#include <errno.h>
 #include <sys/types.h>
 #include <utils/gp_seek.h>
 #include <loaders/gp_types.h>
@@ -22,8 +24,21 @@ struct gp_io {
 	ssize_t (*write)(gp_io *self, const void *buf, size_t size);
 	off_t (*seek)(gp_io *self, off_t off, enum gp_seek_whence whence);
 	int (*close)(gp_io *self);
+	/* Optional, NULL if the I/O cannot map its data, see gp_io_map() */
+	const void *(*map)(gp_io *self, off_t off, size_t size);
 
 	off_t mark;
+
+	/*
+	 * Read buffer window, non-empty for gp_io_rbuffer() and for I/Os backed
+	 * by memory, i.e. gp_io_mem() and gp_io_mmap(). Used by the inline
+	 * gp_io_getb(), gp_io_peek() and gp_io_skip() fast path.
+	 *
+	 * Has to be set to NULL by all other I/O implementations.
+	 */
+	uint8_t *rbuf_pos;
+	uint8_t *rbuf_end;
+
 	char priv[];
 };
 
@@ -64,6 +79,9 @@ static inline int gp_io_getb(gp_io *io)
 {
 	unsigned char c;
 
+	if (io->rbuf_pos < io->rbuf_end)
+		return *(io->rbuf_pos++);
+
 	if (io->read(io, &c, 1) != 1)
 		return -1;
 
@@ -88,6 +106,11 @@ static inline off_t gp_io_rewind(gp_io *io)
 
 static inline off_t gp_io_peek(gp_io *io, void *buf, size_t size)
 {
+	if ((size_t)(io->rbuf_end - io->rbuf_pos) >= size) {
+		memcpy(buf, io->rbuf_pos, size);
+		return gp_io_tell(io);
+	}
+
 	off_t cur_off = gp_io_tell(io);
 
 	if (gp_io_read(io, buf, size) != (ssize_t)size)
@@ -96,6 +119,40 @@ static inline off_t gp_io_peek(gp_io *io, void *buf, size_t size)
 	return gp_io_seek(io, cur_off, GP_SEEK_SET);
 }
 
+/*
+ * Skips size bytes in the I/O stream.
+ *
+ * Returns zero on success, non-zero on failure.
+ */
+static inline int gp_io_skip(gp_io *io, size_t size)
+{
+	if ((size_t)(io->rbuf_end - io->rbuf_pos) >= size) {
+		io->rbuf_pos += size;
+		return 0;
+	}
+
+	return gp_io_seek(io, size, GP_SEEK_CUR) == -1;
+}
+
+/*
+ * Returns a pointer to size bytes of the I/O data starting at absolute offset
+ * off, the data are not copied. The pointer is valid until the I/O is closed
+ * and must not be written to. The I/O offset is not changed.
+ *
+ * This is supported by I/Os backed by memory, i.e. gp_io_mem(), gp_io_mmap()
+ * and the gp_io_sub_io() and gp_io_rbuffer() on the top of these. Otherwise
+ * NULL is returned and errno is set to ENOSYS. If the range is outside of the
+ * I/O data NULL is returned and errno is set to EINVAL.
+ */
+static inline const void *gp_io_map(gp_io *io, off_t off, size_t size)
+{
+	if (!io->map) {
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	return io->map(io, off, size);
+}
 
 /*
  * Returns I/O stream size.
@@ -205,6 +262,19 @@ gp_io *gp_io_file(const char *path, enum gp_io_file_mode mode);
  */
 gp_io *gp_io_mem(void *buf, size_t size, void (*free)(void *));
 
+/*
+ * Creates read-only I/O from a memory mapped file.
+ *
+ * All reads are served directly from the mapping and gp_io_map() is
+ * supported. Fails with ENOSYS if mmap() is not available and with EINVAL for
+ * empty or non-mappable files, use gp_io_file() as a fallback.
+ *
+ * The image loading functions use buffered file I/O, pass the mmap I/O to
+ * gp_read_image_ex() to read an image from the mapping. Note that reading from
+ * a file that has been truncated after it was mapped raises SIGBUS.
+ */
+gp_io *gp_io_mmap(const char *path);
+
 /*
  * Create a sub I/O from an I/O.
  *
@@ -225,4 +295,20 @@ gp_io *gp_io_sub_io(gp_io *pio, size_t size);
  */
 gp_io *gp_io_wbuffer(gp_io *pio, size_t bsize);
 
+/*
+ * Creates a readable buffered I/O on the top of the existing I/O.
+ *
+ * Small reads, gp_io_getb() and gp_io_peek() are served from the buffer,
+ * seeks inside of the buffered data do not touch the parent I/O. Reads larger
+ * than the buffer bypass it.
+ *
+ * The parent I/O is not closed on gp_io_close().
+ *
+ * WARNING: If you combine reading/seeking in the buffered I/O and parent I/O
+ *          the result is undefined.
+ *
+ * Passing zero as bsize select default buffer size.
+ */
+gp_io *gp_io_rbuffer(gp_io *pio, size_t bsize);
+
 #endif /* LOADERS_GP_IO_H */
@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/**
+ * @file gp_load_queue.h
+ * @brief Asynchronous image loading.
+ *
+ * A load queue decodes images on a pool of worker threads. Requests are
+ * embedded into application structures, filled in and passed to
+ * gp_load_queue_add(), higher priority requests are decoded first. Finished
+ * requests are returned by gp_load_queue_get() and the gp_load_queue_fd() file
+ * descriptor is readable whenever there are finished requests, so that the
+ * queue can be added to a #gp_poll, e.g. a backend or widgets event loop.
+ *
+ * Decoded images that were not fetched by the application yet are accounted
+ * and workers stop picking new requests once the limit is reached, which
+ * makes it safe to prefetch a long list of images.
+ *
+ * @code
+ * static enum gp_poll_event_ret load_done(gp_fd *self)
+ * {
+ *	gp_load_req *req;
+ *
+ *	while ((req = gp_load_queue_get(self->priv))) {
+ *		if (req->img)
+ *			...
+ *	}
+ *
+ *	return GP_POLL_RET_OK;
+ * }
+ *
+ * ...
+ *	gp_load_queue *queue = gp_load_queue_create(0, 64 * 1024 * 1024);
+ *
+ *	gp_fd fd = {
+ *		.fd = gp_load_queue_fd(queue),
+ *		.event = load_done,
+ *		.events = GP_POLLIN,
+ *		.priv = queue,
+ *	};
+ *
+ *	gp_backend_poll_add(backend, &fd);
+ * @endcode
+ */
+
+#ifndef LOADERS_GP_LOAD_QUEUE_H
+#define LOADERS_GP_LOAD_QUEUE_H
+
+#include <core/gp_types.h>
+#include <loaders/gp_types.h>
+#include <loaders/gp_data_storage.h>
+
+typedef struct gp_load_queue gp_load_queue;
+
+/**
+ * @brief A cancellation token.
+ *
+ * A token may be shared between any number of requests, once cancelled all of
+ * them finish with ECANCELED error as soon as possible.
+ */
+typedef struct gp_load_token {
+	/** @brief Set by gp_load_token_cancel(). */
+	int cancelled;
+} gp_load_token;
+
+/**
+ * @brief Cancels all requests that use the token.
+ *
+ * Can be called from any thread.
+ *
+ * @param self A cancellation token.
+ */
+static inline void gp_load_token_cancel(gp_load_token *self)
+{
+	__atomic_store_n(&self->cancelled, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Returns non-zero if token was cancelled.
+ *
+ * @param self A cancellation token.
+ */
+static inline int gp_load_token_cancelled(gp_load_token *self)
+{
+	return self && __atomic_load_n(&self->cancelled, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief A load request.
+ *
+ * Owned by the application, must not be modified or freed until it's
+ * returned from gp_load_queue_get().
+ */
+typedef struct gp_load_req {
+	/** @brief A path to load the image from, or NULL if io is set. */
+	const char *path;
+	/**
+	 * @brief An I/O to read the image from, used if path is NULL.
+	 *
+	 * The I/O is not closed by the queue.
+	 */
+	gp_io *io;
+	/** @brief Requests with higher priority are decoded first. */
+	int priority;
+	/**
+	 * @brief Optional size hint.
+	 *
+	 * If non-zero the image is loaded with gp_load_image_scaled().
+	 */
+	gp_size w, h;
+	/** @brief An optional cancellation token. */
+	gp_load_token *token;
+	/** @brief An optional storage for the image meta data. */
+	gp_storage *meta_data;
+	/** @brief User private pointer, not used by the library. */
+	void *priv;
+
+	/** @brief Resulting image, owned by the application. */
+	gp_pixmap *img;
+	/** @brief An errno, zero on success. */
+	int err;
+
+	/* Library private */
+	struct gp_load_req *next;
+} gp_load_req;
+
+/**
+ * @brief Creates a load queue.
+ *
+ * @param threads A number of worker threads, 0 means one per CPU.
+ * @param max_bytes Soft limit for decoded images that were not fetched by
+ *                  gp_load_queue_get() yet, 0 means no limit. A single image
+ *                  larger than the limit is still decoded.
+ *
+ * @return A new load queue or NULL on a failure, errno is set to ENOSYS if
+ *         the library was compiled without pthread.
+ */
+gp_load_queue *gp_load_queue_create(unsigned int threads, size_t max_bytes);
+
+/**
+ * @brief Destroys a load queue.
+ *
+ * Waits for images that are being decoded to finish, frees images that were
+ * not fetched and drops all pending requests.
+ *
+ * @param self A load queue.
+ */
+void gp_load_queue_destroy(gp_load_queue *self);
+
+/**
+ * @brief Adds a load request.
+ *
+ * @param self A load queue.
+ * @param req A filled in request.
+ */
+void gp_load_queue_add(gp_load_queue *self, gp_load_req *req);
+
+/**
+ * @brief Returns a finished request.
+ *
+ * Does not block. The requests are returned in the order they were finished,
+ * if req->img is NULL the req->err is set to errno.
+ *
+ * @param self A load queue.
+ *
+ * @return A finished request or NULL if there is none.
+ */
+gp_load_req *gp_load_queue_get(gp_load_queue *self);
+
+/**
+ * @brief Returns a file descriptor to poll for finished requests.
+ *
+ * The fd is readable while gp_load_queue_get() returns requests, it must not
+ * be read by the application.
+ *
+ * @param self A load queue.
+ *
+ * @return A pollable file descriptor.
+ */
+int gp_load_queue_fd(gp_load_queue *self);
+
+/**
+ * @brief Load queue statistics.
+ */
+typedef struct gp_load_queue_stats {
+	/** @brief Requests waiting for a worker. */
+	size_t pending;
+	/** @brief Requests finished but not fetched yet. */
+	size_t done;
+	/** @brief Size of the not fetched images in bytes. */
+	size_t done_bytes;
+} gp_load_queue_stats;
+
+/**
+ * @brief Returns load queue statistics.
+ *
+ * @param self A load queue.
+ * @param stats Filled in with the statistics.
+ */
+void gp_load_queue_stats_get(gp_load_queue *self, gp_load_queue_stats *stats);
+
+#endif /* LOADERS_GP_LOAD_QUEUE_H */
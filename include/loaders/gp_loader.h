@@ -40,6 +40,42 @@ int gp_load_image_ex(const char *src_path,
                      gp_pixmap **img, gp_storage *meta_data,
                      gp_progress_cb *callback);
 
+/*
+ * Loads an image downscaled to at least w x h pixels.
+ *
+ * Loaders that can decode a smaller image cheaply, e.g. JPEG, return an image
+ * downscaled by an integer factor, that is never smaller than w x h unless the
+ * original image is smaller. Other loaders return the image in full size.
+ * Either way the result has to be resized to exactly w x h by the caller.
+ *
+ * Passing zero as w or h means no constraint in that direction.
+ */
+gp_pixmap *gp_load_image_scaled(const char *src_path, gp_size w, gp_size h,
+                                gp_progress_cb *callback);
+
+int gp_load_image_scaled_ex(const char *src_path,
+                            gp_pixmap **img, gp_storage *meta_data,
+                            gp_size w, gp_size h, gp_progress_cb *callback);
+
+/*
+ * Same as gp_load_image_scaled() but reads the image from an I/O stream.
+ */
+int gp_read_image_scaled_ex(gp_io *io, gp_pixmap **img, gp_storage *meta_data,
+                            gp_size w, gp_size h, gp_progress_cb *callback);
+
+/*
+ * Loads an image preview of at least min_w x min_h pixels.
+ *
+ * If the file contains an embedded thumbnail, e.g. EXIF IFD1 JPEG thumbnail or
+ * PSD thumbnail resource, that is large enough it's returned without decoding
+ * the image itself. Otherwise falls back to gp_load_image_scaled(), hence the
+ * result has to be resized to exactly the desired size by the caller.
+ *
+ * Passing zero as min_w or min_h means no constraint in that direction.
+ */
+gp_pixmap *gp_load_thumbnail(const char *src_path, gp_size min_w, gp_size min_h,
+                             gp_progress_cb *callback);
+
 /*
  * Loads image Meta Data (if possible).
  */
@@ -62,6 +98,79 @@ int gp_load_meta_data(const char *src_path, gp_storage *storage);
 int gp_save_image(const gp_pixmap *src, const char *dst_path,
                   gp_progress_cb *callback);
 
+/*
+ * Encoder speed/size trade-off presets.
+ */
+enum gp_save_preset {
+	/* Library defaults */
+	GP_SAVE_PRESET_DEFAULT = 0,
+	/* Fastest encoding, e.g. zlib level 1 and no PNG filter search */
+	GP_SAVE_PRESET_FASTEST,
+	/* Smallest output, slow */
+	GP_SAVE_PRESET_SMALLEST,
+};
+
+/*
+ * Compression for formats that support more than one, i.e. TIFF.
+ */
+enum gp_save_compress {
+	GP_SAVE_COMPRESS_DEFAULT = 0,
+	GP_SAVE_COMPRESS_NONE,
+	GP_SAVE_COMPRESS_DEFLATE,
+	GP_SAVE_COMPRESS_LZW,
+	GP_SAVE_COMPRESS_PACKBITS,
+};
+
+/*
+ * Chroma subsampling for JPEG.
+ */
+enum gp_save_subsampling {
+	GP_SAVE_SUBSAMPLING_DEFAULT = 0,
+	GP_SAVE_SUBSAMPLING_444,
+	GP_SAVE_SUBSAMPLING_422,
+	GP_SAVE_SUBSAMPLING_420,
+};
+
+enum gp_save_flags {
+	/* Progressive JPEG */
+	GP_SAVE_PROGRESSIVE = 0x01,
+};
+
+/*
+ * Encoder options.
+ *
+ * Zero means default for all the fields, so the structure should be zero
+ * initialized and only the interesting fields set, which also makes it
+ * possible to add new fields later. The explicitly set fields take precedence
+ * over the preset. Options that are not supported by an encoder are ignored.
+ */
+typedef struct gp_save_opts {
+	enum gp_save_preset preset;
+
+	/* Compression level from 1 (fastest) to 9 (smallest), PNG and TIFF */
+	int compress_level;
+
+	enum gp_save_compress compress;
+
+	/* Quality from 1 to 100, JPEG */
+	int quality;
+
+	enum gp_save_subsampling subsampling;
+
+	enum gp_save_flags flags;
+} gp_save_opts;
+
+/*
+ * Options for throughput-bound pipelines.
+ */
+#define GP_SAVE_OPTS_FASTEST (&(const gp_save_opts){.preset = GP_SAVE_PRESET_FASTEST})
+
+/*
+ * Same as gp_save_image() but with encoder options, opts may be NULL.
+ */
+int gp_save_image_ex(const gp_pixmap *src, const char *dst_path,
+                     const gp_save_opts *opts, gp_progress_cb *callback);
+
 typedef struct gp_loader gp_loader;
 
 /*
@@ -74,6 +183,21 @@ struct gp_loader {
 	int (*read)(gp_io *io, gp_pixmap **img, gp_storage *storage,
                     gp_progress_cb *callback);
 
+	/*
+	 * Optional, reads an image downscaled to at least w x h, see
+	 * gp_load_image_scaled().
+	 */
+	int (*read_scaled)(gp_io *io, gp_pixmap **img, gp_storage *storage,
+	                   gp_size w, gp_size h, gp_progress_cb *callback);
+
+	/*
+	 * Optional, reads an embedded thumbnail, see gp_load_thumbnail().
+	 *
+	 * Returns non-zero and sets errno to ENOENT if there is none.
+	 */
+	int (*read_thumbnail)(gp_io *io, gp_pixmap **img,
+	                      gp_progress_cb *callback);
+
 	/*
 	 * Writes an image into an I/O stream.
 	 *
@@ -82,6 +206,15 @@ struct gp_loader {
 	int (*write)(const gp_pixmap *src, gp_io *io,
 	             gp_progress_cb *callback);
 
+	/*
+	 * Optional, writes an image with encoder options, opts may be NULL.
+	 *
+	 * Loaders that do not implement it are saved with write() and the
+	 * options are ignored.
+	 */
+	int (*write_ex)(const gp_pixmap *src, gp_io *io,
+	                const gp_save_opts *opts, gp_progress_cb *callback);
+
 	/*
 	 * GP_PIXEL_UNKNOWN terminated array of formats loader supports for save.
 	 *
@@ -180,6 +313,22 @@ int gp_loader_load_image_ex(const gp_loader *self, const char *src_path,
 int gp_loader_save_image(const gp_loader *self, const gp_pixmap *src,
                          const char *dst_path, gp_progress_cb *callback);
 
+/*
+ * Generic SaveImageEx for a given loader, opts may be NULL.
+ */
+int gp_loader_save_image_ex(const gp_loader *self, const gp_pixmap *src,
+                            const char *dst_path, const gp_save_opts *opts,
+                            gp_progress_cb *callback);
+
+/*
+ * Generic WriteImageEx for a given loader, opts may be NULL.
+ *
+ * The function calls the loader WriteEx() or Write() method for a given I/O.
+ */
+int gp_loader_write_image_ex(const gp_loader *self, const gp_pixmap *src,
+                             gp_io *io, const gp_save_opts *opts,
+                             gp_progress_cb *callback);
+
 /*
  * List loaders into the stdout
  */
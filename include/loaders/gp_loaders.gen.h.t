@@ -40,5 +40,12 @@ static inline int gp_save_{{fmt}}(const gp_pixmap *src, const char *dst_path,
 	return gp_loader_save_image(&gp_{{fmt}}, src, dst_path, callback);
 }
 
+static inline int gp_save_{{fmt}}_ex(const gp_pixmap *src, const char *dst_path,
+                                 const gp_save_opts *opts,
+                                 gp_progress_cb *callback)
+{
+	return gp_loader_save_image_ex(&gp_{{fmt}}, src, dst_path, opts, callback);
+}
+
 @ for fmt in ['ico', 'webp', 'jp2', 'pcx', 'gif', 'psp', 'psd']:
 {@ reader(fmt) @}
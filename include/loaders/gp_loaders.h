@@ -24,6 +24,8 @@
 #include <loaders/gp_exif.h>
 
 #include <loaders/gp_loader.h>
+#include <loaders/gp_load_queue.h>
+#include <loaders/gp_anim.h>
 
 #include <loaders/gp_container.h>
 #include <loaders/gp_zip.h>
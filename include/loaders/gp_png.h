@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+   Internal PNG decoder, used by gp_read_png_ex() when gfxprim is compiled
+   without libpng. It's always compiled in and exported so that it could be
+   tested and benchmarked against libpng, you shouldn't need to call it
+   directly otherwise.
+
+ */
+
+#ifndef LOADERS_GP_PNG_H
+#define LOADERS_GP_PNG_H
+
+#include <loaders/gp_loader.h>
+
+/*
+ * Decodes PNG image of any color type and bit depth, including Adam7
+ * interlaced images, pixel types match the libpng code.
+ *
+ * Returns zero on success, non-zero on failure and errno is set.
+ */
+int gp_read_png_int_ex(gp_io *io, gp_pixmap **img, gp_storage *storage,
+                       gp_progress_cb *callback);
+
+#endif /* LOADERS_GP_PNG_H */
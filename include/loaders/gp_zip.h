@@ -21,6 +21,9 @@ gp_container *gp_open_zip(const char *path);
 /*
  * Creates a new ZIP container from an io. No check are done, the caller is
  * supposed to use gp_match_zip() to check for the zip signature.
+ *
+ * If the io is seekable the central directory is parsed, which sets the
+ * img_count and makes seeks constant time. The io is not closed on a failure.
  */
 gp_container *gp_init_zip(gp_io *io);
 
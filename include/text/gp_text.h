@@ -20,6 +20,7 @@
 #include <core/gp_compiler.h>
 #include <text/gp_text_style.h>
 #include <text/gp_text_metric.h>
+#include <text/gp_text_cache.h>
 #include <text/gp_fonts.h>
 
 /**
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/**
+ * @file gp_text_cache.h
+ * @brief A shaped text run cache.
+ *
+ * Widgets tend to measure and draw the same strings over and over again. The
+ * text run cache stores decoded characters and glyph positions for a string
+ * rendered in a given #gp_text_style so that repeated metric queries and
+ * drawing do not have to decode UTF-8 and lay out glyphs again.
+ *
+ * The cache is keyed by the text style content (font face and all the
+ * multipliers and spacings) and by the string, hence a change of a style
+ * simply causes cache misses. Entries for a font face are dropped when the
+ * font face is freed by gp_font_face_free().
+ *
+ * The cache is per thread and disabled by default. Once enabled by
+ * gp_text_cache_init() the text metric and drawing functions called from
+ * that thread use it transparently. Flushing runs for a font face from any
+ * thread drops all runs cached by the other threads on their next lookup, so
+ * that a freed font face is never matched against a stale run.
+ */
+
+#ifndef TEXT_GP_TEXT_CACHE_H
+#define TEXT_GP_TEXT_CACHE_H
+
+#include <stdint.h>
+#include <core/gp_types.h>
+#include <text/gp_text_style.h>
+#include <text/gp_text_metric.h>
+
+/**
+ * @brief Maximal string length in bytes stored in the cache.
+ *
+ * Longer strings are measured and drawn without the cache.
+ */
+#define GP_TEXT_RUN_MAX_BYTES 512
+
+/**
+ * @brief A shaped text run.
+ */
+typedef struct gp_text_run {
+	/** @brief A string and style hash. */
+	uint32_t hash;
+	/** @brief A number of glyphs (unicode characters) in the run. */
+	size_t len;
+	/** @brief A copy of the style used to shape the run. */
+	gp_text_style style;
+	/**
+	 * @brief Glyph start offsets.
+	 *
+	 * An array of len + 1 offsets, the pos[i] is the sum of all glyph
+	 * advances before the i-th glyph, i.e. the value returned for
+	 * GP_TEXT_LEN_ADVANCE without the bearing of the next glyph.
+	 */
+	gp_size *pos;
+	/**
+	 * @brief An array of len unicode characters.
+	 *
+	 * Glyphs are looked up on each use since font faces may free glyphs
+	 * evicted from their glyph caches.
+	 */
+	uint32_t *chars;
+	/** @brief A copy of the string. */
+	const char *str;
+} gp_text_run;
+
+/**
+ * @brief Enables the text run cache for the calling thread.
+ *
+ * @param order A log2 of the number of cache slots, if unsure pass 0.
+ *
+ * @return Zero on success, non-zero on allocation failure.
+ */
+int gp_text_cache_init(unsigned int order);
+
+/**
+ * @brief Disables the text run cache for the calling thread.
+ *
+ * Frees all cached runs.
+ */
+void gp_text_cache_exit(void);
+
+/**
+ * @brief Drops cached runs.
+ *
+ * Runs cached by other threads are dropped on their next lookup.
+ *
+ * @param font Drops only runs shaped with the font face, if NULL all cached
+ *             runs are dropped.
+ */
+void gp_text_cache_flush(const gp_font_face *font);
+
+/**
+ * @brief Looks up a cached run or shapes and inserts a new one.
+ *
+ * @param style A text style, NULL for the default style.
+ * @param str An UTF-8 string.
+ *
+ * @return A shaped run or NULL if the cache is disabled, the string is too
+ *         long or on allocation failure. The run is valid until the next
+ *         call to any of the text functions.
+ */
+const gp_text_run *gp_text_run_get(const gp_text_style *style, const char *str);
+
+/**
+ * @brief Calculates the width of the first len glyphs in a run.
+ *
+ * Returns exactly the same value gp_text_width_len() would have returned for
+ * the string the run was shaped from.
+ *
+ * @param run A shaped text run.
+ * @param type Select if we want a bounding box or advance.
+ * @param len Maximal number of glyphs.
+ *
+ * @return Width in pixels.
+ */
+gp_size gp_text_run_width_len(const gp_text_run *run,
+                              enum gp_text_len_type type, size_t len);
+
+/**
+ * @brief Text cache statistics.
+ */
+typedef struct gp_text_cache_stats {
+	/** @brief Number of lookups that found a run. */
+	unsigned long hits;
+	/** @brief Number of lookups that had to shape a run. */
+	unsigned long misses;
+	/** @brief Number of runs currently in the cache. */
+	unsigned int used;
+	/** @brief Number of cache slots. */
+	unsigned int size;
+} gp_text_cache_stats;
+
+/**
+ * @brief Returns the text run cache statistics for the calling thread.
+ *
+ * @param stats A pointer to be filled in.
+ */
+void gp_text_cache_stats_get(gp_text_cache_stats *stats);
+
+#endif /* TEXT_GP_TEXT_CACHE_H */
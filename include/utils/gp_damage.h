@@ -0,0 +1,77 @@
+//SPDX-License-Identifier: LGPL-2.0-or-later
+
+/*
+
+   Copyright (c) 2026 Cyril Hrubis <metan@ucw.cz>
+
+ */
+
+/**
+ * @file gp_damage.h
+ * @brief A damaged region tracking.
+ *
+ * A damaged region is a short list of non-overlapping rectangles that
+ * describes which parts of a pixmap have changed. Rectangles that overlap, or
+ * that would not waste too much area when merged, are merged on insertion so
+ * that the list stays short. Once the list is full the new rectangle is merged
+ * with the existing rectangle that wastes the least area when merged with it.
+ */
+
+#ifndef GP_DAMAGE_H
+#define GP_DAMAGE_H
+
+#include <utils/gp_bbox.h>
+
+/** @brief Maximal number of rectangles in a damaged region. */
+#define GP_DAMAGE_RECTS 8
+
+/**
+ * @brief A damaged region.
+ */
+typedef struct gp_damage {
+	/** @brief Number of rectangles in the region. */
+	unsigned int cnt;
+	/** @brief Non-overlapping rectangles. */
+	gp_bbox rects[GP_DAMAGE_RECTS];
+} gp_damage;
+
+/**
+ * @brief Returns true if damaged region is empty.
+ *
+ * @param self A damaged region.
+ *
+ * @return True if there are no rectangles in the region.
+ */
+static inline int gp_damage_empty(const gp_damage *self)
+{
+	return !self->cnt;
+}
+
+/**
+ * @brief Clears damaged region.
+ *
+ * @param self A damaged region.
+ */
+static inline void gp_damage_clear(gp_damage *self)
+{
+	self->cnt = 0;
+}
+
+/**
+ * @brief Adds a rectangle to a damaged region.
+ *
+ * @param self A damaged region.
+ * @param rect A rectangle to add, empty rectangles are ignored.
+ */
+void gp_damage_add(gp_damage *self, gp_bbox rect);
+
+/**
+ * @brief Returns a bounding box of the whole damaged region.
+ *
+ * @param self A damaged region.
+ *
+ * @return A bounding box that contains all rectangles in the region.
+ */
+gp_bbox gp_damage_bbox(const gp_damage *self);
+
+#endif /* GP_DAMAGE_H */
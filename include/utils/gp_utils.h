@@ -20,6 +20,7 @@
 #include <utils/gp_block_alloc.h>
 #include <utils/gp_poll.h>
 #include <utils/gp_bbox.h>
+#include <utils/gp_damage.h>
 #include <utils/gp_list.h>
 #include <utils/gp_json.h>
 #include <utils/gp_utf.h>
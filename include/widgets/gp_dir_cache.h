@@ -13,6 +13,10 @@
  * This implements an data structure to cache a directory content so that it
  * can be listed in an alphabetical order. It also listens for a inotify events
  * so the list is updated whenever the directory content changes.
+ *
+ * Large directories are loaded incrementally, gp_dir_cache_new() reads only
+ * the first batch of entries and the rest, along with the entries size and
+ * modification time, is loaded by repeated gp_dir_cache_populate() calls.
  */
 
 #ifndef GP_DIR_CACHE_H
@@ -30,9 +34,11 @@ typedef struct gp_dir_entry {
 	/** @brief Length of the entry name. */
 	unsigned int name_len;
 	/** @brief Set if entry is a directory. */
-	int is_dir:1;
+	unsigned int is_dir:1;
 	/** @brief If set the entry is hidden from listing. */
-	int filtered:1;
+	unsigned int filtered:1;
+	/** @brief Set if size and mtime were not loaded yet. */
+	unsigned int stat_pending:1;
 	/** @brief Entry name. */
 	char name[];
 } gp_dir_entry;
@@ -65,6 +71,15 @@ typedef struct gp_dir_cache {
 	size_t used;
 	/** @brief An array of dir cache entres sorted accordingly to sort_type. */
 	gp_dir_entry **entries;
+	/**
+	 * @brief Positions of not-filtered entries in the entries array.
+	 *
+	 * Rebuilt on demand by gp_dir_cache_get_filtered() after the entries
+	 * or the filter flags has been changed.
+	 */
+	unsigned int *filtered_idx;
+	/** @brief Set if filtered_idx is up to date. */
+	unsigned int filtered_idx_valid:1;
 } gp_dir_cache;
 
 /**
@@ -74,6 +89,9 @@ typedef struct gp_dir_cache {
  * path. If supported the directory is also set up to with an inotify watch in
  * order to update the listing whenever the directory content changes.
  *
+ * Only the first batch of entries is loaded, which is the whole directory
+ * unless it's large, call gp_dir_cache_populate() to load the rest.
+ *
  * @param path A path to load the cache entries from.
  *
  * @return Newly allocated and populated directory cache or NULL in case of
@@ -81,6 +99,22 @@ typedef struct gp_dir_cache {
  */
 gp_dir_cache *gp_dir_cache_new(const char *path);
 
+/**
+ * @brief Loads next batch of entries or entries metadata.
+ *
+ * Directory entries are read first, the batch is merged into the sorted
+ * listing. Then size and modification time is looked up for entries whose
+ * gp_dir_entry::stat_pending flag is set. This is meant to be called
+ * repeatedly from an application task so that UI stays responsive while
+ * large directories are loaded.
+ *
+ * @param self A directory cache.
+ *
+ * @return Non-zero if there is more work to do, zero once the cache is fully
+ *         loaded.
+ */
+int gp_dir_cache_populate(gp_dir_cache *self);
+
 /**
  * @brief Destroys a directory cache.
  *
@@ -106,6 +140,18 @@ void gp_dir_cache_destroy(gp_dir_cache *self);
 gp_dir_entry *gp_dir_cache_add_entry(gp_dir_cache *self, size_t size,
                                      const char *name, mode_t mode, time_t mtime);
 
+/**
+ * @brief Merges entries added after a position into the sorted listing.
+ *
+ * This function is called by the platform code after a batch of entries has
+ * been added to the cache. The new entries are sorted and merged with the
+ * already sorted entries, which is cheaper than sorting the whole cache.
+ *
+ * @param self A directory cache.
+ * @param first_new A position of the first entry in the batch.
+ */
+void gp_dir_cache_merge(gp_dir_cache *self, size_t first_new);
+
 /**
  * @brief Removes an entry from directory cache.
  *
@@ -122,7 +168,8 @@ int gp_dir_cache_rem_entry_by_name(gp_dir_cache *self, const char *name);
  * @brief Looks up an entry based on a file name
  *
  * @param self A directory cache.
- * @param name An entry name to look for.
+ * @param name An entry name to look for, the trailing slash for directories
+ *             is optional.
  *
  * @return An directory entry on NULL if there is no such entry
  */
@@ -190,6 +237,7 @@ static inline void gp_dir_cache_set_filter(gp_dir_cache *self, unsigned int pos,
 
 	self->entries[pos]->filtered = !!filter;
 	self->filtered += filter ? 1 : -1;
+	self->filtered_idx_valid = 0;
 }
 
 /**
@@ -219,6 +267,9 @@ static inline size_t gp_dir_cache_entries_filter(gp_dir_cache *self)
 /**
  * @brief Returns entry on position pos ignoring filtered out elements.
  *
+ * The first call after the entries or filter flags changed builds an index of
+ * the not-filtered entries, subsequent calls are O(1).
+ *
  * @param self A directory cache.
  * @param pos Element position in the gp_dir_cache::entries array.
  *
@@ -10,6 +10,12 @@
  * @file gp_widget_graph.h
  * @brief An XY graph.
  *
+ * Graphs with more data points than pixel columns are drawn from minimum and
+ * maximum per pixel column, points and line markers are drawn only for the
+ * column minimum and maximum. If the data are sorted by x and the graph window
+ * only moves to the right, the already rendered part of the graph is moved
+ * and only the new columns are drawn.
+ *
  * Graph widget JSON attributes
  * ----------------------------
  *
@@ -97,6 +103,21 @@ gp_widget *gp_widget_graph_new(gp_widget_size min_w, gp_widget_size min_h,
  */
 void gp_widget_graph_point_add(gp_widget *self, double x, double y);
 
+/**
+ * @brief Adds a batch of graph points.
+ *
+ * Same as calling gp_widget_graph_point_add() for each point but the graph is
+ * redrawn only once. The graph minimum and maximum are updated in amortized
+ * constant time per point.
+ *
+ * @param self A graph widget.
+ * @param points An array of data points.
+ * @param cnt A number of points in the array.
+ */
+void gp_widget_graph_points_add(gp_widget *self,
+                                const struct gp_widget_graph_point *points,
+                                size_t cnt);
+
 /**
  * @brief Sets a graph style.
  *
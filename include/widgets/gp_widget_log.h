@@ -34,12 +34,28 @@
  */
 void gp_widget_log_append(gp_widget *self, const char *text);
 
+/**
+ * @brief Appends an array of lines to the log.
+ *
+ * Same as calling gp_widget_log_append() for each line but the widget is
+ * redrawn only once.
+ *
+ * @param self A log widget.
+ * @param lines An array of strings.
+ * @param cnt A number of strings in the array.
+ */
+void gp_widget_log_append_lines(gp_widget *self, const char *const lines[], size_t cnt);
+
 /**
  * @brief Allocates a log widget.
  *
  * The log widget is a circular buffer of loglines, when size reaches the
  * max_log_lines the oldest message gets removed from the log.
  *
+ * The text of the log lines is stored in a single ring buffer and the line
+ * wrapping is cached. When lines are appended the text already on the screen
+ * is moved up and only the new lines are rendered.
+ *
  * @param tattr Text attributes
  * @param min_width Minimal width in letters
  * @param min_lines Minimal number of lines
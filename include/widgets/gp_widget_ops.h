@@ -328,10 +328,7 @@ static inline void gp_widget_ops_blit(const gp_widget_render_ctx *ctx,
 	if (!ctx->flip)
 		return;
 
-	if (gp_bbox_empty(*ctx->flip))
-		*ctx->flip = gp_bbox_pack(x, y, w, h);
-	else
-		*ctx->flip = gp_bbox_merge(*ctx->flip, gp_bbox_pack(x, y, w, h));
+	gp_damage_add(ctx->flip, gp_bbox_pack(x, y, w, h));
 }
 
 /**
@@ -19,6 +19,7 @@
 #include <text/gp_text.h>
 #include <utils/gp_timer.h>
 #include <utils/gp_bbox.h>
+#include <utils/gp_damage.h>
 
 #include <widgets/gp_widget_types.h>
 #include <widgets/gp_widgets_color_scheme.h>
@@ -115,8 +116,8 @@ struct gp_widget_render_ctx {
 	uint16_t dclick_ms;
 	/* feedback delay, how long should be button pressed, tbox red etc */
 	uint16_t feedback_ms;
-	/* area to update on a screen after a call to gp_widget_render() */
-	gp_bbox *flip;
+	/* areas to update on a screen after a call to gp_widget_render() */
+	gp_damage *flip;
 
 	/* passed down if only part of the layout has to be rendered */
 	gp_bbox *bbox;
@@ -198,6 +199,56 @@ void gp_widgets_main_loop(struct gp_widget *layout,
                           int argc, char *argv[])
                           __attribute__((noreturn));
 
+/**
+ * @brief Frame scheduler statistics.
+ */
+typedef struct gp_widgets_frame_stats {
+	/** @brief Number of frames rendered. */
+	unsigned long frames;
+	/** @brief Number of frames rendered immediately after an input event. */
+	unsigned long immediate;
+	/** @brief Number of redraw requests merged into a later frame. */
+	unsigned long coalesced;
+	/** @brief Render time of the last frame in microseconds. */
+	uint32_t last_us;
+	/** @brief Maximal frame render time in microseconds. */
+	uint32_t max_us;
+	/** @brief Sum of all frame render times in microseconds. */
+	uint64_t total_us;
+} gp_widgets_frame_stats;
+
+/**
+ * @brief Sets the minimal interval between two frames.
+ *
+ * The widgets main loop renders at most one frame per interval, redraw
+ * requests that come in between, e.g. from timers or from a flood of events,
+ * are merged into the next frame. Default is 16ms, i.e. about 60 frames per
+ * second.
+ *
+ * @interval_ms A frame interval in miliseconds, 0 renders after each wakeup.
+ */
+void gp_widgets_frame_interval_set(uint32_t interval_ms);
+
+/**
+ * @brief Enables or disables immediate mode.
+ *
+ * If enabled, which is the default, a frame after a key or a mouse button
+ * event is rendered right away regardless of the frame interval so that the
+ * application reacts to the user input with the lowest latency possible.
+ * Frames after pointer motion are paced, otherwise a fast mouse would render
+ * a frame for each motion event.
+ *
+ * @immediate Non-zero enables the immediate mode.
+ */
+void gp_widgets_frame_immediate_set(int immediate);
+
+/**
+ * @brief Returns frame scheduler statistics.
+ *
+ * @return A pointer to the statistics.
+ */
+const gp_widgets_frame_stats *gp_widgets_frame_stats_get(void);
+
 /**
  * @brief Exits the appliaction.
  *
@@ -109,6 +109,23 @@ typedef struct gp_widget_table_col_ops {
 	 * @return See #gp_widget_table_row_op.
 	 */
 	int (*seek_row)(gp_widget *self, int op, unsigned int pos);
+	/**
+	 * @brief Optional random access to the table rows.
+	 *
+	 * Sets the current row to a row index. If not set the table widget
+	 * emulates it with seek_row() by #GP_TABLE_ROW_RESET followed by
+	 * #GP_TABLE_ROW_ADVANCE which is linear in the row index.
+	 *
+	 * Tables with many rows should implement this and
+	 * #GP_TABLE_ROW_MAX so that rendering depends only on the number of
+	 * rows shown on the screen.
+	 *
+	 * @param self A table widget.
+	 * @param row A row index.
+	 *
+	 * @return Non-zero if the row is valid, zero otherwise.
+	 */
+	int (*set_row)(gp_widget *self, unsigned int row);
 	/**
 	 * @brief Returns a cell content.
 	 *
@@ -18,49 +18,99 @@
 #include <backends/gp_clipboard.h>
 #include <backends/gp_backend_input.h>
 
-void gp_backend_update_rect_xyxy(gp_backend *self,
-                                 gp_coord x0, gp_coord y0,
-                                 gp_coord x1, gp_coord y1)
+static void transform_rect(gp_backend *self,
+                           gp_coord *x0, gp_coord *y0,
+                           gp_coord *x1, gp_coord *y1)
 {
-	if (!self->update_rect)
-		return;
-
-	GP_TRANSFORM_POINT(self->pixmap, x0, y0);
-	GP_TRANSFORM_POINT(self->pixmap, x1, y1);
+	GP_TRANSFORM_POINT(self->pixmap, *x0, *y0);
+	GP_TRANSFORM_POINT(self->pixmap, *x1, *y1);
 
-	if (x1 < x0)
-		GP_SWAP(x0, x1);
+	if (*x1 < *x0)
+		GP_SWAP(*x0, *x1);
 
-	if (y1 < y0)
-		GP_SWAP(y0, y1);
+	if (*y1 < *y0)
+		GP_SWAP(*y0, *y1);
 
-	if (x0 < 0) {
-		GP_WARN("Negative x coordinate %i, clipping to 0", x0);
-		x0 = 0;
+	if (*x0 < 0) {
+		GP_WARN("Negative x coordinate %i, clipping to 0", *x0);
+		*x0 = 0;
 	}
 
-	if (y0 < 0) {
-		GP_WARN("Negative y coordinate %i, clipping to 0", y0);
-		y0 = 0;
+	if (*y0 < 0) {
+		GP_WARN("Negative y coordinate %i, clipping to 0", *y0);
+		*y0 = 0;
 	}
 
 	gp_coord w = self->pixmap->w;
 
-	if (x1 >= w) {
-		GP_WARN("Too large x coordinate %i, clipping to %u", x1, w - 1);
-		x1 = w - 1;
+	if (*x1 >= w) {
+		GP_WARN("Too large x coordinate %i, clipping to %u", *x1, w - 1);
+		*x1 = w - 1;
 	}
 
 	gp_coord h = self->pixmap->h;
 
-	if (y1 >= h) {
-		GP_WARN("Too large y coordinate %i, clipping to %u", y1, h - 1);
-		y1 = h - 1;
+	if (*y1 >= h) {
+		GP_WARN("Too large y coordinate %i, clipping to %u", *y1, h - 1);
+		*y1 = h - 1;
 	}
+}
+
+void gp_backend_update_rect_xyxy(gp_backend *self,
+                                 gp_coord x0, gp_coord y0,
+                                 gp_coord x1, gp_coord y1)
+{
+	if (!self->update_rect)
+		return;
+
+	transform_rect(self, &x0, &y0, &x1, &y1);
 
 	self->update_rect(self, x0, y0, x1, y1);
 }
 
+/* Rectangles passed down to the backend at once */
+#define UPDATE_RECTS 16
+
+void gp_backend_update_rects(gp_backend *self, const gp_bbox *rects,
+                             unsigned int cnt)
+{
+	gp_bbox buf[UPDATE_RECTS];
+	unsigned int i = 0, j;
+
+	if (!self->update_rects) {
+		for (i = 0; i < cnt; i++) {
+			if (gp_bbox_empty(rects[i]))
+				continue;
+
+			gp_backend_update_rect_xywh(self, rects[i].x, rects[i].y,
+			                            rects[i].w, rects[i].h);
+		}
+		return;
+	}
+
+	while (i < cnt) {
+		for (j = 0; i < cnt && j < UPDATE_RECTS; i++) {
+			gp_coord x0 = rects[i].x;
+			gp_coord y0 = rects[i].y;
+			gp_coord x1 = x0 + (gp_coord)rects[i].w - 1;
+			gp_coord y1 = y0 + (gp_coord)rects[i].h - 1;
+
+			if (gp_bbox_empty(rects[i]))
+				continue;
+
+			transform_rect(self, &x0, &y0, &x1, &y1);
+
+			if (x1 < x0 || y1 < y0)
+				continue;
+
+			buf[j++] = gp_bbox_pack(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+		}
+
+		if (j)
+			self->update_rects(self, buf, j);
+	}
+}
+
 int gp_backend_resize(gp_backend *self, uint32_t w, uint32_t h)
 {
 	if (!self->set_attr)
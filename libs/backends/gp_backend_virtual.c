@@ -8,26 +8,166 @@
 #include <core/gp_pixmap.h>
 #include <core/gp_blit.h>
 #include <core/gp_debug.h>
+#include <utils/gp_damage.h>
 
 #include <backends/gp_backend_virtual.h>
 
+/*
+ * Tile size for the flip change detection, the width is multiple of eight so
+ * that tiles start at a byte boundary for all pixel sizes.
+ */
+#define TILE_W 64
+#define TILE_H 16
+
 struct virt_priv {
 	/* Original backend */
 	gp_backend *backend;
 
+	/* Copy of the pixmap content as converted in the last flip */
+	gp_pixmap *shadow;
+	/* The shadow is outdated, next flip converts everything */
+	int shadow_invalid;
+
 	int flags;
 };
 
+/*
+ * Compares a tile with the shadow and updates the shadow if they differ.
+ *
+ * Returns non-zero if tile has changed.
+ */
+static int tile_update(gp_pixmap *pixmap, gp_pixmap *shadow,
+                       gp_coord x, gp_coord y, gp_size w, gp_size h)
+{
+	uint8_t bpp = gp_pixel_size(pixmap->pixel_type);
+	size_t off = (size_t)x * bpp / 8;
+	size_t len = ((size_t)(x + w) * bpp + 7) / 8 - off;
+	gp_coord i;
+	int changed = 0;
+
+	for (i = y; i < y + (gp_coord)h; i++) {
+		uint8_t *src = pixmap->pixels + (size_t)i * pixmap->bytes_per_row + off;
+		uint8_t *dst = shadow->pixels + (size_t)i * shadow->bytes_per_row + off;
+
+		if (!changed) {
+			if (!memcmp(src, dst, len))
+				continue;
+			changed = 1;
+		}
+
+		memcpy(dst, src, len);
+	}
+
+	return changed;
+}
+
+/*
+ * Collects changed tiles into damaged region, horizontal runs of changed tiles
+ * are added as a single rectangle and merged further by gp_damage_add().
+ */
+static void diff_tiles(gp_pixmap *pixmap, gp_pixmap *shadow, gp_damage *damage)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)pixmap->h; y += TILE_H) {
+		gp_size th = GP_MIN((gp_size)TILE_H, pixmap->h - y);
+		gp_coord run_x = -1;
+
+		for (x = 0; x < (gp_coord)pixmap->w; x += TILE_W) {
+			gp_size tw = GP_MIN((gp_size)TILE_W, pixmap->w - x);
+
+			if (tile_update(pixmap, shadow, x, y, tw, th)) {
+				if (run_x < 0)
+					run_x = x;
+				continue;
+			}
+
+			if (run_x >= 0) {
+				gp_damage_add(damage, gp_bbox_pack(run_x, y, x - run_x, th));
+				run_x = -1;
+			}
+		}
+
+		if (run_x >= 0)
+			gp_damage_add(damage, gp_bbox_pack(run_x, y, pixmap->w - run_x, th));
+	}
+}
+
+/*
+ * The shadow is updated in whole bytes, for pixels smaller than a byte only
+ * the bytes that are completely inside of the rectangle can be updated,
+ * otherwise we would mark neighbouring pixels that were not converted as
+ * presented. The last byte on a row is padded and can be updated as well.
+ */
+static void update_shadow(struct virt_priv *virt, gp_pixmap *pixmap,
+                          gp_coord x, gp_coord y, gp_size w, gp_size h)
+{
+	uint8_t bpp = gp_pixel_size(pixmap->pixel_type);
+	gp_coord x1 = x + w;
+
+	if (virt->shadow_invalid)
+		return;
+
+	if (bpp < 8) {
+		gp_coord ppb = 8 / bpp;
+
+		x = (x + ppb - 1) / ppb * ppb;
+
+		if (x1 < (gp_coord)pixmap->w)
+			x1 -= x1 % ppb;
+
+		if (x1 <= x)
+			return;
+	}
+
+	tile_update(pixmap, virt->shadow, x, y, x1 - x, h);
+}
+
 static void virt_flip(gp_backend *self)
 {
 	struct virt_priv *virt = GP_BACKEND_PRIV(self);
+	gp_backend *backend = virt->backend;
+	gp_pixmap *pixmap = self->pixmap;
+	gp_damage damage = {};
+	unsigned int i;
 
-	/* Convert and copy the buffer */
-	gp_blit(self->pixmap, 0, 0, self->pixmap->w, self->pixmap->h,
-		virt->backend->pixmap, 0, 0);
+	if (virt->shadow_invalid) {
+		memcpy(virt->shadow->pixels, pixmap->pixels,
+		       (size_t)pixmap->bytes_per_row * pixmap->h);
+		virt->shadow_invalid = 0;
 
-	/* Call blit on original backend */
-	virt->backend->flip(virt->backend);
+		gp_blit_xywh_raw(pixmap, 0, 0, pixmap->w, pixmap->h,
+		                 backend->pixmap, 0, 0);
+
+		backend->flip(backend);
+		return;
+	}
+
+	diff_tiles(pixmap, virt->shadow, &damage);
+
+	if (gp_damage_empty(&damage))
+		return;
+
+	GP_DEBUG(4, "Converting %u rects", damage.cnt);
+
+	for (i = 0; i < damage.cnt; i++) {
+		gp_bbox *r = &damage.rects[i];
+
+		gp_blit_xywh_raw(pixmap, r->x, r->y, r->w, r->h,
+		                 backend->pixmap, r->x, r->y);
+	}
+
+	if (backend->update_rects) {
+		backend->update_rects(backend, damage.rects, damage.cnt);
+		return;
+	}
+
+	for (i = 0; i < damage.cnt; i++) {
+		gp_bbox *r = &damage.rects[i];
+
+		backend->update_rect(backend, r->x, r->y,
+		                     r->x + r->w - 1, r->y + r->h - 1);
+	}
 }
 
 static void virt_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
@@ -35,14 +175,34 @@ static void virt_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
 {
 	struct virt_priv *virt = GP_BACKEND_PRIV(self);
 
+	update_shadow(virt, self->pixmap, x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+
 	/* Convert and copy the buffer */
-	gp_blit_xyxy(self->pixmap, x0, y0, x1, y1,
-	             virt->backend->pixmap, x0, y0);
+	gp_blit_xyxy_raw(self->pixmap, x0, y0, x1, y1,
+	                 virt->backend->pixmap, x0, y0);
 
 	/* Call blit on original backend */
 	virt->backend->update_rect(virt->backend, x0, y0, x1, y1);
 }
 
+static void virt_update_rects(gp_backend *self, const gp_bbox *rects,
+                              unsigned int cnt)
+{
+	struct virt_priv *virt = GP_BACKEND_PRIV(self);
+	unsigned int i;
+
+	for (i = 0; i < cnt; i++) {
+		const gp_bbox *r = &rects[i];
+
+		update_shadow(virt, self->pixmap, r->x, r->y, r->w, r->h);
+
+		gp_blit_xywh_raw(self->pixmap, r->x, r->y, r->w, r->h,
+		                 virt->backend->pixmap, r->x, r->y);
+	}
+
+	virt->backend->update_rects(virt->backend, rects, cnt);
+}
+
 static int virt_set_attr(struct gp_backend *self,
                          enum gp_backend_attrs attr,
                          const void *vals)
@@ -85,6 +245,7 @@ static void virt_exit(gp_backend *self)
 	struct virt_priv *virt = GP_BACKEND_PRIV(self);
 
 	gp_pixmap_free(self->pixmap);
+	gp_pixmap_free(virt->shadow);
 
 	if (virt->flags & GP_BACKEND_CALL_EXIT)
 		virt->backend->exit(virt->backend);
@@ -102,6 +263,13 @@ static int virt_resize_ack(gp_backend *self)
 	if (ret)
 		return ret;
 
+	virt->shadow_invalid = 1;
+
+	ret = gp_pixmap_resize(virt->shadow, virt->backend->pixmap->w,
+	                       virt->backend->pixmap->h);
+	if (ret)
+		return ret;
+
 	return gp_pixmap_resize(self->pixmap, virt->backend->pixmap->w,
 				virt->backend->pixmap->h);
 }
@@ -137,11 +305,19 @@ gp_backend *gp_backend_virt_init(gp_backend *backend,
 		goto err0;
 
 	virt = GP_BACKEND_PRIV(self);
+
+	virt->shadow = gp_pixmap_alloc(backend->pixmap->w, backend->pixmap->h,
+	                               pixel_type);
+	if (!virt->shadow)
+		goto err1;
+
+	virt->shadow_invalid = 1;
 	virt->backend = backend;
 	virt->flags = flags;
 
 	/* Initalize new backend */
 	self->update_rect = virt_update_rect;
+	self->update_rects = backend->update_rects ? virt_update_rects : NULL;
 	self->resize_ack = virt_resize_ack;
 	self->set_attr = backend->set_attr ? virt_set_attr : NULL;
 	self->name = "Virtual Backend";
@@ -156,6 +332,8 @@ gp_backend *gp_backend_virt_init(gp_backend *backend,
 
 	return self;
 
+err1:
+	gp_pixmap_free(self->pixmap);
 err0:
 	free(self);
 	return NULL;
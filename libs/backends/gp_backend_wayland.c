@@ -8,7 +8,9 @@
 
 #include <core/gp_debug.h>
 #include <core/gp_pixmap.h>
+#include <core/gp_blit.h>
 #include <utils/gp_utf.h>
+#include <utils/gp_damage.h>
 #include <backends/gp_backends.h>
 
 #ifdef HAVE_WAYLAND
@@ -26,6 +28,7 @@
 #include <fcntl.h>
 #include <limits.h>
 #include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
 #include <time.h>
@@ -121,47 +124,230 @@ struct client_state {
 
 static struct client_state state = {};
 
-struct buffered_frame {
-	int width;
-	int height;
-	uint32_t* data;
-	struct wl_buffer* buffer;
+/*
+ * Number of buffers in the pool, the compositor usually holds one buffer on
+ * screen and may hold another one until it's composited, the third one is for
+ * the application to render into.
+ */
+#define NR_BUFFERS 3
+
+struct frame_buffer {
+	struct wl_buffer *buffer;
+	void *data;
+	/* attached to the surface and not released by the compositor yet */
+	int busy;
+	/* areas that differ from the application pixmap */
+	gp_damage stale;
 };
 
-static struct buffered_frame frame = {};
+static struct frame_pool {
+	struct frame_buffer bufs[NR_BUFFERS];
+	void *data;
+	size_t size;
+	/* damage waiting for the frame callback */
+	gp_damage pending;
+	struct wl_callback *frame_cb;
+} pool = {};
 
-static int buffered_frame_init(struct client_state* state, struct buffered_frame *frame)
+static void frame_commit(struct client_state *state, struct frame_pool *pool);
+
+static void buffer_release(void *data, struct wl_buffer UN(*buffer))
+{
+	struct frame_buffer *buf = data;
+
+	buf->busy = 0;
+
+	/* Commit deferred because there was no buffer to render into */
+	if (!pool.frame_cb && !gp_damage_empty(&pool.pending))
+		frame_commit(&state, &pool);
+}
+
+static const struct wl_buffer_listener buffer_listener = {
+	.release = buffer_release,
+};
+
+static int frame_pool_init(struct client_state *state, struct frame_pool *pool)
 {
 	const int stride = state->w * 4;
-	const int size = stride * state->h;
+	const size_t buf_size = (size_t)stride * state->h;
+	const size_t size = buf_size * NR_BUFFERS;
+	gp_bbox all = gp_bbox_pack(0, 0, state->w, state->h);
+	unsigned int i;
 
 	int fd = allocate_shm_file(size);
 	if (fd == -1) {
 		return 0;
 	}
 
-	uint32_t *data = mmap(NULL, size,
+	void *data = mmap(NULL, size,
 			PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
 	if (data == MAP_FAILED) {
 		close(fd);
 		return 0;
 	}
 
-	struct wl_shm_pool *pool = wl_shm_create_pool(state->shm, fd, size);
+	struct wl_shm_pool *shm_pool = wl_shm_create_pool(state->shm, fd, size);
 
-	struct wl_buffer *buffer = wl_shm_pool_create_buffer(pool, 0,
-			state->w, state->h, stride, WL_SHM_FORMAT_XRGB8888);
+	for (i = 0; i < NR_BUFFERS; i++) {
+		struct frame_buffer *buf = &pool->bufs[i];
+
+		buf->buffer = wl_shm_pool_create_buffer(shm_pool, i * buf_size,
+				state->w, state->h, stride, WL_SHM_FORMAT_XRGB8888);
+		buf->data = (uint8_t*)data + i * buf_size;
+		buf->busy = 0;
+		gp_damage_clear(&buf->stale);
+		gp_damage_add(&buf->stale, all);
+
+		wl_buffer_add_listener(buf->buffer, &buffer_listener, buf);
+	}
 
-	wl_shm_pool_destroy(pool);
+	wl_shm_pool_destroy(shm_pool);
 	close(fd);
 
-	frame->width = state->w;
-	frame->height = state->h;
-	frame->data = data;
-	frame->buffer = buffer;
+	pool->data = data;
+	pool->size = size;
+	gp_damage_clear(&pool->pending);
+
 	return 1;
 }
 
+static void frame_pool_exit(struct frame_pool *pool)
+{
+	unsigned int i;
+
+	if (pool->frame_cb)
+		wl_callback_destroy(pool->frame_cb);
+
+	for (i = 0; i < NR_BUFFERS; i++)
+		wl_buffer_destroy(pool->bufs[i].buffer);
+
+	munmap(pool->data, pool->size);
+}
+
+/*
+ * Returns a buffer that is not used by the compositor, -1 if there is none.
+ */
+static int free_buffer(struct frame_pool *pool)
+{
+	unsigned int i;
+
+	for (i = 0; i < NR_BUFFERS; i++) {
+		if (!pool->bufs[i].busy)
+			return i;
+	}
+
+	return -1;
+}
+
+/*
+ * Brings the buffer up to date by copying the areas that were updated since
+ * it was committed last time from the application pixmap.
+ */
+static void update_buffer(struct client_state *state, struct frame_buffer *buf)
+{
+	gp_pixmap *pixmap = state->backend->pixmap;
+	gp_pixmap dst;
+	unsigned int i;
+
+	gp_pixmap_init(&dst, pixmap->w, pixmap->h, pixmap->pixel_type, buf->data, 0);
+
+	for (i = 0; i < buf->stale.cnt; i++) {
+		gp_bbox *r = &buf->stale.rects[i];
+
+		gp_blit_xywh_raw(pixmap, r->x, r->y, r->w, r->h, &dst, r->x, r->y);
+	}
+
+	gp_damage_clear(&buf->stale);
+}
+
+static void frame_done(void *data, struct wl_callback *cb, uint32_t time);
+
+static const struct wl_callback_listener frame_listener = {
+	.done = frame_done,
+};
+
+/*
+ * Copies the application pixmap into a free buffer, attaches it with the
+ * accumulated damage and requests a frame callback so that next commit
+ * happens when compositor is ready to draw.
+ *
+ * This is called from the frame and buffer release callbacks as well, so we
+ * must not dispatch here. If all buffers are held by the compositor the commit
+ * is deferred until one of them is released.
+ */
+static void frame_commit(struct client_state *state, struct frame_pool *pool)
+{
+	int n = free_buffer(pool);
+	struct frame_buffer *buf;
+	unsigned int i, j;
+
+	if (n < 0) {
+		GP_DEBUG(4, "All buffers busy, deferring commit");
+		return;
+	}
+
+	buf = &pool->bufs[n];
+
+	GP_DEBUG(4, "Commiting buffer %i with %u rects", n, pool->pending.cnt);
+
+	for (i = 0; i < pool->pending.cnt; i++) {
+		for (j = 0; j < NR_BUFFERS; j++)
+			gp_damage_add(&pool->bufs[j].stale, pool->pending.rects[i]);
+	}
+
+	update_buffer(state, buf);
+
+	wl_surface_attach(state->surface, buf->buffer, 0, 0);
+
+	for (i = 0; i < pool->pending.cnt; i++) {
+		gp_bbox *r = &pool->pending.rects[i];
+
+		wl_surface_damage_buffer(state->surface, r->x, r->y, r->w, r->h);
+	}
+
+	gp_damage_clear(&pool->pending);
+
+	pool->frame_cb = wl_surface_frame(state->surface);
+	wl_callback_add_listener(pool->frame_cb, &frame_listener, state);
+
+	wl_surface_commit(state->surface);
+	wl_display_flush(state->display);
+
+	buf->busy = 1;
+}
+
+static void frame_done(void *data, struct wl_callback *cb, uint32_t UN(time))
+{
+	struct client_state *state = data;
+
+	wl_callback_destroy(cb);
+	pool.frame_cb = NULL;
+
+	if (!gp_damage_empty(&pool.pending))
+		frame_commit(state, &pool);
+}
+
+/*
+ * Adds damage and commits it unless we are waiting for a frame callback, in
+ * that case the damage is commited once the compositor is ready.
+ */
+static void frame_damage(struct client_state *state, const gp_bbox *rects,
+                         unsigned int cnt)
+{
+	unsigned int i;
+
+	for (i = 0; i < cnt; i++)
+		gp_damage_add(&pool.pending, rects[i]);
+
+	if (pool.frame_cb) {
+		GP_DEBUG(4, "Frame pending, deferring commit");
+		return;
+	}
+
+	if (!gp_damage_empty(&pool.pending))
+		frame_commit(state, &pool);
+}
+
 static void
 xdg_surface_configure(void UN(*data),
                       struct xdg_surface *xdg_surface, uint32_t serial)
@@ -626,36 +812,38 @@ static int window_create(struct client_state *state, unsigned int w, unsigned in
 		zxdg_toplevel_decoration_v1_set_mode(state->decoration, ZXDG_TOPLEVEL_DECORATION_V1_MODE_SERVER_SIDE);
 	}
 
-	buffered_frame_init(state, &frame);
-
-	wl_surface_attach(state->surface, frame.buffer, state->w, state->h);
-	wl_surface_commit(state->surface);
+	if (!frame_pool_init(state, &pool)) {
+		GP_FATAL("Failed to allocate buffers");
+		window_destroy(state);
+		return 1;
+	}
 
 	return 0;
 }
 
 static void wayland_flip(gp_backend *self)
 {
-	(void) self;
+	gp_bbox rect = gp_bbox_pack(0, 0, self->pixmap->w, self->pixmap->h);
 
-	//TODO: we need two buffers and swap the backend->pixmap on attach
-	//      so that we avoid drawing into a memory that is currently
-	//      attached to surface
-	wl_surface_attach(state.surface, frame.buffer, state.w, state.h);
-	wl_surface_damage(state.surface, 0, 0, state.w, state.h);
-	wl_surface_commit(state.surface);
-	wl_display_flush(state.display);
+	frame_damage(&state, &rect, 1);
 }
 
+static void wayland_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
+                                gp_coord x1, gp_coord y1)
+{
+	gp_bbox rect = gp_bbox_pack(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
 
-static void wayland_update_rect(gp_backend* self, gp_coord x, gp_coord y, gp_coord w, gp_coord h)
+	(void) self;
+
+	frame_damage(&state, &rect, 1);
+}
+
+static void wayland_update_rects(gp_backend *self, const gp_bbox *rects,
+                                 unsigned int cnt)
 {
 	(void) self;
 
-	wl_surface_attach(state.surface, frame.buffer, state.w, state.h);
-	wl_surface_damage(state.surface, x, y, w, h);
-	wl_surface_commit(state.surface);
-	wl_display_flush(state.display);
+	frame_damage(&state, rects, cnt);
 }
 
 static int wayland_set_attr(gp_backend* self, enum gp_backend_attrs attrs, const void* values)
@@ -685,21 +873,23 @@ static int wayland_resize_ack(gp_backend* self)
 
 static void wayland_exit(gp_backend* self)
 {
-	(void) self;
-
 	/* Free keymap */
 	xkb_keymap_unref(state.keymap);
 	xkb_context_unref(state.keymap_context);
 	xkb_state_unref(state.keymap_state);
 
+	frame_pool_exit(&pool);
 	window_destroy(&state);
 	display_disconnect(&state);
+
+	gp_pixmap_free(self->pixmap);
 }
 
 static struct gp_backend backend = {
 	.name = "Wayland",
 	.flip = wayland_flip,
 	.update_rect = wayland_update_rect,
+	.update_rects = wayland_update_rects,
 	.set_attr = wayland_set_attr,
 	.resize_ack = wayland_resize_ack,
 	.exit = wayland_exit,
@@ -734,8 +924,13 @@ gp_backend *gp_wayland_init(const char *display,
 	state.backend = &backend;
 
 	backend.pixmap = gp_pixmap_alloc(w, h, state.pixel_type);
-
-	backend.pixmap->pixels = (void*)frame.data;
+	if (!backend.pixmap) {
+		frame_pool_exit(&pool);
+		window_destroy(&state);
+		gp_poll_rem(&backend.fds, &state.fd);
+		display_disconnect(&state);
+		return NULL;
+	}
 
 	backend.event_queue = &state.ev_queue;
 
@@ -750,6 +945,9 @@ gp_backend *gp_wayland_init(const char *display,
 
 	gp_ev_queue_init(backend.event_queue, w, h, 0, 0);
 
+	/* Show the initial buffer */
+	wayland_flip(&backend);
+
 	return &backend;
 }
 
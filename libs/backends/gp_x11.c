@@ -3,14 +3,18 @@
  * Copyright (C) 2009-2024 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <time.h>
 
 #include "../../config.h"
 
 #include <core/gp_debug.h>
 #include "core/gp_common.h"
 #include "core/gp_pixmap.h"
+#include <core/gp_blit.h>
+#include <utils/gp_damage.h>
 
 #ifdef HAVE_LIBX11
 
@@ -42,20 +46,176 @@ static void process_events(struct x11_win *win, gp_backend *backend);
 
 static void putimage(struct x11_win *win, int x0, int y0, int x1, int y1)
 {
+	XPutImage(win->dpy, win->win, DefaultGC(win->dpy, win->scr),
+	          win->img, x0, y0, x0, y0, x1-x0+1, y1-y0+1);
+}
+
 #ifdef HAVE_X_SHM
-	if (win->shm_flag)
+
+static uint64_t time_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void shm_present(struct x11_win *win, const gp_bbox *rects,
+                        unsigned int cnt);
+
+static void shm_completion(struct x11_win *win, XEvent *ev)
+{
+	XShmCompletionEvent *cev = (XShmCompletionEvent*)ev;
+	gp_x11_present_stats *stats = &win->stats;
+	unsigned int i;
+
+	for (i = 0; i < X11_SHM_BUFS; i++) {
+		struct x11_shm_buf *buf = &win->shm_bufs[i];
+
+		if (buf->shminfo.shmseg != cev->shmseg || !buf->busy)
+			continue;
+
+		uint32_t latency = time_us() - buf->sent_us;
+
+		buf->busy = 0;
+
+		stats->frames++;
+		stats->last_us = latency;
+		stats->max_us = GP_MAX(stats->max_us, latency);
+
+		if (stats->frames == 1)
+			stats->avg_us = latency;
+		else
+			stats->avg_us = (7 * (uint64_t)stats->avg_us + latency) / 8;
+
+		GP_DEBUG(4, "Buffer %u presented, latency %uus", i, latency);
+
+		/* Updates that were waiting for a free image */
+		shm_present(win, NULL, 0);
+		return;
+	}
+
+	GP_DEBUG(4, "ShmCompletion for unknown segment");
+}
+
+static int shm_free_buf(struct x11_win *win)
+{
+	unsigned int i;
+
+	for (i = 0; i < X11_SHM_BUFS; i++) {
+		if (!win->shm_bufs[i].busy)
+			return i;
+	}
+
+	return -1;
+}
+
+/*
+ * Adds the rectangles to the pending damage, copies the parts of the
+ * application pixmap that changed since a free image was put last time into it
+ * and puts all pending rectangles in a single request sequence with
+ * ShmCompletion requested for the last one.
+ *
+ * If both images are owned by the X server the damage is kept and presented
+ * once ShmCompletion arrives, so this never blocks.
+ */
+static void shm_present(struct x11_win *win, const gp_bbox *rects,
+                        unsigned int cnt)
+{
+	gp_damage *pending = &win->shm_pending;
+	struct x11_shm_buf *buf;
+	gp_pixmap dst;
+	unsigned int i, j;
+	int n;
+
+	for (i = 0; i < cnt; i++)
+		gp_damage_add(pending, rects[i]);
+
+	if (gp_damage_empty(pending))
+		return;
+
+	n = shm_free_buf(win);
+	if (n < 0) {
+		GP_DEBUG(4, "All images busy, deferring present");
+		if (cnt)
+			win->stats.stalls++;
+		return;
+	}
+
+	buf = &win->shm_bufs[n];
+
+	for (i = 0; i < pending->cnt; i++) {
+		for (j = 0; j < X11_SHM_BUFS; j++)
+			gp_damage_add(&win->shm_bufs[j].stale, pending->rects[i]);
+	}
+
+	dst = win->pixmap;
+	dst.pixels = (void*)buf->shminfo.shmaddr;
+
+	for (i = 0; i < buf->stale.cnt; i++) {
+		gp_bbox *r = &buf->stale.rects[i];
+
+		gp_blit_xywh_raw(&win->pixmap, r->x, r->y, r->w, r->h,
+		                 &dst, r->x, r->y);
+	}
+
+	gp_damage_clear(&buf->stale);
+
+	for (i = 0; i < pending->cnt; i++) {
+		gp_bbox *r = &pending->rects[i];
+
 		XShmPutImage(win->dpy, win->win, DefaultGC(win->dpy, win->scr),
-		             win->img, x0, y0, x0, y0, x1-x0+1, y1-y0+1, False);
-	else
+		             buf->img, r->x, r->y, r->x, r->y, r->w, r->h,
+		             i + 1 == pending->cnt);
+	}
+
+	gp_damage_clear(pending);
+
+	buf->busy = 1;
+	buf->sent_us = time_us();
+	win->shm_last = n;
+
+	XFlush(win->dpy);
+}
+
+/*
+ * Repaints window from the last presented image, the image is not modified by
+ * the application so we do not have to wait for the completion.
+ */
+static void shm_expose(struct x11_win *win, int x0, int y0, int x1, int y1)
+{
+	XShmPutImage(win->dpy, win->win, DefaultGC(win->dpy, win->scr),
+	             win->shm_bufs[win->shm_last].img, x0, y0, x0, y0,
+	             x1-x0+1, y1-y0+1, False);
+}
+
+#endif /* HAVE_X_SHM */
+
+static void present(struct x11_win *win, const gp_bbox *rects, unsigned int cnt)
+{
+	unsigned int i;
+
+#ifdef HAVE_X_SHM
+	if (win->shm_flag) {
+		shm_present(win, rects, cnt);
+		return;
+	}
 #endif /* HAVE_X_SHM */
-		XPutImage(win->dpy, win->win, DefaultGC(win->dpy, win->scr),
-		          win->img, x0, y0, x0, y0, x1-x0+1, y1-y0+1);
+
+	for (i = 0; i < cnt; i++) {
+		putimage(win, rects[i].x, rects[i].y,
+		         rects[i].x + rects[i].w - 1, rects[i].y + rects[i].h - 1);
+	}
+
+	XFlush(win->dpy);
 }
 
 static void x11_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
                             gp_coord x1, gp_coord y1)
 {
 	struct x11_win *win = GP_BACKEND_PRIV(self);
+	gp_bbox rect = gp_bbox_pack(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
 
 	GP_DEBUG(4, "Updating rect %ix%i-%ix%i", x0, y0, x1, y1);
 
@@ -66,9 +226,28 @@ static void x11_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
 
 	XLockDisplay(win->dpy);
 
-	putimage(win, x0, y0, x1, y1);
+	present(win, &rect, 1);
 
-	XFlush(win->dpy);
+	process_events(win, self);
+
+	XUnlockDisplay(win->dpy);
+}
+
+static void x11_update_rects(gp_backend *self, const gp_bbox *rects,
+                             unsigned int cnt)
+{
+	struct x11_win *win = GP_BACKEND_PRIV(self);
+
+	GP_DEBUG(4, "Updating %u rects", cnt);
+
+	if (win->resized_flag) {
+		GP_DEBUG(4, "Ignoring update rects, waiting for resize ack");
+		return;
+	}
+
+	XLockDisplay(win->dpy);
+
+	present(win, rects, cnt);
 
 	process_events(win, self);
 
@@ -77,25 +256,29 @@ static void x11_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
 
 static void x11_flip(gp_backend *self)
 {
-	struct x11_win *win = GP_BACKEND_PRIV(self);
 	unsigned int w = self->pixmap->w;
 	unsigned int h = self->pixmap->h;
 
 	GP_DEBUG(4, "Flipping pixmap");
 
-	if (win->resized_flag) {
-		GP_DEBUG(4, "Ignoring flip, waiting for resize ack");
-		return;
-	}
+	x11_update_rect(self, 0, 0, w - 1, h - 1);
+}
+
+static void x11_expose(gp_backend *self, int x0, int y0, int x1, int y1)
+{
+	struct x11_win *win = GP_BACKEND_PRIV(self);
 
 	XLockDisplay(win->dpy);
 
-	putimage(win, 0, 0, w - 1, h - 1);
+#ifdef HAVE_X_SHM
+	if (win->shm_flag)
+		shm_expose(win, x0, y0, x1, y1);
+	else
+#endif /* HAVE_X_SHM */
+		putimage(win, x0, y0, x1, y1);
 
 	XFlush(win->dpy);
 
-	process_events(win, self);
-
 	XUnlockDisplay(win->dpy);
 }
 
@@ -119,6 +302,13 @@ static void x11_ev(XEvent *ev)
 
 	struct gp_backend *self = GP_CONTAINER_OF(win, gp_backend, priv);
 
+#ifdef HAVE_X_SHM
+	if (win->shm_flag && ev->type == win->shm_completion) {
+		shm_completion(win, ev);
+		return;
+	}
+#endif /* HAVE_X_SHM */
+
 	switch (ev->type) {
 	case Expose:
 		GP_DEBUG(4, "Expose %ix%i-%ix%i %i",
@@ -141,9 +331,9 @@ static void x11_ev(XEvent *ev)
 		}
 
 		/* Update the rectangle  */
-		x11_update_rect(self, ev->xexpose.x, ev->xexpose.y,
-		                ev->xexpose.x + ev->xexpose.width - 1,
-				ev->xexpose.y + ev->xexpose.height - 1);
+		x11_expose(self, ev->xexpose.x, ev->xexpose.y,
+		           ev->xexpose.x + ev->xexpose.width - 1,
+		           ev->xexpose.y + ev->xexpose.height - 1);
 	break;
 	case SelectionRequest:
 		x11_selection_request(self, ev);
@@ -311,95 +501,146 @@ static enum gp_pixel_type match_pixel_type(struct x11_win *win)
 
 #ifdef HAVE_X_SHM
 
-static int create_shm_ximage(gp_backend *self, gp_size w, gp_size h)
+static int create_shm_buf(struct x11_win *win, struct x11_shm_buf *buf,
+                          gp_size w, gp_size h)
 {
-	struct x11_win *win = GP_BACKEND_PRIV(self);
-	enum gp_pixel_type pixel_type;
-
-	if (XShmQueryExtension(win->dpy) == False) {
-		GP_DEBUG(1, "MIT SHM Extension not supported, "
-		            "falling back to XImage");
-		return 1;
-	}
-
-	if (self->pixmap == NULL)
-		GP_DEBUG(1, "Using MIT SHM Extension");
+	gp_bbox all = gp_bbox_pack(0, 0, w, h);
 
-	win->img = XShmCreateImage(win->dpy, win->vis, win->scr_depth,
-	                           ZPixmap, NULL, &win->shminfo, w, h);
+	buf->img = XShmCreateImage(win->dpy, win->vis, win->scr_depth,
+	                           ZPixmap, NULL, &buf->shminfo, w, h);
 
-	if (win->img == NULL) {
+	if (buf->img == NULL) {
 		GP_WARN("Failed to create SHM XImage");
 		return 1;
 	}
 
-	size_t size = win->img->bytes_per_line * win->img->height;
-
-	pixel_type = match_pixel_type(win);
-
-	if (pixel_type == GP_PIXEL_UNKNOWN) {
-		GP_DEBUG(1, "Unknown pixel type");
-		goto err0;
-	}
+	size_t size = buf->img->bytes_per_line * buf->img->height;
 
-	win->shminfo.shmid = shmget(IPC_PRIVATE, size, 0666);
+	buf->shminfo.shmid = shmget(IPC_PRIVATE, size, 0666);
 
-	if (win->shminfo.shmid == -1) {
+	if (buf->shminfo.shmid == -1) {
 		GP_WARN("Calling shmget() failed: %s", strerror(errno));
 		goto err0;
 	}
 
-	win->shminfo.shmaddr = win->img->data = shmat(win->shminfo.shmid, 0, 0);
+	buf->shminfo.shmaddr = buf->img->data = shmat(buf->shminfo.shmid, 0, 0);
 
-	if (win->shminfo.shmaddr == (void *)-1) {
+	if (buf->shminfo.shmaddr == (void *)-1) {
 		GP_WARN("Calling shmat() failed: %s", strerror(errno));
 		goto err1;
 	}
 
 	/* Mark SHM for deletion after detach */
-	if (shmctl(win->shminfo.shmid, IPC_RMID, 0)) {
+	if (shmctl(buf->shminfo.shmid, IPC_RMID, 0)) {
 		GP_WARN("Calling shmctl(..., IPC_RMID), 0) failed: %s",
 		         strerror(errno));
 		goto err2;
 	}
 
-	win->shminfo.readOnly = False;
+	buf->shminfo.readOnly = False;
 
-	if (XShmAttach(win->dpy, &win->shminfo) == False) {
+	if (XShmAttach(win->dpy, &buf->shminfo) == False) {
 		GP_WARN("XShmAttach failed");
 		goto err2;
 	}
 
-	gp_pixmap_init(&win->pixmap, w, h, pixel_type, win->shminfo.shmaddr, 0);
+	/* The whole image has to be copied from the application pixmap */
+	buf->busy = 0;
+	gp_damage_clear(&buf->stale);
+	gp_damage_add(&buf->stale, all);
+
+	return 0;
+err2:
+	shmdt(buf->shminfo.shmaddr);
+err1:
+	shmctl(buf->shminfo.shmid, IPC_RMID, 0);
+err0:
+	XDestroyImage(buf->img);
+	buf->img = NULL;
+	return 1;
+}
+
+static void destroy_shm_buf(struct x11_win *win, struct x11_shm_buf *buf)
+{
+	XShmDetach(win->dpy, &buf->shminfo);
+	shmdt(buf->shminfo.shmaddr);
+	XDestroyImage(buf->img);
+	buf->img = NULL;
+}
+
+static int create_shm_ximage(gp_backend *self, gp_size w, gp_size h)
+{
+	struct x11_win *win = GP_BACKEND_PRIV(self);
+	enum gp_pixel_type pixel_type;
+	unsigned int i;
+	void *pixels;
+
+	if (XShmQueryExtension(win->dpy) == False) {
+		GP_DEBUG(1, "MIT SHM Extension not supported, "
+		            "falling back to XImage");
+		return 1;
+	}
+
+	if (self->pixmap == NULL)
+		GP_DEBUG(1, "Using MIT SHM Extension");
+
+	for (i = 0; i < X11_SHM_BUFS; i++) {
+		if (create_shm_buf(win, &win->shm_bufs[i], w, h))
+			goto err;
+	}
+
+	win->shm_last = 0;
+	win->shm_completion = XShmGetEventBase(win->dpy) + ShmCompletion;
+	win->img = win->shm_bufs[0].img;
+	gp_damage_clear(&win->shm_pending);
+
+	pixel_type = match_pixel_type(win);
+
+	if (pixel_type == GP_PIXEL_UNKNOWN) {
+		GP_DEBUG(1, "Unknown pixel type");
+		goto err;
+	}
+
+	pixels = malloc((size_t)win->img->bytes_per_line * h);
+	if (!pixels) {
+		GP_WARN("Malloc failed :(");
+		goto err;
+	}
+
+	gp_pixmap_init(&win->pixmap, w, h, pixel_type, pixels, 0);
 	win->pixmap.bytes_per_row = win->img->bytes_per_line;
 
 	self->pixmap = &win->pixmap;
 
 	win->shm_flag = 1;
 
-	//FIXME: Proper synchronization
-	XSync(win->dpy, True);
+	/* Make sure the segments are attached before we start rendering */
+	XSync(win->dpy, False);
 
 	return 0;
-err2:
-	shmdt(win->shminfo.shmaddr);
-err1:
-	shmctl(win->shminfo.shmid, IPC_RMID, 0);
-err0:
-	XDestroyImage(win->img);
+err:
+	while (i--)
+		destroy_shm_buf(win, &win->shm_bufs[i]);
+	XSync(win->dpy, False);
 	return 1;
 }
 
 static void destroy_shm_ximage(gp_backend *self)
 {
 	struct x11_win *win = GP_BACKEND_PRIV(self);
+	unsigned int i;
 
 	XLockDisplay(win->dpy);
 
-	XShmDetach(win->dpy, &win->shminfo);
-	XFlush(win->dpy);
-	shmdt(win->shminfo.shmaddr);
-	XDestroyImage(win->img);
+	/* Make sure X server finished all pending XShmPutImage() requests */
+	XSync(win->dpy, False);
+
+	for (i = 0; i < X11_SHM_BUFS; i++)
+		destroy_shm_buf(win, &win->shm_bufs[i]);
+
+	free(win->pixmap.pixels);
+	win->pixmap.pixels = NULL;
+
 	XFlush(win->dpy);
 
 	XUnlockDisplay(win->dpy);
@@ -573,6 +814,24 @@ static void x11_exit(gp_backend *self)
 	free(self);
 }
 
+int gp_x11_present_stats_get(gp_backend *self, gp_x11_present_stats *stats)
+{
+#ifdef HAVE_X_SHM
+	struct x11_win *win = GP_BACKEND_PRIV(self);
+
+	if (win->shm_flag) {
+		*stats = win->stats;
+		return 0;
+	}
+#else
+	(void) self;
+	(void) stats;
+#endif /* HAVE_X_SHM */
+
+	errno = ENOSYS;
+	return 1;
+}
+
 static int x11_set_attr(gp_backend *self, enum gp_backend_attrs attr,
                         const void *vals)
 {
@@ -697,6 +956,7 @@ gp_backend *gp_x11_init(const char *display, int x, int y,
 	backend->name = "X11";
 	backend->flip = x11_flip;
 	backend->update_rect = x11_update_rect;
+	backend->update_rects = x11_update_rects;
 	backend->exit = x11_exit;
 	backend->set_attr = x11_set_attr;
 	backend->clipboard = x11_clipboard;
@@ -712,16 +972,24 @@ err1:
 
 #else
 
-#include <backends/gp_backend.h>
+#include <backends/gp_x11.h>
 
 gp_backend *gp_x11_init(const char *GP_UNUSED(display),
                         int GP_UNUSED(x), int GP_UNUSED(y),
                         unsigned int GP_UNUSED(w),
                         unsigned int GP_UNUSED(h),
-                        const char *GP_UNUSED(caption))
+                        const char *GP_UNUSED(caption),
+                        enum gp_x11_flags GP_UNUSED(flags))
 {
 	GP_FATAL("X11 support not compiled in");
 	return NULL;
 }
 
+int gp_x11_present_stats_get(gp_backend *GP_UNUSED(self),
+                             gp_x11_present_stats *GP_UNUSED(stats))
+{
+	errno = ENOSYS;
+	return 1;
+}
+
 #endif /* HAVE_LIBX11 */
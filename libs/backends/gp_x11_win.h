@@ -3,6 +3,27 @@
  * Copyright (C) 2009-2013 Cyril Hrubis <metan@ucw.cz>
  */
 
+#ifdef HAVE_X_SHM
+/*
+ * Number of SHM images, the application renders into a private pixmap that is
+ * copied into an image the X server does not read from on present.
+ */
+#define X11_SHM_BUFS 2
+
+struct x11_shm_buf {
+	XShmSegmentInfo shminfo;
+	XImage *img;
+
+	/* Put image requested, waiting for ShmCompletion */
+	int busy;
+	/* When the image was send, for latency statistics */
+	uint64_t sent_us;
+
+	/* Areas that differ from the application pixmap */
+	gp_damage stale;
+};
+#endif /* HAVE_X_SHM */
+
 /*
  * X11 window.
  */
@@ -26,7 +47,14 @@ struct x11_win {
 	XImage *img;
 
 #ifdef HAVE_X_SHM
-	XShmSegmentInfo shminfo;
+	struct x11_shm_buf shm_bufs[X11_SHM_BUFS];
+	/* Image put last time, used to repaint exposed areas */
+	unsigned int shm_last;
+	/* Areas waiting for an image to be released by the X server */
+	gp_damage shm_pending;
+	/* ShmCompletion event type */
+	int shm_completion;
+	gp_x11_present_stats stats;
 #endif /* HAVE_X_SHM */
 
 	gp_pixmap pixmap;
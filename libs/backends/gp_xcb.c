@@ -7,29 +7,58 @@
 
 #include <core/gp_debug.h>
 #include "core/gp_common.h"
-#include <backends/gp_backend.h>
+#include <backends/gp_xcb.h>
 
 #ifdef HAVE_LIBXCB
 
 #include <string.h>
+#include <errno.h>
+#include <time.h>
 #include <sys/shm.h>
 #include <xcb/xcb.h>
 #include <xcb/shm.h>
 #include <xcb/xfixes.h>
 
 #include <core/gp_pixmap.h>
+#include <core/gp_blit.h>
+#include <utils/gp_damage.h>
 
 #include "gp_xcb_con.h"
 #include "gp_xcb_input.h"
 
 static void x_poll_events(gp_backend *backend);
 
+/*
+ * Number of SHM segments, the application renders into a private pixmap that
+ * is copied into a segment the X server does not read from on present.
+ */
+#define SHM_BUFS 2
+
+struct shm_buf {
+	xcb_shm_seg_t seg;
+	void *addr;
+
+	/* Put image requested, waiting for ShmCompletion */
+	int busy;
+	/* When the image was send, for latency statistics */
+	uint64_t sent_us;
+
+	/* Areas that differ from the application pixmap */
+	gp_damage stale;
+};
+
 struct win {
 	xcb_screen_t *scr;
 	xcb_window_t win;
 	xcb_gcontext_t gc;
 	xcb_pixmap_t pixmap;
-	xcb_shm_seg_t shmseg;
+
+	struct shm_buf shm_bufs[SHM_BUFS];
+	/* Segment put last time, used to repaint exposed areas */
+	unsigned int shm_last;
+	/* Areas waiting for a segment to be released by the X server */
+	gp_damage shm_pending;
+	gp_x11_present_stats stats;
 
 	gp_ev_queue ev_queue;
 
@@ -42,17 +71,24 @@ struct win {
 	int fullscreen:1;
 };
 
+static void detach_shm_bufs(struct win *win, xcb_connection_t *c);
+
 static void x_exit(gp_backend *self)
 {
+	struct win *win = GP_BACKEND_PRIV(self);
+
+	if (x_con.shm_support)
+		detach_shm_bufs(win, x_con.c);
+
 	x_close();
 
 	free(self);
 }
 
-static void *attach_shm_pixmap(struct gp_backend *self, xcb_connection_t *c,
-                               gp_pixel_type pixel_type, int w, int h)
+static int attach_shm_buf(xcb_connection_t *c, struct shm_buf *buf,
+                          gp_pixel_type pixel_type, int w, int h)
 {
-	struct win *win = GP_BACKEND_PRIV(self);
+	gp_bbox all = gp_bbox_pack(0, 0, w, h);
 
 	GP_DEBUG(3, "Attaching SHM pixmap %ix%i", w, h);
 
@@ -62,7 +98,7 @@ static void *attach_shm_pixmap(struct gp_backend *self, xcb_connection_t *c,
 
 	if (shm_id == -1) {
 		GP_WARN("shmget() failed");
-		return NULL;
+		return 1;
 	}
 
 	void *shm_addr = shmat(shm_id, 0, 0);
@@ -75,7 +111,7 @@ static void *attach_shm_pixmap(struct gp_backend *self, xcb_connection_t *c,
 	xcb_void_cookie_t cookie;
 	xcb_generic_error_t *err;
 
-	cookie = xcb_shm_attach_checked(c, win->shmseg, shm_id, 0);
+	cookie = xcb_shm_attach_checked(c, buf->seg, shm_id, 0);
 	err = xcb_request_check(c, cookie);
 
 	shmctl(shm_id, IPC_RMID, 0);
@@ -83,27 +119,40 @@ static void *attach_shm_pixmap(struct gp_backend *self, xcb_connection_t *c,
 	if (err) {
 		GP_WARN("xcb_shm_attach() failed");
 		free(err);
-		return NULL;
+		shmdt(shm_addr);
+		return 1;
 	}
 
-	return shm_addr;
+	/* The whole segment has to be copied from the application pixmap */
+	buf->addr = shm_addr;
+	buf->busy = 0;
+	gp_damage_clear(&buf->stale);
+	gp_damage_add(&buf->stale, all);
+
+	return 0;
 err1:
 	shmctl(shm_id, IPC_RMID, 0);
-	return NULL;
+	return 1;
 }
 
-static int detach_shm_pixmap(struct gp_backend *self, xcb_connection_t *c)
+static int detach_shm_buf(xcb_connection_t *c, struct shm_buf *buf)
 {
-	struct win *win = GP_BACKEND_PRIV(self);
-
 	xcb_void_cookie_t cookie;
 	xcb_generic_error_t *err;
 
+	if (!buf->addr)
+		return 0;
+
 	GP_DEBUG(3, "Detaching SHM pixmap");
 
-	cookie = xcb_shm_detach_checked(c, win->shmseg);
+	/* Requests are processed in order, pending puts are finished here */
+	cookie = xcb_shm_detach_checked(c, buf->seg);
 	err = xcb_request_check(c, cookie);
 
+	shmdt(buf->addr);
+	buf->addr = NULL;
+	buf->busy = 0;
+
 	if (err) {
 		GP_WARN("xcb_shm_detach() failed");
 		free(err);
@@ -113,26 +162,45 @@ static int detach_shm_pixmap(struct gp_backend *self, xcb_connection_t *c)
 	return 0;
 }
 
-static int resize_shm_pixmap(struct gp_backend *self, xcb_connection_t *c)
+static void detach_shm_bufs(struct win *win, xcb_connection_t *c)
 {
-	struct win *win = GP_BACKEND_PRIV(self);
-	void *shm_addr;
+	unsigned int i;
 
-	if (detach_shm_pixmap(self, c))
-		return 1;
+	for (i = 0; i < SHM_BUFS; i++)
+		detach_shm_buf(c, &win->shm_bufs[i]);
+}
 
-	shm_addr = attach_shm_pixmap(self, c, self->pixmap->pixel_type,
-	                             win->new_w, win->new_h);
+static int attach_shm_bufs(struct win *win, xcb_connection_t *c,
+                           gp_pixel_type pixel_type, int w, int h)
+{
+	unsigned int i;
 
-	if (!shm_addr)
-		return 1;
+	for (i = 0; i < SHM_BUFS; i++) {
+		if (attach_shm_buf(c, &win->shm_bufs[i], pixel_type, w, h)) {
+			detach_shm_bufs(win, c);
+			return 1;
+		}
+	}
 
-	gp_pixmap_init(self->pixmap, win->new_w, win->new_h,
-	               self->pixmap->pixel_type, shm_addr, 0);
+	win->shm_last = 0;
+	gp_damage_clear(&win->shm_pending);
 
 	return 0;
 }
 
+static int resize_shm_pixmap(struct gp_backend *self, xcb_connection_t *c)
+{
+	struct win *win = GP_BACKEND_PRIV(self);
+
+	detach_shm_bufs(win, c);
+
+	if (attach_shm_bufs(win, c, self->pixmap->pixel_type,
+	                    win->new_w, win->new_h))
+		return 1;
+
+	return gp_pixmap_resize(self->pixmap, win->new_w, win->new_h);
+}
+
 static int resize_pixmap(gp_backend *self, xcb_connection_t *c)
 {
 	struct win *win = GP_BACKEND_PRIV(self);
@@ -195,14 +263,148 @@ static void put_image(gp_backend *self, int x, int y, int w, int h)
 	xcb_flush(x_con.c);
 }
 
-static void put_shm_image(gp_backend *self, int x, int y, int w, int h)
+static uint64_t time_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int shm_completion(struct win *win, xcb_shm_completion_event_t *cev)
+{
+	gp_x11_present_stats *stats = &win->stats;
+	unsigned int i;
+
+	for (i = 0; i < SHM_BUFS; i++) {
+		struct shm_buf *buf = &win->shm_bufs[i];
+
+		if (buf->seg != cev->shmseg || !buf->busy)
+			continue;
+
+		uint32_t latency = time_us() - buf->sent_us;
+
+		buf->busy = 0;
+
+		stats->frames++;
+		stats->last_us = latency;
+		stats->max_us = GP_MAX(stats->max_us, latency);
+
+		if (stats->frames == 1)
+			stats->avg_us = latency;
+		else
+			stats->avg_us = (7 * (uint64_t)stats->avg_us + latency) / 8;
+
+		GP_DEBUG(4, "Buffer %u presented, latency %uus", i, latency);
+		return 1;
+	}
+
+	GP_DEBUG(4, "ShmCompletion for unknown segment");
+	return 0;
+}
+
+static void put_shm_image(gp_backend *self, struct shm_buf *buf,
+                          int x, int y, int w, int h, int send_event)
 {
 	struct win *win = GP_BACKEND_PRIV(self);
+
 	xcb_shm_put_image(x_con.c, win->win, win->gc, self->pixmap->w, self->pixmap->h, x, y, w, h, x, y,
-	                  win->scr->root_depth, XCB_IMAGE_FORMAT_Z_PIXMAP, 1, win->shmseg, 0);
+	                  win->scr->root_depth, XCB_IMAGE_FORMAT_Z_PIXMAP, send_event, buf->seg, 0);
+}
+
+static int shm_free_buf(struct win *win)
+{
+	unsigned int i;
+
+	for (i = 0; i < SHM_BUFS; i++) {
+		if (!win->shm_bufs[i].busy)
+			return i;
+	}
+
+	return -1;
+}
+
+/*
+ * Adds the rectangles to the pending damage, copies the parts of the
+ * application pixmap that changed since a free segment was put last time into
+ * it and puts all pending rectangles with ShmCompletion requested for the last
+ * one.
+ *
+ * If both segments are owned by the X server the damage is kept and presented
+ * once ShmCompletion arrives, so this never blocks.
+ */
+static void shm_present(gp_backend *self, const gp_bbox *rects, unsigned int cnt)
+{
+	struct win *win = GP_BACKEND_PRIV(self);
+	gp_damage *pending = &win->shm_pending;
+	struct shm_buf *buf;
+	gp_pixmap dst;
+	unsigned int i, j;
+	int n;
+
+	for (i = 0; i < cnt; i++)
+		gp_damage_add(pending, rects[i]);
+
+	if (gp_damage_empty(pending))
+		return;
+
+	n = shm_free_buf(win);
+	if (n < 0) {
+		GP_DEBUG(4, "All segments busy, deferring present");
+		if (cnt)
+			win->stats.stalls++;
+		return;
+	}
+
+	buf = &win->shm_bufs[n];
+
+	for (i = 0; i < pending->cnt; i++) {
+		for (j = 0; j < SHM_BUFS; j++)
+			gp_damage_add(&win->shm_bufs[j].stale, pending->rects[i]);
+	}
+
+	gp_pixmap_init(&dst, self->pixmap->w, self->pixmap->h,
+	               self->pixmap->pixel_type, buf->addr, 0);
+
+	for (i = 0; i < buf->stale.cnt; i++) {
+		gp_bbox *r = &buf->stale.rects[i];
+
+		gp_blit_xywh_raw(self->pixmap, r->x, r->y, r->w, r->h,
+		                 &dst, r->x, r->y);
+	}
+
+	gp_damage_clear(&buf->stale);
+
+	for (i = 0; i < pending->cnt; i++) {
+		gp_bbox *r = &pending->rects[i];
+
+		put_shm_image(self, buf, r->x, r->y, r->w, r->h,
+		              i + 1 == pending->cnt);
+	}
+
+	gp_damage_clear(pending);
+
+	buf->busy = 1;
+	buf->sent_us = time_us();
+	win->shm_last = n;
+
 	xcb_flush(x_con.c);
 }
 
+static void present(gp_backend *self, const gp_bbox *rects, unsigned int cnt)
+{
+	unsigned int i;
+
+	if (x_con.shm_support) {
+		shm_present(self, rects, cnt);
+		return;
+	}
+
+	for (i = 0; i < cnt; i++)
+		put_image(self, rects[i].x, rects[i].y, rects[i].w, rects[i].h);
+}
+
 static void x_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
                              gp_coord x1, gp_coord y1)
 {
@@ -215,24 +417,35 @@ static void x_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
 		return;
 	}
 
-	gp_size w = x1-x0+1;
-	gp_size h = y1-y0+1;
+	gp_bbox rect = gp_bbox_pack(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
 
-	if (x_con.shm_support)
-		put_shm_image(self, x0, y0, w, h);
-	else
-		put_image(self, x0, y0, w, h);
+	present(self, &rect, 1);
 
 	x_poll_events(self);
 }
 
-static void x_flip(gp_backend *self)
+static void x_update_rects(gp_backend *self, const gp_bbox *rects,
+                           unsigned int cnt)
 {
-	x_update_rect(self, 0, 0, self->pixmap->w - 1, self->pixmap->h - 1);
+	struct win *win = GP_BACKEND_PRIV(self);
+
+	GP_DEBUG(4, "Updating %u rects", cnt);
+
+	if (win->resized) {
+		GP_DEBUG(4, "Ignoring update rects, waiting for resize ack");
+		return;
+	}
+
+	present(self, rects, cnt);
 
 	x_poll_events(self);
 }
 
+static void x_flip(gp_backend *self)
+{
+	x_update_rect(self, 0, 0, self->pixmap->w - 1, self->pixmap->h - 1);
+}
+
 static int x_resize_ack(struct gp_backend *self)
 {
 	struct win *win = GP_BACKEND_PRIV(self);
@@ -263,6 +476,14 @@ static void x_ev(gp_backend *self, xcb_generic_event_t *ev)
 {
 	struct win *win = GP_BACKEND_PRIV(self);
 
+	if (x_con.shm_support &&
+	    (ev->response_type & ~0x80) == x_con.shm_completion_ev) {
+		/* Updates that were waiting for a free segment */
+		if (shm_completion(win, (xcb_shm_completion_event_t *)ev))
+			shm_present(self, NULL, 0);
+		return;
+	}
+
 	switch (ev->response_type & ~0x80) {
 	case XCB_EXPOSE: {
 		xcb_expose_event_t *eev = (xcb_expose_event_t *)ev;
@@ -281,8 +502,13 @@ static void x_ev(gp_backend *self, xcb_generic_event_t *ev)
 			break;
 		}
 
+		/*
+		 * Repaint from the last presented segment, it's not modified
+		 * by the application so we do not have to wait for completion.
+		 */
 		if (x_con.shm_support) {
-			put_shm_image(self, eev->x, eev->y, eev->width, eev->height);
+			put_shm_image(self, &win->shm_bufs[win->shm_last], eev->x, eev->y,
+			              eev->width, eev->height, 0);
 		} else {
 			xcb_copy_area(x_con.c, win->pixmap, win->win, win->gc,
 			              eev->x, eev->y,
@@ -372,20 +598,21 @@ static int create_shm_backing_pixmap(struct gp_backend *self, xcb_connection_t *
                                      gp_pixel_type pixel_type, int w, int h)
 {
 	struct win *win = GP_BACKEND_PRIV(self);
-	void *shm_addr;
+	unsigned int i;
 
-	self->pixmap = malloc(sizeof(gp_pixmap));
+	self->pixmap = gp_pixmap_alloc(w, h, pixel_type);
+	if (!self->pixmap)
+		return 1;
 
-	win->shmseg = xcb_generate_id(c);
+	for (i = 0; i < SHM_BUFS; i++)
+		win->shm_bufs[i].seg = xcb_generate_id(c);
 
-	shm_addr = attach_shm_pixmap(self, c, pixel_type, w, h);
-	if (!shm_addr) {
-		free(self->pixmap);
+	if (attach_shm_bufs(win, c, pixel_type, w, h)) {
+		gp_pixmap_free(self->pixmap);
+		self->pixmap = NULL;
 		return 1;
 	}
 
-	gp_pixmap_init(self->pixmap, w, h, pixel_type, shm_addr, 0);
-
 	return 0;
 }
 
@@ -618,8 +845,8 @@ static int x_set_cursor(gp_backend *self, enum gp_backend_cursors cursor)
 	return 0;
 }
 
-gp_backend *gp_xcb_init(const char *display, int x, int y, int w, int h,
-                        const char *caption)
+gp_backend *gp_xcb_init(const char *display, int x, int y,
+                        unsigned int w, unsigned int h, const char *caption)
 {
 	gp_backend *backend;
 	struct win *win;
@@ -654,6 +881,7 @@ gp_backend *gp_xcb_init(const char *display, int x, int y, int w, int h,
 	backend->name = "XCB";
 	backend->flip = x_flip;
 	backend->update_rect = x_update_rect;
+	backend->update_rects = x_update_rects;
 	backend->exit = x_exit;
 	backend->set_attr = x_set_attr;
 	backend->resize_ack = x_resize_ack;
@@ -667,8 +895,24 @@ err0:
 	return NULL;
 }
 
+int gp_xcb_present_stats_get(gp_backend *self, gp_x11_present_stats *stats)
+{
+	struct win *win = GP_BACKEND_PRIV(self);
+
+	if (!x_con.shm_support) {
+		errno = ENOSYS;
+		return 1;
+	}
+
+	*stats = win->stats;
+
+	return 0;
+}
+
 #else
 
+#include <errno.h>
+
 gp_backend *gp_xcb_init(const char *GP_UNUSED(display),
                         int GP_UNUSED(x), int GP_UNUSED(y),
                         unsigned int GP_UNUSED(w),
@@ -679,4 +923,11 @@ gp_backend *gp_xcb_init(const char *GP_UNUSED(display),
 	return NULL;
 }
 
+int gp_xcb_present_stats_get(gp_backend *GP_UNUSED(self),
+                             gp_x11_present_stats *GP_UNUSED(stats))
+{
+	errno = ENOSYS;
+	return 1;
+}
+
 #endif /* HAVE_LIBXCB */
@@ -386,7 +386,8 @@ gp_backend *gp_linux_drm_init(const char *drm_path, int flags)
 	ret->pixmap = &priv->pixmap;
 
 	ret->event_queue = &priv->ev_queue;
-	gp_ev_queue_init(ret->event_queue, ret->pixmap->w, ret->pixmap->h, 0, GP_EVENT_QUEUE_LOAD_KEYMAP);
+	gp_ev_queue_init(ret->event_queue, ret->pixmap->w, ret->pixmap->h,
+	                 0, GP_EVENT_QUEUE_LOAD_KEYMAP | GP_EVENT_QUEUE_COALESCE_MOTION);
 
 	ret->exit = backend_drm_exit;
 
@@ -24,11 +24,22 @@
 #include <backends/gp_linux_input.h>
 #include <backends/gp_linux_fb.h>
 
+/*
+ * Shadow rows are compared in blocks of this size, only changed blocks are
+ * written to the framebuffer.
+ */
+#define FB_BLOCK 64
+
 struct fb_priv {
 	gp_pixmap pixmap;
 	uint32_t bsize;
 	void *fb_mem;
 
+	/* Copy of the framebuffer content, valid after first flip */
+	void *last;
+	int last_valid;
+	gp_linux_fb_stats stats;
+
 	int flags;
 
 	/* console fd, nr and saved data */
@@ -296,8 +307,10 @@ static void fb_exit(gp_backend *self)
 {
 	struct fb_priv *fb = GP_BACKEND_PRIV(self);
 
-	if (fb->flags & GP_FB_SHADOW)
+	if (fb->flags & GP_FB_SHADOW) {
 		free(fb->pixmap.pixels);
+		free(fb->last);
+	}
 
 	/* unmap framebuffer */
 	munmap(fb->fb_mem, fb->bsize);
@@ -310,13 +323,101 @@ static void fb_exit(gp_backend *self)
 	free(self);
 }
 
+/*
+ * Framebuffer memory is usually uncached or write-combined, so we write it
+ * with aligned 64bit stores and never read it back.
+ */
+static void fb_write(void *dst, const void *src, size_t len)
+{
+	uint64_t *d = dst;
+	const uint64_t *s = src;
+
+	if (((uintptr_t)dst | (uintptr_t)src) & 7) {
+		memcpy(dst, src, len);
+		return;
+	}
+
+	for (; len >= 8; len -= 8)
+		*d++ = *s++;
+
+	if (len)
+		memcpy(d, s, len);
+}
+
+static void fb_write_span(struct fb_priv *fb, size_t off, size_t len)
+{
+	uint8_t *src = (uint8_t*)fb->pixmap.pixels + off;
+
+	fb_write((uint8_t*)fb->fb_mem + off, src, len);
+	memcpy((uint8_t*)fb->last + off, src, len);
+
+	fb->stats.bytes_written += len;
+	fb->stats.spans++;
+}
+
+/*
+ * Compares a span of bytes in a shadow row with the last written content in
+ * FB_BLOCK sized blocks and writes out runs of changed blocks.
+ */
+static void fb_flush_row(struct fb_priv *fb, gp_coord y, size_t start, size_t end)
+{
+	size_t row = (size_t)y * fb->pixmap.bytes_per_row;
+	const uint8_t *src = (uint8_t*)fb->pixmap.pixels + row;
+	const uint8_t *last = (uint8_t*)fb->last + row;
+	size_t off = start, run = 0, run_start = 0;
+
+	while (off < end) {
+		size_t block_end = GP_MIN((off / FB_BLOCK + 1) * FB_BLOCK, end);
+		size_t len = block_end - off;
+
+		if (memcmp(src + off, last + off, len)) {
+			if (!run)
+				run_start = off;
+			run += len;
+		} else {
+			if (run)
+				fb_write_span(fb, row + run_start, run);
+			run = 0;
+			fb->stats.bytes_skipped += len;
+		}
+
+		off = block_end;
+	}
+
+	if (run)
+		fb_write_span(fb, row + run_start, run);
+}
+
+static void fb_flush(struct fb_priv *fb, gp_coord x0, gp_coord y0,
+                     gp_coord x1, gp_coord y1)
+{
+	size_t bpp = gp_pixel_size(fb->pixmap.pixel_type);
+	size_t start = ((size_t)x0 * bpp) / 8;
+	size_t end = ((size_t)(x1 + 1) * bpp + 7) / 8;
+
+	for (; y0 <= y1; y0++)
+		fb_flush_row(fb, y0, start, end);
+
+	fb->stats.flushes++;
+}
+
 static void fb_flip_shadow(gp_backend *self)
 {
 	struct fb_priv *fb = GP_BACKEND_PRIV(self);
+	size_t size = (size_t)fb->pixmap.bytes_per_row * fb->pixmap.h;
 
 	GP_DEBUG(2, "Flipping buffer");
 
-	memcpy(fb->fb_mem, fb->pixmap.pixels, fb->bsize);
+	if (!fb->last_valid) {
+		fb_write(fb->fb_mem, fb->pixmap.pixels, size);
+		memcpy(fb->last, fb->pixmap.pixels, size);
+		fb->last_valid = 1;
+		fb->stats.bytes_written += size;
+		fb->stats.flushes++;
+		return;
+	}
+
+	fb_flush(fb, 0, 0, fb->pixmap.w - 1, fb->pixmap.h - 1);
 }
 
 static void fb_update_rect_shadow(gp_backend *self, gp_coord x0, gp_coord y0,
@@ -326,16 +427,37 @@ static void fb_update_rect_shadow(gp_backend *self, gp_coord x0, gp_coord y0,
 
 	GP_DEBUG(2, "Flipping buffer");
 
-	size_t bpp = gp_pixel_size(fb->pixmap.pixel_type);
-	size_t size = ((x1 - x0 + 1) * bpp) / 8;
-
-	for (;y0 <= y1; y0++) {
-		void *src = GP_PIXEL_ADDR(&fb->pixmap, x0, y0);
-		void *dst = (char*)fb->fb_mem +
-                            y0 * fb->pixmap.bytes_per_row +
-                            (x0 * bpp)/8;
-		memcpy(dst, src, size);
+	/*
+	 * Until first flip we do not know what is in the framebuffer, the
+	 * comparsion with the zeroed last buffer would skip black areas.
+	 */
+	if (!fb->last_valid) {
+		size_t bpp = gp_pixel_size(fb->pixmap.pixel_type);
+		size_t start = ((size_t)x0 * bpp) / 8;
+		size_t len = ((size_t)(x1 + 1) * bpp + 7) / 8 - start;
+
+		for (; y0 <= y1; y0++)
+			fb_write_span(fb, (size_t)y0 * fb->pixmap.bytes_per_row + start, len);
+
+		fb->stats.flushes++;
+		return;
 	}
+
+	fb_flush(fb, x0, y0, x1, y1);
+}
+
+int gp_linux_fb_stats_get(gp_backend *self, gp_linux_fb_stats *stats)
+{
+	struct fb_priv *fb = GP_BACKEND_PRIV(self);
+
+	if (!(fb->flags & GP_FB_SHADOW)) {
+		errno = ENOSYS;
+		return 1;
+	}
+
+	*stats = fb->stats;
+
+	return 0;
 }
 
 gp_backend *gp_linux_fb_init(const char *path, enum gp_linux_fb_flags flags)
@@ -423,10 +545,11 @@ gp_backend *gp_linux_fb_init(const char *path, enum gp_linux_fb_flags flags)
 
 	if (flags & GP_FB_SHADOW) {
 		fb->pixmap.pixels = malloc(fscri.smem_len);
+		fb->last = calloc(1, fscri.smem_len);
 
-		if (!fb->pixmap.pixels) {
+		if (!fb->pixmap.pixels || !fb->last) {
 			GP_DEBUG(1, "Malloc failed :(");
-			goto err3;
+			goto err4;
 		}
 	}
 
@@ -468,15 +591,18 @@ gp_backend *gp_linux_fb_init(const char *path, enum gp_linux_fb_flags flags)
 	backend->exit = fb_exit;
 	backend->event_queue = &fb->ev_queue;
 
-	gp_ev_queue_init(backend->event_queue, vscri.xres, vscri.yres, 0, GP_EVENT_QUEUE_LOAD_KEYMAP);
+	gp_ev_queue_init(backend->event_queue, vscri.xres, vscri.yres,
+	                 0, GP_EVENT_QUEUE_LOAD_KEYMAP | GP_EVENT_QUEUE_COALESCE_MOTION);
 
 	if (kbd)
 		gp_ev_queue_feedback_register(backend->event_queue, &fb->feedback);
 
 	return backend;
 err4:
-	if (flags & GP_FB_SHADOW)
+	if (flags & GP_FB_SHADOW) {
 		free(fb->pixmap.pixels);
+		free(fb->last);
+	}
 err3:
 	close(fd);
 err2:
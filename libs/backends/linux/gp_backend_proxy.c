@@ -14,9 +14,12 @@
 #include <sys/mman.h>
 #include <core/gp_debug.h>
 #include <core/gp_pixmap.h>
+#include <core/gp_blit.h>
+#include <utils/gp_damage.h>
 #include <backends/gp_backend.h>
 #include <backends/gp_proxy_proto.h>
 #include <backends/gp_proxy_conn.h>
+#include <backends/gp_proxy_shm.h>
 #include <backends/gp_proxy.h>
 
 struct proxy_priv {
@@ -34,8 +37,22 @@ struct proxy_priv {
 	/* mapped memory backing the pixmap */
 	void *map;
 	size_t map_size;
+
+	/* buffer ring in the mapped memory, single buffer unless announced */
+	unsigned int buffers;
+	size_t buf_size;
+	/* bitmask of buffers owned by the server */
+	unsigned int busy;
+	/* the application renders here when buffer ring is used */
+	gp_pixmap *app_pixmap;
+	/* areas not yet copied into a buffer and presented */
+	gp_damage pending;
 };
 
+#if GP_DAMAGE_RECTS > GP_PROXY_PRESENT_RECTS
+# error GP_PROXY_PRESENT_RECTS too small
+#endif
+
 static int proxy_set_attr(gp_backend *self, enum gp_backend_attrs attr, const void *vals)
 {
 	switch (attr) {
@@ -54,6 +71,8 @@ static void proxy_exit(gp_backend *self)
 	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
 
 	gp_proxy_send(priv->fd.fd, GP_PROXY_EXIT, NULL);
+
+	gp_pixmap_free(priv->app_pixmap);
 }
 
 static void map_buffer(gp_backend *self, union gp_proxy_msg *msg)
@@ -66,7 +85,7 @@ static void map_buffer(gp_backend *self, union gp_proxy_msg *msg)
 	         msg->map.map.path, msg->map.map.size);
 
 	fd = open(msg->map.map.path, O_RDWR);
-	if (!fd) {
+	if (fd < 0) {
 		GP_WARN("Invalid path for map event");
 		return;
 	}
@@ -82,16 +101,24 @@ static void map_buffer(gp_backend *self, union gp_proxy_msg *msg)
 	}
 
 	priv->map = p;
-	priv->map_size = msg->map.size;
+	priv->map_size = size;
 
 	gp_proxy_send(priv->fd.fd, GP_PROXY_MAP, NULL);
 }
 
+static gp_pixmap *render_pixmap(struct proxy_priv *priv)
+{
+	if (priv->app_pixmap)
+		return priv->app_pixmap;
+
+	return &priv->shm_pixmap;
+}
+
 static void visible(gp_backend *self)
 {
 	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
 
-	self->pixmap = &priv->shm_pixmap;
+	self->pixmap = render_pixmap(priv);
 
 	priv->visible = 1;
 
@@ -118,12 +145,38 @@ static void unmap_buffer(gp_backend *self)
 
 	priv->map = NULL;
 	priv->map_size = 0;
+	priv->busy = 0;
 
 //	hidden(self);
 
 	gp_proxy_send(priv->fd.fd, GP_PROXY_UNMAP, NULL);
 }
 
+/*
+ * With a buffer ring the application renders into a private pixmap and the
+ * damaged parts are copied into a free buffer on present.
+ */
+static void init_app_pixmap(struct proxy_priv *priv)
+{
+	gp_pixmap *pix = &priv->shm_pixmap;
+
+	if (priv->buffers < 2) {
+		gp_pixmap_free(priv->app_pixmap);
+		priv->app_pixmap = NULL;
+		return;
+	}
+
+	if (priv->app_pixmap &&
+	    priv->app_pixmap->w == pix->w && priv->app_pixmap->h == pix->h)
+		return;
+
+	gp_pixmap_free(priv->app_pixmap);
+
+	priv->app_pixmap = gp_pixmap_alloc(pix->w, pix->h, pix->pixel_type);
+	if (!priv->app_pixmap)
+		GP_WARN("Malloc failed, rendering into single buffer");
+}
+
 static void init_pixmap(gp_backend *self, union gp_proxy_msg *msg)
 {
 	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
@@ -133,16 +186,33 @@ static void init_pixmap(gp_backend *self, union gp_proxy_msg *msg)
 		return;
 	}
 
+	priv->buf_size = priv->map_size / priv->buffers;
+
+	if ((size_t)msg->pix.pix.bytes_per_row * msg->pix.pix.h > priv->buf_size) {
+		GP_WARN("Buffer too small for %ux%u pixmap",
+		        msg->pix.pix.w, msg->pix.pix.h);
+		return;
+	}
+
 	priv->shm_pixmap = msg->pix.pix;
 	priv->shm_pixmap.pixels = priv->map;
 
-	GP_DEBUG(1, "Pixmap %ux%u initialized", msg->pix.pix.w, msg->pix.pix.h);
+	GP_DEBUG(1, "Pixmap %ux%u initialized %u buffers",
+	         msg->pix.pix.w, msg->pix.pix.h, priv->buffers);
 
-	//TODO: check that the buffer is large enough!
+	priv->busy = 0;
+	gp_damage_clear(&priv->pending);
+
+	init_app_pixmap(priv);
+
+	if (priv->visible)
+		self->pixmap = render_pixmap(priv);
 
 	gp_ev_queue_set_screen_size(self->event_queue, msg->pix.pix.w, msg->pix.pix.h);
 }
 
+static void present_pending(gp_backend *self);
+
 static enum gp_poll_event_ret proxy_process_fd(gp_fd *self)
 {
 	gp_backend *backend = self->priv;
@@ -157,6 +227,11 @@ static enum gp_poll_event_ret proxy_process_fd(gp_fd *self)
 				GP_DEBUG(4, "Got GP_PROXY_CLI_INIT");
 				priv->dummy.pixel_type = msg->cli_init.cli_init.pixel_type;
 				backend->dpi = msg->cli_init.cli_init.dpi;
+				/* Older servers do not announce a buffer ring */
+				if (msg->size < 8 + sizeof(struct gp_proxy_cli_init_))
+					break;
+				priv->buffers = GP_MAX(1u, GP_MIN(msg->cli_init.cli_init.buffers,
+				                                  (unsigned int)GP_PROXY_SHM_BUFS));
 			break;
 			case GP_PROXY_EVENT:
 				GP_DEBUG(4, "Got GP_PROXY_EVENT");
@@ -188,6 +263,13 @@ static enum gp_poll_event_ret proxy_process_fd(gp_fd *self)
 				                           msg->cursor.pos.x,
 				                           msg->cursor.pos.y);
 			break;
+			case GP_PROXY_RELEASE:
+				GP_DEBUG(4, "Got GP_PROXY_RELEASE %u", msg->release.buf);
+				if (msg->release.buf < priv->buffers)
+					priv->busy &= ~(1u << msg->release.buf);
+				/* Updates that were waiting for a free buffer */
+				present_pending(backend);
+			break;
 			case GP_PROXY_EXIT:
 				GP_DEBUG(4, "Got GP_PROXY_EXIT");
 				gp_ev_queue_push(backend->event_queue, GP_EV_SYS,
@@ -205,26 +287,120 @@ static enum gp_poll_event_ret proxy_process_fd(gp_fd *self)
 	return 0;
 }
 
-static void proxy_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
-                             gp_coord x1, gp_coord y1)
+static void *buf_pixels(struct proxy_priv *priv, unsigned int buf)
+{
+	return (uint8_t*)priv->map + buf * priv->buf_size;
+}
+
+static int free_buffer(struct proxy_priv *priv)
+{
+	unsigned int i;
+
+	for (i = 0; i < priv->buffers; i++) {
+		if (!(priv->busy & (1u << i)))
+			return i;
+	}
+
+	return -1;
+}
+
+/*
+ * Copies the pending damage from the application pixmap into a free buffer and
+ * passes it to the server. If all buffers are owned by the server the damage
+ * is kept and presented once a buffer is released.
+ */
+static void present_pending(gp_backend *self)
+{
+	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
+	struct gp_proxy_present_ present;
+	gp_damage *pending = &priv->pending;
+	gp_pixmap dst = priv->shm_pixmap;
+	unsigned int i;
+	int buf;
+
+	if (!priv->visible || !priv->app_pixmap || gp_damage_empty(pending))
+		return;
+
+	buf = free_buffer(priv);
+	if (buf < 0) {
+		GP_DEBUG(4, "All buffers busy, deferring %u rects", pending->cnt);
+		return;
+	}
+
+	dst.pixels = buf_pixels(priv, buf);
+
+	present.buf = buf;
+	present.cnt = pending->cnt;
+
+	for (i = 0; i < pending->cnt; i++) {
+		gp_bbox *r = &pending->rects[i];
+
+		gp_blit_xywh_clipped(priv->app_pixmap, r->x, r->y, r->w, r->h,
+		                     &dst, r->x, r->y);
+
+		present.rects[i] = (struct gp_proxy_rect_) {
+			.x = r->x,
+			.y = r->y,
+			.w = r->w,
+			.h = r->h,
+		};
+	}
+
+	gp_damage_clear(pending);
+
+	GP_DEBUG(4, "Sending GP_PROXY_PRESENT buffer %i %u rects", buf, present.cnt);
+
+	if (gp_proxy_send(priv->fd.fd, GP_PROXY_PRESENT, &present))
+		return;
+
+	priv->busy |= 1u << buf;
+}
+
+static void update_rects(gp_backend *self, const gp_bbox *rects, unsigned int cnt)
 {
 	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
+	unsigned int i;
 
 	if (!priv->visible) {
 		GP_DEBUG(4, "Not visible!");
 		return;
 	}
 
-	struct gp_proxy_rect_ rect = {
-		.x = x0,
-		.y = y0,
-		.w = x1 - x0 + 1,
-		.h = y1 - y0 + 1,
-	};
+	if (priv->app_pixmap) {
+		/* Merges overlapping rectangles and limits the number of them */
+		for (i = 0; i < cnt; i++)
+			gp_damage_add(&priv->pending, rects[i]);
 
-	GP_DEBUG(4, "Sending GP_PROXY_UPDATE");
+		present_pending(self);
+		return;
+	}
+
+	for (i = 0; i < cnt; i++) {
+		struct gp_proxy_rect_ rect = {
+			.x = rects[i].x,
+			.y = rects[i].y,
+			.w = rects[i].w,
+			.h = rects[i].h,
+		};
 
-	gp_proxy_send(priv->fd.fd, GP_PROXY_UPDATE, &rect);
+		GP_DEBUG(4, "Sending GP_PROXY_UPDATE");
+
+		gp_proxy_send(priv->fd.fd, GP_PROXY_UPDATE, &rect);
+	}
+}
+
+static void proxy_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
+                             gp_coord x1, gp_coord y1)
+{
+	gp_bbox rect = gp_bbox_pack(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+
+	update_rects(self, &rect, 1);
+}
+
+static void proxy_update_rects(gp_backend *self, const gp_bbox *rects,
+                               unsigned int cnt)
+{
+	update_rects(self, rects, cnt);
 }
 
 static void proxy_flip(gp_backend *self)
@@ -274,12 +450,14 @@ gp_backend *gp_proxy_init(const char *path, const char *title)
 	ret->set_attr = proxy_set_attr;
 	ret->exit = proxy_exit;
 	ret->update_rect = proxy_update_rect;
+	ret->update_rects = proxy_update_rects;
 	ret->flip = proxy_flip;
 
 
 	priv->map = NULL;
 	priv->map_size = 0;
 	priv->visible = 0;
+	priv->buffers = 1;
 
 	gp_proxy_buf_init(&priv->buf);
 
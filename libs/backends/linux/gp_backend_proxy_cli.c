@@ -101,6 +101,19 @@ int gp_proxy_cli_msg(gp_proxy_cli *self, gp_proxy_msg **rmsg)
 		         msg->rect.rect.x, msg->rect.rect.y,
 			 msg->rect.rect.w, msg->rect.rect.h);
 	break;
+	case GP_PROXY_PRESENT:
+		if (msg->size < 16 ||
+		    msg->present.present.cnt > GP_PROXY_PRESENT_RECTS ||
+		    msg->size != 16 + msg->present.present.cnt * sizeof(struct gp_proxy_rect_)) {
+			GP_WARN("Client (%p) '%s' fd %i invalid present size %u",
+			        self, self->name, self->fd.fd, msg->size);
+			return 1;
+		}
+
+		GP_DEBUG(4, "Client (%p) '%s' fd %i presented buffer %u %u rects",
+		         self, self->name, self->fd.fd,
+		         msg->present.present.buf, msg->present.present.cnt);
+	break;
 	case GP_PROXY_MAP:
 		GP_DEBUG(1, "Client (%p) '%s' fd %i mapped buffer",
 		         self, self->name, self->fd.fd);
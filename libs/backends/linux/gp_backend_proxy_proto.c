@@ -99,6 +99,10 @@ const char *gp_proxy_msg_type_name(enum gp_proxy_msg_types type)
 		return "GP_PROXY_HIDE";
 	case GP_PROXY_CURSOR_POS:
 		return "GP_PROXY_CURSOR_POS";
+	case GP_PROXY_PRESENT:
+		return "GP_PROXY_PRESENT";
+	case GP_PROXY_RELEASE:
+		return "GP_PROXY_RELEASE";
 	case GP_PROXY_MAX:
 	break;
 	}
@@ -139,6 +143,19 @@ int gp_proxy_send(int fd, enum gp_proxy_msg_types type, void *payload)
 	case GP_PROXY_CURSOR_POS:
 		payload_size = sizeof(struct gp_proxy_coord);
 	break;
+	case GP_PROXY_PRESENT: {
+		struct gp_proxy_present_ *present = payload;
+
+		if (present->cnt > GP_PROXY_PRESENT_RECTS) {
+			GP_WARN("Too many rectangles %" PRIu32, present->cnt);
+			return 1;
+		}
+
+		payload_size = 8 + present->cnt * sizeof(struct gp_proxy_rect_);
+	} break;
+	case GP_PROXY_RELEASE:
+		payload_size = sizeof(uint32_t);
+	break;
 	default:
 	break;
 	}
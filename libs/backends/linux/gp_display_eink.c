@@ -4,11 +4,19 @@
  */
 
 #include <pthread.h>
+#include <string.h>
 #include <core/gp_debug.h>
 #include "gp_display_eink.h"
 
 static pthread_mutex_t repaint_lock = PTHREAD_MUTEX_INITIALIZER;
 
+/* Defaults for drivers that does not set the timings */
+#define FULL_REPAINT_MS 1000
+#define PART_REPAINT_MS 500
+/* 1000 pixels at 1bpp over 10MHz SPI */
+#define XFER_US_PER_KPX 100
+#define GHOST_LIMIT 5
+
 static int can_start_repaint(gp_backend *backend)
 {
 	struct gp_display_eink *eink = GP_BACKEND_PRIV(backend);
@@ -20,6 +28,9 @@ static void schedulle_full_repaint(gp_backend *self)
 {
 	struct gp_display_eink *eink = GP_BACKEND_PRIV(self);
 
+	/* Full repaint includes all queued partial repaints */
+	eink->part_queue_cnt = 0;
+
 	if (can_start_repaint(self)) {
 		GP_DEBUG(4, "Starting full repaint");
 		eink->repaint_full_start(self);
@@ -30,7 +41,144 @@ static void schedulle_full_repaint(gp_backend *self)
 	GP_DEBUG(4, "Queueing full repaint");
 
 	eink->do_full = 1;
-	eink->do_part = 0;
+}
+
+/* Estimated time to transfer and refresh an area in us */
+static uint64_t part_cost(struct gp_display_eink *eink, gp_bbox rect)
+{
+	uint64_t px = (uint64_t)rect.w * rect.h;
+
+	return 1000 * (uint64_t)eink->part_repaint_ms + px * eink->xfer_us_per_kpx / 1000;
+}
+
+static uint64_t full_cost(struct gp_display_eink *eink)
+{
+	uint64_t px = (uint64_t)eink->spi.w * eink->spi.h;
+
+	return 1000 * (uint64_t)eink->full_repaint_ms + px * eink->xfer_us_per_kpx / 1000;
+}
+
+/* How much longer it takes to refresh a and b merged than separately */
+static int64_t merge_penalty(struct gp_display_eink *eink, gp_bbox a, gp_bbox b)
+{
+	gp_bbox merged = gp_bbox_merge(a, b);
+
+	return part_cost(eink, merged) - part_cost(eink, a) - part_cost(eink, b);
+}
+
+static gp_bbox queue_take(struct gp_display_eink *eink, unsigned int i)
+{
+	gp_bbox ret = eink->part_queue[i];
+
+	eink->part_queue_cnt--;
+
+	memmove(&eink->part_queue[i], &eink->part_queue[i+1],
+	        sizeof(gp_bbox) * (eink->part_queue_cnt - i));
+
+	return ret;
+}
+
+static void queue_part_repaint(gp_backend *self, gp_bbox rect)
+{
+	struct gp_display_eink *eink = GP_BACKEND_PRIV(self);
+	uint64_t cost = 0;
+	unsigned int i;
+
+	/*
+	 * Overlapping areas have to be merged, otherwise the latter refresh
+	 * would repaint the already refreshed part again.
+	 */
+	for (i = 0; i < eink->part_queue_cnt; i++) {
+		gp_bbox q = eink->part_queue[i];
+
+		if (gp_bbox_intersects(q, rect) || merge_penalty(eink, q, rect) <= 0) {
+			rect = gp_bbox_merge(queue_take(eink, i), rect);
+			i = -1;
+		}
+	}
+
+	if (eink->part_queue_cnt >= GP_EINK_PART_QUEUE) {
+		unsigned int min_i = 0;
+		int64_t min_penalty = INT64_MAX;
+
+		for (i = 0; i < eink->part_queue_cnt; i++) {
+			int64_t penalty = merge_penalty(eink, eink->part_queue[i], rect);
+
+			if (penalty < min_penalty) {
+				min_penalty = penalty;
+				min_i = i;
+			}
+		}
+
+		rect = gp_bbox_merge(queue_take(eink, min_i), rect);
+	}
+
+	eink->part_queue[eink->part_queue_cnt++] = rect;
+
+	for (i = 0; i < eink->part_queue_cnt; i++)
+		cost += part_cost(eink, eink->part_queue[i]);
+
+	if (cost >= full_cost(eink)) {
+		GP_DEBUG(4, "Queued partial repaints slower than full repaint");
+		schedulle_full_repaint(self);
+		return;
+	}
+
+	GP_DEBUG(4, "Queued partial repaint " GP_BBOX_FMT " (%u queued)",
+	         GP_BBOX_PARS(rect), eink->part_queue_cnt);
+}
+
+static void ghost_cells(struct gp_display_eink *eink, gp_bbox rect,
+                        unsigned int *cx0, unsigned int *cy0,
+                        unsigned int *cx1, unsigned int *cy1)
+{
+	*cx0 = (uint32_t)rect.x * GP_EINK_GHOST_GRID / eink->spi.w;
+	*cy0 = (uint32_t)rect.y * GP_EINK_GHOST_GRID / eink->spi.h;
+	*cx1 = (uint32_t)(rect.x + rect.w - 1) * GP_EINK_GHOST_GRID / eink->spi.w;
+	*cy1 = (uint32_t)(rect.y + rect.h - 1) * GP_EINK_GHOST_GRID / eink->spi.h;
+}
+
+/*
+ * Accounts a partial refresh in the cells it covers, returns non-zero if any
+ * of the cells needs a full refresh instead.
+ */
+static int ghost_add(struct gp_display_eink *eink, gp_bbox rect)
+{
+	unsigned int x, y, cx0, cy0, cx1, cy1;
+
+	ghost_cells(eink, rect, &cx0, &cy0, &cx1, &cy1);
+
+	for (y = cy0; y <= cy1; y++) {
+		for (x = cx0; x <= cx1; x++) {
+			if (eink->ghost[y][x] >= eink->ghost_limit)
+				return 1;
+		}
+	}
+
+	for (y = cy0; y <= cy1; y++) {
+		for (x = cx0; x <= cx1; x++)
+			eink->ghost[y][x]++;
+	}
+
+	return 0;
+}
+
+static void start_part_repaint(gp_backend *self, gp_bbox rect)
+{
+	struct gp_display_eink *eink = GP_BACKEND_PRIV(self);
+
+	if (ghost_add(eink, rect)) {
+		GP_DEBUG(4, "Too many partial repaints in " GP_BBOX_FMT ", requesting full repaint",
+		         GP_BBOX_PARS(rect));
+		schedulle_full_repaint(self);
+		return;
+	}
+
+	GP_DEBUG(4, "Starting partial repaint " GP_BBOX_FMT, GP_BBOX_PARS(rect));
+
+	eink->repaint_part_start(self, rect.x, rect.y,
+	                         rect.x + rect.w - 1, rect.y + rect.h - 1);
+	eink->part_in_progress = 1;
 }
 
 static void gp_display_eink_flip(gp_backend *self)
@@ -43,21 +191,18 @@ static void gp_display_eink_flip(gp_backend *self)
 static void gp_display_eink_update_rect(gp_backend *self, gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1)
 {
 	struct gp_display_eink *eink = GP_BACKEND_PRIV(self);
+	gp_bbox rect = gp_bbox_pack(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
 
 	pthread_mutex_lock(&repaint_lock);
 
-	if (eink->part_cnt >= 5) {
-		eink->part_cnt = 0;
-		GP_DEBUG(4, "Five partial repaints in row, requesting full repaint");
+	if (part_cost(eink, rect) >= full_cost(eink)) {
+		GP_DEBUG(4, "Partial repaint slower than full repaint");
 		schedulle_full_repaint(self);
 		goto unlock;
 	}
 
 	if (can_start_repaint(self)) {
-		GP_DEBUG(4, "Starting partial repaint");
-		eink->part_cnt++;
-		eink->repaint_part_start(self, x0, y0, x1, y1);
-		eink->part_in_progress = 1;
+		start_part_repaint(self, rect);
 		goto unlock;
 	}
 
@@ -66,20 +211,7 @@ static void gp_display_eink_update_rect(gp_backend *self, gp_coord x0, gp_coord
 		goto unlock;
 	}
 
-	if (eink->do_part) {
-		eink->x0 = GP_MIN(eink->x0, x0);
-		eink->y0 = GP_MIN(eink->y0, y0);
-		eink->x1 = GP_MAX(eink->x1, x1);
-		eink->y1 = GP_MAX(eink->y1, y1);
-		GP_DEBUG(4, "Merging partial repaints");
-	} else {
-		eink->x0 = x0;
-		eink->y0 = y0;
-		eink->x1 = x1;
-		eink->y1 = y1;
-		eink->do_part = 1;
-		GP_DEBUG(4, "Queueing partial repaint");
-	}
+	queue_part_repaint(self, rect);
 unlock:
 	pthread_mutex_unlock(&repaint_lock);
 }
@@ -96,7 +228,7 @@ static enum gp_poll_event_ret flush_queued_repaints(gp_fd *self)
 	if (eink->full_in_progress) {
 		GP_DEBUG(4, "Finishing full repaint");
 		eink->full_in_progress = 0;
-		eink->part_cnt = 0;
+		memset(eink->ghost, 0, sizeof(eink->ghost));
 		eink->repaint_full_finish(backend);
 	}
 
@@ -119,12 +251,9 @@ static enum gp_poll_event_ret flush_queued_repaints(gp_fd *self)
 		goto unlock;
 	}
 
-	if (eink->do_part) {
+	if (eink->part_queue_cnt) {
 		GP_DEBUG(4, "Starting queued partial repaint");
-		eink->do_part = 0;
-		eink->part_cnt++;
-		eink->repaint_part_start(backend, eink->x0, eink->y0, eink->x1, eink->y1);
-		eink->part_in_progress = 1;
+		start_part_repaint(backend, queue_take(eink, 0));
 		goto unlock;
 	}
 
@@ -169,9 +298,23 @@ void gp_display_eink_init(gp_backend *self)
 {
 	struct gp_display_eink *eink = GP_BACKEND_PRIV(self);
 
-	eink->part_cnt = 0;
+	eink->part_queue_cnt = 0;
 	eink->exitting = 0;
 
+	memset(eink->ghost, 0, sizeof(eink->ghost));
+
+	if (!eink->full_repaint_ms)
+		eink->full_repaint_ms = FULL_REPAINT_MS;
+
+	if (!eink->part_repaint_ms)
+		eink->part_repaint_ms = PART_REPAINT_MS;
+
+	if (!eink->xfer_us_per_kpx)
+		eink->xfer_us_per_kpx = XFER_US_PER_KPX;
+
+	if (!eink->ghost_limit)
+		eink->ghost_limit = GHOST_LIMIT;
+
 	self->flip = gp_display_eink_flip;
 	self->update_rect = gp_display_eink_update_rect;
 	self->exit = eink_exit;
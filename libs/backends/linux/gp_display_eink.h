@@ -13,9 +13,14 @@
  * if not we turn off the display power, otherwise we repaint the display and
  * start the timer again.
  *
- * If the area to be repainted is small, we do partial refresh, if large full
- * refresh. Also after a few partial refreshes the display needs a full refresh
- * to get rid of the accumulated noise.
+ * Updates that arrive while the display is busy are queued as separate
+ * partial refreshes. Two queued areas are merged only if a single refresh of
+ * the merged area is estimated to be faster than two refreshes, and the whole
+ * queue is replaced by a full refresh once that is estimated to be faster.
+ *
+ * Also after a few partial refreshes of the same area the display needs a full
+ * refresh to get rid of the accumulated noise. The display is split into a
+ * grid and partial refreshes are counted for each grid cell.
  */
 
 #ifndef GP_DISPLAY_EINK_H
@@ -27,25 +32,39 @@
 
 #include "gp_display_spi.h"
 
+/* Maximal number of queued partial repaints */
+#define GP_EINK_PART_QUEUE 8
+
+/* Display is split into GP_EINK_GHOST_GRID x GP_EINK_GHOST_GRID cells */
+#define GP_EINK_GHOST_GRID 8
+
 struct gp_display_eink {
 	/* display hardware connection */
 	struct gp_display_spi spi;
 
-	/* partial refresh counter for e-paper */
-	unsigned int part_cnt;
-
-	/* how long on average repaint takes */
+	/*
+	 * How long on average repaint takes, defaults are set in
+	 * gp_display_eink_init() if zero.
+	 */
 	unsigned int full_repaint_ms;
 	unsigned int part_repaint_ms;
+	/* how long it takes to send 1000 pixels to the display in us */
+	unsigned int xfer_us_per_kpx;
+	/* partial refreshes of a cell before full refresh is needed */
+	unsigned int ghost_limit;
 
 	/* flags */
 	unsigned int part_in_progress:1;
 	unsigned int full_in_progress:1;
 	unsigned int do_full:1;
-	unsigned int do_part:1;
 	unsigned int exitting:1;
 
-	gp_coord x0, y0, x1, y1;
+	/* queued partial repaints */
+	unsigned int part_queue_cnt;
+	gp_bbox part_queue[GP_EINK_PART_QUEUE];
+
+	/* partial refresh counters per cell since last full refresh */
+	uint8_t ghost[GP_EINK_GHOST_GRID][GP_EINK_GHOST_GRID];
 
 	/* File descriptor for the busy interrupts */
 	gp_fd busy_fd;
@@ -184,38 +184,61 @@ static void input_syn(struct linux_input *self,
 	}
 }
 
-static enum gp_poll_event_ret input_read(gp_fd *self)
+static void input_event(struct linux_input *input, struct input_event *ev)
 {
-	struct linux_input *input = self->priv;
-	struct input_event ev;
-	int ret;
-
-	ret = read(input->fd.fd, &ev, sizeof(ev));
-
-	if (ret == -1 && errno == EAGAIN)
-		return 0;
-
-	if (ret < 1)
-		return 1;
-
-	switch (ev.type) {
+	switch (ev->type) {
 	case EV_REL:
-		input_rel(input, &ev);
+		input_rel(input, ev);
 	break;
 	case EV_ABS:
-		input_abs(input, &ev);
+		input_abs(input, ev);
 	break;
 	case EV_KEY:
-		input_key(input, input->backend->event_queue, &ev);
+		input_key(input, input->backend->event_queue, ev);
 	break;
 	case EV_SYN:
-		input_syn(input, input->backend->event_queue, &ev);
+		input_syn(input, input->backend->event_queue, ev);
 	break;
 	default:
-		GP_DEBUG(3, "Unhandled type %i", ev.type);
+		GP_DEBUG(3, "Unhandled type %i", ev->type);
 	}
+}
 
-	return 0;
+/*
+ * Maximal number of events read by a single read() call.
+ *
+ * Touchscreens and mice generate several events for each report, reading them
+ * in batches saves syscalls and the motion in the batch is merged in the event
+ * queue if enabled.
+ */
+#define INPUT_BATCH 64
+
+static enum gp_poll_event_ret input_read(gp_fd *self)
+{
+	struct linux_input *input = self->priv;
+	struct input_event ev[INPUT_BATCH];
+	ssize_t ret;
+	size_t i, cnt;
+
+	for (;;) {
+		ret = read(input->fd.fd, ev, sizeof(ev));
+
+		if (ret == -1 && errno == EAGAIN)
+			return 0;
+
+		if (ret < 1)
+			return 1;
+
+		cnt = ret / sizeof(*ev);
+
+		GP_DEBUG(4, "Read %zu events", cnt);
+
+		for (i = 0; i < cnt; i++)
+			input_event(input, &ev[i]);
+
+		if (cnt < INPUT_BATCH)
+			return 0;
+	}
 }
 
 static int get_version(int fd)
@@ -0,0 +1,19447 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_blit.gen.c
+ *
+ * GENERATED on 2026 10 19 15:07:32 from gp_blit.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Specialized blit functions and macros.
+ *
+ * Copyright (C) 2011      Tomas Gavenciak <gavento@ucw.cz>
+ * Copyright (C) 2011-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <string.h>
+
+#include <core/gp_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_pixmap.h>
+#include <core/gp_transform.h>
+#include <core/gp_blit.h>
+#include <core/gp_debug.h>
+#include <core/gp_convert.h>
+#include <core/gp_convert.gen.h>
+#include <core/gp_convert_scale.gen.h>
+#include <core/gp_mix_pixels2.gen.h>
+
+/*
+ * TODO: this is used for same pixel but different offset, could still be optimized
+ */
+static void blit_xyxy_naive_raw(const gp_pixmap *src,
+                                gp_coord x0, gp_coord y0,
+				gp_coord x1, gp_coord y1,
+                                gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p = gp_getpixel_raw(src, x, y);
+
+			if (src->pixel_type != dst->pixel_type)
+				p = gp_convert_pixmap_pixel(p, src, dst);
+
+			gp_putpixel_raw(dst, x2 + (x - x0), y2 + (y - y0), p);
+		}
+
+	}
+}
+
+/*
+ * Blit for equal pixel types 1BPP_DB
+ */
+static void blitXYXY_Raw_1BPP_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+# if 0
+	/* Rectangles may not be bit-aligned in the same way! */
+	/* Alignment (index) of first bits in the first byte */
+	//TODO: This is wrong for subpixmaps where the offset
+	//      needs to be summed with pixmap->offset and moduled
+	int al1 = GP_PIXEL_ADDR_OFFSET_1BPP_DB(x0);
+	int al2 = GP_PIXEL_ADDR_OFFSET_1BPP_DB(x2);
+	/* Special case of the same alignment and width >=2 bytes */
+	if ((al1 == al2) && ((x1 - x0 + 1) * 1 >= 16)) {
+		/* Number of bits in the last partial byte */
+		int end_al = GP_PIXEL_ADDR_OFFSET_1BPP_DB(x1);
+		GP_ASSERT((1 * (x1 - x0 + 1) - al1 - end_al) % 8 == 0);
+		int copy_size = (1 * (x1 - x0 + 1) - al1 - end_al) / 8;
+		/* First and last byte incident to the line */
+		uint8_t *p1 = (uint8_t *) GP_PIXEL_ADDR_1BPP_DB(src, x1, y1);
+		uint8_t *p2 = (uint8_t *) GP_PIXEL_ADDR_1BPP_DB(dst, x2, y2);
+		uint8_t *end_p1 = (uint8_t *) GP_PIXEL_ADDR_1BPP_DB(src, x1, y0);
+		uint8_t *end_p2 = (uint8_t *) GP_PIXEL_ADDR_1BPP_DB(dst, x2, y2);
+
+		gp_coord i;
+
+		for (i = 0; i < (y1 - y0 + 1); i++) {
+			if (al1 != 0)
+				GP_SET_BITS(al1, 8-al1, *p2, GP_GET_BITS(al1, 8-al1, *p1));
+			memcpy(p2+(al1!=0), p1+(al1!=0), copy_size);
+			if (end_al != 0)
+				GP_SET_BITS(0, end_al, *end_p2, GP_GET_BITS(0, end_al, *end_p1));
+			p1 += src->bytes_per_row;
+			end_p1 += src->bytes_per_row;
+			p2 += dst->bytes_per_row;
+			end_p2 += dst->bytes_per_row;
+		}
+	} else /* Different bit-alignment, can't use memcpy() */
+#endif
+		blit_xyxy_naive_raw(src, x0, y0, x1, y1, dst, x2, y2);
+}
+
+/*
+ * Blit for equal pixel types 1BPP_UB
+ */
+static void blitXYXY_Raw_1BPP_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+# if 0
+	/* Rectangles may not be bit-aligned in the same way! */
+	/* Alignment (index) of first bits in the first byte */
+	//TODO: This is wrong for subpixmaps where the offset
+	//      needs to be summed with pixmap->offset and moduled
+	int al1 = GP_PIXEL_ADDR_OFFSET_1BPP_UB(x0);
+	int al2 = GP_PIXEL_ADDR_OFFSET_1BPP_UB(x2);
+	/* Special case of the same alignment and width >=2 bytes */
+	if ((al1 == al2) && ((x1 - x0 + 1) * 1 >= 16)) {
+		/* Number of bits in the last partial byte */
+		int end_al = GP_PIXEL_ADDR_OFFSET_1BPP_UB(x1);
+		GP_ASSERT((1 * (x1 - x0 + 1) - al1 - end_al) % 8 == 0);
+		int copy_size = (1 * (x1 - x0 + 1) - al1 - end_al) / 8;
+		/* First and last byte incident to the line */
+		uint8_t *p1 = (uint8_t *) GP_PIXEL_ADDR_1BPP_UB(src, x1, y1);
+		uint8_t *p2 = (uint8_t *) GP_PIXEL_ADDR_1BPP_UB(dst, x2, y2);
+		uint8_t *end_p1 = (uint8_t *) GP_PIXEL_ADDR_1BPP_UB(src, x1, y0);
+		uint8_t *end_p2 = (uint8_t *) GP_PIXEL_ADDR_1BPP_UB(dst, x2, y2);
+
+		gp_coord i;
+
+		for (i = 0; i < (y1 - y0 + 1); i++) {
+			if (al1 != 0)
+				GP_SET_BITS(al1, 8-al1, *p2, GP_GET_BITS(al1, 8-al1, *p1));
+			memcpy(p2+(al1!=0), p1+(al1!=0), copy_size);
+			if (end_al != 0)
+				GP_SET_BITS(0, end_al, *end_p2, GP_GET_BITS(0, end_al, *end_p1));
+			p1 += src->bytes_per_row;
+			end_p1 += src->bytes_per_row;
+			p2 += dst->bytes_per_row;
+			end_p2 += dst->bytes_per_row;
+		}
+	} else /* Different bit-alignment, can't use memcpy() */
+#endif
+		blit_xyxy_naive_raw(src, x0, y0, x1, y1, dst, x2, y2);
+}
+
+/*
+ * Blit for equal pixel types 2BPP_DB
+ */
+static void blitXYXY_Raw_2BPP_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+# if 0
+	/* Rectangles may not be bit-aligned in the same way! */
+	/* Alignment (index) of first bits in the first byte */
+	//TODO: This is wrong for subpixmaps where the offset
+	//      needs to be summed with pixmap->offset and moduled
+	int al1 = GP_PIXEL_ADDR_OFFSET_2BPP_DB(x0);
+	int al2 = GP_PIXEL_ADDR_OFFSET_2BPP_DB(x2);
+	/* Special case of the same alignment and width >=2 bytes */
+	if ((al1 == al2) && ((x1 - x0 + 1) * 2 >= 16)) {
+		/* Number of bits in the last partial byte */
+		int end_al = GP_PIXEL_ADDR_OFFSET_2BPP_DB(x1);
+		GP_ASSERT((2 * (x1 - x0 + 1) - al1 - end_al) % 8 == 0);
+		int copy_size = (2 * (x1 - x0 + 1) - al1 - end_al) / 8;
+		/* First and last byte incident to the line */
+		uint8_t *p1 = (uint8_t *) GP_PIXEL_ADDR_2BPP_DB(src, x1, y1);
+		uint8_t *p2 = (uint8_t *) GP_PIXEL_ADDR_2BPP_DB(dst, x2, y2);
+		uint8_t *end_p1 = (uint8_t *) GP_PIXEL_ADDR_2BPP_DB(src, x1, y0);
+		uint8_t *end_p2 = (uint8_t *) GP_PIXEL_ADDR_2BPP_DB(dst, x2, y2);
+
+		gp_coord i;
+
+		for (i = 0; i < (y1 - y0 + 1); i++) {
+			if (al1 != 0)
+				GP_SET_BITS(al1, 8-al1, *p2, GP_GET_BITS(al1, 8-al1, *p1));
+			memcpy(p2+(al1!=0), p1+(al1!=0), copy_size);
+			if (end_al != 0)
+				GP_SET_BITS(0, end_al, *end_p2, GP_GET_BITS(0, end_al, *end_p1));
+			p1 += src->bytes_per_row;
+			end_p1 += src->bytes_per_row;
+			p2 += dst->bytes_per_row;
+			end_p2 += dst->bytes_per_row;
+		}
+	} else /* Different bit-alignment, can't use memcpy() */
+#endif
+		blit_xyxy_naive_raw(src, x0, y0, x1, y1, dst, x2, y2);
+}
+
+/*
+ * Blit for equal pixel types 2BPP_UB
+ */
+static void blitXYXY_Raw_2BPP_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+# if 0
+	/* Rectangles may not be bit-aligned in the same way! */
+	/* Alignment (index) of first bits in the first byte */
+	//TODO: This is wrong for subpixmaps where the offset
+	//      needs to be summed with pixmap->offset and moduled
+	int al1 = GP_PIXEL_ADDR_OFFSET_2BPP_UB(x0);
+	int al2 = GP_PIXEL_ADDR_OFFSET_2BPP_UB(x2);
+	/* Special case of the same alignment and width >=2 bytes */
+	if ((al1 == al2) && ((x1 - x0 + 1) * 2 >= 16)) {
+		/* Number of bits in the last partial byte */
+		int end_al = GP_PIXEL_ADDR_OFFSET_2BPP_UB(x1);
+		GP_ASSERT((2 * (x1 - x0 + 1) - al1 - end_al) % 8 == 0);
+		int copy_size = (2 * (x1 - x0 + 1) - al1 - end_al) / 8;
+		/* First and last byte incident to the line */
+		uint8_t *p1 = (uint8_t *) GP_PIXEL_ADDR_2BPP_UB(src, x1, y1);
+		uint8_t *p2 = (uint8_t *) GP_PIXEL_ADDR_2BPP_UB(dst, x2, y2);
+		uint8_t *end_p1 = (uint8_t *) GP_PIXEL_ADDR_2BPP_UB(src, x1, y0);
+		uint8_t *end_p2 = (uint8_t *) GP_PIXEL_ADDR_2BPP_UB(dst, x2, y2);
+
+		gp_coord i;
+
+		for (i = 0; i < (y1 - y0 + 1); i++) {
+			if (al1 != 0)
+				GP_SET_BITS(al1, 8-al1, *p2, GP_GET_BITS(al1, 8-al1, *p1));
+			memcpy(p2+(al1!=0), p1+(al1!=0), copy_size);
+			if (end_al != 0)
+				GP_SET_BITS(0, end_al, *end_p2, GP_GET_BITS(0, end_al, *end_p1));
+			p1 += src->bytes_per_row;
+			end_p1 += src->bytes_per_row;
+			p2 += dst->bytes_per_row;
+			end_p2 += dst->bytes_per_row;
+		}
+	} else /* Different bit-alignment, can't use memcpy() */
+#endif
+		blit_xyxy_naive_raw(src, x0, y0, x1, y1, dst, x2, y2);
+}
+
+/*
+ * Blit for equal pixel types 4BPP_DB
+ */
+static void blitXYXY_Raw_4BPP_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+# if 0
+	/* Rectangles may not be bit-aligned in the same way! */
+	/* Alignment (index) of first bits in the first byte */
+	//TODO: This is wrong for subpixmaps where the offset
+	//      needs to be summed with pixmap->offset and moduled
+	int al1 = GP_PIXEL_ADDR_OFFSET_4BPP_DB(x0);
+	int al2 = GP_PIXEL_ADDR_OFFSET_4BPP_DB(x2);
+	/* Special case of the same alignment and width >=2 bytes */
+	if ((al1 == al2) && ((x1 - x0 + 1) * 4 >= 16)) {
+		/* Number of bits in the last partial byte */
+		int end_al = GP_PIXEL_ADDR_OFFSET_4BPP_DB(x1);
+		GP_ASSERT((4 * (x1 - x0 + 1) - al1 - end_al) % 8 == 0);
+		int copy_size = (4 * (x1 - x0 + 1) - al1 - end_al) / 8;
+		/* First and last byte incident to the line */
+		uint8_t *p1 = (uint8_t *) GP_PIXEL_ADDR_4BPP_DB(src, x1, y1);
+		uint8_t *p2 = (uint8_t *) GP_PIXEL_ADDR_4BPP_DB(dst, x2, y2);
+		uint8_t *end_p1 = (uint8_t *) GP_PIXEL_ADDR_4BPP_DB(src, x1, y0);
+		uint8_t *end_p2 = (uint8_t *) GP_PIXEL_ADDR_4BPP_DB(dst, x2, y2);
+
+		gp_coord i;
+
+		for (i = 0; i < (y1 - y0 + 1); i++) {
+			if (al1 != 0)
+				GP_SET_BITS(al1, 8-al1, *p2, GP_GET_BITS(al1, 8-al1, *p1));
+			memcpy(p2+(al1!=0), p1+(al1!=0), copy_size);
+			if (end_al != 0)
+				GP_SET_BITS(0, end_al, *end_p2, GP_GET_BITS(0, end_al, *end_p1));
+			p1 += src->bytes_per_row;
+			end_p1 += src->bytes_per_row;
+			p2 += dst->bytes_per_row;
+			end_p2 += dst->bytes_per_row;
+		}
+	} else /* Different bit-alignment, can't use memcpy() */
+#endif
+		blit_xyxy_naive_raw(src, x0, y0, x1, y1, dst, x2, y2);
+}
+
+/*
+ * Blit for equal pixel types 4BPP_UB
+ */
+static void blitXYXY_Raw_4BPP_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+# if 0
+	/* Rectangles may not be bit-aligned in the same way! */
+	/* Alignment (index) of first bits in the first byte */
+	//TODO: This is wrong for subpixmaps where the offset
+	//      needs to be summed with pixmap->offset and moduled
+	int al1 = GP_PIXEL_ADDR_OFFSET_4BPP_UB(x0);
+	int al2 = GP_PIXEL_ADDR_OFFSET_4BPP_UB(x2);
+	/* Special case of the same alignment and width >=2 bytes */
+	if ((al1 == al2) && ((x1 - x0 + 1) * 4 >= 16)) {
+		/* Number of bits in the last partial byte */
+		int end_al = GP_PIXEL_ADDR_OFFSET_4BPP_UB(x1);
+		GP_ASSERT((4 * (x1 - x0 + 1) - al1 - end_al) % 8 == 0);
+		int copy_size = (4 * (x1 - x0 + 1) - al1 - end_al) / 8;
+		/* First and last byte incident to the line */
+		uint8_t *p1 = (uint8_t *) GP_PIXEL_ADDR_4BPP_UB(src, x1, y1);
+		uint8_t *p2 = (uint8_t *) GP_PIXEL_ADDR_4BPP_UB(dst, x2, y2);
+		uint8_t *end_p1 = (uint8_t *) GP_PIXEL_ADDR_4BPP_UB(src, x1, y0);
+		uint8_t *end_p2 = (uint8_t *) GP_PIXEL_ADDR_4BPP_UB(dst, x2, y2);
+
+		gp_coord i;
+
+		for (i = 0; i < (y1 - y0 + 1); i++) {
+			if (al1 != 0)
+				GP_SET_BITS(al1, 8-al1, *p2, GP_GET_BITS(al1, 8-al1, *p1));
+			memcpy(p2+(al1!=0), p1+(al1!=0), copy_size);
+			if (end_al != 0)
+				GP_SET_BITS(0, end_al, *end_p2, GP_GET_BITS(0, end_al, *end_p1));
+			p1 += src->bytes_per_row;
+			end_p1 += src->bytes_per_row;
+			p2 += dst->bytes_per_row;
+			end_p2 += dst->bytes_per_row;
+		}
+	} else /* Different bit-alignment, can't use memcpy() */
+#endif
+		blit_xyxy_naive_raw(src, x0, y0, x1, y1, dst, x2, y2);
+}
+
+/*
+ * Blit for equal pixel types 8BPP
+ */
+static void blitXYXY_Raw_8BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_8BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_8BPP(src, x0, y0 + y),
+		       1 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 16BPP
+ */
+static void blitXYXY_Raw_16BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_16BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_16BPP(src, x0, y0 + y),
+		       2 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 24BPP
+ */
+static void blitXYXY_Raw_24BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_24BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_24BPP(src, x0, y0 + y),
+		       3 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 32BPP
+ */
+static void blitXYXY_Raw_32BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_32BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_32BPP(src, x0, y0 + y),
+		       4 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 18BPP_DB
+ */
+static void blitXYXY_Raw_18BPP_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+# if 0
+	/* Rectangles may not be bit-aligned in the same way! */
+	/* Alignment (index) of first bits in the first byte */
+	//TODO: This is wrong for subpixmaps where the offset
+	//      needs to be summed with pixmap->offset and moduled
+	int al1 = GP_PIXEL_ADDR_OFFSET_18BPP_DB(x0);
+	int al2 = GP_PIXEL_ADDR_OFFSET_18BPP_DB(x2);
+	/* Special case of the same alignment and width >=2 bytes */
+	if ((al1 == al2) && ((x1 - x0 + 1) * 18 >= 16)) {
+		/* Number of bits in the last partial byte */
+		int end_al = GP_PIXEL_ADDR_OFFSET_18BPP_DB(x1);
+		GP_ASSERT((18 * (x1 - x0 + 1) - al1 - end_al) % 8 == 0);
+		int copy_size = (18 * (x1 - x0 + 1) - al1 - end_al) / 8;
+		/* First and last byte incident to the line */
+		uint8_t *p1 = (uint8_t *) GP_PIXEL_ADDR_18BPP_DB(src, x1, y1);
+		uint8_t *p2 = (uint8_t *) GP_PIXEL_ADDR_18BPP_DB(dst, x2, y2);
+		uint8_t *end_p1 = (uint8_t *) GP_PIXEL_ADDR_18BPP_DB(src, x1, y0);
+		uint8_t *end_p2 = (uint8_t *) GP_PIXEL_ADDR_18BPP_DB(dst, x2, y2);
+
+		gp_coord i;
+
+		for (i = 0; i < (y1 - y0 + 1); i++) {
+			if (al1 != 0)
+				GP_SET_BITS(al1, 8-al1, *p2, GP_GET_BITS(al1, 8-al1, *p1));
+			memcpy(p2+(al1!=0), p1+(al1!=0), copy_size);
+			if (end_al != 0)
+				GP_SET_BITS(0, end_al, *end_p2, GP_GET_BITS(0, end_al, *end_p1));
+			p1 += src->bytes_per_row;
+			end_p1 += src->bytes_per_row;
+			p2 += dst->bytes_per_row;
+			end_p2 += dst->bytes_per_row;
+		}
+	} else /* Different bit-alignment, can't use memcpy() */
+#endif
+		blit_xyxy_naive_raw(src, x0, y0, x1, y1, dst, x2, y2);
+}
+
+/*
+ * Generate Blits, I know this is n^2 variants but the gain is in speed is
+ * more than 50% and the size footprint for two for cycles is really small.
+ */
+/*
+ * Blits RGB101010 to xRGB8888
+ */
+static void blitXYXY_Raw_RGB101010_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to RGBA8888
+ */
+static void blitXYXY_Raw_RGB101010_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to RGB888
+ */
+static void blitXYXY_Raw_RGB101010_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to BGR888
+ */
+static void blitXYXY_Raw_RGB101010_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to RGB555
+ */
+static void blitXYXY_Raw_RGB101010_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to RGB565
+ */
+static void blitXYXY_Raw_RGB101010_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to RGB666
+ */
+static void blitXYXY_Raw_RGB101010_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to RGB332
+ */
+static void blitXYXY_Raw_RGB101010_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB101010_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to G1_DB
+ */
+static void blitXYXY_Raw_RGB101010_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to G2_DB
+ */
+static void blitXYXY_Raw_RGB101010_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to G4_DB
+ */
+static void blitXYXY_Raw_RGB101010_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to G1_UB
+ */
+static void blitXYXY_Raw_RGB101010_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to G2_UB
+ */
+static void blitXYXY_Raw_RGB101010_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to G4_UB
+ */
+static void blitXYXY_Raw_RGB101010_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to G8
+ */
+static void blitXYXY_Raw_RGB101010_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to GA88
+ */
+static void blitXYXY_Raw_RGB101010_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB101010 to G16
+ */
+static void blitXYXY_Raw_RGB101010_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGB101010
+ */
+static void blitXYXY_Raw_xRGB8888_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGBA8888
+ */
+static void blitXYXY_Raw_xRGB8888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGB888
+ */
+static void blitXYXY_Raw_xRGB8888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to BGR888
+ */
+static void blitXYXY_Raw_xRGB8888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGB555
+ */
+static void blitXYXY_Raw_xRGB8888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGB565
+ */
+static void blitXYXY_Raw_xRGB8888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGB666
+ */
+static void blitXYXY_Raw_xRGB8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGB332
+ */
+static void blitXYXY_Raw_xRGB8888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to CMYK8888
+ */
+static void blitXYXY_Raw_xRGB8888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G1_DB
+ */
+static void blitXYXY_Raw_xRGB8888_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G2_DB
+ */
+static void blitXYXY_Raw_xRGB8888_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G4_DB
+ */
+static void blitXYXY_Raw_xRGB8888_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G1_UB
+ */
+static void blitXYXY_Raw_xRGB8888_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G2_UB
+ */
+static void blitXYXY_Raw_xRGB8888_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G4_UB
+ */
+static void blitXYXY_Raw_xRGB8888_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G8
+ */
+static void blitXYXY_Raw_xRGB8888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to GA88
+ */
+static void blitXYXY_Raw_xRGB8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G16
+ */
+static void blitXYXY_Raw_xRGB8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGB101010
+ */
+static void blitXYXY_Raw_RGBA8888_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_RGB101010(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to xRGB8888
+ */
+static void blitXYXY_Raw_RGBA8888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_xRGB8888(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGB888
+ */
+static void blitXYXY_Raw_RGBA8888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_RGB888(p1, p2);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to BGR888
+ */
+static void blitXYXY_Raw_RGBA8888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_BGR888(p1, p2);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGB555
+ */
+static void blitXYXY_Raw_RGBA8888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_RGB555(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGB565
+ */
+static void blitXYXY_Raw_RGBA8888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_RGB565(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGB666
+ */
+static void blitXYXY_Raw_RGBA8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_18BPP_DB(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_RGB666(p1, p2);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGB332
+ */
+static void blitXYXY_Raw_RGBA8888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_RGB332(p1, p2);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to CMYK8888
+ */
+static void blitXYXY_Raw_RGBA8888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_CMYK8888(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G1_DB
+ */
+static void blitXYXY_Raw_RGBA8888_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_1BPP_DB(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_G1_DB(p1, p2);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G2_DB
+ */
+static void blitXYXY_Raw_RGBA8888_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_2BPP_DB(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_G2_DB(p1, p2);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G4_DB
+ */
+static void blitXYXY_Raw_RGBA8888_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_4BPP_DB(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_G4_DB(p1, p2);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G1_UB
+ */
+static void blitXYXY_Raw_RGBA8888_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_1BPP_UB(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_G1_UB(p1, p2);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G2_UB
+ */
+static void blitXYXY_Raw_RGBA8888_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_2BPP_UB(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_G2_UB(p1, p2);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G4_UB
+ */
+static void blitXYXY_Raw_RGBA8888_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_4BPP_UB(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_G4_UB(p1, p2);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G8
+ */
+static void blitXYXY_Raw_RGBA8888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_G8(p1, p2);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to GA88
+ */
+static void blitXYXY_Raw_RGBA8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_GA88(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G16
+ */
+static void blitXYXY_Raw_RGBA8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_G16(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGB101010
+ */
+static void blitXYXY_Raw_RGB888_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to xRGB8888
+ */
+static void blitXYXY_Raw_RGB888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGBA8888
+ */
+static void blitXYXY_Raw_RGB888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to BGR888
+ */
+static void blitXYXY_Raw_RGB888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGB555
+ */
+static void blitXYXY_Raw_RGB888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGB565
+ */
+static void blitXYXY_Raw_RGB888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGB666
+ */
+static void blitXYXY_Raw_RGB888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGB332
+ */
+static void blitXYXY_Raw_RGB888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G1_DB
+ */
+static void blitXYXY_Raw_RGB888_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G2_DB
+ */
+static void blitXYXY_Raw_RGB888_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G4_DB
+ */
+static void blitXYXY_Raw_RGB888_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G1_UB
+ */
+static void blitXYXY_Raw_RGB888_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G2_UB
+ */
+static void blitXYXY_Raw_RGB888_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G4_UB
+ */
+static void blitXYXY_Raw_RGB888_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G8
+ */
+static void blitXYXY_Raw_RGB888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to GA88
+ */
+static void blitXYXY_Raw_RGB888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G16
+ */
+static void blitXYXY_Raw_RGB888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGB101010
+ */
+static void blitXYXY_Raw_BGR888_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to xRGB8888
+ */
+static void blitXYXY_Raw_BGR888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGBA8888
+ */
+static void blitXYXY_Raw_BGR888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGB888
+ */
+static void blitXYXY_Raw_BGR888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGB555
+ */
+static void blitXYXY_Raw_BGR888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGB565
+ */
+static void blitXYXY_Raw_BGR888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGB666
+ */
+static void blitXYXY_Raw_BGR888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGB332
+ */
+static void blitXYXY_Raw_BGR888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to CMYK8888
+ */
+static void blitXYXY_Raw_BGR888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G1_DB
+ */
+static void blitXYXY_Raw_BGR888_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G2_DB
+ */
+static void blitXYXY_Raw_BGR888_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G4_DB
+ */
+static void blitXYXY_Raw_BGR888_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G1_UB
+ */
+static void blitXYXY_Raw_BGR888_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G2_UB
+ */
+static void blitXYXY_Raw_BGR888_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G4_UB
+ */
+static void blitXYXY_Raw_BGR888_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G8
+ */
+static void blitXYXY_Raw_BGR888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to GA88
+ */
+static void blitXYXY_Raw_BGR888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G16
+ */
+static void blitXYXY_Raw_BGR888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGB101010
+ */
+static void blitXYXY_Raw_RGB555_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to xRGB8888
+ */
+static void blitXYXY_Raw_RGB555_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGBA8888
+ */
+static void blitXYXY_Raw_RGB555_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGB888
+ */
+static void blitXYXY_Raw_RGB555_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to BGR888
+ */
+static void blitXYXY_Raw_RGB555_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGB565
+ */
+static void blitXYXY_Raw_RGB555_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGB666
+ */
+static void blitXYXY_Raw_RGB555_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGB332
+ */
+static void blitXYXY_Raw_RGB555_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB555_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G1_DB
+ */
+static void blitXYXY_Raw_RGB555_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G2_DB
+ */
+static void blitXYXY_Raw_RGB555_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G4_DB
+ */
+static void blitXYXY_Raw_RGB555_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G1_UB
+ */
+static void blitXYXY_Raw_RGB555_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G2_UB
+ */
+static void blitXYXY_Raw_RGB555_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G4_UB
+ */
+static void blitXYXY_Raw_RGB555_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G8
+ */
+static void blitXYXY_Raw_RGB555_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to GA88
+ */
+static void blitXYXY_Raw_RGB555_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G16
+ */
+static void blitXYXY_Raw_RGB555_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGB101010
+ */
+static void blitXYXY_Raw_RGB565_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to xRGB8888
+ */
+static void blitXYXY_Raw_RGB565_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGBA8888
+ */
+static void blitXYXY_Raw_RGB565_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGB888
+ */
+static void blitXYXY_Raw_RGB565_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to BGR888
+ */
+static void blitXYXY_Raw_RGB565_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGB555
+ */
+static void blitXYXY_Raw_RGB565_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGB666
+ */
+static void blitXYXY_Raw_RGB565_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGB332
+ */
+static void blitXYXY_Raw_RGB565_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB565_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G1_DB
+ */
+static void blitXYXY_Raw_RGB565_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G2_DB
+ */
+static void blitXYXY_Raw_RGB565_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G4_DB
+ */
+static void blitXYXY_Raw_RGB565_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G1_UB
+ */
+static void blitXYXY_Raw_RGB565_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G2_UB
+ */
+static void blitXYXY_Raw_RGB565_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G4_UB
+ */
+static void blitXYXY_Raw_RGB565_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G8
+ */
+static void blitXYXY_Raw_RGB565_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to GA88
+ */
+static void blitXYXY_Raw_RGB565_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G16
+ */
+static void blitXYXY_Raw_RGB565_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB101010
+ */
+static void blitXYXY_Raw_RGB666_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to xRGB8888
+ */
+static void blitXYXY_Raw_RGB666_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGBA8888
+ */
+static void blitXYXY_Raw_RGB666_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB888
+ */
+static void blitXYXY_Raw_RGB666_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to BGR888
+ */
+static void blitXYXY_Raw_RGB666_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB555
+ */
+static void blitXYXY_Raw_RGB666_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB565
+ */
+static void blitXYXY_Raw_RGB666_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB332
+ */
+static void blitXYXY_Raw_RGB666_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB666_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G1_DB
+ */
+static void blitXYXY_Raw_RGB666_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G2_DB
+ */
+static void blitXYXY_Raw_RGB666_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G4_DB
+ */
+static void blitXYXY_Raw_RGB666_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G1_UB
+ */
+static void blitXYXY_Raw_RGB666_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G2_UB
+ */
+static void blitXYXY_Raw_RGB666_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G4_UB
+ */
+static void blitXYXY_Raw_RGB666_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G8
+ */
+static void blitXYXY_Raw_RGB666_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to GA88
+ */
+static void blitXYXY_Raw_RGB666_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G16
+ */
+static void blitXYXY_Raw_RGB666_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGB101010
+ */
+static void blitXYXY_Raw_RGB332_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to xRGB8888
+ */
+static void blitXYXY_Raw_RGB332_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGBA8888
+ */
+static void blitXYXY_Raw_RGB332_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGB888
+ */
+static void blitXYXY_Raw_RGB332_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to BGR888
+ */
+static void blitXYXY_Raw_RGB332_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGB555
+ */
+static void blitXYXY_Raw_RGB332_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGB565
+ */
+static void blitXYXY_Raw_RGB332_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGB666
+ */
+static void blitXYXY_Raw_RGB332_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB332_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G1_DB
+ */
+static void blitXYXY_Raw_RGB332_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G2_DB
+ */
+static void blitXYXY_Raw_RGB332_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G4_DB
+ */
+static void blitXYXY_Raw_RGB332_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G1_UB
+ */
+static void blitXYXY_Raw_RGB332_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G2_UB
+ */
+static void blitXYXY_Raw_RGB332_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G4_UB
+ */
+static void blitXYXY_Raw_RGB332_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G8
+ */
+static void blitXYXY_Raw_RGB332_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to GA88
+ */
+static void blitXYXY_Raw_RGB332_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G16
+ */
+static void blitXYXY_Raw_RGB332_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB101010
+ */
+static void blitXYXY_Raw_CMYK8888_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to xRGB8888
+ */
+static void blitXYXY_Raw_CMYK8888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGBA8888
+ */
+static void blitXYXY_Raw_CMYK8888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB888
+ */
+static void blitXYXY_Raw_CMYK8888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to BGR888
+ */
+static void blitXYXY_Raw_CMYK8888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB555
+ */
+static void blitXYXY_Raw_CMYK8888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB565
+ */
+static void blitXYXY_Raw_CMYK8888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB666
+ */
+static void blitXYXY_Raw_CMYK8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB332
+ */
+static void blitXYXY_Raw_CMYK8888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G1_DB
+ */
+static void blitXYXY_Raw_CMYK8888_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G2_DB
+ */
+static void blitXYXY_Raw_CMYK8888_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G4_DB
+ */
+static void blitXYXY_Raw_CMYK8888_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G1_UB
+ */
+static void blitXYXY_Raw_CMYK8888_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G2_UB
+ */
+static void blitXYXY_Raw_CMYK8888_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G4_UB
+ */
+static void blitXYXY_Raw_CMYK8888_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G8
+ */
+static void blitXYXY_Raw_CMYK8888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to GA88
+ */
+static void blitXYXY_Raw_CMYK8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G16
+ */
+static void blitXYXY_Raw_CMYK8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to RGB101010
+ */
+static void blitXYXY_Raw_G1_DB_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to xRGB8888
+ */
+static void blitXYXY_Raw_G1_DB_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to RGBA8888
+ */
+static void blitXYXY_Raw_G1_DB_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to RGB888
+ */
+static void blitXYXY_Raw_G1_DB_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to BGR888
+ */
+static void blitXYXY_Raw_G1_DB_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to RGB555
+ */
+static void blitXYXY_Raw_G1_DB_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to RGB565
+ */
+static void blitXYXY_Raw_G1_DB_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to RGB666
+ */
+static void blitXYXY_Raw_G1_DB_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to RGB332
+ */
+static void blitXYXY_Raw_G1_DB_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to CMYK8888
+ */
+static void blitXYXY_Raw_G1_DB_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to G2_DB
+ */
+static void blitXYXY_Raw_G1_DB_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to G4_DB
+ */
+static void blitXYXY_Raw_G1_DB_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to G1_UB
+ */
+static void blitXYXY_Raw_G1_DB_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to G2_UB
+ */
+static void blitXYXY_Raw_G1_DB_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to G4_UB
+ */
+static void blitXYXY_Raw_G1_DB_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to G8
+ */
+static void blitXYXY_Raw_G1_DB_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to GA88
+ */
+static void blitXYXY_Raw_G1_DB_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_DB to G16
+ */
+static void blitXYXY_Raw_G1_DB_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to RGB101010
+ */
+static void blitXYXY_Raw_G2_DB_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to xRGB8888
+ */
+static void blitXYXY_Raw_G2_DB_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to RGBA8888
+ */
+static void blitXYXY_Raw_G2_DB_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to RGB888
+ */
+static void blitXYXY_Raw_G2_DB_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to BGR888
+ */
+static void blitXYXY_Raw_G2_DB_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to RGB555
+ */
+static void blitXYXY_Raw_G2_DB_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to RGB565
+ */
+static void blitXYXY_Raw_G2_DB_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to RGB666
+ */
+static void blitXYXY_Raw_G2_DB_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to RGB332
+ */
+static void blitXYXY_Raw_G2_DB_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to CMYK8888
+ */
+static void blitXYXY_Raw_G2_DB_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to G1_DB
+ */
+static void blitXYXY_Raw_G2_DB_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to G4_DB
+ */
+static void blitXYXY_Raw_G2_DB_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to G1_UB
+ */
+static void blitXYXY_Raw_G2_DB_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to G2_UB
+ */
+static void blitXYXY_Raw_G2_DB_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to G4_UB
+ */
+static void blitXYXY_Raw_G2_DB_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to G8
+ */
+static void blitXYXY_Raw_G2_DB_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to GA88
+ */
+static void blitXYXY_Raw_G2_DB_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_DB to G16
+ */
+static void blitXYXY_Raw_G2_DB_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to RGB101010
+ */
+static void blitXYXY_Raw_G4_DB_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to xRGB8888
+ */
+static void blitXYXY_Raw_G4_DB_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to RGBA8888
+ */
+static void blitXYXY_Raw_G4_DB_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to RGB888
+ */
+static void blitXYXY_Raw_G4_DB_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to BGR888
+ */
+static void blitXYXY_Raw_G4_DB_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to RGB555
+ */
+static void blitXYXY_Raw_G4_DB_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to RGB565
+ */
+static void blitXYXY_Raw_G4_DB_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to RGB666
+ */
+static void blitXYXY_Raw_G4_DB_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to RGB332
+ */
+static void blitXYXY_Raw_G4_DB_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to CMYK8888
+ */
+static void blitXYXY_Raw_G4_DB_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to G1_DB
+ */
+static void blitXYXY_Raw_G4_DB_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to G2_DB
+ */
+static void blitXYXY_Raw_G4_DB_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to G1_UB
+ */
+static void blitXYXY_Raw_G4_DB_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to G2_UB
+ */
+static void blitXYXY_Raw_G4_DB_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to G4_UB
+ */
+static void blitXYXY_Raw_G4_DB_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to G8
+ */
+static void blitXYXY_Raw_G4_DB_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to GA88
+ */
+static void blitXYXY_Raw_G4_DB_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_DB to G16
+ */
+static void blitXYXY_Raw_G4_DB_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to RGB101010
+ */
+static void blitXYXY_Raw_G1_UB_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to xRGB8888
+ */
+static void blitXYXY_Raw_G1_UB_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to RGBA8888
+ */
+static void blitXYXY_Raw_G1_UB_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to RGB888
+ */
+static void blitXYXY_Raw_G1_UB_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to BGR888
+ */
+static void blitXYXY_Raw_G1_UB_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to RGB555
+ */
+static void blitXYXY_Raw_G1_UB_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to RGB565
+ */
+static void blitXYXY_Raw_G1_UB_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to RGB666
+ */
+static void blitXYXY_Raw_G1_UB_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to RGB332
+ */
+static void blitXYXY_Raw_G1_UB_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to CMYK8888
+ */
+static void blitXYXY_Raw_G1_UB_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to G1_DB
+ */
+static void blitXYXY_Raw_G1_UB_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to G2_DB
+ */
+static void blitXYXY_Raw_G1_UB_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to G4_DB
+ */
+static void blitXYXY_Raw_G1_UB_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to G2_UB
+ */
+static void blitXYXY_Raw_G1_UB_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to G4_UB
+ */
+static void blitXYXY_Raw_G1_UB_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to G8
+ */
+static void blitXYXY_Raw_G1_UB_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to GA88
+ */
+static void blitXYXY_Raw_G1_UB_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1_UB to G16
+ */
+static void blitXYXY_Raw_G1_UB_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to RGB101010
+ */
+static void blitXYXY_Raw_G2_UB_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to xRGB8888
+ */
+static void blitXYXY_Raw_G2_UB_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to RGBA8888
+ */
+static void blitXYXY_Raw_G2_UB_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to RGB888
+ */
+static void blitXYXY_Raw_G2_UB_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to BGR888
+ */
+static void blitXYXY_Raw_G2_UB_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to RGB555
+ */
+static void blitXYXY_Raw_G2_UB_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to RGB565
+ */
+static void blitXYXY_Raw_G2_UB_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to RGB666
+ */
+static void blitXYXY_Raw_G2_UB_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to RGB332
+ */
+static void blitXYXY_Raw_G2_UB_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to CMYK8888
+ */
+static void blitXYXY_Raw_G2_UB_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to G1_DB
+ */
+static void blitXYXY_Raw_G2_UB_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to G2_DB
+ */
+static void blitXYXY_Raw_G2_UB_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to G4_DB
+ */
+static void blitXYXY_Raw_G2_UB_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to G1_UB
+ */
+static void blitXYXY_Raw_G2_UB_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to G4_UB
+ */
+static void blitXYXY_Raw_G2_UB_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to G8
+ */
+static void blitXYXY_Raw_G2_UB_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to GA88
+ */
+static void blitXYXY_Raw_G2_UB_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2_UB to G16
+ */
+static void blitXYXY_Raw_G2_UB_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to RGB101010
+ */
+static void blitXYXY_Raw_G4_UB_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to xRGB8888
+ */
+static void blitXYXY_Raw_G4_UB_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to RGBA8888
+ */
+static void blitXYXY_Raw_G4_UB_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to RGB888
+ */
+static void blitXYXY_Raw_G4_UB_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to BGR888
+ */
+static void blitXYXY_Raw_G4_UB_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to RGB555
+ */
+static void blitXYXY_Raw_G4_UB_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to RGB565
+ */
+static void blitXYXY_Raw_G4_UB_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to RGB666
+ */
+static void blitXYXY_Raw_G4_UB_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to RGB332
+ */
+static void blitXYXY_Raw_G4_UB_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to CMYK8888
+ */
+static void blitXYXY_Raw_G4_UB_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to G1_DB
+ */
+static void blitXYXY_Raw_G4_UB_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to G2_DB
+ */
+static void blitXYXY_Raw_G4_UB_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to G4_DB
+ */
+static void blitXYXY_Raw_G4_UB_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to G1_UB
+ */
+static void blitXYXY_Raw_G4_UB_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to G2_UB
+ */
+static void blitXYXY_Raw_G4_UB_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to G8
+ */
+static void blitXYXY_Raw_G4_UB_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to GA88
+ */
+static void blitXYXY_Raw_G4_UB_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4_UB to G16
+ */
+static void blitXYXY_Raw_G4_UB_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGB101010
+ */
+static void blitXYXY_Raw_G8_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to xRGB8888
+ */
+static void blitXYXY_Raw_G8_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGBA8888
+ */
+static void blitXYXY_Raw_G8_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGB888
+ */
+static void blitXYXY_Raw_G8_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to BGR888
+ */
+static void blitXYXY_Raw_G8_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGB555
+ */
+static void blitXYXY_Raw_G8_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGB565
+ */
+static void blitXYXY_Raw_G8_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGB666
+ */
+static void blitXYXY_Raw_G8_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGB332
+ */
+static void blitXYXY_Raw_G8_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to CMYK8888
+ */
+static void blitXYXY_Raw_G8_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G1_DB
+ */
+static void blitXYXY_Raw_G8_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G2_DB
+ */
+static void blitXYXY_Raw_G8_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G4_DB
+ */
+static void blitXYXY_Raw_G8_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G1_UB
+ */
+static void blitXYXY_Raw_G8_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G2_UB
+ */
+static void blitXYXY_Raw_G8_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G4_UB
+ */
+static void blitXYXY_Raw_G8_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to GA88
+ */
+static void blitXYXY_Raw_G8_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G16
+ */
+static void blitXYXY_Raw_G8_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB101010
+ */
+static void blitXYXY_Raw_GA88_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGB101010(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to xRGB8888
+ */
+static void blitXYXY_Raw_GA88_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_xRGB8888(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGBA8888
+ */
+static void blitXYXY_Raw_GA88_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGBA8888(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB888
+ */
+static void blitXYXY_Raw_GA88_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGB888(p1, p2);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to BGR888
+ */
+static void blitXYXY_Raw_GA88_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_BGR888(p1, p2);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB555
+ */
+static void blitXYXY_Raw_GA88_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGB555(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB565
+ */
+static void blitXYXY_Raw_GA88_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGB565(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB666
+ */
+static void blitXYXY_Raw_GA88_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_18BPP_DB(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGB666(p1, p2);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB332
+ */
+static void blitXYXY_Raw_GA88_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGB332(p1, p2);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to CMYK8888
+ */
+static void blitXYXY_Raw_GA88_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_CMYK8888(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G1_DB
+ */
+static void blitXYXY_Raw_GA88_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_1BPP_DB(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_G1_DB(p1, p2);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G2_DB
+ */
+static void blitXYXY_Raw_GA88_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_2BPP_DB(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_G2_DB(p1, p2);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G4_DB
+ */
+static void blitXYXY_Raw_GA88_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_4BPP_DB(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_G4_DB(p1, p2);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G1_UB
+ */
+static void blitXYXY_Raw_GA88_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_1BPP_UB(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_G1_UB(p1, p2);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G2_UB
+ */
+static void blitXYXY_Raw_GA88_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_2BPP_UB(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_G2_UB(p1, p2);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G4_UB
+ */
+static void blitXYXY_Raw_GA88_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_4BPP_UB(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_G4_UB(p1, p2);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G8
+ */
+static void blitXYXY_Raw_GA88_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_G8(p1, p2);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G16
+ */
+static void blitXYXY_Raw_GA88_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_G16(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB101010
+ */
+static void blitXYXY_Raw_G16_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to xRGB8888
+ */
+static void blitXYXY_Raw_G16_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGBA8888
+ */
+static void blitXYXY_Raw_G16_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB888
+ */
+static void blitXYXY_Raw_G16_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to BGR888
+ */
+static void blitXYXY_Raw_G16_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB555
+ */
+static void blitXYXY_Raw_G16_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB565
+ */
+static void blitXYXY_Raw_G16_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB666
+ */
+static void blitXYXY_Raw_G16_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB332
+ */
+static void blitXYXY_Raw_G16_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to CMYK8888
+ */
+static void blitXYXY_Raw_G16_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G1_DB
+ */
+static void blitXYXY_Raw_G16_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p3);
+			gp_putpixel_raw_1BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G2_DB
+ */
+static void blitXYXY_Raw_G16_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p3);
+			gp_putpixel_raw_2BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G4_DB
+ */
+static void blitXYXY_Raw_G16_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p3);
+			gp_putpixel_raw_4BPP_DB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G1_UB
+ */
+static void blitXYXY_Raw_G16_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p3);
+			gp_putpixel_raw_1BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G2_UB
+ */
+static void blitXYXY_Raw_G16_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p3);
+			gp_putpixel_raw_2BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G4_UB
+ */
+static void blitXYXY_Raw_G16_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p3);
+			gp_putpixel_raw_4BPP_UB(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G8
+ */
+static void blitXYXY_Raw_G16_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to GA88
+ */
+static void blitXYXY_Raw_G16_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+
+void gp_blit_xyxy_raw_fast(const gp_pixmap *src,
+                           gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                           gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* Same pixel type, could be (mostly) optimized to memcpy() */
+	if (src->pixel_type == dst->pixel_type) {
+		GP_FN_PER_PACK_PIXMAP(blitXYXY_Raw, src,
+		                      src, x0, y0, x1, y1, dst, x2, y2);
+		return;
+	}
+
+	/* Specialized functions */
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGB101010_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_RGB101010_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_RGB101010_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGB101010_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_RGB101010_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_RGB101010_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_RGB101010_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_RGB101010_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGB101010_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_RGB101010_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_RGB101010_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_RGB101010_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_RGB101010_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_RGB101010_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_RGB101010_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGB101010_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGB101010_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGB101010_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_xRGB8888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_xRGB8888_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_xRGB8888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_xRGB8888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_xRGB8888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_xRGB8888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_xRGB8888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_xRGB8888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_xRGB8888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_xRGB8888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_xRGB8888_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_xRGB8888_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_xRGB8888_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_xRGB8888_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_xRGB8888_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_xRGB8888_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_xRGB8888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_xRGB8888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_xRGB8888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGBA8888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_RGBA8888_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGBA8888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_RGBA8888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGBA8888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_RGBA8888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_RGBA8888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_RGBA8888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_RGBA8888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGBA8888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_RGBA8888_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_RGBA8888_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_RGBA8888_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_RGBA8888_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_RGBA8888_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_RGBA8888_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGBA8888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGBA8888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGBA8888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_RGB888_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGB888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_RGB888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGB888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_RGB888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_RGB888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_RGB888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_RGB888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGB888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_RGB888_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_RGB888_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_RGB888_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_RGB888_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_RGB888_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_RGB888_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGB888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGB888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGB888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_BGR888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_BGR888_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_BGR888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_BGR888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_BGR888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_BGR888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_BGR888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_BGR888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_BGR888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_BGR888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_BGR888_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_BGR888_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_BGR888_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_BGR888_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_BGR888_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_BGR888_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_BGR888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_BGR888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_BGR888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB555:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_RGB555_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGB555_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_RGB555_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_RGB555_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGB555_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_RGB555_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_RGB555_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_RGB555_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGB555_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_RGB555_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_RGB555_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_RGB555_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_RGB555_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_RGB555_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_RGB555_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGB555_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGB555_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGB555_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB565:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_RGB565_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGB565_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_RGB565_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_RGB565_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGB565_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_RGB565_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_RGB565_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_RGB565_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGB565_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_RGB565_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_RGB565_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_RGB565_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_RGB565_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_RGB565_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_RGB565_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGB565_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGB565_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGB565_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB666:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_RGB666_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGB666_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_RGB666_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_RGB666_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGB666_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_RGB666_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_RGB666_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_RGB666_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGB666_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_RGB666_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_RGB666_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_RGB666_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_RGB666_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_RGB666_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_RGB666_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGB666_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGB666_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGB666_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB332:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_RGB332_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGB332_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_RGB332_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_RGB332_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGB332_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_RGB332_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_RGB332_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_RGB332_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGB332_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_RGB332_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_RGB332_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_RGB332_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_RGB332_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_RGB332_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_RGB332_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGB332_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGB332_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGB332_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_CMYK8888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_CMYK8888_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_CMYK8888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_CMYK8888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_CMYK8888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_CMYK8888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_CMYK8888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_CMYK8888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_CMYK8888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_CMYK8888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_CMYK8888_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_CMYK8888_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_CMYK8888_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_CMYK8888_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_CMYK8888_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_CMYK8888_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_CMYK8888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_CMYK8888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_CMYK8888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G1_DB:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_G1_DB_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_G1_DB_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_G1_DB_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_G1_DB_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_G1_DB_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_G1_DB_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_G1_DB_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_G1_DB_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_G1_DB_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_G1_DB_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_G1_DB_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_G1_DB_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_G1_DB_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_G1_DB_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_G1_DB_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_G1_DB_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_G1_DB_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_G1_DB_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G2_DB:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_G2_DB_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_G2_DB_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_G2_DB_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_G2_DB_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_G2_DB_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_G2_DB_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_G2_DB_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_G2_DB_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_G2_DB_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_G2_DB_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_G2_DB_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_G2_DB_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_G2_DB_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_G2_DB_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_G2_DB_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_G2_DB_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_G2_DB_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_G2_DB_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G4_DB:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_G4_DB_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_G4_DB_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_G4_DB_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_G4_DB_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_G4_DB_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_G4_DB_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_G4_DB_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_G4_DB_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_G4_DB_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_G4_DB_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_G4_DB_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_G4_DB_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_G4_DB_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_G4_DB_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_G4_DB_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_G4_DB_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_G4_DB_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_G4_DB_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G1_UB:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_G1_UB_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_G1_UB_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_G1_UB_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_G1_UB_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_G1_UB_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_G1_UB_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_G1_UB_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_G1_UB_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_G1_UB_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_G1_UB_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_G1_UB_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_G1_UB_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_G1_UB_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_G1_UB_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_G1_UB_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_G1_UB_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_G1_UB_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_G1_UB_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G2_UB:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_G2_UB_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_G2_UB_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_G2_UB_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_G2_UB_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_G2_UB_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_G2_UB_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_G2_UB_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_G2_UB_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_G2_UB_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_G2_UB_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_G2_UB_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_G2_UB_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_G2_UB_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_G2_UB_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_G2_UB_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_G2_UB_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_G2_UB_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_G2_UB_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G4_UB:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_G4_UB_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_G4_UB_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_G4_UB_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_G4_UB_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_G4_UB_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_G4_UB_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_G4_UB_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_G4_UB_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_G4_UB_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_G4_UB_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_G4_UB_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_G4_UB_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_G4_UB_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_G4_UB_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_G4_UB_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_G4_UB_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_G4_UB_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_G4_UB_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G8:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_G8_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_G8_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_G8_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_G8_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_G8_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_G8_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_G8_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_G8_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_G8_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_G8_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_G8_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_G8_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_G8_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_G8_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_G8_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_G8_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_G8_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_G8_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_GA88:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_GA88_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_GA88_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_GA88_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_GA88_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_GA88_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_GA88_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_GA88_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_GA88_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_GA88_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_GA88_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_GA88_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_GA88_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_GA88_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_GA88_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_GA88_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_GA88_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_GA88_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_GA88_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G16:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_Raw_G16_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_G16_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_G16_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_G16_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_G16_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_G16_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_G16_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_G16_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_G16_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_G16_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_Raw_G16_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_Raw_G16_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_Raw_G16_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_Raw_G16_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_Raw_G16_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_Raw_G16_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_G16_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_G16_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	default:
+		GP_ABORT("Invalid source pixel %s",
+		         gp_pixel_type_name(src->pixel_type));
+	}
+}
+
+/*
+ * And the same for non-raw variants.
+ */
+/*
+ * Blits RGB101010 to xRGB8888
+ */
+static void blitXYXY_RGB101010_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to RGBA8888
+ */
+static void blitXYXY_RGB101010_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to RGB888
+ */
+static void blitXYXY_RGB101010_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to BGR888
+ */
+static void blitXYXY_RGB101010_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to RGB555
+ */
+static void blitXYXY_RGB101010_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to RGB565
+ */
+static void blitXYXY_RGB101010_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to RGB666
+ */
+static void blitXYXY_RGB101010_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to RGB332
+ */
+static void blitXYXY_RGB101010_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to CMYK8888
+ */
+static void blitXYXY_RGB101010_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to G1_DB
+ */
+static void blitXYXY_RGB101010_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to G2_DB
+ */
+static void blitXYXY_RGB101010_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to G4_DB
+ */
+static void blitXYXY_RGB101010_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to G1_UB
+ */
+static void blitXYXY_RGB101010_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to G2_UB
+ */
+static void blitXYXY_RGB101010_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to G4_UB
+ */
+static void blitXYXY_RGB101010_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to G8
+ */
+static void blitXYXY_RGB101010_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to GA88
+ */
+static void blitXYXY_RGB101010_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB101010 to G16
+ */
+static void blitXYXY_RGB101010_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGB101010_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to RGB101010
+ */
+static void blitXYXY_xRGB8888_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to RGBA8888
+ */
+static void blitXYXY_xRGB8888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to RGB888
+ */
+static void blitXYXY_xRGB8888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to BGR888
+ */
+static void blitXYXY_xRGB8888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to RGB555
+ */
+static void blitXYXY_xRGB8888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to RGB565
+ */
+static void blitXYXY_xRGB8888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to RGB666
+ */
+static void blitXYXY_xRGB8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to RGB332
+ */
+static void blitXYXY_xRGB8888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to CMYK8888
+ */
+static void blitXYXY_xRGB8888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to G1_DB
+ */
+static void blitXYXY_xRGB8888_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to G2_DB
+ */
+static void blitXYXY_xRGB8888_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to G4_DB
+ */
+static void blitXYXY_xRGB8888_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to G1_UB
+ */
+static void blitXYXY_xRGB8888_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to G2_UB
+ */
+static void blitXYXY_xRGB8888_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to G4_UB
+ */
+static void blitXYXY_xRGB8888_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to G8
+ */
+static void blitXYXY_xRGB8888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to GA88
+ */
+static void blitXYXY_xRGB8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to G16
+ */
+static void blitXYXY_xRGB8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to RGB101010
+ */
+static void blitXYXY_RGBA8888_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to xRGB8888
+ */
+static void blitXYXY_RGBA8888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to RGB888
+ */
+static void blitXYXY_RGBA8888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to BGR888
+ */
+static void blitXYXY_RGBA8888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to RGB555
+ */
+static void blitXYXY_RGBA8888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to RGB565
+ */
+static void blitXYXY_RGBA8888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to RGB666
+ */
+static void blitXYXY_RGBA8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to RGB332
+ */
+static void blitXYXY_RGBA8888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to CMYK8888
+ */
+static void blitXYXY_RGBA8888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to G1_DB
+ */
+static void blitXYXY_RGBA8888_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to G2_DB
+ */
+static void blitXYXY_RGBA8888_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to G4_DB
+ */
+static void blitXYXY_RGBA8888_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to G1_UB
+ */
+static void blitXYXY_RGBA8888_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to G2_UB
+ */
+static void blitXYXY_RGBA8888_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to G4_UB
+ */
+static void blitXYXY_RGBA8888_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to G8
+ */
+static void blitXYXY_RGBA8888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to GA88
+ */
+static void blitXYXY_RGBA8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to G16
+ */
+static void blitXYXY_RGBA8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to RGB101010
+ */
+static void blitXYXY_RGB888_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to xRGB8888
+ */
+static void blitXYXY_RGB888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to RGBA8888
+ */
+static void blitXYXY_RGB888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to BGR888
+ */
+static void blitXYXY_RGB888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to RGB555
+ */
+static void blitXYXY_RGB888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to RGB565
+ */
+static void blitXYXY_RGB888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to RGB666
+ */
+static void blitXYXY_RGB888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to RGB332
+ */
+static void blitXYXY_RGB888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to CMYK8888
+ */
+static void blitXYXY_RGB888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to G1_DB
+ */
+static void blitXYXY_RGB888_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to G2_DB
+ */
+static void blitXYXY_RGB888_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to G4_DB
+ */
+static void blitXYXY_RGB888_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to G1_UB
+ */
+static void blitXYXY_RGB888_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to G2_UB
+ */
+static void blitXYXY_RGB888_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to G4_UB
+ */
+static void blitXYXY_RGB888_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to G8
+ */
+static void blitXYXY_RGB888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to GA88
+ */
+static void blitXYXY_RGB888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to G16
+ */
+static void blitXYXY_RGB888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGB101010
+ */
+static void blitXYXY_BGR888_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to xRGB8888
+ */
+static void blitXYXY_BGR888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGBA8888
+ */
+static void blitXYXY_BGR888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGB888
+ */
+static void blitXYXY_BGR888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGB555
+ */
+static void blitXYXY_BGR888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGB565
+ */
+static void blitXYXY_BGR888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGB666
+ */
+static void blitXYXY_BGR888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGB332
+ */
+static void blitXYXY_BGR888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to CMYK8888
+ */
+static void blitXYXY_BGR888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to G1_DB
+ */
+static void blitXYXY_BGR888_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to G2_DB
+ */
+static void blitXYXY_BGR888_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to G4_DB
+ */
+static void blitXYXY_BGR888_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to G1_UB
+ */
+static void blitXYXY_BGR888_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to G2_UB
+ */
+static void blitXYXY_BGR888_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to G4_UB
+ */
+static void blitXYXY_BGR888_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to G8
+ */
+static void blitXYXY_BGR888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to GA88
+ */
+static void blitXYXY_BGR888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to G16
+ */
+static void blitXYXY_BGR888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to RGB101010
+ */
+static void blitXYXY_RGB555_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to xRGB8888
+ */
+static void blitXYXY_RGB555_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to RGBA8888
+ */
+static void blitXYXY_RGB555_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to RGB888
+ */
+static void blitXYXY_RGB555_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to BGR888
+ */
+static void blitXYXY_RGB555_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to RGB565
+ */
+static void blitXYXY_RGB555_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to RGB666
+ */
+static void blitXYXY_RGB555_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to RGB332
+ */
+static void blitXYXY_RGB555_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to CMYK8888
+ */
+static void blitXYXY_RGB555_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to G1_DB
+ */
+static void blitXYXY_RGB555_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to G2_DB
+ */
+static void blitXYXY_RGB555_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to G4_DB
+ */
+static void blitXYXY_RGB555_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to G1_UB
+ */
+static void blitXYXY_RGB555_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to G2_UB
+ */
+static void blitXYXY_RGB555_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to G4_UB
+ */
+static void blitXYXY_RGB555_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to G8
+ */
+static void blitXYXY_RGB555_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to GA88
+ */
+static void blitXYXY_RGB555_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to G16
+ */
+static void blitXYXY_RGB555_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to RGB101010
+ */
+static void blitXYXY_RGB565_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to xRGB8888
+ */
+static void blitXYXY_RGB565_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to RGBA8888
+ */
+static void blitXYXY_RGB565_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to RGB888
+ */
+static void blitXYXY_RGB565_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to BGR888
+ */
+static void blitXYXY_RGB565_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to RGB555
+ */
+static void blitXYXY_RGB565_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to RGB666
+ */
+static void blitXYXY_RGB565_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to RGB332
+ */
+static void blitXYXY_RGB565_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to CMYK8888
+ */
+static void blitXYXY_RGB565_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to G1_DB
+ */
+static void blitXYXY_RGB565_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to G2_DB
+ */
+static void blitXYXY_RGB565_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to G4_DB
+ */
+static void blitXYXY_RGB565_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to G1_UB
+ */
+static void blitXYXY_RGB565_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to G2_UB
+ */
+static void blitXYXY_RGB565_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to G4_UB
+ */
+static void blitXYXY_RGB565_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to G8
+ */
+static void blitXYXY_RGB565_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to GA88
+ */
+static void blitXYXY_RGB565_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to G16
+ */
+static void blitXYXY_RGB565_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to RGB101010
+ */
+static void blitXYXY_RGB666_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to xRGB8888
+ */
+static void blitXYXY_RGB666_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to RGBA8888
+ */
+static void blitXYXY_RGB666_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to RGB888
+ */
+static void blitXYXY_RGB666_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to BGR888
+ */
+static void blitXYXY_RGB666_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to RGB555
+ */
+static void blitXYXY_RGB666_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to RGB565
+ */
+static void blitXYXY_RGB666_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to RGB332
+ */
+static void blitXYXY_RGB666_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to CMYK8888
+ */
+static void blitXYXY_RGB666_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to G1_DB
+ */
+static void blitXYXY_RGB666_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to G2_DB
+ */
+static void blitXYXY_RGB666_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to G4_DB
+ */
+static void blitXYXY_RGB666_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to G1_UB
+ */
+static void blitXYXY_RGB666_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to G2_UB
+ */
+static void blitXYXY_RGB666_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to G4_UB
+ */
+static void blitXYXY_RGB666_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to G8
+ */
+static void blitXYXY_RGB666_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to GA88
+ */
+static void blitXYXY_RGB666_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to G16
+ */
+static void blitXYXY_RGB666_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to RGB101010
+ */
+static void blitXYXY_RGB332_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to xRGB8888
+ */
+static void blitXYXY_RGB332_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to RGBA8888
+ */
+static void blitXYXY_RGB332_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to RGB888
+ */
+static void blitXYXY_RGB332_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to BGR888
+ */
+static void blitXYXY_RGB332_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to RGB555
+ */
+static void blitXYXY_RGB332_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to RGB565
+ */
+static void blitXYXY_RGB332_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to RGB666
+ */
+static void blitXYXY_RGB332_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to CMYK8888
+ */
+static void blitXYXY_RGB332_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to G1_DB
+ */
+static void blitXYXY_RGB332_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to G2_DB
+ */
+static void blitXYXY_RGB332_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to G4_DB
+ */
+static void blitXYXY_RGB332_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to G1_UB
+ */
+static void blitXYXY_RGB332_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to G2_UB
+ */
+static void blitXYXY_RGB332_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to G4_UB
+ */
+static void blitXYXY_RGB332_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to G8
+ */
+static void blitXYXY_RGB332_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to GA88
+ */
+static void blitXYXY_RGB332_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to G16
+ */
+static void blitXYXY_RGB332_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGB101010
+ */
+static void blitXYXY_CMYK8888_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to xRGB8888
+ */
+static void blitXYXY_CMYK8888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGBA8888
+ */
+static void blitXYXY_CMYK8888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGB888
+ */
+static void blitXYXY_CMYK8888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to BGR888
+ */
+static void blitXYXY_CMYK8888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGB555
+ */
+static void blitXYXY_CMYK8888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGB565
+ */
+static void blitXYXY_CMYK8888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGB666
+ */
+static void blitXYXY_CMYK8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGB332
+ */
+static void blitXYXY_CMYK8888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to G1_DB
+ */
+static void blitXYXY_CMYK8888_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to G2_DB
+ */
+static void blitXYXY_CMYK8888_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to G4_DB
+ */
+static void blitXYXY_CMYK8888_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to G1_UB
+ */
+static void blitXYXY_CMYK8888_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to G2_UB
+ */
+static void blitXYXY_CMYK8888_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to G4_UB
+ */
+static void blitXYXY_CMYK8888_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to G8
+ */
+static void blitXYXY_CMYK8888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to GA88
+ */
+static void blitXYXY_CMYK8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to G16
+ */
+static void blitXYXY_CMYK8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to RGB101010
+ */
+static void blitXYXY_G1_DB_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to xRGB8888
+ */
+static void blitXYXY_G1_DB_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to RGBA8888
+ */
+static void blitXYXY_G1_DB_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to RGB888
+ */
+static void blitXYXY_G1_DB_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to BGR888
+ */
+static void blitXYXY_G1_DB_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to RGB555
+ */
+static void blitXYXY_G1_DB_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to RGB565
+ */
+static void blitXYXY_G1_DB_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to RGB666
+ */
+static void blitXYXY_G1_DB_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to RGB332
+ */
+static void blitXYXY_G1_DB_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to CMYK8888
+ */
+static void blitXYXY_G1_DB_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to G2_DB
+ */
+static void blitXYXY_G1_DB_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to G4_DB
+ */
+static void blitXYXY_G1_DB_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to G1_UB
+ */
+static void blitXYXY_G1_DB_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to G2_UB
+ */
+static void blitXYXY_G1_DB_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to G4_UB
+ */
+static void blitXYXY_G1_DB_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to G8
+ */
+static void blitXYXY_G1_DB_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to GA88
+ */
+static void blitXYXY_G1_DB_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_DB to G16
+ */
+static void blitXYXY_G1_DB_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			GP_PIXEL_G1_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to RGB101010
+ */
+static void blitXYXY_G2_DB_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to xRGB8888
+ */
+static void blitXYXY_G2_DB_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to RGBA8888
+ */
+static void blitXYXY_G2_DB_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to RGB888
+ */
+static void blitXYXY_G2_DB_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to BGR888
+ */
+static void blitXYXY_G2_DB_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to RGB555
+ */
+static void blitXYXY_G2_DB_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to RGB565
+ */
+static void blitXYXY_G2_DB_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to RGB666
+ */
+static void blitXYXY_G2_DB_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to RGB332
+ */
+static void blitXYXY_G2_DB_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to CMYK8888
+ */
+static void blitXYXY_G2_DB_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to G1_DB
+ */
+static void blitXYXY_G2_DB_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to G4_DB
+ */
+static void blitXYXY_G2_DB_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to G1_UB
+ */
+static void blitXYXY_G2_DB_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to G2_UB
+ */
+static void blitXYXY_G2_DB_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to G4_UB
+ */
+static void blitXYXY_G2_DB_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to G8
+ */
+static void blitXYXY_G2_DB_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to GA88
+ */
+static void blitXYXY_G2_DB_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_DB to G16
+ */
+static void blitXYXY_G2_DB_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			GP_PIXEL_G2_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to RGB101010
+ */
+static void blitXYXY_G4_DB_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to xRGB8888
+ */
+static void blitXYXY_G4_DB_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to RGBA8888
+ */
+static void blitXYXY_G4_DB_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to RGB888
+ */
+static void blitXYXY_G4_DB_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to BGR888
+ */
+static void blitXYXY_G4_DB_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to RGB555
+ */
+static void blitXYXY_G4_DB_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to RGB565
+ */
+static void blitXYXY_G4_DB_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to RGB666
+ */
+static void blitXYXY_G4_DB_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to RGB332
+ */
+static void blitXYXY_G4_DB_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to CMYK8888
+ */
+static void blitXYXY_G4_DB_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to G1_DB
+ */
+static void blitXYXY_G4_DB_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to G2_DB
+ */
+static void blitXYXY_G4_DB_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to G1_UB
+ */
+static void blitXYXY_G4_DB_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to G2_UB
+ */
+static void blitXYXY_G4_DB_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to G4_UB
+ */
+static void blitXYXY_G4_DB_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to G8
+ */
+static void blitXYXY_G4_DB_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to GA88
+ */
+static void blitXYXY_G4_DB_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_DB to G16
+ */
+static void blitXYXY_G4_DB_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			GP_PIXEL_G4_DB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to RGB101010
+ */
+static void blitXYXY_G1_UB_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to xRGB8888
+ */
+static void blitXYXY_G1_UB_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to RGBA8888
+ */
+static void blitXYXY_G1_UB_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to RGB888
+ */
+static void blitXYXY_G1_UB_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to BGR888
+ */
+static void blitXYXY_G1_UB_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to RGB555
+ */
+static void blitXYXY_G1_UB_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to RGB565
+ */
+static void blitXYXY_G1_UB_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to RGB666
+ */
+static void blitXYXY_G1_UB_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to RGB332
+ */
+static void blitXYXY_G1_UB_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to CMYK8888
+ */
+static void blitXYXY_G1_UB_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to G1_DB
+ */
+static void blitXYXY_G1_UB_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to G2_DB
+ */
+static void blitXYXY_G1_UB_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to G4_DB
+ */
+static void blitXYXY_G1_UB_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to G2_UB
+ */
+static void blitXYXY_G1_UB_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to G4_UB
+ */
+static void blitXYXY_G1_UB_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to G8
+ */
+static void blitXYXY_G1_UB_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to GA88
+ */
+static void blitXYXY_G1_UB_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1_UB to G16
+ */
+static void blitXYXY_G1_UB_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			GP_PIXEL_G1_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to RGB101010
+ */
+static void blitXYXY_G2_UB_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to xRGB8888
+ */
+static void blitXYXY_G2_UB_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to RGBA8888
+ */
+static void blitXYXY_G2_UB_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to RGB888
+ */
+static void blitXYXY_G2_UB_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to BGR888
+ */
+static void blitXYXY_G2_UB_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to RGB555
+ */
+static void blitXYXY_G2_UB_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to RGB565
+ */
+static void blitXYXY_G2_UB_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to RGB666
+ */
+static void blitXYXY_G2_UB_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to RGB332
+ */
+static void blitXYXY_G2_UB_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to CMYK8888
+ */
+static void blitXYXY_G2_UB_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to G1_DB
+ */
+static void blitXYXY_G2_UB_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to G2_DB
+ */
+static void blitXYXY_G2_UB_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to G4_DB
+ */
+static void blitXYXY_G2_UB_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to G1_UB
+ */
+static void blitXYXY_G2_UB_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to G4_UB
+ */
+static void blitXYXY_G2_UB_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to G8
+ */
+static void blitXYXY_G2_UB_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to GA88
+ */
+static void blitXYXY_G2_UB_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2_UB to G16
+ */
+static void blitXYXY_G2_UB_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			GP_PIXEL_G2_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to RGB101010
+ */
+static void blitXYXY_G4_UB_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to xRGB8888
+ */
+static void blitXYXY_G4_UB_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to RGBA8888
+ */
+static void blitXYXY_G4_UB_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to RGB888
+ */
+static void blitXYXY_G4_UB_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to BGR888
+ */
+static void blitXYXY_G4_UB_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to RGB555
+ */
+static void blitXYXY_G4_UB_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to RGB565
+ */
+static void blitXYXY_G4_UB_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to RGB666
+ */
+static void blitXYXY_G4_UB_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to RGB332
+ */
+static void blitXYXY_G4_UB_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to CMYK8888
+ */
+static void blitXYXY_G4_UB_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to G1_DB
+ */
+static void blitXYXY_G4_UB_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to G2_DB
+ */
+static void blitXYXY_G4_UB_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to G4_DB
+ */
+static void blitXYXY_G4_UB_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to G1_UB
+ */
+static void blitXYXY_G4_UB_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to G2_UB
+ */
+static void blitXYXY_G4_UB_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to G8
+ */
+static void blitXYXY_G4_UB_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to GA88
+ */
+static void blitXYXY_G4_UB_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4_UB to G16
+ */
+static void blitXYXY_G4_UB_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			GP_PIXEL_G4_UB_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGB101010
+ */
+static void blitXYXY_G8_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to xRGB8888
+ */
+static void blitXYXY_G8_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGBA8888
+ */
+static void blitXYXY_G8_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGB888
+ */
+static void blitXYXY_G8_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to BGR888
+ */
+static void blitXYXY_G8_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGB555
+ */
+static void blitXYXY_G8_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGB565
+ */
+static void blitXYXY_G8_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGB666
+ */
+static void blitXYXY_G8_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGB332
+ */
+static void blitXYXY_G8_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to CMYK8888
+ */
+static void blitXYXY_G8_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to G1_DB
+ */
+static void blitXYXY_G8_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to G2_DB
+ */
+static void blitXYXY_G8_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to G4_DB
+ */
+static void blitXYXY_G8_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to G1_UB
+ */
+static void blitXYXY_G8_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to G2_UB
+ */
+static void blitXYXY_G8_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to G4_UB
+ */
+static void blitXYXY_G8_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to GA88
+ */
+static void blitXYXY_G8_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to G16
+ */
+static void blitXYXY_G8_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGB101010
+ */
+static void blitXYXY_GA88_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to xRGB8888
+ */
+static void blitXYXY_GA88_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGBA8888
+ */
+static void blitXYXY_GA88_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGB888
+ */
+static void blitXYXY_GA88_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to BGR888
+ */
+static void blitXYXY_GA88_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGB555
+ */
+static void blitXYXY_GA88_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGB565
+ */
+static void blitXYXY_GA88_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGB666
+ */
+static void blitXYXY_GA88_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGB332
+ */
+static void blitXYXY_GA88_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to CMYK8888
+ */
+static void blitXYXY_GA88_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to G1_DB
+ */
+static void blitXYXY_GA88_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to G2_DB
+ */
+static void blitXYXY_GA88_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to G4_DB
+ */
+static void blitXYXY_GA88_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to G1_UB
+ */
+static void blitXYXY_GA88_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to G2_UB
+ */
+static void blitXYXY_GA88_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to G4_UB
+ */
+static void blitXYXY_GA88_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to G8
+ */
+static void blitXYXY_GA88_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to G16
+ */
+static void blitXYXY_GA88_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGB101010
+ */
+static void blitXYXY_G16_RGB101010(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB101010(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to xRGB8888
+ */
+static void blitXYXY_G16_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGBA8888
+ */
+static void blitXYXY_G16_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGB888
+ */
+static void blitXYXY_G16_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to BGR888
+ */
+static void blitXYXY_G16_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGB555
+ */
+static void blitXYXY_G16_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGB565
+ */
+static void blitXYXY_G16_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGB666
+ */
+static void blitXYXY_G16_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGB332
+ */
+static void blitXYXY_G16_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to CMYK8888
+ */
+static void blitXYXY_G16_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to G1_DB
+ */
+static void blitXYXY_G16_G1_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to G2_DB
+ */
+static void blitXYXY_G16_G2_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to G4_DB
+ */
+static void blitXYXY_G16_G4_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_DB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to G1_UB
+ */
+static void blitXYXY_G16_G1_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to G2_UB
+ */
+static void blitXYXY_G16_G2_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to G4_UB
+ */
+static void blitXYXY_G16_G4_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4_UB(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to G8
+ */
+static void blitXYXY_G16_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to GA88
+ */
+static void blitXYXY_G16_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+
+/*
+ * Same pixel type but with rotation.
+ */
+/*
+ * Blits for same pixel type and bpp 1BPP_DB
+ */
+static void blitXYXY_1BPP_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_1BPP_DB(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_DB(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 1BPP_UB
+ */
+static void blitXYXY_1BPP_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_1BPP_UB(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_UB(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 2BPP_DB
+ */
+static void blitXYXY_2BPP_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_2BPP_DB(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_DB(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 2BPP_UB
+ */
+static void blitXYXY_2BPP_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_2BPP_UB(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_UB(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 4BPP_DB
+ */
+static void blitXYXY_4BPP_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_4BPP_DB(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_DB(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 4BPP_UB
+ */
+static void blitXYXY_4BPP_UB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_4BPP_UB(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_UB(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 8BPP
+ */
+static void blitXYXY_8BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_8BPP(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 16BPP
+ */
+static void blitXYXY_16BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_16BPP(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 24BPP
+ */
+static void blitXYXY_24BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_24BPP(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 32BPP
+ */
+static void blitXYXY_32BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_32BPP(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 18BPP_DB
+ */
+static void blitXYXY_18BPP_DB(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_18BPP_DB(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_DB(dst, xt, yt, p);
+		}
+}
+
+void gp_blit_xyxy_fast(const gp_pixmap *src,
+                       gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                       gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	GP_DEBUG(2, "Blitting %s -> %s",
+	         gp_pixel_type_name(src->pixel_type),
+	         gp_pixel_type_name(dst->pixel_type));
+
+	/* Same pixel type */
+	if (src->pixel_type == dst->pixel_type) {
+		GP_FN_PER_PACK_PIXMAP(blitXYXY, src,
+		                      src, x0, y0, x1, y1, dst, x2, y2);
+		return;
+	}
+
+	if (gp_pixmap_rotation_equal(src, dst)) {
+		gp_blit_xyxy_raw_fast(src, x0, y0, x1, y1, dst, x2, y2);
+		return;
+	}
+
+	/* Specialized functions */
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGB101010_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_RGB101010_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_RGB101010_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGB101010_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_RGB101010_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_RGB101010_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_RGB101010_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_RGB101010_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGB101010_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_RGB101010_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_RGB101010_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_RGB101010_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_RGB101010_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_RGB101010_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_RGB101010_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGB101010_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGB101010_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGB101010_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_xRGB8888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_xRGB8888_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_xRGB8888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_xRGB8888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_xRGB8888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_xRGB8888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_xRGB8888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_xRGB8888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_xRGB8888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_xRGB8888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_xRGB8888_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_xRGB8888_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_xRGB8888_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_xRGB8888_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_xRGB8888_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_xRGB8888_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_xRGB8888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_xRGB8888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_xRGB8888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGBA8888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_RGBA8888_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGBA8888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_RGBA8888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGBA8888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_RGBA8888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_RGBA8888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_RGBA8888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_RGBA8888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGBA8888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_RGBA8888_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_RGBA8888_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_RGBA8888_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_RGBA8888_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_RGBA8888_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_RGBA8888_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGBA8888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGBA8888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGBA8888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_RGB888_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGB888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_RGB888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGB888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_RGB888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_RGB888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_RGB888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_RGB888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGB888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_RGB888_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_RGB888_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_RGB888_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_RGB888_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_RGB888_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_RGB888_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGB888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGB888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGB888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_BGR888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_BGR888_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_BGR888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_BGR888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_BGR888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_BGR888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_BGR888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_BGR888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_BGR888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_BGR888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_BGR888_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_BGR888_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_BGR888_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_BGR888_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_BGR888_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_BGR888_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_BGR888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_BGR888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_BGR888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB555:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_RGB555_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGB555_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_RGB555_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_RGB555_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGB555_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_RGB555_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_RGB555_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_RGB555_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGB555_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_RGB555_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_RGB555_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_RGB555_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_RGB555_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_RGB555_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_RGB555_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGB555_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGB555_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGB555_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB565:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_RGB565_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGB565_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_RGB565_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_RGB565_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGB565_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_RGB565_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_RGB565_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_RGB565_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGB565_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_RGB565_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_RGB565_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_RGB565_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_RGB565_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_RGB565_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_RGB565_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGB565_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGB565_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGB565_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB666:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_RGB666_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGB666_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_RGB666_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_RGB666_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGB666_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_RGB666_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_RGB666_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_RGB666_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGB666_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_RGB666_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_RGB666_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_RGB666_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_RGB666_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_RGB666_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_RGB666_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGB666_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGB666_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGB666_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB332:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_RGB332_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGB332_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_RGB332_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_RGB332_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGB332_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_RGB332_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_RGB332_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_RGB332_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGB332_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_RGB332_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_RGB332_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_RGB332_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_RGB332_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_RGB332_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_RGB332_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGB332_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGB332_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGB332_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_CMYK8888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_CMYK8888_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_CMYK8888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_CMYK8888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_CMYK8888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_CMYK8888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_CMYK8888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_CMYK8888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_CMYK8888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_CMYK8888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_CMYK8888_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_CMYK8888_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_CMYK8888_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_CMYK8888_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_CMYK8888_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_CMYK8888_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_CMYK8888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_CMYK8888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_CMYK8888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G1_DB:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_G1_DB_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_G1_DB_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_G1_DB_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_G1_DB_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_G1_DB_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_G1_DB_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_G1_DB_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_G1_DB_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_G1_DB_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_G1_DB_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_G1_DB_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_G1_DB_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_G1_DB_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_G1_DB_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_G1_DB_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_G1_DB_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_G1_DB_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_G1_DB_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G2_DB:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_G2_DB_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_G2_DB_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_G2_DB_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_G2_DB_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_G2_DB_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_G2_DB_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_G2_DB_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_G2_DB_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_G2_DB_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_G2_DB_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_G2_DB_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_G2_DB_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_G2_DB_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_G2_DB_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_G2_DB_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_G2_DB_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_G2_DB_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_G2_DB_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G4_DB:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_G4_DB_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_G4_DB_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_G4_DB_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_G4_DB_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_G4_DB_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_G4_DB_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_G4_DB_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_G4_DB_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_G4_DB_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_G4_DB_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_G4_DB_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_G4_DB_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_G4_DB_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_G4_DB_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_G4_DB_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_G4_DB_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_G4_DB_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_G4_DB_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G1_UB:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_G1_UB_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_G1_UB_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_G1_UB_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_G1_UB_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_G1_UB_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_G1_UB_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_G1_UB_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_G1_UB_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_G1_UB_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_G1_UB_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_G1_UB_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_G1_UB_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_G1_UB_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_G1_UB_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_G1_UB_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_G1_UB_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_G1_UB_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_G1_UB_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G2_UB:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_G2_UB_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_G2_UB_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_G2_UB_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_G2_UB_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_G2_UB_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_G2_UB_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_G2_UB_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_G2_UB_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_G2_UB_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_G2_UB_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_G2_UB_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_G2_UB_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_G2_UB_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_G2_UB_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_G2_UB_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_G2_UB_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_G2_UB_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_G2_UB_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G4_UB:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_G4_UB_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_G4_UB_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_G4_UB_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_G4_UB_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_G4_UB_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_G4_UB_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_G4_UB_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_G4_UB_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_G4_UB_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_G4_UB_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_G4_UB_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_G4_UB_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_G4_UB_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_G4_UB_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_G4_UB_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_G4_UB_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_G4_UB_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_G4_UB_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G8:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_G8_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_G8_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_G8_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_G8_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_G8_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_G8_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_G8_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_G8_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_G8_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_G8_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_G8_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_G8_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_G8_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_G8_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_G8_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_G8_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_G8_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_G8_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_GA88:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_GA88_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_GA88_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_GA88_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_GA88_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_GA88_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_GA88_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_GA88_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_GA88_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_GA88_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_GA88_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_GA88_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_GA88_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_GA88_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_GA88_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_GA88_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_GA88_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_GA88_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_GA88_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G16:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			blitXYXY_G16_RGB101010(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_G16_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_G16_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_G16_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_G16_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_G16_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_G16_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_G16_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_G16_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_G16_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_DB:
+			blitXYXY_G16_G1_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_DB:
+			blitXYXY_G16_G2_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_DB:
+			blitXYXY_G16_G4_DB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1_UB:
+			blitXYXY_G16_G1_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2_UB:
+			blitXYXY_G16_G2_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4_UB:
+			blitXYXY_G16_G4_UB(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_G16_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_G16_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	default:
+		GP_ABORT("Invalid source pixel %s",
+		         gp_pixel_type_name(src->pixel_type));
+	}
+}
@@ -0,0 +1,555 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_pixel.gen.c
+ *
+ * GENERATED on 2026 10 19 15:07:32 from gp_pixel.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Pixel type definitions and functions
+ *
+ * Copyright (C) 2011-2012 Tomas Gavenciak <gavento@ucw.cz>
+ * Copyright (C) 2011-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+#include <core/gp_pixel.h>
+#include <core/gp_get_set_bits.h>
+
+/*
+ * Description of all known pixel types
+ */
+const gp_pixel_type_desc gp_pixel_types[GP_PIXEL_MAX] = {
+	/* GP_PIXEL_UNKNOWN */ {
+		.type	= GP_PIXEL_UNKNOWN,
+		.name	= "UNKNOWN",
+		.size	= 0,
+		.pack   = 0,
+		.numchannels = 0,
+		.bitmap      = "",
+		.flags       = 0,
+		.channels    = {
+		}
+	},
+	/* GP_PIXEL_RGB101010 */ {
+		.type	= GP_PIXEL_RGB101010,
+		.name	= "RGB101010",
+		.size	= 32,
+		.pack   = 32,
+		.numchannels = 3,
+		.bitmap      = "BBBBBBBBBBGGGGGGGGGGRRRRRRRRRRxx",
+		.flags       = GP_PIXEL_IS_RGB,
+		.channels    = {
+			{.name = "R", .offset = 20, .size = 10, .lin_size = 12},
+			{.name = "G", .offset = 10, .size = 10, .lin_size = 12},
+			{.name = "B", .offset = 0, .size = 10, .lin_size = 12},
+		}
+	},
+	/* GP_PIXEL_xRGB8888 */ {
+		.type	= GP_PIXEL_xRGB8888,
+		.name	= "xRGB8888",
+		.size	= 32,
+		.pack   = 32,
+		.numchannels = 3,
+		.bitmap      = "BBBBBBBBGGGGGGGGRRRRRRRRxxxxxxxx",
+		.flags       = GP_PIXEL_IS_RGB,
+		.channels    = {
+			{.name = "R", .offset = 16, .size = 8, .lin_size = 10},
+			{.name = "G", .offset = 8, .size = 8, .lin_size = 10},
+			{.name = "B", .offset = 0, .size = 8, .lin_size = 10},
+		}
+	},
+	/* GP_PIXEL_RGBA8888 */ {
+		.type	= GP_PIXEL_RGBA8888,
+		.name	= "RGBA8888",
+		.size	= 32,
+		.pack   = 32,
+		.numchannels = 4,
+		.bitmap      = "AAAAAAAABBBBBBBBGGGGGGGGRRRRRRRR",
+		.flags       = GP_PIXEL_HAS_ALPHA | GP_PIXEL_IS_RGB,
+		.channels    = {
+			{.name = "R", .offset = 24, .size = 8, .lin_size = 10},
+			{.name = "G", .offset = 16, .size = 8, .lin_size = 10},
+			{.name = "B", .offset = 8, .size = 8, .lin_size = 10},
+			{.name = "A", .offset = 0, .size = 8, .lin_size = 8},
+		}
+	},
+	/* GP_PIXEL_RGB888 */ {
+		.type	= GP_PIXEL_RGB888,
+		.name	= "RGB888",
+		.size	= 24,
+		.pack   = 24,
+		.numchannels = 3,
+		.bitmap      = "BBBBBBBBGGGGGGGGRRRRRRRR",
+		.flags       = GP_PIXEL_IS_RGB,
+		.channels    = {
+			{.name = "R", .offset = 16, .size = 8, .lin_size = 10},
+			{.name = "G", .offset = 8, .size = 8, .lin_size = 10},
+			{.name = "B", .offset = 0, .size = 8, .lin_size = 10},
+		}
+	},
+	/* GP_PIXEL_BGR888 */ {
+		.type	= GP_PIXEL_BGR888,
+		.name	= "BGR888",
+		.size	= 24,
+		.pack   = 24,
+		.numchannels = 3,
+		.bitmap      = "RRRRRRRRGGGGGGGGBBBBBBBB",
+		.flags       = GP_PIXEL_IS_RGB,
+		.channels    = {
+			{.name = "B", .offset = 16, .size = 8, .lin_size = 10},
+			{.name = "G", .offset = 8, .size = 8, .lin_size = 10},
+			{.name = "R", .offset = 0, .size = 8, .lin_size = 10},
+		}
+	},
+	/* GP_PIXEL_RGB555 */ {
+		.type	= GP_PIXEL_RGB555,
+		.name	= "RGB555",
+		.size	= 16,
+		.pack   = 16,
+		.numchannels = 3,
+		.bitmap      = "BBBBBGGGGGRRRRRx",
+		.flags       = GP_PIXEL_IS_RGB,
+		.channels    = {
+			{.name = "R", .offset = 10, .size = 5, .lin_size = 7},
+			{.name = "G", .offset = 5, .size = 5, .lin_size = 7},
+			{.name = "B", .offset = 0, .size = 5, .lin_size = 7},
+		}
+	},
+	/* GP_PIXEL_RGB565 */ {
+		.type	= GP_PIXEL_RGB565,
+		.name	= "RGB565",
+		.size	= 16,
+		.pack   = 16,
+		.numchannels = 3,
+		.bitmap      = "BBBBBGGGGGGRRRRR",
+		.flags       = GP_PIXEL_IS_RGB,
+		.channels    = {
+			{.name = "R", .offset = 11, .size = 5, .lin_size = 7},
+			{.name = "G", .offset = 5, .size = 6, .lin_size = 8},
+			{.name = "B", .offset = 0, .size = 5, .lin_size = 7},
+		}
+	},
+	/* GP_PIXEL_RGB666 */ {
+		.type	= GP_PIXEL_RGB666,
+		.name	= "RGB666",
+		.size	= 18,
+		.pack   = 130,
+		.numchannels = 3,
+		.bitmap      = "BBBBBBGGGGGGRRRRRR",
+		.flags       = GP_PIXEL_IS_RGB,
+		.channels    = {
+			{.name = "R", .offset = 12, .size = 6, .lin_size = 8},
+			{.name = "G", .offset = 6, .size = 6, .lin_size = 8},
+			{.name = "B", .offset = 0, .size = 6, .lin_size = 8},
+		}
+	},
+	/* GP_PIXEL_RGB332 */ {
+		.type	= GP_PIXEL_RGB332,
+		.name	= "RGB332",
+		.size	= 8,
+		.pack   = 8,
+		.numchannels = 3,
+		.bitmap      = "BBGGGRRR",
+		.flags       = GP_PIXEL_IS_RGB,
+		.channels    = {
+			{.name = "R", .offset = 5, .size = 3, .lin_size = 5},
+			{.name = "G", .offset = 2, .size = 3, .lin_size = 5},
+			{.name = "B", .offset = 0, .size = 2, .lin_size = 4},
+		}
+	},
+	/* GP_PIXEL_CMYK8888 */ {
+		.type	= GP_PIXEL_CMYK8888,
+		.name	= "CMYK8888",
+		.size	= 32,
+		.pack   = 32,
+		.numchannels = 4,
+		.bitmap      = "CCCCCCCCMMMMMMMMYYYYYYYYKKKKKKKK",
+		.flags       = GP_PIXEL_IS_CMYK,
+		.channels    = {
+			{.name = "K", .offset = 24, .size = 8, .lin_size = 8},
+			{.name = "Y", .offset = 16, .size = 8, .lin_size = 8},
+			{.name = "M", .offset = 8, .size = 8, .lin_size = 8},
+			{.name = "C", .offset = 0, .size = 8, .lin_size = 8},
+		}
+	},
+	/* GP_PIXEL_P2 */ {
+		.type	= GP_PIXEL_P2,
+		.name	= "P2",
+		.size	= 2,
+		.pack   = 2,
+		.numchannels = 1,
+		.bitmap      = "PP",
+		.flags       = GP_PIXEL_IS_PALETTE,
+		.channels    = {
+			{.name = "P", .offset = 0, .size = 2, .lin_size = 2},
+		}
+	},
+	/* GP_PIXEL_P4 */ {
+		.type	= GP_PIXEL_P4,
+		.name	= "P4",
+		.size	= 4,
+		.pack   = 4,
+		.numchannels = 1,
+		.bitmap      = "PPPP",
+		.flags       = GP_PIXEL_IS_PALETTE,
+		.channels    = {
+			{.name = "P", .offset = 0, .size = 4, .lin_size = 4},
+		}
+	},
+	/* GP_PIXEL_P8 */ {
+		.type	= GP_PIXEL_P8,
+		.name	= "P8",
+		.size	= 8,
+		.pack   = 8,
+		.numchannels = 1,
+		.bitmap      = "PPPPPPPP",
+		.flags       = GP_PIXEL_IS_PALETTE,
+		.channels    = {
+			{.name = "P", .offset = 0, .size = 8, .lin_size = 8},
+		}
+	},
+	/* GP_PIXEL_G1_DB */ {
+		.type	= GP_PIXEL_G1_DB,
+		.name	= "G1_DB",
+		.size	= 1,
+		.pack   = 113,
+		.numchannels = 1,
+		.bitmap      = "V",
+		.flags       = GP_PIXEL_IS_GRAYSCALE,
+		.channels    = {
+			{.name = "V", .offset = 0, .size = 1, .lin_size = 1},
+		}
+	},
+	/* GP_PIXEL_G2_DB */ {
+		.type	= GP_PIXEL_G2_DB,
+		.name	= "G2_DB",
+		.size	= 2,
+		.pack   = 114,
+		.numchannels = 1,
+		.bitmap      = "VV",
+		.flags       = GP_PIXEL_IS_GRAYSCALE,
+		.channels    = {
+			{.name = "V", .offset = 0, .size = 2, .lin_size = 4},
+		}
+	},
+	/* GP_PIXEL_G4_DB */ {
+		.type	= GP_PIXEL_G4_DB,
+		.name	= "G4_DB",
+		.size	= 4,
+		.pack   = 116,
+		.numchannels = 1,
+		.bitmap      = "VVVV",
+		.flags       = GP_PIXEL_IS_GRAYSCALE,
+		.channels    = {
+			{.name = "V", .offset = 0, .size = 4, .lin_size = 6},
+		}
+	},
+	/* GP_PIXEL_G1_UB */ {
+		.type	= GP_PIXEL_G1_UB,
+		.name	= "G1_UB",
+		.size	= 1,
+		.pack   = 1,
+		.numchannels = 1,
+		.bitmap      = "V",
+		.flags       = GP_PIXEL_IS_GRAYSCALE,
+		.channels    = {
+			{.name = "V", .offset = 0, .size = 1, .lin_size = 1},
+		}
+	},
+	/* GP_PIXEL_G2_UB */ {
+		.type	= GP_PIXEL_G2_UB,
+		.name	= "G2_UB",
+		.size	= 2,
+		.pack   = 2,
+		.numchannels = 1,
+		.bitmap      = "VV",
+		.flags       = GP_PIXEL_IS_GRAYSCALE,
+		.channels    = {
+			{.name = "V", .offset = 0, .size = 2, .lin_size = 4},
+		}
+	},
+	/* GP_PIXEL_G4_UB */ {
+		.type	= GP_PIXEL_G4_UB,
+		.name	= "G4_UB",
+		.size	= 4,
+		.pack   = 4,
+		.numchannels = 1,
+		.bitmap      = "VVVV",
+		.flags       = GP_PIXEL_IS_GRAYSCALE,
+		.channels    = {
+			{.name = "V", .offset = 0, .size = 4, .lin_size = 6},
+		}
+	},
+	/* GP_PIXEL_G8 */ {
+		.type	= GP_PIXEL_G8,
+		.name	= "G8",
+		.size	= 8,
+		.pack   = 8,
+		.numchannels = 1,
+		.bitmap      = "VVVVVVVV",
+		.flags       = GP_PIXEL_IS_GRAYSCALE,
+		.channels    = {
+			{.name = "V", .offset = 0, .size = 8, .lin_size = 10},
+		}
+	},
+	/* GP_PIXEL_GA88 */ {
+		.type	= GP_PIXEL_GA88,
+		.name	= "GA88",
+		.size	= 16,
+		.pack   = 16,
+		.numchannels = 2,
+		.bitmap      = "VVVVVVVVAAAAAAAA",
+		.flags       = GP_PIXEL_HAS_ALPHA | GP_PIXEL_IS_GRAYSCALE,
+		.channels    = {
+			{.name = "V", .offset = 0, .size = 8, .lin_size = 10},
+			{.name = "A", .offset = 8, .size = 8, .lin_size = 8},
+		}
+	},
+	/* GP_PIXEL_G16 */ {
+		.type	= GP_PIXEL_G16,
+		.name	= "G16",
+		.size	= 16,
+		.pack   = 16,
+		.numchannels = 1,
+		.bitmap      = "VVVVVVVVVVVVVVVV",
+		.flags       = GP_PIXEL_IS_GRAYSCALE,
+		.channels    = {
+			{.name = "V", .offset = 0, .size = 16, .lin_size = 18},
+		}
+	},
+};
+
+/*
+ * snprintf a human readable value of pixel type RGB101010
+ */
+static void pixel_snprint_RGB101010(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "RGB101010 0x%08lx R=%li G=%li B=%li",
+		(unsigned long int)GP_GET_BITS(0, 32, p),
+		(long int) GP_PIXEL_GET_R_RGB101010(p), (long int) GP_PIXEL_GET_G_RGB101010(p), (long int) GP_PIXEL_GET_B_RGB101010(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type xRGB8888
+ */
+static void pixel_snprint_xRGB8888(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "xRGB8888 0x%08lx R=%li G=%li B=%li",
+		(unsigned long int)GP_GET_BITS(0, 32, p),
+		(long int) GP_PIXEL_GET_R_xRGB8888(p), (long int) GP_PIXEL_GET_G_xRGB8888(p), (long int) GP_PIXEL_GET_B_xRGB8888(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type RGBA8888
+ */
+static void pixel_snprint_RGBA8888(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "RGBA8888 0x%08lx R=%li G=%li B=%li A=%li",
+		(unsigned long int)GP_GET_BITS(0, 32, p),
+		(long int) GP_PIXEL_GET_R_RGBA8888(p), (long int) GP_PIXEL_GET_G_RGBA8888(p), (long int) GP_PIXEL_GET_B_RGBA8888(p), (long int) GP_PIXEL_GET_A_RGBA8888(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type RGB888
+ */
+static void pixel_snprint_RGB888(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "RGB888 0x%06lx R=%li G=%li B=%li",
+		(unsigned long int)GP_GET_BITS(0, 24, p),
+		(long int) GP_PIXEL_GET_R_RGB888(p), (long int) GP_PIXEL_GET_G_RGB888(p), (long int) GP_PIXEL_GET_B_RGB888(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type BGR888
+ */
+static void pixel_snprint_BGR888(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "BGR888 0x%06lx B=%li G=%li R=%li",
+		(unsigned long int)GP_GET_BITS(0, 24, p),
+		(long int) GP_PIXEL_GET_B_BGR888(p), (long int) GP_PIXEL_GET_G_BGR888(p), (long int) GP_PIXEL_GET_R_BGR888(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type RGB555
+ */
+static void pixel_snprint_RGB555(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "RGB555 0x%04lx R=%li G=%li B=%li",
+		(unsigned long int)GP_GET_BITS(0, 16, p),
+		(long int) GP_PIXEL_GET_R_RGB555(p), (long int) GP_PIXEL_GET_G_RGB555(p), (long int) GP_PIXEL_GET_B_RGB555(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type RGB565
+ */
+static void pixel_snprint_RGB565(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "RGB565 0x%04lx R=%li G=%li B=%li",
+		(unsigned long int)GP_GET_BITS(0, 16, p),
+		(long int) GP_PIXEL_GET_R_RGB565(p), (long int) GP_PIXEL_GET_G_RGB565(p), (long int) GP_PIXEL_GET_B_RGB565(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type RGB666
+ */
+static void pixel_snprint_RGB666(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "RGB666 0x%05lx R=%li G=%li B=%li",
+		(unsigned long int)GP_GET_BITS(0, 18, p),
+		(long int) GP_PIXEL_GET_R_RGB666(p), (long int) GP_PIXEL_GET_G_RGB666(p), (long int) GP_PIXEL_GET_B_RGB666(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type RGB332
+ */
+static void pixel_snprint_RGB332(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "RGB332 0x%02lx R=%li G=%li B=%li",
+		(unsigned long int)GP_GET_BITS(0, 8, p),
+		(long int) GP_PIXEL_GET_R_RGB332(p), (long int) GP_PIXEL_GET_G_RGB332(p), (long int) GP_PIXEL_GET_B_RGB332(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type CMYK8888
+ */
+static void pixel_snprint_CMYK8888(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "CMYK8888 0x%08lx K=%li Y=%li M=%li C=%li",
+		(unsigned long int)GP_GET_BITS(0, 32, p),
+		(long int) GP_PIXEL_GET_K_CMYK8888(p), (long int) GP_PIXEL_GET_Y_CMYK8888(p), (long int) GP_PIXEL_GET_M_CMYK8888(p), (long int) GP_PIXEL_GET_C_CMYK8888(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type P2
+ */
+static void pixel_snprint_P2(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "P2 0x%01lx P=%li",
+		(unsigned long int)GP_GET_BITS(0, 2, p),
+		(long int) GP_PIXEL_GET_P_P2(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type P4
+ */
+static void pixel_snprint_P4(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "P4 0x%01lx P=%li",
+		(unsigned long int)GP_GET_BITS(0, 4, p),
+		(long int) GP_PIXEL_GET_P_P4(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type P8
+ */
+static void pixel_snprint_P8(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "P8 0x%02lx P=%li",
+		(unsigned long int)GP_GET_BITS(0, 8, p),
+		(long int) GP_PIXEL_GET_P_P8(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type G1_DB
+ */
+static void pixel_snprint_G1_DB(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "G1_DB 0x%01lx V=%li",
+		(unsigned long int)GP_GET_BITS(0, 1, p),
+		(long int) GP_PIXEL_GET_V_G1_DB(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type G2_DB
+ */
+static void pixel_snprint_G2_DB(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "G2_DB 0x%01lx V=%li",
+		(unsigned long int)GP_GET_BITS(0, 2, p),
+		(long int) GP_PIXEL_GET_V_G2_DB(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type G4_DB
+ */
+static void pixel_snprint_G4_DB(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "G4_DB 0x%01lx V=%li",
+		(unsigned long int)GP_GET_BITS(0, 4, p),
+		(long int) GP_PIXEL_GET_V_G4_DB(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type G1_UB
+ */
+static void pixel_snprint_G1_UB(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "G1_UB 0x%01lx V=%li",
+		(unsigned long int)GP_GET_BITS(0, 1, p),
+		(long int) GP_PIXEL_GET_V_G1_UB(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type G2_UB
+ */
+static void pixel_snprint_G2_UB(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "G2_UB 0x%01lx V=%li",
+		(unsigned long int)GP_GET_BITS(0, 2, p),
+		(long int) GP_PIXEL_GET_V_G2_UB(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type G4_UB
+ */
+static void pixel_snprint_G4_UB(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "G4_UB 0x%01lx V=%li",
+		(unsigned long int)GP_GET_BITS(0, 4, p),
+		(long int) GP_PIXEL_GET_V_G4_UB(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type G8
+ */
+static void pixel_snprint_G8(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "G8 0x%02lx V=%li",
+		(unsigned long int)GP_GET_BITS(0, 8, p),
+		(long int) GP_PIXEL_GET_V_G8(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type GA88
+ */
+static void pixel_snprint_GA88(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "GA88 0x%04lx V=%li A=%li",
+		(unsigned long int)GP_GET_BITS(0, 16, p),
+		(long int) GP_PIXEL_GET_V_GA88(p), (long int) GP_PIXEL_GET_A_GA88(p));
+}
+
+/*
+ * snprintf a human readable value of pixel type G16
+ */
+static void pixel_snprint_G16(char *buf, size_t len, gp_pixel p)
+{
+	snprintf(buf, len, "G16 0x%04lx V=%li",
+		(unsigned long int)GP_GET_BITS(0, 16, p),
+		(long int) GP_PIXEL_GET_V_G16(p));
+}
+
+
+void gp_pixel_snprint(char *buf, size_t len, gp_pixel p, gp_pixel_type pixel_type)
+{
+	GP_FN_PER_PIXELTYPE(pixel_snprint, pixel_type, buf, len, p);
+}
+
+void gp_pixel_print(gp_pixel p, gp_pixel_type pixel_type)
+{
+	char buf[256];
+	gp_pixel_snprint(buf, sizeof(buf), p, pixel_type);
+	puts(buf);
+}
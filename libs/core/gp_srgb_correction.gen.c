@@ -0,0 +1,1301 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_srgb_correction.gen.c
+ *
+ * GENERATED on 2026 10 19 15:07:32 from gp_srgb_correction.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * sRGB correction lookup tables
+ *
+ * Copyright (C) 2012-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdint.h>
+
+uint16_t gp_srgb8_to_lin10_tbl[256] = {
+	0, /* 0 (lin) */
+	0, /* 1 (lin) */
+	1, /* 2 (lin) */
+	1, /* 3 (lin) */
+	1, /* 4 (lin) */
+	2, /* 5 (lin) */
+	2, /* 6 (lin) */
+	2, /* 7 (lin) */
+	2, /* 8 (lin) */
+	3, /* 9 (lin) */
+	3, /* 10 (lin) */
+	3, /* 11 */
+	4, /* 12 */
+	4, /* 13 */
+	4, /* 14 */
+	5, /* 15 */
+	5, /* 16 */
+	6, /* 17 */
+	6, /* 18 */
+	7, /* 19 */
+	7, /* 20 */
+	8, /* 21 */
+	8, /* 22 */
+	9, /* 23 */
+	9, /* 24 */
+	10, /* 25 */
+	11, /* 26 */
+	11, /* 27 */
+	12, /* 28 */
+	13, /* 29 */
+	13, /* 30 */
+	14, /* 31 */
+	15, /* 32 */
+	16, /* 33 */
+	16, /* 34 */
+	17, /* 35 */
+	18, /* 36 */
+	19, /* 37 */
+	20, /* 38 */
+	21, /* 39 */
+	22, /* 40 */
+	23, /* 41 */
+	24, /* 42 */
+	25, /* 43 */
+	26, /* 44 */
+	27, /* 45 */
+	28, /* 46 */
+	29, /* 47 */
+	30, /* 48 */
+	31, /* 49 */
+	33, /* 50 */
+	34, /* 51 */
+	35, /* 52 */
+	36, /* 53 */
+	38, /* 54 */
+	39, /* 55 */
+	40, /* 56 */
+	42, /* 57 */
+	43, /* 58 */
+	45, /* 59 */
+	46, /* 60 */
+	48, /* 61 */
+	49, /* 62 */
+	51, /* 63 */
+	52, /* 64 */
+	54, /* 65 */
+	56, /* 66 */
+	57, /* 67 */
+	59, /* 68 */
+	61, /* 69 */
+	63, /* 70 */
+	64, /* 71 */
+	66, /* 72 */
+	68, /* 73 */
+	70, /* 74 */
+	72, /* 75 */
+	74, /* 76 */
+	76, /* 77 */
+	78, /* 78 */
+	80, /* 79 */
+	82, /* 80 */
+	84, /* 81 */
+	86, /* 82 */
+	88, /* 83 */
+	91, /* 84 */
+	93, /* 85 */
+	95, /* 86 */
+	97, /* 87 */
+	100, /* 88 */
+	102, /* 89 */
+	105, /* 90 */
+	107, /* 91 */
+	109, /* 92 */
+	112, /* 93 */
+	115, /* 94 */
+	117, /* 95 */
+	120, /* 96 */
+	122, /* 97 */
+	125, /* 98 */
+	128, /* 99 */
+	130, /* 100 */
+	133, /* 101 */
+	136, /* 102 */
+	139, /* 103 */
+	142, /* 104 */
+	145, /* 105 */
+	147, /* 106 */
+	150, /* 107 */
+	153, /* 108 */
+	156, /* 109 */
+	160, /* 110 */
+	163, /* 111 */
+	166, /* 112 */
+	169, /* 113 */
+	172, /* 114 */
+	175, /* 115 */
+	179, /* 116 */
+	182, /* 117 */
+	185, /* 118 */
+	189, /* 119 */
+	192, /* 120 */
+	196, /* 121 */
+	199, /* 122 */
+	203, /* 123 */
+	206, /* 124 */
+	210, /* 125 */
+	213, /* 126 */
+	217, /* 127 */
+	221, /* 128 */
+	225, /* 129 */
+	228, /* 130 */
+	232, /* 131 */
+	236, /* 132 */
+	240, /* 133 */
+	244, /* 134 */
+	248, /* 135 */
+	252, /* 136 */
+	256, /* 137 */
+	260, /* 138 */
+	264, /* 139 */
+	268, /* 140 */
+	272, /* 141 */
+	277, /* 142 */
+	281, /* 143 */
+	285, /* 144 */
+	290, /* 145 */
+	294, /* 146 */
+	298, /* 147 */
+	303, /* 148 */
+	307, /* 149 */
+	312, /* 150 */
+	317, /* 151 */
+	321, /* 152 */
+	326, /* 153 */
+	331, /* 154 */
+	335, /* 155 */
+	340, /* 156 */
+	345, /* 157 */
+	350, /* 158 */
+	355, /* 159 */
+	360, /* 160 */
+	365, /* 161 */
+	370, /* 162 */
+	375, /* 163 */
+	380, /* 164 */
+	385, /* 165 */
+	390, /* 166 */
+	395, /* 167 */
+	401, /* 168 */
+	406, /* 169 */
+	411, /* 170 */
+	417, /* 171 */
+	422, /* 172 */
+	427, /* 173 */
+	433, /* 174 */
+	439, /* 175 */
+	444, /* 176 */
+	450, /* 177 */
+	455, /* 178 */
+	461, /* 179 */
+	467, /* 180 */
+	473, /* 181 */
+	479, /* 182 */
+	484, /* 183 */
+	490, /* 184 */
+	496, /* 185 */
+	502, /* 186 */
+	508, /* 187 */
+	514, /* 188 */
+	521, /* 189 */
+	527, /* 190 */
+	533, /* 191 */
+	539, /* 192 */
+	546, /* 193 */
+	552, /* 194 */
+	558, /* 195 */
+	565, /* 196 */
+	571, /* 197 */
+	578, /* 198 */
+	584, /* 199 */
+	591, /* 200 */
+	598, /* 201 */
+	604, /* 202 */
+	611, /* 203 */
+	618, /* 204 */
+	625, /* 205 */
+	631, /* 206 */
+	638, /* 207 */
+	645, /* 208 */
+	652, /* 209 */
+	659, /* 210 */
+	666, /* 211 */
+	674, /* 212 */
+	681, /* 213 */
+	688, /* 214 */
+	695, /* 215 */
+	702, /* 216 */
+	710, /* 217 */
+	717, /* 218 */
+	725, /* 219 */
+	732, /* 220 */
+	740, /* 221 */
+	747, /* 222 */
+	755, /* 223 */
+	763, /* 224 */
+	770, /* 225 */
+	778, /* 226 */
+	786, /* 227 */
+	794, /* 228 */
+	802, /* 229 */
+	809, /* 230 */
+	817, /* 231 */
+	826, /* 232 */
+	834, /* 233 */
+	842, /* 234 */
+	850, /* 235 */
+	858, /* 236 */
+	866, /* 237 */
+	875, /* 238 */
+	883, /* 239 */
+	891, /* 240 */
+	900, /* 241 */
+	908, /* 242 */
+	917, /* 243 */
+	925, /* 244 */
+	934, /* 245 */
+	943, /* 246 */
+	952, /* 247 */
+	960, /* 248 */
+	969, /* 249 */
+	978, /* 250 */
+	987, /* 251 */
+	996, /* 252 */
+	1005, /* 253 */
+	1014, /* 254 */
+	1023, /* 255 */
+};
+
+uint8_t gp_lin10_to_srgb8_tbl[1024] = {
+	0, /* 0 (lin) */
+	3, /* 1 (lin) */
+	6, /* 2 (lin) */
+	10, /* 3 (lin) */
+	13, /* 4 */
+	15, /* 5 */
+	18, /* 6 */
+	20, /* 7 */
+	22, /* 8 */
+	23, /* 9 */
+	25, /* 10 */
+	27, /* 11 */
+	28, /* 12 */
+	30, /* 13 */
+	31, /* 14 */
+	32, /* 15 */
+	34, /* 16 */
+	35, /* 17 */
+	36, /* 18 */
+	37, /* 19 */
+	38, /* 20 */
+	39, /* 21 */
+	40, /* 22 */
+	41, /* 23 */
+	42, /* 24 */
+	43, /* 25 */
+	44, /* 26 */
+	45, /* 27 */
+	46, /* 28 */
+	47, /* 29 */
+	48, /* 30 */
+	49, /* 31 */
+	49, /* 32 */
+	50, /* 33 */
+	51, /* 34 */
+	52, /* 35 */
+	53, /* 36 */
+	53, /* 37 */
+	54, /* 38 */
+	55, /* 39 */
+	56, /* 40 */
+	56, /* 41 */
+	57, /* 42 */
+	58, /* 43 */
+	58, /* 44 */
+	59, /* 45 */
+	60, /* 46 */
+	61, /* 47 */
+	61, /* 48 */
+	62, /* 49 */
+	62, /* 50 */
+	63, /* 51 */
+	64, /* 52 */
+	64, /* 53 */
+	65, /* 54 */
+	66, /* 55 */
+	66, /* 56 */
+	67, /* 57 */
+	67, /* 58 */
+	68, /* 59 */
+	68, /* 60 */
+	69, /* 61 */
+	70, /* 62 */
+	70, /* 63 */
+	71, /* 64 */
+	71, /* 65 */
+	72, /* 66 */
+	72, /* 67 */
+	73, /* 68 */
+	73, /* 69 */
+	74, /* 70 */
+	74, /* 71 */
+	75, /* 72 */
+	76, /* 73 */
+	76, /* 74 */
+	77, /* 75 */
+	77, /* 76 */
+	78, /* 77 */
+	78, /* 78 */
+	79, /* 79 */
+	79, /* 80 */
+	79, /* 81 */
+	80, /* 82 */
+	80, /* 83 */
+	81, /* 84 */
+	81, /* 85 */
+	82, /* 86 */
+	82, /* 87 */
+	83, /* 88 */
+	83, /* 89 */
+	84, /* 90 */
+	84, /* 91 */
+	85, /* 92 */
+	85, /* 93 */
+	85, /* 94 */
+	86, /* 95 */
+	86, /* 96 */
+	87, /* 97 */
+	87, /* 98 */
+	88, /* 99 */
+	88, /* 100 */
+	88, /* 101 */
+	89, /* 102 */
+	89, /* 103 */
+	90, /* 104 */
+	90, /* 105 */
+	91, /* 106 */
+	91, /* 107 */
+	91, /* 108 */
+	92, /* 109 */
+	92, /* 110 */
+	93, /* 111 */
+	93, /* 112 */
+	93, /* 113 */
+	94, /* 114 */
+	94, /* 115 */
+	95, /* 116 */
+	95, /* 117 */
+	95, /* 118 */
+	96, /* 119 */
+	96, /* 120 */
+	97, /* 121 */
+	97, /* 122 */
+	97, /* 123 */
+	98, /* 124 */
+	98, /* 125 */
+	98, /* 126 */
+	99, /* 127 */
+	99, /* 128 */
+	99, /* 129 */
+	100, /* 130 */
+	100, /* 131 */
+	101, /* 132 */
+	101, /* 133 */
+	101, /* 134 */
+	102, /* 135 */
+	102, /* 136 */
+	102, /* 137 */
+	103, /* 138 */
+	103, /* 139 */
+	103, /* 140 */
+	104, /* 141 */
+	104, /* 142 */
+	104, /* 143 */
+	105, /* 144 */
+	105, /* 145 */
+	106, /* 146 */
+	106, /* 147 */
+	106, /* 148 */
+	107, /* 149 */
+	107, /* 150 */
+	107, /* 151 */
+	108, /* 152 */
+	108, /* 153 */
+	108, /* 154 */
+	109, /* 155 */
+	109, /* 156 */
+	109, /* 157 */
+	110, /* 158 */
+	110, /* 159 */
+	110, /* 160 */
+	110, /* 161 */
+	111, /* 162 */
+	111, /* 163 */
+	111, /* 164 */
+	112, /* 165 */
+	112, /* 166 */
+	112, /* 167 */
+	113, /* 168 */
+	113, /* 169 */
+	113, /* 170 */
+	114, /* 171 */
+	114, /* 172 */
+	114, /* 173 */
+	115, /* 174 */
+	115, /* 175 */
+	115, /* 176 */
+	115, /* 177 */
+	116, /* 178 */
+	116, /* 179 */
+	116, /* 180 */
+	117, /* 181 */
+	117, /* 182 */
+	117, /* 183 */
+	118, /* 184 */
+	118, /* 185 */
+	118, /* 186 */
+	118, /* 187 */
+	119, /* 188 */
+	119, /* 189 */
+	119, /* 190 */
+	120, /* 191 */
+	120, /* 192 */
+	120, /* 193 */
+	121, /* 194 */
+	121, /* 195 */
+	121, /* 196 */
+	121, /* 197 */
+	122, /* 198 */
+	122, /* 199 */
+	122, /* 200 */
+	123, /* 201 */
+	123, /* 202 */
+	123, /* 203 */
+	123, /* 204 */
+	124, /* 205 */
+	124, /* 206 */
+	124, /* 207 */
+	125, /* 208 */
+	125, /* 209 */
+	125, /* 210 */
+	125, /* 211 */
+	126, /* 212 */
+	126, /* 213 */
+	126, /* 214 */
+	126, /* 215 */
+	127, /* 216 */
+	127, /* 217 */
+	127, /* 218 */
+	128, /* 219 */
+	128, /* 220 */
+	128, /* 221 */
+	128, /* 222 */
+	129, /* 223 */
+	129, /* 224 */
+	129, /* 225 */
+	129, /* 226 */
+	130, /* 227 */
+	130, /* 228 */
+	130, /* 229 */
+	130, /* 230 */
+	131, /* 231 */
+	131, /* 232 */
+	131, /* 233 */
+	131, /* 234 */
+	132, /* 235 */
+	132, /* 236 */
+	132, /* 237 */
+	133, /* 238 */
+	133, /* 239 */
+	133, /* 240 */
+	133, /* 241 */
+	134, /* 242 */
+	134, /* 243 */
+	134, /* 244 */
+	134, /* 245 */
+	135, /* 246 */
+	135, /* 247 */
+	135, /* 248 */
+	135, /* 249 */
+	136, /* 250 */
+	136, /* 251 */
+	136, /* 252 */
+	136, /* 253 */
+	137, /* 254 */
+	137, /* 255 */
+	137, /* 256 */
+	137, /* 257 */
+	138, /* 258 */
+	138, /* 259 */
+	138, /* 260 */
+	138, /* 261 */
+	138, /* 262 */
+	139, /* 263 */
+	139, /* 264 */
+	139, /* 265 */
+	139, /* 266 */
+	140, /* 267 */
+	140, /* 268 */
+	140, /* 269 */
+	140, /* 270 */
+	141, /* 271 */
+	141, /* 272 */
+	141, /* 273 */
+	141, /* 274 */
+	142, /* 275 */
+	142, /* 276 */
+	142, /* 277 */
+	142, /* 278 */
+	143, /* 279 */
+	143, /* 280 */
+	143, /* 281 */
+	143, /* 282 */
+	143, /* 283 */
+	144, /* 284 */
+	144, /* 285 */
+	144, /* 286 */
+	144, /* 287 */
+	145, /* 288 */
+	145, /* 289 */
+	145, /* 290 */
+	145, /* 291 */
+	146, /* 292 */
+	146, /* 293 */
+	146, /* 294 */
+	146, /* 295 */
+	146, /* 296 */
+	147, /* 297 */
+	147, /* 298 */
+	147, /* 299 */
+	147, /* 300 */
+	148, /* 301 */
+	148, /* 302 */
+	148, /* 303 */
+	148, /* 304 */
+	148, /* 305 */
+	149, /* 306 */
+	149, /* 307 */
+	149, /* 308 */
+	149, /* 309 */
+	150, /* 310 */
+	150, /* 311 */
+	150, /* 312 */
+	150, /* 313 */
+	150, /* 314 */
+	151, /* 315 */
+	151, /* 316 */
+	151, /* 317 */
+	151, /* 318 */
+	152, /* 319 */
+	152, /* 320 */
+	152, /* 321 */
+	152, /* 322 */
+	152, /* 323 */
+	153, /* 324 */
+	153, /* 325 */
+	153, /* 326 */
+	153, /* 327 */
+	153, /* 328 */
+	154, /* 329 */
+	154, /* 330 */
+	154, /* 331 */
+	154, /* 332 */
+	155, /* 333 */
+	155, /* 334 */
+	155, /* 335 */
+	155, /* 336 */
+	155, /* 337 */
+	156, /* 338 */
+	156, /* 339 */
+	156, /* 340 */
+	156, /* 341 */
+	156, /* 342 */
+	157, /* 343 */
+	157, /* 344 */
+	157, /* 345 */
+	157, /* 346 */
+	157, /* 347 */
+	158, /* 348 */
+	158, /* 349 */
+	158, /* 350 */
+	158, /* 351 */
+	158, /* 352 */
+	159, /* 353 */
+	159, /* 354 */
+	159, /* 355 */
+	159, /* 356 */
+	159, /* 357 */
+	160, /* 358 */
+	160, /* 359 */
+	160, /* 360 */
+	160, /* 361 */
+	160, /* 362 */
+	161, /* 363 */
+	161, /* 364 */
+	161, /* 365 */
+	161, /* 366 */
+	161, /* 367 */
+	162, /* 368 */
+	162, /* 369 */
+	162, /* 370 */
+	162, /* 371 */
+	162, /* 372 */
+	163, /* 373 */
+	163, /* 374 */
+	163, /* 375 */
+	163, /* 376 */
+	163, /* 377 */
+	164, /* 378 */
+	164, /* 379 */
+	164, /* 380 */
+	164, /* 381 */
+	164, /* 382 */
+	165, /* 383 */
+	165, /* 384 */
+	165, /* 385 */
+	165, /* 386 */
+	165, /* 387 */
+	166, /* 388 */
+	166, /* 389 */
+	166, /* 390 */
+	166, /* 391 */
+	166, /* 392 */
+	167, /* 393 */
+	167, /* 394 */
+	167, /* 395 */
+	167, /* 396 */
+	167, /* 397 */
+	168, /* 398 */
+	168, /* 399 */
+	168, /* 400 */
+	168, /* 401 */
+	168, /* 402 */
+	168, /* 403 */
+	169, /* 404 */
+	169, /* 405 */
+	169, /* 406 */
+	169, /* 407 */
+	169, /* 408 */
+	170, /* 409 */
+	170, /* 410 */
+	170, /* 411 */
+	170, /* 412 */
+	170, /* 413 */
+	171, /* 414 */
+	171, /* 415 */
+	171, /* 416 */
+	171, /* 417 */
+	171, /* 418 */
+	171, /* 419 */
+	172, /* 420 */
+	172, /* 421 */
+	172, /* 422 */
+	172, /* 423 */
+	172, /* 424 */
+	173, /* 425 */
+	173, /* 426 */
+	173, /* 427 */
+	173, /* 428 */
+	173, /* 429 */
+	173, /* 430 */
+	174, /* 431 */
+	174, /* 432 */
+	174, /* 433 */
+	174, /* 434 */
+	174, /* 435 */
+	175, /* 436 */
+	175, /* 437 */
+	175, /* 438 */
+	175, /* 439 */
+	175, /* 440 */
+	175, /* 441 */
+	176, /* 442 */
+	176, /* 443 */
+	176, /* 444 */
+	176, /* 445 */
+	176, /* 446 */
+	177, /* 447 */
+	177, /* 448 */
+	177, /* 449 */
+	177, /* 450 */
+	177, /* 451 */
+	177, /* 452 */
+	178, /* 453 */
+	178, /* 454 */
+	178, /* 455 */
+	178, /* 456 */
+	178, /* 457 */
+	178, /* 458 */
+	179, /* 459 */
+	179, /* 460 */
+	179, /* 461 */
+	179, /* 462 */
+	179, /* 463 */
+	179, /* 464 */
+	180, /* 465 */
+	180, /* 466 */
+	180, /* 467 */
+	180, /* 468 */
+	180, /* 469 */
+	181, /* 470 */
+	181, /* 471 */
+	181, /* 472 */
+	181, /* 473 */
+	181, /* 474 */
+	181, /* 475 */
+	182, /* 476 */
+	182, /* 477 */
+	182, /* 478 */
+	182, /* 479 */
+	182, /* 480 */
+	182, /* 481 */
+	183, /* 482 */
+	183, /* 483 */
+	183, /* 484 */
+	183, /* 485 */
+	183, /* 486 */
+	183, /* 487 */
+	184, /* 488 */
+	184, /* 489 */
+	184, /* 490 */
+	184, /* 491 */
+	184, /* 492 */
+	184, /* 493 */
+	185, /* 494 */
+	185, /* 495 */
+	185, /* 496 */
+	185, /* 497 */
+	185, /* 498 */
+	185, /* 499 */
+	186, /* 500 */
+	186, /* 501 */
+	186, /* 502 */
+	186, /* 503 */
+	186, /* 504 */
+	186, /* 505 */
+	187, /* 506 */
+	187, /* 507 */
+	187, /* 508 */
+	187, /* 509 */
+	187, /* 510 */
+	187, /* 511 */
+	188, /* 512 */
+	188, /* 513 */
+	188, /* 514 */
+	188, /* 515 */
+	188, /* 516 */
+	188, /* 517 */
+	189, /* 518 */
+	189, /* 519 */
+	189, /* 520 */
+	189, /* 521 */
+	189, /* 522 */
+	189, /* 523 */
+	190, /* 524 */
+	190, /* 525 */
+	190, /* 526 */
+	190, /* 527 */
+	190, /* 528 */
+	190, /* 529 */
+	191, /* 530 */
+	191, /* 531 */
+	191, /* 532 */
+	191, /* 533 */
+	191, /* 534 */
+	191, /* 535 */
+	191, /* 536 */
+	192, /* 537 */
+	192, /* 538 */
+	192, /* 539 */
+	192, /* 540 */
+	192, /* 541 */
+	192, /* 542 */
+	193, /* 543 */
+	193, /* 544 */
+	193, /* 545 */
+	193, /* 546 */
+	193, /* 547 */
+	193, /* 548 */
+	194, /* 549 */
+	194, /* 550 */
+	194, /* 551 */
+	194, /* 552 */
+	194, /* 553 */
+	194, /* 554 */
+	194, /* 555 */
+	195, /* 556 */
+	195, /* 557 */
+	195, /* 558 */
+	195, /* 559 */
+	195, /* 560 */
+	195, /* 561 */
+	196, /* 562 */
+	196, /* 563 */
+	196, /* 564 */
+	196, /* 565 */
+	196, /* 566 */
+	196, /* 567 */
+	197, /* 568 */
+	197, /* 569 */
+	197, /* 570 */
+	197, /* 571 */
+	197, /* 572 */
+	197, /* 573 */
+	197, /* 574 */
+	198, /* 575 */
+	198, /* 576 */
+	198, /* 577 */
+	198, /* 578 */
+	198, /* 579 */
+	198, /* 580 */
+	199, /* 581 */
+	199, /* 582 */
+	199, /* 583 */
+	199, /* 584 */
+	199, /* 585 */
+	199, /* 586 */
+	199, /* 587 */
+	200, /* 588 */
+	200, /* 589 */
+	200, /* 590 */
+	200, /* 591 */
+	200, /* 592 */
+	200, /* 593 */
+	200, /* 594 */
+	201, /* 595 */
+	201, /* 596 */
+	201, /* 597 */
+	201, /* 598 */
+	201, /* 599 */
+	201, /* 600 */
+	202, /* 601 */
+	202, /* 602 */
+	202, /* 603 */
+	202, /* 604 */
+	202, /* 605 */
+	202, /* 606 */
+	202, /* 607 */
+	203, /* 608 */
+	203, /* 609 */
+	203, /* 610 */
+	203, /* 611 */
+	203, /* 612 */
+	203, /* 613 */
+	203, /* 614 */
+	204, /* 615 */
+	204, /* 616 */
+	204, /* 617 */
+	204, /* 618 */
+	204, /* 619 */
+	204, /* 620 */
+	204, /* 621 */
+	205, /* 622 */
+	205, /* 623 */
+	205, /* 624 */
+	205, /* 625 */
+	205, /* 626 */
+	205, /* 627 */
+	206, /* 628 */
+	206, /* 629 */
+	206, /* 630 */
+	206, /* 631 */
+	206, /* 632 */
+	206, /* 633 */
+	206, /* 634 */
+	207, /* 635 */
+	207, /* 636 */
+	207, /* 637 */
+	207, /* 638 */
+	207, /* 639 */
+	207, /* 640 */
+	207, /* 641 */
+	208, /* 642 */
+	208, /* 643 */
+	208, /* 644 */
+	208, /* 645 */
+	208, /* 646 */
+	208, /* 647 */
+	208, /* 648 */
+	209, /* 649 */
+	209, /* 650 */
+	209, /* 651 */
+	209, /* 652 */
+	209, /* 653 */
+	209, /* 654 */
+	209, /* 655 */
+	210, /* 656 */
+	210, /* 657 */
+	210, /* 658 */
+	210, /* 659 */
+	210, /* 660 */
+	210, /* 661 */
+	210, /* 662 */
+	211, /* 663 */
+	211, /* 664 */
+	211, /* 665 */
+	211, /* 666 */
+	211, /* 667 */
+	211, /* 668 */
+	211, /* 669 */
+	212, /* 670 */
+	212, /* 671 */
+	212, /* 672 */
+	212, /* 673 */
+	212, /* 674 */
+	212, /* 675 */
+	212, /* 676 */
+	212, /* 677 */
+	213, /* 678 */
+	213, /* 679 */
+	213, /* 680 */
+	213, /* 681 */
+	213, /* 682 */
+	213, /* 683 */
+	213, /* 684 */
+	214, /* 685 */
+	214, /* 686 */
+	214, /* 687 */
+	214, /* 688 */
+	214, /* 689 */
+	214, /* 690 */
+	214, /* 691 */
+	215, /* 692 */
+	215, /* 693 */
+	215, /* 694 */
+	215, /* 695 */
+	215, /* 696 */
+	215, /* 697 */
+	215, /* 698 */
+	216, /* 699 */
+	216, /* 700 */
+	216, /* 701 */
+	216, /* 702 */
+	216, /* 703 */
+	216, /* 704 */
+	216, /* 705 */
+	216, /* 706 */
+	217, /* 707 */
+	217, /* 708 */
+	217, /* 709 */
+	217, /* 710 */
+	217, /* 711 */
+	217, /* 712 */
+	217, /* 713 */
+	218, /* 714 */
+	218, /* 715 */
+	218, /* 716 */
+	218, /* 717 */
+	218, /* 718 */
+	218, /* 719 */
+	218, /* 720 */
+	219, /* 721 */
+	219, /* 722 */
+	219, /* 723 */
+	219, /* 724 */
+	219, /* 725 */
+	219, /* 726 */
+	219, /* 727 */
+	219, /* 728 */
+	220, /* 729 */
+	220, /* 730 */
+	220, /* 731 */
+	220, /* 732 */
+	220, /* 733 */
+	220, /* 734 */
+	220, /* 735 */
+	221, /* 736 */
+	221, /* 737 */
+	221, /* 738 */
+	221, /* 739 */
+	221, /* 740 */
+	221, /* 741 */
+	221, /* 742 */
+	221, /* 743 */
+	222, /* 744 */
+	222, /* 745 */
+	222, /* 746 */
+	222, /* 747 */
+	222, /* 748 */
+	222, /* 749 */
+	222, /* 750 */
+	222, /* 751 */
+	223, /* 752 */
+	223, /* 753 */
+	223, /* 754 */
+	223, /* 755 */
+	223, /* 756 */
+	223, /* 757 */
+	223, /* 758 */
+	224, /* 759 */
+	224, /* 760 */
+	224, /* 761 */
+	224, /* 762 */
+	224, /* 763 */
+	224, /* 764 */
+	224, /* 765 */
+	224, /* 766 */
+	225, /* 767 */
+	225, /* 768 */
+	225, /* 769 */
+	225, /* 770 */
+	225, /* 771 */
+	225, /* 772 */
+	225, /* 773 */
+	225, /* 774 */
+	226, /* 775 */
+	226, /* 776 */
+	226, /* 777 */
+	226, /* 778 */
+	226, /* 779 */
+	226, /* 780 */
+	226, /* 781 */
+	227, /* 782 */
+	227, /* 783 */
+	227, /* 784 */
+	227, /* 785 */
+	227, /* 786 */
+	227, /* 787 */
+	227, /* 788 */
+	227, /* 789 */
+	228, /* 790 */
+	228, /* 791 */
+	228, /* 792 */
+	228, /* 793 */
+	228, /* 794 */
+	228, /* 795 */
+	228, /* 796 */
+	228, /* 797 */
+	229, /* 798 */
+	229, /* 799 */
+	229, /* 800 */
+	229, /* 801 */
+	229, /* 802 */
+	229, /* 803 */
+	229, /* 804 */
+	229, /* 805 */
+	230, /* 806 */
+	230, /* 807 */
+	230, /* 808 */
+	230, /* 809 */
+	230, /* 810 */
+	230, /* 811 */
+	230, /* 812 */
+	230, /* 813 */
+	231, /* 814 */
+	231, /* 815 */
+	231, /* 816 */
+	231, /* 817 */
+	231, /* 818 */
+	231, /* 819 */
+	231, /* 820 */
+	231, /* 821 */
+	232, /* 822 */
+	232, /* 823 */
+	232, /* 824 */
+	232, /* 825 */
+	232, /* 826 */
+	232, /* 827 */
+	232, /* 828 */
+	232, /* 829 */
+	233, /* 830 */
+	233, /* 831 */
+	233, /* 832 */
+	233, /* 833 */
+	233, /* 834 */
+	233, /* 835 */
+	233, /* 836 */
+	233, /* 837 */
+	234, /* 838 */
+	234, /* 839 */
+	234, /* 840 */
+	234, /* 841 */
+	234, /* 842 */
+	234, /* 843 */
+	234, /* 844 */
+	234, /* 845 */
+	235, /* 846 */
+	235, /* 847 */
+	235, /* 848 */
+	235, /* 849 */
+	235, /* 850 */
+	235, /* 851 */
+	235, /* 852 */
+	235, /* 853 */
+	236, /* 854 */
+	236, /* 855 */
+	236, /* 856 */
+	236, /* 857 */
+	236, /* 858 */
+	236, /* 859 */
+	236, /* 860 */
+	236, /* 861 */
+	236, /* 862 */
+	237, /* 863 */
+	237, /* 864 */
+	237, /* 865 */
+	237, /* 866 */
+	237, /* 867 */
+	237, /* 868 */
+	237, /* 869 */
+	237, /* 870 */
+	238, /* 871 */
+	238, /* 872 */
+	238, /* 873 */
+	238, /* 874 */
+	238, /* 875 */
+	238, /* 876 */
+	238, /* 877 */
+	238, /* 878 */
+	239, /* 879 */
+	239, /* 880 */
+	239, /* 881 */
+	239, /* 882 */
+	239, /* 883 */
+	239, /* 884 */
+	239, /* 885 */
+	239, /* 886 */
+	239, /* 887 */
+	240, /* 888 */
+	240, /* 889 */
+	240, /* 890 */
+	240, /* 891 */
+	240, /* 892 */
+	240, /* 893 */
+	240, /* 894 */
+	240, /* 895 */
+	241, /* 896 */
+	241, /* 897 */
+	241, /* 898 */
+	241, /* 899 */
+	241, /* 900 */
+	241, /* 901 */
+	241, /* 902 */
+	241, /* 903 */
+	241, /* 904 */
+	242, /* 905 */
+	242, /* 906 */
+	242, /* 907 */
+	242, /* 908 */
+	242, /* 909 */
+	242, /* 910 */
+	242, /* 911 */
+	242, /* 912 */
+	243, /* 913 */
+	243, /* 914 */
+	243, /* 915 */
+	243, /* 916 */
+	243, /* 917 */
+	243, /* 918 */
+	243, /* 919 */
+	243, /* 920 */
+	243, /* 921 */
+	244, /* 922 */
+	244, /* 923 */
+	244, /* 924 */
+	244, /* 925 */
+	244, /* 926 */
+	244, /* 927 */
+	244, /* 928 */
+	244, /* 929 */
+	245, /* 930 */
+	245, /* 931 */
+	245, /* 932 */
+	245, /* 933 */
+	245, /* 934 */
+	245, /* 935 */
+	245, /* 936 */
+	245, /* 937 */
+	245, /* 938 */
+	246, /* 939 */
+	246, /* 940 */
+	246, /* 941 */
+	246, /* 942 */
+	246, /* 943 */
+	246, /* 944 */
+	246, /* 945 */
+	246, /* 946 */
+	246, /* 947 */
+	247, /* 948 */
+	247, /* 949 */
+	247, /* 950 */
+	247, /* 951 */
+	247, /* 952 */
+	247, /* 953 */
+	247, /* 954 */
+	247, /* 955 */
+	248, /* 956 */
+	248, /* 957 */
+	248, /* 958 */
+	248, /* 959 */
+	248, /* 960 */
+	248, /* 961 */
+	248, /* 962 */
+	248, /* 963 */
+	248, /* 964 */
+	249, /* 965 */
+	249, /* 966 */
+	249, /* 967 */
+	249, /* 968 */
+	249, /* 969 */
+	249, /* 970 */
+	249, /* 971 */
+	249, /* 972 */
+	249, /* 973 */
+	250, /* 974 */
+	250, /* 975 */
+	250, /* 976 */
+	250, /* 977 */
+	250, /* 978 */
+	250, /* 979 */
+	250, /* 980 */
+	250, /* 981 */
+	250, /* 982 */
+	251, /* 983 */
+	251, /* 984 */
+	251, /* 985 */
+	251, /* 986 */
+	251, /* 987 */
+	251, /* 988 */
+	251, /* 989 */
+	251, /* 990 */
+	251, /* 991 */
+	252, /* 992 */
+	252, /* 993 */
+	252, /* 994 */
+	252, /* 995 */
+	252, /* 996 */
+	252, /* 997 */
+	252, /* 998 */
+	252, /* 999 */
+	252, /* 1000 */
+	253, /* 1001 */
+	253, /* 1002 */
+	253, /* 1003 */
+	253, /* 1004 */
+	253, /* 1005 */
+	253, /* 1006 */
+	253, /* 1007 */
+	253, /* 1008 */
+	253, /* 1009 */
+	254, /* 1010 */
+	254, /* 1011 */
+	254, /* 1012 */
+	254, /* 1013 */
+	254, /* 1014 */
+	254, /* 1015 */
+	254, /* 1016 */
+	254, /* 1017 */
+	254, /* 1018 */
+	255, /* 1019 */
+	255, /* 1020 */
+	255, /* 1021 */
+	255, /* 1022 */
+	255, /* 1023 */
+};
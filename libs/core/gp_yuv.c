@@ -0,0 +1,412 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../../config.h"
+
+#ifdef HAVE_PTHREAD
+# include <pthread.h>
+# include <core/gp_threads.h>
+#endif
+
+#include <core/gp_common.h>
+#include <core/gp_debug.h>
+#include <core/gp_pixmap.h>
+#include <core/gp_yuv.h>
+
+/*
+ * Fixed point coefficients with 12 fractional bits.
+ *
+ * R = (Y - y_off) * y_mul + rv * (V - 128)
+ * G = (Y - y_off) * y_mul - gu * (U - 128) - gv * (V - 128)
+ * B = (Y - y_off) * y_mul + bu * (U - 128)
+ */
+struct yuv_coefs {
+	int32_t y_off;
+	int32_t y_mul;
+	int32_t rv, gu, gv, bu;
+};
+
+#define FP_BITS 12
+#define FP(x) ((int32_t)((x) * (1<<FP_BITS) + 0.5))
+
+#define COEFS_FULL(kr, kb) { \
+	.y_off = 0, \
+	.y_mul = FP(1), \
+	.rv = FP(2 * (1 - (kr))), \
+	.gu = FP(2 * (1 - (kb)) * (kb) / (1 - (kr) - (kb))), \
+	.gv = FP(2 * (1 - (kr)) * (kr) / (1 - (kr) - (kb))), \
+	.bu = FP(2 * (1 - (kb))), \
+}
+
+/* Luma is in 16-235 and chroma in 16-240 range */
+#define C_RANGE (255.0 / 224)
+
+#define COEFS_LIMITED(kr, kb) { \
+	.y_off = 16, \
+	.y_mul = FP(255.0 / 219), \
+	.rv = FP(C_RANGE * 2 * (1 - (kr))), \
+	.gu = FP(C_RANGE * 2 * (1 - (kb)) * (kb) / (1 - (kr) - (kb))), \
+	.gv = FP(C_RANGE * 2 * (1 - (kr)) * (kr) / (1 - (kr) - (kb))), \
+	.bu = FP(C_RANGE * 2 * (1 - (kb))), \
+}
+
+static const struct yuv_coefs coefs[] = {
+	[GP_YUV_BT601] = COEFS_LIMITED(0.299, 0.114),
+	[GP_YUV_BT709] = COEFS_LIMITED(0.2126, 0.0722),
+	[GP_YUV_BT601 | GP_YUV_FULL_RANGE] = COEFS_FULL(0.299, 0.114),
+	[GP_YUV_BT709 | GP_YUV_FULL_RANGE] = COEFS_FULL(0.2126, 0.0722),
+};
+
+static const char *fmt_names[] = {
+	[GP_YUV_YUYV] = "YUYV",
+	[GP_YUV_UYVY] = "UYVY",
+	[GP_YUV_NV12] = "NV12",
+	[GP_YUV_I420] = "I420",
+};
+
+const char *gp_yuv_fmt_name(enum gp_yuv_fmt fmt)
+{
+	if ((unsigned int)fmt >= GP_ARRAY_SIZE(fmt_names))
+		return "Invalid";
+
+	return fmt_names[fmt];
+}
+
+static size_t min_stride(enum gp_yuv_fmt fmt, gp_size w)
+{
+	switch (fmt) {
+	case GP_YUV_YUYV:
+	case GP_YUV_UYVY:
+		return 4 * (((size_t)w + 1) / 2);
+	case GP_YUV_NV12:
+	case GP_YUV_I420:
+		return ((size_t)w + 1) & ~(size_t)1;
+	}
+
+	return 0;
+}
+
+static size_t chroma_h(gp_size h)
+{
+	return ((size_t)h + 1) / 2;
+}
+
+size_t gp_yuv_buf_size(enum gp_yuv_fmt fmt, gp_size w, gp_size h, size_t stride)
+{
+	if (!stride)
+		stride = min_stride(fmt, w);
+
+	switch (fmt) {
+	case GP_YUV_YUYV:
+	case GP_YUV_UYVY:
+		return stride * h;
+	case GP_YUV_NV12:
+		return stride * h + stride * chroma_h(h);
+	case GP_YUV_I420:
+		return stride * h + 2 * ((stride + 1) / 2) * chroma_h(h);
+	}
+
+	return 0;
+}
+
+/*
+ * Samples for one row, chroma is shared by two horizontally adjacent pixels.
+ */
+struct yuv_row {
+	const uint8_t *y;
+	const uint8_t *u;
+	const uint8_t *v;
+	unsigned int y_step;
+	unsigned int c_step;
+};
+
+struct yuv_params {
+	const uint8_t *buf;
+	size_t stride;
+	enum gp_yuv_fmt fmt;
+	const struct yuv_coefs *coefs;
+	gp_pixmap *dst;
+	gp_coord y;
+	gp_size h;
+};
+
+static void row_init(const struct yuv_params *params, gp_coord y, struct yuv_row *row)
+{
+	const uint8_t *line = params->buf + y * params->stride;
+	const uint8_t *planes = params->buf + params->stride * params->dst->h;
+	size_t c_stride;
+
+	switch (params->fmt) {
+	case GP_YUV_YUYV:
+		row->y = line;
+		row->u = line + 1;
+		row->v = line + 3;
+		row->y_step = 2;
+		row->c_step = 4;
+	break;
+	case GP_YUV_UYVY:
+		row->y = line + 1;
+		row->u = line;
+		row->v = line + 2;
+		row->y_step = 2;
+		row->c_step = 4;
+	break;
+	case GP_YUV_NV12:
+		row->y = line;
+		row->u = planes + (y / 2) * params->stride;
+		row->v = row->u + 1;
+		row->y_step = 1;
+		row->c_step = 2;
+	break;
+	case GP_YUV_I420:
+		c_stride = (params->stride + 1) / 2;
+		row->y = line;
+		row->u = planes + (y / 2) * c_stride;
+		row->v = planes + chroma_h(params->dst->h) * c_stride + (y / 2) * c_stride;
+		row->y_step = 1;
+		row->c_step = 1;
+	break;
+	}
+}
+
+/*
+ * The conversion works on four pixels at a time, the compiler maps the
+ * vector operations to the SIMD instructions available on the target.
+ */
+#define LANES 4
+
+typedef int32_t v4i32 __attribute__ ((vector_size (LANES * sizeof(int32_t))));
+
+static inline __attribute__((always_inline))
+void row_load(const struct yuv_row *row, gp_coord x, unsigned int cnt,
+              v4i32 *y, v4i32 *u, v4i32 *v)
+{
+	unsigned int i;
+
+	*y = (v4i32){};
+	*u = (v4i32){};
+	*v = (v4i32){};
+
+	for (i = 0; i < cnt; i++) {
+		size_t c = ((x + i) / 2) * row->c_step;
+
+		(*y)[i] = row->y[(x + i) * row->y_step];
+		(*u)[i] = row->u[c];
+		(*v)[i] = row->v[c];
+	}
+}
+
+static inline __attribute__((always_inline))
+v4i32 clamp(v4i32 x)
+{
+	/* Negative values to 0 */
+	x &= ~(x >> 31);
+	/* Values over 255 to all ones */
+	x |= (255 - x) >> 31;
+
+	return x & 255;
+}
+
+static inline __attribute__((always_inline))
+void yuv_to_rgb(const struct yuv_coefs *c, v4i32 y, v4i32 u, v4i32 v,
+                v4i32 *r, v4i32 *g, v4i32 *b)
+{
+	y = (y - c->y_off) * c->y_mul + (1<<(FP_BITS-1));
+	u -= 128;
+	v -= 128;
+
+	*r = clamp((y + c->rv * v) >> FP_BITS);
+	*g = clamp((y - c->gu * u - c->gv * v) >> FP_BITS);
+	*b = clamp((y + c->bu * u) >> FP_BITS);
+}
+
+static inline __attribute__((always_inline))
+void store_24(uint8_t *dst, unsigned int ri, unsigned int bi,
+              v4i32 r, v4i32 g, v4i32 b, unsigned int cnt)
+{
+	unsigned int i;
+
+	for (i = 0; i < cnt; i++) {
+		dst[3 * i + ri] = r[i];
+		dst[3 * i + 1] = g[i];
+		dst[3 * i + bi] = b[i];
+	}
+}
+
+static inline __attribute__((always_inline))
+void store_32(uint8_t *dst, v4i32 r, v4i32 g, v4i32 b, unsigned int cnt)
+{
+	v4i32 px = (r << 16) | (g << 8) | b;
+
+	memcpy(dst, &px, 4 * cnt);
+}
+
+static inline __attribute__((always_inline))
+void convert_row(const struct yuv_coefs *c, const struct yuv_row *row,
+                 uint8_t *dst, gp_size w, gp_pixel_type pixel_type)
+{
+	gp_coord x;
+
+	for (x = 0; x < (gp_coord)w; x += LANES) {
+		unsigned int cnt = GP_MIN((gp_size)LANES, w - x);
+		v4i32 y, u, v, r, g, b;
+
+		row_load(row, x, cnt, &y, &u, &v);
+		yuv_to_rgb(c, y, u, v, &r, &g, &b);
+
+		switch (pixel_type) {
+		case GP_PIXEL_RGB888:
+			store_24(dst + 3 * x, 2, 0, r, g, b, cnt);
+		break;
+		case GP_PIXEL_BGR888:
+			store_24(dst + 3 * x, 0, 2, r, g, b, cnt);
+		break;
+		default:
+			store_32(dst + 4 * x, r, g, b, cnt);
+		break;
+		}
+	}
+}
+
+static inline __attribute__((always_inline))
+void convert_rows(const struct yuv_params *params, gp_pixel_type pixel_type)
+{
+	gp_pixmap *dst = params->dst;
+	struct yuv_row row;
+	gp_coord y;
+
+	for (y = params->y; y < params->y + (gp_coord)params->h; y++) {
+		uint8_t *line = dst->pixels + y * dst->bytes_per_row;
+
+		row_init(params, y, &row);
+		convert_row(params->coefs, &row, line, dst->w, pixel_type);
+	}
+}
+
+/* Specialized for the pixel type so that the store is resolved at compile time */
+static void convert_rgb888(const struct yuv_params *params)
+{
+	convert_rows(params, GP_PIXEL_RGB888);
+}
+
+static void convert_bgr888(const struct yuv_params *params)
+{
+	convert_rows(params, GP_PIXEL_BGR888);
+}
+
+static void convert_xrgb8888(const struct yuv_params *params)
+{
+	convert_rows(params, GP_PIXEL_xRGB8888);
+}
+
+#ifdef HAVE_PTHREAD
+
+struct yuv_thread {
+	struct yuv_params params;
+	void (*convert)(const struct yuv_params *params);
+};
+
+static void *convert_thread(void *arg)
+{
+	struct yuv_thread *thread = arg;
+
+	thread->convert(&thread->params);
+
+	return NULL;
+}
+
+static void convert_mp(const struct yuv_params *params,
+                       void (*convert)(const struct yuv_params *params))
+{
+	unsigned int i, t = gp_nr_threads(params->dst->w, params->dst->h, NULL);
+
+	if (t <= 1) {
+		convert(params);
+		return;
+	}
+
+	pthread_t threads[t];
+	struct yuv_thread args[t];
+	gp_size h = params->h / t;
+
+	for (i = 0; i < t; i++) {
+		args[i].params = *params;
+		args[i].params.y = i * h;
+		args[i].params.h = i == t - 1 ? params->h - i * h : h;
+		args[i].convert = convert;
+
+		if (pthread_create(&threads[i], NULL, convert_thread, &args[i])) {
+			GP_DEBUG(1, "Failed to create thread, converting in place");
+			convert(&args[i].params);
+			args[i].convert = NULL;
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (args[i].convert)
+			pthread_join(threads[i], NULL);
+	}
+}
+
+#else
+
+static void convert_mp(const struct yuv_params *params,
+                       void (*convert)(const struct yuv_params *params))
+{
+	convert(params);
+}
+
+#endif /* HAVE_PTHREAD */
+
+int gp_yuv_convert(const void *buf, size_t stride, enum gp_yuv_fmt fmt,
+                   enum gp_yuv_flags flags, gp_pixmap *dst)
+{
+	void (*convert)(const struct yuv_params *params);
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB888:
+		convert = convert_rgb888;
+	break;
+	case GP_PIXEL_BGR888:
+		convert = convert_bgr888;
+	break;
+	case GP_PIXEL_xRGB8888:
+		convert = convert_xrgb8888;
+	break;
+	default:
+		GP_DEBUG(1, "Unsupported pixel type %s",
+		         gp_pixel_type_name(dst->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	if ((unsigned int)fmt >= GP_ARRAY_SIZE(fmt_names) ||
+	    (unsigned int)flags >= GP_ARRAY_SIZE(coefs)) {
+		errno = EINVAL;
+		return 1;
+	}
+
+	struct yuv_params params = {
+		.buf = buf,
+		.stride = stride ? stride : min_stride(fmt, dst->w),
+		.fmt = fmt,
+		.coefs = &coefs[flags],
+		.dst = dst,
+		.y = 0,
+		.h = dst->h,
+	};
+
+	GP_DEBUG(3, "Converting %ux%u %s stride %zu to %s",
+	         dst->w, dst->h, gp_yuv_fmt_name(fmt), params.stride,
+	         gp_pixel_type_name(dst->pixel_type));
+
+	convert_mp(&params, convert);
+
+	return 0;
+}
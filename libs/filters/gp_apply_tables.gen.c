@@ -0,0 +1,1001 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_apply_tables.gen.c
+ *
+ * GENERATED on 2026 10 19 15:08:15 from gp_apply_tables.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Generic Point filer
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_apply_tables.h>
+
+static int apply_tables_RGB101010(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_RGB101010(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_RGB101010(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_RGB101010(pix);
+			B = tables->table[2][B];
+
+			pix = GP_PIXEL_CREATE_RGB101010(R, G, B);
+			gp_putpixel_raw_32BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_xRGB8888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_xRGB8888(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_xRGB8888(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_xRGB8888(pix);
+			B = tables->table[2][B];
+
+			pix = GP_PIXEL_CREATE_xRGB8888(R, G, B);
+			gp_putpixel_raw_32BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGBA8888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+	gp_pixel A;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_RGBA8888(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_RGBA8888(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_RGBA8888(pix);
+			B = tables->table[2][B];
+			A = GP_PIXEL_GET_A_RGBA8888(pix);
+			A = tables->table[3][A];
+
+			pix = GP_PIXEL_CREATE_RGBA8888(R, G, B, A);
+			gp_putpixel_raw_32BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_RGB888(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_RGB888(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_RGB888(pix);
+			B = tables->table[2][B];
+
+			pix = GP_PIXEL_CREATE_RGB888(R, G, B);
+			gp_putpixel_raw_24BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_BGR888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel B;
+	gp_pixel G;
+	gp_pixel R;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, src_x, src_y);
+
+			B = GP_PIXEL_GET_B_BGR888(pix);
+			B = tables->table[0][B];
+			G = GP_PIXEL_GET_G_BGR888(pix);
+			G = tables->table[1][G];
+			R = GP_PIXEL_GET_R_BGR888(pix);
+			R = tables->table[2][R];
+
+			pix = GP_PIXEL_CREATE_BGR888(B, G, R);
+			gp_putpixel_raw_24BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB555(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_RGB555(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_RGB555(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_RGB555(pix);
+			B = tables->table[2][B];
+
+			pix = GP_PIXEL_CREATE_RGB555(R, G, B);
+			gp_putpixel_raw_16BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB565(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_RGB565(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_RGB565(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_RGB565(pix);
+			B = tables->table[2][B];
+
+			pix = GP_PIXEL_CREATE_RGB565(R, G, B);
+			gp_putpixel_raw_16BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB666(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_RGB666(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_RGB666(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_RGB666(pix);
+			B = tables->table[2][B];
+
+			pix = GP_PIXEL_CREATE_RGB666(R, G, B);
+			gp_putpixel_raw_18BPP_DB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB332(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_RGB332(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_RGB332(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_RGB332(pix);
+			B = tables->table[2][B];
+
+			pix = GP_PIXEL_CREATE_RGB332(R, G, B);
+			gp_putpixel_raw_8BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_CMYK8888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel K;
+	gp_pixel Y;
+	gp_pixel M;
+	gp_pixel C;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, src_x, src_y);
+
+			K = GP_PIXEL_GET_K_CMYK8888(pix);
+			K = tables->table[0][K];
+			Y = GP_PIXEL_GET_Y_CMYK8888(pix);
+			Y = tables->table[1][Y];
+			M = GP_PIXEL_GET_M_CMYK8888(pix);
+			M = tables->table[2][M];
+			C = GP_PIXEL_GET_C_CMYK8888(pix);
+			C = tables->table[3][C];
+
+			pix = GP_PIXEL_CREATE_CMYK8888(K, Y, M, C);
+			gp_putpixel_raw_32BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G1_DB(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G1_DB(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G1_DB(V);
+			gp_putpixel_raw_1BPP_DB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G2_DB(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G2_DB(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G2_DB(V);
+			gp_putpixel_raw_2BPP_DB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G4_DB(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G4_DB(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G4_DB(V);
+			gp_putpixel_raw_4BPP_DB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G1_UB(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G1_UB(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G1_UB(V);
+			gp_putpixel_raw_1BPP_UB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G2_UB(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G2_UB(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G2_UB(V);
+			gp_putpixel_raw_2BPP_UB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G4_UB(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G4_UB(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G4_UB(V);
+			gp_putpixel_raw_4BPP_UB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G8(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G8(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G8(V);
+			gp_putpixel_raw_8BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_GA88(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+	gp_pixel A;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_GA88(pix);
+			V = tables->table[0][V];
+			A = GP_PIXEL_GET_A_GA88(pix);
+			A = tables->table[1][A];
+
+			pix = GP_PIXEL_CREATE_GA88(V, A);
+			gp_putpixel_raw_16BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G16(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G16(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G16(V);
+			gp_putpixel_raw_16BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+int gp_filter_tables_apply(const gp_pixmap *const src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           gp_pixmap *dst,
+                           gp_coord x_dst, gp_coord y_dst,
+                           const gp_filter_tables *const tables,
+                           gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type);
+	//TODO: Assert size
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return apply_tables_RGB101010(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_xRGB8888:
+		return apply_tables_xRGB8888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return apply_tables_RGBA8888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return apply_tables_RGB888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return apply_tables_BGR888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return apply_tables_RGB555(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return apply_tables_RGB565(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return apply_tables_RGB666(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return apply_tables_RGB332(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return apply_tables_CMYK8888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G1_DB:
+		return apply_tables_G1_DB(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G2_DB:
+		return apply_tables_G2_DB(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G4_DB:
+		return apply_tables_G4_DB(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G1_UB:
+		return apply_tables_G1_UB(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G2_UB:
+		return apply_tables_G2_UB(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G4_UB:
+		return apply_tables_G4_UB(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G8:
+		return apply_tables_G8(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return apply_tables_GA88(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G16:
+		return apply_tables_G16(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
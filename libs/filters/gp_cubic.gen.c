@@ -0,0 +1,2064 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_cubic.gen.c
+ *
+ * GENERATED on 2026 10 19 15:08:14 from gp_cubic.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Table for fixed point cubic coeficients for A=0.5
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdint.h>
+
+int16_t gp_cubic_table[2047] = {
+	1024, /* 0    0.000000 */
+	1024, /* 1    0.000977 */
+	1024, /* 2    0.001953 */
+	1024, /* 3    0.002930 */
+	1024, /* 4    0.003906 */
+	1024, /* 5    0.004883 */
+	1024, /* 6    0.005859 */
+	1024, /* 7    0.006836 */
+	1024, /* 8    0.007812 */
+	1024, /* 9    0.008789 */
+	1024, /* 10   0.009766 */
+	1024, /* 11   0.010742 */
+	1024, /* 12   0.011719 */
+	1024, /* 13   0.012695 */
+	1024, /* 14   0.013672 */
+	1023, /* 15   0.014648 */
+	1023, /* 16   0.015625 */
+	1023, /* 17   0.016602 */
+	1023, /* 18   0.017578 */
+	1023, /* 19   0.018555 */
+	1023, /* 20   0.019531 */
+	1023, /* 21   0.020508 */
+	1023, /* 22   0.021484 */
+	1023, /* 23   0.022461 */
+	1023, /* 24   0.023438 */
+	1022, /* 25   0.024414 */
+	1022, /* 26   0.025391 */
+	1022, /* 27   0.026367 */
+	1022, /* 28   0.027344 */
+	1022, /* 29   0.028320 */
+	1022, /* 30   0.029297 */
+	1022, /* 31   0.030273 */
+	1022, /* 32   0.031250 */
+	1021, /* 33   0.032227 */
+	1021, /* 34   0.033203 */
+	1021, /* 35   0.034180 */
+	1021, /* 36   0.035156 */
+	1021, /* 37   0.036133 */
+	1021, /* 38   0.037109 */
+	1020, /* 39   0.038086 */
+	1020, /* 40   0.039062 */
+	1020, /* 41   0.040039 */
+	1020, /* 42   0.041016 */
+	1020, /* 43   0.041992 */
+	1019, /* 44   0.042969 */
+	1019, /* 45   0.043945 */
+	1019, /* 46   0.044922 */
+	1019, /* 47   0.045898 */
+	1019, /* 48   0.046875 */
+	1018, /* 49   0.047852 */
+	1018, /* 50   0.048828 */
+	1018, /* 51   0.049805 */
+	1018, /* 52   0.050781 */
+	1017, /* 53   0.051758 */
+	1017, /* 54   0.052734 */
+	1017, /* 55   0.053711 */
+	1017, /* 56   0.054688 */
+	1016, /* 57   0.055664 */
+	1016, /* 58   0.056641 */
+	1016, /* 59   0.057617 */
+	1016, /* 60   0.058594 */
+	1015, /* 61   0.059570 */
+	1015, /* 62   0.060547 */
+	1015, /* 63   0.061523 */
+	1014, /* 64   0.062500 */
+	1014, /* 65   0.063477 */
+	1014, /* 66   0.064453 */
+	1013, /* 67   0.065430 */
+	1013, /* 68   0.066406 */
+	1013, /* 69   0.067383 */
+	1013, /* 70   0.068359 */
+	1012, /* 71   0.069336 */
+	1012, /* 72   0.070312 */
+	1012, /* 73   0.071289 */
+	1011, /* 74   0.072266 */
+	1011, /* 75   0.073242 */
+	1011, /* 76   0.074219 */
+	1010, /* 77   0.075195 */
+	1010, /* 78   0.076172 */
+	1009, /* 79   0.077148 */
+	1009, /* 80   0.078125 */
+	1009, /* 81   0.079102 */
+	1008, /* 82   0.080078 */
+	1008, /* 83   0.081055 */
+	1008, /* 84   0.082031 */
+	1007, /* 85   0.083008 */
+	1007, /* 86   0.083984 */
+	1006, /* 87   0.084961 */
+	1006, /* 88   0.085938 */
+	1006, /* 89   0.086914 */
+	1005, /* 90   0.087891 */
+	1005, /* 91   0.088867 */
+	1004, /* 92   0.089844 */
+	1004, /* 93   0.090820 */
+	1004, /* 94   0.091797 */
+	1003, /* 95   0.092773 */
+	1003, /* 96   0.093750 */
+	1002, /* 97   0.094727 */
+	1002, /* 98   0.095703 */
+	1001, /* 99   0.096680 */
+	1001, /* 100  0.097656 */
+	1001, /* 101  0.098633 */
+	1000, /* 102  0.099609 */
+	1000, /* 103  0.100586 */
+	999, /* 104  0.101562 */
+	999, /* 105  0.102539 */
+	998, /* 106  0.103516 */
+	998, /* 107  0.104492 */
+	997, /* 108  0.105469 */
+	997, /* 109  0.106445 */
+	996, /* 110  0.107422 */
+	996, /* 111  0.108398 */
+	995, /* 112  0.109375 */
+	995, /* 113  0.110352 */
+	994, /* 114  0.111328 */
+	994, /* 115  0.112305 */
+	993, /* 116  0.113281 */
+	993, /* 117  0.114258 */
+	992, /* 118  0.115234 */
+	992, /* 119  0.116211 */
+	991, /* 120  0.117188 */
+	991, /* 121  0.118164 */
+	990, /* 122  0.119141 */
+	990, /* 123  0.120117 */
+	989, /* 124  0.121094 */
+	989, /* 125  0.122070 */
+	988, /* 126  0.123047 */
+	988, /* 127  0.124023 */
+	987, /* 128  0.125000 */
+	986, /* 129  0.125977 */
+	986, /* 130  0.126953 */
+	985, /* 131  0.127930 */
+	985, /* 132  0.128906 */
+	984, /* 133  0.129883 */
+	984, /* 134  0.130859 */
+	983, /* 135  0.131836 */
+	982, /* 136  0.132812 */
+	982, /* 137  0.133789 */
+	981, /* 138  0.134766 */
+	981, /* 139  0.135742 */
+	980, /* 140  0.136719 */
+	979, /* 141  0.137695 */
+	979, /* 142  0.138672 */
+	978, /* 143  0.139648 */
+	978, /* 144  0.140625 */
+	977, /* 145  0.141602 */
+	976, /* 146  0.142578 */
+	976, /* 147  0.143555 */
+	975, /* 148  0.144531 */
+	975, /* 149  0.145508 */
+	974, /* 150  0.146484 */
+	973, /* 151  0.147461 */
+	973, /* 152  0.148438 */
+	972, /* 153  0.149414 */
+	971, /* 154  0.150391 */
+	971, /* 155  0.151367 */
+	970, /* 156  0.152344 */
+	969, /* 157  0.153320 */
+	969, /* 158  0.154297 */
+	968, /* 159  0.155273 */
+	967, /* 160  0.156250 */
+	967, /* 161  0.157227 */
+	966, /* 162  0.158203 */
+	965, /* 163  0.159180 */
+	965, /* 164  0.160156 */
+	964, /* 165  0.161133 */
+	963, /* 166  0.162109 */
+	963, /* 167  0.163086 */
+	962, /* 168  0.164062 */
+	961, /* 169  0.165039 */
+	960, /* 170  0.166016 */
+	960, /* 171  0.166992 */
+	959, /* 172  0.167969 */
+	958, /* 173  0.168945 */
+	958, /* 174  0.169922 */
+	957, /* 175  0.170898 */
+	956, /* 176  0.171875 */
+	955, /* 177  0.172852 */
+	955, /* 178  0.173828 */
+	954, /* 179  0.174805 */
+	953, /* 180  0.175781 */
+	952, /* 181  0.176758 */
+	952, /* 182  0.177734 */
+	951, /* 183  0.178711 */
+	950, /* 184  0.179688 */
+	950, /* 185  0.180664 */
+	949, /* 186  0.181641 */
+	948, /* 187  0.182617 */
+	947, /* 188  0.183594 */
+	946, /* 189  0.184570 */
+	946, /* 190  0.185547 */
+	945, /* 191  0.186523 */
+	944, /* 192  0.187500 */
+	943, /* 193  0.188477 */
+	943, /* 194  0.189453 */
+	942, /* 195  0.190430 */
+	941, /* 196  0.191406 */
+	940, /* 197  0.192383 */
+	939, /* 198  0.193359 */
+	939, /* 199  0.194336 */
+	938, /* 200  0.195312 */
+	937, /* 201  0.196289 */
+	936, /* 202  0.197266 */
+	935, /* 203  0.198242 */
+	935, /* 204  0.199219 */
+	934, /* 205  0.200195 */
+	933, /* 206  0.201172 */
+	932, /* 207  0.202148 */
+	931, /* 208  0.203125 */
+	930, /* 209  0.204102 */
+	930, /* 210  0.205078 */
+	929, /* 211  0.206055 */
+	928, /* 212  0.207031 */
+	927, /* 213  0.208008 */
+	926, /* 214  0.208984 */
+	925, /* 215  0.209961 */
+	925, /* 216  0.210938 */
+	924, /* 217  0.211914 */
+	923, /* 218  0.212891 */
+	922, /* 219  0.213867 */
+	921, /* 220  0.214844 */
+	920, /* 221  0.215820 */
+	919, /* 222  0.216797 */
+	918, /* 223  0.217773 */
+	918, /* 224  0.218750 */
+	917, /* 225  0.219727 */
+	916, /* 226  0.220703 */
+	915, /* 227  0.221680 */
+	914, /* 228  0.222656 */
+	913, /* 229  0.223633 */
+	912, /* 230  0.224609 */
+	911, /* 231  0.225586 */
+	910, /* 232  0.226562 */
+	910, /* 233  0.227539 */
+	909, /* 234  0.228516 */
+	908, /* 235  0.229492 */
+	907, /* 236  0.230469 */
+	906, /* 237  0.231445 */
+	905, /* 238  0.232422 */
+	904, /* 239  0.233398 */
+	903, /* 240  0.234375 */
+	902, /* 241  0.235352 */
+	901, /* 242  0.236328 */
+	900, /* 243  0.237305 */
+	899, /* 244  0.238281 */
+	898, /* 245  0.239258 */
+	898, /* 246  0.240234 */
+	897, /* 247  0.241211 */
+	896, /* 248  0.242188 */
+	895, /* 249  0.243164 */
+	894, /* 250  0.244141 */
+	893, /* 251  0.245117 */
+	892, /* 252  0.246094 */
+	891, /* 253  0.247070 */
+	890, /* 254  0.248047 */
+	889, /* 255  0.249023 */
+	888, /* 256  0.250000 */
+	887, /* 257  0.250977 */
+	886, /* 258  0.251953 */
+	885, /* 259  0.252930 */
+	884, /* 260  0.253906 */
+	883, /* 261  0.254883 */
+	882, /* 262  0.255859 */
+	881, /* 263  0.256836 */
+	880, /* 264  0.257812 */
+	879, /* 265  0.258789 */
+	878, /* 266  0.259766 */
+	877, /* 267  0.260742 */
+	876, /* 268  0.261719 */
+	875, /* 269  0.262695 */
+	874, /* 270  0.263672 */
+	873, /* 271  0.264648 */
+	872, /* 272  0.265625 */
+	871, /* 273  0.266602 */
+	870, /* 274  0.267578 */
+	869, /* 275  0.268555 */
+	868, /* 276  0.269531 */
+	867, /* 277  0.270508 */
+	866, /* 278  0.271484 */
+	865, /* 279  0.272461 */
+	864, /* 280  0.273438 */
+	863, /* 281  0.274414 */
+	862, /* 282  0.275391 */
+	861, /* 283  0.276367 */
+	860, /* 284  0.277344 */
+	859, /* 285  0.278320 */
+	858, /* 286  0.279297 */
+	857, /* 287  0.280273 */
+	856, /* 288  0.281250 */
+	855, /* 289  0.282227 */
+	854, /* 290  0.283203 */
+	853, /* 291  0.284180 */
+	851, /* 292  0.285156 */
+	850, /* 293  0.286133 */
+	849, /* 294  0.287109 */
+	848, /* 295  0.288086 */
+	847, /* 296  0.289062 */
+	846, /* 297  0.290039 */
+	845, /* 298  0.291016 */
+	844, /* 299  0.291992 */
+	843, /* 300  0.292969 */
+	842, /* 301  0.293945 */
+	841, /* 302  0.294922 */
+	840, /* 303  0.295898 */
+	839, /* 304  0.296875 */
+	837, /* 305  0.297852 */
+	836, /* 306  0.298828 */
+	835, /* 307  0.299805 */
+	834, /* 308  0.300781 */
+	833, /* 309  0.301758 */
+	832, /* 310  0.302734 */
+	831, /* 311  0.303711 */
+	830, /* 312  0.304688 */
+	829, /* 313  0.305664 */
+	828, /* 314  0.306641 */
+	826, /* 315  0.307617 */
+	825, /* 316  0.308594 */
+	824, /* 317  0.309570 */
+	823, /* 318  0.310547 */
+	822, /* 319  0.311523 */
+	821, /* 320  0.312500 */
+	820, /* 321  0.313477 */
+	819, /* 322  0.314453 */
+	817, /* 323  0.315430 */
+	816, /* 324  0.316406 */
+	815, /* 325  0.317383 */
+	814, /* 326  0.318359 */
+	813, /* 327  0.319336 */
+	812, /* 328  0.320312 */
+	811, /* 329  0.321289 */
+	810, /* 330  0.322266 */
+	808, /* 331  0.323242 */
+	807, /* 332  0.324219 */
+	806, /* 333  0.325195 */
+	805, /* 334  0.326172 */
+	804, /* 335  0.327148 */
+	803, /* 336  0.328125 */
+	801, /* 337  0.329102 */
+	800, /* 338  0.330078 */
+	799, /* 339  0.331055 */
+	798, /* 340  0.332031 */
+	797, /* 341  0.333008 */
+	796, /* 342  0.333984 */
+	794, /* 343  0.334961 */
+	793, /* 344  0.335938 */
+	792, /* 345  0.336914 */
+	791, /* 346  0.337891 */
+	790, /* 347  0.338867 */
+	789, /* 348  0.339844 */
+	787, /* 349  0.340820 */
+	786, /* 350  0.341797 */
+	785, /* 351  0.342773 */
+	784, /* 352  0.343750 */
+	783, /* 353  0.344727 */
+	782, /* 354  0.345703 */
+	780, /* 355  0.346680 */
+	779, /* 356  0.347656 */
+	778, /* 357  0.348633 */
+	777, /* 358  0.349609 */
+	776, /* 359  0.350586 */
+	774, /* 360  0.351562 */
+	773, /* 361  0.352539 */
+	772, /* 362  0.353516 */
+	771, /* 363  0.354492 */
+	770, /* 364  0.355469 */
+	768, /* 365  0.356445 */
+	767, /* 366  0.357422 */
+	766, /* 367  0.358398 */
+	765, /* 368  0.359375 */
+	763, /* 369  0.360352 */
+	762, /* 370  0.361328 */
+	761, /* 371  0.362305 */
+	760, /* 372  0.363281 */
+	759, /* 373  0.364258 */
+	757, /* 374  0.365234 */
+	756, /* 375  0.366211 */
+	755, /* 376  0.367188 */
+	754, /* 377  0.368164 */
+	752, /* 378  0.369141 */
+	751, /* 379  0.370117 */
+	750, /* 380  0.371094 */
+	749, /* 381  0.372070 */
+	747, /* 382  0.373047 */
+	746, /* 383  0.374023 */
+	745, /* 384  0.375000 */
+	744, /* 385  0.375977 */
+	743, /* 386  0.376953 */
+	741, /* 387  0.377930 */
+	740, /* 388  0.378906 */
+	739, /* 389  0.379883 */
+	738, /* 390  0.380859 */
+	736, /* 391  0.381836 */
+	735, /* 392  0.382812 */
+	734, /* 393  0.383789 */
+	733, /* 394  0.384766 */
+	731, /* 395  0.385742 */
+	730, /* 396  0.386719 */
+	729, /* 397  0.387695 */
+	727, /* 398  0.388672 */
+	726, /* 399  0.389648 */
+	725, /* 400  0.390625 */
+	724, /* 401  0.391602 */
+	722, /* 402  0.392578 */
+	721, /* 403  0.393555 */
+	720, /* 404  0.394531 */
+	719, /* 405  0.395508 */
+	717, /* 406  0.396484 */
+	716, /* 407  0.397461 */
+	715, /* 408  0.398438 */
+	713, /* 409  0.399414 */
+	712, /* 410  0.400391 */
+	711, /* 411  0.401367 */
+	710, /* 412  0.402344 */
+	708, /* 413  0.403320 */
+	707, /* 414  0.404297 */
+	706, /* 415  0.405273 */
+	704, /* 416  0.406250 */
+	703, /* 417  0.407227 */
+	702, /* 418  0.408203 */
+	701, /* 419  0.409180 */
+	699, /* 420  0.410156 */
+	698, /* 421  0.411133 */
+	697, /* 422  0.412109 */
+	695, /* 423  0.413086 */
+	694, /* 424  0.414062 */
+	693, /* 425  0.415039 */
+	692, /* 426  0.416016 */
+	690, /* 427  0.416992 */
+	689, /* 428  0.417969 */
+	688, /* 429  0.418945 */
+	686, /* 430  0.419922 */
+	685, /* 431  0.420898 */
+	684, /* 432  0.421875 */
+	682, /* 433  0.422852 */
+	681, /* 434  0.423828 */
+	680, /* 435  0.424805 */
+	678, /* 436  0.425781 */
+	677, /* 437  0.426758 */
+	676, /* 438  0.427734 */
+	675, /* 439  0.428711 */
+	673, /* 440  0.429688 */
+	672, /* 441  0.430664 */
+	671, /* 442  0.431641 */
+	669, /* 443  0.432617 */
+	668, /* 444  0.433594 */
+	667, /* 445  0.434570 */
+	665, /* 446  0.435547 */
+	664, /* 447  0.436523 */
+	663, /* 448  0.437500 */
+	661, /* 449  0.438477 */
+	660, /* 450  0.439453 */
+	659, /* 451  0.440430 */
+	657, /* 452  0.441406 */
+	656, /* 453  0.442383 */
+	655, /* 454  0.443359 */
+	653, /* 455  0.444336 */
+	652, /* 456  0.445312 */
+	651, /* 457  0.446289 */
+	649, /* 458  0.447266 */
+	648, /* 459  0.448242 */
+	647, /* 460  0.449219 */
+	645, /* 461  0.450195 */
+	644, /* 462  0.451172 */
+	643, /* 463  0.452148 */
+	641, /* 464  0.453125 */
+	640, /* 465  0.454102 */
+	639, /* 466  0.455078 */
+	637, /* 467  0.456055 */
+	636, /* 468  0.457031 */
+	635, /* 469  0.458008 */
+	633, /* 470  0.458984 */
+	632, /* 471  0.459961 */
+	631, /* 472  0.460938 */
+	629, /* 473  0.461914 */
+	628, /* 474  0.462891 */
+	626, /* 475  0.463867 */
+	625, /* 476  0.464844 */
+	624, /* 477  0.465820 */
+	622, /* 478  0.466797 */
+	621, /* 479  0.467773 */
+	620, /* 480  0.468750 */
+	618, /* 481  0.469727 */
+	617, /* 482  0.470703 */
+	616, /* 483  0.471680 */
+	614, /* 484  0.472656 */
+	613, /* 485  0.473633 */
+	612, /* 486  0.474609 */
+	610, /* 487  0.475586 */
+	609, /* 488  0.476562 */
+	607, /* 489  0.477539 */
+	606, /* 490  0.478516 */
+	605, /* 491  0.479492 */
+	603, /* 492  0.480469 */
+	602, /* 493  0.481445 */
+	601, /* 494  0.482422 */
+	599, /* 495  0.483398 */
+	598, /* 496  0.484375 */
+	597, /* 497  0.485352 */
+	595, /* 498  0.486328 */
+	594, /* 499  0.487305 */
+	592, /* 500  0.488281 */
+	591, /* 501  0.489258 */
+	590, /* 502  0.490234 */
+	588, /* 503  0.491211 */
+	587, /* 504  0.492188 */
+	586, /* 505  0.493164 */
+	584, /* 506  0.494141 */
+	583, /* 507  0.495117 */
+	581, /* 508  0.496094 */
+	580, /* 509  0.497070 */
+	579, /* 510  0.498047 */
+	577, /* 511  0.499023 */
+	576, /* 512  0.500000 */
+	575, /* 513  0.500977 */
+	573, /* 514  0.501953 */
+	572, /* 515  0.502930 */
+	570, /* 516  0.503906 */
+	569, /* 517  0.504883 */
+	568, /* 518  0.505859 */
+	566, /* 519  0.506836 */
+	565, /* 520  0.507812 */
+	564, /* 521  0.508789 */
+	562, /* 522  0.509766 */
+	561, /* 523  0.510742 */
+	559, /* 524  0.511719 */
+	558, /* 525  0.512695 */
+	557, /* 526  0.513672 */
+	555, /* 527  0.514648 */
+	554, /* 528  0.515625 */
+	553, /* 529  0.516602 */
+	551, /* 530  0.517578 */
+	550, /* 531  0.518555 */
+	548, /* 532  0.519531 */
+	547, /* 533  0.520508 */
+	546, /* 534  0.521484 */
+	544, /* 535  0.522461 */
+	543, /* 536  0.523438 */
+	541, /* 537  0.524414 */
+	540, /* 538  0.525391 */
+	539, /* 539  0.526367 */
+	537, /* 540  0.527344 */
+	536, /* 541  0.528320 */
+	535, /* 542  0.529297 */
+	533, /* 543  0.530273 */
+	532, /* 544  0.531250 */
+	530, /* 545  0.532227 */
+	529, /* 546  0.533203 */
+	528, /* 547  0.534180 */
+	526, /* 548  0.535156 */
+	525, /* 549  0.536133 */
+	523, /* 550  0.537109 */
+	522, /* 551  0.538086 */
+	521, /* 552  0.539062 */
+	519, /* 553  0.540039 */
+	518, /* 554  0.541016 */
+	517, /* 555  0.541992 */
+	515, /* 556  0.542969 */
+	514, /* 557  0.543945 */
+	512, /* 558  0.544922 */
+	511, /* 559  0.545898 */
+	510, /* 560  0.546875 */
+	508, /* 561  0.547852 */
+	507, /* 562  0.548828 */
+	505, /* 563  0.549805 */
+	504, /* 564  0.550781 */
+	503, /* 565  0.551758 */
+	501, /* 566  0.552734 */
+	500, /* 567  0.553711 */
+	498, /* 568  0.554688 */
+	497, /* 569  0.555664 */
+	496, /* 570  0.556641 */
+	494, /* 571  0.557617 */
+	493, /* 572  0.558594 */
+	492, /* 573  0.559570 */
+	490, /* 574  0.560547 */
+	489, /* 575  0.561523 */
+	487, /* 576  0.562500 */
+	486, /* 577  0.563477 */
+	485, /* 578  0.564453 */
+	483, /* 579  0.565430 */
+	482, /* 580  0.566406 */
+	480, /* 581  0.567383 */
+	479, /* 582  0.568359 */
+	478, /* 583  0.569336 */
+	476, /* 584  0.570312 */
+	475, /* 585  0.571289 */
+	473, /* 586  0.572266 */
+	472, /* 587  0.573242 */
+	471, /* 588  0.574219 */
+	469, /* 589  0.575195 */
+	468, /* 590  0.576172 */
+	467, /* 591  0.577148 */
+	465, /* 592  0.578125 */
+	464, /* 593  0.579102 */
+	462, /* 594  0.580078 */
+	461, /* 595  0.581055 */
+	460, /* 596  0.582031 */
+	458, /* 597  0.583008 */
+	457, /* 598  0.583984 */
+	455, /* 599  0.584961 */
+	454, /* 600  0.585938 */
+	453, /* 601  0.586914 */
+	451, /* 602  0.587891 */
+	450, /* 603  0.588867 */
+	449, /* 604  0.589844 */
+	447, /* 605  0.590820 */
+	446, /* 606  0.591797 */
+	444, /* 607  0.592773 */
+	443, /* 608  0.593750 */
+	442, /* 609  0.594727 */
+	440, /* 610  0.595703 */
+	439, /* 611  0.596680 */
+	437, /* 612  0.597656 */
+	436, /* 613  0.598633 */
+	435, /* 614  0.599609 */
+	433, /* 615  0.600586 */
+	432, /* 616  0.601562 */
+	431, /* 617  0.602539 */
+	429, /* 618  0.603516 */
+	428, /* 619  0.604492 */
+	426, /* 620  0.605469 */
+	425, /* 621  0.606445 */
+	424, /* 622  0.607422 */
+	422, /* 623  0.608398 */
+	421, /* 624  0.609375 */
+	420, /* 625  0.610352 */
+	418, /* 626  0.611328 */
+	417, /* 627  0.612305 */
+	415, /* 628  0.613281 */
+	414, /* 629  0.614258 */
+	413, /* 630  0.615234 */
+	411, /* 631  0.616211 */
+	410, /* 632  0.617188 */
+	409, /* 633  0.618164 */
+	407, /* 634  0.619141 */
+	406, /* 635  0.620117 */
+	404, /* 636  0.621094 */
+	403, /* 637  0.622070 */
+	402, /* 638  0.623047 */
+	400, /* 639  0.624023 */
+	399, /* 640  0.625000 */
+	398, /* 641  0.625977 */
+	396, /* 642  0.626953 */
+	395, /* 643  0.627930 */
+	394, /* 644  0.628906 */
+	392, /* 645  0.629883 */
+	391, /* 646  0.630859 */
+	389, /* 647  0.631836 */
+	388, /* 648  0.632812 */
+	387, /* 649  0.633789 */
+	385, /* 650  0.634766 */
+	384, /* 651  0.635742 */
+	383, /* 652  0.636719 */
+	381, /* 653  0.637695 */
+	380, /* 654  0.638672 */
+	379, /* 655  0.639648 */
+	377, /* 656  0.640625 */
+	376, /* 657  0.641602 */
+	374, /* 658  0.642578 */
+	373, /* 659  0.643555 */
+	372, /* 660  0.644531 */
+	370, /* 661  0.645508 */
+	369, /* 662  0.646484 */
+	368, /* 663  0.647461 */
+	366, /* 664  0.648438 */
+	365, /* 665  0.649414 */
+	364, /* 666  0.650391 */
+	362, /* 667  0.651367 */
+	361, /* 668  0.652344 */
+	360, /* 669  0.653320 */
+	358, /* 670  0.654297 */
+	357, /* 671  0.655273 */
+	356, /* 672  0.656250 */
+	354, /* 673  0.657227 */
+	353, /* 674  0.658203 */
+	352, /* 675  0.659180 */
+	350, /* 676  0.660156 */
+	349, /* 677  0.661133 */
+	348, /* 678  0.662109 */
+	346, /* 679  0.663086 */
+	345, /* 680  0.664062 */
+	344, /* 681  0.665039 */
+	342, /* 682  0.666016 */
+	341, /* 683  0.666992 */
+	340, /* 684  0.667969 */
+	338, /* 685  0.668945 */
+	337, /* 686  0.669922 */
+	336, /* 687  0.670898 */
+	334, /* 688  0.671875 */
+	333, /* 689  0.672852 */
+	332, /* 690  0.673828 */
+	330, /* 691  0.674805 */
+	329, /* 692  0.675781 */
+	328, /* 693  0.676758 */
+	326, /* 694  0.677734 */
+	325, /* 695  0.678711 */
+	324, /* 696  0.679688 */
+	322, /* 697  0.680664 */
+	321, /* 698  0.681641 */
+	320, /* 699  0.682617 */
+	318, /* 700  0.683594 */
+	317, /* 701  0.684570 */
+	316, /* 702  0.685547 */
+	314, /* 703  0.686523 */
+	313, /* 704  0.687500 */
+	312, /* 705  0.688477 */
+	311, /* 706  0.689453 */
+	309, /* 707  0.690430 */
+	308, /* 708  0.691406 */
+	307, /* 709  0.692383 */
+	305, /* 710  0.693359 */
+	304, /* 711  0.694336 */
+	303, /* 712  0.695312 */
+	301, /* 713  0.696289 */
+	300, /* 714  0.697266 */
+	299, /* 715  0.698242 */
+	297, /* 716  0.699219 */
+	296, /* 717  0.700195 */
+	295, /* 718  0.701172 */
+	294, /* 719  0.702148 */
+	292, /* 720  0.703125 */
+	291, /* 721  0.704102 */
+	290, /* 722  0.705078 */
+	288, /* 723  0.706055 */
+	287, /* 724  0.707031 */
+	286, /* 725  0.708008 */
+	285, /* 726  0.708984 */
+	283, /* 727  0.709961 */
+	282, /* 728  0.710938 */
+	281, /* 729  0.711914 */
+	279, /* 730  0.712891 */
+	278, /* 731  0.713867 */
+	277, /* 732  0.714844 */
+	276, /* 733  0.715820 */
+	274, /* 734  0.716797 */
+	273, /* 735  0.717773 */
+	272, /* 736  0.718750 */
+	271, /* 737  0.719727 */
+	269, /* 738  0.720703 */
+	268, /* 739  0.721680 */
+	267, /* 740  0.722656 */
+	266, /* 741  0.723633 */
+	264, /* 742  0.724609 */
+	263, /* 743  0.725586 */
+	262, /* 744  0.726562 */
+	260, /* 745  0.727539 */
+	259, /* 746  0.728516 */
+	258, /* 747  0.729492 */
+	257, /* 748  0.730469 */
+	255, /* 749  0.731445 */
+	254, /* 750  0.732422 */
+	253, /* 751  0.733398 */
+	252, /* 752  0.734375 */
+	250, /* 753  0.735352 */
+	249, /* 754  0.736328 */
+	248, /* 755  0.737305 */
+	247, /* 756  0.738281 */
+	246, /* 757  0.739258 */
+	244, /* 758  0.740234 */
+	243, /* 759  0.741211 */
+	242, /* 760  0.742188 */
+	241, /* 761  0.743164 */
+	239, /* 762  0.744141 */
+	238, /* 763  0.745117 */
+	237, /* 764  0.746094 */
+	236, /* 765  0.747070 */
+	234, /* 766  0.748047 */
+	233, /* 767  0.749023 */
+	232, /* 768  0.750000 */
+	231, /* 769  0.750977 */
+	230, /* 770  0.751953 */
+	228, /* 771  0.752930 */
+	227, /* 772  0.753906 */
+	226, /* 773  0.754883 */
+	225, /* 774  0.755859 */
+	224, /* 775  0.756836 */
+	222, /* 776  0.757812 */
+	221, /* 777  0.758789 */
+	220, /* 778  0.759766 */
+	219, /* 779  0.760742 */
+	218, /* 780  0.761719 */
+	216, /* 781  0.762695 */
+	215, /* 782  0.763672 */
+	214, /* 783  0.764648 */
+	213, /* 784  0.765625 */
+	212, /* 785  0.766602 */
+	210, /* 786  0.767578 */
+	209, /* 787  0.768555 */
+	208, /* 788  0.769531 */
+	207, /* 789  0.770508 */
+	206, /* 790  0.771484 */
+	204, /* 791  0.772461 */
+	203, /* 792  0.773438 */
+	202, /* 793  0.774414 */
+	201, /* 794  0.775391 */
+	200, /* 795  0.776367 */
+	199, /* 796  0.777344 */
+	197, /* 797  0.778320 */
+	196, /* 798  0.779297 */
+	195, /* 799  0.780273 */
+	194, /* 800  0.781250 */
+	193, /* 801  0.782227 */
+	192, /* 802  0.783203 */
+	190, /* 803  0.784180 */
+	189, /* 804  0.785156 */
+	188, /* 805  0.786133 */
+	187, /* 806  0.787109 */
+	186, /* 807  0.788086 */
+	185, /* 808  0.789062 */
+	184, /* 809  0.790039 */
+	182, /* 810  0.791016 */
+	181, /* 811  0.791992 */
+	180, /* 812  0.792969 */
+	179, /* 813  0.793945 */
+	178, /* 814  0.794922 */
+	177, /* 815  0.795898 */
+	176, /* 816  0.796875 */
+	175, /* 817  0.797852 */
+	173, /* 818  0.798828 */
+	172, /* 819  0.799805 */
+	171, /* 820  0.800781 */
+	170, /* 821  0.801758 */
+	169, /* 822  0.802734 */
+	168, /* 823  0.803711 */
+	167, /* 824  0.804688 */
+	166, /* 825  0.805664 */
+	164, /* 826  0.806641 */
+	163, /* 827  0.807617 */
+	162, /* 828  0.808594 */
+	161, /* 829  0.809570 */
+	160, /* 830  0.810547 */
+	159, /* 831  0.811523 */
+	158, /* 832  0.812500 */
+	157, /* 833  0.813477 */
+	156, /* 834  0.814453 */
+	155, /* 835  0.815430 */
+	154, /* 836  0.816406 */
+	152, /* 837  0.817383 */
+	151, /* 838  0.818359 */
+	150, /* 839  0.819336 */
+	149, /* 840  0.820312 */
+	148, /* 841  0.821289 */
+	147, /* 842  0.822266 */
+	146, /* 843  0.823242 */
+	145, /* 844  0.824219 */
+	144, /* 845  0.825195 */
+	143, /* 846  0.826172 */
+	142, /* 847  0.827148 */
+	141, /* 848  0.828125 */
+	140, /* 849  0.829102 */
+	139, /* 850  0.830078 */
+	138, /* 851  0.831055 */
+	137, /* 852  0.832031 */
+	135, /* 853  0.833008 */
+	134, /* 854  0.833984 */
+	133, /* 855  0.834961 */
+	132, /* 856  0.835938 */
+	131, /* 857  0.836914 */
+	130, /* 858  0.837891 */
+	129, /* 859  0.838867 */
+	128, /* 860  0.839844 */
+	127, /* 861  0.840820 */
+	126, /* 862  0.841797 */
+	125, /* 863  0.842773 */
+	124, /* 864  0.843750 */
+	123, /* 865  0.844727 */
+	122, /* 866  0.845703 */
+	121, /* 867  0.846680 */
+	120, /* 868  0.847656 */
+	119, /* 869  0.848633 */
+	118, /* 870  0.849609 */
+	117, /* 871  0.850586 */
+	116, /* 872  0.851562 */
+	115, /* 873  0.852539 */
+	114, /* 874  0.853516 */
+	113, /* 875  0.854492 */
+	112, /* 876  0.855469 */
+	111, /* 877  0.856445 */
+	110, /* 878  0.857422 */
+	109, /* 879  0.858398 */
+	108, /* 880  0.859375 */
+	107, /* 881  0.860352 */
+	106, /* 882  0.861328 */
+	105, /* 883  0.862305 */
+	104, /* 884  0.863281 */
+	103, /* 885  0.864258 */
+	102, /* 886  0.865234 */
+	101, /* 887  0.866211 */
+	101, /* 888  0.867188 */
+	100, /* 889  0.868164 */
+	99, /* 890  0.869141 */
+	98, /* 891  0.870117 */
+	97, /* 892  0.871094 */
+	96, /* 893  0.872070 */
+	95, /* 894  0.873047 */
+	94, /* 895  0.874023 */
+	93, /* 896  0.875000 */
+	92, /* 897  0.875977 */
+	91, /* 898  0.876953 */
+	90, /* 899  0.877930 */
+	89, /* 900  0.878906 */
+	88, /* 901  0.879883 */
+	87, /* 902  0.880859 */
+	87, /* 903  0.881836 */
+	86, /* 904  0.882812 */
+	85, /* 905  0.883789 */
+	84, /* 906  0.884766 */
+	83, /* 907  0.885742 */
+	82, /* 908  0.886719 */
+	81, /* 909  0.887695 */
+	80, /* 910  0.888672 */
+	79, /* 911  0.889648 */
+	78, /* 912  0.890625 */
+	78, /* 913  0.891602 */
+	77, /* 914  0.892578 */
+	76, /* 915  0.893555 */
+	75, /* 916  0.894531 */
+	74, /* 917  0.895508 */
+	73, /* 918  0.896484 */
+	72, /* 919  0.897461 */
+	72, /* 920  0.898438 */
+	71, /* 921  0.899414 */
+	70, /* 922  0.900391 */
+	69, /* 923  0.901367 */
+	68, /* 924  0.902344 */
+	67, /* 925  0.903320 */
+	66, /* 926  0.904297 */
+	66, /* 927  0.905273 */
+	65, /* 928  0.906250 */
+	64, /* 929  0.907227 */
+	63, /* 930  0.908203 */
+	62, /* 931  0.909180 */
+	61, /* 932  0.910156 */
+	61, /* 933  0.911133 */
+	60, /* 934  0.912109 */
+	59, /* 935  0.913086 */
+	58, /* 936  0.914062 */
+	57, /* 937  0.915039 */
+	57, /* 938  0.916016 */
+	56, /* 939  0.916992 */
+	55, /* 940  0.917969 */
+	54, /* 941  0.918945 */
+	53, /* 942  0.919922 */
+	53, /* 943  0.920898 */
+	52, /* 944  0.921875 */
+	51, /* 945  0.922852 */
+	50, /* 946  0.923828 */
+	49, /* 947  0.924805 */
+	49, /* 948  0.925781 */
+	48, /* 949  0.926758 */
+	47, /* 950  0.927734 */
+	46, /* 951  0.928711 */
+	46, /* 952  0.929688 */
+	45, /* 953  0.930664 */
+	44, /* 954  0.931641 */
+	43, /* 955  0.932617 */
+	43, /* 956  0.933594 */
+	42, /* 957  0.934570 */
+	41, /* 958  0.935547 */
+	40, /* 959  0.936523 */
+	40, /* 960  0.937500 */
+	39, /* 961  0.938477 */
+	38, /* 962  0.939453 */
+	37, /* 963  0.940430 */
+	37, /* 964  0.941406 */
+	36, /* 965  0.942383 */
+	35, /* 966  0.943359 */
+	35, /* 967  0.944336 */
+	34, /* 968  0.945312 */
+	33, /* 969  0.946289 */
+	32, /* 970  0.947266 */
+	32, /* 971  0.948242 */
+	31, /* 972  0.949219 */
+	30, /* 973  0.950195 */
+	30, /* 974  0.951172 */
+	29, /* 975  0.952148 */
+	28, /* 976  0.953125 */
+	28, /* 977  0.954102 */
+	27, /* 978  0.955078 */
+	26, /* 979  0.956055 */
+	26, /* 980  0.957031 */
+	25, /* 981  0.958008 */
+	24, /* 982  0.958984 */
+	24, /* 983  0.959961 */
+	23, /* 984  0.960938 */
+	22, /* 985  0.961914 */
+	22, /* 986  0.962891 */
+	21, /* 987  0.963867 */
+	20, /* 988  0.964844 */
+	20, /* 989  0.965820 */
+	19, /* 990  0.966797 */
+	19, /* 991  0.967773 */
+	18, /* 992  0.968750 */
+	17, /* 993  0.969727 */
+	17, /* 994  0.970703 */
+	16, /* 995  0.971680 */
+	15, /* 996  0.972656 */
+	15, /* 997  0.973633 */
+	14, /* 998  0.974609 */
+	14, /* 999  0.975586 */
+	13, /* 1000 0.976562 */
+	13, /* 1001 0.977539 */
+	12, /* 1002 0.978516 */
+	11, /* 1003 0.979492 */
+	11, /* 1004 0.980469 */
+	10, /* 1005 0.981445 */
+	10, /* 1006 0.982422 */
+	9, /* 1007 0.983398 */
+	8, /* 1008 0.984375 */
+	8, /* 1009 0.985352 */
+	7, /* 1010 0.986328 */
+	7, /* 1011 0.987305 */
+	6, /* 1012 0.988281 */
+	6, /* 1013 0.989258 */
+	5, /* 1014 0.990234 */
+	5, /* 1015 0.991211 */
+	4, /* 1016 0.992188 */
+	4, /* 1017 0.993164 */
+	3, /* 1018 0.994141 */
+	3, /* 1019 0.995117 */
+	2, /* 1020 0.996094 */
+	2, /* 1021 0.997070 */
+	1, /* 1022 0.998047 */
+	0, /* 1024 1.000000 */
+	0, /* 1025 1.000977 */
+	-1, /* 1026 1.001953 */
+	-1, /* 1027 1.002930 */
+	-2, /* 1028 1.003906 */
+	-2, /* 1029 1.004883 */
+	-3, /* 1030 1.005859 */
+	-3, /* 1031 1.006836 */
+	-4, /* 1032 1.007812 */
+	-4, /* 1033 1.008789 */
+	-5, /* 1034 1.009766 */
+	-5, /* 1035 1.010742 */
+	-6, /* 1036 1.011719 */
+	-6, /* 1037 1.012695 */
+	-7, /* 1038 1.013672 */
+	-7, /* 1039 1.014648 */
+	-8, /* 1040 1.015625 */
+	-8, /* 1041 1.016602 */
+	-9, /* 1042 1.017578 */
+	-9, /* 1043 1.018555 */
+	-10, /* 1044 1.019531 */
+	-10, /* 1045 1.020508 */
+	-11, /* 1046 1.021484 */
+	-11, /* 1047 1.022461 */
+	-11, /* 1048 1.023438 */
+	-12, /* 1049 1.024414 */
+	-12, /* 1050 1.025391 */
+	-13, /* 1051 1.026367 */
+	-13, /* 1052 1.027344 */
+	-14, /* 1053 1.028320 */
+	-14, /* 1054 1.029297 */
+	-15, /* 1055 1.030273 */
+	-15, /* 1056 1.031250 */
+	-15, /* 1057 1.032227 */
+	-16, /* 1058 1.033203 */
+	-16, /* 1059 1.034180 */
+	-17, /* 1060 1.035156 */
+	-17, /* 1061 1.036133 */
+	-18, /* 1062 1.037109 */
+	-18, /* 1063 1.038086 */
+	-18, /* 1064 1.039062 */
+	-19, /* 1065 1.040039 */
+	-19, /* 1066 1.041016 */
+	-20, /* 1067 1.041992 */
+	-20, /* 1068 1.042969 */
+	-21, /* 1069 1.043945 */
+	-21, /* 1070 1.044922 */
+	-21, /* 1071 1.045898 */
+	-22, /* 1072 1.046875 */
+	-22, /* 1073 1.047852 */
+	-23, /* 1074 1.048828 */
+	-23, /* 1075 1.049805 */
+	-23, /* 1076 1.050781 */
+	-24, /* 1077 1.051758 */
+	-24, /* 1078 1.052734 */
+	-25, /* 1079 1.053711 */
+	-25, /* 1080 1.054688 */
+	-25, /* 1081 1.055664 */
+	-26, /* 1082 1.056641 */
+	-26, /* 1083 1.057617 */
+	-27, /* 1084 1.058594 */
+	-27, /* 1085 1.059570 */
+	-27, /* 1086 1.060547 */
+	-28, /* 1087 1.061523 */
+	-28, /* 1088 1.062500 */
+	-29, /* 1089 1.063477 */
+	-29, /* 1090 1.064453 */
+	-29, /* 1091 1.065430 */
+	-30, /* 1092 1.066406 */
+	-30, /* 1093 1.067383 */
+	-30, /* 1094 1.068359 */
+	-31, /* 1095 1.069336 */
+	-31, /* 1096 1.070312 */
+	-31, /* 1097 1.071289 */
+	-32, /* 1098 1.072266 */
+	-32, /* 1099 1.073242 */
+	-33, /* 1100 1.074219 */
+	-33, /* 1101 1.075195 */
+	-33, /* 1102 1.076172 */
+	-34, /* 1103 1.077148 */
+	-34, /* 1104 1.078125 */
+	-34, /* 1105 1.079102 */
+	-35, /* 1106 1.080078 */
+	-35, /* 1107 1.081055 */
+	-35, /* 1108 1.082031 */
+	-36, /* 1109 1.083008 */
+	-36, /* 1110 1.083984 */
+	-36, /* 1111 1.084961 */
+	-37, /* 1112 1.085938 */
+	-37, /* 1113 1.086914 */
+	-37, /* 1114 1.087891 */
+	-38, /* 1115 1.088867 */
+	-38, /* 1116 1.089844 */
+	-38, /* 1117 1.090820 */
+	-39, /* 1118 1.091797 */
+	-39, /* 1119 1.092773 */
+	-39, /* 1120 1.093750 */
+	-40, /* 1121 1.094727 */
+	-40, /* 1122 1.095703 */
+	-40, /* 1123 1.096680 */
+	-41, /* 1124 1.097656 */
+	-41, /* 1125 1.098633 */
+	-41, /* 1126 1.099609 */
+	-42, /* 1127 1.100586 */
+	-42, /* 1128 1.101562 */
+	-42, /* 1129 1.102539 */
+	-43, /* 1130 1.103516 */
+	-43, /* 1131 1.104492 */
+	-43, /* 1132 1.105469 */
+	-44, /* 1133 1.106445 */
+	-44, /* 1134 1.107422 */
+	-44, /* 1135 1.108398 */
+	-44, /* 1136 1.109375 */
+	-45, /* 1137 1.110352 */
+	-45, /* 1138 1.111328 */
+	-45, /* 1139 1.112305 */
+	-46, /* 1140 1.113281 */
+	-46, /* 1141 1.114258 */
+	-46, /* 1142 1.115234 */
+	-46, /* 1143 1.116211 */
+	-47, /* 1144 1.117188 */
+	-47, /* 1145 1.118164 */
+	-47, /* 1146 1.119141 */
+	-48, /* 1147 1.120117 */
+	-48, /* 1148 1.121094 */
+	-48, /* 1149 1.122070 */
+	-48, /* 1150 1.123047 */
+	-49, /* 1151 1.124023 */
+	-49, /* 1152 1.125000 */
+	-49, /* 1153 1.125977 */
+	-50, /* 1154 1.126953 */
+	-50, /* 1155 1.127930 */
+	-50, /* 1156 1.128906 */
+	-50, /* 1157 1.129883 */
+	-51, /* 1158 1.130859 */
+	-51, /* 1159 1.131836 */
+	-51, /* 1160 1.132812 */
+	-51, /* 1161 1.133789 */
+	-52, /* 1162 1.134766 */
+	-52, /* 1163 1.135742 */
+	-52, /* 1164 1.136719 */
+	-52, /* 1165 1.137695 */
+	-53, /* 1166 1.138672 */
+	-53, /* 1167 1.139648 */
+	-53, /* 1168 1.140625 */
+	-53, /* 1169 1.141602 */
+	-54, /* 1170 1.142578 */
+	-54, /* 1171 1.143555 */
+	-54, /* 1172 1.144531 */
+	-54, /* 1173 1.145508 */
+	-55, /* 1174 1.146484 */
+	-55, /* 1175 1.147461 */
+	-55, /* 1176 1.148438 */
+	-55, /* 1177 1.149414 */
+	-56, /* 1178 1.150391 */
+	-56, /* 1179 1.151367 */
+	-56, /* 1180 1.152344 */
+	-56, /* 1181 1.153320 */
+	-57, /* 1182 1.154297 */
+	-57, /* 1183 1.155273 */
+	-57, /* 1184 1.156250 */
+	-57, /* 1185 1.157227 */
+	-57, /* 1186 1.158203 */
+	-58, /* 1187 1.159180 */
+	-58, /* 1188 1.160156 */
+	-58, /* 1189 1.161133 */
+	-58, /* 1190 1.162109 */
+	-58, /* 1191 1.163086 */
+	-59, /* 1192 1.164062 */
+	-59, /* 1193 1.165039 */
+	-59, /* 1194 1.166016 */
+	-59, /* 1195 1.166992 */
+	-60, /* 1196 1.167969 */
+	-60, /* 1197 1.168945 */
+	-60, /* 1198 1.169922 */
+	-60, /* 1199 1.170898 */
+	-60, /* 1200 1.171875 */
+	-61, /* 1201 1.172852 */
+	-61, /* 1202 1.173828 */
+	-61, /* 1203 1.174805 */
+	-61, /* 1204 1.175781 */
+	-61, /* 1205 1.176758 */
+	-62, /* 1206 1.177734 */
+	-62, /* 1207 1.178711 */
+	-62, /* 1208 1.179688 */
+	-62, /* 1209 1.180664 */
+	-62, /* 1210 1.181641 */
+	-62, /* 1211 1.182617 */
+	-63, /* 1212 1.183594 */
+	-63, /* 1213 1.184570 */
+	-63, /* 1214 1.185547 */
+	-63, /* 1215 1.186523 */
+	-63, /* 1216 1.187500 */
+	-64, /* 1217 1.188477 */
+	-64, /* 1218 1.189453 */
+	-64, /* 1219 1.190430 */
+	-64, /* 1220 1.191406 */
+	-64, /* 1221 1.192383 */
+	-64, /* 1222 1.193359 */
+	-65, /* 1223 1.194336 */
+	-65, /* 1224 1.195312 */
+	-65, /* 1225 1.196289 */
+	-65, /* 1226 1.197266 */
+	-65, /* 1227 1.198242 */
+	-65, /* 1228 1.199219 */
+	-66, /* 1229 1.200195 */
+	-66, /* 1230 1.201172 */
+	-66, /* 1231 1.202148 */
+	-66, /* 1232 1.203125 */
+	-66, /* 1233 1.204102 */
+	-66, /* 1234 1.205078 */
+	-67, /* 1235 1.206055 */
+	-67, /* 1236 1.207031 */
+	-67, /* 1237 1.208008 */
+	-67, /* 1238 1.208984 */
+	-67, /* 1239 1.209961 */
+	-67, /* 1240 1.210938 */
+	-67, /* 1241 1.211914 */
+	-68, /* 1242 1.212891 */
+	-68, /* 1243 1.213867 */
+	-68, /* 1244 1.214844 */
+	-68, /* 1245 1.215820 */
+	-68, /* 1246 1.216797 */
+	-68, /* 1247 1.217773 */
+	-68, /* 1248 1.218750 */
+	-68, /* 1249 1.219727 */
+	-69, /* 1250 1.220703 */
+	-69, /* 1251 1.221680 */
+	-69, /* 1252 1.222656 */
+	-69, /* 1253 1.223633 */
+	-69, /* 1254 1.224609 */
+	-69, /* 1255 1.225586 */
+	-69, /* 1256 1.226562 */
+	-70, /* 1257 1.227539 */
+	-70, /* 1258 1.228516 */
+	-70, /* 1259 1.229492 */
+	-70, /* 1260 1.230469 */
+	-70, /* 1261 1.231445 */
+	-70, /* 1262 1.232422 */
+	-70, /* 1263 1.233398 */
+	-70, /* 1264 1.234375 */
+	-70, /* 1265 1.235352 */
+	-71, /* 1266 1.236328 */
+	-71, /* 1267 1.237305 */
+	-71, /* 1268 1.238281 */
+	-71, /* 1269 1.239258 */
+	-71, /* 1270 1.240234 */
+	-71, /* 1271 1.241211 */
+	-71, /* 1272 1.242188 */
+	-71, /* 1273 1.243164 */
+	-71, /* 1274 1.244141 */
+	-72, /* 1275 1.245117 */
+	-72, /* 1276 1.246094 */
+	-72, /* 1277 1.247070 */
+	-72, /* 1278 1.248047 */
+	-72, /* 1279 1.249023 */
+	-72, /* 1280 1.250000 */
+	-72, /* 1281 1.250977 */
+	-72, /* 1282 1.251953 */
+	-72, /* 1283 1.252930 */
+	-72, /* 1284 1.253906 */
+	-72, /* 1285 1.254883 */
+	-73, /* 1286 1.255859 */
+	-73, /* 1287 1.256836 */
+	-73, /* 1288 1.257812 */
+	-73, /* 1289 1.258789 */
+	-73, /* 1290 1.259766 */
+	-73, /* 1291 1.260742 */
+	-73, /* 1292 1.261719 */
+	-73, /* 1293 1.262695 */
+	-73, /* 1294 1.263672 */
+	-73, /* 1295 1.264648 */
+	-73, /* 1296 1.265625 */
+	-73, /* 1297 1.266602 */
+	-73, /* 1298 1.267578 */
+	-74, /* 1299 1.268555 */
+	-74, /* 1300 1.269531 */
+	-74, /* 1301 1.270508 */
+	-74, /* 1302 1.271484 */
+	-74, /* 1303 1.272461 */
+	-74, /* 1304 1.273438 */
+	-74, /* 1305 1.274414 */
+	-74, /* 1306 1.275391 */
+	-74, /* 1307 1.276367 */
+	-74, /* 1308 1.277344 */
+	-74, /* 1309 1.278320 */
+	-74, /* 1310 1.279297 */
+	-74, /* 1311 1.280273 */
+	-74, /* 1312 1.281250 */
+	-74, /* 1313 1.282227 */
+	-75, /* 1314 1.283203 */
+	-75, /* 1315 1.284180 */
+	-75, /* 1316 1.285156 */
+	-75, /* 1317 1.286133 */
+	-75, /* 1318 1.287109 */
+	-75, /* 1319 1.288086 */
+	-75, /* 1320 1.289062 */
+	-75, /* 1321 1.290039 */
+	-75, /* 1322 1.291016 */
+	-75, /* 1323 1.291992 */
+	-75, /* 1324 1.292969 */
+	-75, /* 1325 1.293945 */
+	-75, /* 1326 1.294922 */
+	-75, /* 1327 1.295898 */
+	-75, /* 1328 1.296875 */
+	-75, /* 1329 1.297852 */
+	-75, /* 1330 1.298828 */
+	-75, /* 1331 1.299805 */
+	-75, /* 1332 1.300781 */
+	-75, /* 1333 1.301758 */
+	-75, /* 1334 1.302734 */
+	-75, /* 1335 1.303711 */
+	-75, /* 1336 1.304688 */
+	-75, /* 1337 1.305664 */
+	-75, /* 1338 1.306641 */
+	-76, /* 1339 1.307617 */
+	-76, /* 1340 1.308594 */
+	-76, /* 1341 1.309570 */
+	-76, /* 1342 1.310547 */
+	-76, /* 1343 1.311523 */
+	-76, /* 1344 1.312500 */
+	-76, /* 1345 1.313477 */
+	-76, /* 1346 1.314453 */
+	-76, /* 1347 1.315430 */
+	-76, /* 1348 1.316406 */
+	-76, /* 1349 1.317383 */
+	-76, /* 1350 1.318359 */
+	-76, /* 1351 1.319336 */
+	-76, /* 1352 1.320312 */
+	-76, /* 1353 1.321289 */
+	-76, /* 1354 1.322266 */
+	-76, /* 1355 1.323242 */
+	-76, /* 1356 1.324219 */
+	-76, /* 1357 1.325195 */
+	-76, /* 1358 1.326172 */
+	-76, /* 1359 1.327148 */
+	-76, /* 1360 1.328125 */
+	-76, /* 1361 1.329102 */
+	-76, /* 1362 1.330078 */
+	-76, /* 1363 1.331055 */
+	-76, /* 1364 1.332031 */
+	-76, /* 1365 1.333008 */
+	-76, /* 1366 1.333984 */
+	-76, /* 1367 1.334961 */
+	-76, /* 1368 1.335938 */
+	-76, /* 1369 1.336914 */
+	-76, /* 1370 1.337891 */
+	-76, /* 1371 1.338867 */
+	-76, /* 1372 1.339844 */
+	-76, /* 1373 1.340820 */
+	-76, /* 1374 1.341797 */
+	-76, /* 1375 1.342773 */
+	-76, /* 1376 1.343750 */
+	-76, /* 1377 1.344727 */
+	-76, /* 1378 1.345703 */
+	-76, /* 1379 1.346680 */
+	-76, /* 1380 1.347656 */
+	-76, /* 1381 1.348633 */
+	-76, /* 1382 1.349609 */
+	-76, /* 1383 1.350586 */
+	-76, /* 1384 1.351562 */
+	-76, /* 1385 1.352539 */
+	-76, /* 1386 1.353516 */
+	-76, /* 1387 1.354492 */
+	-76, /* 1388 1.355469 */
+	-76, /* 1389 1.356445 */
+	-76, /* 1390 1.357422 */
+	-76, /* 1391 1.358398 */
+	-76, /* 1392 1.359375 */
+	-75, /* 1393 1.360352 */
+	-75, /* 1394 1.361328 */
+	-75, /* 1395 1.362305 */
+	-75, /* 1396 1.363281 */
+	-75, /* 1397 1.364258 */
+	-75, /* 1398 1.365234 */
+	-75, /* 1399 1.366211 */
+	-75, /* 1400 1.367188 */
+	-75, /* 1401 1.368164 */
+	-75, /* 1402 1.369141 */
+	-75, /* 1403 1.370117 */
+	-75, /* 1404 1.371094 */
+	-75, /* 1405 1.372070 */
+	-75, /* 1406 1.373047 */
+	-75, /* 1407 1.374023 */
+	-75, /* 1408 1.375000 */
+	-75, /* 1409 1.375977 */
+	-75, /* 1410 1.376953 */
+	-75, /* 1411 1.377930 */
+	-75, /* 1412 1.378906 */
+	-75, /* 1413 1.379883 */
+	-75, /* 1414 1.380859 */
+	-75, /* 1415 1.381836 */
+	-75, /* 1416 1.382812 */
+	-75, /* 1417 1.383789 */
+	-75, /* 1418 1.384766 */
+	-75, /* 1419 1.385742 */
+	-74, /* 1420 1.386719 */
+	-74, /* 1421 1.387695 */
+	-74, /* 1422 1.388672 */
+	-74, /* 1423 1.389648 */
+	-74, /* 1424 1.390625 */
+	-74, /* 1425 1.391602 */
+	-74, /* 1426 1.392578 */
+	-74, /* 1427 1.393555 */
+	-74, /* 1428 1.394531 */
+	-74, /* 1429 1.395508 */
+	-74, /* 1430 1.396484 */
+	-74, /* 1431 1.397461 */
+	-74, /* 1432 1.398438 */
+	-74, /* 1433 1.399414 */
+	-74, /* 1434 1.400391 */
+	-74, /* 1435 1.401367 */
+	-74, /* 1436 1.402344 */
+	-74, /* 1437 1.403320 */
+	-73, /* 1438 1.404297 */
+	-73, /* 1439 1.405273 */
+	-73, /* 1440 1.406250 */
+	-73, /* 1441 1.407227 */
+	-73, /* 1442 1.408203 */
+	-73, /* 1443 1.409180 */
+	-73, /* 1444 1.410156 */
+	-73, /* 1445 1.411133 */
+	-73, /* 1446 1.412109 */
+	-73, /* 1447 1.413086 */
+	-73, /* 1448 1.414062 */
+	-73, /* 1449 1.415039 */
+	-73, /* 1450 1.416016 */
+	-73, /* 1451 1.416992 */
+	-72, /* 1452 1.417969 */
+	-72, /* 1453 1.418945 */
+	-72, /* 1454 1.419922 */
+	-72, /* 1455 1.420898 */
+	-72, /* 1456 1.421875 */
+	-72, /* 1457 1.422852 */
+	-72, /* 1458 1.423828 */
+	-72, /* 1459 1.424805 */
+	-72, /* 1460 1.425781 */
+	-72, /* 1461 1.426758 */
+	-72, /* 1462 1.427734 */
+	-72, /* 1463 1.428711 */
+	-72, /* 1464 1.429688 */
+	-71, /* 1465 1.430664 */
+	-71, /* 1466 1.431641 */
+	-71, /* 1467 1.432617 */
+	-71, /* 1468 1.433594 */
+	-71, /* 1469 1.434570 */
+	-71, /* 1470 1.435547 */
+	-71, /* 1471 1.436523 */
+	-71, /* 1472 1.437500 */
+	-71, /* 1473 1.438477 */
+	-71, /* 1474 1.439453 */
+	-71, /* 1475 1.440430 */
+	-71, /* 1476 1.441406 */
+	-70, /* 1477 1.442383 */
+	-70, /* 1478 1.443359 */
+	-70, /* 1479 1.444336 */
+	-70, /* 1480 1.445312 */
+	-70, /* 1481 1.446289 */
+	-70, /* 1482 1.447266 */
+	-70, /* 1483 1.448242 */
+	-70, /* 1484 1.449219 */
+	-70, /* 1485 1.450195 */
+	-70, /* 1486 1.451172 */
+	-69, /* 1487 1.452148 */
+	-69, /* 1488 1.453125 */
+	-69, /* 1489 1.454102 */
+	-69, /* 1490 1.455078 */
+	-69, /* 1491 1.456055 */
+	-69, /* 1492 1.457031 */
+	-69, /* 1493 1.458008 */
+	-69, /* 1494 1.458984 */
+	-69, /* 1495 1.459961 */
+	-69, /* 1496 1.460938 */
+	-68, /* 1497 1.461914 */
+	-68, /* 1498 1.462891 */
+	-68, /* 1499 1.463867 */
+	-68, /* 1500 1.464844 */
+	-68, /* 1501 1.465820 */
+	-68, /* 1502 1.466797 */
+	-68, /* 1503 1.467773 */
+	-68, /* 1504 1.468750 */
+	-68, /* 1505 1.469727 */
+	-68, /* 1506 1.470703 */
+	-67, /* 1507 1.471680 */
+	-67, /* 1508 1.472656 */
+	-67, /* 1509 1.473633 */
+	-67, /* 1510 1.474609 */
+	-67, /* 1511 1.475586 */
+	-67, /* 1512 1.476562 */
+	-67, /* 1513 1.477539 */
+	-67, /* 1514 1.478516 */
+	-67, /* 1515 1.479492 */
+	-66, /* 1516 1.480469 */
+	-66, /* 1517 1.481445 */
+	-66, /* 1518 1.482422 */
+	-66, /* 1519 1.483398 */
+	-66, /* 1520 1.484375 */
+	-66, /* 1521 1.485352 */
+	-66, /* 1522 1.486328 */
+	-66, /* 1523 1.487305 */
+	-65, /* 1524 1.488281 */
+	-65, /* 1525 1.489258 */
+	-65, /* 1526 1.490234 */
+	-65, /* 1527 1.491211 */
+	-65, /* 1528 1.492188 */
+	-65, /* 1529 1.493164 */
+	-65, /* 1530 1.494141 */
+	-65, /* 1531 1.495117 */
+	-64, /* 1532 1.496094 */
+	-64, /* 1533 1.497070 */
+	-64, /* 1534 1.498047 */
+	-64, /* 1535 1.499023 */
+	-64, /* 1536 1.500000 */
+	-64, /* 1537 1.500977 */
+	-64, /* 1538 1.501953 */
+	-64, /* 1539 1.502930 */
+	-63, /* 1540 1.503906 */
+	-63, /* 1541 1.504883 */
+	-63, /* 1542 1.505859 */
+	-63, /* 1543 1.506836 */
+	-63, /* 1544 1.507812 */
+	-63, /* 1545 1.508789 */
+	-63, /* 1546 1.509766 */
+	-63, /* 1547 1.510742 */
+	-62, /* 1548 1.511719 */
+	-62, /* 1549 1.512695 */
+	-62, /* 1550 1.513672 */
+	-62, /* 1551 1.514648 */
+	-62, /* 1552 1.515625 */
+	-62, /* 1553 1.516602 */
+	-62, /* 1554 1.517578 */
+	-62, /* 1555 1.518555 */
+	-61, /* 1556 1.519531 */
+	-61, /* 1557 1.520508 */
+	-61, /* 1558 1.521484 */
+	-61, /* 1559 1.522461 */
+	-61, /* 1560 1.523438 */
+	-61, /* 1561 1.524414 */
+	-61, /* 1562 1.525391 */
+	-60, /* 1563 1.526367 */
+	-60, /* 1564 1.527344 */
+	-60, /* 1565 1.528320 */
+	-60, /* 1566 1.529297 */
+	-60, /* 1567 1.530273 */
+	-60, /* 1568 1.531250 */
+	-60, /* 1569 1.532227 */
+	-59, /* 1570 1.533203 */
+	-59, /* 1571 1.534180 */
+	-59, /* 1572 1.535156 */
+	-59, /* 1573 1.536133 */
+	-59, /* 1574 1.537109 */
+	-59, /* 1575 1.538086 */
+	-59, /* 1576 1.539062 */
+	-58, /* 1577 1.540039 */
+	-58, /* 1578 1.541016 */
+	-58, /* 1579 1.541992 */
+	-58, /* 1580 1.542969 */
+	-58, /* 1581 1.543945 */
+	-58, /* 1582 1.544922 */
+	-58, /* 1583 1.545898 */
+	-57, /* 1584 1.546875 */
+	-57, /* 1585 1.547852 */
+	-57, /* 1586 1.548828 */
+	-57, /* 1587 1.549805 */
+	-57, /* 1588 1.550781 */
+	-57, /* 1589 1.551758 */
+	-57, /* 1590 1.552734 */
+	-56, /* 1591 1.553711 */
+	-56, /* 1592 1.554688 */
+	-56, /* 1593 1.555664 */
+	-56, /* 1594 1.556641 */
+	-56, /* 1595 1.557617 */
+	-56, /* 1596 1.558594 */
+	-56, /* 1597 1.559570 */
+	-55, /* 1598 1.560547 */
+	-55, /* 1599 1.561523 */
+	-55, /* 1600 1.562500 */
+	-55, /* 1601 1.563477 */
+	-55, /* 1602 1.564453 */
+	-55, /* 1603 1.565430 */
+	-55, /* 1604 1.566406 */
+	-54, /* 1605 1.567383 */
+	-54, /* 1606 1.568359 */
+	-54, /* 1607 1.569336 */
+	-54, /* 1608 1.570312 */
+	-54, /* 1609 1.571289 */
+	-54, /* 1610 1.572266 */
+	-53, /* 1611 1.573242 */
+	-53, /* 1612 1.574219 */
+	-53, /* 1613 1.575195 */
+	-53, /* 1614 1.576172 */
+	-53, /* 1615 1.577148 */
+	-53, /* 1616 1.578125 */
+	-53, /* 1617 1.579102 */
+	-52, /* 1618 1.580078 */
+	-52, /* 1619 1.581055 */
+	-52, /* 1620 1.582031 */
+	-52, /* 1621 1.583008 */
+	-52, /* 1622 1.583984 */
+	-52, /* 1623 1.584961 */
+	-51, /* 1624 1.585938 */
+	-51, /* 1625 1.586914 */
+	-51, /* 1626 1.587891 */
+	-51, /* 1627 1.588867 */
+	-51, /* 1628 1.589844 */
+	-51, /* 1629 1.590820 */
+	-50, /* 1630 1.591797 */
+	-50, /* 1631 1.592773 */
+	-50, /* 1632 1.593750 */
+	-50, /* 1633 1.594727 */
+	-50, /* 1634 1.595703 */
+	-50, /* 1635 1.596680 */
+	-50, /* 1636 1.597656 */
+	-49, /* 1637 1.598633 */
+	-49, /* 1638 1.599609 */
+	-49, /* 1639 1.600586 */
+	-49, /* 1640 1.601562 */
+	-49, /* 1641 1.602539 */
+	-49, /* 1642 1.603516 */
+	-48, /* 1643 1.604492 */
+	-48, /* 1644 1.605469 */
+	-48, /* 1645 1.606445 */
+	-48, /* 1646 1.607422 */
+	-48, /* 1647 1.608398 */
+	-48, /* 1648 1.609375 */
+	-47, /* 1649 1.610352 */
+	-47, /* 1650 1.611328 */
+	-47, /* 1651 1.612305 */
+	-47, /* 1652 1.613281 */
+	-47, /* 1653 1.614258 */
+	-47, /* 1654 1.615234 */
+	-46, /* 1655 1.616211 */
+	-46, /* 1656 1.617188 */
+	-46, /* 1657 1.618164 */
+	-46, /* 1658 1.619141 */
+	-46, /* 1659 1.620117 */
+	-46, /* 1660 1.621094 */
+	-45, /* 1661 1.622070 */
+	-45, /* 1662 1.623047 */
+	-45, /* 1663 1.624023 */
+	-45, /* 1664 1.625000 */
+	-45, /* 1665 1.625977 */
+	-45, /* 1666 1.626953 */
+	-45, /* 1667 1.627930 */
+	-44, /* 1668 1.628906 */
+	-44, /* 1669 1.629883 */
+	-44, /* 1670 1.630859 */
+	-44, /* 1671 1.631836 */
+	-44, /* 1672 1.632812 */
+	-44, /* 1673 1.633789 */
+	-43, /* 1674 1.634766 */
+	-43, /* 1675 1.635742 */
+	-43, /* 1676 1.636719 */
+	-43, /* 1677 1.637695 */
+	-43, /* 1678 1.638672 */
+	-43, /* 1679 1.639648 */
+	-42, /* 1680 1.640625 */
+	-42, /* 1681 1.641602 */
+	-42, /* 1682 1.642578 */
+	-42, /* 1683 1.643555 */
+	-42, /* 1684 1.644531 */
+	-42, /* 1685 1.645508 */
+	-41, /* 1686 1.646484 */
+	-41, /* 1687 1.647461 */
+	-41, /* 1688 1.648438 */
+	-41, /* 1689 1.649414 */
+	-41, /* 1690 1.650391 */
+	-41, /* 1691 1.651367 */
+	-40, /* 1692 1.652344 */
+	-40, /* 1693 1.653320 */
+	-40, /* 1694 1.654297 */
+	-40, /* 1695 1.655273 */
+	-40, /* 1696 1.656250 */
+	-40, /* 1697 1.657227 */
+	-39, /* 1698 1.658203 */
+	-39, /* 1699 1.659180 */
+	-39, /* 1700 1.660156 */
+	-39, /* 1701 1.661133 */
+	-39, /* 1702 1.662109 */
+	-39, /* 1703 1.663086 */
+	-38, /* 1704 1.664062 */
+	-38, /* 1705 1.665039 */
+	-38, /* 1706 1.666016 */
+	-38, /* 1707 1.666992 */
+	-38, /* 1708 1.667969 */
+	-38, /* 1709 1.668945 */
+	-37, /* 1710 1.669922 */
+	-37, /* 1711 1.670898 */
+	-37, /* 1712 1.671875 */
+	-37, /* 1713 1.672852 */
+	-37, /* 1714 1.673828 */
+	-37, /* 1715 1.674805 */
+	-36, /* 1716 1.675781 */
+	-36, /* 1717 1.676758 */
+	-36, /* 1718 1.677734 */
+	-36, /* 1719 1.678711 */
+	-36, /* 1720 1.679688 */
+	-36, /* 1721 1.680664 */
+	-35, /* 1722 1.681641 */
+	-35, /* 1723 1.682617 */
+	-35, /* 1724 1.683594 */
+	-35, /* 1725 1.684570 */
+	-35, /* 1726 1.685547 */
+	-35, /* 1727 1.686523 */
+	-34, /* 1728 1.687500 */
+	-34, /* 1729 1.688477 */
+	-34, /* 1730 1.689453 */
+	-34, /* 1731 1.690430 */
+	-34, /* 1732 1.691406 */
+	-34, /* 1733 1.692383 */
+	-33, /* 1734 1.693359 */
+	-33, /* 1735 1.694336 */
+	-33, /* 1736 1.695312 */
+	-33, /* 1737 1.696289 */
+	-33, /* 1738 1.697266 */
+	-33, /* 1739 1.698242 */
+	-32, /* 1740 1.699219 */
+	-32, /* 1741 1.700195 */
+	-32, /* 1742 1.701172 */
+	-32, /* 1743 1.702148 */
+	-32, /* 1744 1.703125 */
+	-32, /* 1745 1.704102 */
+	-31, /* 1746 1.705078 */
+	-31, /* 1747 1.706055 */
+	-31, /* 1748 1.707031 */
+	-31, /* 1749 1.708008 */
+	-31, /* 1750 1.708984 */
+	-31, /* 1751 1.709961 */
+	-30, /* 1752 1.710938 */
+	-30, /* 1753 1.711914 */
+	-30, /* 1754 1.712891 */
+	-30, /* 1755 1.713867 */
+	-30, /* 1756 1.714844 */
+	-30, /* 1757 1.715820 */
+	-29, /* 1758 1.716797 */
+	-29, /* 1759 1.717773 */
+	-29, /* 1760 1.718750 */
+	-29, /* 1761 1.719727 */
+	-29, /* 1762 1.720703 */
+	-29, /* 1763 1.721680 */
+	-28, /* 1764 1.722656 */
+	-28, /* 1765 1.723633 */
+	-28, /* 1766 1.724609 */
+	-28, /* 1767 1.725586 */
+	-28, /* 1768 1.726562 */
+	-28, /* 1769 1.727539 */
+	-27, /* 1770 1.728516 */
+	-27, /* 1771 1.729492 */
+	-27, /* 1772 1.730469 */
+	-27, /* 1773 1.731445 */
+	-27, /* 1774 1.732422 */
+	-27, /* 1775 1.733398 */
+	-27, /* 1776 1.734375 */
+	-26, /* 1777 1.735352 */
+	-26, /* 1778 1.736328 */
+	-26, /* 1779 1.737305 */
+	-26, /* 1780 1.738281 */
+	-26, /* 1781 1.739258 */
+	-26, /* 1782 1.740234 */
+	-25, /* 1783 1.741211 */
+	-25, /* 1784 1.742188 */
+	-25, /* 1785 1.743164 */
+	-25, /* 1786 1.744141 */
+	-25, /* 1787 1.745117 */
+	-25, /* 1788 1.746094 */
+	-24, /* 1789 1.747070 */
+	-24, /* 1790 1.748047 */
+	-24, /* 1791 1.749023 */
+	-24, /* 1792 1.750000 */
+	-24, /* 1793 1.750977 */
+	-24, /* 1794 1.751953 */
+	-24, /* 1795 1.752930 */
+	-23, /* 1796 1.753906 */
+	-23, /* 1797 1.754883 */
+	-23, /* 1798 1.755859 */
+	-23, /* 1799 1.756836 */
+	-23, /* 1800 1.757812 */
+	-23, /* 1801 1.758789 */
+	-22, /* 1802 1.759766 */
+	-22, /* 1803 1.760742 */
+	-22, /* 1804 1.761719 */
+	-22, /* 1805 1.762695 */
+	-22, /* 1806 1.763672 */
+	-22, /* 1807 1.764648 */
+	-22, /* 1808 1.765625 */
+	-21, /* 1809 1.766602 */
+	-21, /* 1810 1.767578 */
+	-21, /* 1811 1.768555 */
+	-21, /* 1812 1.769531 */
+	-21, /* 1813 1.770508 */
+	-21, /* 1814 1.771484 */
+	-20, /* 1815 1.772461 */
+	-20, /* 1816 1.773438 */
+	-20, /* 1817 1.774414 */
+	-20, /* 1818 1.775391 */
+	-20, /* 1819 1.776367 */
+	-20, /* 1820 1.777344 */
+	-20, /* 1821 1.778320 */
+	-19, /* 1822 1.779297 */
+	-19, /* 1823 1.780273 */
+	-19, /* 1824 1.781250 */
+	-19, /* 1825 1.782227 */
+	-19, /* 1826 1.783203 */
+	-19, /* 1827 1.784180 */
+	-19, /* 1828 1.785156 */
+	-18, /* 1829 1.786133 */
+	-18, /* 1830 1.787109 */
+	-18, /* 1831 1.788086 */
+	-18, /* 1832 1.789062 */
+	-18, /* 1833 1.790039 */
+	-18, /* 1834 1.791016 */
+	-18, /* 1835 1.791992 */
+	-17, /* 1836 1.792969 */
+	-17, /* 1837 1.793945 */
+	-17, /* 1838 1.794922 */
+	-17, /* 1839 1.795898 */
+	-17, /* 1840 1.796875 */
+	-17, /* 1841 1.797852 */
+	-17, /* 1842 1.798828 */
+	-16, /* 1843 1.799805 */
+	-16, /* 1844 1.800781 */
+	-16, /* 1845 1.801758 */
+	-16, /* 1846 1.802734 */
+	-16, /* 1847 1.803711 */
+	-16, /* 1848 1.804688 */
+	-16, /* 1849 1.805664 */
+	-15, /* 1850 1.806641 */
+	-15, /* 1851 1.807617 */
+	-15, /* 1852 1.808594 */
+	-15, /* 1853 1.809570 */
+	-15, /* 1854 1.810547 */
+	-15, /* 1855 1.811523 */
+	-15, /* 1856 1.812500 */
+	-14, /* 1857 1.813477 */
+	-14, /* 1858 1.814453 */
+	-14, /* 1859 1.815430 */
+	-14, /* 1860 1.816406 */
+	-14, /* 1861 1.817383 */
+	-14, /* 1862 1.818359 */
+	-14, /* 1863 1.819336 */
+	-14, /* 1864 1.820312 */
+	-13, /* 1865 1.821289 */
+	-13, /* 1866 1.822266 */
+	-13, /* 1867 1.823242 */
+	-13, /* 1868 1.824219 */
+	-13, /* 1869 1.825195 */
+	-13, /* 1870 1.826172 */
+	-13, /* 1871 1.827148 */
+	-13, /* 1872 1.828125 */
+	-12, /* 1873 1.829102 */
+	-12, /* 1874 1.830078 */
+	-12, /* 1875 1.831055 */
+	-12, /* 1876 1.832031 */
+	-12, /* 1877 1.833008 */
+	-12, /* 1878 1.833984 */
+	-12, /* 1879 1.834961 */
+	-12, /* 1880 1.835938 */
+	-11, /* 1881 1.836914 */
+	-11, /* 1882 1.837891 */
+	-11, /* 1883 1.838867 */
+	-11, /* 1884 1.839844 */
+	-11, /* 1885 1.840820 */
+	-11, /* 1886 1.841797 */
+	-11, /* 1887 1.842773 */
+	-11, /* 1888 1.843750 */
+	-10, /* 1889 1.844727 */
+	-10, /* 1890 1.845703 */
+	-10, /* 1891 1.846680 */
+	-10, /* 1892 1.847656 */
+	-10, /* 1893 1.848633 */
+	-10, /* 1894 1.849609 */
+	-10, /* 1895 1.850586 */
+	-10, /* 1896 1.851562 */
+	-9, /* 1897 1.852539 */
+	-9, /* 1898 1.853516 */
+	-9, /* 1899 1.854492 */
+	-9, /* 1900 1.855469 */
+	-9, /* 1901 1.856445 */
+	-9, /* 1902 1.857422 */
+	-9, /* 1903 1.858398 */
+	-9, /* 1904 1.859375 */
+	-9, /* 1905 1.860352 */
+	-8, /* 1906 1.861328 */
+	-8, /* 1907 1.862305 */
+	-8, /* 1908 1.863281 */
+	-8, /* 1909 1.864258 */
+	-8, /* 1910 1.865234 */
+	-8, /* 1911 1.866211 */
+	-8, /* 1912 1.867188 */
+	-8, /* 1913 1.868164 */
+	-8, /* 1914 1.869141 */
+	-8, /* 1915 1.870117 */
+	-7, /* 1916 1.871094 */
+	-7, /* 1917 1.872070 */
+	-7, /* 1918 1.873047 */
+	-7, /* 1919 1.874023 */
+	-7, /* 1920 1.875000 */
+	-7, /* 1921 1.875977 */
+	-7, /* 1922 1.876953 */
+	-7, /* 1923 1.877930 */
+	-7, /* 1924 1.878906 */
+	-6, /* 1925 1.879883 */
+	-6, /* 1926 1.880859 */
+	-6, /* 1927 1.881836 */
+	-6, /* 1928 1.882812 */
+	-6, /* 1929 1.883789 */
+	-6, /* 1930 1.884766 */
+	-6, /* 1931 1.885742 */
+	-6, /* 1932 1.886719 */
+	-6, /* 1933 1.887695 */
+	-6, /* 1934 1.888672 */
+	-6, /* 1935 1.889648 */
+	-5, /* 1936 1.890625 */
+	-5, /* 1937 1.891602 */
+	-5, /* 1938 1.892578 */
+	-5, /* 1939 1.893555 */
+	-5, /* 1940 1.894531 */
+	-5, /* 1941 1.895508 */
+	-5, /* 1942 1.896484 */
+	-5, /* 1943 1.897461 */
+	-5, /* 1944 1.898438 */
+	-5, /* 1945 1.899414 */
+	-5, /* 1946 1.900391 */
+	-4, /* 1947 1.901367 */
+	-4, /* 1948 1.902344 */
+	-4, /* 1949 1.903320 */
+	-4, /* 1950 1.904297 */
+	-4, /* 1951 1.905273 */
+	-4, /* 1952 1.906250 */
+	-4, /* 1953 1.907227 */
+	-4, /* 1954 1.908203 */
+	-4, /* 1955 1.909180 */
+	-4, /* 1956 1.910156 */
+	-4, /* 1957 1.911133 */
+	-4, /* 1958 1.912109 */
+	-4, /* 1959 1.913086 */
+	-3, /* 1960 1.914062 */
+	-3, /* 1961 1.915039 */
+	-3, /* 1962 1.916016 */
+	-3, /* 1963 1.916992 */
+	-3, /* 1964 1.917969 */
+	-3, /* 1965 1.918945 */
+	-3, /* 1966 1.919922 */
+	-3, /* 1967 1.920898 */
+	-3, /* 1968 1.921875 */
+	-3, /* 1969 1.922852 */
+	-3, /* 1970 1.923828 */
+	-3, /* 1971 1.924805 */
+	-3, /* 1972 1.925781 */
+	-3, /* 1973 1.926758 */
+	-2, /* 1974 1.927734 */
+	-2, /* 1975 1.928711 */
+	-2, /* 1976 1.929688 */
+	-2, /* 1977 1.930664 */
+	-2, /* 1978 1.931641 */
+	-2, /* 1979 1.932617 */
+	-2, /* 1980 1.933594 */
+	-2, /* 1981 1.934570 */
+	-2, /* 1982 1.935547 */
+	-2, /* 1983 1.936523 */
+	-2, /* 1984 1.937500 */
+	-2, /* 1985 1.938477 */
+	-2, /* 1986 1.939453 */
+	-2, /* 1987 1.940430 */
+	-2, /* 1988 1.941406 */
+	-2, /* 1989 1.942383 */
+	-2, /* 1990 1.943359 */
+	-1, /* 1991 1.944336 */
+	-1, /* 1992 1.945312 */
+	-1, /* 1993 1.946289 */
+	-1, /* 1994 1.947266 */
+	-1, /* 1995 1.948242 */
+	-1, /* 1996 1.949219 */
+	-1, /* 1997 1.950195 */
+	-1, /* 1998 1.951172 */
+	-1, /* 1999 1.952148 */
+	-1, /* 2000 1.953125 */
+	-1, /* 2001 1.954102 */
+	-1, /* 2002 1.955078 */
+	-1, /* 2003 1.956055 */
+	-1, /* 2004 1.957031 */
+	-1, /* 2005 1.958008 */
+	-1, /* 2006 1.958984 */
+	-1, /* 2007 1.959961 */
+	-1, /* 2008 1.960938 */
+	-1, /* 2009 1.961914 */
+	-1, /* 2010 1.962891 */
+	-1, /* 2011 1.963867 */
+	-1, /* 2012 1.964844 */
+	-1, /* 2013 1.965820 */
+	-1, /* 2014 1.966797 */
+	-1, /* 2015 1.967773 */
+	0, /* 2016 1.968750 */
+	0, /* 2017 1.969727 */
+	0, /* 2018 1.970703 */
+	0, /* 2019 1.971680 */
+	0, /* 2020 1.972656 */
+	0, /* 2021 1.973633 */
+	0, /* 2022 1.974609 */
+	0, /* 2023 1.975586 */
+	0, /* 2024 1.976562 */
+	0, /* 2025 1.977539 */
+	0, /* 2026 1.978516 */
+	0, /* 2027 1.979492 */
+	0, /* 2028 1.980469 */
+	0, /* 2029 1.981445 */
+	0, /* 2030 1.982422 */
+	0, /* 2031 1.983398 */
+	0, /* 2032 1.984375 */
+	0, /* 2033 1.985352 */
+	0, /* 2034 1.986328 */
+	0, /* 2035 1.987305 */
+	0, /* 2036 1.988281 */
+	0, /* 2037 1.989258 */
+	0, /* 2038 1.990234 */
+	0, /* 2039 1.991211 */
+	0, /* 2040 1.992188 */
+	0, /* 2041 1.993164 */
+	0, /* 2042 1.994141 */
+	0, /* 2043 1.995117 */
+	0, /* 2044 1.996094 */
+	0, /* 2045 1.997070 */
+	0, /* 2046 1.998047 */
+};
@@ -0,0 +1,5456 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_dither.gen.c
+ *
+ * GENERATED on 2026 10 19 15:08:16 from gp_dither.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Floyd Steinberg dithering -> any pixel
+ *
+ * Copyright (C) 2009-2023 Cyril Hrubis <metan@ucw.cz>
+ */
+#include <string.h>
+#include <errno.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_convert.h>
+#include <core/gp_clamp.h>
+#include <filters/gp_filter.h>
+#include <filters/gp_dither.gen.h>
+
+/*
+ * Floyd Steinberg to RGB101010
+ */
+static int floyd_steinberg_to_RGB101010_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB101010),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 1023 * val_R / 255;
+			err_R -= res_R * 255 / 1023;
+
+			errors_R[y%2][x+2] += 7 * err_R;
+			errors_R[!(y%2)][x] += 3 * err_R;
+			errors_R[!(y%2)][x+1] += 5 * err_R;
+			errors_R[!(y%2)][x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 1023);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 1023 * val_G / 255;
+			err_G -= res_G * 255 / 1023;
+
+			errors_G[y%2][x+2] += 7 * err_G;
+			errors_G[!(y%2)][x] += 3 * err_G;
+			errors_G[!(y%2)][x+1] += 5 * err_G;
+			errors_G[!(y%2)][x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 1023);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 1023 * val_B / 255;
+			err_B -= res_B * 255 / 1023;
+
+			errors_B[y%2][x+2] += 7 * err_B;
+			errors_B[!(y%2)][x] += 3 * err_B;
+			errors_B[!(y%2)][x+1] += 5 * err_B;
+			errors_B[!(y%2)][x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 1023);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to xRGB8888
+ */
+static int floyd_steinberg_to_xRGB8888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_xRGB8888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			errors_R[y%2][x+2] += 7 * err_R;
+			errors_R[!(y%2)][x] += 3 * err_R;
+			errors_R[!(y%2)][x+1] += 5 * err_R;
+			errors_R[!(y%2)][x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			errors_G[y%2][x+2] += 7 * err_G;
+			errors_G[!(y%2)][x] += 3 * err_G;
+			errors_G[!(y%2)][x+1] += 5 * err_G;
+			errors_G[!(y%2)][x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			errors_B[y%2][x+2] += 7 * err_B;
+			errors_B[!(y%2)][x] += 3 * err_B;
+			errors_B[!(y%2)][x+1] += 5 * err_B;
+			errors_B[!(y%2)][x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to RGB888
+ */
+static int floyd_steinberg_to_RGB888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			errors_R[y%2][x+2] += 7 * err_R;
+			errors_R[!(y%2)][x] += 3 * err_R;
+			errors_R[!(y%2)][x+1] += 5 * err_R;
+			errors_R[!(y%2)][x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			errors_G[y%2][x+2] += 7 * err_G;
+			errors_G[!(y%2)][x] += 3 * err_G;
+			errors_G[!(y%2)][x+1] += 5 * err_G;
+			errors_G[!(y%2)][x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			errors_B[y%2][x+2] += 7 * err_B;
+			errors_B[!(y%2)][x] += 3 * err_B;
+			errors_B[!(y%2)][x+1] += 5 * err_B;
+			errors_B[!(y%2)][x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to BGR888
+ */
+static int floyd_steinberg_to_BGR888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_B[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_BGR888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			errors_B[y%2][x+2] += 7 * err_B;
+			errors_B[!(y%2)][x] += 3 * err_B;
+			errors_B[!(y%2)][x+1] += 5 * err_B;
+			errors_B[!(y%2)][x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			errors_G[y%2][x+2] += 7 * err_G;
+			errors_G[!(y%2)][x] += 3 * err_G;
+			errors_G[!(y%2)][x+1] += 5 * err_G;
+			errors_G[!(y%2)][x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			errors_R[y%2][x+2] += 7 * err_R;
+			errors_R[!(y%2)][x] += 3 * err_R;
+			errors_R[!(y%2)][x+1] += 5 * err_R;
+			errors_R[!(y%2)][x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to RGB555
+ */
+static int floyd_steinberg_to_RGB555_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB555),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			errors_R[y%2][x+2] += 7 * err_R;
+			errors_R[!(y%2)][x] += 3 * err_R;
+			errors_R[!(y%2)][x+1] += 5 * err_R;
+			errors_R[!(y%2)][x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 31 * val_G / 255;
+			err_G -= res_G * 255 / 31;
+
+			errors_G[y%2][x+2] += 7 * err_G;
+			errors_G[!(y%2)][x] += 3 * err_G;
+			errors_G[!(y%2)][x+1] += 5 * err_G;
+			errors_G[!(y%2)][x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 31);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			errors_B[y%2][x+2] += 7 * err_B;
+			errors_B[!(y%2)][x] += 3 * err_B;
+			errors_B[!(y%2)][x+1] += 5 * err_B;
+			errors_B[!(y%2)][x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to RGB565
+ */
+static int floyd_steinberg_to_RGB565_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			errors_R[y%2][x+2] += 7 * err_R;
+			errors_R[!(y%2)][x] += 3 * err_R;
+			errors_R[!(y%2)][x+1] += 5 * err_R;
+			errors_R[!(y%2)][x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			errors_G[y%2][x+2] += 7 * err_G;
+			errors_G[!(y%2)][x] += 3 * err_G;
+			errors_G[!(y%2)][x+1] += 5 * err_G;
+			errors_G[!(y%2)][x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			errors_B[y%2][x+2] += 7 * err_B;
+			errors_B[!(y%2)][x] += 3 * err_B;
+			errors_B[!(y%2)][x+1] += 5 * err_B;
+			errors_B[!(y%2)][x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to RGB666
+ */
+static int floyd_steinberg_to_RGB666_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB666),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 63 * val_R / 255;
+			err_R -= res_R * 255 / 63;
+
+			errors_R[y%2][x+2] += 7 * err_R;
+			errors_R[!(y%2)][x] += 3 * err_R;
+			errors_R[!(y%2)][x+1] += 5 * err_R;
+			errors_R[!(y%2)][x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 63);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			errors_G[y%2][x+2] += 7 * err_G;
+			errors_G[!(y%2)][x] += 3 * err_G;
+			errors_G[!(y%2)][x+1] += 5 * err_G;
+			errors_G[!(y%2)][x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 63 * val_B / 255;
+			err_B -= res_B * 255 / 63;
+
+			errors_B[y%2][x+2] += 7 * err_B;
+			errors_B[!(y%2)][x] += 3 * err_B;
+			errors_B[!(y%2)][x+1] += 5 * err_B;
+			errors_B[!(y%2)][x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 63);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to RGB332
+ */
+static int floyd_steinberg_to_RGB332_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB332),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 7 * val_R / 255;
+			err_R -= res_R * 255 / 7;
+
+			errors_R[y%2][x+2] += 7 * err_R;
+			errors_R[!(y%2)][x] += 3 * err_R;
+			errors_R[!(y%2)][x+1] += 5 * err_R;
+			errors_R[!(y%2)][x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 7);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 7 * val_G / 255;
+			err_G -= res_G * 255 / 7;
+
+			errors_G[y%2][x+2] += 7 * err_G;
+			errors_G[!(y%2)][x] += 3 * err_G;
+			errors_G[!(y%2)][x+1] += 5 * err_G;
+			errors_G[!(y%2)][x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 7);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 3 * val_B / 255;
+			err_B -= res_B * 255 / 3;
+
+			errors_B[y%2][x+2] += 7 * err_B;
+			errors_B[!(y%2)][x] += 3 * err_B;
+			errors_B[!(y%2)][x+1] += 5 * err_B;
+			errors_B[!(y%2)][x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 3);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to G1_DB
+ */
+static int floyd_steinberg_to_G1_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			errors_V[y%2][x+2] += 7 * err_V;
+			errors_V[!(y%2)][x] += 3 * err_V;
+			errors_V[!(y%2)][x+1] += 5 * err_V;
+			errors_V[!(y%2)][x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to G2_DB
+ */
+static int floyd_steinberg_to_G2_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			errors_V[y%2][x+2] += 7 * err_V;
+			errors_V[!(y%2)][x] += 3 * err_V;
+			errors_V[!(y%2)][x+1] += 5 * err_V;
+			errors_V[!(y%2)][x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to G4_DB
+ */
+static int floyd_steinberg_to_G4_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			errors_V[y%2][x+2] += 7 * err_V;
+			errors_V[!(y%2)][x] += 3 * err_V;
+			errors_V[!(y%2)][x+1] += 5 * err_V;
+			errors_V[!(y%2)][x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to G1_UB
+ */
+static int floyd_steinberg_to_G1_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			errors_V[y%2][x+2] += 7 * err_V;
+			errors_V[!(y%2)][x] += 3 * err_V;
+			errors_V[!(y%2)][x+1] += 5 * err_V;
+			errors_V[!(y%2)][x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to G2_UB
+ */
+static int floyd_steinberg_to_G2_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			errors_V[y%2][x+2] += 7 * err_V;
+			errors_V[!(y%2)][x] += 3 * err_V;
+			errors_V[!(y%2)][x+1] += 5 * err_V;
+			errors_V[!(y%2)][x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to G4_UB
+ */
+static int floyd_steinberg_to_G4_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			errors_V[y%2][x+2] += 7 * err_V;
+			errors_V[!(y%2)][x] += 3 * err_V;
+			errors_V[!(y%2)][x+1] += 5 * err_V;
+			errors_V[!(y%2)][x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to G8
+ */
+static int floyd_steinberg_to_G8_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G8),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			errors_V[y%2][x+2] += 7 * err_V;
+			errors_V[!(y%2)][x] += 3 * err_V;
+			errors_V[!(y%2)][x+1] += 5 * err_V;
+			errors_V[!(y%2)][x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to GA88
+ */
+static int floyd_steinberg_to_GA88_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	uint32_t errors_A[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_A[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_A[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_GA88),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			errors_V[y%2][x+2] += 7 * err_V;
+			errors_V[!(y%2)][x] += 3 * err_V;
+			errors_V[!(y%2)][x+1] += 5 * err_V;
+			errors_V[!(y%2)][x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+			uint32_t val_A = gp_pixel_to_G8(pix, src->pixel_type);
+			val_A += errors_A[y % 2][x + 1] / 16;
+
+			uint32_t err_A = val_A;
+
+			gp_pixel res_A = 255 * val_A / 255;
+			err_A -= res_A * 255 / 255;
+
+			errors_A[y%2][x+2] += 7 * err_A;
+			errors_A[!(y%2)][x] += 3 * err_A;
+			errors_A[!(y%2)][x+1] += 5 * err_A;
+			errors_A[!(y%2)][x+2] += 1 * err_A;
+
+			GP_CLAMP_DOWN(res_A, 255);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_A[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to G16
+ */
+static int floyd_steinberg_to_G16_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G16),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 65535 * val_V / 255;
+			err_V -= res_V * 255 / 65535;
+
+			errors_V[y%2][x+2] += 7 * err_V;
+			errors_V[!(y%2)][x] += 3 * err_V;
+			errors_V[!(y%2)][x+1] += 5 * err_V;
+			errors_V[!(y%2)][x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 65535);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int floyd_steinberg(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return floyd_steinberg_to_RGB101010_raw(src, dst, callback);
+	case GP_PIXEL_xRGB8888:
+		return floyd_steinberg_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return floyd_steinberg_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return floyd_steinberg_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return floyd_steinberg_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565:
+		return floyd_steinberg_to_RGB565_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return floyd_steinberg_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return floyd_steinberg_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1_DB:
+		return floyd_steinberg_to_G1_DB_raw(src, dst, callback);
+	case GP_PIXEL_G2_DB:
+		return floyd_steinberg_to_G2_DB_raw(src, dst, callback);
+	case GP_PIXEL_G4_DB:
+		return floyd_steinberg_to_G4_DB_raw(src, dst, callback);
+	case GP_PIXEL_G1_UB:
+		return floyd_steinberg_to_G1_UB_raw(src, dst, callback);
+	case GP_PIXEL_G2_UB:
+		return floyd_steinberg_to_G2_UB_raw(src, dst, callback);
+	case GP_PIXEL_G4_UB:
+		return floyd_steinberg_to_G4_UB_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return floyd_steinberg_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return floyd_steinberg_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return floyd_steinberg_to_G16_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_floyd_steinberg(const gp_pixmap *src, gp_pixmap *dst,
+                              gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+	return floyd_steinberg(src, dst, callback);
+}
+
+/*
+ * Atkinson to RGB101010
+ */
+static int atkinson_to_RGB101010_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB101010),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 1023 * val_R / 255;
+			err_R -= res_R * 255 / 1023;
+
+			errors_R[y%3][x+2] += 1 * err_R;
+			errors_R[y%3][x+3] += 1 * err_R;
+			errors_R[(y+1)%3][x] += 1 * err_R;
+			errors_R[(y+1)%3][x+1] += 1 * err_R;
+			errors_R[(y+1)%3][x+2] += 1 * err_R;
+			errors_R[(y+2)%3][x+0] += 1 * err_R;
+			errors_R[(y+2)%3][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 1023);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 1023 * val_G / 255;
+			err_G -= res_G * 255 / 1023;
+
+			errors_G[y%3][x+2] += 1 * err_G;
+			errors_G[y%3][x+3] += 1 * err_G;
+			errors_G[(y+1)%3][x] += 1 * err_G;
+			errors_G[(y+1)%3][x+1] += 1 * err_G;
+			errors_G[(y+1)%3][x+2] += 1 * err_G;
+			errors_G[(y+2)%3][x+0] += 1 * err_G;
+			errors_G[(y+2)%3][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 1023);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 1023 * val_B / 255;
+			err_B -= res_B * 255 / 1023;
+
+			errors_B[y%3][x+2] += 1 * err_B;
+			errors_B[y%3][x+3] += 1 * err_B;
+			errors_B[(y+1)%3][x] += 1 * err_B;
+			errors_B[(y+1)%3][x+1] += 1 * err_B;
+			errors_B[(y+1)%3][x+2] += 1 * err_B;
+			errors_B[(y+2)%3][x+0] += 1 * err_B;
+			errors_B[(y+2)%3][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 1023);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to xRGB8888
+ */
+static int atkinson_to_xRGB8888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_xRGB8888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			errors_R[y%3][x+2] += 1 * err_R;
+			errors_R[y%3][x+3] += 1 * err_R;
+			errors_R[(y+1)%3][x] += 1 * err_R;
+			errors_R[(y+1)%3][x+1] += 1 * err_R;
+			errors_R[(y+1)%3][x+2] += 1 * err_R;
+			errors_R[(y+2)%3][x+0] += 1 * err_R;
+			errors_R[(y+2)%3][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			errors_G[y%3][x+2] += 1 * err_G;
+			errors_G[y%3][x+3] += 1 * err_G;
+			errors_G[(y+1)%3][x] += 1 * err_G;
+			errors_G[(y+1)%3][x+1] += 1 * err_G;
+			errors_G[(y+1)%3][x+2] += 1 * err_G;
+			errors_G[(y+2)%3][x+0] += 1 * err_G;
+			errors_G[(y+2)%3][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			errors_B[y%3][x+2] += 1 * err_B;
+			errors_B[y%3][x+3] += 1 * err_B;
+			errors_B[(y+1)%3][x] += 1 * err_B;
+			errors_B[(y+1)%3][x+1] += 1 * err_B;
+			errors_B[(y+1)%3][x+2] += 1 * err_B;
+			errors_B[(y+2)%3][x+0] += 1 * err_B;
+			errors_B[(y+2)%3][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to RGB888
+ */
+static int atkinson_to_RGB888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			errors_R[y%3][x+2] += 1 * err_R;
+			errors_R[y%3][x+3] += 1 * err_R;
+			errors_R[(y+1)%3][x] += 1 * err_R;
+			errors_R[(y+1)%3][x+1] += 1 * err_R;
+			errors_R[(y+1)%3][x+2] += 1 * err_R;
+			errors_R[(y+2)%3][x+0] += 1 * err_R;
+			errors_R[(y+2)%3][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			errors_G[y%3][x+2] += 1 * err_G;
+			errors_G[y%3][x+3] += 1 * err_G;
+			errors_G[(y+1)%3][x] += 1 * err_G;
+			errors_G[(y+1)%3][x+1] += 1 * err_G;
+			errors_G[(y+1)%3][x+2] += 1 * err_G;
+			errors_G[(y+2)%3][x+0] += 1 * err_G;
+			errors_G[(y+2)%3][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			errors_B[y%3][x+2] += 1 * err_B;
+			errors_B[y%3][x+3] += 1 * err_B;
+			errors_B[(y+1)%3][x] += 1 * err_B;
+			errors_B[(y+1)%3][x+1] += 1 * err_B;
+			errors_B[(y+1)%3][x+2] += 1 * err_B;
+			errors_B[(y+2)%3][x+0] += 1 * err_B;
+			errors_B[(y+2)%3][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to BGR888
+ */
+static int atkinson_to_BGR888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_B[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_BGR888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			errors_B[y%3][x+2] += 1 * err_B;
+			errors_B[y%3][x+3] += 1 * err_B;
+			errors_B[(y+1)%3][x] += 1 * err_B;
+			errors_B[(y+1)%3][x+1] += 1 * err_B;
+			errors_B[(y+1)%3][x+2] += 1 * err_B;
+			errors_B[(y+2)%3][x+0] += 1 * err_B;
+			errors_B[(y+2)%3][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			errors_G[y%3][x+2] += 1 * err_G;
+			errors_G[y%3][x+3] += 1 * err_G;
+			errors_G[(y+1)%3][x] += 1 * err_G;
+			errors_G[(y+1)%3][x+1] += 1 * err_G;
+			errors_G[(y+1)%3][x+2] += 1 * err_G;
+			errors_G[(y+2)%3][x+0] += 1 * err_G;
+			errors_G[(y+2)%3][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			errors_R[y%3][x+2] += 1 * err_R;
+			errors_R[y%3][x+3] += 1 * err_R;
+			errors_R[(y+1)%3][x] += 1 * err_R;
+			errors_R[(y+1)%3][x+1] += 1 * err_R;
+			errors_R[(y+1)%3][x+2] += 1 * err_R;
+			errors_R[(y+2)%3][x+0] += 1 * err_R;
+			errors_R[(y+2)%3][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to RGB555
+ */
+static int atkinson_to_RGB555_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB555),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			errors_R[y%3][x+2] += 1 * err_R;
+			errors_R[y%3][x+3] += 1 * err_R;
+			errors_R[(y+1)%3][x] += 1 * err_R;
+			errors_R[(y+1)%3][x+1] += 1 * err_R;
+			errors_R[(y+1)%3][x+2] += 1 * err_R;
+			errors_R[(y+2)%3][x+0] += 1 * err_R;
+			errors_R[(y+2)%3][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 31 * val_G / 255;
+			err_G -= res_G * 255 / 31;
+
+			errors_G[y%3][x+2] += 1 * err_G;
+			errors_G[y%3][x+3] += 1 * err_G;
+			errors_G[(y+1)%3][x] += 1 * err_G;
+			errors_G[(y+1)%3][x+1] += 1 * err_G;
+			errors_G[(y+1)%3][x+2] += 1 * err_G;
+			errors_G[(y+2)%3][x+0] += 1 * err_G;
+			errors_G[(y+2)%3][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 31);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			errors_B[y%3][x+2] += 1 * err_B;
+			errors_B[y%3][x+3] += 1 * err_B;
+			errors_B[(y+1)%3][x] += 1 * err_B;
+			errors_B[(y+1)%3][x+1] += 1 * err_B;
+			errors_B[(y+1)%3][x+2] += 1 * err_B;
+			errors_B[(y+2)%3][x+0] += 1 * err_B;
+			errors_B[(y+2)%3][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to RGB565
+ */
+static int atkinson_to_RGB565_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			errors_R[y%3][x+2] += 1 * err_R;
+			errors_R[y%3][x+3] += 1 * err_R;
+			errors_R[(y+1)%3][x] += 1 * err_R;
+			errors_R[(y+1)%3][x+1] += 1 * err_R;
+			errors_R[(y+1)%3][x+2] += 1 * err_R;
+			errors_R[(y+2)%3][x+0] += 1 * err_R;
+			errors_R[(y+2)%3][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			errors_G[y%3][x+2] += 1 * err_G;
+			errors_G[y%3][x+3] += 1 * err_G;
+			errors_G[(y+1)%3][x] += 1 * err_G;
+			errors_G[(y+1)%3][x+1] += 1 * err_G;
+			errors_G[(y+1)%3][x+2] += 1 * err_G;
+			errors_G[(y+2)%3][x+0] += 1 * err_G;
+			errors_G[(y+2)%3][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			errors_B[y%3][x+2] += 1 * err_B;
+			errors_B[y%3][x+3] += 1 * err_B;
+			errors_B[(y+1)%3][x] += 1 * err_B;
+			errors_B[(y+1)%3][x+1] += 1 * err_B;
+			errors_B[(y+1)%3][x+2] += 1 * err_B;
+			errors_B[(y+2)%3][x+0] += 1 * err_B;
+			errors_B[(y+2)%3][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to RGB666
+ */
+static int atkinson_to_RGB666_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB666),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 63 * val_R / 255;
+			err_R -= res_R * 255 / 63;
+
+			errors_R[y%3][x+2] += 1 * err_R;
+			errors_R[y%3][x+3] += 1 * err_R;
+			errors_R[(y+1)%3][x] += 1 * err_R;
+			errors_R[(y+1)%3][x+1] += 1 * err_R;
+			errors_R[(y+1)%3][x+2] += 1 * err_R;
+			errors_R[(y+2)%3][x+0] += 1 * err_R;
+			errors_R[(y+2)%3][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 63);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			errors_G[y%3][x+2] += 1 * err_G;
+			errors_G[y%3][x+3] += 1 * err_G;
+			errors_G[(y+1)%3][x] += 1 * err_G;
+			errors_G[(y+1)%3][x+1] += 1 * err_G;
+			errors_G[(y+1)%3][x+2] += 1 * err_G;
+			errors_G[(y+2)%3][x+0] += 1 * err_G;
+			errors_G[(y+2)%3][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 63 * val_B / 255;
+			err_B -= res_B * 255 / 63;
+
+			errors_B[y%3][x+2] += 1 * err_B;
+			errors_B[y%3][x+3] += 1 * err_B;
+			errors_B[(y+1)%3][x] += 1 * err_B;
+			errors_B[(y+1)%3][x+1] += 1 * err_B;
+			errors_B[(y+1)%3][x+2] += 1 * err_B;
+			errors_B[(y+2)%3][x+0] += 1 * err_B;
+			errors_B[(y+2)%3][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 63);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to RGB332
+ */
+static int atkinson_to_RGB332_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB332),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 7 * val_R / 255;
+			err_R -= res_R * 255 / 7;
+
+			errors_R[y%3][x+2] += 1 * err_R;
+			errors_R[y%3][x+3] += 1 * err_R;
+			errors_R[(y+1)%3][x] += 1 * err_R;
+			errors_R[(y+1)%3][x+1] += 1 * err_R;
+			errors_R[(y+1)%3][x+2] += 1 * err_R;
+			errors_R[(y+2)%3][x+0] += 1 * err_R;
+			errors_R[(y+2)%3][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 7);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 7 * val_G / 255;
+			err_G -= res_G * 255 / 7;
+
+			errors_G[y%3][x+2] += 1 * err_G;
+			errors_G[y%3][x+3] += 1 * err_G;
+			errors_G[(y+1)%3][x] += 1 * err_G;
+			errors_G[(y+1)%3][x+1] += 1 * err_G;
+			errors_G[(y+1)%3][x+2] += 1 * err_G;
+			errors_G[(y+2)%3][x+0] += 1 * err_G;
+			errors_G[(y+2)%3][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 7);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 3 * val_B / 255;
+			err_B -= res_B * 255 / 3;
+
+			errors_B[y%3][x+2] += 1 * err_B;
+			errors_B[y%3][x+3] += 1 * err_B;
+			errors_B[(y+1)%3][x] += 1 * err_B;
+			errors_B[(y+1)%3][x+1] += 1 * err_B;
+			errors_B[(y+1)%3][x+2] += 1 * err_B;
+			errors_B[(y+2)%3][x+0] += 1 * err_B;
+			errors_B[(y+2)%3][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 3);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to G1_DB
+ */
+static int atkinson_to_G1_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			errors_V[y%3][x+2] += 1 * err_V;
+			errors_V[y%3][x+3] += 1 * err_V;
+			errors_V[(y+1)%3][x] += 1 * err_V;
+			errors_V[(y+1)%3][x+1] += 1 * err_V;
+			errors_V[(y+1)%3][x+2] += 1 * err_V;
+			errors_V[(y+2)%3][x+0] += 1 * err_V;
+			errors_V[(y+2)%3][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to G2_DB
+ */
+static int atkinson_to_G2_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			errors_V[y%3][x+2] += 1 * err_V;
+			errors_V[y%3][x+3] += 1 * err_V;
+			errors_V[(y+1)%3][x] += 1 * err_V;
+			errors_V[(y+1)%3][x+1] += 1 * err_V;
+			errors_V[(y+1)%3][x+2] += 1 * err_V;
+			errors_V[(y+2)%3][x+0] += 1 * err_V;
+			errors_V[(y+2)%3][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to G4_DB
+ */
+static int atkinson_to_G4_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			errors_V[y%3][x+2] += 1 * err_V;
+			errors_V[y%3][x+3] += 1 * err_V;
+			errors_V[(y+1)%3][x] += 1 * err_V;
+			errors_V[(y+1)%3][x+1] += 1 * err_V;
+			errors_V[(y+1)%3][x+2] += 1 * err_V;
+			errors_V[(y+2)%3][x+0] += 1 * err_V;
+			errors_V[(y+2)%3][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to G1_UB
+ */
+static int atkinson_to_G1_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			errors_V[y%3][x+2] += 1 * err_V;
+			errors_V[y%3][x+3] += 1 * err_V;
+			errors_V[(y+1)%3][x] += 1 * err_V;
+			errors_V[(y+1)%3][x+1] += 1 * err_V;
+			errors_V[(y+1)%3][x+2] += 1 * err_V;
+			errors_V[(y+2)%3][x+0] += 1 * err_V;
+			errors_V[(y+2)%3][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to G2_UB
+ */
+static int atkinson_to_G2_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			errors_V[y%3][x+2] += 1 * err_V;
+			errors_V[y%3][x+3] += 1 * err_V;
+			errors_V[(y+1)%3][x] += 1 * err_V;
+			errors_V[(y+1)%3][x+1] += 1 * err_V;
+			errors_V[(y+1)%3][x+2] += 1 * err_V;
+			errors_V[(y+2)%3][x+0] += 1 * err_V;
+			errors_V[(y+2)%3][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to G4_UB
+ */
+static int atkinson_to_G4_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			errors_V[y%3][x+2] += 1 * err_V;
+			errors_V[y%3][x+3] += 1 * err_V;
+			errors_V[(y+1)%3][x] += 1 * err_V;
+			errors_V[(y+1)%3][x+1] += 1 * err_V;
+			errors_V[(y+1)%3][x+2] += 1 * err_V;
+			errors_V[(y+2)%3][x+0] += 1 * err_V;
+			errors_V[(y+2)%3][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to G8
+ */
+static int atkinson_to_G8_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G8),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			errors_V[y%3][x+2] += 1 * err_V;
+			errors_V[y%3][x+3] += 1 * err_V;
+			errors_V[(y+1)%3][x] += 1 * err_V;
+			errors_V[(y+1)%3][x+1] += 1 * err_V;
+			errors_V[(y+1)%3][x+2] += 1 * err_V;
+			errors_V[(y+2)%3][x+0] += 1 * err_V;
+			errors_V[(y+2)%3][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to GA88
+ */
+static int atkinson_to_GA88_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	uint32_t errors_A[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_A[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_A[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_A[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_GA88),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			errors_V[y%3][x+2] += 1 * err_V;
+			errors_V[y%3][x+3] += 1 * err_V;
+			errors_V[(y+1)%3][x] += 1 * err_V;
+			errors_V[(y+1)%3][x+1] += 1 * err_V;
+			errors_V[(y+1)%3][x+2] += 1 * err_V;
+			errors_V[(y+2)%3][x+0] += 1 * err_V;
+			errors_V[(y+2)%3][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+			uint32_t val_A = gp_pixel_to_G8(pix, src->pixel_type);
+			val_A += errors_A[y % 3][x + 1] / 8;
+
+			uint32_t err_A = val_A;
+
+			gp_pixel res_A = 255 * val_A / 255;
+			err_A -= res_A * 255 / 255;
+
+			errors_A[y%3][x+2] += 1 * err_A;
+			errors_A[y%3][x+3] += 1 * err_A;
+			errors_A[(y+1)%3][x] += 1 * err_A;
+			errors_A[(y+1)%3][x+1] += 1 * err_A;
+			errors_A[(y+1)%3][x+2] += 1 * err_A;
+			errors_A[(y+2)%3][x+0] += 1 * err_A;
+			errors_A[(y+2)%3][x+1] += 1 * err_A;
+
+			GP_CLAMP_DOWN(res_A, 255);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_A[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Atkinson to G16
+ */
+static int atkinson_to_G16_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G16),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 65535 * val_V / 255;
+			err_V -= res_V * 255 / 65535;
+
+			errors_V[y%3][x+2] += 1 * err_V;
+			errors_V[y%3][x+3] += 1 * err_V;
+			errors_V[(y+1)%3][x] += 1 * err_V;
+			errors_V[(y+1)%3][x+1] += 1 * err_V;
+			errors_V[(y+1)%3][x+2] += 1 * err_V;
+			errors_V[(y+2)%3][x+0] += 1 * err_V;
+			errors_V[(y+2)%3][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 65535);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int atkinson(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return atkinson_to_RGB101010_raw(src, dst, callback);
+	case GP_PIXEL_xRGB8888:
+		return atkinson_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return atkinson_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return atkinson_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return atkinson_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565:
+		return atkinson_to_RGB565_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return atkinson_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return atkinson_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1_DB:
+		return atkinson_to_G1_DB_raw(src, dst, callback);
+	case GP_PIXEL_G2_DB:
+		return atkinson_to_G2_DB_raw(src, dst, callback);
+	case GP_PIXEL_G4_DB:
+		return atkinson_to_G4_DB_raw(src, dst, callback);
+	case GP_PIXEL_G1_UB:
+		return atkinson_to_G1_UB_raw(src, dst, callback);
+	case GP_PIXEL_G2_UB:
+		return atkinson_to_G2_UB_raw(src, dst, callback);
+	case GP_PIXEL_G4_UB:
+		return atkinson_to_G4_UB_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return atkinson_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return atkinson_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return atkinson_to_G16_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_atkinson(const gp_pixmap *src, gp_pixmap *dst,
+                              gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+	return atkinson(src, dst, callback);
+}
+
+/*
+ * Sierra to RGB101010
+ */
+static int sierra_to_RGB101010_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB101010),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 1023 * val_R / 255;
+			err_R -= res_R * 255 / 1023;
+
+			errors_R[y%3][x+3] += 5 * err_R;
+			errors_R[y%3][x+4] += 3 * err_R;
+			errors_R[(y+1)%3][x] += 2 * err_R;
+			errors_R[(y+1)%3][x+1] += 4 * err_R;
+			errors_R[(y+1)%3][x+2] += 5 * err_R;
+			errors_R[(y+1)%3][x+3] += 4 * err_R;
+			errors_R[(y+1)%3][x+4] += 2 * err_R;
+			errors_R[(y+2)%3][x+1] += 2 * err_R;
+			errors_R[(y+2)%3][x+2] += 3 * err_R;
+			errors_R[(y+2)%3][x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 1023);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 1023 * val_G / 255;
+			err_G -= res_G * 255 / 1023;
+
+			errors_G[y%3][x+3] += 5 * err_G;
+			errors_G[y%3][x+4] += 3 * err_G;
+			errors_G[(y+1)%3][x] += 2 * err_G;
+			errors_G[(y+1)%3][x+1] += 4 * err_G;
+			errors_G[(y+1)%3][x+2] += 5 * err_G;
+			errors_G[(y+1)%3][x+3] += 4 * err_G;
+			errors_G[(y+1)%3][x+4] += 2 * err_G;
+			errors_G[(y+2)%3][x+1] += 2 * err_G;
+			errors_G[(y+2)%3][x+2] += 3 * err_G;
+			errors_G[(y+2)%3][x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 1023);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 1023 * val_B / 255;
+			err_B -= res_B * 255 / 1023;
+
+			errors_B[y%3][x+3] += 5 * err_B;
+			errors_B[y%3][x+4] += 3 * err_B;
+			errors_B[(y+1)%3][x] += 2 * err_B;
+			errors_B[(y+1)%3][x+1] += 4 * err_B;
+			errors_B[(y+1)%3][x+2] += 5 * err_B;
+			errors_B[(y+1)%3][x+3] += 4 * err_B;
+			errors_B[(y+1)%3][x+4] += 2 * err_B;
+			errors_B[(y+2)%3][x+1] += 2 * err_B;
+			errors_B[(y+2)%3][x+2] += 3 * err_B;
+			errors_B[(y+2)%3][x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 1023);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to xRGB8888
+ */
+static int sierra_to_xRGB8888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_xRGB8888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			errors_R[y%3][x+3] += 5 * err_R;
+			errors_R[y%3][x+4] += 3 * err_R;
+			errors_R[(y+1)%3][x] += 2 * err_R;
+			errors_R[(y+1)%3][x+1] += 4 * err_R;
+			errors_R[(y+1)%3][x+2] += 5 * err_R;
+			errors_R[(y+1)%3][x+3] += 4 * err_R;
+			errors_R[(y+1)%3][x+4] += 2 * err_R;
+			errors_R[(y+2)%3][x+1] += 2 * err_R;
+			errors_R[(y+2)%3][x+2] += 3 * err_R;
+			errors_R[(y+2)%3][x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			errors_G[y%3][x+3] += 5 * err_G;
+			errors_G[y%3][x+4] += 3 * err_G;
+			errors_G[(y+1)%3][x] += 2 * err_G;
+			errors_G[(y+1)%3][x+1] += 4 * err_G;
+			errors_G[(y+1)%3][x+2] += 5 * err_G;
+			errors_G[(y+1)%3][x+3] += 4 * err_G;
+			errors_G[(y+1)%3][x+4] += 2 * err_G;
+			errors_G[(y+2)%3][x+1] += 2 * err_G;
+			errors_G[(y+2)%3][x+2] += 3 * err_G;
+			errors_G[(y+2)%3][x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			errors_B[y%3][x+3] += 5 * err_B;
+			errors_B[y%3][x+4] += 3 * err_B;
+			errors_B[(y+1)%3][x] += 2 * err_B;
+			errors_B[(y+1)%3][x+1] += 4 * err_B;
+			errors_B[(y+1)%3][x+2] += 5 * err_B;
+			errors_B[(y+1)%3][x+3] += 4 * err_B;
+			errors_B[(y+1)%3][x+4] += 2 * err_B;
+			errors_B[(y+2)%3][x+1] += 2 * err_B;
+			errors_B[(y+2)%3][x+2] += 3 * err_B;
+			errors_B[(y+2)%3][x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to RGB888
+ */
+static int sierra_to_RGB888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			errors_R[y%3][x+3] += 5 * err_R;
+			errors_R[y%3][x+4] += 3 * err_R;
+			errors_R[(y+1)%3][x] += 2 * err_R;
+			errors_R[(y+1)%3][x+1] += 4 * err_R;
+			errors_R[(y+1)%3][x+2] += 5 * err_R;
+			errors_R[(y+1)%3][x+3] += 4 * err_R;
+			errors_R[(y+1)%3][x+4] += 2 * err_R;
+			errors_R[(y+2)%3][x+1] += 2 * err_R;
+			errors_R[(y+2)%3][x+2] += 3 * err_R;
+			errors_R[(y+2)%3][x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			errors_G[y%3][x+3] += 5 * err_G;
+			errors_G[y%3][x+4] += 3 * err_G;
+			errors_G[(y+1)%3][x] += 2 * err_G;
+			errors_G[(y+1)%3][x+1] += 4 * err_G;
+			errors_G[(y+1)%3][x+2] += 5 * err_G;
+			errors_G[(y+1)%3][x+3] += 4 * err_G;
+			errors_G[(y+1)%3][x+4] += 2 * err_G;
+			errors_G[(y+2)%3][x+1] += 2 * err_G;
+			errors_G[(y+2)%3][x+2] += 3 * err_G;
+			errors_G[(y+2)%3][x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			errors_B[y%3][x+3] += 5 * err_B;
+			errors_B[y%3][x+4] += 3 * err_B;
+			errors_B[(y+1)%3][x] += 2 * err_B;
+			errors_B[(y+1)%3][x+1] += 4 * err_B;
+			errors_B[(y+1)%3][x+2] += 5 * err_B;
+			errors_B[(y+1)%3][x+3] += 4 * err_B;
+			errors_B[(y+1)%3][x+4] += 2 * err_B;
+			errors_B[(y+2)%3][x+1] += 2 * err_B;
+			errors_B[(y+2)%3][x+2] += 3 * err_B;
+			errors_B[(y+2)%3][x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to BGR888
+ */
+static int sierra_to_BGR888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_B[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_BGR888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			errors_B[y%3][x+3] += 5 * err_B;
+			errors_B[y%3][x+4] += 3 * err_B;
+			errors_B[(y+1)%3][x] += 2 * err_B;
+			errors_B[(y+1)%3][x+1] += 4 * err_B;
+			errors_B[(y+1)%3][x+2] += 5 * err_B;
+			errors_B[(y+1)%3][x+3] += 4 * err_B;
+			errors_B[(y+1)%3][x+4] += 2 * err_B;
+			errors_B[(y+2)%3][x+1] += 2 * err_B;
+			errors_B[(y+2)%3][x+2] += 3 * err_B;
+			errors_B[(y+2)%3][x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			errors_G[y%3][x+3] += 5 * err_G;
+			errors_G[y%3][x+4] += 3 * err_G;
+			errors_G[(y+1)%3][x] += 2 * err_G;
+			errors_G[(y+1)%3][x+1] += 4 * err_G;
+			errors_G[(y+1)%3][x+2] += 5 * err_G;
+			errors_G[(y+1)%3][x+3] += 4 * err_G;
+			errors_G[(y+1)%3][x+4] += 2 * err_G;
+			errors_G[(y+2)%3][x+1] += 2 * err_G;
+			errors_G[(y+2)%3][x+2] += 3 * err_G;
+			errors_G[(y+2)%3][x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			errors_R[y%3][x+3] += 5 * err_R;
+			errors_R[y%3][x+4] += 3 * err_R;
+			errors_R[(y+1)%3][x] += 2 * err_R;
+			errors_R[(y+1)%3][x+1] += 4 * err_R;
+			errors_R[(y+1)%3][x+2] += 5 * err_R;
+			errors_R[(y+1)%3][x+3] += 4 * err_R;
+			errors_R[(y+1)%3][x+4] += 2 * err_R;
+			errors_R[(y+2)%3][x+1] += 2 * err_R;
+			errors_R[(y+2)%3][x+2] += 3 * err_R;
+			errors_R[(y+2)%3][x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to RGB555
+ */
+static int sierra_to_RGB555_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB555),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			errors_R[y%3][x+3] += 5 * err_R;
+			errors_R[y%3][x+4] += 3 * err_R;
+			errors_R[(y+1)%3][x] += 2 * err_R;
+			errors_R[(y+1)%3][x+1] += 4 * err_R;
+			errors_R[(y+1)%3][x+2] += 5 * err_R;
+			errors_R[(y+1)%3][x+3] += 4 * err_R;
+			errors_R[(y+1)%3][x+4] += 2 * err_R;
+			errors_R[(y+2)%3][x+1] += 2 * err_R;
+			errors_R[(y+2)%3][x+2] += 3 * err_R;
+			errors_R[(y+2)%3][x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 31 * val_G / 255;
+			err_G -= res_G * 255 / 31;
+
+			errors_G[y%3][x+3] += 5 * err_G;
+			errors_G[y%3][x+4] += 3 * err_G;
+			errors_G[(y+1)%3][x] += 2 * err_G;
+			errors_G[(y+1)%3][x+1] += 4 * err_G;
+			errors_G[(y+1)%3][x+2] += 5 * err_G;
+			errors_G[(y+1)%3][x+3] += 4 * err_G;
+			errors_G[(y+1)%3][x+4] += 2 * err_G;
+			errors_G[(y+2)%3][x+1] += 2 * err_G;
+			errors_G[(y+2)%3][x+2] += 3 * err_G;
+			errors_G[(y+2)%3][x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 31);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			errors_B[y%3][x+3] += 5 * err_B;
+			errors_B[y%3][x+4] += 3 * err_B;
+			errors_B[(y+1)%3][x] += 2 * err_B;
+			errors_B[(y+1)%3][x+1] += 4 * err_B;
+			errors_B[(y+1)%3][x+2] += 5 * err_B;
+			errors_B[(y+1)%3][x+3] += 4 * err_B;
+			errors_B[(y+1)%3][x+4] += 2 * err_B;
+			errors_B[(y+2)%3][x+1] += 2 * err_B;
+			errors_B[(y+2)%3][x+2] += 3 * err_B;
+			errors_B[(y+2)%3][x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to RGB565
+ */
+static int sierra_to_RGB565_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			errors_R[y%3][x+3] += 5 * err_R;
+			errors_R[y%3][x+4] += 3 * err_R;
+			errors_R[(y+1)%3][x] += 2 * err_R;
+			errors_R[(y+1)%3][x+1] += 4 * err_R;
+			errors_R[(y+1)%3][x+2] += 5 * err_R;
+			errors_R[(y+1)%3][x+3] += 4 * err_R;
+			errors_R[(y+1)%3][x+4] += 2 * err_R;
+			errors_R[(y+2)%3][x+1] += 2 * err_R;
+			errors_R[(y+2)%3][x+2] += 3 * err_R;
+			errors_R[(y+2)%3][x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			errors_G[y%3][x+3] += 5 * err_G;
+			errors_G[y%3][x+4] += 3 * err_G;
+			errors_G[(y+1)%3][x] += 2 * err_G;
+			errors_G[(y+1)%3][x+1] += 4 * err_G;
+			errors_G[(y+1)%3][x+2] += 5 * err_G;
+			errors_G[(y+1)%3][x+3] += 4 * err_G;
+			errors_G[(y+1)%3][x+4] += 2 * err_G;
+			errors_G[(y+2)%3][x+1] += 2 * err_G;
+			errors_G[(y+2)%3][x+2] += 3 * err_G;
+			errors_G[(y+2)%3][x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			errors_B[y%3][x+3] += 5 * err_B;
+			errors_B[y%3][x+4] += 3 * err_B;
+			errors_B[(y+1)%3][x] += 2 * err_B;
+			errors_B[(y+1)%3][x+1] += 4 * err_B;
+			errors_B[(y+1)%3][x+2] += 5 * err_B;
+			errors_B[(y+1)%3][x+3] += 4 * err_B;
+			errors_B[(y+1)%3][x+4] += 2 * err_B;
+			errors_B[(y+2)%3][x+1] += 2 * err_B;
+			errors_B[(y+2)%3][x+2] += 3 * err_B;
+			errors_B[(y+2)%3][x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to RGB666
+ */
+static int sierra_to_RGB666_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB666),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 63 * val_R / 255;
+			err_R -= res_R * 255 / 63;
+
+			errors_R[y%3][x+3] += 5 * err_R;
+			errors_R[y%3][x+4] += 3 * err_R;
+			errors_R[(y+1)%3][x] += 2 * err_R;
+			errors_R[(y+1)%3][x+1] += 4 * err_R;
+			errors_R[(y+1)%3][x+2] += 5 * err_R;
+			errors_R[(y+1)%3][x+3] += 4 * err_R;
+			errors_R[(y+1)%3][x+4] += 2 * err_R;
+			errors_R[(y+2)%3][x+1] += 2 * err_R;
+			errors_R[(y+2)%3][x+2] += 3 * err_R;
+			errors_R[(y+2)%3][x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 63);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			errors_G[y%3][x+3] += 5 * err_G;
+			errors_G[y%3][x+4] += 3 * err_G;
+			errors_G[(y+1)%3][x] += 2 * err_G;
+			errors_G[(y+1)%3][x+1] += 4 * err_G;
+			errors_G[(y+1)%3][x+2] += 5 * err_G;
+			errors_G[(y+1)%3][x+3] += 4 * err_G;
+			errors_G[(y+1)%3][x+4] += 2 * err_G;
+			errors_G[(y+2)%3][x+1] += 2 * err_G;
+			errors_G[(y+2)%3][x+2] += 3 * err_G;
+			errors_G[(y+2)%3][x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 63 * val_B / 255;
+			err_B -= res_B * 255 / 63;
+
+			errors_B[y%3][x+3] += 5 * err_B;
+			errors_B[y%3][x+4] += 3 * err_B;
+			errors_B[(y+1)%3][x] += 2 * err_B;
+			errors_B[(y+1)%3][x+1] += 4 * err_B;
+			errors_B[(y+1)%3][x+2] += 5 * err_B;
+			errors_B[(y+1)%3][x+3] += 4 * err_B;
+			errors_B[(y+1)%3][x+4] += 2 * err_B;
+			errors_B[(y+2)%3][x+1] += 2 * err_B;
+			errors_B[(y+2)%3][x+2] += 3 * err_B;
+			errors_B[(y+2)%3][x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 63);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to RGB332
+ */
+static int sierra_to_RGB332_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	uint32_t errors_G[3][src->w + 4];
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_R[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_R[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_G[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_B[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB332),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 3][x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 7 * val_R / 255;
+			err_R -= res_R * 255 / 7;
+
+			errors_R[y%3][x+3] += 5 * err_R;
+			errors_R[y%3][x+4] += 3 * err_R;
+			errors_R[(y+1)%3][x] += 2 * err_R;
+			errors_R[(y+1)%3][x+1] += 4 * err_R;
+			errors_R[(y+1)%3][x+2] += 5 * err_R;
+			errors_R[(y+1)%3][x+3] += 4 * err_R;
+			errors_R[(y+1)%3][x+4] += 2 * err_R;
+			errors_R[(y+2)%3][x+1] += 2 * err_R;
+			errors_R[(y+2)%3][x+2] += 3 * err_R;
+			errors_R[(y+2)%3][x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 7);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 3][x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 7 * val_G / 255;
+			err_G -= res_G * 255 / 7;
+
+			errors_G[y%3][x+3] += 5 * err_G;
+			errors_G[y%3][x+4] += 3 * err_G;
+			errors_G[(y+1)%3][x] += 2 * err_G;
+			errors_G[(y+1)%3][x+1] += 4 * err_G;
+			errors_G[(y+1)%3][x+2] += 5 * err_G;
+			errors_G[(y+1)%3][x+3] += 4 * err_G;
+			errors_G[(y+1)%3][x+4] += 2 * err_G;
+			errors_G[(y+2)%3][x+1] += 2 * err_G;
+			errors_G[(y+2)%3][x+2] += 3 * err_G;
+			errors_G[(y+2)%3][x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 7);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 3][x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 3 * val_B / 255;
+			err_B -= res_B * 255 / 3;
+
+			errors_B[y%3][x+3] += 5 * err_B;
+			errors_B[y%3][x+4] += 3 * err_B;
+			errors_B[(y+1)%3][x] += 2 * err_B;
+			errors_B[(y+1)%3][x+1] += 4 * err_B;
+			errors_B[(y+1)%3][x+2] += 5 * err_B;
+			errors_B[(y+1)%3][x+3] += 4 * err_B;
+			errors_B[(y+1)%3][x+4] += 2 * err_B;
+			errors_B[(y+2)%3][x+1] += 2 * err_B;
+			errors_B[(y+2)%3][x+2] += 3 * err_B;
+			errors_B[(y+2)%3][x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 3);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to G1_DB
+ */
+static int sierra_to_G1_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			errors_V[y%3][x+3] += 5 * err_V;
+			errors_V[y%3][x+4] += 3 * err_V;
+			errors_V[(y+1)%3][x] += 2 * err_V;
+			errors_V[(y+1)%3][x+1] += 4 * err_V;
+			errors_V[(y+1)%3][x+2] += 5 * err_V;
+			errors_V[(y+1)%3][x+3] += 4 * err_V;
+			errors_V[(y+1)%3][x+4] += 2 * err_V;
+			errors_V[(y+2)%3][x+1] += 2 * err_V;
+			errors_V[(y+2)%3][x+2] += 3 * err_V;
+			errors_V[(y+2)%3][x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to G2_DB
+ */
+static int sierra_to_G2_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			errors_V[y%3][x+3] += 5 * err_V;
+			errors_V[y%3][x+4] += 3 * err_V;
+			errors_V[(y+1)%3][x] += 2 * err_V;
+			errors_V[(y+1)%3][x+1] += 4 * err_V;
+			errors_V[(y+1)%3][x+2] += 5 * err_V;
+			errors_V[(y+1)%3][x+3] += 4 * err_V;
+			errors_V[(y+1)%3][x+4] += 2 * err_V;
+			errors_V[(y+2)%3][x+1] += 2 * err_V;
+			errors_V[(y+2)%3][x+2] += 3 * err_V;
+			errors_V[(y+2)%3][x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to G4_DB
+ */
+static int sierra_to_G4_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			errors_V[y%3][x+3] += 5 * err_V;
+			errors_V[y%3][x+4] += 3 * err_V;
+			errors_V[(y+1)%3][x] += 2 * err_V;
+			errors_V[(y+1)%3][x+1] += 4 * err_V;
+			errors_V[(y+1)%3][x+2] += 5 * err_V;
+			errors_V[(y+1)%3][x+3] += 4 * err_V;
+			errors_V[(y+1)%3][x+4] += 2 * err_V;
+			errors_V[(y+2)%3][x+1] += 2 * err_V;
+			errors_V[(y+2)%3][x+2] += 3 * err_V;
+			errors_V[(y+2)%3][x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to G1_UB
+ */
+static int sierra_to_G1_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			errors_V[y%3][x+3] += 5 * err_V;
+			errors_V[y%3][x+4] += 3 * err_V;
+			errors_V[(y+1)%3][x] += 2 * err_V;
+			errors_V[(y+1)%3][x+1] += 4 * err_V;
+			errors_V[(y+1)%3][x+2] += 5 * err_V;
+			errors_V[(y+1)%3][x+3] += 4 * err_V;
+			errors_V[(y+1)%3][x+4] += 2 * err_V;
+			errors_V[(y+2)%3][x+1] += 2 * err_V;
+			errors_V[(y+2)%3][x+2] += 3 * err_V;
+			errors_V[(y+2)%3][x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to G2_UB
+ */
+static int sierra_to_G2_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			errors_V[y%3][x+3] += 5 * err_V;
+			errors_V[y%3][x+4] += 3 * err_V;
+			errors_V[(y+1)%3][x] += 2 * err_V;
+			errors_V[(y+1)%3][x+1] += 4 * err_V;
+			errors_V[(y+1)%3][x+2] += 5 * err_V;
+			errors_V[(y+1)%3][x+3] += 4 * err_V;
+			errors_V[(y+1)%3][x+4] += 2 * err_V;
+			errors_V[(y+2)%3][x+1] += 2 * err_V;
+			errors_V[(y+2)%3][x+2] += 3 * err_V;
+			errors_V[(y+2)%3][x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to G4_UB
+ */
+static int sierra_to_G4_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			errors_V[y%3][x+3] += 5 * err_V;
+			errors_V[y%3][x+4] += 3 * err_V;
+			errors_V[(y+1)%3][x] += 2 * err_V;
+			errors_V[(y+1)%3][x+1] += 4 * err_V;
+			errors_V[(y+1)%3][x+2] += 5 * err_V;
+			errors_V[(y+1)%3][x+3] += 4 * err_V;
+			errors_V[(y+1)%3][x+4] += 2 * err_V;
+			errors_V[(y+2)%3][x+1] += 2 * err_V;
+			errors_V[(y+2)%3][x+2] += 3 * err_V;
+			errors_V[(y+2)%3][x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to G8
+ */
+static int sierra_to_G8_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G8),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			errors_V[y%3][x+3] += 5 * err_V;
+			errors_V[y%3][x+4] += 3 * err_V;
+			errors_V[(y+1)%3][x] += 2 * err_V;
+			errors_V[(y+1)%3][x+1] += 4 * err_V;
+			errors_V[(y+1)%3][x+2] += 5 * err_V;
+			errors_V[(y+1)%3][x+3] += 4 * err_V;
+			errors_V[(y+1)%3][x+4] += 2 * err_V;
+			errors_V[(y+2)%3][x+1] += 2 * err_V;
+			errors_V[(y+2)%3][x+2] += 3 * err_V;
+			errors_V[(y+2)%3][x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to GA88
+ */
+static int sierra_to_GA88_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	uint32_t errors_A[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_A[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_A[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_A[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_GA88),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			errors_V[y%3][x+3] += 5 * err_V;
+			errors_V[y%3][x+4] += 3 * err_V;
+			errors_V[(y+1)%3][x] += 2 * err_V;
+			errors_V[(y+1)%3][x+1] += 4 * err_V;
+			errors_V[(y+1)%3][x+2] += 5 * err_V;
+			errors_V[(y+1)%3][x+3] += 4 * err_V;
+			errors_V[(y+1)%3][x+4] += 2 * err_V;
+			errors_V[(y+2)%3][x+1] += 2 * err_V;
+			errors_V[(y+2)%3][x+2] += 3 * err_V;
+			errors_V[(y+2)%3][x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+			uint32_t val_A = gp_pixel_to_G8(pix, src->pixel_type);
+			val_A += errors_A[y % 3][x + 2] / 32;
+
+			uint32_t err_A = val_A;
+
+			gp_pixel res_A = 255 * val_A / 255;
+			err_A -= res_A * 255 / 255;
+
+			errors_A[y%3][x+3] += 5 * err_A;
+			errors_A[y%3][x+4] += 3 * err_A;
+			errors_A[(y+1)%3][x] += 2 * err_A;
+			errors_A[(y+1)%3][x+1] += 4 * err_A;
+			errors_A[(y+1)%3][x+2] += 5 * err_A;
+			errors_A[(y+1)%3][x+3] += 4 * err_A;
+			errors_A[(y+1)%3][x+4] += 2 * err_A;
+			errors_A[(y+2)%3][x+1] += 2 * err_A;
+			errors_A[(y+2)%3][x+2] += 3 * err_A;
+			errors_A[(y+2)%3][x+3] += 2 * err_A;
+
+			GP_CLAMP_DOWN(res_A, 255);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+		memset(errors_A[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra to G16
+ */
+static int sierra_to_G16_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V[0 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+	memset(errors_V[2 % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G16),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 3][x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 65535 * val_V / 255;
+			err_V -= res_V * 255 / 65535;
+
+			errors_V[y%3][x+3] += 5 * err_V;
+			errors_V[y%3][x+4] += 3 * err_V;
+			errors_V[(y+1)%3][x] += 2 * err_V;
+			errors_V[(y+1)%3][x+1] += 4 * err_V;
+			errors_V[(y+1)%3][x+2] += 5 * err_V;
+			errors_V[(y+1)%3][x+3] += 4 * err_V;
+			errors_V[(y+1)%3][x+4] += 2 * err_V;
+			errors_V[(y+2)%3][x+1] += 2 * err_V;
+			errors_V[(y+2)%3][x+2] += 3 * err_V;
+			errors_V[(y+2)%3][x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 65535);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 3], 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int sierra(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return sierra_to_RGB101010_raw(src, dst, callback);
+	case GP_PIXEL_xRGB8888:
+		return sierra_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return sierra_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return sierra_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return sierra_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565:
+		return sierra_to_RGB565_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return sierra_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return sierra_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1_DB:
+		return sierra_to_G1_DB_raw(src, dst, callback);
+	case GP_PIXEL_G2_DB:
+		return sierra_to_G2_DB_raw(src, dst, callback);
+	case GP_PIXEL_G4_DB:
+		return sierra_to_G4_DB_raw(src, dst, callback);
+	case GP_PIXEL_G1_UB:
+		return sierra_to_G1_UB_raw(src, dst, callback);
+	case GP_PIXEL_G2_UB:
+		return sierra_to_G2_UB_raw(src, dst, callback);
+	case GP_PIXEL_G4_UB:
+		return sierra_to_G4_UB_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return sierra_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return sierra_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return sierra_to_G16_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_sierra(const gp_pixmap *src, gp_pixmap *dst,
+                              gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+	return sierra(src, dst, callback);
+}
+
+/*
+ * Sierra Lite to RGB101010
+ */
+static int sierra_lite_to_RGB101010_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB101010),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 1023 * val_R / 255;
+			err_R -= res_R * 255 / 1023;
+
+			errors_R[y%2][x+2] += 2 * err_R;
+			errors_R[!(y%2)][x] += 1 * err_R;
+			errors_R[!(y%2)][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 1023);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 1023 * val_G / 255;
+			err_G -= res_G * 255 / 1023;
+
+			errors_G[y%2][x+2] += 2 * err_G;
+			errors_G[!(y%2)][x] += 1 * err_G;
+			errors_G[!(y%2)][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 1023);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 1023 * val_B / 255;
+			err_B -= res_B * 255 / 1023;
+
+			errors_B[y%2][x+2] += 2 * err_B;
+			errors_B[!(y%2)][x] += 1 * err_B;
+			errors_B[!(y%2)][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 1023);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to xRGB8888
+ */
+static int sierra_lite_to_xRGB8888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_xRGB8888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			errors_R[y%2][x+2] += 2 * err_R;
+			errors_R[!(y%2)][x] += 1 * err_R;
+			errors_R[!(y%2)][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			errors_G[y%2][x+2] += 2 * err_G;
+			errors_G[!(y%2)][x] += 1 * err_G;
+			errors_G[!(y%2)][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			errors_B[y%2][x+2] += 2 * err_B;
+			errors_B[!(y%2)][x] += 1 * err_B;
+			errors_B[!(y%2)][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to RGB888
+ */
+static int sierra_lite_to_RGB888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			errors_R[y%2][x+2] += 2 * err_R;
+			errors_R[!(y%2)][x] += 1 * err_R;
+			errors_R[!(y%2)][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			errors_G[y%2][x+2] += 2 * err_G;
+			errors_G[!(y%2)][x] += 1 * err_G;
+			errors_G[!(y%2)][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			errors_B[y%2][x+2] += 2 * err_B;
+			errors_B[!(y%2)][x] += 1 * err_B;
+			errors_B[!(y%2)][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to BGR888
+ */
+static int sierra_lite_to_BGR888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_B[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_BGR888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			errors_B[y%2][x+2] += 2 * err_B;
+			errors_B[!(y%2)][x] += 1 * err_B;
+			errors_B[!(y%2)][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			errors_G[y%2][x+2] += 2 * err_G;
+			errors_G[!(y%2)][x] += 1 * err_G;
+			errors_G[!(y%2)][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			errors_R[y%2][x+2] += 2 * err_R;
+			errors_R[!(y%2)][x] += 1 * err_R;
+			errors_R[!(y%2)][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to RGB555
+ */
+static int sierra_lite_to_RGB555_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB555),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			errors_R[y%2][x+2] += 2 * err_R;
+			errors_R[!(y%2)][x] += 1 * err_R;
+			errors_R[!(y%2)][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 31 * val_G / 255;
+			err_G -= res_G * 255 / 31;
+
+			errors_G[y%2][x+2] += 2 * err_G;
+			errors_G[!(y%2)][x] += 1 * err_G;
+			errors_G[!(y%2)][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 31);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			errors_B[y%2][x+2] += 2 * err_B;
+			errors_B[!(y%2)][x] += 1 * err_B;
+			errors_B[!(y%2)][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to RGB565
+ */
+static int sierra_lite_to_RGB565_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			errors_R[y%2][x+2] += 2 * err_R;
+			errors_R[!(y%2)][x] += 1 * err_R;
+			errors_R[!(y%2)][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			errors_G[y%2][x+2] += 2 * err_G;
+			errors_G[!(y%2)][x] += 1 * err_G;
+			errors_G[!(y%2)][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			errors_B[y%2][x+2] += 2 * err_B;
+			errors_B[!(y%2)][x] += 1 * err_B;
+			errors_B[!(y%2)][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to RGB666
+ */
+static int sierra_lite_to_RGB666_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB666),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 63 * val_R / 255;
+			err_R -= res_R * 255 / 63;
+
+			errors_R[y%2][x+2] += 2 * err_R;
+			errors_R[!(y%2)][x] += 1 * err_R;
+			errors_R[!(y%2)][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 63);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			errors_G[y%2][x+2] += 2 * err_G;
+			errors_G[!(y%2)][x] += 1 * err_G;
+			errors_G[!(y%2)][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 63 * val_B / 255;
+			err_B -= res_B * 255 / 63;
+
+			errors_B[y%2][x+2] += 2 * err_B;
+			errors_B[!(y%2)][x] += 1 * err_B;
+			errors_B[!(y%2)][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 63);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to RGB332
+ */
+static int sierra_lite_to_RGB332_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	uint32_t errors_G[2][src->w + 2];
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_R[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_R[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_G[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_B[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB332),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y % 2][x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 7 * val_R / 255;
+			err_R -= res_R * 255 / 7;
+
+			errors_R[y%2][x+2] += 2 * err_R;
+			errors_R[!(y%2)][x] += 1 * err_R;
+			errors_R[!(y%2)][x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 7);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y % 2][x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 7 * val_G / 255;
+			err_G -= res_G * 255 / 7;
+
+			errors_G[y%2][x+2] += 2 * err_G;
+			errors_G[!(y%2)][x] += 1 * err_G;
+			errors_G[!(y%2)][x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 7);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y % 2][x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 3 * val_B / 255;
+			err_B -= res_B * 255 / 3;
+
+			errors_B[y%2][x+2] += 2 * err_B;
+			errors_B[!(y%2)][x] += 1 * err_B;
+			errors_B[!(y%2)][x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 3);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_G[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_B[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to G1_DB
+ */
+static int sierra_lite_to_G1_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			errors_V[y%2][x+2] += 2 * err_V;
+			errors_V[!(y%2)][x] += 1 * err_V;
+			errors_V[!(y%2)][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to G2_DB
+ */
+static int sierra_lite_to_G2_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			errors_V[y%2][x+2] += 2 * err_V;
+			errors_V[!(y%2)][x] += 1 * err_V;
+			errors_V[!(y%2)][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to G4_DB
+ */
+static int sierra_lite_to_G4_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			errors_V[y%2][x+2] += 2 * err_V;
+			errors_V[!(y%2)][x] += 1 * err_V;
+			errors_V[!(y%2)][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to G1_UB
+ */
+static int sierra_lite_to_G1_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			errors_V[y%2][x+2] += 2 * err_V;
+			errors_V[!(y%2)][x] += 1 * err_V;
+			errors_V[!(y%2)][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to G2_UB
+ */
+static int sierra_lite_to_G2_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			errors_V[y%2][x+2] += 2 * err_V;
+			errors_V[!(y%2)][x] += 1 * err_V;
+			errors_V[!(y%2)][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to G4_UB
+ */
+static int sierra_lite_to_G4_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			errors_V[y%2][x+2] += 2 * err_V;
+			errors_V[!(y%2)][x] += 1 * err_V;
+			errors_V[!(y%2)][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to G8
+ */
+static int sierra_lite_to_G8_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G8),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			errors_V[y%2][x+2] += 2 * err_V;
+			errors_V[!(y%2)][x] += 1 * err_V;
+			errors_V[!(y%2)][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to GA88
+ */
+static int sierra_lite_to_GA88_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	uint32_t errors_A[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_A[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_A[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_GA88),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			errors_V[y%2][x+2] += 2 * err_V;
+			errors_V[!(y%2)][x] += 1 * err_V;
+			errors_V[!(y%2)][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+			uint32_t val_A = gp_pixel_to_G8(pix, src->pixel_type);
+			val_A += errors_A[y % 2][x + 1] / 4;
+
+			uint32_t err_A = val_A;
+
+			gp_pixel res_A = 255 * val_A / 255;
+			err_A -= res_A * 255 / 255;
+
+			errors_A[y%2][x+2] += 2 * err_A;
+			errors_A[!(y%2)][x] += 1 * err_A;
+			errors_A[!(y%2)][x+1] += 1 * err_A;
+
+			GP_CLAMP_DOWN(res_A, 255);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+		memset(errors_A[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Sierra Lite to G16
+ */
+static int sierra_lite_to_G16_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V[0 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+	memset(errors_V[1 % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G16),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += errors_V[y % 2][x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 65535 * val_V / 255;
+			err_V -= res_V * 255 / 65535;
+
+			errors_V[y%2][x+2] += 2 * err_V;
+			errors_V[!(y%2)][x] += 1 * err_V;
+			errors_V[!(y%2)][x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 65535);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y % 2], 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int sierra_lite(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return sierra_lite_to_RGB101010_raw(src, dst, callback);
+	case GP_PIXEL_xRGB8888:
+		return sierra_lite_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return sierra_lite_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return sierra_lite_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return sierra_lite_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565:
+		return sierra_lite_to_RGB565_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return sierra_lite_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return sierra_lite_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1_DB:
+		return sierra_lite_to_G1_DB_raw(src, dst, callback);
+	case GP_PIXEL_G2_DB:
+		return sierra_lite_to_G2_DB_raw(src, dst, callback);
+	case GP_PIXEL_G4_DB:
+		return sierra_lite_to_G4_DB_raw(src, dst, callback);
+	case GP_PIXEL_G1_UB:
+		return sierra_lite_to_G1_UB_raw(src, dst, callback);
+	case GP_PIXEL_G2_UB:
+		return sierra_lite_to_G2_UB_raw(src, dst, callback);
+	case GP_PIXEL_G4_UB:
+		return sierra_lite_to_G4_UB_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return sierra_lite_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return sierra_lite_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return sierra_lite_to_G16_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_sierra_lite(const gp_pixmap *src, gp_pixmap *dst,
+                              gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+	return sierra_lite(src, dst, callback);
+}
+
@@ -0,0 +1,760 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_histogram.gen.c
+ *
+ * GENERATED on 2026 10 19 15:08:14 from gp_histogram.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Histogram filter -- Compute image histogram
+ *
+ * Copyright (C) 2009-2015 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <string.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_debug.h>
+#include <filters/gp_filter.h>
+#include <filters/gp_stats.h>
+
+static int histogram_RGB101010(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_R = self->channels[0];
+	gp_histogram_channel *chan_G = self->channels[1];
+	gp_histogram_channel *chan_B = self->channels[2];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y);
+			int32_t R = GP_PIXEL_GET_R_RGB101010(pix);
+			int32_t G = GP_PIXEL_GET_G_RGB101010(pix);
+			int32_t B = GP_PIXEL_GET_B_RGB101010(pix);
+
+			chan_R->hist[R]++;
+			chan_G->hist[G]++;
+			chan_B->hist[B]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_xRGB8888(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_R = self->channels[0];
+	gp_histogram_channel *chan_G = self->channels[1];
+	gp_histogram_channel *chan_B = self->channels[2];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y);
+			int32_t R = GP_PIXEL_GET_R_xRGB8888(pix);
+			int32_t G = GP_PIXEL_GET_G_xRGB8888(pix);
+			int32_t B = GP_PIXEL_GET_B_xRGB8888(pix);
+
+			chan_R->hist[R]++;
+			chan_G->hist[G]++;
+			chan_B->hist[B]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_RGBA8888(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_R = self->channels[0];
+	gp_histogram_channel *chan_G = self->channels[1];
+	gp_histogram_channel *chan_B = self->channels[2];
+	gp_histogram_channel *chan_A = self->channels[3];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y);
+			int32_t R = GP_PIXEL_GET_R_RGBA8888(pix);
+			int32_t G = GP_PIXEL_GET_G_RGBA8888(pix);
+			int32_t B = GP_PIXEL_GET_B_RGBA8888(pix);
+			int32_t A = GP_PIXEL_GET_A_RGBA8888(pix);
+
+			chan_R->hist[R]++;
+			chan_G->hist[G]++;
+			chan_B->hist[B]++;
+			chan_A->hist[A]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_RGB888(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_R = self->channels[0];
+	gp_histogram_channel *chan_G = self->channels[1];
+	gp_histogram_channel *chan_B = self->channels[2];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x, y);
+			int32_t R = GP_PIXEL_GET_R_RGB888(pix);
+			int32_t G = GP_PIXEL_GET_G_RGB888(pix);
+			int32_t B = GP_PIXEL_GET_B_RGB888(pix);
+
+			chan_R->hist[R]++;
+			chan_G->hist[G]++;
+			chan_B->hist[B]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_BGR888(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_B = self->channels[0];
+	gp_histogram_channel *chan_G = self->channels[1];
+	gp_histogram_channel *chan_R = self->channels[2];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x, y);
+			int32_t B = GP_PIXEL_GET_B_BGR888(pix);
+			int32_t G = GP_PIXEL_GET_G_BGR888(pix);
+			int32_t R = GP_PIXEL_GET_R_BGR888(pix);
+
+			chan_B->hist[B]++;
+			chan_G->hist[G]++;
+			chan_R->hist[R]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_RGB555(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_R = self->channels[0];
+	gp_histogram_channel *chan_G = self->channels[1];
+	gp_histogram_channel *chan_B = self->channels[2];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, x, y);
+			int32_t R = GP_PIXEL_GET_R_RGB555(pix);
+			int32_t G = GP_PIXEL_GET_G_RGB555(pix);
+			int32_t B = GP_PIXEL_GET_B_RGB555(pix);
+
+			chan_R->hist[R]++;
+			chan_G->hist[G]++;
+			chan_B->hist[B]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_RGB565(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_R = self->channels[0];
+	gp_histogram_channel *chan_G = self->channels[1];
+	gp_histogram_channel *chan_B = self->channels[2];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, x, y);
+			int32_t R = GP_PIXEL_GET_R_RGB565(pix);
+			int32_t G = GP_PIXEL_GET_G_RGB565(pix);
+			int32_t B = GP_PIXEL_GET_B_RGB565(pix);
+
+			chan_R->hist[R]++;
+			chan_G->hist[G]++;
+			chan_B->hist[B]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_RGB666(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_R = self->channels[0];
+	gp_histogram_channel *chan_G = self->channels[1];
+	gp_histogram_channel *chan_B = self->channels[2];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, x, y);
+			int32_t R = GP_PIXEL_GET_R_RGB666(pix);
+			int32_t G = GP_PIXEL_GET_G_RGB666(pix);
+			int32_t B = GP_PIXEL_GET_B_RGB666(pix);
+
+			chan_R->hist[R]++;
+			chan_G->hist[G]++;
+			chan_B->hist[B]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_RGB332(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_R = self->channels[0];
+	gp_histogram_channel *chan_G = self->channels[1];
+	gp_histogram_channel *chan_B = self->channels[2];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x, y);
+			int32_t R = GP_PIXEL_GET_R_RGB332(pix);
+			int32_t G = GP_PIXEL_GET_G_RGB332(pix);
+			int32_t B = GP_PIXEL_GET_B_RGB332(pix);
+
+			chan_R->hist[R]++;
+			chan_G->hist[G]++;
+			chan_B->hist[B]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_CMYK8888(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_K = self->channels[0];
+	gp_histogram_channel *chan_Y = self->channels[1];
+	gp_histogram_channel *chan_M = self->channels[2];
+	gp_histogram_channel *chan_C = self->channels[3];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y);
+			int32_t K = GP_PIXEL_GET_K_CMYK8888(pix);
+			int32_t Y = GP_PIXEL_GET_Y_CMYK8888(pix);
+			int32_t M = GP_PIXEL_GET_M_CMYK8888(pix);
+			int32_t C = GP_PIXEL_GET_C_CMYK8888(pix);
+
+			chan_K->hist[K]++;
+			chan_Y->hist[Y]++;
+			chan_M->hist[M]++;
+			chan_C->hist[C]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_G1_DB(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_V = self->channels[0];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, x, y);
+			int32_t V = GP_PIXEL_GET_V_G1_DB(pix);
+
+			chan_V->hist[V]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_G2_DB(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_V = self->channels[0];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, x, y);
+			int32_t V = GP_PIXEL_GET_V_G2_DB(pix);
+
+			chan_V->hist[V]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_G4_DB(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_V = self->channels[0];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, x, y);
+			int32_t V = GP_PIXEL_GET_V_G4_DB(pix);
+
+			chan_V->hist[V]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_G1_UB(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_V = self->channels[0];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, x, y);
+			int32_t V = GP_PIXEL_GET_V_G1_UB(pix);
+
+			chan_V->hist[V]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_G2_UB(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_V = self->channels[0];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, x, y);
+			int32_t V = GP_PIXEL_GET_V_G2_UB(pix);
+
+			chan_V->hist[V]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_G4_UB(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_V = self->channels[0];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, x, y);
+			int32_t V = GP_PIXEL_GET_V_G4_UB(pix);
+
+			chan_V->hist[V]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_G8(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_V = self->channels[0];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x, y);
+			int32_t V = GP_PIXEL_GET_V_G8(pix);
+
+			chan_V->hist[V]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_GA88(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_V = self->channels[0];
+	gp_histogram_channel *chan_A = self->channels[1];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, x, y);
+			int32_t V = GP_PIXEL_GET_V_GA88(pix);
+			int32_t A = GP_PIXEL_GET_A_GA88(pix);
+
+			chan_V->hist[V]++;
+			chan_A->hist[A]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int histogram_G16(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+{
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	gp_histogram_channel *chan_V = self->channels[0];
+
+	uint32_t x, y;
+
+	for (y = 0; y < src->h; y++) {
+		for (x = 0; x < src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, x, y);
+			int32_t V = GP_PIXEL_GET_V_G16(pix);
+
+			chan_V->hist[V]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+int gp_filter_histogram(gp_histogram *self, const gp_pixmap *src,
+                       gp_progress_cb *callback)
+{
+	unsigned int i, j;
+	int ret;
+
+	GP_DEBUG(1, "Running Histogram filter");
+
+	for (i = 0; i < gp_pixel_channel_count(self->pixel_type); i++) {
+		gp_histogram_channel *chan = self->channels[i];
+		memset(chan->hist, 0, sizeof(uint32_t) * chan->len);
+	}
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		ret = histogram_RGB101010(self, src, callback);
+	break;
+	case GP_PIXEL_xRGB8888:
+		ret = histogram_xRGB8888(self, src, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		ret = histogram_RGBA8888(self, src, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		ret = histogram_RGB888(self, src, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		ret = histogram_BGR888(self, src, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		ret = histogram_RGB555(self, src, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		ret = histogram_RGB565(self, src, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		ret = histogram_RGB666(self, src, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		ret = histogram_RGB332(self, src, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		ret = histogram_CMYK8888(self, src, callback);
+	break;
+	case GP_PIXEL_G1_DB:
+		ret = histogram_G1_DB(self, src, callback);
+	break;
+	case GP_PIXEL_G2_DB:
+		ret = histogram_G2_DB(self, src, callback);
+	break;
+	case GP_PIXEL_G4_DB:
+		ret = histogram_G4_DB(self, src, callback);
+	break;
+	case GP_PIXEL_G1_UB:
+		ret = histogram_G1_UB(self, src, callback);
+	break;
+	case GP_PIXEL_G2_UB:
+		ret = histogram_G2_UB(self, src, callback);
+	break;
+	case GP_PIXEL_G4_UB:
+		ret = histogram_G4_UB(self, src, callback);
+	break;
+	case GP_PIXEL_G8:
+		ret = histogram_G8(self, src, callback);
+	break;
+	case GP_PIXEL_GA88:
+		ret = histogram_GA88(self, src, callback);
+	break;
+	case GP_PIXEL_G16:
+		ret = histogram_G16(self, src, callback);
+	break;
+	default:
+		errno = ENOSYS;
+		return 1;
+	break;
+	}
+
+	if (ret)
+		return ret;
+
+	for (i = 0; i < gp_pixel_channel_count(self->pixel_type); i++) {
+		gp_histogram_channel *chan = self->channels[i];
+
+		chan->max = chan->hist[0];
+		chan->min = chan->hist[0];
+
+		for (j = 1; j < chan->len; j++) {
+			if (chan->hist[j] > chan->max)
+				chan->max = chan->hist[j];
+
+			if (chan->hist[j] < chan->min)
+				chan->min = chan->hist[j];
+		}
+	}
+
+	return 0;
+}
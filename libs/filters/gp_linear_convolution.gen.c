@@ -0,0 +1,6870 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_linear_convolution.gen.c
+ *
+ * GENERATED on 2026 10 19 15:08:13 from gp_linear_convolution.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Linear Convolution
+ *
+ * Copyright (C) 2009-2024 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_clamp.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_linear.h>
+
+#define MUL 1024
+
+
+static int h_lin_conv_RGB101010(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_B(src);
+	uint16_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_R(dst);
+	uint16_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_G(dst);
+	uint16_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB101010_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB101010_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB101010_LIN(pix, B_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB101010_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB101010_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB101010_LIN(pix, B_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB101010_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB101010_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB101010_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + x;
+			int32_t G_sum = MUL/2;
+			int *pG = G + x;
+			int32_t B_sum = MUL/2;
+			int *pB = B + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_RGB101010_ENC(
+					R_res, G_res, B_res,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_xRGB8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_xRGB8888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_xRGB8888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_xRGB8888_LIN(pix, B_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_xRGB8888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_xRGB8888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_xRGB8888_LIN(pix, B_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_xRGB8888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_xRGB8888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_xRGB8888_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + x;
+			int32_t G_sum = MUL/2;
+			int *pG = G + x;
+			int32_t B_sum = MUL/2;
+			int *pB = B + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_xRGB8888_ENC(
+					R_res, G_res, B_res,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGBA8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_B(src);
+	uint8_t *A_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_A(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_B(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_A(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_B(src);
+	gp_pixel A_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_A(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 4 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *A = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGBA8888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGBA8888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGBA8888_LIN(pix, B_gamma_lin);
+			A[i] = GP_PIXEL_GET_A_RGBA8888_LIN(pix, A_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGBA8888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGBA8888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGBA8888_LIN(pix, B_gamma_lin);
+			A[i] = GP_PIXEL_GET_A_RGBA8888_LIN(pix, A_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGBA8888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGBA8888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGBA8888_LIN(pix, B_gamma_lin);
+			A[i] = GP_PIXEL_GET_A_RGBA8888_LIN(pix, A_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + x;
+			int32_t G_sum = MUL/2;
+			int *pG = G + x;
+			int32_t B_sum = MUL/2;
+			int *pB = B + x;
+			int32_t A_sum = MUL/2;
+			int *pA = A + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+				A_sum += (*pA++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+			A_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+			gp_pixel A_res = GP_CLAMP(A_sum, 0, (int)A_lin_max);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_RGBA8888_ENC(
+					R_res, G_res, B_res, A_res,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc, A_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_24BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB888_LIN(pix, B_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB888_LIN(pix, B_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB888_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + x;
+			int32_t G_sum = MUL/2;
+			int *pG = G + x;
+			int32_t B_sum = MUL/2;
+			int *pB = B + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_RGB888_ENC(
+					R_res, G_res, B_res,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_BGR888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_B(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_G(src);
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_R(src);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_B(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_G(dst);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_R(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_B(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_G(src);
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_R(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_24BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			B[i] = GP_PIXEL_GET_B_BGR888_LIN(pix, B_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_BGR888_LIN(pix, G_gamma_lin);
+			R[i] = GP_PIXEL_GET_R_BGR888_LIN(pix, R_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			B[i] = GP_PIXEL_GET_B_BGR888_LIN(pix, B_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_BGR888_LIN(pix, G_gamma_lin);
+			R[i] = GP_PIXEL_GET_R_BGR888_LIN(pix, R_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			B[i] = GP_PIXEL_GET_B_BGR888_LIN(pix, B_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_BGR888_LIN(pix, G_gamma_lin);
+			R[i] = GP_PIXEL_GET_R_BGR888_LIN(pix, R_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t B_sum = MUL/2;
+			int *pB = B + x;
+			int32_t G_sum = MUL/2;
+			int *pG = G + x;
+			int32_t R_sum = MUL/2;
+			int *pR = R + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				B_sum += (*pB++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				R_sum += (*pR++) * ikernel[i];
+			}
+
+			/* divide the result */
+			B_sum /= ikern_div;
+			G_sum /= ikern_div;
+			R_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_BGR888_ENC(
+					B_res, G_res, R_res,
+					B_gamma_enc, G_gamma_enc, R_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB555(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB555_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB555_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB555_LIN(pix, B_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB555_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB555_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB555_LIN(pix, B_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB555_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB555_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB555_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + x;
+			int32_t G_sum = MUL/2;
+			int *pG = G + x;
+			int32_t B_sum = MUL/2;
+			int *pB = B + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_RGB555_ENC(
+					R_res, G_res, B_res,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB565(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB565_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB565_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB565_LIN(pix, B_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB565_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB565_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB565_LIN(pix, B_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB565_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB565_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB565_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + x;
+			int32_t G_sum = MUL/2;
+			int *pG = G + x;
+			int32_t B_sum = MUL/2;
+			int *pB = B + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_RGB565_ENC(
+					R_res, G_res, B_res,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB666(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB666_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB666_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB666_LIN(pix, B_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_18BPP_DB(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB666_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB666_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB666_LIN(pix, B_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB666_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB666_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB666_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + x;
+			int32_t G_sum = MUL/2;
+			int *pG = G + x;
+			int32_t B_sum = MUL/2;
+			int *pB = B + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_18BPP_DB(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_RGB666_ENC(
+					R_res, G_res, B_res,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB332(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_8BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB332_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB332_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB332_LIN(pix, B_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB332_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB332_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB332_LIN(pix, B_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB332_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB332_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB332_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + x;
+			int32_t G_sum = MUL/2;
+			int *pG = G + x;
+			int32_t B_sum = MUL/2;
+			int *pB = B + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_RGB332_ENC(
+					R_res, G_res, B_res,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_CMYK8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *K_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_K(src);
+	uint8_t *Y_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_Y(src);
+	uint8_t *M_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_M(src);
+	uint8_t *C_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_C(src);
+	uint8_t *K_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_K(dst);
+	uint8_t *Y_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_Y(dst);
+	uint8_t *M_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_M(dst);
+	uint8_t *C_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_C(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel K_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_K(src);
+	gp_pixel Y_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_Y(src);
+	gp_pixel M_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_M(src);
+	gp_pixel C_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_C(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 4 * size * sizeof(int));
+
+	int *K = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *Y = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *M = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *C = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			K[i] = GP_PIXEL_GET_K_CMYK8888_LIN(pix, K_gamma_lin);
+			Y[i] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix, Y_gamma_lin);
+			M[i] = GP_PIXEL_GET_M_CMYK8888_LIN(pix, M_gamma_lin);
+			C[i] = GP_PIXEL_GET_C_CMYK8888_LIN(pix, C_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			K[i] = GP_PIXEL_GET_K_CMYK8888_LIN(pix, K_gamma_lin);
+			Y[i] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix, Y_gamma_lin);
+			M[i] = GP_PIXEL_GET_M_CMYK8888_LIN(pix, M_gamma_lin);
+			C[i] = GP_PIXEL_GET_C_CMYK8888_LIN(pix, C_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			K[i] = GP_PIXEL_GET_K_CMYK8888_LIN(pix, K_gamma_lin);
+			Y[i] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix, Y_gamma_lin);
+			M[i] = GP_PIXEL_GET_M_CMYK8888_LIN(pix, M_gamma_lin);
+			C[i] = GP_PIXEL_GET_C_CMYK8888_LIN(pix, C_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t K_sum = MUL/2;
+			int *pK = K + x;
+			int32_t Y_sum = MUL/2;
+			int *pY = Y + x;
+			int32_t M_sum = MUL/2;
+			int *pM = M + x;
+			int32_t C_sum = MUL/2;
+			int *pC = C + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				K_sum += (*pK++) * ikernel[i];
+				Y_sum += (*pY++) * ikernel[i];
+				M_sum += (*pM++) * ikernel[i];
+				C_sum += (*pC++) * ikernel[i];
+			}
+
+			/* divide the result */
+			K_sum /= ikern_div;
+			Y_sum /= ikern_div;
+			M_sum /= ikern_div;
+			C_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel K_res = GP_CLAMP(K_sum, 0, (int)K_lin_max);
+			gp_pixel Y_res = GP_CLAMP(Y_sum, 0, (int)Y_lin_max);
+			gp_pixel M_res = GP_CLAMP(M_sum, 0, (int)M_lin_max);
+			gp_pixel C_res = GP_CLAMP(C_sum, 0, (int)C_lin_max);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_CMYK8888_ENC(
+					K_res, Y_res, M_res, C_res,
+					K_gamma_enc, Y_gamma_enc, M_gamma_enc, C_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G1_DB(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_DB_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G1_DB_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G1_DB_LIN(pix, V_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_1BPP_DB(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G1_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G1_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_1BPP_DB(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_G1_DB_ENC(
+					V_res,
+					V_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G2_DB(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_DB_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G2_DB_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G2_DB_LIN(pix, V_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_2BPP_DB(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G2_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G2_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_2BPP_DB(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_G2_DB_ENC(
+					V_res,
+					V_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G4_DB(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_DB_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G4_DB_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G4_DB_LIN(pix, V_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_4BPP_DB(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G4_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G4_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_4BPP_DB(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_G4_DB_ENC(
+					V_res,
+					V_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G1_UB(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_UB_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G1_UB_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G1_UB_LIN(pix, V_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_1BPP_UB(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G1_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G1_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_1BPP_UB(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_G1_UB_ENC(
+					V_res,
+					V_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G2_UB(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_UB_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G2_UB_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G2_UB_LIN(pix, V_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_2BPP_UB(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G2_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G2_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_2BPP_UB(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_G2_UB_ENC(
+					V_res,
+					V_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G4_UB(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_UB_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G4_UB_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G4_UB_LIN(pix, V_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_4BPP_UB(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G4_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G4_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_4BPP_UB(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_G4_UB_ENC(
+					V_res,
+					V_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G8(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G8_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G8_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G8_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_8BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G8_LIN(pix, V_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G8_LIN(pix, V_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G8_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_G8_ENC(
+					V_res,
+					V_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_GA88(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_V(src);
+	uint8_t *A_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_A(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_V(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_A(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_GA88_V(src);
+	gp_pixel A_lin_max = GP_CHAN_LIN_MAX_VAL_GA88_A(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 2 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *A = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_GA88_LIN(pix, V_gamma_lin);
+			A[i] = GP_PIXEL_GET_A_GA88_LIN(pix, A_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_GA88_LIN(pix, V_gamma_lin);
+			A[i] = GP_PIXEL_GET_A_GA88_LIN(pix, A_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_GA88_LIN(pix, V_gamma_lin);
+			A[i] = GP_PIXEL_GET_A_GA88_LIN(pix, A_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + x;
+			int32_t A_sum = MUL/2;
+			int *pA = A + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				V_sum += (*pV++) * ikernel[i];
+				A_sum += (*pA++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+			A_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+			gp_pixel A_res = GP_CLAMP(A_sum, 0, (int)A_lin_max);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_GA88_ENC(
+					V_res, A_res,
+					V_gamma_enc, A_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G16(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G16_V(src);
+	uint16_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G16_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G16_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kw; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G16_LIN(pix, V_gamma_lin);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G16_LIN(pix, V_gamma_lin);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G16_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + x;
+
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+				GP_PIXEL_CREATE_G16_ENC(
+					V_res,
+					V_gamma_enc
+				));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+int gp_filter_hlinear_convolution_raw(const gp_pixmap *src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      float kernel[], uint32_t kw, float kern_div,
+				      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Horizontal linear convolution kernel width %u "
+	            "offset %ix%i rectangle %ux%u src->gamma %p dst->gamma %p",
+		    kw, x_src, y_src, w_src, h_src, src->gamma, dst->gamma);
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return h_lin_conv_RGB101010(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_xRGB8888:
+		return h_lin_conv_xRGB8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return h_lin_conv_RGBA8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return h_lin_conv_RGB888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return h_lin_conv_BGR888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return h_lin_conv_RGB555(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return h_lin_conv_RGB565(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return h_lin_conv_RGB666(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return h_lin_conv_RGB332(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return h_lin_conv_CMYK8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G1_DB:
+		return h_lin_conv_G1_DB(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G2_DB:
+		return h_lin_conv_G2_DB(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G4_DB:
+		return h_lin_conv_G4_DB(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G1_UB:
+		return h_lin_conv_G1_UB(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G2_UB:
+		return h_lin_conv_G2_UB(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G4_UB:
+		return h_lin_conv_G4_UB(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G8:
+		return h_lin_conv_G8(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return h_lin_conv_GA88(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G16:
+		return h_lin_conv_G16(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+
+static int v_lin_conv_RGB101010(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_B(src);
+	uint16_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_R(dst);
+	uint16_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_G(dst);
+	uint16_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB101010_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB101010_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB101010_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB101010_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB101010_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB101010_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB101010_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB101010_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB101010_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t R_sum = MUL/2;
+			int *pR = R + y;
+			int64_t G_sum = MUL/2;
+			int *pG = G + y;
+			int64_t B_sum = MUL/2;
+			int *pB = B + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB101010_ENC(
+					      R_res, G_res, B_res,
+					      R_gamma_enc, G_gamma_enc, B_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_xRGB8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_xRGB8888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_xRGB8888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_xRGB8888_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_xRGB8888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_xRGB8888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_xRGB8888_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_xRGB8888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_xRGB8888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_xRGB8888_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t R_sum = MUL/2;
+			int *pR = R + y;
+			int64_t G_sum = MUL/2;
+			int *pG = G + y;
+			int64_t B_sum = MUL/2;
+			int *pB = B + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_xRGB8888_ENC(
+					      R_res, G_res, B_res,
+					      R_gamma_enc, G_gamma_enc, B_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGBA8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_B(src);
+	uint8_t *A_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_A(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_B(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_A(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_B(src);
+	gp_pixel A_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_A(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 4 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *A = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGBA8888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGBA8888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGBA8888_LIN(pix, B_gamma_lin);
+			A[i] = GP_PIXEL_GET_A_RGBA8888_LIN(pix, A_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGBA8888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGBA8888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGBA8888_LIN(pix, B_gamma_lin);
+			A[i] = GP_PIXEL_GET_A_RGBA8888_LIN(pix, A_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGBA8888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGBA8888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGBA8888_LIN(pix, B_gamma_lin);
+			A[i] = GP_PIXEL_GET_A_RGBA8888_LIN(pix, A_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t R_sum = MUL/2;
+			int *pR = R + y;
+			int64_t G_sum = MUL/2;
+			int *pG = G + y;
+			int64_t B_sum = MUL/2;
+			int *pB = B + y;
+			int64_t A_sum = MUL/2;
+			int *pA = A + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+				A_sum += (*pA++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+			A_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+			gp_pixel A_res = GP_CLAMP(A_sum, 0, (int)A_lin_max);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGBA8888_ENC(
+					      R_res, G_res, B_res, A_res,
+					      R_gamma_enc, G_gamma_enc, B_gamma_enc, A_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB888_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB888_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB888_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB888_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB888_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t R_sum = MUL/2;
+			int *pR = R + y;
+			int64_t G_sum = MUL/2;
+			int *pG = G + y;
+			int64_t B_sum = MUL/2;
+			int *pB = B + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB888_ENC(
+					      R_res, G_res, B_res,
+					      R_gamma_enc, G_gamma_enc, B_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_BGR888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_B(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_G(src);
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_R(src);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_B(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_G(dst);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_R(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_B(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_G(src);
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_R(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			B[i] = GP_PIXEL_GET_B_BGR888_LIN(pix, B_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_BGR888_LIN(pix, G_gamma_lin);
+			R[i] = GP_PIXEL_GET_R_BGR888_LIN(pix, R_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			B[i] = GP_PIXEL_GET_B_BGR888_LIN(pix, B_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_BGR888_LIN(pix, G_gamma_lin);
+			R[i] = GP_PIXEL_GET_R_BGR888_LIN(pix, R_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			B[i] = GP_PIXEL_GET_B_BGR888_LIN(pix, B_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_BGR888_LIN(pix, G_gamma_lin);
+			R[i] = GP_PIXEL_GET_R_BGR888_LIN(pix, R_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t B_sum = MUL/2;
+			int *pB = B + y;
+			int64_t G_sum = MUL/2;
+			int *pG = G + y;
+			int64_t R_sum = MUL/2;
+			int *pR = R + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				B_sum += (*pB++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				R_sum += (*pR++) * ikernel[i];
+			}
+
+			/* divide the result */
+			B_sum /= ikern_div;
+			G_sum /= ikern_div;
+			R_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_BGR888_ENC(
+					      B_res, G_res, R_res,
+					      B_gamma_enc, G_gamma_enc, R_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB555(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB555_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB555_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB555_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB555_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB555_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB555_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB555_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB555_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB555_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t R_sum = MUL/2;
+			int *pR = R + y;
+			int64_t G_sum = MUL/2;
+			int *pG = G + y;
+			int64_t B_sum = MUL/2;
+			int *pB = B + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB555_ENC(
+					      R_res, G_res, B_res,
+					      R_gamma_enc, G_gamma_enc, B_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB565(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB565_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB565_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB565_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB565_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB565_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB565_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB565_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB565_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB565_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t R_sum = MUL/2;
+			int *pR = R + y;
+			int64_t G_sum = MUL/2;
+			int *pG = G + y;
+			int64_t B_sum = MUL/2;
+			int *pB = B + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB565_ENC(
+					      R_res, G_res, B_res,
+					      R_gamma_enc, G_gamma_enc, B_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB666(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB666_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB666_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB666_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_18BPP_DB(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB666_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB666_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB666_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB666_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB666_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB666_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t R_sum = MUL/2;
+			int *pR = R + y;
+			int64_t G_sum = MUL/2;
+			int *pG = G + y;
+			int64_t B_sum = MUL/2;
+			int *pB = B + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_18BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB666_ENC(
+					      R_res, G_res, B_res,
+					      R_gamma_enc, G_gamma_enc, B_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB332(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_B(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_B(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB332_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB332_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB332_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB332_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB332_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB332_LIN(pix, B_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB332_LIN(pix, R_gamma_lin);
+			G[i] = GP_PIXEL_GET_G_RGB332_LIN(pix, G_gamma_lin);
+			B[i] = GP_PIXEL_GET_B_RGB332_LIN(pix, B_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t R_sum = MUL/2;
+			int *pR = R + y;
+			int64_t G_sum = MUL/2;
+			int *pG = G + y;
+			int64_t B_sum = MUL/2;
+			int *pB = B + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel R_res = GP_CLAMP(R_sum, 0, (int)R_lin_max);
+			gp_pixel G_res = GP_CLAMP(G_sum, 0, (int)G_lin_max);
+			gp_pixel B_res = GP_CLAMP(B_sum, 0, (int)B_lin_max);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB332_ENC(
+					      R_res, G_res, B_res,
+					      R_gamma_enc, G_gamma_enc, B_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_CMYK8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *K_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_K(src);
+	uint8_t *Y_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_Y(src);
+	uint8_t *M_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_M(src);
+	uint8_t *C_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_C(src);
+	uint8_t *K_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_K(dst);
+	uint8_t *Y_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_Y(dst);
+	uint8_t *M_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_M(dst);
+	uint8_t *C_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_C(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel K_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_K(src);
+	gp_pixel Y_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_Y(src);
+	gp_pixel M_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_M(src);
+	gp_pixel C_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_C(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 4 * size * sizeof(int));
+
+	int *K = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *Y = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *M = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *C = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			K[i] = GP_PIXEL_GET_K_CMYK8888_LIN(pix, K_gamma_lin);
+			Y[i] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix, Y_gamma_lin);
+			M[i] = GP_PIXEL_GET_M_CMYK8888_LIN(pix, M_gamma_lin);
+			C[i] = GP_PIXEL_GET_C_CMYK8888_LIN(pix, C_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			K[i] = GP_PIXEL_GET_K_CMYK8888_LIN(pix, K_gamma_lin);
+			Y[i] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix, Y_gamma_lin);
+			M[i] = GP_PIXEL_GET_M_CMYK8888_LIN(pix, M_gamma_lin);
+			C[i] = GP_PIXEL_GET_C_CMYK8888_LIN(pix, C_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			K[i] = GP_PIXEL_GET_K_CMYK8888_LIN(pix, K_gamma_lin);
+			Y[i] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix, Y_gamma_lin);
+			M[i] = GP_PIXEL_GET_M_CMYK8888_LIN(pix, M_gamma_lin);
+			C[i] = GP_PIXEL_GET_C_CMYK8888_LIN(pix, C_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t K_sum = MUL/2;
+			int *pK = K + y;
+			int64_t Y_sum = MUL/2;
+			int *pY = Y + y;
+			int64_t M_sum = MUL/2;
+			int *pM = M + y;
+			int64_t C_sum = MUL/2;
+			int *pC = C + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				K_sum += (*pK++) * ikernel[i];
+				Y_sum += (*pY++) * ikernel[i];
+				M_sum += (*pM++) * ikernel[i];
+				C_sum += (*pC++) * ikernel[i];
+			}
+
+			/* divide the result */
+			K_sum /= ikern_div;
+			Y_sum /= ikern_div;
+			M_sum /= ikern_div;
+			C_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel K_res = GP_CLAMP(K_sum, 0, (int)K_lin_max);
+			gp_pixel Y_res = GP_CLAMP(Y_sum, 0, (int)Y_lin_max);
+			gp_pixel M_res = GP_CLAMP(M_sum, 0, (int)M_lin_max);
+			gp_pixel C_res = GP_CLAMP(C_sum, 0, (int)C_lin_max);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_CMYK8888_ENC(
+					      K_res, Y_res, M_res, C_res,
+					      K_gamma_enc, Y_gamma_enc, M_gamma_enc, C_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G1_DB(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_DB_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G1_DB_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G1_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_1BPP_DB(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G1_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G1_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t V_sum = MUL/2;
+			int *pV = V + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_1BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G1_DB_ENC(
+					      V_res,
+					      V_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G2_DB(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_DB_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G2_DB_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G2_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_2BPP_DB(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G2_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G2_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t V_sum = MUL/2;
+			int *pV = V + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_2BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G2_DB_ENC(
+					      V_res,
+					      V_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G4_DB(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_DB_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G4_DB_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G4_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_4BPP_DB(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G4_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G4_DB_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t V_sum = MUL/2;
+			int *pV = V + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_4BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G4_DB_ENC(
+					      V_res,
+					      V_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G1_UB(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_UB_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G1_UB_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G1_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_1BPP_UB(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G1_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G1_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t V_sum = MUL/2;
+			int *pV = V + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_1BPP_UB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G1_UB_ENC(
+					      V_res,
+					      V_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G2_UB(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_UB_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G2_UB_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G2_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_2BPP_UB(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G2_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G2_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t V_sum = MUL/2;
+			int *pV = V + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_2BPP_UB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G2_UB_ENC(
+					      V_res,
+					      V_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G4_UB(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_UB_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G4_UB_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G4_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_4BPP_UB(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G4_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G4_UB_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t V_sum = MUL/2;
+			int *pV = V + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_4BPP_UB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G4_UB_ENC(
+					      V_res,
+					      V_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G8(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G8_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G8_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G8_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G8_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G8_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G8_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t V_sum = MUL/2;
+			int *pV = V + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G8_ENC(
+					      V_res,
+					      V_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_GA88(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_V(src);
+	uint8_t *A_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_A(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_V(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_A(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_GA88_V(src);
+	gp_pixel A_lin_max = GP_CHAN_LIN_MAX_VAL_GA88_A(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 2 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *A = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_GA88_LIN(pix, V_gamma_lin);
+			A[i] = GP_PIXEL_GET_A_GA88_LIN(pix, A_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_GA88_LIN(pix, V_gamma_lin);
+			A[i] = GP_PIXEL_GET_A_GA88_LIN(pix, A_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_GA88_LIN(pix, V_gamma_lin);
+			A[i] = GP_PIXEL_GET_A_GA88_LIN(pix, A_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t V_sum = MUL/2;
+			int *pV = V + y;
+			int64_t A_sum = MUL/2;
+			int *pA = A + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+				A_sum += (*pA++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+			A_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+			gp_pixel A_res = GP_CLAMP(A_sum, 0, (int)A_lin_max);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_GA88_ENC(
+					      V_res, A_res,
+					      V_gamma_enc, A_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G16(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Fetch gamma tables */
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G16_V(src);
+	uint16_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G16_V(dst);
+
+	/* Fetch maximal values for linearized channels */
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G16_V(src);
+
+	ikern_div = 0;
+	(void) kern_div;
+
+	for (i = 0; i < kh; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+		ikern_div += ikernel[i];
+	}
+
+	GP_ASSERT(ikern_div != 0);
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G16_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G16_LIN(pix, V_gamma_lin);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G16_LIN(pix, V_gamma_lin);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int64_t V_sum = MUL/2;
+			int *pV = V + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			gp_pixel V_res = GP_CLAMP(V_sum, 0, (int)V_lin_max);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G16_ENC(
+					      V_res,
+					      V_gamma_enc
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+int gp_filter_vlinear_convolution_raw(const gp_pixmap *src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      float kernel[], uint32_t kh, float kern_div,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Vertical linear convolution kernel width %u "
+	            "offset %ix%i rectangle %ux%u",
+		    kh, x_src, y_src, w_src, h_src);
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return v_lin_conv_RGB101010(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_xRGB8888:
+		return v_lin_conv_xRGB8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return v_lin_conv_RGBA8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return v_lin_conv_RGB888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return v_lin_conv_BGR888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return v_lin_conv_RGB555(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return v_lin_conv_RGB565(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return v_lin_conv_RGB666(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return v_lin_conv_RGB332(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return v_lin_conv_CMYK8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G1_DB:
+		return v_lin_conv_G1_DB(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G2_DB:
+		return v_lin_conv_G2_DB(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G4_DB:
+		return v_lin_conv_G4_DB(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G1_UB:
+		return v_lin_conv_G1_UB(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G2_UB:
+		return v_lin_conv_G2_UB(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G4_UB:
+		return v_lin_conv_G4_UB(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G8:
+		return v_lin_conv_G8(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return v_lin_conv_GA88(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G16:
+		return v_lin_conv_G16(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+
+static int lin_conv_RGB101010(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_B(src);
+	uint16_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_R(dst);
+	uint16_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_G(dst);
+	uint16_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_B(dst);
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_B(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGB101010_LIN(pix, R_gamma_lin);
+				G[i][j] = GP_PIXEL_GET_G_RGB101010_LIN(pix, G_gamma_lin);
+				B[i][j] = GP_PIXEL_GET_B_RGB101010_LIN(pix, B_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGB101010_LIN(pix, R_gamma_lin);
+				G[idx][j] = GP_PIXEL_GET_G_RGB101010_LIN(pix, G_gamma_lin);
+				B[idx][j] = GP_PIXEL_GET_B_RGB101010_LIN(pix, B_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, (int)R_lin_max);
+			int G_res = GP_CLAMP((int)G_sum, 0, (int)G_lin_max);
+			int B_res = GP_CLAMP((int)B_sum, 0, (int)B_lin_max);
+
+			pix = GP_PIXEL_CREATE_RGB101010_ENC(R_res, G_res, B_res, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_xRGB8888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_B(dst);
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_B(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_xRGB8888_LIN(pix, R_gamma_lin);
+				G[i][j] = GP_PIXEL_GET_G_xRGB8888_LIN(pix, G_gamma_lin);
+				B[i][j] = GP_PIXEL_GET_B_xRGB8888_LIN(pix, B_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_xRGB8888_LIN(pix, R_gamma_lin);
+				G[idx][j] = GP_PIXEL_GET_G_xRGB8888_LIN(pix, G_gamma_lin);
+				B[idx][j] = GP_PIXEL_GET_B_xRGB8888_LIN(pix, B_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, (int)R_lin_max);
+			int G_res = GP_CLAMP((int)G_sum, 0, (int)G_lin_max);
+			int B_res = GP_CLAMP((int)B_sum, 0, (int)B_lin_max);
+
+			pix = GP_PIXEL_CREATE_xRGB8888_ENC(R_res, G_res, B_res, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGBA8888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_B(src);
+	uint8_t *A_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_A(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_B(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_A(dst);
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_B(src);
+	gp_pixel A_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_A(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		uint32_t A[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGBA8888_LIN(pix, R_gamma_lin);
+				G[i][j] = GP_PIXEL_GET_G_RGBA8888_LIN(pix, G_gamma_lin);
+				B[i][j] = GP_PIXEL_GET_B_RGBA8888_LIN(pix, B_gamma_lin);
+				A[i][j] = GP_PIXEL_GET_A_RGBA8888_LIN(pix, A_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+			float A_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGBA8888_LIN(pix, R_gamma_lin);
+				G[idx][j] = GP_PIXEL_GET_G_RGBA8888_LIN(pix, G_gamma_lin);
+				B[idx][j] = GP_PIXEL_GET_B_RGBA8888_LIN(pix, B_gamma_lin);
+				A[idx][j] = GP_PIXEL_GET_A_RGBA8888_LIN(pix, A_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+					A_sum += A[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+			A_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, (int)R_lin_max);
+			int G_res = GP_CLAMP((int)G_sum, 0, (int)G_lin_max);
+			int B_res = GP_CLAMP((int)B_sum, 0, (int)B_lin_max);
+			int A_res = GP_CLAMP((int)A_sum, 0, (int)A_lin_max);
+
+			pix = GP_PIXEL_CREATE_RGBA8888_ENC(R_res, G_res, B_res, A_res, R_gamma_enc, G_gamma_enc, B_gamma_enc, A_gamma_enc);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_B(dst);
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_B(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGB888_LIN(pix, R_gamma_lin);
+				G[i][j] = GP_PIXEL_GET_G_RGB888_LIN(pix, G_gamma_lin);
+				B[i][j] = GP_PIXEL_GET_B_RGB888_LIN(pix, B_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGB888_LIN(pix, R_gamma_lin);
+				G[idx][j] = GP_PIXEL_GET_G_RGB888_LIN(pix, G_gamma_lin);
+				B[idx][j] = GP_PIXEL_GET_B_RGB888_LIN(pix, B_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, (int)R_lin_max);
+			int G_res = GP_CLAMP((int)G_sum, 0, (int)G_lin_max);
+			int B_res = GP_CLAMP((int)B_sum, 0, (int)B_lin_max);
+
+			pix = GP_PIXEL_CREATE_RGB888_ENC(R_res, G_res, B_res, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_BGR888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_B(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_G(src);
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_R(src);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_B(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_G(dst);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_R(dst);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_B(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_G(src);
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_R(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t B[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t R[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+				B[i][j] = GP_PIXEL_GET_B_BGR888_LIN(pix, B_gamma_lin);
+				G[i][j] = GP_PIXEL_GET_G_BGR888_LIN(pix, G_gamma_lin);
+				R[i][j] = GP_PIXEL_GET_R_BGR888_LIN(pix, R_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float B_sum = 0;
+			float G_sum = 0;
+			float R_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+				B[idx][j] = GP_PIXEL_GET_B_BGR888_LIN(pix, B_gamma_lin);
+				G[idx][j] = GP_PIXEL_GET_G_BGR888_LIN(pix, G_gamma_lin);
+				R[idx][j] = GP_PIXEL_GET_R_BGR888_LIN(pix, R_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					B_sum += B[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					R_sum += R[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			B_sum /= kern_div;
+			G_sum /= kern_div;
+			R_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int B_res = GP_CLAMP((int)B_sum, 0, (int)B_lin_max);
+			int G_res = GP_CLAMP((int)G_sum, 0, (int)G_lin_max);
+			int R_res = GP_CLAMP((int)R_sum, 0, (int)R_lin_max);
+
+			pix = GP_PIXEL_CREATE_BGR888_ENC(B_res, G_res, R_res, B_gamma_enc, G_gamma_enc, R_gamma_enc);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB555(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_B(dst);
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_B(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGB555_LIN(pix, R_gamma_lin);
+				G[i][j] = GP_PIXEL_GET_G_RGB555_LIN(pix, G_gamma_lin);
+				B[i][j] = GP_PIXEL_GET_B_RGB555_LIN(pix, B_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGB555_LIN(pix, R_gamma_lin);
+				G[idx][j] = GP_PIXEL_GET_G_RGB555_LIN(pix, G_gamma_lin);
+				B[idx][j] = GP_PIXEL_GET_B_RGB555_LIN(pix, B_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, (int)R_lin_max);
+			int G_res = GP_CLAMP((int)G_sum, 0, (int)G_lin_max);
+			int B_res = GP_CLAMP((int)B_sum, 0, (int)B_lin_max);
+
+			pix = GP_PIXEL_CREATE_RGB555_ENC(R_res, G_res, B_res, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB565(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_B(dst);
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_B(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGB565_LIN(pix, R_gamma_lin);
+				G[i][j] = GP_PIXEL_GET_G_RGB565_LIN(pix, G_gamma_lin);
+				B[i][j] = GP_PIXEL_GET_B_RGB565_LIN(pix, B_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGB565_LIN(pix, R_gamma_lin);
+				G[idx][j] = GP_PIXEL_GET_G_RGB565_LIN(pix, G_gamma_lin);
+				B[idx][j] = GP_PIXEL_GET_B_RGB565_LIN(pix, B_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, (int)R_lin_max);
+			int G_res = GP_CLAMP((int)G_sum, 0, (int)G_lin_max);
+			int B_res = GP_CLAMP((int)B_sum, 0, (int)B_lin_max);
+
+			pix = GP_PIXEL_CREATE_RGB565_ENC(R_res, G_res, B_res, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB666(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_B(dst);
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_B(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_18BPP_DB(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGB666_LIN(pix, R_gamma_lin);
+				G[i][j] = GP_PIXEL_GET_G_RGB666_LIN(pix, G_gamma_lin);
+				B[i][j] = GP_PIXEL_GET_B_RGB666_LIN(pix, B_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_18BPP_DB(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGB666_LIN(pix, R_gamma_lin);
+				G[idx][j] = GP_PIXEL_GET_G_RGB666_LIN(pix, G_gamma_lin);
+				B[idx][j] = GP_PIXEL_GET_B_RGB666_LIN(pix, B_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, (int)R_lin_max);
+			int G_res = GP_CLAMP((int)G_sum, 0, (int)G_lin_max);
+			int B_res = GP_CLAMP((int)B_sum, 0, (int)B_lin_max);
+
+			pix = GP_PIXEL_CREATE_RGB666_ENC(R_res, G_res, B_res, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_18BPP_DB(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB332(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_B(dst);
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_B(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGB332_LIN(pix, R_gamma_lin);
+				G[i][j] = GP_PIXEL_GET_G_RGB332_LIN(pix, G_gamma_lin);
+				B[i][j] = GP_PIXEL_GET_B_RGB332_LIN(pix, B_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGB332_LIN(pix, R_gamma_lin);
+				G[idx][j] = GP_PIXEL_GET_G_RGB332_LIN(pix, G_gamma_lin);
+				B[idx][j] = GP_PIXEL_GET_B_RGB332_LIN(pix, B_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, (int)R_lin_max);
+			int G_res = GP_CLAMP((int)G_sum, 0, (int)G_lin_max);
+			int B_res = GP_CLAMP((int)B_sum, 0, (int)B_lin_max);
+
+			pix = GP_PIXEL_CREATE_RGB332_ENC(R_res, G_res, B_res, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_CMYK8888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint8_t *K_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_K(src);
+	uint8_t *Y_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_Y(src);
+	uint8_t *M_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_M(src);
+	uint8_t *C_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_C(src);
+	uint8_t *K_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_K(dst);
+	uint8_t *Y_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_Y(dst);
+	uint8_t *M_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_M(dst);
+	uint8_t *C_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_C(dst);
+	gp_pixel K_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_K(src);
+	gp_pixel Y_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_Y(src);
+	gp_pixel M_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_M(src);
+	gp_pixel C_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_C(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t K[kw][kh];
+		uint32_t Y[kw][kh];
+		uint32_t M[kw][kh];
+		uint32_t C[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				K[i][j] = GP_PIXEL_GET_K_CMYK8888_LIN(pix, K_gamma_lin);
+				Y[i][j] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix, Y_gamma_lin);
+				M[i][j] = GP_PIXEL_GET_M_CMYK8888_LIN(pix, M_gamma_lin);
+				C[i][j] = GP_PIXEL_GET_C_CMYK8888_LIN(pix, C_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float K_sum = 0;
+			float Y_sum = 0;
+			float M_sum = 0;
+			float C_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				K[idx][j] = GP_PIXEL_GET_K_CMYK8888_LIN(pix, K_gamma_lin);
+				Y[idx][j] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix, Y_gamma_lin);
+				M[idx][j] = GP_PIXEL_GET_M_CMYK8888_LIN(pix, M_gamma_lin);
+				C[idx][j] = GP_PIXEL_GET_C_CMYK8888_LIN(pix, C_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					K_sum += K[i][j] * kernel[k + j * kw];
+					Y_sum += Y[i][j] * kernel[k + j * kw];
+					M_sum += M[i][j] * kernel[k + j * kw];
+					C_sum += C[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			K_sum /= kern_div;
+			Y_sum /= kern_div;
+			M_sum /= kern_div;
+			C_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int K_res = GP_CLAMP((int)K_sum, 0, (int)K_lin_max);
+			int Y_res = GP_CLAMP((int)Y_sum, 0, (int)Y_lin_max);
+			int M_res = GP_CLAMP((int)M_sum, 0, (int)M_lin_max);
+			int C_res = GP_CLAMP((int)C_sum, 0, (int)C_lin_max);
+
+			pix = GP_PIXEL_CREATE_CMYK8888_ENC(K_res, Y_res, M_res, C_res, K_gamma_enc, Y_gamma_enc, M_gamma_enc, C_gamma_enc);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G1_DB(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_DB_V(dst);
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G1_DB_V(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_1BPP_DB(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_G1_DB_LIN(pix, V_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_1BPP_DB(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_G1_DB_LIN(pix, V_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, (int)V_lin_max);
+
+			pix = GP_PIXEL_CREATE_G1_DB_ENC(V_res, V_gamma_enc);
+
+			gp_putpixel_raw_1BPP_DB(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G2_DB(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_DB_V(dst);
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G2_DB_V(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_2BPP_DB(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_G2_DB_LIN(pix, V_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_2BPP_DB(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_G2_DB_LIN(pix, V_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, (int)V_lin_max);
+
+			pix = GP_PIXEL_CREATE_G2_DB_ENC(V_res, V_gamma_enc);
+
+			gp_putpixel_raw_2BPP_DB(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G4_DB(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_DB_V(dst);
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G4_DB_V(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_4BPP_DB(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_G4_DB_LIN(pix, V_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_4BPP_DB(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_G4_DB_LIN(pix, V_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, (int)V_lin_max);
+
+			pix = GP_PIXEL_CREATE_G4_DB_ENC(V_res, V_gamma_enc);
+
+			gp_putpixel_raw_4BPP_DB(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G1_UB(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_UB_V(dst);
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G1_UB_V(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_1BPP_UB(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_G1_UB_LIN(pix, V_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_1BPP_UB(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_G1_UB_LIN(pix, V_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, (int)V_lin_max);
+
+			pix = GP_PIXEL_CREATE_G1_UB_ENC(V_res, V_gamma_enc);
+
+			gp_putpixel_raw_1BPP_UB(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G2_UB(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_UB_V(dst);
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G2_UB_V(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_2BPP_UB(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_G2_UB_LIN(pix, V_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_2BPP_UB(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_G2_UB_LIN(pix, V_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, (int)V_lin_max);
+
+			pix = GP_PIXEL_CREATE_G2_UB_ENC(V_res, V_gamma_enc);
+
+			gp_putpixel_raw_2BPP_UB(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G4_UB(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_UB_V(dst);
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G4_UB_V(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_4BPP_UB(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_G4_UB_LIN(pix, V_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_4BPP_UB(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_G4_UB_LIN(pix, V_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, (int)V_lin_max);
+
+			pix = GP_PIXEL_CREATE_G4_UB_ENC(V_res, V_gamma_enc);
+
+			gp_putpixel_raw_4BPP_UB(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G8(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G8_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G8_V(dst);
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G8_V(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_G8_LIN(pix, V_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_G8_LIN(pix, V_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, (int)V_lin_max);
+
+			pix = GP_PIXEL_CREATE_G8_ENC(V_res, V_gamma_enc);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_GA88(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_V(src);
+	uint8_t *A_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_A(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_V(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_A(dst);
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_GA88_V(src);
+	gp_pixel A_lin_max = GP_CHAN_LIN_MAX_VAL_GA88_A(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		uint32_t A[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_GA88_LIN(pix, V_gamma_lin);
+				A[i][j] = GP_PIXEL_GET_A_GA88_LIN(pix, A_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+			float A_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_GA88_LIN(pix, V_gamma_lin);
+				A[idx][j] = GP_PIXEL_GET_A_GA88_LIN(pix, A_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+					A_sum += A[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+			A_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, (int)V_lin_max);
+			int A_res = GP_CLAMP((int)A_sum, 0, (int)A_lin_max);
+
+			pix = GP_PIXEL_CREATE_GA88_ENC(V_res, A_res, V_gamma_enc, A_gamma_enc);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G16(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G16_V(src);
+	uint16_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G16_V(dst);
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G16_V(src);
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_G16_LIN(pix, V_gamma_lin);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_G16_LIN(pix, V_gamma_lin);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, (int)V_lin_max);
+
+			pix = GP_PIXEL_CREATE_G16_ENC(V_res, V_gamma_enc);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+int gp_filter_linear_convolution_raw(const gp_pixmap *src,
+                                     gp_coord x_src, gp_coord y_src,
+                                     gp_size w_src, gp_size h_src,
+                                     gp_pixmap *dst,
+                                     gp_coord x_dst, gp_coord y_dst,
+                                     float kernel[], uint32_t kw, uint32_t kh,
+                                     float kern_div, gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Linear convolution kernel %ix%i rectangle %ux%u",
+	            kw, kh, w_src, h_src);
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return lin_conv_RGB101010(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_xRGB8888:
+		return lin_conv_xRGB8888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return lin_conv_RGBA8888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return lin_conv_RGB888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return lin_conv_BGR888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return lin_conv_RGB555(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return lin_conv_RGB565(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return lin_conv_RGB666(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return lin_conv_RGB332(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return lin_conv_CMYK8888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G1_DB:
+		return lin_conv_G1_DB(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G2_DB:
+		return lin_conv_G2_DB(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G4_DB:
+		return lin_conv_G4_DB(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G1_UB:
+		return lin_conv_G1_UB(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G2_UB:
+		return lin_conv_G2_UB(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G4_UB:
+		return lin_conv_G4_UB(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G8:
+		return lin_conv_G8(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return lin_conv_GA88(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G16:
+		return lin_conv_G16(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
@@ -0,0 +1,1124 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_max.gen.c
+ *
+ * GENERATED on 2026 10 19 15:08:14 from gp_max.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Choose max for each pixel (and for each channel) for two bitmaps.
+ *
+ * Copyright (C) 2012-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_pixmap.h>
+#include <core/gp_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_debug.h>
+#include <filters/gp_filter.h>
+#include <filters/gp_arithmetic.h>
+
+static int filter_max_RGB101010(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint16_t *R_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_R(src_a);
+	uint16_t *G_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_G(src_a);
+	uint16_t *B_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_B(src_a);
+	uint16_t *R_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_R(src_b);
+	uint16_t *G_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_G(src_b);
+	uint16_t *B_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_B(src_b);
+	uint16_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_R(dst);
+	uint16_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_G(dst);
+	uint16_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_R(src_a);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_G(src_a);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_B(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_32BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_32BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGB101010_LIN(pix_a, R_a_gamma_lin);
+			int32_t R_B = GP_PIXEL_GET_R_RGB101010_LIN(pix_b, R_b_gamma_lin);
+			int32_t G_A = GP_PIXEL_GET_G_RGB101010_LIN(pix_a, G_a_gamma_lin);
+			int32_t G_B = GP_PIXEL_GET_G_RGB101010_LIN(pix_b, G_b_gamma_lin);
+			int32_t B_A = GP_PIXEL_GET_B_RGB101010_LIN(pix_a, B_a_gamma_lin);
+			int32_t B_B = GP_PIXEL_GET_B_RGB101010_LIN(pix_b, B_b_gamma_lin);
+
+			int32_t R;
+			(void) R_lin_max;
+			R = GP_MAX(R_A, R_B);
+			int32_t G;
+			(void) G_lin_max;
+			G = GP_MAX(G_A, G_B);
+			int32_t B;
+			(void) B_lin_max;
+			B = GP_MAX(B_A, B_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGB101010_ENC(
+				R, G, B,
+				R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_32BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_xRGB8888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint16_t *R_a_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_R(src_a);
+	uint16_t *G_a_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_G(src_a);
+	uint16_t *B_a_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_B(src_a);
+	uint16_t *R_b_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_R(src_b);
+	uint16_t *G_b_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_G(src_b);
+	uint16_t *B_b_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_B(src_b);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_R(src_a);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_G(src_a);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_B(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_32BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_32BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_xRGB8888_LIN(pix_a, R_a_gamma_lin);
+			int32_t R_B = GP_PIXEL_GET_R_xRGB8888_LIN(pix_b, R_b_gamma_lin);
+			int32_t G_A = GP_PIXEL_GET_G_xRGB8888_LIN(pix_a, G_a_gamma_lin);
+			int32_t G_B = GP_PIXEL_GET_G_xRGB8888_LIN(pix_b, G_b_gamma_lin);
+			int32_t B_A = GP_PIXEL_GET_B_xRGB8888_LIN(pix_a, B_a_gamma_lin);
+			int32_t B_B = GP_PIXEL_GET_B_xRGB8888_LIN(pix_b, B_b_gamma_lin);
+
+			int32_t R;
+			(void) R_lin_max;
+			R = GP_MAX(R_A, R_B);
+			int32_t G;
+			(void) G_lin_max;
+			G = GP_MAX(G_A, G_B);
+			int32_t B;
+			(void) B_lin_max;
+			B = GP_MAX(B_A, B_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_xRGB8888_ENC(
+				R, G, B,
+				R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_32BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_RGBA8888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint16_t *R_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_R(src_a);
+	uint16_t *G_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_G(src_a);
+	uint16_t *B_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_B(src_a);
+	uint8_t *A_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_A(src_a);
+	uint16_t *R_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_R(src_b);
+	uint16_t *G_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_G(src_b);
+	uint16_t *B_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_B(src_b);
+	uint8_t *A_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_A(src_b);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_B(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_A(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_R(src_a);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_G(src_a);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_B(src_a);
+	gp_pixel A_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_A(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_32BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_32BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGBA8888_LIN(pix_a, R_a_gamma_lin);
+			int32_t R_B = GP_PIXEL_GET_R_RGBA8888_LIN(pix_b, R_b_gamma_lin);
+			int32_t G_A = GP_PIXEL_GET_G_RGBA8888_LIN(pix_a, G_a_gamma_lin);
+			int32_t G_B = GP_PIXEL_GET_G_RGBA8888_LIN(pix_b, G_b_gamma_lin);
+			int32_t B_A = GP_PIXEL_GET_B_RGBA8888_LIN(pix_a, B_a_gamma_lin);
+			int32_t B_B = GP_PIXEL_GET_B_RGBA8888_LIN(pix_b, B_b_gamma_lin);
+			int32_t A_A = GP_PIXEL_GET_A_RGBA8888_LIN(pix_a, A_a_gamma_lin);
+			int32_t A_B = GP_PIXEL_GET_A_RGBA8888_LIN(pix_b, A_b_gamma_lin);
+
+			int32_t R;
+			(void) R_lin_max;
+			R = GP_MAX(R_A, R_B);
+			int32_t G;
+			(void) G_lin_max;
+			G = GP_MAX(G_A, G_B);
+			int32_t B;
+			(void) B_lin_max;
+			B = GP_MAX(B_A, B_B);
+			int32_t A;
+			(void) A_lin_max;
+			A = GP_MAX(A_A, A_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGBA8888_ENC(
+				R, G, B, A,
+				R_gamma_enc, G_gamma_enc, B_gamma_enc, A_gamma_enc);
+
+			gp_putpixel_raw_32BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_RGB888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint16_t *R_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_R(src_a);
+	uint16_t *G_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_G(src_a);
+	uint16_t *B_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_B(src_a);
+	uint16_t *R_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_R(src_b);
+	uint16_t *G_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_G(src_b);
+	uint16_t *B_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_B(src_b);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_R(src_a);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_G(src_a);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_B(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_24BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_24BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGB888_LIN(pix_a, R_a_gamma_lin);
+			int32_t R_B = GP_PIXEL_GET_R_RGB888_LIN(pix_b, R_b_gamma_lin);
+			int32_t G_A = GP_PIXEL_GET_G_RGB888_LIN(pix_a, G_a_gamma_lin);
+			int32_t G_B = GP_PIXEL_GET_G_RGB888_LIN(pix_b, G_b_gamma_lin);
+			int32_t B_A = GP_PIXEL_GET_B_RGB888_LIN(pix_a, B_a_gamma_lin);
+			int32_t B_B = GP_PIXEL_GET_B_RGB888_LIN(pix_b, B_b_gamma_lin);
+
+			int32_t R;
+			(void) R_lin_max;
+			R = GP_MAX(R_A, R_B);
+			int32_t G;
+			(void) G_lin_max;
+			G = GP_MAX(G_A, G_B);
+			int32_t B;
+			(void) B_lin_max;
+			B = GP_MAX(B_A, B_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGB888_ENC(
+				R, G, B,
+				R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_24BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_BGR888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint16_t *B_a_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_B(src_a);
+	uint16_t *G_a_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_G(src_a);
+	uint16_t *R_a_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_R(src_a);
+	uint16_t *B_b_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_B(src_b);
+	uint16_t *G_b_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_G(src_b);
+	uint16_t *R_b_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_R(src_b);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_B(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_G(dst);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_R(dst);
+
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_B(src_a);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_G(src_a);
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_R(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_24BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_24BPP(src_b, x, y);
+
+			int32_t B_A = GP_PIXEL_GET_B_BGR888_LIN(pix_a, B_a_gamma_lin);
+			int32_t B_B = GP_PIXEL_GET_B_BGR888_LIN(pix_b, B_b_gamma_lin);
+			int32_t G_A = GP_PIXEL_GET_G_BGR888_LIN(pix_a, G_a_gamma_lin);
+			int32_t G_B = GP_PIXEL_GET_G_BGR888_LIN(pix_b, G_b_gamma_lin);
+			int32_t R_A = GP_PIXEL_GET_R_BGR888_LIN(pix_a, R_a_gamma_lin);
+			int32_t R_B = GP_PIXEL_GET_R_BGR888_LIN(pix_b, R_b_gamma_lin);
+
+			int32_t B;
+			(void) B_lin_max;
+			B = GP_MAX(B_A, B_B);
+			int32_t G;
+			(void) G_lin_max;
+			G = GP_MAX(G_A, G_B);
+			int32_t R;
+			(void) R_lin_max;
+			R = GP_MAX(R_A, R_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_BGR888_ENC(
+				B, G, R,
+				B_gamma_enc, G_gamma_enc, R_gamma_enc);
+
+			gp_putpixel_raw_24BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_RGB555(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint8_t *R_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_R(src_a);
+	uint8_t *G_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_G(src_a);
+	uint8_t *B_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_B(src_a);
+	uint8_t *R_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_R(src_b);
+	uint8_t *G_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_G(src_b);
+	uint8_t *B_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_B(src_b);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_R(src_a);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_G(src_a);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_B(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_16BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_16BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGB555_LIN(pix_a, R_a_gamma_lin);
+			int32_t R_B = GP_PIXEL_GET_R_RGB555_LIN(pix_b, R_b_gamma_lin);
+			int32_t G_A = GP_PIXEL_GET_G_RGB555_LIN(pix_a, G_a_gamma_lin);
+			int32_t G_B = GP_PIXEL_GET_G_RGB555_LIN(pix_b, G_b_gamma_lin);
+			int32_t B_A = GP_PIXEL_GET_B_RGB555_LIN(pix_a, B_a_gamma_lin);
+			int32_t B_B = GP_PIXEL_GET_B_RGB555_LIN(pix_b, B_b_gamma_lin);
+
+			int32_t R;
+			(void) R_lin_max;
+			R = GP_MAX(R_A, R_B);
+			int32_t G;
+			(void) G_lin_max;
+			G = GP_MAX(G_A, G_B);
+			int32_t B;
+			(void) B_lin_max;
+			B = GP_MAX(B_A, B_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGB555_ENC(
+				R, G, B,
+				R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_16BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_RGB565(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint8_t *R_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_R(src_a);
+	uint8_t *G_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_G(src_a);
+	uint8_t *B_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_B(src_a);
+	uint8_t *R_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_R(src_b);
+	uint8_t *G_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_G(src_b);
+	uint8_t *B_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_B(src_b);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_R(src_a);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_G(src_a);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_B(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_16BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_16BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGB565_LIN(pix_a, R_a_gamma_lin);
+			int32_t R_B = GP_PIXEL_GET_R_RGB565_LIN(pix_b, R_b_gamma_lin);
+			int32_t G_A = GP_PIXEL_GET_G_RGB565_LIN(pix_a, G_a_gamma_lin);
+			int32_t G_B = GP_PIXEL_GET_G_RGB565_LIN(pix_b, G_b_gamma_lin);
+			int32_t B_A = GP_PIXEL_GET_B_RGB565_LIN(pix_a, B_a_gamma_lin);
+			int32_t B_B = GP_PIXEL_GET_B_RGB565_LIN(pix_b, B_b_gamma_lin);
+
+			int32_t R;
+			(void) R_lin_max;
+			R = GP_MAX(R_A, R_B);
+			int32_t G;
+			(void) G_lin_max;
+			G = GP_MAX(G_A, G_B);
+			int32_t B;
+			(void) B_lin_max;
+			B = GP_MAX(B_A, B_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGB565_ENC(
+				R, G, B,
+				R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_16BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_RGB666(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint8_t *R_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_R(src_a);
+	uint8_t *G_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_G(src_a);
+	uint8_t *B_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_B(src_a);
+	uint8_t *R_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_R(src_b);
+	uint8_t *G_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_G(src_b);
+	uint8_t *B_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_B(src_b);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_R(src_a);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_G(src_a);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_B(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_18BPP_DB(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_18BPP_DB(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGB666_LIN(pix_a, R_a_gamma_lin);
+			int32_t R_B = GP_PIXEL_GET_R_RGB666_LIN(pix_b, R_b_gamma_lin);
+			int32_t G_A = GP_PIXEL_GET_G_RGB666_LIN(pix_a, G_a_gamma_lin);
+			int32_t G_B = GP_PIXEL_GET_G_RGB666_LIN(pix_b, G_b_gamma_lin);
+			int32_t B_A = GP_PIXEL_GET_B_RGB666_LIN(pix_a, B_a_gamma_lin);
+			int32_t B_B = GP_PIXEL_GET_B_RGB666_LIN(pix_b, B_b_gamma_lin);
+
+			int32_t R;
+			(void) R_lin_max;
+			R = GP_MAX(R_A, R_B);
+			int32_t G;
+			(void) G_lin_max;
+			G = GP_MAX(G_A, G_B);
+			int32_t B;
+			(void) B_lin_max;
+			B = GP_MAX(B_A, B_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGB666_ENC(
+				R, G, B,
+				R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_RGB332(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint8_t *R_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_R(src_a);
+	uint8_t *G_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_G(src_a);
+	uint8_t *B_a_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_B(src_a);
+	uint8_t *R_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_R(src_b);
+	uint8_t *G_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_G(src_b);
+	uint8_t *B_b_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_B(src_b);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_R(src_a);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_G(src_a);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_B(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_8BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_8BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGB332_LIN(pix_a, R_a_gamma_lin);
+			int32_t R_B = GP_PIXEL_GET_R_RGB332_LIN(pix_b, R_b_gamma_lin);
+			int32_t G_A = GP_PIXEL_GET_G_RGB332_LIN(pix_a, G_a_gamma_lin);
+			int32_t G_B = GP_PIXEL_GET_G_RGB332_LIN(pix_b, G_b_gamma_lin);
+			int32_t B_A = GP_PIXEL_GET_B_RGB332_LIN(pix_a, B_a_gamma_lin);
+			int32_t B_B = GP_PIXEL_GET_B_RGB332_LIN(pix_b, B_b_gamma_lin);
+
+			int32_t R;
+			(void) R_lin_max;
+			R = GP_MAX(R_A, R_B);
+			int32_t G;
+			(void) G_lin_max;
+			G = GP_MAX(G_A, G_B);
+			int32_t B;
+			(void) B_lin_max;
+			B = GP_MAX(B_A, B_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGB332_ENC(
+				R, G, B,
+				R_gamma_enc, G_gamma_enc, B_gamma_enc);
+
+			gp_putpixel_raw_8BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_CMYK8888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint8_t *K_a_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_K(src_a);
+	uint8_t *Y_a_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_Y(src_a);
+	uint8_t *M_a_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_M(src_a);
+	uint8_t *C_a_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_C(src_a);
+	uint8_t *K_b_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_K(src_b);
+	uint8_t *Y_b_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_Y(src_b);
+	uint8_t *M_b_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_M(src_b);
+	uint8_t *C_b_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_C(src_b);
+	uint8_t *K_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_K(dst);
+	uint8_t *Y_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_Y(dst);
+	uint8_t *M_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_M(dst);
+	uint8_t *C_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_C(dst);
+
+	gp_pixel K_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_K(src_a);
+	gp_pixel Y_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_Y(src_a);
+	gp_pixel M_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_M(src_a);
+	gp_pixel C_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_C(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_32BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_32BPP(src_b, x, y);
+
+			int32_t K_A = GP_PIXEL_GET_K_CMYK8888_LIN(pix_a, K_a_gamma_lin);
+			int32_t K_B = GP_PIXEL_GET_K_CMYK8888_LIN(pix_b, K_b_gamma_lin);
+			int32_t Y_A = GP_PIXEL_GET_Y_CMYK8888_LIN(pix_a, Y_a_gamma_lin);
+			int32_t Y_B = GP_PIXEL_GET_Y_CMYK8888_LIN(pix_b, Y_b_gamma_lin);
+			int32_t M_A = GP_PIXEL_GET_M_CMYK8888_LIN(pix_a, M_a_gamma_lin);
+			int32_t M_B = GP_PIXEL_GET_M_CMYK8888_LIN(pix_b, M_b_gamma_lin);
+			int32_t C_A = GP_PIXEL_GET_C_CMYK8888_LIN(pix_a, C_a_gamma_lin);
+			int32_t C_B = GP_PIXEL_GET_C_CMYK8888_LIN(pix_b, C_b_gamma_lin);
+
+			int32_t K;
+			(void) K_lin_max;
+			K = GP_MAX(K_A, K_B);
+			int32_t Y;
+			(void) Y_lin_max;
+			Y = GP_MAX(Y_A, Y_B);
+			int32_t M;
+			(void) M_lin_max;
+			M = GP_MAX(M_A, M_B);
+			int32_t C;
+			(void) C_lin_max;
+			C = GP_MAX(C_A, C_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_CMYK8888_ENC(
+				K, Y, M, C,
+				K_gamma_enc, Y_gamma_enc, M_gamma_enc, C_gamma_enc);
+
+			gp_putpixel_raw_32BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_G1_DB(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint8_t *V_a_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_DB_V(src_a);
+	uint8_t *V_b_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_DB_V(src_b);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_DB_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G1_DB_V(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_1BPP_DB(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_1BPP_DB(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_G1_DB_LIN(pix_a, V_a_gamma_lin);
+			int32_t V_B = GP_PIXEL_GET_V_G1_DB_LIN(pix_b, V_b_gamma_lin);
+
+			int32_t V;
+			(void) V_lin_max;
+			V = GP_MAX(V_A, V_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_G1_DB_ENC(
+				V,
+				V_gamma_enc);
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_G2_DB(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint8_t *V_a_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_DB_V(src_a);
+	uint8_t *V_b_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_DB_V(src_b);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_DB_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G2_DB_V(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_2BPP_DB(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_2BPP_DB(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_G2_DB_LIN(pix_a, V_a_gamma_lin);
+			int32_t V_B = GP_PIXEL_GET_V_G2_DB_LIN(pix_b, V_b_gamma_lin);
+
+			int32_t V;
+			(void) V_lin_max;
+			V = GP_MAX(V_A, V_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_G2_DB_ENC(
+				V,
+				V_gamma_enc);
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_G4_DB(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint8_t *V_a_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_DB_V(src_a);
+	uint8_t *V_b_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_DB_V(src_b);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_DB_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G4_DB_V(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_4BPP_DB(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_4BPP_DB(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_G4_DB_LIN(pix_a, V_a_gamma_lin);
+			int32_t V_B = GP_PIXEL_GET_V_G4_DB_LIN(pix_b, V_b_gamma_lin);
+
+			int32_t V;
+			(void) V_lin_max;
+			V = GP_MAX(V_A, V_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_G4_DB_ENC(
+				V,
+				V_gamma_enc);
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_G1_UB(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint8_t *V_a_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_UB_V(src_a);
+	uint8_t *V_b_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_UB_V(src_b);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_UB_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G1_UB_V(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_1BPP_UB(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_1BPP_UB(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_G1_UB_LIN(pix_a, V_a_gamma_lin);
+			int32_t V_B = GP_PIXEL_GET_V_G1_UB_LIN(pix_b, V_b_gamma_lin);
+
+			int32_t V;
+			(void) V_lin_max;
+			V = GP_MAX(V_A, V_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_G1_UB_ENC(
+				V,
+				V_gamma_enc);
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_G2_UB(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint8_t *V_a_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_UB_V(src_a);
+	uint8_t *V_b_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_UB_V(src_b);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_UB_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G2_UB_V(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_2BPP_UB(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_2BPP_UB(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_G2_UB_LIN(pix_a, V_a_gamma_lin);
+			int32_t V_B = GP_PIXEL_GET_V_G2_UB_LIN(pix_b, V_b_gamma_lin);
+
+			int32_t V;
+			(void) V_lin_max;
+			V = GP_MAX(V_A, V_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_G2_UB_ENC(
+				V,
+				V_gamma_enc);
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_G4_UB(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint8_t *V_a_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_UB_V(src_a);
+	uint8_t *V_b_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_UB_V(src_b);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_UB_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G4_UB_V(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_4BPP_UB(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_4BPP_UB(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_G4_UB_LIN(pix_a, V_a_gamma_lin);
+			int32_t V_B = GP_PIXEL_GET_V_G4_UB_LIN(pix_b, V_b_gamma_lin);
+
+			int32_t V;
+			(void) V_lin_max;
+			V = GP_MAX(V_A, V_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_G4_UB_ENC(
+				V,
+				V_gamma_enc);
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_G8(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint16_t *V_a_gamma_lin = GP_CHAN_TO_LIN_TBL_G8_V(src_a);
+	uint16_t *V_b_gamma_lin = GP_CHAN_TO_LIN_TBL_G8_V(src_b);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G8_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G8_V(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_8BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_8BPP(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_G8_LIN(pix_a, V_a_gamma_lin);
+			int32_t V_B = GP_PIXEL_GET_V_G8_LIN(pix_b, V_b_gamma_lin);
+
+			int32_t V;
+			(void) V_lin_max;
+			V = GP_MAX(V_A, V_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_G8_ENC(
+				V,
+				V_gamma_enc);
+
+			gp_putpixel_raw_8BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_GA88(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint16_t *V_a_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_V(src_a);
+	uint8_t *A_a_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_A(src_a);
+	uint16_t *V_b_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_V(src_b);
+	uint8_t *A_b_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_A(src_b);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_V(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_A(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_GA88_V(src_a);
+	gp_pixel A_lin_max = GP_CHAN_LIN_MAX_VAL_GA88_A(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_16BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_16BPP(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_GA88_LIN(pix_a, V_a_gamma_lin);
+			int32_t V_B = GP_PIXEL_GET_V_GA88_LIN(pix_b, V_b_gamma_lin);
+			int32_t A_A = GP_PIXEL_GET_A_GA88_LIN(pix_a, A_a_gamma_lin);
+			int32_t A_B = GP_PIXEL_GET_A_GA88_LIN(pix_b, A_b_gamma_lin);
+
+			int32_t V;
+			(void) V_lin_max;
+			V = GP_MAX(V_A, V_B);
+			int32_t A;
+			(void) A_lin_max;
+			A = GP_MAX(A_A, A_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_GA88_ENC(
+				V, A,
+				V_gamma_enc, A_gamma_enc);
+
+			gp_putpixel_raw_16BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_max_G16(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	uint16_t *V_a_gamma_lin = GP_CHAN_TO_LIN_TBL_G16_V(src_a);
+	uint16_t *V_b_gamma_lin = GP_CHAN_TO_LIN_TBL_G16_V(src_b);
+	uint16_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G16_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G16_V(src_a);
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_16BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_16BPP(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_G16_LIN(pix_a, V_a_gamma_lin);
+			int32_t V_B = GP_PIXEL_GET_V_G16_LIN(pix_b, V_b_gamma_lin);
+
+			int32_t V;
+			(void) V_lin_max;
+			V = GP_MAX(V_A, V_B);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_G16_ENC(
+				V,
+				V_gamma_enc);
+
+			gp_putpixel_raw_16BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+int gp_filter_max_raw(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Running filter max");
+
+	switch (src_a->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return filter_max_RGB101010(src_a, src_b, dst, callback);
+	case GP_PIXEL_xRGB8888:
+		return filter_max_xRGB8888(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGBA8888:
+		return filter_max_RGBA8888(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGB888:
+		return filter_max_RGB888(src_a, src_b, dst, callback);
+	case GP_PIXEL_BGR888:
+		return filter_max_BGR888(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGB555:
+		return filter_max_RGB555(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGB565:
+		return filter_max_RGB565(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGB666:
+		return filter_max_RGB666(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGB332:
+		return filter_max_RGB332(src_a, src_b, dst, callback);
+	case GP_PIXEL_CMYK8888:
+		return filter_max_CMYK8888(src_a, src_b, dst, callback);
+	case GP_PIXEL_G1_DB:
+		return filter_max_G1_DB(src_a, src_b, dst, callback);
+	case GP_PIXEL_G2_DB:
+		return filter_max_G2_DB(src_a, src_b, dst, callback);
+	case GP_PIXEL_G4_DB:
+		return filter_max_G4_DB(src_a, src_b, dst, callback);
+	case GP_PIXEL_G1_UB:
+		return filter_max_G1_UB(src_a, src_b, dst, callback);
+	case GP_PIXEL_G2_UB:
+		return filter_max_G2_UB(src_a, src_b, dst, callback);
+	case GP_PIXEL_G4_UB:
+		return filter_max_G4_UB(src_a, src_b, dst, callback);
+	case GP_PIXEL_G8:
+		return filter_max_G8(src_a, src_b, dst, callback);
+	case GP_PIXEL_GA88:
+		return filter_max_GA88(src_a, src_b, dst, callback);
+	case GP_PIXEL_G16:
+		return filter_max_G16(src_a, src_b, dst, callback);
+	default:
+	break;
+	}
+
+	return 1;
+}
+
+int gp_filter_max(const gp_pixmap *src_a, const gp_pixmap *src_b,
+                         gp_pixmap *dst,
+                         gp_progress_cb *callback)
+{
+	gp_size w = GP_MIN(src_a->w, src_b->w);
+	gp_size h = GP_MIN(src_a->h, src_b->h);
+
+	GP_ASSERT(src_a->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(w <= dst->w && h <= dst->h,
+	          "Destination is not big enough");
+
+	if (gp_filter_max_raw(src_a, src_b, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+
+gp_pixmap *gp_filter_max_alloc(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	                              gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	GP_ASSERT(src_a->pixel_type == src_b->pixel_type,
+	          "Pixel types for sources must match.");
+
+	gp_size w = GP_MIN(src_a->w, src_b->w);
+	gp_size h = GP_MIN(src_a->h, src_b->h);
+
+	res = gp_pixmap_alloc(w, h, src_a->pixel_type);
+
+	if (res == NULL)
+		return NULL;
+
+	if (gp_filter_max_raw(src_a, src_b, res, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+
+		gp_pixmap_free(res);
+
+		return NULL;
+	}
+
+	return res;
+}
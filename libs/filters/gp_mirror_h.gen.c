@@ -0,0 +1,433 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_mirror_h.gen.c
+ *
+ * GENERATED on 2026 10 19 15:08:16 from gp_mirror_h.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Horizontal Mirror alogorithm
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_debug.h>
+#include <filters/gp_rotate.h>
+
+static int mirror_h_raw_1BPP_DB(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_1BPP_DB(src, x, y);
+			gp_putpixel_raw_1BPP_DB(dst, x, y, gp_getpixel_raw_1BPP_DB(src, xm, y));
+			gp_putpixel_raw_1BPP_DB(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_1BPP_DB(dst, x, y, gp_getpixel_raw_1BPP_DB(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_1BPP_UB(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_1BPP_UB(src, x, y);
+			gp_putpixel_raw_1BPP_UB(dst, x, y, gp_getpixel_raw_1BPP_UB(src, xm, y));
+			gp_putpixel_raw_1BPP_UB(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_1BPP_UB(dst, x, y, gp_getpixel_raw_1BPP_UB(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_2BPP_DB(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_2BPP_DB(src, x, y);
+			gp_putpixel_raw_2BPP_DB(dst, x, y, gp_getpixel_raw_2BPP_DB(src, xm, y));
+			gp_putpixel_raw_2BPP_DB(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_2BPP_DB(dst, x, y, gp_getpixel_raw_2BPP_DB(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_2BPP_UB(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_2BPP_UB(src, x, y);
+			gp_putpixel_raw_2BPP_UB(dst, x, y, gp_getpixel_raw_2BPP_UB(src, xm, y));
+			gp_putpixel_raw_2BPP_UB(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_2BPP_UB(dst, x, y, gp_getpixel_raw_2BPP_UB(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_4BPP_DB(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_4BPP_DB(src, x, y);
+			gp_putpixel_raw_4BPP_DB(dst, x, y, gp_getpixel_raw_4BPP_DB(src, xm, y));
+			gp_putpixel_raw_4BPP_DB(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_4BPP_DB(dst, x, y, gp_getpixel_raw_4BPP_DB(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_4BPP_UB(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_4BPP_UB(src, x, y);
+			gp_putpixel_raw_4BPP_UB(dst, x, y, gp_getpixel_raw_4BPP_UB(src, xm, y));
+			gp_putpixel_raw_4BPP_UB(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_4BPP_UB(dst, x, y, gp_getpixel_raw_4BPP_UB(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_8BPP(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_8BPP(src, x, y);
+			gp_putpixel_raw_8BPP(dst, x, y, gp_getpixel_raw_8BPP(src, xm, y));
+			gp_putpixel_raw_8BPP(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_8BPP(dst, x, y, gp_getpixel_raw_8BPP(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_16BPP(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_16BPP(src, x, y);
+			gp_putpixel_raw_16BPP(dst, x, y, gp_getpixel_raw_16BPP(src, xm, y));
+			gp_putpixel_raw_16BPP(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_16BPP(dst, x, y, gp_getpixel_raw_16BPP(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_24BPP(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_24BPP(src, x, y);
+			gp_putpixel_raw_24BPP(dst, x, y, gp_getpixel_raw_24BPP(src, xm, y));
+			gp_putpixel_raw_24BPP(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_24BPP(dst, x, y, gp_getpixel_raw_24BPP(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_32BPP(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_32BPP(src, x, y);
+			gp_putpixel_raw_32BPP(dst, x, y, gp_getpixel_raw_32BPP(src, xm, y));
+			gp_putpixel_raw_32BPP(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_32BPP(dst, x, y, gp_getpixel_raw_32BPP(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_18BPP_DB(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_18BPP_DB(src, x, y);
+			gp_putpixel_raw_18BPP_DB(dst, x, y, gp_getpixel_raw_18BPP_DB(src, xm, y));
+			gp_putpixel_raw_18BPP_DB(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_18BPP_DB(dst, x, y, gp_getpixel_raw_18BPP_DB(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int gp_filter_mirror_h_raw(const gp_pixmap *src, gp_pixmap *dst,
+                                  gp_progress_cb *callback)
+{
+	GP_FN_RET_PER_PACK_PIXMAP(mirror_h_raw, src, src, dst, callback);
+	return 1;
+}
+
+int gp_filter_mirror_h(const gp_pixmap *src, gp_pixmap *dst,
+                       gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(src->w <= dst->w && src->h <= dst->h,
+	          "Destination is not large enough");
+
+	if (gp_filter_mirror_h_raw(src, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+gp_pixmap *gp_filter_mirror_h_alloc(const gp_pixmap *src,
+                                    gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	res = gp_pixmap_copy(src, 0);
+
+	if (res == NULL)
+		return NULL;
+
+	if (gp_filter_mirror_h_raw(src, res, callback)) {
+		gp_pixmap_free(res);
+		return NULL;
+	}
+
+	return res;
+}
@@ -0,0 +1,4651 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_resize_linear.gen.c
+ *
+ * GENERATED on 2026 10 19 15:08:13 from gp_resize_linear.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Linear resampling
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <string.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_gamma_correction.h>
+#include <core/gp_debug.h>
+#include <filters/gp_resize.h>
+
+static int resize_lin_lf_RGB101010(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_B(src);
+	uint16_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_R(dst);
+	uint16_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_G(dst);
+	uint16_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_B(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGB101010_LIN(pix, R_gamma_lin);
+		G[x] = GP_PIXEL_GET_G_RGB101010_LIN(pix, G_gamma_lin);
+		B[x] = GP_PIXEL_GET_B_RGB101010_LIN(pix, B_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGB101010_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGB101010_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGB101010_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGB101010_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGB101010_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGB101010_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t R_p = (R_res[x]) / div;
+			uint32_t G_p = (G_res[x]) / div;
+			uint32_t B_p = (B_res[x]) / div;
+                        gp_putpixel_raw_32BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGB101010_ENC(R_p, G_p, B_p,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_xRGB8888(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_B(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_xRGB8888_LIN(pix, R_gamma_lin);
+		G[x] = GP_PIXEL_GET_G_xRGB8888_LIN(pix, G_gamma_lin);
+		B[x] = GP_PIXEL_GET_B_xRGB8888_LIN(pix, B_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_xRGB8888_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_xRGB8888_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_xRGB8888_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_xRGB8888_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_xRGB8888_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_xRGB8888_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t R_p = (R_res[x]) / div;
+			uint32_t G_p = (G_res[x]) / div;
+			uint32_t B_p = (B_res[x]) / div;
+                        gp_putpixel_raw_32BPP(dst, x, y,
+				GP_PIXEL_CREATE_xRGB8888_ENC(R_p, G_p, B_p,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGBA8888(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t A[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_B(src);
+	uint8_t *A_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_A(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_B(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_A(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGBA8888_LIN(pix, R_gamma_lin);
+		G[x] = GP_PIXEL_GET_G_RGBA8888_LIN(pix, G_gamma_lin);
+		B[x] = GP_PIXEL_GET_B_RGBA8888_LIN(pix, B_gamma_lin);
+		A[x] = GP_PIXEL_GET_A_RGBA8888_LIN(pix, A_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+		uint32_t A_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+		memset(A_res, 0, sizeof(A_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			uint32_t A_middle = 0;
+			uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+				A_middle += A[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+			A_res[x] += (A_middle * (MULT / DIV) +
+			                        (A[xmap[x+1]] * xoff[x+1] +
+			                         A_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGBA8888_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGBA8888_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGBA8888_LIN(pix, B_gamma_lin);
+				A[x] = GP_PIXEL_GET_A_RGBA8888_LIN(pix, A_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				uint32_t A_middle = 0;
+				uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+					A_middle += A[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+				A_res[x] += (A_middle * (MULT / DIV) +
+				                        (A[xmap[x+1]] * xoff[x+1] +
+				                         A_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGBA8888_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGBA8888_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGBA8888_LIN(pix, B_gamma_lin);
+				A[x] = GP_PIXEL_GET_A_RGBA8888_LIN(pix, A_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				uint32_t A_middle = 0;
+				uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+					A_middle += A[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+				A_res[x] += (A_middle * (MULT / DIV) +
+				                        (A[xmap[x+1]] * xoff[x+1] +
+				                         A_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t R_p = (R_res[x]) / div;
+			uint32_t G_p = (G_res[x]) / div;
+			uint32_t B_p = (B_res[x]) / div;
+			uint32_t A_p = (A_res[x]) / div;
+                        gp_putpixel_raw_32BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGBA8888_ENC(R_p, G_p, B_p, A_p,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc, A_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGB888(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_B(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_24BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGB888_LIN(pix, R_gamma_lin);
+		G[x] = GP_PIXEL_GET_G_RGB888_LIN(pix, G_gamma_lin);
+		B[x] = GP_PIXEL_GET_B_RGB888_LIN(pix, B_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_24BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGB888_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGB888_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGB888_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_24BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGB888_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGB888_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGB888_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t R_p = (R_res[x]) / div;
+			uint32_t G_p = (G_res[x]) / div;
+			uint32_t B_p = (B_res[x]) / div;
+                        gp_putpixel_raw_24BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGB888_ENC(R_p, G_p, B_p,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_BGR888(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t B[src->w];
+	uint32_t G[src->w];
+	uint32_t R[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_B(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_G(src);
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_R(src);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_B(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_G(dst);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_R(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_24BPP(src, x, 0);
+		B[x] = GP_PIXEL_GET_B_BGR888_LIN(pix, B_gamma_lin);
+		G[x] = GP_PIXEL_GET_G_BGR888_LIN(pix, G_gamma_lin);
+		R[x] = GP_PIXEL_GET_R_BGR888_LIN(pix, R_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t B_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t R_res[dst->w];
+
+		memset(B_res, 0, sizeof(B_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(R_res, 0, sizeof(R_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				B_middle += B[j];
+				G_middle += G[j];
+				R_middle += R[j];
+			}
+			/* Add it all together with last pixel on the right */
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_24BPP(src, x, i);
+				B[x] = GP_PIXEL_GET_B_BGR888_LIN(pix, B_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_BGR888_LIN(pix, G_gamma_lin);
+				R[x] = GP_PIXEL_GET_R_BGR888_LIN(pix, R_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					B_middle += B[j];
+					G_middle += G[j];
+					R_middle += R[j];
+				}
+				/* Add it all together with last pixel on the right */
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_24BPP(src, x, ymap[y+1]);
+				B[x] = GP_PIXEL_GET_B_BGR888_LIN(pix, B_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_BGR888_LIN(pix, G_gamma_lin);
+				R[x] = GP_PIXEL_GET_R_BGR888_LIN(pix, R_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					B_middle += B[j];
+					G_middle += G[j];
+					R_middle += R[j];
+				}
+				/* Add it all together with last pixel on the right */
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t B_p = (B_res[x]) / div;
+			uint32_t G_p = (G_res[x]) / div;
+			uint32_t R_p = (R_res[x]) / div;
+                        gp_putpixel_raw_24BPP(dst, x, y,
+				GP_PIXEL_CREATE_BGR888_ENC(B_p, G_p, R_p,
+					B_gamma_enc, G_gamma_enc, R_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGB555(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_B(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGB555_LIN(pix, R_gamma_lin);
+		G[x] = GP_PIXEL_GET_G_RGB555_LIN(pix, G_gamma_lin);
+		B[x] = GP_PIXEL_GET_B_RGB555_LIN(pix, B_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGB555_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGB555_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGB555_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGB555_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGB555_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGB555_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t R_p = (R_res[x]) / div;
+			uint32_t G_p = (G_res[x]) / div;
+			uint32_t B_p = (B_res[x]) / div;
+                        gp_putpixel_raw_16BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGB555_ENC(R_p, G_p, B_p,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGB565(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_B(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGB565_LIN(pix, R_gamma_lin);
+		G[x] = GP_PIXEL_GET_G_RGB565_LIN(pix, G_gamma_lin);
+		B[x] = GP_PIXEL_GET_B_RGB565_LIN(pix, B_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGB565_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGB565_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGB565_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGB565_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGB565_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGB565_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t R_p = (R_res[x]) / div;
+			uint32_t G_p = (G_res[x]) / div;
+			uint32_t B_p = (B_res[x]) / div;
+                        gp_putpixel_raw_16BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGB565_ENC(R_p, G_p, B_p,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGB666(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_B(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGB666_LIN(pix, R_gamma_lin);
+		G[x] = GP_PIXEL_GET_G_RGB666_LIN(pix, G_gamma_lin);
+		B[x] = GP_PIXEL_GET_B_RGB666_LIN(pix, B_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGB666_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGB666_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGB666_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGB666_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGB666_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGB666_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t R_p = (R_res[x]) / div;
+			uint32_t G_p = (G_res[x]) / div;
+			uint32_t B_p = (B_res[x]) / div;
+                        gp_putpixel_raw_18BPP_DB(dst, x, y,
+				GP_PIXEL_CREATE_RGB666_ENC(R_p, G_p, B_p,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGB332(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_B(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_8BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGB332_LIN(pix, R_gamma_lin);
+		G[x] = GP_PIXEL_GET_G_RGB332_LIN(pix, G_gamma_lin);
+		B[x] = GP_PIXEL_GET_B_RGB332_LIN(pix, B_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_8BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGB332_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGB332_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGB332_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_8BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGB332_LIN(pix, R_gamma_lin);
+				G[x] = GP_PIXEL_GET_G_RGB332_LIN(pix, G_gamma_lin);
+				B[x] = GP_PIXEL_GET_B_RGB332_LIN(pix, B_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t R_p = (R_res[x]) / div;
+			uint32_t G_p = (G_res[x]) / div;
+			uint32_t B_p = (B_res[x]) / div;
+                        gp_putpixel_raw_8BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGB332_ENC(R_p, G_p, B_p,
+					R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_CMYK8888(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t K[src->w];
+	uint32_t Y[src->w];
+	uint32_t M[src->w];
+	uint32_t C[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint8_t *K_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_K(src);
+	uint8_t *Y_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_Y(src);
+	uint8_t *M_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_M(src);
+	uint8_t *C_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_C(src);
+	uint8_t *K_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_K(dst);
+	uint8_t *Y_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_Y(dst);
+	uint8_t *M_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_M(dst);
+	uint8_t *C_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_C(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, x, 0);
+		K[x] = GP_PIXEL_GET_K_CMYK8888_LIN(pix, K_gamma_lin);
+		Y[x] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix, Y_gamma_lin);
+		M[x] = GP_PIXEL_GET_M_CMYK8888_LIN(pix, M_gamma_lin);
+		C[x] = GP_PIXEL_GET_C_CMYK8888_LIN(pix, C_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t K_res[dst->w];
+		uint32_t Y_res[dst->w];
+		uint32_t M_res[dst->w];
+		uint32_t C_res[dst->w];
+
+		memset(K_res, 0, sizeof(K_res));
+		memset(Y_res, 0, sizeof(Y_res));
+		memset(M_res, 0, sizeof(M_res));
+		memset(C_res, 0, sizeof(C_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t K_middle = 0;
+			uint32_t K_first = K[xmap[x]] * (MULT - xoff[x]);
+			uint32_t Y_middle = 0;
+			uint32_t Y_first = Y[xmap[x]] * (MULT - xoff[x]);
+			uint32_t M_middle = 0;
+			uint32_t M_first = M[xmap[x]] * (MULT - xoff[x]);
+			uint32_t C_middle = 0;
+			uint32_t C_first = C[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				K_middle += K[j];
+				Y_middle += Y[j];
+				M_middle += M[j];
+				C_middle += C[j];
+			}
+			/* Add it all together with last pixel on the right */
+			K_res[x] += (K_middle * (MULT / DIV) +
+			                        (K[xmap[x+1]] * xoff[x+1] +
+			                         K_first) / DIV) * (MULT-yoff[y]) / DIV;
+			Y_res[x] += (Y_middle * (MULT / DIV) +
+			                        (Y[xmap[x+1]] * xoff[x+1] +
+			                         Y_first) / DIV) * (MULT-yoff[y]) / DIV;
+			M_res[x] += (M_middle * (MULT / DIV) +
+			                        (M[xmap[x+1]] * xoff[x+1] +
+			                         M_first) / DIV) * (MULT-yoff[y]) / DIV;
+			C_res[x] += (C_middle * (MULT / DIV) +
+			                        (C[xmap[x+1]] * xoff[x+1] +
+			                         C_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, i);
+				K[x] = GP_PIXEL_GET_K_CMYK8888_LIN(pix, K_gamma_lin);
+				Y[x] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix, Y_gamma_lin);
+				M[x] = GP_PIXEL_GET_M_CMYK8888_LIN(pix, M_gamma_lin);
+				C[x] = GP_PIXEL_GET_C_CMYK8888_LIN(pix, C_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t K_middle = 0;
+				uint32_t K_first = K[xmap[x]] * (MULT - xoff[x]);
+				uint32_t Y_middle = 0;
+				uint32_t Y_first = Y[xmap[x]] * (MULT - xoff[x]);
+				uint32_t M_middle = 0;
+				uint32_t M_first = M[xmap[x]] * (MULT - xoff[x]);
+				uint32_t C_middle = 0;
+				uint32_t C_first = C[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					K_middle += K[j];
+					Y_middle += Y[j];
+					M_middle += M[j];
+					C_middle += C[j];
+				}
+				/* Add it all together with last pixel on the right */
+				K_res[x] += (K_middle * (MULT / DIV) +
+				                        (K[xmap[x+1]] * xoff[x+1] +
+				                         K_first) / DIV) * MULT / DIV;
+				Y_res[x] += (Y_middle * (MULT / DIV) +
+				                        (Y[xmap[x+1]] * xoff[x+1] +
+				                         Y_first) / DIV) * MULT / DIV;
+				M_res[x] += (M_middle * (MULT / DIV) +
+				                        (M[xmap[x+1]] * xoff[x+1] +
+				                         M_first) / DIV) * MULT / DIV;
+				C_res[x] += (C_middle * (MULT / DIV) +
+				                        (C[xmap[x+1]] * xoff[x+1] +
+				                         C_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, ymap[y+1]);
+				K[x] = GP_PIXEL_GET_K_CMYK8888_LIN(pix, K_gamma_lin);
+				Y[x] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix, Y_gamma_lin);
+				M[x] = GP_PIXEL_GET_M_CMYK8888_LIN(pix, M_gamma_lin);
+				C[x] = GP_PIXEL_GET_C_CMYK8888_LIN(pix, C_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t K_middle = 0;
+				uint32_t K_first = K[xmap[x]] * (MULT - xoff[x]);
+				uint32_t Y_middle = 0;
+				uint32_t Y_first = Y[xmap[x]] * (MULT - xoff[x]);
+				uint32_t M_middle = 0;
+				uint32_t M_first = M[xmap[x]] * (MULT - xoff[x]);
+				uint32_t C_middle = 0;
+				uint32_t C_first = C[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					K_middle += K[j];
+					Y_middle += Y[j];
+					M_middle += M[j];
+					C_middle += C[j];
+				}
+				/* Add it all together with last pixel on the right */
+				K_res[x] += (K_middle * (MULT / DIV) +
+				                        (K[xmap[x+1]] * xoff[x+1] +
+				                         K_first) / DIV) * yoff[y+1] / DIV;
+				Y_res[x] += (Y_middle * (MULT / DIV) +
+				                        (Y[xmap[x+1]] * xoff[x+1] +
+				                         Y_first) / DIV) * yoff[y+1] / DIV;
+				M_res[x] += (M_middle * (MULT / DIV) +
+				                        (M[xmap[x+1]] * xoff[x+1] +
+				                         M_first) / DIV) * yoff[y+1] / DIV;
+				C_res[x] += (C_middle * (MULT / DIV) +
+				                        (C[xmap[x+1]] * xoff[x+1] +
+				                         C_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t K_p = (K_res[x]) / div;
+			uint32_t Y_p = (Y_res[x]) / div;
+			uint32_t M_p = (M_res[x]) / div;
+			uint32_t C_p = (C_res[x]) / div;
+                        gp_putpixel_raw_32BPP(dst, x, y,
+				GP_PIXEL_CREATE_CMYK8888_ENC(K_p, Y_p, M_p, C_p,
+					K_gamma_enc, Y_gamma_enc, M_gamma_enc, C_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_G1_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_DB_V(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_G1_DB_LIN(pix, V_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t V_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, x, i);
+				V[x] = GP_PIXEL_GET_V_G1_DB_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_G1_DB_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t V_p = (V_res[x]) / div;
+                        gp_putpixel_raw_1BPP_DB(dst, x, y,
+				GP_PIXEL_CREATE_G1_DB_ENC(V_p,
+					V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_G2_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_DB_V(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_G2_DB_LIN(pix, V_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t V_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, x, i);
+				V[x] = GP_PIXEL_GET_V_G2_DB_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_G2_DB_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t V_p = (V_res[x]) / div;
+                        gp_putpixel_raw_2BPP_DB(dst, x, y,
+				GP_PIXEL_CREATE_G2_DB_ENC(V_p,
+					V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_G4_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_DB_V(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_G4_DB_LIN(pix, V_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t V_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, x, i);
+				V[x] = GP_PIXEL_GET_V_G4_DB_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_G4_DB_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t V_p = (V_res[x]) / div;
+                        gp_putpixel_raw_4BPP_DB(dst, x, y,
+				GP_PIXEL_CREATE_G4_DB_ENC(V_p,
+					V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_G1_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_UB_V(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_G1_UB_LIN(pix, V_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t V_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, x, i);
+				V[x] = GP_PIXEL_GET_V_G1_UB_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_G1_UB_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t V_p = (V_res[x]) / div;
+                        gp_putpixel_raw_1BPP_UB(dst, x, y,
+				GP_PIXEL_CREATE_G1_UB_ENC(V_p,
+					V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_G2_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_UB_V(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_G2_UB_LIN(pix, V_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t V_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, x, i);
+				V[x] = GP_PIXEL_GET_V_G2_UB_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_G2_UB_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t V_p = (V_res[x]) / div;
+                        gp_putpixel_raw_2BPP_UB(dst, x, y,
+				GP_PIXEL_CREATE_G2_UB_ENC(V_p,
+					V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_G4_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_UB_V(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_G4_UB_LIN(pix, V_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t V_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, x, i);
+				V[x] = GP_PIXEL_GET_V_G4_UB_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_G4_UB_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t V_p = (V_res[x]) / div;
+                        gp_putpixel_raw_4BPP_UB(dst, x, y,
+				GP_PIXEL_CREATE_G4_UB_ENC(V_p,
+					V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_G8(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G8_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G8_V(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_8BPP(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_G8_LIN(pix, V_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t V_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_8BPP(src, x, i);
+				V[x] = GP_PIXEL_GET_V_G8_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_8BPP(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_G8_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t V_p = (V_res[x]) / div;
+                        gp_putpixel_raw_8BPP(dst, x, y,
+				GP_PIXEL_CREATE_G8_ENC(V_p,
+					V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_GA88(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t A[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_V(src);
+	uint8_t *A_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_A(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_V(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_A(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_GA88_LIN(pix, V_gamma_lin);
+		A[x] = GP_PIXEL_GET_A_GA88_LIN(pix, A_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t V_res[dst->w];
+		uint32_t A_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+		memset(A_res, 0, sizeof(A_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			uint32_t A_middle = 0;
+			uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+				A_middle += A[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+			A_res[x] += (A_middle * (MULT / DIV) +
+			                        (A[xmap[x+1]] * xoff[x+1] +
+			                         A_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, i);
+				V[x] = GP_PIXEL_GET_V_GA88_LIN(pix, V_gamma_lin);
+				A[x] = GP_PIXEL_GET_A_GA88_LIN(pix, A_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				uint32_t A_middle = 0;
+				uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+					A_middle += A[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+				A_res[x] += (A_middle * (MULT / DIV) +
+				                        (A[xmap[x+1]] * xoff[x+1] +
+				                         A_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_GA88_LIN(pix, V_gamma_lin);
+				A[x] = GP_PIXEL_GET_A_GA88_LIN(pix, A_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				uint32_t A_middle = 0;
+				uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+					A_middle += A[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+				A_res[x] += (A_middle * (MULT / DIV) +
+				                        (A[xmap[x+1]] * xoff[x+1] +
+				                         A_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t V_p = (V_res[x]) / div;
+			uint32_t A_p = (A_res[x]) / div;
+                        gp_putpixel_raw_16BPP(dst, x, y,
+				GP_PIXEL_CREATE_GA88_ENC(V_p, A_p,
+					V_gamma_enc, A_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_G16(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<12;
+	const int DIV=1<<6;
+
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G16_V(src);
+	uint16_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G16_V(dst);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/* Compute pixel area for the final normalization */
+	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_G16_LIN(pix, V_gamma_lin);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t V_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, i);
+				V[x] = GP_PIXEL_GET_V_G16_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_G16_LIN(pix, V_gamma_lin);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint32_t V_p = (V_res[x]) / div;
+                        gp_putpixel_raw_16BPP(dst, x, y,
+				GP_PIXEL_CREATE_G16_ENC(V_p,
+					V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGB101010(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_B(src);
+	uint16_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_R(dst);
+	uint16_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_G(dst);
+	uint16_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_B(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_32BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_32BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_32BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_32BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGB101010_LIN(pix00, R_gamma_lin) * (255 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGB101010_LIN(pix00, G_gamma_lin) * (255 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGB101010_LIN(pix00, B_gamma_lin) * (255 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGB101010_LIN(pix10, R_gamma_lin) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGB101010_LIN(pix10, G_gamma_lin) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGB101010_LIN(pix10, B_gamma_lin) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGB101010_LIN(pix01, R_gamma_lin) * (255 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGB101010_LIN(pix01, G_gamma_lin) * (255 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGB101010_LIN(pix01, B_gamma_lin) * (255 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGB101010_LIN(pix11, R_gamma_lin) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGB101010_LIN(pix11, G_gamma_lin) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGB101010_LIN(pix11, B_gamma_lin) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_32BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGB101010_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linxRGB8888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_B(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_32BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_32BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_32BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_32BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_xRGB8888_LIN(pix00, R_gamma_lin) * (255 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_xRGB8888_LIN(pix00, G_gamma_lin) * (255 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_xRGB8888_LIN(pix00, B_gamma_lin) * (255 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_xRGB8888_LIN(pix10, R_gamma_lin) * xoff[x];
+			G0 += GP_PIXEL_GET_G_xRGB8888_LIN(pix10, G_gamma_lin) * xoff[x];
+			B0 += GP_PIXEL_GET_B_xRGB8888_LIN(pix10, B_gamma_lin) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_xRGB8888_LIN(pix01, R_gamma_lin) * (255 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_xRGB8888_LIN(pix01, G_gamma_lin) * (255 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_xRGB8888_LIN(pix01, B_gamma_lin) * (255 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_xRGB8888_LIN(pix11, R_gamma_lin) * xoff[x];
+			G1 += GP_PIXEL_GET_G_xRGB8888_LIN(pix11, G_gamma_lin) * xoff[x];
+			B1 += GP_PIXEL_GET_B_xRGB8888_LIN(pix11, B_gamma_lin) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_32BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_xRGB8888_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGBA8888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_B(src);
+	uint8_t *A_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_A(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_B(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_A(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+			uint32_t A, A0, A1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_32BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_32BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_32BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_32BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGBA8888_LIN(pix00, R_gamma_lin) * (255 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGBA8888_LIN(pix00, G_gamma_lin) * (255 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGBA8888_LIN(pix00, B_gamma_lin) * (255 - xoff[x]);
+			A0 = GP_PIXEL_GET_A_RGBA8888_LIN(pix00, A_gamma_lin) * (255 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGBA8888_LIN(pix10, R_gamma_lin) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGBA8888_LIN(pix10, G_gamma_lin) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGBA8888_LIN(pix10, B_gamma_lin) * xoff[x];
+			A0 += GP_PIXEL_GET_A_RGBA8888_LIN(pix10, A_gamma_lin) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGBA8888_LIN(pix01, R_gamma_lin) * (255 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGBA8888_LIN(pix01, G_gamma_lin) * (255 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGBA8888_LIN(pix01, B_gamma_lin) * (255 - xoff[x]);
+			A1 = GP_PIXEL_GET_A_RGBA8888_LIN(pix01, A_gamma_lin) * (255 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGBA8888_LIN(pix11, R_gamma_lin) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGBA8888_LIN(pix11, G_gamma_lin) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGBA8888_LIN(pix11, B_gamma_lin) * xoff[x];
+			A1 += GP_PIXEL_GET_A_RGBA8888_LIN(pix11, A_gamma_lin) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			A = (A1 * yoff[y] + A0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_32BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGBA8888_ENC(R, G, B, A, R_gamma_enc, G_gamma_enc, B_gamma_enc, A_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGB888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_B(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_24BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_24BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_24BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_24BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGB888_LIN(pix00, R_gamma_lin) * (255 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGB888_LIN(pix00, G_gamma_lin) * (255 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGB888_LIN(pix00, B_gamma_lin) * (255 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGB888_LIN(pix10, R_gamma_lin) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGB888_LIN(pix10, G_gamma_lin) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGB888_LIN(pix10, B_gamma_lin) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGB888_LIN(pix01, R_gamma_lin) * (255 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGB888_LIN(pix01, G_gamma_lin) * (255 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGB888_LIN(pix01, B_gamma_lin) * (255 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGB888_LIN(pix11, R_gamma_lin) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGB888_LIN(pix11, G_gamma_lin) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGB888_LIN(pix11, B_gamma_lin) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_24BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGB888_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linBGR888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_B(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_G(src);
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_R(src);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_B(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_G(dst);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_R(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t B, B0, B1;
+			uint32_t G, G0, G1;
+			uint32_t R, R0, R1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_24BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_24BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_24BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_24BPP(src, x1, y1);
+
+			B0 = GP_PIXEL_GET_B_BGR888_LIN(pix00, B_gamma_lin) * (255 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_BGR888_LIN(pix00, G_gamma_lin) * (255 - xoff[x]);
+			R0 = GP_PIXEL_GET_R_BGR888_LIN(pix00, R_gamma_lin) * (255 - xoff[x]);
+
+			B0 += GP_PIXEL_GET_B_BGR888_LIN(pix10, B_gamma_lin) * xoff[x];
+			G0 += GP_PIXEL_GET_G_BGR888_LIN(pix10, G_gamma_lin) * xoff[x];
+			R0 += GP_PIXEL_GET_R_BGR888_LIN(pix10, R_gamma_lin) * xoff[x];
+
+			B1 = GP_PIXEL_GET_B_BGR888_LIN(pix01, B_gamma_lin) * (255 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_BGR888_LIN(pix01, G_gamma_lin) * (255 - xoff[x]);
+			R1 = GP_PIXEL_GET_R_BGR888_LIN(pix01, R_gamma_lin) * (255 - xoff[x]);
+
+			B1 += GP_PIXEL_GET_B_BGR888_LIN(pix11, B_gamma_lin) * xoff[x];
+			G1 += GP_PIXEL_GET_G_BGR888_LIN(pix11, G_gamma_lin) * xoff[x];
+			R1 += GP_PIXEL_GET_R_BGR888_LIN(pix11, R_gamma_lin) * xoff[x];
+
+			B = (B1 * yoff[y] + B0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			R = (R1 * yoff[y] + R0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_24BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_BGR888_ENC(B, G, R, B_gamma_enc, G_gamma_enc, R_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGB555(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_B(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_16BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_16BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_16BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_16BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGB555_LIN(pix00, R_gamma_lin) * (255 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGB555_LIN(pix00, G_gamma_lin) * (255 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGB555_LIN(pix00, B_gamma_lin) * (255 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGB555_LIN(pix10, R_gamma_lin) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGB555_LIN(pix10, G_gamma_lin) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGB555_LIN(pix10, B_gamma_lin) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGB555_LIN(pix01, R_gamma_lin) * (255 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGB555_LIN(pix01, G_gamma_lin) * (255 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGB555_LIN(pix01, B_gamma_lin) * (255 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGB555_LIN(pix11, R_gamma_lin) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGB555_LIN(pix11, G_gamma_lin) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGB555_LIN(pix11, B_gamma_lin) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_16BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGB555_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGB565(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_B(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_16BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_16BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_16BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_16BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGB565_LIN(pix00, R_gamma_lin) * (255 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGB565_LIN(pix00, G_gamma_lin) * (255 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGB565_LIN(pix00, B_gamma_lin) * (255 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGB565_LIN(pix10, R_gamma_lin) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGB565_LIN(pix10, G_gamma_lin) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGB565_LIN(pix10, B_gamma_lin) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGB565_LIN(pix01, R_gamma_lin) * (255 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGB565_LIN(pix01, G_gamma_lin) * (255 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGB565_LIN(pix01, B_gamma_lin) * (255 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGB565_LIN(pix11, R_gamma_lin) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGB565_LIN(pix11, G_gamma_lin) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGB565_LIN(pix11, B_gamma_lin) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_16BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGB565_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGB666(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_B(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_18BPP_DB(src, x0, y0);
+			pix10 = gp_getpixel_raw_18BPP_DB(src, x1, y0);
+			pix01 = gp_getpixel_raw_18BPP_DB(src, x0, y1);
+			pix11 = gp_getpixel_raw_18BPP_DB(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGB666_LIN(pix00, R_gamma_lin) * (255 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGB666_LIN(pix00, G_gamma_lin) * (255 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGB666_LIN(pix00, B_gamma_lin) * (255 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGB666_LIN(pix10, R_gamma_lin) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGB666_LIN(pix10, G_gamma_lin) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGB666_LIN(pix10, B_gamma_lin) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGB666_LIN(pix01, R_gamma_lin) * (255 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGB666_LIN(pix01, G_gamma_lin) * (255 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGB666_LIN(pix01, B_gamma_lin) * (255 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGB666_LIN(pix11, R_gamma_lin) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGB666_LIN(pix11, G_gamma_lin) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGB666_LIN(pix11, B_gamma_lin) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y,
+			                      GP_PIXEL_CREATE_RGB666_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGB332(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_B(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_8BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_8BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_8BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_8BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGB332_LIN(pix00, R_gamma_lin) * (255 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGB332_LIN(pix00, G_gamma_lin) * (255 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGB332_LIN(pix00, B_gamma_lin) * (255 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGB332_LIN(pix10, R_gamma_lin) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGB332_LIN(pix10, G_gamma_lin) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGB332_LIN(pix10, B_gamma_lin) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGB332_LIN(pix01, R_gamma_lin) * (255 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGB332_LIN(pix01, G_gamma_lin) * (255 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGB332_LIN(pix01, B_gamma_lin) * (255 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGB332_LIN(pix11, R_gamma_lin) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGB332_LIN(pix11, G_gamma_lin) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGB332_LIN(pix11, B_gamma_lin) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_8BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGB332_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linCMYK8888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint8_t *K_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_K(src);
+	uint8_t *Y_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_Y(src);
+	uint8_t *M_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_M(src);
+	uint8_t *C_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_C(src);
+	uint8_t *K_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_K(dst);
+	uint8_t *Y_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_Y(dst);
+	uint8_t *M_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_M(dst);
+	uint8_t *C_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_C(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t K, K0, K1;
+			uint32_t Y, Y0, Y1;
+			uint32_t M, M0, M1;
+			uint32_t C, C0, C1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_32BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_32BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_32BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_32BPP(src, x1, y1);
+
+			K0 = GP_PIXEL_GET_K_CMYK8888_LIN(pix00, K_gamma_lin) * (255 - xoff[x]);
+			Y0 = GP_PIXEL_GET_Y_CMYK8888_LIN(pix00, Y_gamma_lin) * (255 - xoff[x]);
+			M0 = GP_PIXEL_GET_M_CMYK8888_LIN(pix00, M_gamma_lin) * (255 - xoff[x]);
+			C0 = GP_PIXEL_GET_C_CMYK8888_LIN(pix00, C_gamma_lin) * (255 - xoff[x]);
+
+			K0 += GP_PIXEL_GET_K_CMYK8888_LIN(pix10, K_gamma_lin) * xoff[x];
+			Y0 += GP_PIXEL_GET_Y_CMYK8888_LIN(pix10, Y_gamma_lin) * xoff[x];
+			M0 += GP_PIXEL_GET_M_CMYK8888_LIN(pix10, M_gamma_lin) * xoff[x];
+			C0 += GP_PIXEL_GET_C_CMYK8888_LIN(pix10, C_gamma_lin) * xoff[x];
+
+			K1 = GP_PIXEL_GET_K_CMYK8888_LIN(pix01, K_gamma_lin) * (255 - xoff[x]);
+			Y1 = GP_PIXEL_GET_Y_CMYK8888_LIN(pix01, Y_gamma_lin) * (255 - xoff[x]);
+			M1 = GP_PIXEL_GET_M_CMYK8888_LIN(pix01, M_gamma_lin) * (255 - xoff[x]);
+			C1 = GP_PIXEL_GET_C_CMYK8888_LIN(pix01, C_gamma_lin) * (255 - xoff[x]);
+
+			K1 += GP_PIXEL_GET_K_CMYK8888_LIN(pix11, K_gamma_lin) * xoff[x];
+			Y1 += GP_PIXEL_GET_Y_CMYK8888_LIN(pix11, Y_gamma_lin) * xoff[x];
+			M1 += GP_PIXEL_GET_M_CMYK8888_LIN(pix11, M_gamma_lin) * xoff[x];
+			C1 += GP_PIXEL_GET_C_CMYK8888_LIN(pix11, C_gamma_lin) * xoff[x];
+
+			K = (K1 * yoff[y] + K0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			Y = (Y1 * yoff[y] + Y0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			M = (M1 * yoff[y] + M0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			C = (C1 * yoff[y] + C0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_32BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_CMYK8888_ENC(K, Y, M, C, K_gamma_enc, Y_gamma_enc, M_gamma_enc, C_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linG1_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_DB_V(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_1BPP_DB(src, x0, y0);
+			pix10 = gp_getpixel_raw_1BPP_DB(src, x1, y0);
+			pix01 = gp_getpixel_raw_1BPP_DB(src, x0, y1);
+			pix11 = gp_getpixel_raw_1BPP_DB(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_G1_DB_LIN(pix00, V_gamma_lin) * (255 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_G1_DB_LIN(pix10, V_gamma_lin) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_G1_DB_LIN(pix01, V_gamma_lin) * (255 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_G1_DB_LIN(pix11, V_gamma_lin) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y,
+			                      GP_PIXEL_CREATE_G1_DB_ENC(V, V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linG2_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_DB_V(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_2BPP_DB(src, x0, y0);
+			pix10 = gp_getpixel_raw_2BPP_DB(src, x1, y0);
+			pix01 = gp_getpixel_raw_2BPP_DB(src, x0, y1);
+			pix11 = gp_getpixel_raw_2BPP_DB(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_G2_DB_LIN(pix00, V_gamma_lin) * (255 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_G2_DB_LIN(pix10, V_gamma_lin) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_G2_DB_LIN(pix01, V_gamma_lin) * (255 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_G2_DB_LIN(pix11, V_gamma_lin) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y,
+			                      GP_PIXEL_CREATE_G2_DB_ENC(V, V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linG4_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_DB_V(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_4BPP_DB(src, x0, y0);
+			pix10 = gp_getpixel_raw_4BPP_DB(src, x1, y0);
+			pix01 = gp_getpixel_raw_4BPP_DB(src, x0, y1);
+			pix11 = gp_getpixel_raw_4BPP_DB(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_G4_DB_LIN(pix00, V_gamma_lin) * (255 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_G4_DB_LIN(pix10, V_gamma_lin) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_G4_DB_LIN(pix01, V_gamma_lin) * (255 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_G4_DB_LIN(pix11, V_gamma_lin) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y,
+			                      GP_PIXEL_CREATE_G4_DB_ENC(V, V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linG1_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_UB_V(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_1BPP_UB(src, x0, y0);
+			pix10 = gp_getpixel_raw_1BPP_UB(src, x1, y0);
+			pix01 = gp_getpixel_raw_1BPP_UB(src, x0, y1);
+			pix11 = gp_getpixel_raw_1BPP_UB(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_G1_UB_LIN(pix00, V_gamma_lin) * (255 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_G1_UB_LIN(pix10, V_gamma_lin) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_G1_UB_LIN(pix01, V_gamma_lin) * (255 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_G1_UB_LIN(pix11, V_gamma_lin) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y,
+			                      GP_PIXEL_CREATE_G1_UB_ENC(V, V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linG2_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_UB_V(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_2BPP_UB(src, x0, y0);
+			pix10 = gp_getpixel_raw_2BPP_UB(src, x1, y0);
+			pix01 = gp_getpixel_raw_2BPP_UB(src, x0, y1);
+			pix11 = gp_getpixel_raw_2BPP_UB(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_G2_UB_LIN(pix00, V_gamma_lin) * (255 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_G2_UB_LIN(pix10, V_gamma_lin) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_G2_UB_LIN(pix01, V_gamma_lin) * (255 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_G2_UB_LIN(pix11, V_gamma_lin) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y,
+			                      GP_PIXEL_CREATE_G2_UB_ENC(V, V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linG4_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_UB_V(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_4BPP_UB(src, x0, y0);
+			pix10 = gp_getpixel_raw_4BPP_UB(src, x1, y0);
+			pix01 = gp_getpixel_raw_4BPP_UB(src, x0, y1);
+			pix11 = gp_getpixel_raw_4BPP_UB(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_G4_UB_LIN(pix00, V_gamma_lin) * (255 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_G4_UB_LIN(pix10, V_gamma_lin) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_G4_UB_LIN(pix01, V_gamma_lin) * (255 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_G4_UB_LIN(pix11, V_gamma_lin) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y,
+			                      GP_PIXEL_CREATE_G4_UB_ENC(V, V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linG8(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G8_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G8_V(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_8BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_8BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_8BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_8BPP(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_G8_LIN(pix00, V_gamma_lin) * (255 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_G8_LIN(pix10, V_gamma_lin) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_G8_LIN(pix01, V_gamma_lin) * (255 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_G8_LIN(pix11, V_gamma_lin) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_8BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_G8_ENC(V, V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linGA88(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_V(src);
+	uint8_t *A_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_A(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_V(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_A(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+			uint32_t A, A0, A1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_16BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_16BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_16BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_16BPP(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_GA88_LIN(pix00, V_gamma_lin) * (255 - xoff[x]);
+			A0 = GP_PIXEL_GET_A_GA88_LIN(pix00, A_gamma_lin) * (255 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_GA88_LIN(pix10, V_gamma_lin) * xoff[x];
+			A0 += GP_PIXEL_GET_A_GA88_LIN(pix10, A_gamma_lin) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_GA88_LIN(pix01, V_gamma_lin) * (255 - xoff[x]);
+			A1 = GP_PIXEL_GET_A_GA88_LIN(pix01, A_gamma_lin) * (255 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_GA88_LIN(pix11, V_gamma_lin) * xoff[x];
+			A1 += GP_PIXEL_GET_A_GA88_LIN(pix11, A_gamma_lin) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			A = (A1 * yoff[y] + A0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_16BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_GA88_ENC(V, A, V_gamma_enc, A_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linG16(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G16_V(src);
+	uint16_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G16_V(dst);
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/* Interpolate */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_16BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_16BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_16BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_16BPP(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_G16_LIN(pix00, V_gamma_lin) * (255 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_G16_LIN(pix10, V_gamma_lin) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_G16_LIN(pix01, V_gamma_lin) * (255 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_G16_LIN(pix11, V_gamma_lin) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (255 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_16BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_G16_ENC(V, V_gamma_enc));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin(const gp_pixmap *src, gp_pixmap *dst,
+                     gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return resize_linRGB101010(src, dst, callback);
+	break;
+	case GP_PIXEL_xRGB8888:
+		return resize_linxRGB8888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return resize_linRGBA8888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return resize_linRGB888(src, dst, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return resize_linBGR888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return resize_linRGB555(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return resize_linRGB565(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return resize_linRGB666(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return resize_linRGB332(src, dst, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return resize_linCMYK8888(src, dst, callback);
+	break;
+	case GP_PIXEL_G1_DB:
+		return resize_linG1_DB(src, dst, callback);
+	break;
+	case GP_PIXEL_G2_DB:
+		return resize_linG2_DB(src, dst, callback);
+	break;
+	case GP_PIXEL_G4_DB:
+		return resize_linG4_DB(src, dst, callback);
+	break;
+	case GP_PIXEL_G1_UB:
+		return resize_linG1_UB(src, dst, callback);
+	break;
+	case GP_PIXEL_G2_UB:
+		return resize_linG2_UB(src, dst, callback);
+	break;
+	case GP_PIXEL_G4_UB:
+		return resize_linG4_UB(src, dst, callback);
+	break;
+	case GP_PIXEL_G8:
+		return resize_linG8(src, dst, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return resize_linGA88(src, dst, callback);
+	break;
+	case GP_PIXEL_G16:
+		return resize_linG16(src, dst, callback);
+	break;
+	default:
+		GP_WARN("Invalid pixel type %s",
+		        gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+int gp_filter_resize_linear_int(const gp_pixmap *src, gp_pixmap *dst,
+                                gp_progress_cb *callback)
+{
+	if (src->pixel_type != dst->pixel_type) {
+		GP_WARN("The src and dst pixel types must match");
+		errno = EINVAL;
+		return 1;
+	}
+
+	return resize_lin(src, dst, callback);
+}
+
+static int resize_lin_lf(const gp_pixmap *src, gp_pixmap *dst,
+                          gp_progress_cb *callback)
+{
+	float x_rat = 1.00 * dst->w / src->w;
+	float y_rat = 1.00 * dst->h / src->h;
+
+	if (x_rat < 1.00 && y_rat < 1.00) {
+
+		GP_DEBUG(1, "Downscaling image %ux%u -> %ux%u %2.2f %2.2f",
+	                     src->w, src->h, dst->w, dst->h, x_rat, y_rat);
+
+		switch (src->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			return resize_lin_lf_RGB101010(src, dst, callback);
+		break;
+		case GP_PIXEL_xRGB8888:
+			return resize_lin_lf_xRGB8888(src, dst, callback);
+		break;
+		case GP_PIXEL_RGBA8888:
+			return resize_lin_lf_RGBA8888(src, dst, callback);
+		break;
+		case GP_PIXEL_RGB888:
+			return resize_lin_lf_RGB888(src, dst, callback);
+		break;
+		case GP_PIXEL_BGR888:
+			return resize_lin_lf_BGR888(src, dst, callback);
+		break;
+		case GP_PIXEL_RGB555:
+			return resize_lin_lf_RGB555(src, dst, callback);
+		break;
+		case GP_PIXEL_RGB565:
+			return resize_lin_lf_RGB565(src, dst, callback);
+		break;
+		case GP_PIXEL_RGB666:
+			return resize_lin_lf_RGB666(src, dst, callback);
+		break;
+		case GP_PIXEL_RGB332:
+			return resize_lin_lf_RGB332(src, dst, callback);
+		break;
+		case GP_PIXEL_CMYK8888:
+			return resize_lin_lf_CMYK8888(src, dst, callback);
+		break;
+		case GP_PIXEL_G1_DB:
+			return resize_lin_lf_G1_DB(src, dst, callback);
+		break;
+		case GP_PIXEL_G2_DB:
+			return resize_lin_lf_G2_DB(src, dst, callback);
+		break;
+		case GP_PIXEL_G4_DB:
+			return resize_lin_lf_G4_DB(src, dst, callback);
+		break;
+		case GP_PIXEL_G1_UB:
+			return resize_lin_lf_G1_UB(src, dst, callback);
+		break;
+		case GP_PIXEL_G2_UB:
+			return resize_lin_lf_G2_UB(src, dst, callback);
+		break;
+		case GP_PIXEL_G4_UB:
+			return resize_lin_lf_G4_UB(src, dst, callback);
+		break;
+		case GP_PIXEL_G8:
+			return resize_lin_lf_G8(src, dst, callback);
+		break;
+		case GP_PIXEL_GA88:
+			return resize_lin_lf_GA88(src, dst, callback);
+		break;
+		case GP_PIXEL_G16:
+			return resize_lin_lf_G16(src, dst, callback);
+		break;
+		default:
+			GP_WARN("Invalid pixel type %s",
+			        gp_pixel_type_name(src->pixel_type));
+			errno = EINVAL;
+			return -1;
+		}
+	}
+
+	//TODO: x_rat > 1.00 && y_rat < 1.00
+	//TODO: x_rat < 1.00 && y_rat > 1.00
+
+	return resize_lin(src, dst, callback);
+}
+
+int gp_filter_resize_linear_lf_int(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	if (src->pixel_type != dst->pixel_type) {
+		GP_WARN("The src and dst pixel types must match");
+		errno = EINVAL;
+		return 1;
+	}
+
+	return resize_lin_lf(src, dst, callback);
+}
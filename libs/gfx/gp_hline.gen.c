@@ -0,0 +1,256 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_hline.gen.c
+ *
+ * GENERATED on 2026 10 19 15:07:56 from gp_hline.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Horizontal line drawing
+ *
+ * Copyright (C) 2009-2011 Jiri "BlueBear" Dluhos
+ *                         <jiri.bluebear.dluhos@gmail.com>
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_get_put_pixel.gen.h>
+#include <core/gp_write_pixels.gen.h>
+
+#include <gfx/gp_hline.h>
+
+void gp_hline_raw_1BPP_DB(gp_pixmap *pixmap, int x0, int x1, int y,
+			       gp_pixel pixel)
+{
+	/* draw always from left to right, swap coords if necessary */
+	if (x0 > x1)
+		GP_SWAP(x0, x1);
+
+	/* return immediately if the line is completely out of surface */
+	if (y < 0 || y >= (int) pixmap->h || x1 < 0 || x0 >= (int) pixmap->w)
+		return;
+
+	/* clip the line against surface boundaries */
+	x0 = GP_MAX(x0, 0);
+	x1 = GP_MIN(x1, (gp_coord) pixmap->w - 1);
+
+	size_t length = 1 + x1 - x0;
+	void *start = GP_PIXEL_ADDR_1BPP_DB(pixmap, x0, y);
+
+	unsigned int offset = GP_PIXEL_ADDR_OFFSET_1BPP_DB(pixmap, x0);
+	gp_write_pixels_1BPP_DB(start, offset, length, pixel);
+}
+
+void gp_hline_raw_1BPP_UB(gp_pixmap *pixmap, int x0, int x1, int y,
+			       gp_pixel pixel)
+{
+	/* draw always from left to right, swap coords if necessary */
+	if (x0 > x1)
+		GP_SWAP(x0, x1);
+
+	/* return immediately if the line is completely out of surface */
+	if (y < 0 || y >= (int) pixmap->h || x1 < 0 || x0 >= (int) pixmap->w)
+		return;
+
+	/* clip the line against surface boundaries */
+	x0 = GP_MAX(x0, 0);
+	x1 = GP_MIN(x1, (gp_coord) pixmap->w - 1);
+
+	size_t length = 1 + x1 - x0;
+	void *start = GP_PIXEL_ADDR_1BPP_UB(pixmap, x0, y);
+
+	unsigned int offset = GP_PIXEL_ADDR_OFFSET_1BPP_UB(pixmap, x0);
+	gp_write_pixels_1BPP_UB(start, offset, length, pixel);
+}
+
+void gp_hline_raw_2BPP_DB(gp_pixmap *pixmap, int x0, int x1, int y,
+			       gp_pixel pixel)
+{
+	/* draw always from left to right, swap coords if necessary */
+	if (x0 > x1)
+		GP_SWAP(x0, x1);
+
+	/* return immediately if the line is completely out of surface */
+	if (y < 0 || y >= (int) pixmap->h || x1 < 0 || x0 >= (int) pixmap->w)
+		return;
+
+	/* clip the line against surface boundaries */
+	x0 = GP_MAX(x0, 0);
+	x1 = GP_MIN(x1, (gp_coord) pixmap->w - 1);
+
+	size_t length = 1 + x1 - x0;
+	void *start = GP_PIXEL_ADDR_2BPP_DB(pixmap, x0, y);
+
+	unsigned int offset = GP_PIXEL_ADDR_OFFSET_2BPP_DB(pixmap, x0);
+	gp_write_pixels_2BPP_DB(start, offset, length, pixel);
+}
+
+void gp_hline_raw_2BPP_UB(gp_pixmap *pixmap, int x0, int x1, int y,
+			       gp_pixel pixel)
+{
+	/* draw always from left to right, swap coords if necessary */
+	if (x0 > x1)
+		GP_SWAP(x0, x1);
+
+	/* return immediately if the line is completely out of surface */
+	if (y < 0 || y >= (int) pixmap->h || x1 < 0 || x0 >= (int) pixmap->w)
+		return;
+
+	/* clip the line against surface boundaries */
+	x0 = GP_MAX(x0, 0);
+	x1 = GP_MIN(x1, (gp_coord) pixmap->w - 1);
+
+	size_t length = 1 + x1 - x0;
+	void *start = GP_PIXEL_ADDR_2BPP_UB(pixmap, x0, y);
+
+	unsigned int offset = GP_PIXEL_ADDR_OFFSET_2BPP_UB(pixmap, x0);
+	gp_write_pixels_2BPP_UB(start, offset, length, pixel);
+}
+
+void gp_hline_raw_4BPP_DB(gp_pixmap *pixmap, int x0, int x1, int y,
+			       gp_pixel pixel)
+{
+	/* draw always from left to right, swap coords if necessary */
+	if (x0 > x1)
+		GP_SWAP(x0, x1);
+
+	/* return immediately if the line is completely out of surface */
+	if (y < 0 || y >= (int) pixmap->h || x1 < 0 || x0 >= (int) pixmap->w)
+		return;
+
+	/* clip the line against surface boundaries */
+	x0 = GP_MAX(x0, 0);
+	x1 = GP_MIN(x1, (gp_coord) pixmap->w - 1);
+
+	size_t length = 1 + x1 - x0;
+	void *start = GP_PIXEL_ADDR_4BPP_DB(pixmap, x0, y);
+
+	unsigned int offset = GP_PIXEL_ADDR_OFFSET_4BPP_DB(pixmap, x0);
+	gp_write_pixels_4BPP_DB(start, offset, length, pixel);
+}
+
+void gp_hline_raw_4BPP_UB(gp_pixmap *pixmap, int x0, int x1, int y,
+			       gp_pixel pixel)
+{
+	/* draw always from left to right, swap coords if necessary */
+	if (x0 > x1)
+		GP_SWAP(x0, x1);
+
+	/* return immediately if the line is completely out of surface */
+	if (y < 0 || y >= (int) pixmap->h || x1 < 0 || x0 >= (int) pixmap->w)
+		return;
+
+	/* clip the line against surface boundaries */
+	x0 = GP_MAX(x0, 0);
+	x1 = GP_MIN(x1, (gp_coord) pixmap->w - 1);
+
+	size_t length = 1 + x1 - x0;
+	void *start = GP_PIXEL_ADDR_4BPP_UB(pixmap, x0, y);
+
+	unsigned int offset = GP_PIXEL_ADDR_OFFSET_4BPP_UB(pixmap, x0);
+	gp_write_pixels_4BPP_UB(start, offset, length, pixel);
+}
+
+void gp_hline_raw_8BPP(gp_pixmap *pixmap, int x0, int x1, int y,
+			       gp_pixel pixel)
+{
+	/* draw always from left to right, swap coords if necessary */
+	if (x0 > x1)
+		GP_SWAP(x0, x1);
+
+	/* return immediately if the line is completely out of surface */
+	if (y < 0 || y >= (int) pixmap->h || x1 < 0 || x0 >= (int) pixmap->w)
+		return;
+
+	/* clip the line against surface boundaries */
+	x0 = GP_MAX(x0, 0);
+	x1 = GP_MIN(x1, (gp_coord) pixmap->w - 1);
+
+	size_t length = 1 + x1 - x0;
+	void *start = GP_PIXEL_ADDR_8BPP(pixmap, x0, y);
+
+	gp_write_pixels_8BPP(start, length, pixel);
+}
+
+void gp_hline_raw_16BPP(gp_pixmap *pixmap, int x0, int x1, int y,
+			       gp_pixel pixel)
+{
+	/* draw always from left to right, swap coords if necessary */
+	if (x0 > x1)
+		GP_SWAP(x0, x1);
+
+	/* return immediately if the line is completely out of surface */
+	if (y < 0 || y >= (int) pixmap->h || x1 < 0 || x0 >= (int) pixmap->w)
+		return;
+
+	/* clip the line against surface boundaries */
+	x0 = GP_MAX(x0, 0);
+	x1 = GP_MIN(x1, (gp_coord) pixmap->w - 1);
+
+	size_t length = 1 + x1 - x0;
+	void *start = GP_PIXEL_ADDR_16BPP(pixmap, x0, y);
+
+	gp_write_pixels_16BPP(start, length, pixel);
+}
+
+void gp_hline_raw_24BPP(gp_pixmap *pixmap, int x0, int x1, int y,
+			       gp_pixel pixel)
+{
+	/* draw always from left to right, swap coords if necessary */
+	if (x0 > x1)
+		GP_SWAP(x0, x1);
+
+	/* return immediately if the line is completely out of surface */
+	if (y < 0 || y >= (int) pixmap->h || x1 < 0 || x0 >= (int) pixmap->w)
+		return;
+
+	/* clip the line against surface boundaries */
+	x0 = GP_MAX(x0, 0);
+	x1 = GP_MIN(x1, (gp_coord) pixmap->w - 1);
+
+	size_t length = 1 + x1 - x0;
+	void *start = GP_PIXEL_ADDR_24BPP(pixmap, x0, y);
+
+	gp_write_pixels_24BPP(start, length, pixel);
+}
+
+void gp_hline_raw_32BPP(gp_pixmap *pixmap, int x0, int x1, int y,
+			       gp_pixel pixel)
+{
+	/* draw always from left to right, swap coords if necessary */
+	if (x0 > x1)
+		GP_SWAP(x0, x1);
+
+	/* return immediately if the line is completely out of surface */
+	if (y < 0 || y >= (int) pixmap->h || x1 < 0 || x0 >= (int) pixmap->w)
+		return;
+
+	/* clip the line against surface boundaries */
+	x0 = GP_MAX(x0, 0);
+	x1 = GP_MIN(x1, (gp_coord) pixmap->w - 1);
+
+	size_t length = 1 + x1 - x0;
+	void *start = GP_PIXEL_ADDR_32BPP(pixmap, x0, y);
+
+	gp_write_pixels_32BPP(start, length, pixel);
+}
+
+void gp_hline_raw_18BPP_DB(gp_pixmap *pixmap, int x0, int x1, int y,
+			       gp_pixel pixel)
+{
+	/* draw always from left to right, swap coords if necessary */
+	if (x0 > x1)
+		GP_SWAP(x0, x1);
+
+	/* return immediately if the line is completely out of surface */
+	if (y < 0 || y >= (int) pixmap->h || x1 < 0 || x0 >= (int) pixmap->w)
+		return;
+
+	/* clip the line against surface boundaries */
+	x0 = GP_MAX(x0, 0);
+	x1 = GP_MIN(x1, (gp_coord) pixmap->w - 1);
+
+	for (;x0 <= x1; x0++)
+		gp_putpixel_raw_18BPP_DB(pixmap, x0, y, pixel);
+}
+
@@ -0,0 +1,834 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_symbol.gen.c
+ *
+ * GENERATED on 2026 10 19 15:07:55 from gp_symbol.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Copyright (C) 2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_common.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_pixel_pack.gen.h>
+
+#include <gfx/gp_symbol.h>
+#include <gfx/gp_hline.h>
+#include <gfx/gp_vline.h>
+
+static void triangle_up_1BPP_DB(gp_pixmap *pixmap,
+                                        gp_coord xcenter, gp_coord ycenter,
+                                        gp_size rx, gp_size ry,
+                                        gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_1BPP_DB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_1BPP_DB(pixmap, xcenter + len, xcenter - len, ycenter + y - ry, pixel);
+	}
+}
+
+static void triangle_down_1BPP_DB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_1BPP_DB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_1BPP_DB(pixmap, xcenter + len, xcenter - len, ycenter - y + ry, pixel);
+	}
+}
+
+static void triangle_left_1BPP_DB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_1BPP_DB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_1BPP_DB_clip(pixmap, xcenter + x - rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_right_1BPP_DB(gp_pixmap *pixmap,
+                                           gp_coord xcenter, gp_coord ycenter,
+                                           gp_size rx, gp_size ry,
+                                           gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_1BPP_DB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_1BPP_DB_clip(pixmap, xcenter - x + rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_up_1BPP_UB(gp_pixmap *pixmap,
+                                        gp_coord xcenter, gp_coord ycenter,
+                                        gp_size rx, gp_size ry,
+                                        gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_1BPP_UB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_1BPP_UB(pixmap, xcenter + len, xcenter - len, ycenter + y - ry, pixel);
+	}
+}
+
+static void triangle_down_1BPP_UB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_1BPP_UB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_1BPP_UB(pixmap, xcenter + len, xcenter - len, ycenter - y + ry, pixel);
+	}
+}
+
+static void triangle_left_1BPP_UB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_1BPP_UB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_1BPP_UB_clip(pixmap, xcenter + x - rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_right_1BPP_UB(gp_pixmap *pixmap,
+                                           gp_coord xcenter, gp_coord ycenter,
+                                           gp_size rx, gp_size ry,
+                                           gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_1BPP_UB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_1BPP_UB_clip(pixmap, xcenter - x + rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_up_2BPP_DB(gp_pixmap *pixmap,
+                                        gp_coord xcenter, gp_coord ycenter,
+                                        gp_size rx, gp_size ry,
+                                        gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_2BPP_DB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_2BPP_DB(pixmap, xcenter + len, xcenter - len, ycenter + y - ry, pixel);
+	}
+}
+
+static void triangle_down_2BPP_DB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_2BPP_DB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_2BPP_DB(pixmap, xcenter + len, xcenter - len, ycenter - y + ry, pixel);
+	}
+}
+
+static void triangle_left_2BPP_DB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_2BPP_DB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_2BPP_DB_clip(pixmap, xcenter + x - rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_right_2BPP_DB(gp_pixmap *pixmap,
+                                           gp_coord xcenter, gp_coord ycenter,
+                                           gp_size rx, gp_size ry,
+                                           gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_2BPP_DB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_2BPP_DB_clip(pixmap, xcenter - x + rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_up_2BPP_UB(gp_pixmap *pixmap,
+                                        gp_coord xcenter, gp_coord ycenter,
+                                        gp_size rx, gp_size ry,
+                                        gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_2BPP_UB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_2BPP_UB(pixmap, xcenter + len, xcenter - len, ycenter + y - ry, pixel);
+	}
+}
+
+static void triangle_down_2BPP_UB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_2BPP_UB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_2BPP_UB(pixmap, xcenter + len, xcenter - len, ycenter - y + ry, pixel);
+	}
+}
+
+static void triangle_left_2BPP_UB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_2BPP_UB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_2BPP_UB_clip(pixmap, xcenter + x - rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_right_2BPP_UB(gp_pixmap *pixmap,
+                                           gp_coord xcenter, gp_coord ycenter,
+                                           gp_size rx, gp_size ry,
+                                           gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_2BPP_UB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_2BPP_UB_clip(pixmap, xcenter - x + rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_up_4BPP_DB(gp_pixmap *pixmap,
+                                        gp_coord xcenter, gp_coord ycenter,
+                                        gp_size rx, gp_size ry,
+                                        gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_4BPP_DB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_4BPP_DB(pixmap, xcenter + len, xcenter - len, ycenter + y - ry, pixel);
+	}
+}
+
+static void triangle_down_4BPP_DB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_4BPP_DB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_4BPP_DB(pixmap, xcenter + len, xcenter - len, ycenter - y + ry, pixel);
+	}
+}
+
+static void triangle_left_4BPP_DB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_4BPP_DB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_4BPP_DB_clip(pixmap, xcenter + x - rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_right_4BPP_DB(gp_pixmap *pixmap,
+                                           gp_coord xcenter, gp_coord ycenter,
+                                           gp_size rx, gp_size ry,
+                                           gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_4BPP_DB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_4BPP_DB_clip(pixmap, xcenter - x + rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_up_4BPP_UB(gp_pixmap *pixmap,
+                                        gp_coord xcenter, gp_coord ycenter,
+                                        gp_size rx, gp_size ry,
+                                        gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_4BPP_UB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_4BPP_UB(pixmap, xcenter + len, xcenter - len, ycenter + y - ry, pixel);
+	}
+}
+
+static void triangle_down_4BPP_UB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_4BPP_UB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_4BPP_UB(pixmap, xcenter + len, xcenter - len, ycenter - y + ry, pixel);
+	}
+}
+
+static void triangle_left_4BPP_UB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_4BPP_UB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_4BPP_UB_clip(pixmap, xcenter + x - rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_right_4BPP_UB(gp_pixmap *pixmap,
+                                           gp_coord xcenter, gp_coord ycenter,
+                                           gp_size rx, gp_size ry,
+                                           gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_4BPP_UB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_4BPP_UB_clip(pixmap, xcenter - x + rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_up_8BPP(gp_pixmap *pixmap,
+                                        gp_coord xcenter, gp_coord ycenter,
+                                        gp_size rx, gp_size ry,
+                                        gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_8BPP_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_8BPP(pixmap, xcenter + len, xcenter - len, ycenter + y - ry, pixel);
+	}
+}
+
+static void triangle_down_8BPP(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_8BPP_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_8BPP(pixmap, xcenter + len, xcenter - len, ycenter - y + ry, pixel);
+	}
+}
+
+static void triangle_left_8BPP(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_8BPP(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_8BPP_clip(pixmap, xcenter + x - rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_right_8BPP(gp_pixmap *pixmap,
+                                           gp_coord xcenter, gp_coord ycenter,
+                                           gp_size rx, gp_size ry,
+                                           gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_8BPP(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_8BPP_clip(pixmap, xcenter - x + rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_up_16BPP(gp_pixmap *pixmap,
+                                        gp_coord xcenter, gp_coord ycenter,
+                                        gp_size rx, gp_size ry,
+                                        gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_16BPP_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_16BPP(pixmap, xcenter + len, xcenter - len, ycenter + y - ry, pixel);
+	}
+}
+
+static void triangle_down_16BPP(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_16BPP_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_16BPP(pixmap, xcenter + len, xcenter - len, ycenter - y + ry, pixel);
+	}
+}
+
+static void triangle_left_16BPP(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_16BPP(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_16BPP_clip(pixmap, xcenter + x - rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_right_16BPP(gp_pixmap *pixmap,
+                                           gp_coord xcenter, gp_coord ycenter,
+                                           gp_size rx, gp_size ry,
+                                           gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_16BPP(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_16BPP_clip(pixmap, xcenter - x + rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_up_24BPP(gp_pixmap *pixmap,
+                                        gp_coord xcenter, gp_coord ycenter,
+                                        gp_size rx, gp_size ry,
+                                        gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_24BPP_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_24BPP(pixmap, xcenter + len, xcenter - len, ycenter + y - ry, pixel);
+	}
+}
+
+static void triangle_down_24BPP(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_24BPP_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_24BPP(pixmap, xcenter + len, xcenter - len, ycenter - y + ry, pixel);
+	}
+}
+
+static void triangle_left_24BPP(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_24BPP(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_24BPP_clip(pixmap, xcenter + x - rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_right_24BPP(gp_pixmap *pixmap,
+                                           gp_coord xcenter, gp_coord ycenter,
+                                           gp_size rx, gp_size ry,
+                                           gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_24BPP(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_24BPP_clip(pixmap, xcenter - x + rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_up_32BPP(gp_pixmap *pixmap,
+                                        gp_coord xcenter, gp_coord ycenter,
+                                        gp_size rx, gp_size ry,
+                                        gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_32BPP_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_32BPP(pixmap, xcenter + len, xcenter - len, ycenter + y - ry, pixel);
+	}
+}
+
+static void triangle_down_32BPP(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_32BPP_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_32BPP(pixmap, xcenter + len, xcenter - len, ycenter - y + ry, pixel);
+	}
+}
+
+static void triangle_left_32BPP(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_32BPP(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_32BPP_clip(pixmap, xcenter + x - rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_right_32BPP(gp_pixmap *pixmap,
+                                           gp_coord xcenter, gp_coord ycenter,
+                                           gp_size rx, gp_size ry,
+                                           gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_32BPP(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_32BPP_clip(pixmap, xcenter - x + rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_up_18BPP_DB(gp_pixmap *pixmap,
+                                        gp_coord xcenter, gp_coord ycenter,
+                                        gp_size rx, gp_size ry,
+                                        gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_18BPP_DB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_18BPP_DB(pixmap, xcenter + len, xcenter - len, ycenter + y - ry, pixel);
+	}
+}
+
+static void triangle_down_18BPP_DB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord y;
+
+	if (ry == 0) {
+		gp_vline_raw_18BPP_DB_clip(pixmap, xcenter - rx, xcenter + rx, ry, pixel);
+		return;
+	}
+
+	for (y = 0; y <= 2 * (gp_coord)ry; y++) {
+		gp_coord len = (y * rx) / (2  * ry);
+		gp_hline_raw_18BPP_DB(pixmap, xcenter + len, xcenter - len, ycenter - y + ry, pixel);
+	}
+}
+
+static void triangle_left_18BPP_DB(gp_pixmap *pixmap,
+                                          gp_coord xcenter, gp_coord ycenter,
+                                          gp_size rx, gp_size ry,
+                                          gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_18BPP_DB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_18BPP_DB_clip(pixmap, xcenter + x - rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+static void triangle_right_18BPP_DB(gp_pixmap *pixmap,
+                                           gp_coord xcenter, gp_coord ycenter,
+                                           gp_size rx, gp_size ry,
+                                           gp_pixel pixel)
+{
+	gp_coord x;
+
+	if (rx == 0) {
+		gp_hline_raw_18BPP_DB(pixmap, xcenter, ycenter - ry, ycenter + ry, pixel);
+		return;
+	}
+
+	for (x = 0; x <= 2 * (gp_coord)rx; x++) {
+		gp_coord len = (x * ry) / (2 * rx);
+		gp_vline_raw_18BPP_DB_clip(pixmap, xcenter - x + rx, ycenter - len, ycenter + len, pixel);
+	}
+}
+
+
+
+void gp_symbol_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
+                   gp_size rx, gp_size ry, enum gp_symbol_type stype, gp_pixel pixel)
+{
+	GP_CHECK_PIXMAP(pixmap);
+
+	switch (stype) {
+	case GP_TRIANGLE_UP:
+		GP_FN_PER_PACK_PIXMAP(triangle_up, pixmap, pixmap, xcenter, ycenter, rx, ry, pixel);
+	break;
+	case GP_TRIANGLE_DOWN:
+		GP_FN_PER_PACK_PIXMAP(triangle_down, pixmap, pixmap, xcenter, ycenter, rx, ry, pixel);
+	break;
+	case GP_TRIANGLE_LEFT:
+		GP_FN_PER_PACK_PIXMAP(triangle_left, pixmap, pixmap, xcenter, ycenter, rx, ry, pixel);
+	break;
+	case GP_TRIANGLE_RIGHT:
+		GP_FN_PER_PACK_PIXMAP(triangle_right, pixmap, pixmap, xcenter, ycenter, rx, ry, pixel);
+	break;
+	}
+}
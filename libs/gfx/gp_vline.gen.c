@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_vline.gen.c
+ *
+ * GENERATED on 2026 10 19 15:07:55 from gp_vline.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Vertical Line drawing algorithm.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_get_put_pixel.h>
+#include <gfx/gp_vline.gen.h>
+
+void gp_vline_raw_1BPP_DB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	int y;
+
+	for (y = y0; y <= y1; y++)
+		gp_putpixel_raw_1BPP_DB(pixmap, x, y, pixel);
+}
+
+void gp_vline_raw_1BPP_DB_clip(gp_pixmap *pixmap, gp_coord x,
+                                       gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	if (x < 0 || x >= (gp_coord) pixmap->w ||
+	    y1 < 0 || y0 >= (gp_coord) pixmap->h)
+		return;
+
+	y0 = GP_MAX(y0, 0);
+	y1 = GP_MIN(y1, (gp_coord) pixmap->h - 1);
+
+	gp_vline_raw_1BPP_DB(pixmap, x, y0, y1, pixel);
+}
+void gp_vline_raw_1BPP_UB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	int y;
+
+	for (y = y0; y <= y1; y++)
+		gp_putpixel_raw_1BPP_UB(pixmap, x, y, pixel);
+}
+
+void gp_vline_raw_1BPP_UB_clip(gp_pixmap *pixmap, gp_coord x,
+                                       gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	if (x < 0 || x >= (gp_coord) pixmap->w ||
+	    y1 < 0 || y0 >= (gp_coord) pixmap->h)
+		return;
+
+	y0 = GP_MAX(y0, 0);
+	y1 = GP_MIN(y1, (gp_coord) pixmap->h - 1);
+
+	gp_vline_raw_1BPP_UB(pixmap, x, y0, y1, pixel);
+}
+void gp_vline_raw_2BPP_DB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	int y;
+
+	for (y = y0; y <= y1; y++)
+		gp_putpixel_raw_2BPP_DB(pixmap, x, y, pixel);
+}
+
+void gp_vline_raw_2BPP_DB_clip(gp_pixmap *pixmap, gp_coord x,
+                                       gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	if (x < 0 || x >= (gp_coord) pixmap->w ||
+	    y1 < 0 || y0 >= (gp_coord) pixmap->h)
+		return;
+
+	y0 = GP_MAX(y0, 0);
+	y1 = GP_MIN(y1, (gp_coord) pixmap->h - 1);
+
+	gp_vline_raw_2BPP_DB(pixmap, x, y0, y1, pixel);
+}
+void gp_vline_raw_2BPP_UB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	int y;
+
+	for (y = y0; y <= y1; y++)
+		gp_putpixel_raw_2BPP_UB(pixmap, x, y, pixel);
+}
+
+void gp_vline_raw_2BPP_UB_clip(gp_pixmap *pixmap, gp_coord x,
+                                       gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	if (x < 0 || x >= (gp_coord) pixmap->w ||
+	    y1 < 0 || y0 >= (gp_coord) pixmap->h)
+		return;
+
+	y0 = GP_MAX(y0, 0);
+	y1 = GP_MIN(y1, (gp_coord) pixmap->h - 1);
+
+	gp_vline_raw_2BPP_UB(pixmap, x, y0, y1, pixel);
+}
+void gp_vline_raw_4BPP_DB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	int y;
+
+	for (y = y0; y <= y1; y++)
+		gp_putpixel_raw_4BPP_DB(pixmap, x, y, pixel);
+}
+
+void gp_vline_raw_4BPP_DB_clip(gp_pixmap *pixmap, gp_coord x,
+                                       gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	if (x < 0 || x >= (gp_coord) pixmap->w ||
+	    y1 < 0 || y0 >= (gp_coord) pixmap->h)
+		return;
+
+	y0 = GP_MAX(y0, 0);
+	y1 = GP_MIN(y1, (gp_coord) pixmap->h - 1);
+
+	gp_vline_raw_4BPP_DB(pixmap, x, y0, y1, pixel);
+}
+void gp_vline_raw_4BPP_UB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	int y;
+
+	for (y = y0; y <= y1; y++)
+		gp_putpixel_raw_4BPP_UB(pixmap, x, y, pixel);
+}
+
+void gp_vline_raw_4BPP_UB_clip(gp_pixmap *pixmap, gp_coord x,
+                                       gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	if (x < 0 || x >= (gp_coord) pixmap->w ||
+	    y1 < 0 || y0 >= (gp_coord) pixmap->h)
+		return;
+
+	y0 = GP_MAX(y0, 0);
+	y1 = GP_MIN(y1, (gp_coord) pixmap->h - 1);
+
+	gp_vline_raw_4BPP_UB(pixmap, x, y0, y1, pixel);
+}
+void gp_vline_raw_8BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	int y;
+
+	for (y = y0; y <= y1; y++)
+		gp_putpixel_raw_8BPP(pixmap, x, y, pixel);
+}
+
+void gp_vline_raw_8BPP_clip(gp_pixmap *pixmap, gp_coord x,
+                                       gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	if (x < 0 || x >= (gp_coord) pixmap->w ||
+	    y1 < 0 || y0 >= (gp_coord) pixmap->h)
+		return;
+
+	y0 = GP_MAX(y0, 0);
+	y1 = GP_MIN(y1, (gp_coord) pixmap->h - 1);
+
+	gp_vline_raw_8BPP(pixmap, x, y0, y1, pixel);
+}
+void gp_vline_raw_16BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	int y;
+
+	for (y = y0; y <= y1; y++)
+		gp_putpixel_raw_16BPP(pixmap, x, y, pixel);
+}
+
+void gp_vline_raw_16BPP_clip(gp_pixmap *pixmap, gp_coord x,
+                                       gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	if (x < 0 || x >= (gp_coord) pixmap->w ||
+	    y1 < 0 || y0 >= (gp_coord) pixmap->h)
+		return;
+
+	y0 = GP_MAX(y0, 0);
+	y1 = GP_MIN(y1, (gp_coord) pixmap->h - 1);
+
+	gp_vline_raw_16BPP(pixmap, x, y0, y1, pixel);
+}
+void gp_vline_raw_24BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	int y;
+
+	for (y = y0; y <= y1; y++)
+		gp_putpixel_raw_24BPP(pixmap, x, y, pixel);
+}
+
+void gp_vline_raw_24BPP_clip(gp_pixmap *pixmap, gp_coord x,
+                                       gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	if (x < 0 || x >= (gp_coord) pixmap->w ||
+	    y1 < 0 || y0 >= (gp_coord) pixmap->h)
+		return;
+
+	y0 = GP_MAX(y0, 0);
+	y1 = GP_MIN(y1, (gp_coord) pixmap->h - 1);
+
+	gp_vline_raw_24BPP(pixmap, x, y0, y1, pixel);
+}
+void gp_vline_raw_32BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	int y;
+
+	for (y = y0; y <= y1; y++)
+		gp_putpixel_raw_32BPP(pixmap, x, y, pixel);
+}
+
+void gp_vline_raw_32BPP_clip(gp_pixmap *pixmap, gp_coord x,
+                                       gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	if (x < 0 || x >= (gp_coord) pixmap->w ||
+	    y1 < 0 || y0 >= (gp_coord) pixmap->h)
+		return;
+
+	y0 = GP_MAX(y0, 0);
+	y1 = GP_MIN(y1, (gp_coord) pixmap->h - 1);
+
+	gp_vline_raw_32BPP(pixmap, x, y0, y1, pixel);
+}
+void gp_vline_raw_18BPP_DB(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	int y;
+
+	for (y = y0; y <= y1; y++)
+		gp_putpixel_raw_18BPP_DB(pixmap, x, y, pixel);
+}
+
+void gp_vline_raw_18BPP_DB_clip(gp_pixmap *pixmap, gp_coord x,
+                                       gp_coord y0, gp_coord y1, gp_pixel pixel)
+{
+	if (x < 0 || x >= (gp_coord) pixmap->w ||
+	    y1 < 0 || y0 >= (gp_coord) pixmap->h)
+		return;
+
+	y0 = GP_MAX(y0, 0);
+	y1 = GP_MIN(y1, (gp_coord) pixmap->h - 1);
+
+	gp_vline_raw_18BPP_DB(pixmap, x, y0, y1, pixel);
+}
@@ -14,6 +14,7 @@
 
 #include <core/gp_debug.h>
 #include <core/gp_pixmap.h>
+#include <core/gp_yuv.h>
 #include <grabbers/gp_grabber.h>
 
 #include "../../config.h"
@@ -39,6 +40,11 @@ struct v4l2_priv {
 	void *bufptr[4];
 	size_t buf_len[4];
 
+	/* negotiated buffer format */
+	enum gp_yuv_fmt fmt;
+	enum gp_yuv_flags flags;
+	size_t stride;
+
 	char device[];
 };
 
@@ -63,56 +69,6 @@ static void v4l2_exit(gp_grabber *self)
 	free(self);
 }
 
-#define CLAMP(x, max)    \
-	if (x > max)     \
-		x = max; \
-	if (x < 0)       \
-		x = 0;   \
-
-#define MUL 1024
-
-static void v4l2_yuv422_fillframe(gp_grabber *self, void *buf)
-{
-	unsigned int i, j;
-	unsigned char *py, *pu, *pv;
-	unsigned char *tmp = self->frame->pixels;
-
-	py = buf;
-	pu = buf + 1;
-	pv = buf + 3;
-
-	for (i = 0; i < self->frame->h; i++) {
-		for (j = 0; j < self->frame->w; j++) {
-			int32_t PU = ((int32_t)*pu) - 128;
-			int32_t PV = ((int32_t)*pv) - 128;
-
-			int32_t R = MUL * (*py) + ((int32_t)(MUL * 1.772)) * PU;
-			int32_t G = MUL * (*py) - ((int32_t)(MUL * 0.344)) * PU
-			            - ((int32_t)(MUL * 0.714)) * PV;
-			int32_t B = MUL * (*py) + ((int32_t)(MUL * 1.402)) * PV;
-
-			R = (R + MUL/2)/MUL;
-			G = (G + MUL/2)/MUL;
-			B = (B + MUL/2)/MUL;
-
-			CLAMP(R, 255);
-			CLAMP(G, 255);
-			CLAMP(B, 255);
-
-			*tmp++ = R;
-			*tmp++ = G;
-			*tmp++ = B;
-
-			py += 2;
-
-			if ((j & 1) == 1) {
-				pu += 4;
-				pv += 4;
-			}
-		}
-	}
-}
-
 static int v4l2_poll(gp_grabber *self)
 {
 	struct v4l2_priv *priv = GP_GRABBER_PRIV(self);
@@ -149,7 +105,8 @@ static int v4l2_poll(gp_grabber *self)
 		return 0;
 	}
 
-	v4l2_yuv422_fillframe(self, priv->bufptr[buf.index]);
+	gp_yuv_convert(priv->bufptr[buf.index], priv->stride,
+	               priv->fmt, priv->flags, self->frame);
 
 	if (ioctl(self->fd, VIDIOC_QBUF, &buf)) {
 		GP_WARN("Failed to ioctl VIDIOC_QBUF on '%s' : %s",
@@ -226,6 +183,80 @@ static char *pixelformat_name(uint32_t ptype, char buf[])
 	return buf;
 }
 
+/*
+ * Supported formats in the order of preference, 4:2:0 formats need half of the
+ * bandwidth of the packed 4:2:2 ones.
+ */
+static const struct v4l2_yuv_fmt {
+	uint32_t pixelformat;
+	enum gp_yuv_fmt fmt;
+} yuv_fmts[] = {
+	{V4L2_PIX_FMT_NV12, GP_YUV_NV12},
+	{V4L2_PIX_FMT_YUV420, GP_YUV_I420},
+	{V4L2_PIX_FMT_YUYV, GP_YUV_YUYV},
+	{V4L2_PIX_FMT_UYVY, GP_YUV_UYVY},
+};
+
+static const struct v4l2_yuv_fmt *lookup_fmt(uint32_t pixelformat)
+{
+	unsigned int i;
+
+	for (i = 0; i < GP_ARRAY_SIZE(yuv_fmts); i++) {
+		if (yuv_fmts[i].pixelformat == pixelformat)
+			return &yuv_fmts[i];
+	}
+
+	return NULL;
+}
+
+static const struct v4l2_yuv_fmt *pick_fmt(int fd, const char *device)
+{
+	const struct v4l2_yuv_fmt *ret = NULL, *yuv_fmt;
+	struct v4l2_fmtdesc desc;
+	char pfmt[5];
+
+	memset(&desc, 0, sizeof(desc));
+	desc.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+
+	for (desc.index = 0; !ioctl(fd, VIDIOC_ENUM_FMT, &desc); desc.index++) {
+		yuv_fmt = lookup_fmt(desc.pixelformat);
+
+		GP_DEBUG(2, "Device '%s' offers %s%s", device,
+		         pixelformat_name(desc.pixelformat, pfmt),
+		         yuv_fmt ? "" : " (unsupported)");
+
+		if (yuv_fmt && (!ret || yuv_fmt < ret))
+			ret = yuv_fmt;
+	}
+
+	/* Drivers that do not enumerate formats are likely to do YUYV */
+	if (!ret)
+		ret = lookup_fmt(V4L2_PIX_FMT_YUYV);
+
+	return ret;
+}
+
+static enum gp_yuv_flags fmt_flags(struct v4l2_pix_format *pix)
+{
+	enum gp_yuv_flags flags = GP_YUV_BT601;
+	uint32_t enc = pix->ycbcr_enc;
+	uint32_t quant = pix->quantization;
+
+	if (enc == V4L2_YCBCR_ENC_DEFAULT)
+		enc = V4L2_MAP_YCBCR_ENC_DEFAULT(pix->colorspace);
+
+	if (quant == V4L2_QUANTIZATION_DEFAULT)
+		quant = V4L2_MAP_QUANTIZATION_DEFAULT(0, pix->colorspace, enc);
+
+	if (enc == V4L2_YCBCR_ENC_709)
+		flags |= GP_YUV_BT709;
+
+	if (quant == V4L2_QUANTIZATION_FULL_RANGE)
+		flags |= GP_YUV_FULL_RANGE;
+
+	return flags;
+}
+
 gp_grabber *gp_grabber_v4l2_init(const char *device,
                                  unsigned int preferred_width,
 				 unsigned int preferred_height)
@@ -299,6 +330,7 @@ gp_grabber *gp_grabber_v4l2_init(const char *device,
 		goto err0;
 	}
 
+	const struct v4l2_yuv_fmt *yuv_fmt = pick_fmt(fd, device);
 	struct v4l2_format fmt;
 
 	memset(&fmt, 0, sizeof(fmt));
@@ -306,7 +338,7 @@ gp_grabber *gp_grabber_v4l2_init(const char *device,
 	fmt.type                = V4L2_BUF_TYPE_VIDEO_CAPTURE;
 	fmt.fmt.pix.width       = preferred_width;
 	fmt.fmt.pix.height      = preferred_height;
-	fmt.fmt.pix.pixelformat = V4L2_PIX_FMT_YUYV;
+	fmt.fmt.pix.pixelformat = yuv_fmt->pixelformat;
 	fmt.fmt.pix.field       = V4L2_FIELD_INTERLACED;
 
 	if (ioctl(fd, VIDIOC_S_FMT, &fmt)) {
@@ -315,10 +347,12 @@ gp_grabber *gp_grabber_v4l2_init(const char *device,
 		goto err0;
 	}
 
-	if (fmt.fmt.pix.pixelformat != V4L2_PIX_FMT_YUYV) {
+	yuv_fmt = lookup_fmt(fmt.fmt.pix.pixelformat);
+
+	if (!yuv_fmt) {
 		char pfmt[5];
 
-		GP_WARN("Failed to set format to YUYV got %s",
+		GP_WARN("Failed to set YUV format got %s",
 		        pixelformat_name(fmt.fmt.pix.pixelformat, pfmt));
 
 		err = ENOSYS;
@@ -345,6 +379,15 @@ gp_grabber *gp_grabber_v4l2_init(const char *device,
 
 	strcpy(priv->device, device);
 	priv->mode = mode;
+	priv->fmt = yuv_fmt->fmt;
+	priv->flags = fmt_flags(&fmt.fmt.pix);
+	priv->stride = fmt.fmt.pix.bytesperline;
+
+	GP_DEBUG(1, "Device '%s' format %s %ux%u stride %zu%s%s", device,
+	         gp_yuv_fmt_name(priv->fmt), fmt.fmt.pix.width,
+	         fmt.fmt.pix.height, priv->stride,
+	         priv->flags & GP_YUV_BT709 ? " BT.709" : " BT.601",
+	         priv->flags & GP_YUV_FULL_RANGE ? " full range" : "");
 
 	switch (mode) {
 	case 1:
@@ -392,6 +435,13 @@ gp_grabber *gp_grabber_v4l2_init(const char *device,
 				goto err2;
 			}
 
+			if (buf.length < gp_yuv_buf_size(priv->fmt, fmt.fmt.pix.width,
+			                                 fmt.fmt.pix.height, priv->stride)) {
+				err = EINVAL;
+				GP_WARN("Buffer too small on '%s'", device);
+				goto err3;
+			}
+
 			priv->bufptr[i] = mmap(NULL, buf.length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, buf.m.offset);
 			priv->buf_len[i] = buf.length;	
 
@@ -26,10 +26,20 @@ void gp_ev_queue_init(gp_ev_queue *self,
 
 	self->keymap = NULL;
 
+	if (queue_size > GP_EVENT_QUEUE_SIZE) {
+		GP_WARN("Queue size %u too big, using %u",
+		        queue_size, GP_EVENT_QUEUE_SIZE);
+		queue_size = GP_EVENT_QUEUE_SIZE;
+	}
+
 	self->queue_first = 0;
 	self->queue_last = 0;
 	self->queue_size = queue_size ? queue_size : GP_EVENT_QUEUE_SIZE;
 
+	self->dropped = 0;
+	self->coalesced = 0;
+	self->coalesce_motion = !!(flags & GP_EVENT_QUEUE_COALESCE_MOTION);
+
 	if (flags & GP_EVENT_QUEUE_LOAD_KEYMAP)
 		self->keymap = gp_keymap_load(NULL);
 }
@@ -157,6 +167,56 @@ gp_event *gp_ev_queue_peek(gp_ev_queue *self)
 	return &(self->events[self->queue_first]);
 }
 
+/*
+ * Merges a motion event into the last queued event if both are of the same
+ * kind. The event before queue_first is never touched since that may have been
+ * returned by gp_event_get() previously.
+ */
+static int event_coalesce(gp_ev_queue *self, gp_event *ev)
+{
+	gp_event *last;
+
+	if (self->queue_first == self->queue_last)
+		return 0;
+
+	last = &self->events[(self->queue_last + self->queue_size - 1) % self->queue_size];
+
+	if (last->type != ev->type || last->code != ev->code)
+		return 0;
+
+	switch (ev->type) {
+	case GP_EV_REL:
+		switch (ev->code) {
+		case GP_EV_REL_POS:
+			last->rel.rx += ev->rel.rx;
+			last->rel.ry += ev->rel.ry;
+		break;
+		case GP_EV_REL_WHEEL:
+			last->val += ev->val;
+		break;
+		default:
+			return 0;
+		}
+	break;
+	case GP_EV_ABS:
+		if (ev->code != GP_EV_ABS_POS ||
+		    last->abs.x_max != ev->abs.x_max ||
+		    last->abs.y_max != ev->abs.y_max ||
+		    last->abs.pressure_max != ev->abs.pressure_max)
+			return 0;
+
+		last->abs = ev->abs;
+	break;
+	default:
+		return 0;
+	}
+
+	last->time = ev->time;
+	self->coalesced++;
+
+	return 1;
+}
+
 /*
  * We avoid overriding an position before the queue_first since that may have
  * been returned by gp_event_get() previously.
@@ -165,8 +225,16 @@ static void event_put(gp_ev_queue *self, gp_event *ev)
 {
 	unsigned int next = (self->queue_last + 1) % self->queue_size;
 
+	if (self->coalesce_motion && event_coalesce(self, ev))
+		return;
+
 	if (next == self->queue_first) {
+		/* Rather merge motion than lose it */
+		if (event_coalesce(self, ev))
+			return;
+
 		GP_WARN("Event queue full, dropping event.");
+		self->dropped++;
 		return;
 	}
 
@@ -185,6 +253,7 @@ static void event_put_back(gp_ev_queue *self, gp_event *ev)
 
 	if (prev == self->queue_last) {
 		GP_WARN("Event queue full, dropping event.");
+		self->dropped++;
 		return;
 	}
 
@@ -105,7 +105,7 @@ void gp_task_queue_rem(gp_task_queue *self, gp_task *task)
 
 	GP_DEBUG(3, "Removing task '%s' prio %i", task->id, task->prio);
 
-	gp_dlist_rem(&self->queues[task->prio], &task->head);
+	gp_dlist_rem(queue, &task->head);
 
 	self->task_cnt--;
 	self->min_prio = find_queue_min_prio(self);
@@ -0,0 +1,302 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_pixmap.h>
+#include <core/gp_blit.h>
+#include <core/gp_convert.h>
+#include <core/gp_get_put_pixel.h>
+#include <loaders/gp_io.h>
+
+#include "gp_anim_priv.h"
+
+static const gp_anim_ops *const anims[] = {
+	&gp_apng_anim_ops,
+	&gp_gif_anim_ops,
+	NULL
+};
+
+gp_anim *gp_anim_alloc(const gp_anim_ops *ops, size_t priv_size,
+                       gp_size w, gp_size h)
+{
+	gp_anim *self = calloc(1, sizeof(*self) + priv_size);
+
+	if (!self) {
+		GP_WARN("Malloc failed :-(");
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	self->canvas = gp_pixmap_alloc(w, h, GP_PIXEL_RGBA8888);
+	if (!self->canvas) {
+		free(self);
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	gp_pixmap_srgb_set(self->canvas);
+	memset(self->canvas->pixels, 0, self->canvas->bytes_per_row * h);
+
+	self->ops = ops;
+
+	return self;
+}
+
+void gp_anim_free(gp_anim *self)
+{
+	gp_pixmap_free(self->saved);
+	gp_pixmap_free(self->canvas);
+	free(self);
+}
+
+static void clear_rect(gp_pixmap *canvas, gp_coord x, gp_coord y,
+                       gp_size w, gp_size h)
+{
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)h; i++)
+		memset(GP_PIXEL_ADDR(canvas, x, y + i), 0, 4 * w);
+}
+
+/*
+ * Non-premultiplied source over operator on RGBA8888 pixels.
+ */
+static gp_pixel blend_over(gp_pixel src, gp_pixel dst)
+{
+	unsigned int sa = src & 0xff, da = dst & 0xff;
+	unsigned int dw, a, i;
+	gp_pixel res;
+
+	if (sa == 0xff || !da)
+		return src;
+
+	if (!sa)
+		return dst;
+
+	/* Weight of the destination and resulting alpha, both times 255 */
+	dw = da * (255 - sa);
+	a = sa * 255 + dw;
+
+	res = (a + 127) / 255;
+
+	for (i = 8; i < 32; i += 8) {
+		unsigned int sc = (src >> i) & 0xff;
+		unsigned int dc = (dst >> i) & 0xff;
+
+		res |= (gp_pixel)((sc * sa * 255 + dc * dw + a/2) / a) << i;
+	}
+
+	return res;
+}
+
+static void blend(gp_pixmap *canvas, const gp_pixmap *src,
+                  gp_coord x, gp_coord y, gp_size w, gp_size h,
+                  enum gp_anim_blend blend)
+{
+	gp_coord i, j;
+
+	if (src->pixel_type == GP_PIXEL_RGBA8888 && blend == GP_ANIM_BLEND_SRC) {
+		for (j = 0; j < (gp_coord)h; j++) {
+			memcpy(GP_PIXEL_ADDR(canvas, x, y + j),
+			       GP_PIXEL_ADDR(src, 0, j), 4 * w);
+		}
+		return;
+	}
+
+	for (j = 0; j < (gp_coord)h; j++) {
+		for (i = 0; i < (gp_coord)w; i++) {
+			gp_pixel p = gp_getpixel_raw(src, i, j);
+
+			if (src->pixel_type != GP_PIXEL_RGBA8888)
+				p = gp_convert_pixel(p, src->pixel_type, GP_PIXEL_RGBA8888);
+
+			if (blend == GP_ANIM_BLEND_OVER)
+				p = blend_over(p, gp_getpixel_raw_32BPP(canvas, x + i, y + j));
+
+			gp_putpixel_raw_32BPP(canvas, x + i, y + j, p);
+		}
+	}
+}
+
+static void rect_union(gp_anim_frame *frame, gp_coord x, gp_coord y,
+                       gp_size w, gp_size h)
+{
+	gp_coord x1, y1;
+
+	if (!w || !h)
+		return;
+
+	if (!frame->w || !frame->h) {
+		frame->x = x;
+		frame->y = y;
+		frame->w = w;
+		frame->h = h;
+		return;
+	}
+
+	x1 = GP_MAX(frame->x + (gp_coord)frame->w, x + (gp_coord)w);
+	y1 = GP_MAX(frame->y + (gp_coord)frame->h, y + (gp_coord)h);
+
+	frame->x = GP_MIN(frame->x, x);
+	frame->y = GP_MIN(frame->y, y);
+	frame->w = x1 - frame->x;
+	frame->h = y1 - frame->y;
+}
+
+int gp_anim_compose(gp_anim *self, const gp_pixmap *src, gp_coord x, gp_coord y,
+                    enum gp_anim_blend blend_op, enum gp_anim_dispose dispose,
+                    gp_anim_frame *frame)
+{
+	gp_pixmap *canvas = self->canvas;
+	gp_size w = 0, h = 0;
+
+	if (x >= 0 && y >= 0 && x < (gp_coord)canvas->w && y < (gp_coord)canvas->h) {
+		w = GP_MIN(src->w, canvas->w - x);
+		h = GP_MIN(src->h, canvas->h - y);
+	}
+
+	frame->x = frame->y = 0;
+	frame->w = frame->h = 0;
+
+	/* Dispose the previous frame */
+	if (!self->cur_frame) {
+		rect_union(frame, 0, 0, canvas->w, canvas->h);
+	} else {
+		switch (self->dispose) {
+		case GP_ANIM_DISPOSE_NONE:
+		break;
+		case GP_ANIM_DISPOSE_BG:
+			clear_rect(canvas, self->dispose_x, self->dispose_y,
+			           self->dispose_w, self->dispose_h);
+			rect_union(frame, self->dispose_x, self->dispose_y,
+			           self->dispose_w, self->dispose_h);
+		break;
+		case GP_ANIM_DISPOSE_PREV:
+			if (!self->dispose_w || !self->dispose_h)
+				break;
+
+			gp_blit_xywh(self->saved, 0, 0, self->dispose_w, self->dispose_h,
+			             canvas, self->dispose_x, self->dispose_y);
+			rect_union(frame, self->dispose_x, self->dispose_y,
+			           self->dispose_w, self->dispose_h);
+		break;
+		}
+	}
+
+	if (dispose == GP_ANIM_DISPOSE_PREV && w && h) {
+		if (!self->saved || self->saved->w < w || self->saved->h < h) {
+			gp_pixmap_free(self->saved);
+			self->saved = gp_pixmap_alloc(w, h, GP_PIXEL_RGBA8888);
+			if (!self->saved) {
+				errno = ENOMEM;
+				return 1;
+			}
+		}
+
+		gp_blit_xywh(canvas, x, y, w, h, self->saved, 0, 0);
+	}
+
+	if (w && h) {
+		blend(canvas, src, x, y, w, h, blend_op);
+		rect_union(frame, x, y, w, h);
+	}
+
+	self->dispose = dispose;
+	self->dispose_x = x;
+	self->dispose_y = y;
+	self->dispose_w = w;
+	self->dispose_h = h;
+
+	GP_DEBUG(3, "Frame %u changed %ix%i-%ux%u", self->cur_frame,
+	         frame->x, frame->y, frame->w, frame->h);
+
+	return 0;
+}
+
+gp_anim *gp_anim_init(gp_io *io)
+{
+	char buf[32];
+	unsigned int i;
+
+	gp_io_mark(io, GP_IO_MARK);
+
+	if (gp_io_fill(io, buf, sizeof(buf))) {
+		GP_DEBUG(1, "Failed to read first 32 bytes: %s", strerror(errno));
+		return NULL;
+	}
+
+	gp_io_mark(io, GP_IO_REWIND);
+
+	for (i = 0; anims[i]; i++) {
+		if (anims[i]->match && anims[i]->match(buf) == 1) {
+			GP_DEBUG(1, "Found animation '%s'", anims[i]->fmt_name);
+			return anims[i]->init(io);
+		}
+	}
+
+	GP_DEBUG(1, "Animation format not found");
+	errno = ENOSYS;
+	return NULL;
+}
+
+gp_anim *gp_anim_open(const char *path)
+{
+	gp_anim *ret;
+	gp_io *io;
+	int err;
+
+	io = gp_io_mmap(path);
+	if (!io)
+		io = gp_io_file(path, GP_IO_RDONLY);
+
+	if (!io)
+		return NULL;
+
+	ret = gp_anim_init(io);
+	if (!ret) {
+		err = errno;
+		gp_io_close(io);
+		errno = err;
+	}
+
+	return ret;
+}
+
+int gp_anim_next(gp_anim *self, gp_anim_frame *frame, gp_progress_cb *callback)
+{
+	if (self->ops->next(self, frame, callback))
+		return 1;
+
+	self->cur_frame++;
+
+	return 0;
+}
+
+int gp_anim_rewind(gp_anim *self)
+{
+	gp_pixmap *canvas = self->canvas;
+
+	if (self->ops->rewind(self))
+		return 1;
+
+	memset(canvas->pixels, 0, canvas->bytes_per_row * canvas->h);
+
+	self->cur_frame = 0;
+	self->dispose = GP_ANIM_DISPOSE_NONE;
+
+	return 0;
+}
+
+void gp_anim_close(gp_anim *self)
+{
+	if (!self)
+		return;
+
+	self->ops->close(self);
+}
@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+ * Helpers for animation readers implementations.
+ */
+
+#ifndef GP_ANIM_PRIV_H
+#define GP_ANIM_PRIV_H
+
+#include <loaders/gp_anim.h>
+
+/*
+ * Allocates the reader with priv_size bytes of private data and a w x h
+ * transparent canvas.
+ */
+gp_anim *gp_anim_alloc(const gp_anim_ops *ops, size_t priv_size,
+                       gp_size w, gp_size h) __attribute__((visibility ("hidden")));
+
+/*
+ * Frees the canvas and the reader, to be called from the ops close().
+ */
+void gp_anim_free(gp_anim *self) __attribute__((visibility ("hidden")));
+
+/*
+ * Disposes the previous frame, composites the frame onto the canvas at x, y
+ * and fills in the changed rectangle. The frame is clipped to the canvas.
+ */
+int gp_anim_compose(gp_anim *self, const gp_pixmap *src, gp_coord x, gp_coord y,
+                    enum gp_anim_blend blend, enum gp_anim_dispose dispose,
+                    gp_anim_frame *frame) __attribute__((visibility ("hidden")));
+
+extern const gp_anim_ops gp_apng_anim_ops __attribute__((visibility ("hidden")));
+extern const gp_anim_ops gp_gif_anim_ops __attribute__((visibility ("hidden")));
+
+#endif /* GP_ANIM_PRIV_H */
@@ -451,7 +451,7 @@ static uint32_t bitmap_row_size(struct gp_bmp_info_header *header)
 }
 
 static uint8_t get_idx(struct gp_bmp_info_header *header,
-                       uint8_t row[], int32_t x)
+                       const uint8_t row[], int32_t x)
 {
 	switch (header->bpp) {
 	case 1:
@@ -488,16 +488,31 @@ static int read_palette(gp_io *io, struct gp_bmp_info_header *header,
 	if ((err = seek_pixels_offset(io, header)))
 		goto err;
 
-	uint8_t *row = gp_temp_alloc_arr(tmp, uint8_t, row_size);
+	uint8_t *rbuf = gp_temp_alloc_arr(tmp, uint8_t, row_size);
+	off_t off = io->map ? gp_io_tell(io) : 0;
 
 	for (y = 0; y < GP_ABS(header->h); y++) {
+		const uint8_t *row = NULL;
 		int32_t x;
 
-		if (gp_io_fill(io, row, row_size)) {
+		/* Use the data in place if the I/O is backed by memory */
+		if (io->map) {
+			row = gp_io_map(io, off, row_size);
+			off += row_size;
+		}
+
+		if (row) {
+			if (gp_io_skip(io, row_size)) {
+				err = errno;
+				goto err;
+			}
+		} else if (gp_io_fill(io, rbuf, row_size)) {
 			err = errno;
 			GP_DEBUG(1, "Failed to read row %"PRId32": %s",
 			         y, strerror(errno));
 			goto err;
+		} else {
+			row = rbuf;
 		}
 
 		for (x = 0; x < header->w; x++) {
@@ -6,10 +6,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <inttypes.h>
 
 #include "core/gp_common.h"
 #include <core/gp_debug.h>
 #include <loaders/gp_exif.h>
+#include <loaders/gp_loaders.h>
 
 enum IFD_formats {
 	/* 1 bytes/components */
@@ -400,10 +402,9 @@ static int load_IFD(gp_io *io, gp_storage *storage, gp_data_node *node,
 	return 0;
 }
 
-int gp_read_exif(gp_io *io, gp_storage *storage, gp_correction_desc *correction)
+static int read_tiff_header(gp_io *io, char *endian, uint32_t *IFD_offset)
 {
 	char b1, b2;
-	uint32_t IFD_offset;
 
 	uint16_t exif_header[] = {
 		'E', 'x', 'i', 'f', 0, 0, /* EXIF signature */
@@ -411,7 +412,7 @@ int gp_read_exif(gp_io *io, gp_storage *storage, gp_correction_desc *correction)
 		GP_IO_END,
 	};
 
-	if (gp_io_readf(io, exif_header, &b1, &b2, &IFD_offset) != 8) {
+	if (gp_io_readf(io, exif_header, &b1, &b2) != 8) {
 		GP_WARN("Failed to read Exif header");
 		return 1;
 	}
@@ -438,21 +439,123 @@ int gp_read_exif(gp_io *io, gp_storage *storage, gp_correction_desc *correction)
 
 	uint16_t *tiff_header = b1 == 'I' ? tiff_header_LE : tiff_header_BE;
 
-	if (gp_io_readf(io, tiff_header,  &IFD_offset) != 3) {
+	if (gp_io_readf(io, tiff_header, IFD_offset) != 3) {
 		GP_DEBUG(1, "Failed to read TIFF header");
 		return 1;
 	}
 
-	GP_DEBUG(2, "IFD offset is 0x%08x", IFD_offset);
+	GP_DEBUG(2, "IFD offset is 0x%08x", *IFD_offset);
 
-	if (IFD_offset < 8) {
+	if (*IFD_offset < 8) {
 		GP_WARN("Invalid (negative) IFD offset");
 		errno = EINVAL;
 		return 1;
 	}
 
+	*endian = b1;
+
+	return 0;
+}
+
+int gp_read_exif(gp_io *io, gp_storage *storage, gp_correction_desc *correction)
+{
+	uint32_t IFD_offset;
+	char endian;
+
+	if (read_tiff_header(io, &endian, &IFD_offset))
+		return 1;
+
 	gp_data_node *exif_root = gp_storage_add_dict(storage, NULL, "Exif");
 
 	/* The offset starts from the II or MM */
-	return load_IFD(io, storage, exif_root, correction, &IFD_EXIF_tags, IFD_offset, b1);
+	return load_IFD(io, storage, exif_root, correction, &IFD_EXIF_tags, IFD_offset, endian);
+}
+
+int gp_read_exif_thumbnail(gp_io *io, gp_pixmap **img, gp_progress_cb *callback)
+{
+	uint32_t IFD_offset, thumb_off = 0, thumb_size = 0;
+	uint16_t i, IFD_entries_count;
+	gp_io *sub_io;
+	char endian;
+	int err;
+
+	if (read_tiff_header(io, &endian, &IFD_offset))
+		return 1;
+
+	uint16_t i2[] = {endian == 'I' ? GP_IO_L2 : GP_IO_B2, GP_IO_END};
+	uint16_t i4[] = {endian == 'I' ? GP_IO_L4 : GP_IO_B4, GP_IO_END};
+
+	uint16_t IFD_record[] = {
+		i2[0],    /* Tag                  */
+		GP_IO_I2, /* Format               */
+		GP_IO_I4, /* Number of components */
+		i4[0],    /* Value                */
+		GP_IO_END,
+	};
+
+	/* Skip IFD0 and read the IFD1 offset */
+	if (gp_io_seek(io, IFD_offset + 6, GP_SEEK_SET) == (off_t)-1 ||
+	    gp_io_readf(io, i2, &IFD_entries_count) != 1 ||
+	    gp_io_seek(io, 12 * IFD_entries_count, GP_SEEK_CUR) == (off_t)-1 ||
+	    gp_io_readf(io, i4, &IFD_offset) != 1) {
+		GP_DEBUG(1, "Failed to read IFD0");
+		return 1;
+	}
+
+	if (!IFD_offset) {
+		GP_DEBUG(1, "No IFD1 present");
+		errno = ENOENT;
+		return 1;
+	}
+
+	GP_DEBUG(2, "-- IFD1 Offset 0x%08x --", IFD_offset);
+
+	if (gp_io_seek(io, IFD_offset + 6, GP_SEEK_SET) == (off_t)-1 ||
+	    gp_io_readf(io, i2, &IFD_entries_count) != 1) {
+		GP_DEBUG(1, "Failed to read IFD1");
+		return 1;
+	}
+
+	for (i = 0; i < IFD_entries_count; i++) {
+		uint16_t tag;
+		uint32_t val;
+
+		if (gp_io_readf(io, IFD_record, &tag, &val) != 4) {
+			GP_DEBUG(1, "Failed to read IFD1 record");
+			return 1;
+		}
+
+		switch (tag) {
+		case IFD_JPEG_INTERCHANGE_FORMAT:
+			thumb_off = val;
+		break;
+		case IFD_JPEG_INTERCHANGE_FORMAT_LENGTH:
+			thumb_size = val;
+		break;
+		}
+	}
+
+	if (!thumb_off || !thumb_size) {
+		GP_DEBUG(1, "No JPEG thumbnail in IFD1");
+		errno = ENOENT;
+		return 1;
+	}
+
+	GP_DEBUG(1, "JPEG thumbnail at 0x%08x size %"PRIu32, thumb_off, thumb_size);
+
+	if (gp_io_seek(io, thumb_off + 6, GP_SEEK_SET) == (off_t)-1) {
+		GP_DEBUG(1, "Failed to seek to thumbnail");
+		return 1;
+	}
+
+	sub_io = gp_io_sub_io(io, thumb_size);
+	if (!sub_io)
+		return 1;
+
+	*img = gp_read_jpg(sub_io, callback);
+	err = errno;
+	gp_io_close(sub_io);
+	errno = err;
+
+	return *img == NULL;
 }
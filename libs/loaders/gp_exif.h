@@ -46,6 +46,9 @@ enum IFD_EXIF_tags {
 	IFD_WHITE_POINT = 0x013e,
 	/* Primary Chromaticies */
 	IFD_PRIMARY_CHROMATICIES = 0x013f,
+	/* Offset and size of JPEG thumbnail, stored in IFD1 */
+	IFD_JPEG_INTERCHANGE_FORMAT = 0x0201,
+	IFD_JPEG_INTERCHANGE_FORMAT_LENGTH = 0x0202,
 	/* YCbCr Coefficients */
 	IFD_Y_CB_CR_COEFFICIENTS = 0x0211,
 	/* YCbCr Positioning */
@@ -24,6 +24,8 @@
 #include <loaders/gp_io.h>
 #include <loaders/gp_loaders.gen.h>
 
+#include "gp_anim_priv.h"
+
 #ifdef HAVE_GIFLIB
 
 #include <gif_lib.h>
@@ -377,6 +379,302 @@ err1:
 	return 1;
 }
 
+/*
+ * GIF animation, frame timing and disposal are stored in the Graphics Control
+ * Extension that precedes the image and the loop count in the NETSCAPE2.0
+ * application extension.
+ */
+
+#define GIF_DISPOSE_BG 2
+#define GIF_DISPOSE_PREV 3
+
+struct gif_anim {
+	gp_io *io;
+	GifFileType *gf;
+	off_t start;
+
+	/* Graphics Control Extension for the next frame */
+	uint32_t delay_ms;
+	int transparent;
+	enum gp_anim_dispose dispose;
+};
+
+static GifFileType *gif_open(gp_io *io)
+{
+	GifFileType *gf;
+
+	errno = 0;
+#if defined(GIFLIB_MAJOR) && GIFLIB_MAJOR >= 5
+	gf = DGifOpen(io, gif_input_func, NULL);
+#else
+	gf = DGifOpen(io, gif_input_func);
+#endif
+	if (!gf && !errno)
+		errno = EIO;
+
+	return gf;
+}
+
+static void gif_close(GifFileType *gf)
+{
+#if defined(GIFLIB_MAJOR) && GIFLIB_MAJOR >= 5 && GIFLIB_MINOR >= 1
+	DGifCloseFile(gf, NULL);
+#else
+	DGifCloseFile(gf);
+#endif
+}
+
+static void gif_anim_gce(struct gif_anim *gif, const uint8_t *ext)
+{
+	if (ext[0] < 4)
+		return;
+
+	switch ((ext[1]>>2) & 0x07) {
+	case GIF_DISPOSE_BG:
+		gif->dispose = GP_ANIM_DISPOSE_BG;
+	break;
+	case GIF_DISPOSE_PREV:
+		gif->dispose = GP_ANIM_DISPOSE_PREV;
+	break;
+	default:
+		gif->dispose = GP_ANIM_DISPOSE_NONE;
+	}
+
+	gif->delay_ms = 10 * (ext[2] | (ext[3]<<8));
+	gif->transparent = (ext[1] & 0x01) ? ext[4] : -1;
+
+	GP_DEBUG(3, "GCE delay %"PRIu32"ms transparent %i dispose %i",
+	         gif->delay_ms, gif->transparent, gif->dispose);
+}
+
+static int gif_anim_ext(gp_anim *self, struct gif_anim *gif)
+{
+	GifFileType *gf = gif->gf;
+	uint8_t *ext;
+	int ext_type, netscape = 0;
+
+	if (DGifGetExtension(gf, &ext_type, &ext) != GIF_OK)
+		goto err;
+
+	switch (ext_type) {
+	case GRAPHICS_EXT_FUNC_CODE:
+		if (ext)
+			gif_anim_gce(gif, ext);
+	break;
+	case APPLICATION_EXT_FUNC_CODE:
+		netscape = ext && ext[0] == 11 && !memcmp(ext + 1, "NETSCAPE2.0", 11);
+	break;
+	}
+
+	while (ext) {
+		if (DGifGetExtensionNext(gf, &ext) != GIF_OK)
+			goto err;
+
+		if (netscape && ext && ext[0] >= 3 && ext[1] == 1) {
+			self->loop_cnt = ext[2] | (ext[3]<<8);
+			GP_DEBUG(2, "GIF loop count %u", self->loop_cnt);
+		}
+	}
+
+	return 0;
+err:
+	GP_DEBUG(1, "DGifGetExtension() error %s (%i)",
+	         gif_err_name(gif_err(gf)), gif_err(gf));
+	return EIO;
+}
+
+static int gif_anim_frame(struct gif_anim *gif, gp_pixmap **img,
+                          gp_progress_cb *callback)
+{
+	GifFileType *gf = gif->gf;
+	gp_pixmap *res;
+	uint32_t x, y;
+
+	if (DGifGetImageDesc(gf) != GIF_OK) {
+		GP_DEBUG(1, "DGifGetImageDesc() error %s (%i)",
+		         gif_err_name(gif_err(gf)), gif_err(gf));
+		return EIO;
+	}
+
+	GP_DEBUG(2, "Have GIF frame %ix%i-%ix%i interlace %i",
+	         gf->Image.Left, gf->Image.Top, gf->Image.Width,
+	         gf->Image.Height, gf->Image.Interlace);
+
+	res = gp_pixmap_alloc(gf->Image.Width, gf->Image.Height, GP_PIXEL_RGBA8888);
+	if (!res)
+		return ENOMEM;
+
+	for (y = 0; y < res->h; y++) {
+		uint8_t line[res->w];
+		uint32_t real_y = y;
+
+		if (DGifGetLine(gf, line, res->w) != GIF_OK) {
+			GP_DEBUG(1, "DGifGetLine() error %s (%i)",
+			         gif_err_name(gif_err(gf)), gif_err(gf));
+			gp_pixmap_free(res);
+			return EIO;
+		}
+
+		if (gf->Image.Interlace)
+			real_y = interlace_real_y(gf, y);
+
+		for (x = 0; x < res->w; x++) {
+			gp_pixel p = 0;
+
+			if (line[x] != gif->transparent)
+				p = (get_color(gf, line[x])<<8) | 0xff;
+
+			gp_putpixel_raw_32BPP(res, x, real_y, p);
+		}
+
+		if (gp_progress_cb_report(callback, y, res->h, res->w)) {
+			GP_DEBUG(1, "Operation aborted");
+			gp_pixmap_free(res);
+			return ECANCELED;
+		}
+	}
+
+	*img = res;
+	return 0;
+}
+
+static int gif_anim_next(gp_anim *self, gp_anim_frame *frame,
+                         gp_progress_cb *callback)
+{
+	struct gif_anim *gif = GP_ANIM_PRIV(self);
+	GifRecordType rec_type;
+	gp_pixmap *img = NULL;
+	int err;
+
+	/* Failed rewind */
+	if (!gif->gf) {
+		errno = EIO;
+		return 1;
+	}
+
+	for (;;) {
+		if (DGifGetRecordType(gif->gf, &rec_type) != GIF_OK) {
+			GP_DEBUG(1, "DGifGetRecordType() error %s (%i)",
+			         gif_err_name(gif_err(gif->gf)), gif_err(gif->gf));
+			errno = EIO;
+			return 1;
+		}
+
+		switch (rec_type) {
+		case EXTENSION_RECORD_TYPE:
+			err = gif_anim_ext(self, gif);
+		break;
+		case IMAGE_DESC_RECORD_TYPE:
+			err = gif_anim_frame(gif, &img, callback);
+		break;
+		case TERMINATE_RECORD_TYPE:
+			errno = ENOENT;
+			return 1;
+		default:
+			err = 0;
+		}
+
+		if (err) {
+			errno = err;
+			return 1;
+		}
+
+		if (img)
+			break;
+	}
+
+	frame->delay_ms = gif->delay_ms;
+
+	err = gp_anim_compose(self, img, gif->gf->Image.Left, gif->gf->Image.Top,
+	                      GP_ANIM_BLEND_OVER, gif->dispose, frame);
+	gp_pixmap_free(img);
+
+	/* Graphics Control Extension applies only to the next image */
+	gif->delay_ms = 0;
+	gif->transparent = -1;
+	gif->dispose = GP_ANIM_DISPOSE_NONE;
+
+	if (err)
+		return 1;
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int gif_anim_rewind(gp_anim *self)
+{
+	struct gif_anim *gif = GP_ANIM_PRIV(self);
+	GifFileType *gf = NULL;
+
+	if (gp_io_seek(gif->io, gif->start, GP_SEEK_SET) == gif->start)
+		gf = gif_open(gif->io);
+
+	/* The old handle is useless once we moved in the stream */
+	if (gif->gf)
+		gif_close(gif->gf);
+
+	gif->gf = gf;
+
+	if (!gf)
+		return 1;
+
+	gif->transparent = -1;
+
+	return 0;
+}
+
+static void gif_anim_close(gp_anim *self)
+{
+	struct gif_anim *gif = GP_ANIM_PRIV(self);
+
+	if (gif->gf)
+		gif_close(gif->gf);
+
+	gp_io_close(gif->io);
+	gp_anim_free(self);
+}
+
+static gp_anim *gif_anim_init(gp_io *io)
+{
+	struct gif_anim *gif;
+	GifFileType *gf;
+	gp_anim *self;
+	off_t start = gp_io_tell(io);
+
+	gf = gif_open(io);
+	if (!gf)
+		return NULL;
+
+	GP_DEBUG(1, "Have GIF animation %ix%i", gf->SWidth, gf->SHeight);
+
+	self = gp_anim_alloc(&gp_gif_anim_ops, sizeof(struct gif_anim),
+	                     gf->SWidth, gf->SHeight);
+	if (!self) {
+		gif_close(gf);
+		return NULL;
+	}
+
+	/* Played once unless there is NETSCAPE2.0 extension */
+	self->loop_cnt = 1;
+
+	gif = GP_ANIM_PRIV(self);
+	gif->io = io;
+	gif->gf = gf;
+	gif->start = start;
+	gif->transparent = -1;
+
+	return self;
+}
+
+const gp_anim_ops gp_gif_anim_ops = {
+	.next = gif_anim_next,
+	.rewind = gif_anim_rewind,
+	.close = gif_anim_close,
+	.match = gp_match_gif,
+	.init = gif_anim_init,
+	.fmt_name = "Graphics Interchange Format",
+};
+
 #else
 
 int gp_match_gif(const void GP_UNUSED(*buf))
@@ -392,6 +690,10 @@ int gp_read_gif_ex(gp_io GP_UNUSED(*io), gp_pixmap GP_UNUSED(**img),
 	return -1;
 }
 
+const gp_anim_ops gp_gif_anim_ops = {
+	.fmt_name = "Graphics Interchange Format",
+};
+
 #endif /* HAVE_GIFLIB */
 
 const gp_loader gp_gif = {
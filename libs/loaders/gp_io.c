@@ -11,6 +11,10 @@
 #include <fcntl.h>
 #include <stdarg.h>
 #include <inttypes.h>
+#include "../../config.h"
+#ifdef HAVE_MMAP
+# include <sys/mman.h>
+#endif
 
 #include <core/gp_byte_order.h>
 #include <core/gp_debug.h>
@@ -105,6 +109,8 @@ gp_io *gp_io_file(const char *path, enum gp_io_file_mode mode)
 	}
 
 	io->mark = 0;
+	io->rbuf_pos = NULL;
+	io->rbuf_end = NULL;
 
 	io->seek = file_seek;
 	io->read = file_read;
@@ -117,6 +123,7 @@ gp_io *gp_io_file(const char *path, enum gp_io_file_mode mode)
 		io->read = NULL;
 
 	io->close = file_close;
+	io->map = NULL;
 
 	return io;
 err1:
@@ -126,17 +133,19 @@ err0:
 	return NULL;
 }
 
+/*
+ * Memory backed I/O, the current position is kept in the io->rbuf_pos so
+ * that the inline helpers are always served from the buffer.
+ */
 struct mem_io {
 	uint8_t *buf;
 	size_t size;
-	size_t pos;
 	void (*free)(void *);
 };
 
 static ssize_t mem_read(gp_io *io, void *buf, size_t size)
 {
-	struct mem_io *mem_io = GP_IO_PRIV(io);
-	size_t rest = mem_io->size - mem_io->pos;
+	size_t rest = io->rbuf_end - io->rbuf_pos;
 	ssize_t ret = GP_MIN(rest, size);
 
 	if (ret <= 0) {
@@ -144,8 +153,8 @@ static ssize_t mem_read(gp_io *io, void *buf, size_t size)
 		return 0;
 	}
 
-	memcpy(buf, mem_io->buf + mem_io->pos, ret);
-	mem_io->pos += ret;
+	memcpy(buf, io->rbuf_pos, ret);
+	io->rbuf_pos += ret;
 
 	return ret;
 }
@@ -153,30 +162,31 @@ static ssize_t mem_read(gp_io *io, void *buf, size_t size)
 static off_t mem_seek(gp_io *io, off_t off, enum gp_seek_whence whence)
 {
 	struct mem_io *mem_io = GP_IO_PRIV(io);
+	size_t pos = io->rbuf_pos - mem_io->buf;
 
 	switch (whence) {
 	case GP_SEEK_CUR:
-		if (-off > (off_t)mem_io->pos ||
-		     off + mem_io->pos > mem_io->size) {
+		if (-off > (off_t)pos ||
+		     off + pos > mem_io->size) {
 			errno = EINVAL;
 			return -1;
 		}
 
-		mem_io->pos += off;
+		pos += off;
 	break;
 	case GP_SEEK_SET:
 		if (off < 0 || off > (off_t)mem_io->size) {
 			errno = EINVAL;
 			return -1;
 		}
-		mem_io->pos = off;
+		pos = off;
 	break;
 	case GP_SEEK_END:
 		if (off > 0 || off + (off_t)mem_io->size < 0) {
 			errno = EINVAL;
 			return -1;
 		}
-		mem_io->pos = mem_io->size + off;
+		pos = mem_io->size + off;
 	break;
 	default:
 		GP_WARN("Invalid whence");
@@ -184,7 +194,21 @@ static off_t mem_seek(gp_io *io, off_t off, enum gp_seek_whence whence)
 		return -1;
 	}
 
-	return mem_io->pos;
+	io->rbuf_pos = mem_io->buf + pos;
+
+	return pos;
+}
+
+static const void *mem_map(gp_io *io, off_t off, size_t size)
+{
+	struct mem_io *mem_io = GP_IO_PRIV(io);
+
+	if (off < 0 || (size_t)off > mem_io->size || size > mem_io->size - off) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	return mem_io->buf + off;
 }
 
 static int mem_close(gp_io *io)
@@ -201,13 +225,11 @@ static int mem_close(gp_io *io)
 	return 0;
 }
 
-gp_io *gp_io_mem(void *buf, size_t size, void (*free)(void *))
+static gp_io *mem_io_alloc(void *buf, size_t size)
 {
 	gp_io *io;
 	struct mem_io *mem_io;
 
-	GP_DEBUG(1, "Creating IOMem %p size=%zu", buf, size);
-
 	io = malloc(sizeof(gp_io) + sizeof(*mem_io));
 
 	if (!io) {
@@ -219,18 +241,116 @@ gp_io *gp_io_mem(void *buf, size_t size, void (*free)(void *))
 	io->read = mem_read;
 	io->seek = mem_seek;
 	io->close = mem_close;
+	io->map = mem_map;
 	io->write = NULL;
+	io->mark = 0;
+	io->rbuf_pos = buf;
+	io->rbuf_end = (uint8_t*)buf + size;
 
 	mem_io = GP_IO_PRIV(io);
 
-	mem_io->free = free;
+	mem_io->free = NULL;
 	mem_io->buf = buf;
 	mem_io->size = size;
-	mem_io->pos = 0;
 
 	return io;
 }
 
+gp_io *gp_io_mem(void *buf, size_t size, void (*free)(void *))
+{
+	gp_io *io;
+	struct mem_io *mem_io;
+
+	GP_DEBUG(1, "Creating IOMem %p size=%zu", buf, size);
+
+	io = mem_io_alloc(buf, size);
+	if (!io)
+		return NULL;
+
+	mem_io = GP_IO_PRIV(io);
+	mem_io->free = free;
+
+	return io;
+}
+
+#ifdef HAVE_MMAP
+
+static int mmap_close(gp_io *io)
+{
+	struct mem_io *mem_io = GP_IO_PRIV(io);
+
+	GP_DEBUG(1, "Closing IOMmap");
+
+	munmap(mem_io->buf, mem_io->size);
+	free(io);
+
+	return 0;
+}
+
+gp_io *gp_io_mmap(const char *path)
+{
+	struct stat st;
+	void *buf;
+	gp_io *io;
+	int fd, err;
+
+	GP_DEBUG(1, "Creating IOMmap '%s'", path);
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		GP_DEBUG(1, "Failed to open '%s': %s", path, strerror(errno));
+		return NULL;
+	}
+
+	if (fstat(fd, &st)) {
+		err = errno;
+		goto err0;
+	}
+
+	if (!S_ISREG(st.st_mode) || !st.st_size || (off_t)(size_t)st.st_size != st.st_size) {
+		GP_DEBUG(1, "Cannot map '%s'", path);
+		err = EINVAL;
+		goto err0;
+	}
+
+	buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (buf == MAP_FAILED) {
+		err = errno;
+		GP_DEBUG(1, "Failed to mmap '%s': %s", path, strerror(errno));
+		goto err0;
+	}
+
+	/* The mapping holds a reference to the file */
+	close(fd);
+
+	madvise(buf, st.st_size, MADV_SEQUENTIAL);
+
+	io = mem_io_alloc(buf, st.st_size);
+	if (!io) {
+		munmap(buf, st.st_size);
+		return NULL;
+	}
+
+	io->close = mmap_close;
+
+	return io;
+err0:
+	close(fd);
+	errno = err;
+	return NULL;
+}
+
+#else
+
+gp_io *gp_io_mmap(const char *path)
+{
+	GP_DEBUG(1, "mmap() not available, cannot map '%s'", path);
+	errno = ENOSYS;
+	return NULL;
+}
+
+#endif /* HAVE_MMAP */
+
 struct sub_io {
 	/* Points to parent IO */
 	off_t start;
@@ -318,6 +438,19 @@ static off_t sub_seek(gp_io *io, off_t off, enum gp_seek_whence whence)
 	return sub_io->cur - sub_io->start;
 }
 
+static const void *sub_map(gp_io *io, off_t off, size_t size)
+{
+	struct sub_io *sub_io = GP_IO_PRIV(io);
+	off_t io_size = sub_io->end - sub_io->start;
+
+	if (off < 0 || off > io_size || size > (size_t)(io_size - off)) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	return gp_io_map(sub_io->io, sub_io->start + off, size);
+}
+
 static int sub_close(gp_io *io)
 {
 	struct sub_io *sub_io = GP_IO_PRIV(io);
@@ -347,7 +480,11 @@ gp_io *gp_io_sub_io(gp_io *pio, size_t size)
 	io->read = sub_read;
 	io->seek = sub_seek;
 	io->close = sub_close;
+	io->map = pio->map ? sub_map : NULL;
 	io->write = NULL;
+	io->mark = 0;
+	io->rbuf_pos = NULL;
+	io->rbuf_end = NULL;
 
 	sub_io = GP_IO_PRIV(io);
 	sub_io->cur = sub_io->start = gp_io_tell(pio);
@@ -426,6 +563,10 @@ gp_io *gp_io_wbuffer(gp_io *pio, size_t bsize)
 	io->close = wbuf_close;
 	io->read = NULL;
 	io->seek = NULL;
+	io->map = NULL;
+	io->mark = 0;
+	io->rbuf_pos = NULL;
+	io->rbuf_end = NULL;
 
 	buf_io = GP_IO_PRIV(io);
 	buf_io->io = pio;
@@ -435,6 +576,159 @@ gp_io *gp_io_wbuffer(gp_io *pio, size_t bsize)
 	return io;
 }
 
+struct rbuf_io {
+	gp_io *io;
+	/* Parent I/O offset at the end of the buffered data */
+	off_t poff;
+	size_t bsize;
+	uint8_t buf[];
+};
+
+static const void *rbuf_map(gp_io *io, off_t off, size_t size)
+{
+	struct rbuf_io *rbuf_io = GP_IO_PRIV(io);
+
+	return gp_io_map(rbuf_io->io, off, size);
+}
+
+static int rbuf_close(gp_io *io)
+{
+	struct rbuf_io *rbuf_io = GP_IO_PRIV(io);
+
+	GP_DEBUG(1, "Closing ReadBufferIO (from %p)", rbuf_io->io);
+
+	free(io);
+	return 0;
+}
+
+static size_t rbuf_copy(gp_io *io, void *buf, size_t size)
+{
+	size = GP_MIN(size, (size_t)(io->rbuf_end - io->rbuf_pos));
+
+	memcpy(buf, io->rbuf_pos, size);
+	io->rbuf_pos += size;
+
+	return size;
+}
+
+static ssize_t rbuf_read(gp_io *io, void *buf, size_t size)
+{
+	struct rbuf_io *rbuf_io = GP_IO_PRIV(io);
+	size_t avail = io->rbuf_end - io->rbuf_pos;
+	ssize_t ret;
+
+	if (avail >= size)
+		return rbuf_copy(io, buf, size);
+
+	if (size >= rbuf_io->bsize) {
+		if (avail)
+			return rbuf_copy(io, buf, size);
+
+		GP_DEBUG(3, "Read too large, doing direct read (%p)", io);
+
+		ret = gp_io_read(rbuf_io->io, buf, size);
+		if (ret > 0)
+			rbuf_io->poff += ret;
+
+		return ret;
+	}
+
+	/*
+	 * Move the rest of the data to the start of the buffer and refill, this
+	 * keeps the data consecutive so that gp_io_peek() can seek back.
+	 */
+	memmove(rbuf_io->buf, io->rbuf_pos, avail);
+
+	ret = gp_io_read(rbuf_io->io, rbuf_io->buf + avail, rbuf_io->bsize - avail);
+
+	if (ret < 0 && !avail)
+		return ret;
+
+	if (ret > 0) {
+		rbuf_io->poff += ret;
+		avail += ret;
+	}
+
+	io->rbuf_pos = rbuf_io->buf;
+	io->rbuf_end = rbuf_io->buf + avail;
+
+	return rbuf_copy(io, buf, size);
+}
+
+static off_t rbuf_seek(gp_io *io, off_t off, enum gp_seek_whence whence)
+{
+	struct rbuf_io *rbuf_io = GP_IO_PRIV(io);
+	off_t cur = rbuf_io->poff - (io->rbuf_end - io->rbuf_pos);
+	off_t start = rbuf_io->poff - (io->rbuf_end - rbuf_io->buf);
+	off_t ret;
+
+	switch (whence) {
+	case GP_SEEK_CUR:
+		off += cur;
+	/* fallthrough */
+	case GP_SEEK_SET:
+		if (off >= start && off <= rbuf_io->poff) {
+			io->rbuf_pos = rbuf_io->buf + (off - start);
+			return off;
+		}
+
+		ret = gp_io_seek(rbuf_io->io, off, GP_SEEK_SET);
+	break;
+	case GP_SEEK_END:
+		ret = gp_io_seek(rbuf_io->io, off, GP_SEEK_END);
+	break;
+	default:
+		GP_WARN("Invalid whence");
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (ret == -1)
+		return -1;
+
+	rbuf_io->poff = ret;
+	io->rbuf_pos = rbuf_io->buf;
+	io->rbuf_end = rbuf_io->buf;
+
+	return ret;
+}
+
+gp_io *gp_io_rbuffer(gp_io *pio, size_t bsize)
+{
+	gp_io *io;
+	struct rbuf_io *rbuf_io;
+
+	if (!bsize)
+		bsize = 4096;
+
+	GP_DEBUG(1, "Creating IORBuffer (from %p) size=%zu", pio, bsize);
+
+	io = malloc(sizeof(gp_io) + sizeof(*rbuf_io) + bsize);
+
+	if (!io) {
+		GP_DEBUG(1, "Malloc failed :(");
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	io->read = rbuf_read;
+	io->seek = rbuf_seek;
+	io->close = rbuf_close;
+	io->map = pio->map ? rbuf_map : NULL;
+	io->write = NULL;
+	io->mark = 0;
+
+	rbuf_io = GP_IO_PRIV(io);
+	rbuf_io->io = pio;
+	rbuf_io->bsize = bsize;
+	rbuf_io->poff = gp_io_tell(pio);
+
+	io->rbuf_pos = rbuf_io->buf;
+	io->rbuf_end = rbuf_io->buf;
+
+	return io;
+}
+
 int gp_io_mark(gp_io *self, enum gp_io_mark_types type)
 {
 	off_t ret;
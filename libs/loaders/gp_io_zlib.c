@@ -230,6 +230,10 @@ gp_io *gp_io_zlib(gp_io *io, size_t comp_size)
 	}
 
 	new->close = zlib_close;
+	new->mark = 0;
+	new->rbuf_pos = NULL;
+	new->rbuf_end = NULL;
+	new->map = NULL;
 	new->read  = zlib_read;
 	new->write = NULL;
 	new->seek = zlib_seek;
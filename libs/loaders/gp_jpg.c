@@ -129,6 +129,7 @@ static int load_cmyk(struct jpeg_decompress_struct *cinfo, gp_pixmap *ret,
 struct my_source_mgr {
 	struct jpeg_source_mgr mgr;
 	int start_of_file;
+	int mapped;
 	void *buffer;
 	size_t size;
 	gp_io *io;
@@ -177,6 +178,13 @@ static void skip_input_data(struct jpeg_decompress_struct *cinfo, long num_bytes
 	GP_DEBUG(3, "Skipping %li bytes", num_bytes);
 
 	if (src->mgr.bytes_in_buffer < (unsigned long)num_bytes) {
+		/* Whole file is in the buffer, skipping past the end */
+		if (src->mapped) {
+			src->mgr.next_input_byte += src->mgr.bytes_in_buffer;
+			src->mgr.bytes_in_buffer = 0;
+			return;
+		}
+
 		ret = gp_io_seek(src->io, num_bytes - src->mgr.bytes_in_buffer, GP_SEEK_CUR);
 		//TODO: Call jpeg error
 		if (ret == (off_t)-1)
@@ -202,6 +210,34 @@ static inline void init_source_mgr(struct my_source_mgr *src, gp_io *io,
 	src->buffer = buf;
 	src->size = buf_size;
 	src->start_of_file = 1;
+	src->mapped = 0;
+
+	if (!io->map)
+		return;
+
+	/*
+	 * The data are in memory, decode them in place. The I/O is moved to
+	 * the end so that fill_input_buffer() inserts EOI on truncated data.
+	 */
+	off_t off = gp_io_tell(io);
+	off_t end = gp_io_seek(io, 0, GP_SEEK_END);
+
+	if (off == (off_t)-1 || end <= off)
+		goto restore;
+
+	src->mgr.next_input_byte = gp_io_map(io, off, end - off);
+	if (!src->mgr.next_input_byte)
+		goto restore;
+
+	GP_DEBUG(1, "Decoding %zu bytes from memory", (size_t)(end - off));
+
+	src->mgr.bytes_in_buffer = end - off;
+	src->start_of_file = 0;
+	src->mapped = 1;
+	return;
+restore:
+	src->mgr.next_input_byte = NULL;
+	gp_io_seek(io, off, GP_SEEK_SET);
 }
 
 #define JPEG_COM_MAX 128
@@ -291,8 +327,31 @@ static void save_jpg_markers(struct jpeg_decompress_struct *cinfo)
 	jpeg_save_markers(cinfo, JPEG_APP0 + 2, 0xffff);
 }
 
-int gp_read_jpg_ex(gp_io *io, gp_pixmap **img,
-		 gp_storage *storage, gp_progress_cb *callback)
+/*
+ * Picks the largest of the 1/2, 1/4 and 1/8 DCT scaling factors that keeps the
+ * image at least w x h.
+ */
+static void set_scale(struct jpeg_decompress_struct *cinfo, gp_size w, gp_size h)
+{
+	unsigned int denom;
+
+	for (denom = 8; denom > 1; denom /= 2) {
+		if ((cinfo->image_width + denom - 1) / denom >= w &&
+		    (cinfo->image_height + denom - 1) / denom >= h)
+			break;
+	}
+
+	cinfo->scale_num = 1;
+	cinfo->scale_denom = denom;
+
+	jpeg_calc_output_dimensions(cinfo);
+
+	GP_DEBUG(1, "Decoding at 1/%u scale %ux%u for %ux%u", denom,
+	         cinfo->output_width, cinfo->output_height, w, h);
+}
+
+static int read_jpg(gp_io *io, gp_pixmap **img, gp_storage *storage,
+                    gp_size w, gp_size h, gp_progress_cb *callback)
 {
 	struct jpeg_decompress_struct cinfo;
 	struct my_source_mgr src;
@@ -351,7 +410,12 @@ int gp_read_jpg_ex(gp_io *io, gp_pixmap **img,
 		goto err1;
 	}
 
-	ret = gp_pixmap_alloc(cinfo.image_width, cinfo.image_height,
+	if (w || h)
+		set_scale(&cinfo, w, h);
+	else
+		jpeg_calc_output_dimensions(&cinfo);
+
+	ret = gp_pixmap_alloc(cinfo.output_width, cinfo.output_height,
 			      pixel_type);
 
 	if (!ret) {
@@ -407,6 +471,90 @@ err1:
 	return 1;
 }
 
+int gp_read_jpg_ex(gp_io *io, gp_pixmap **img,
+		 gp_storage *storage, gp_progress_cb *callback)
+{
+	return read_jpg(io, img, storage, 0, 0, callback);
+}
+
+static int read_jpg_scaled(gp_io *io, gp_pixmap **img, gp_storage *storage,
+                           gp_size w, gp_size h, gp_progress_cb *callback)
+{
+	return read_jpg(io, img, storage, w, h, callback);
+}
+
+/*
+ * Looks for Exif APP1 marker before the image data and decodes the thumbnail,
+ * only the markers are parsed so this is cheap compared to a full decode.
+ */
+static int read_jpg_thumbnail(gp_io *io, gp_pixmap **img,
+                              gp_progress_cb *callback)
+{
+	uint8_t marker;
+	uint16_t len;
+	off_t off;
+	gp_io *sub_io;
+	int ret, err;
+
+	uint16_t soi[] = {
+		0xff, 0xd8,
+		GP_IO_END
+	};
+
+	uint16_t segment[] = {
+		0xff,
+		GP_IO_BYTE, /* Marker */
+		GP_IO_B2,   /* Segment length including the length */
+		GP_IO_END
+	};
+
+	if (gp_io_readf(io, soi) != 2) {
+		GP_DEBUG(1, "Failed to read JPEG SOI");
+		return 1;
+	}
+
+	for (;;) {
+		if (gp_io_readf(io, segment, &marker, &len) != 3 || len < 2) {
+			GP_DEBUG(1, "Failed to read JPEG segment header");
+			return 1;
+		}
+
+		GP_DEBUG(3, "JPEG marker 0x%02x size %"PRIu16, marker, len);
+
+		/* Frame, Huffman tables or scan, Exif is stored before these */
+		if (marker >= 0xc0 && marker <= 0xda)
+			break;
+
+		off = gp_io_tell(io);
+
+		if (marker == JPEG_APP0 + 1) {
+			sub_io = gp_io_sub_io(io, len - 2);
+			if (!sub_io)
+				return 1;
+
+			ret = gp_read_exif_thumbnail(sub_io, img, callback);
+			err = errno;
+			gp_io_close(sub_io);
+
+			if (!ret)
+				return 0;
+
+			if (err == ECANCELED) {
+				errno = err;
+				return 1;
+			}
+		}
+
+		if (gp_io_seek(io, off + len - 2, GP_SEEK_SET) == (off_t)-1) {
+			GP_DEBUG(1, "Failed to skip JPEG segment");
+			return 1;
+		}
+	}
+
+	errno = ENOENT;
+	return 1;
+}
+
 static int save_convert(struct jpeg_compress_struct *cinfo,
                         const gp_pixmap *src,
                         gp_pixel_type out_pix,
@@ -514,8 +662,56 @@ static gp_pixel_type out_pixel_types[] = {
 	GP_PIXEL_UNKNOWN
 };
 
-int gp_write_jpg(const gp_pixmap *src, gp_io *io,
-                gp_progress_cb *callback)
+static void set_jpg_opts(struct jpeg_compress_struct *cinfo,
+                         const gp_save_opts *opts)
+{
+	enum gp_save_subsampling subsampling = opts->subsampling;
+	int progressive = opts->flags & GP_SAVE_PROGRESSIVE;
+	int h = 2, v = 2;
+
+	switch (opts->preset) {
+	case GP_SAVE_PRESET_DEFAULT:
+	break;
+	case GP_SAVE_PRESET_FASTEST:
+		cinfo->dct_method = JDCT_IFAST;
+		cinfo->optimize_coding = FALSE;
+	break;
+	case GP_SAVE_PRESET_SMALLEST:
+		cinfo->optimize_coding = TRUE;
+		progressive = 1;
+	break;
+	}
+
+	if (opts->quality)
+		jpeg_set_quality(cinfo, opts->quality, TRUE);
+
+	switch (subsampling) {
+	case GP_SAVE_SUBSAMPLING_DEFAULT:
+	case GP_SAVE_SUBSAMPLING_420:
+	break;
+	case GP_SAVE_SUBSAMPLING_422:
+		v = 1;
+	break;
+	case GP_SAVE_SUBSAMPLING_444:
+		h = 1;
+		v = 1;
+	break;
+	}
+
+	if (cinfo->num_components == 3) {
+		cinfo->comp_info[0].h_samp_factor = h;
+		cinfo->comp_info[0].v_samp_factor = v;
+	}
+
+	if (progressive)
+		jpeg_simple_progression(cinfo);
+
+	GP_DEBUG(1, "Quality %i subsampling %ix%i%s", opts->quality, h, v,
+	         progressive ? " progressive" : "");
+}
+
+static int write_jpg(const gp_pixmap *src, gp_io *io,
+                     const gp_save_opts *opts, gp_progress_cb *callback)
 {
 	struct jpeg_compress_struct cinfo;
 	gp_pixel_type out_pix;
@@ -567,6 +763,9 @@ int gp_write_jpg(const gp_pixmap *src, gp_io *io,
 
 	jpeg_set_defaults(&cinfo);
 
+	if (opts)
+		set_jpg_opts(&cinfo, opts);
+
 	jpeg_start_compress(&cinfo, TRUE);
 
 	if (out_pix != src->pixel_type)
@@ -587,6 +786,12 @@ int gp_write_jpg(const gp_pixmap *src, gp_io *io,
 	return 0;
 }
 
+int gp_write_jpg(const gp_pixmap *src, gp_io *io,
+                gp_progress_cb *callback)
+{
+	return write_jpg(src, io, NULL, callback);
+}
+
 #else
 
 int gp_read_jpg_ex(gp_io GP_UNUSED(*io), gp_pixmap GP_UNUSED(**img),
@@ -609,7 +814,10 @@ int gp_write_jpg(const gp_pixmap GP_UNUSED(*src), gp_io GP_UNUSED(*io),
 const gp_loader gp_jpg = {
 #ifdef HAVE_JPEG
 	.read = gp_read_jpg_ex,
+	.read_scaled = read_jpg_scaled,
+	.read_thumbnail = read_jpg_thumbnail,
 	.write = gp_write_jpg,
+	.write_ex = write_jpg,
 	.save_ptypes = out_pixel_types,
 #endif
 	.match = gp_match_jpg,
@@ -0,0 +1,326 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_pixmap.h>
+#include <core/gp_progress_callback.h>
+#include <loaders/gp_loader.h>
+#include <loaders/gp_load_queue.h>
+
+struct gp_load_queue {
+	pthread_mutex_t lock;
+	/* Signalled when there is new request or when done_bytes decreased */
+	pthread_cond_t cond;
+
+	/* Sorted by priority, FIFO for requests with the same priority */
+	gp_load_req *pending;
+	size_t pending_cnt;
+
+	/* Finished requests, FIFO */
+	gp_load_req *done_head;
+	gp_load_req *done_tail;
+	size_t done_cnt;
+	size_t done_bytes;
+	size_t max_bytes;
+
+	int exit;
+	int efd;
+
+	unsigned int threads;
+	pthread_t workers[];
+};
+
+static size_t img_bytes(gp_pixmap *img)
+{
+	if (!img)
+		return 0;
+
+	return (size_t)img->bytes_per_row * img->h;
+}
+
+static void pending_add(gp_load_queue *self, gp_load_req *req)
+{
+	gp_load_req **i = &self->pending;
+
+	while (*i && (*i)->priority >= req->priority)
+		i = &(*i)->next;
+
+	req->next = *i;
+	*i = req;
+	self->pending_cnt++;
+}
+
+static gp_load_req *pending_pop(gp_load_queue *self)
+{
+	gp_load_req *req = self->pending;
+
+	self->pending = req->next;
+	self->pending_cnt--;
+
+	return req;
+}
+
+static void done_add(gp_load_queue *self, gp_load_req *req)
+{
+	uint64_t one = 1;
+
+	req->next = NULL;
+
+	if (self->done_tail)
+		self->done_tail->next = req;
+	else
+		self->done_head = req;
+
+	self->done_tail = req;
+	self->done_bytes += img_bytes(req->img);
+
+	/* Queue was empty, make the fd readable */
+	if (!self->done_cnt++) {
+		if (write(self->efd, &one, sizeof(one)) != sizeof(one))
+			GP_WARN("Failed to write eventfd: %s", strerror(errno));
+	}
+}
+
+static gp_load_req *done_pop(gp_load_queue *self)
+{
+	gp_load_req *req = self->done_head;
+	uint64_t cnt;
+
+	if (!req)
+		return NULL;
+
+	self->done_head = req->next;
+	if (!self->done_head)
+		self->done_tail = NULL;
+
+	self->done_bytes -= img_bytes(req->img);
+	req->next = NULL;
+
+	/* Queue is empty, clear the fd */
+	if (!--self->done_cnt) {
+		if (read(self->efd, &cnt, sizeof(cnt)) != sizeof(cnt))
+			GP_WARN("Failed to read eventfd: %s", strerror(errno));
+	}
+
+	return req;
+}
+
+static int over_limit(gp_load_queue *self)
+{
+	return self->max_bytes && self->done_bytes >= self->max_bytes;
+}
+
+static int load_progress(gp_progress_cb *self)
+{
+	gp_load_req *req = self->priv;
+
+	return gp_load_token_cancelled(req->token);
+}
+
+static void load(gp_load_req *req)
+{
+	gp_progress_cb callback = {
+		.callback = load_progress,
+		.priv = req,
+	};
+	int ret;
+
+	req->img = NULL;
+
+	if (gp_load_token_cancelled(req->token)) {
+		req->err = ECANCELED;
+		return;
+	}
+
+	errno = 0;
+
+	if (req->path) {
+		ret = gp_load_image_scaled_ex(req->path, &req->img, req->meta_data,
+		                              req->w, req->h, &callback);
+	} else {
+		ret = gp_read_image_scaled_ex(req->io, &req->img, req->meta_data,
+		                              req->w, req->h, &callback);
+	}
+
+	if (!ret && req->img) {
+		req->err = 0;
+		return;
+	}
+
+	req->err = errno ? errno : EINVAL;
+
+	gp_pixmap_free(req->img);
+	req->img = NULL;
+
+	GP_DEBUG(1, "Failed to load '%s': %s",
+	         req->path ? req->path : "I/O", strerror(req->err));
+}
+
+static void *worker(void *ptr)
+{
+	gp_load_queue *self = ptr;
+	gp_load_req *req;
+
+	pthread_mutex_lock(&self->lock);
+
+	for (;;) {
+		while (!self->exit && (!self->pending || over_limit(self)))
+			pthread_cond_wait(&self->cond, &self->lock);
+
+		if (self->exit)
+			break;
+
+		req = pending_pop(self);
+
+		pthread_mutex_unlock(&self->lock);
+		load(req);
+		pthread_mutex_lock(&self->lock);
+
+		done_add(self, req);
+	}
+
+	pthread_mutex_unlock(&self->lock);
+
+	return NULL;
+}
+
+static void stop_workers(gp_load_queue *self, unsigned int cnt)
+{
+	unsigned int i;
+
+	pthread_mutex_lock(&self->lock);
+	self->exit = 1;
+	pthread_cond_broadcast(&self->cond);
+	pthread_mutex_unlock(&self->lock);
+
+	for (i = 0; i < cnt; i++)
+		pthread_join(self->workers[i], NULL);
+}
+
+gp_load_queue *gp_load_queue_create(unsigned int threads, size_t max_bytes)
+{
+	gp_load_queue *self;
+	unsigned int i;
+	int err;
+
+	if (!threads) {
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		threads = cpus > 0 ? cpus : 1;
+	}
+
+	self = calloc(1, sizeof(*self) + threads * sizeof(pthread_t));
+	if (!self) {
+		GP_WARN("Malloc failed :-(");
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	self->efd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (self->efd < 0) {
+		err = errno;
+		GP_WARN("Failed to create eventfd: %s", strerror(errno));
+		goto err0;
+	}
+
+	pthread_mutex_init(&self->lock, NULL);
+	pthread_cond_init(&self->cond, NULL);
+
+	self->max_bytes = max_bytes;
+	self->threads = threads;
+
+	for (i = 0; i < threads; i++) {
+		err = pthread_create(&self->workers[i], NULL, worker, self);
+		if (err) {
+			GP_WARN("Failed to create thread: %s", strerror(err));
+			stop_workers(self, i);
+			goto err1;
+		}
+	}
+
+	GP_DEBUG(1, "Load queue with %u threads max_bytes=%zu",
+	         threads, max_bytes);
+
+	return self;
+err1:
+	pthread_cond_destroy(&self->cond);
+	pthread_mutex_destroy(&self->lock);
+	close(self->efd);
+err0:
+	free(self);
+	errno = err;
+	return NULL;
+}
+
+void gp_load_queue_destroy(gp_load_queue *self)
+{
+	gp_load_req *req;
+
+	if (!self)
+		return;
+
+	stop_workers(self, self->threads);
+
+	while ((req = done_pop(self))) {
+		gp_pixmap_free(req->img);
+		req->img = NULL;
+	}
+
+	pthread_cond_destroy(&self->cond);
+	pthread_mutex_destroy(&self->lock);
+	close(self->efd);
+	free(self);
+}
+
+void gp_load_queue_add(gp_load_queue *self, gp_load_req *req)
+{
+	req->img = NULL;
+	req->err = 0;
+
+	pthread_mutex_lock(&self->lock);
+	pending_add(self, req);
+	pthread_cond_signal(&self->cond);
+	pthread_mutex_unlock(&self->lock);
+}
+
+gp_load_req *gp_load_queue_get(gp_load_queue *self)
+{
+	gp_load_req *req;
+	int was_over;
+
+	pthread_mutex_lock(&self->lock);
+
+	was_over = over_limit(self);
+	req = done_pop(self);
+
+	if (was_over && !over_limit(self))
+		pthread_cond_broadcast(&self->cond);
+
+	pthread_mutex_unlock(&self->lock);
+
+	return req;
+}
+
+int gp_load_queue_fd(gp_load_queue *self)
+{
+	return self->efd;
+}
+
+void gp_load_queue_stats_get(gp_load_queue *self, gp_load_queue_stats *stats)
+{
+	pthread_mutex_lock(&self->lock);
+	stats->pending = self->pending_cnt;
+	stats->done = self->done_cnt;
+	stats->done_bytes = self->done_bytes;
+	pthread_mutex_unlock(&self->lock);
+}
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+ * Load queue stubs used when the library is compiled without pthread.
+ */
+
+#include <errno.h>
+
+#include <core/gp_debug.h>
+#include <loaders/gp_load_queue.h>
+
+gp_load_queue *gp_load_queue_create(unsigned int threads, size_t max_bytes)
+{
+	(void) threads;
+	(void) max_bytes;
+
+	GP_WARN("Load queue support not compiled in (pthread missing)!");
+
+	errno = ENOSYS;
+	return NULL;
+}
+
+void gp_load_queue_destroy(gp_load_queue *self)
+{
+	(void) self;
+}
+
+void gp_load_queue_add(gp_load_queue *self, gp_load_req *req)
+{
+	(void) self;
+
+	req->err = ENOSYS;
+}
+
+gp_load_req *gp_load_queue_get(gp_load_queue *self)
+{
+	(void) self;
+
+	return NULL;
+}
+
+int gp_load_queue_fd(gp_load_queue *self)
+{
+	(void) self;
+
+	return -1;
+}
+
+void gp_load_queue_stats_get(gp_load_queue *self, gp_load_queue_stats *stats)
+{
+	(void) self;
+
+	stats->pending = 0;
+	stats->done = 0;
+	stats->done_bytes = 0;
+}
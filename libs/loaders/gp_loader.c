@@ -112,6 +112,7 @@ void gp_loaders_list(void)
 		printf("Format: %s\n", loaders[i]->fmt_name);
 		printf("Read:\t%s\n", loaders[i]->read ? "Yes" : "No");
 		printf("Write:\t%s\n", loaders[i]->write ? "Yes" : "No");
+		printf("Options:\t%s\n", loaders[i]->write_ex ? "Yes" : "No");
 		if (loaders[i]->save_ptypes) {
 			printf("Write Pixel Types: ");
 			for (j = 0; loaders[i]->save_ptypes[j]; j++) {
@@ -223,8 +224,55 @@ gp_pixmap *gp_read_image(gp_io *io, gp_progress_cb *callback)
 	return ret;
 }
 
-int gp_read_image_ex(gp_io *io, gp_pixmap **img, gp_storage *meta_data,
-                     gp_progress_cb *callback)
+static int read_thumbnail(const gp_loader *self, gp_io *io, gp_pixmap **img,
+                          gp_size w, gp_size h, gp_progress_cb *callback)
+{
+	gp_pixmap *thumb = NULL;
+
+	if (self->read_thumbnail(io, &thumb, callback))
+		return 1;
+
+	if ((w && thumb->w < w) || (h && thumb->h < h)) {
+		GP_DEBUG(1, "Embedded thumbnail %ux%u smaller than %ux%u",
+		         thumb->w, thumb->h, w, h);
+		gp_pixmap_free(thumb);
+		errno = ENOENT;
+		return 1;
+	}
+
+	GP_DEBUG(1, "Using embedded thumbnail %ux%u", thumb->w, thumb->h);
+
+	*img = thumb;
+	return 0;
+}
+
+static int loader_read(const gp_loader *self, gp_io *io, gp_pixmap **img,
+                       gp_storage *storage, gp_size w, gp_size h, int thumb,
+                       gp_progress_cb *callback)
+{
+	if (img && thumb && self->read_thumbnail) {
+		off_t start = gp_io_tell(io);
+
+		if (!read_thumbnail(self, io, img, w, h, callback))
+			return 0;
+
+		if (errno == ECANCELED)
+			return 1;
+
+		if (gp_io_seek(io, start, GP_SEEK_SET) != start) {
+			GP_DEBUG(1, "Failed to seek back: %s", strerror(errno));
+			return 1;
+		}
+	}
+
+	if (img && (w || h) && self->read_scaled)
+		return self->read_scaled(io, img, storage, w, h, callback);
+
+	return self->read(io, img, storage, callback);
+}
+
+static int read_image(gp_io *io, gp_pixmap **img, gp_storage *meta_data,
+                      gp_size w, gp_size h, gp_progress_cb *callback)
 {
 	char buf[32];
 	off_t start;
@@ -267,14 +315,27 @@ int gp_read_image_ex(gp_io *io, gp_pixmap **img, gp_storage *meta_data,
 		return 1;
 	}
 
-	return loader->read(io, img, meta_data, callback);
+	return loader_read(loader, io, img, meta_data, w, h, 0, callback);
 }
 
-int gp_loader_load_image_ex(const gp_loader *self, const char *src_path,
-                            gp_pixmap **img, gp_storage *storage,
-                            gp_progress_cb *callback)
+int gp_read_image_ex(gp_io *io, gp_pixmap **img, gp_storage *meta_data,
+                     gp_progress_cb *callback)
 {
-	gp_io *io;
+	return read_image(io, img, meta_data, 0, 0, callback);
+}
+
+int gp_read_image_scaled_ex(gp_io *io, gp_pixmap **img, gp_storage *meta_data,
+                            gp_size w, gp_size h, gp_progress_cb *callback)
+{
+	return read_image(io, img, meta_data, w, h, callback);
+}
+
+static int loader_load_image(const gp_loader *self, const char *src_path,
+                             gp_pixmap **img, gp_storage *storage,
+                             gp_size w, gp_size h, int thumb,
+                             gp_progress_cb *callback)
+{
+	gp_io *fio, *io;
 	int err, ret;
 
 	GP_DEBUG(1, "Loading Image '%s'", src_path);
@@ -284,19 +345,35 @@ int gp_loader_load_image_ex(const gp_loader *self, const char *src_path,
 		return ENOSYS;
 	}
 
-	io = gp_io_file(src_path, GP_IO_RDONLY);
-	if (!io)
+	fio = gp_io_file(src_path, GP_IO_RDONLY);
+	if (!fio)
+		return 1;
+
+	io = gp_io_rbuffer(fio, 0);
+	if (!io) {
+		err = errno;
+		gp_io_close(fio);
+		errno = err;
 		return 1;
+	}
 
-	ret = self->read(io, img, storage, callback);
+	ret = loader_read(self, io, img, storage, w, h, thumb, callback);
 
 	err = errno;
 	gp_io_close(io);
+	gp_io_close(fio);
 	errno = err;
 
 	return ret;
 }
 
+int gp_loader_load_image_ex(const gp_loader *self, const char *src_path,
+                            gp_pixmap **img, gp_storage *storage,
+                            gp_progress_cb *callback)
+{
+	return loader_load_image(self, src_path, img, storage, 0, 0, 0, callback);
+}
+
 
 gp_pixmap *gp_loader_load_image(const gp_loader *self, const char *src_path,
                                gp_progress_cb *callback)
@@ -341,9 +418,10 @@ gp_pixmap *gp_load_image(const char *src_path, gp_progress_cb *callback)
 	return ret;
 }
 
-int gp_load_image_ex(const char *src_path,
-                     gp_pixmap **img, gp_storage *meta_data,
-                     gp_progress_cb *callback)
+static int load_image(const char *src_path,
+                      gp_pixmap **img, gp_storage *meta_data,
+                      gp_size w, gp_size h, int thumb,
+                      gp_progress_cb *callback)
 {
 	int err;
 	struct stat st;
@@ -370,8 +448,8 @@ int gp_load_image_ex(const char *src_path,
 	ext_load = gp_loader_by_filename(src_path);
 
 	if (ext_load) {
-		if (!gp_loader_load_image_ex(ext_load, src_path,
-		                             img, meta_data, callback))
+		if (!loader_load_image(ext_load, src_path,
+		                       img, meta_data, w, h, thumb, callback))
 			return 0;
 	}
 
@@ -400,8 +478,8 @@ int gp_load_image_ex(const char *src_path,
 	}
 
 	if (sig_load) {
-		if (!gp_loader_load_image_ex(sig_load, src_path,
-		                          img, meta_data, callback))
+		if (!loader_load_image(sig_load, src_path,
+		                       img, meta_data, w, h, thumb, callback))
 			return 0;
 	}
 
@@ -409,6 +487,40 @@ int gp_load_image_ex(const char *src_path,
 	return 1;
 }
 
+int gp_load_image_ex(const char *src_path,
+                     gp_pixmap **img, gp_storage *meta_data,
+                     gp_progress_cb *callback)
+{
+	return load_image(src_path, img, meta_data, 0, 0, 0, callback);
+}
+
+gp_pixmap *gp_load_image_scaled(const char *src_path, gp_size w, gp_size h,
+                                gp_progress_cb *callback)
+{
+	gp_pixmap *ret = NULL;
+
+	load_image(src_path, &ret, NULL, w, h, 0, callback);
+
+	return ret;
+}
+
+int gp_load_image_scaled_ex(const char *src_path,
+                            gp_pixmap **img, gp_storage *meta_data,
+                            gp_size w, gp_size h, gp_progress_cb *callback)
+{
+	return load_image(src_path, img, meta_data, w, h, 0, callback);
+}
+
+gp_pixmap *gp_load_thumbnail(const char *src_path, gp_size min_w, gp_size min_h,
+                             gp_progress_cb *callback)
+{
+	gp_pixmap *ret = NULL;
+
+	load_image(src_path, &ret, NULL, min_w, min_h, 1, callback);
+
+	return ret;
+}
+
 int gp_load_meta_data(const char *src_path, gp_storage *storage)
 {
 	const gp_loader *loader;
@@ -445,14 +557,40 @@ out:
 	return 1;
 }
 
-int gp_loader_save_image(const gp_loader *self, const gp_pixmap *src,
-                         const char *dst_path, gp_progress_cb *callback)
+int gp_loader_write_image_ex(const gp_loader *self, const gp_pixmap *src,
+                             gp_io *io, const gp_save_opts *opts,
+                             gp_progress_cb *callback)
+{
+	if (opts && (opts->compress_level < 0 || opts->compress_level > 9 ||
+	             opts->quality < 0 || opts->quality > 100)) {
+		GP_DEBUG(1, "Invalid encoder options");
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (self->write_ex)
+		return self->write_ex(src, io, opts, callback);
+
+	if (!self->write) {
+		errno = ENOSYS;
+		return 1;
+	}
+
+	if (opts)
+		GP_DEBUG(1, "Encoder options not supported by %s", self->fmt_name);
+
+	return self->write(src, io, callback);
+}
+
+int gp_loader_save_image_ex(const gp_loader *self, const gp_pixmap *src,
+                            const char *dst_path, const gp_save_opts *opts,
+                            gp_progress_cb *callback)
 {
 	gp_io *io;
 
 	GP_DEBUG(1, "Saving image '%s' format %s", dst_path, self->fmt_name);
 
-	if (!self->write) {
+	if (!self->write && !self->write_ex) {
 		errno = ENOSYS;
 		return 1;
 	}
@@ -462,7 +600,7 @@ int gp_loader_save_image(const gp_loader *self, const gp_pixmap *src,
 	if (!io)
 		return 1;
 
-	if (self->write(src, io, callback)) {
+	if (gp_loader_write_image_ex(self, src, io, opts, callback)) {
 		gp_io_close(io);
 		unlink(dst_path);
 		return 1;
@@ -476,8 +614,14 @@ int gp_loader_save_image(const gp_loader *self, const gp_pixmap *src,
 	return 0;
 }
 
-int gp_save_image(const gp_pixmap *src, const char *dst_path,
-                  gp_progress_cb *callback)
+int gp_loader_save_image(const gp_loader *self, const gp_pixmap *src,
+                         const char *dst_path, gp_progress_cb *callback)
+{
+	return gp_loader_save_image_ex(self, src, dst_path, NULL, callback);
+}
+
+int gp_save_image_ex(const gp_pixmap *src, const char *dst_path,
+                     const gp_save_opts *opts, gp_progress_cb *callback)
 {
 	const gp_loader *l = gp_loader_by_filename(dst_path);
 
@@ -486,7 +630,13 @@ int gp_save_image(const gp_pixmap *src, const char *dst_path,
 		return 1;
 	}
 
-	return gp_loader_save_image(l, src, dst_path, callback);
+	return gp_loader_save_image_ex(l, src, dst_path, opts, callback);
+}
+
+int gp_save_image(const gp_pixmap *src, const char *dst_path,
+                  gp_progress_cb *callback)
+{
+	return gp_save_image_ex(src, dst_path, NULL, callback);
 }
 
 const gp_loader *gp_loader_by_signature(const void *buf)
@@ -144,6 +144,10 @@ static gp_io *rle(gp_io *io)
 	rle->write = NULL;
 	rle->seek = rle_seek;
 	rle->close = rle_close;
+	rle->mark = 0;
+	rle->rbuf_pos = NULL;
+	rle->rbuf_end = NULL;
+	rle->map = NULL;
 
 	return rle;
 }
@@ -18,12 +18,17 @@
 #include "../../config.h"
 #include <core/gp_byte_order.h>
 #include <core/gp_debug.h>
+#include <core/gp_get_put_pixel.h>
 #include <core/gp_gamma_correction.h>
 #include <core/gp_temp_alloc.h>
 
 #include <loaders/gp_io.h>
 #include <loaders/gp_line_convert.h>
 #include <loaders/gp_loaders.gen.h>
+#include <loaders/gp_io_zlib.h>
+#include <loaders/gp_png.h>
+
+#include "gp_anim_priv.h"
 
 enum color_types {
 	COLOR_MASK_PALETTE = 0x01,
@@ -607,8 +612,43 @@ static void flush_data(png_structp png_ptr)
 	(void)png_ptr;
 }
 
-int gp_write_png(const gp_pixmap *src, gp_io *io,
-                gp_progress_cb *callback)
+static void set_png_opts(png_structp png, const gp_save_opts *opts)
+{
+	int level = -1, filters = -1;
+
+	if (!opts)
+		return;
+
+	switch (opts->preset) {
+	case GP_SAVE_PRESET_DEFAULT:
+	break;
+	case GP_SAVE_PRESET_FASTEST:
+		level = 1;
+		filters = PNG_FILTER_NONE;
+	break;
+	case GP_SAVE_PRESET_SMALLEST:
+		level = 9;
+		filters = PNG_ALL_FILTERS;
+	break;
+	}
+
+	if (opts->compress_level)
+		level = opts->compress_level;
+
+	if (opts->compress == GP_SAVE_COMPRESS_NONE)
+		level = 0;
+
+	GP_DEBUG(1, "Setting zlib level %i filters 0x%02x", level, filters);
+
+	if (level >= 0)
+		png_set_compression_level(png, level);
+
+	if (filters >= 0)
+		png_set_filter(png, PNG_FILTER_TYPE_BASE, filters);
+}
+
+static int write_png(const gp_pixmap *src, gp_io *io,
+                     const gp_save_opts *opts, gp_progress_cb *callback)
 {
 	png_structp png;
 	png_infop png_info = NULL;
@@ -653,6 +693,8 @@ int gp_write_png(const gp_pixmap *src, gp_io *io,
 
 	png_set_write_fn(png, io, write_data, flush_data);
 
+	set_png_opts(png, opts);
+
 	/* Fill png header and prepare for data */
 	prepare_png_header(out_pix, src->w, src->h, png, png_info);
 
@@ -676,9 +718,39 @@ err:
 	return 1;
 }
 
+int gp_write_png(const gp_pixmap *src, gp_io *io,
+                gp_progress_cb *callback)
+{
+	return write_png(src, io, NULL, callback);
+}
+
 #else
 
-#include <loaders/gp_io_zlib.h>
+int gp_match_png(const void *buf)
+{
+	const char *header = "\x89PNG\r\n\x1a\n";
+
+	return !memcmp(buf, header, 8);
+}
+
+int gp_read_png_ex(gp_io *io, gp_pixmap **img, gp_storage *storage,
+                   gp_progress_cb *callback)
+{
+	return gp_read_png_int_ex(io, img, storage, callback);
+}
+
+int gp_write_png(const gp_pixmap GP_UNUSED(*src), gp_io GP_UNUSED(*io),
+                gp_progress_cb GP_UNUSED(*callback))
+{
+	errno = ENOSYS;
+	return 1;
+}
+
+#endif /* HAVE_LIBPNG */
+
+/*
+ * Internal PNG decoder, used when libpng is not available.
+ */
 
 enum comp_methods {
 	COMP_METHOD_ZLIB = 0,
@@ -711,13 +783,6 @@ static const char *filter_method_name(uint8_t filter_method)
 	}
 }
 
-int gp_match_png(const void *buf)
-{
-	const char *header = "\x89PNG\r\n\x1a\n";
-
-	return !memcmp(buf, header, 8);
-}
-
 struct IHDR_chunk {
 	uint32_t size;
 	uint32_t width;
@@ -729,272 +794,944 @@ struct IHDR_chunk {
 	uint8_t interlace_method;
 };
 
-static inline uint8_t paeth(int a, int b, int c)
-{
-	int p = a + b - c;
-	int pa = GP_ABS(p - a);
-	int pb = GP_ABS(p - b);
-	int pc = GP_ABS(p - c);
+struct png_dec;
 
-	if (pa <= pb && pa <= pc)
-		return a;
+/*
+ * Converts unfiltered scanline into a pixmap row, NULL if the scanline is
+ * stored in the pixmap pixel format already.
+ */
+typedef void (*png_conv)(struct png_dec *dec, const uint8_t *src,
+                         uint8_t *dst, uint32_t w);
 
-	if (pb <= pc)
-		return b;
+struct png_dec {
+	struct IHDR_chunk IHDR;
 
-	return c;
-}
+	/* Bits per pixel and bytes per complete pixel for unfiltering */
+	unsigned int bpp;
+	unsigned int filter_bpp;
+
+	/* Palette converted to RGB888 or RGBA8888 pixel values */
+	gp_pixel palette[256];
+	unsigned int palette_size;
+	int has_trns;
+
+	int has_srgb;
+	int has_gamma;
+	uint32_t gamma;
+	/* 16 bit samples are linear and are converted to sRGB */
+	int lin16;
+
+	gp_pixel_type pixel_type;
+	png_conv conv;
+};
 
-static void decode_filter(uint8_t *scanline, uint8_t *prev_scanline,
-                          int scanline_len, uint8_t filter_method,
-			  uint8_t stride)
+/*
+ * Unfiltering, the Up filter is byte parallel and works on 16 bytes at a time.
+ *
+ * Sub, Avg and Paeth depend on the previous pixel, these are specialized for
+ * the number of bytes per pixel and for three and more bytes all bytes of a
+ * pixel are processed in one vector, which keeps the previous pixel in a
+ * register.
+ */
+typedef uint8_t v16u8 __attribute__ ((vector_size (16)));
+typedef int16_t v8i16 __attribute__ ((vector_size (16)));
+
+static void unfilter_up(uint8_t *cur, const uint8_t *prev, size_t len)
 {
-	int i;
+	size_t i = 0;
 
-	GP_DEBUG(5, "Scanline filter method %s first pixel [%i,%i,%i]",
-	         filter_method_name(filter_method),
-	         (int)scanline[0], (int)scanline[1], (int)scanline[2]);
+	for (; i + 16 <= len; i += 16) {
+		v16u8 a, b;
 
-	switch (filter_method) {
-	case FILTER_METHOD_NONE:
-	break;
-	case FILTER_METHOD_SUB:
-		for (i = 0; i < scanline_len; i++)
-			scanline[i] += scanline[i-stride];
-	break;
-	case FILTER_METHOD_UP:
-		for (i = 0; i < scanline_len; i++)
-			scanline[i] += prev_scanline[i];
-	break;
-	case FILTER_METHOD_AVG:
-		for (i = 0; i < scanline_len; i++)
-			scanline[i] += (scanline[i-stride] + prev_scanline[i])/2;
-	break;
-	case FILTER_METHOD_PAETH:
-		for (i = 0; i < scanline_len; i++)
-			scanline[i] += paeth(scanline[i-stride], prev_scanline[i], prev_scanline[i-stride]);
-	break;
+		memcpy(&a, cur + i, 16);
+		memcpy(&b, prev + i, 16);
+		a += b;
+		memcpy(cur + i, &a, 16);
 	}
+
+	for (; i < len; i++)
+		cur[i] += prev[i];
 }
 
-static int load_rgb888_image(gp_io *zlib_io, struct IHDR_chunk *IHDR, gp_pixmap **ret, gp_progress_cb *callback)
+static inline uint8_t paeth(int a, int b, int c)
 {
-	uint32_t x, y;
-	uint32_t width = IHDR->width;
-	uint32_t scanline_len = 3 * width;
-	uint8_t *scanline1, *scanline2, *prev_scanline, *cur_scanline;
-	int err;
-	gp_pixmap *res;
+	int pa = GP_ABS(b - c);
+	int pb = GP_ABS(a - c);
+	int pc = GP_ABS(a + b - 2 * c);
 
-	gp_temp_alloc_create(tmpbuf, 2*((size_t)scanline_len+3));
+	if (pb < pa) {
+		pa = pb;
+		a = b;
+	}
 
-	scanline1 = gp_temp_alloc_get(tmpbuf, scanline_len+3);
-	scanline2 = gp_temp_alloc_get(tmpbuf, scanline_len+3);
+	return pc < pa ? c : a;
+}
 
-	memset(scanline1, 0, scanline_len+3);
-	memset(scanline2, 0, scanline_len+3);
+#define UNFILTER_SCALAR(bpp) \
+static void unfilter_sub_##bpp(uint8_t *cur, const uint8_t GP_UNUSED(*prev), \
+                               size_t len) \
+{ \
+	size_t i; \
+\
+	for (i = bpp; i < len; i++) \
+		cur[i] += cur[i - bpp]; \
+} \
+\
+static void unfilter_avg_##bpp(uint8_t *cur, const uint8_t *prev, size_t len) \
+{ \
+	size_t i; \
+\
+	for (i = 0; i < bpp && i < len; i++) \
+		cur[i] += prev[i] >> 1; \
+\
+	for (; i < len; i++) \
+		cur[i] += (cur[i - bpp] + prev[i]) >> 1; \
+} \
+\
+static void unfilter_paeth_##bpp(uint8_t *cur, const uint8_t *prev, size_t len) \
+{ \
+	size_t i; \
+\
+	for (i = 0; i < bpp && i < len; i++) \
+		cur[i] += prev[i]; \
+\
+	for (; i < len; i++) \
+		cur[i] += paeth(cur[i - bpp], prev[i], prev[i - bpp]); \
+}
 
-	prev_scanline = scanline1 + 2;
-	cur_scanline = scanline2 + 2;
+UNFILTER_SCALAR(1)
+UNFILTER_SCALAR(2)
 
-	res = gp_pixmap_alloc(IHDR->width, IHDR->height, GP_PIXEL_RGB888);
-	if (!res) {
-		err = errno;
-		goto err;
-	}
+static inline __attribute__((always_inline))
+v8i16 px_load(const uint8_t *p, unsigned int bpp)
+{
+	v8i16 ret = {};
+	unsigned int i;
 
-	for (y = 0; y < IHDR->height; y++) {
-		if (gp_io_fill(zlib_io, cur_scanline, scanline_len+1)) {
-			GP_DEBUG(1, "Failed to read scanline %u", (unsigned int)y);
-			err = errno;
-			goto err;
-		}
+	for (i = 0; i < bpp; i++)
+		ret[i] = p[i];
+
+	return ret;
+}
 
-		uint8_t filter_method = cur_scanline[0];
+static inline __attribute__((always_inline))
+void px_store(uint8_t *p, v8i16 px, unsigned int bpp)
+{
+	unsigned int i;
 
-		cur_scanline[0] = 0;
+	for (i = 0; i < bpp; i++)
+		p[i] = px[i];
+}
 
-		if (filter_method > FILTER_METHOD_LAST) {
-			GP_DEBUG(1, "Invalid filter method %i", (int)filter_method);
-			err = EINVAL;
-			goto err;
-		}
+static inline v8i16 px_abs(v8i16 v)
+{
+	v8i16 m = v >> 15;
 
-		decode_filter(cur_scanline+1, prev_scanline+1, scanline_len, filter_method, 3);
+	return (v ^ m) - m;
+}
 
-		uint8_t *row = GP_PIXEL_ADDR(res, 0, y);
+static inline v8i16 px_paeth(v8i16 a, v8i16 b, v8i16 c)
+{
+	v8i16 pa = px_abs(b - c);
+	v8i16 pb = px_abs(a - c);
+	v8i16 pc = px_abs(a + b - c - c);
+	v8i16 m;
 
-		for (x = 0; x < IHDR->width; x++) {
-			row[3 * x + 2] = cur_scanline[3 * x + 1];
-			row[3 * x + 1] = cur_scanline[3 * x + 2];
-			row[3 * x + 0] = cur_scanline[3 * x + 3];
-		}
+	m = pb < pa;
+	pa = (pb & m) | (pa & ~m);
+	a = (b & m) | (a & ~m);
 
-		GP_SWAP(cur_scanline, prev_scanline);
+	m = pc < pa;
 
-		if (gp_progress_cb_report(callback, y, res->h, res->w)) {
-			GP_DEBUG(1, "Operation aborted");
-			err = ECANCELED;
-			goto err;
-		}
-	}
+	return (c & m) | (a & ~m);
+}
 
-	*ret = res;
-	return 0;
-err:
-	gp_temp_alloc_free(tmpbuf);
-	gp_pixmap_free(res);
-	return err;
+/* Rows with at least 8 bits per pixel are multiple of bpp long */
+#define UNFILTER_VECTOR(bpp) \
+static void unfilter_sub_##bpp(uint8_t *cur, const uint8_t GP_UNUSED(*prev), \
+                               size_t len) \
+{ \
+	v8i16 a = {}; \
+	size_t i; \
+\
+	for (i = 0; i < len; i += bpp) { \
+		a = (px_load(cur + i, bpp) + a) & 0xff; \
+		px_store(cur + i, a, bpp); \
+	} \
+} \
+\
+static void unfilter_avg_##bpp(uint8_t *cur, const uint8_t *prev, size_t len) \
+{ \
+	v8i16 a = {}; \
+	size_t i; \
+\
+	for (i = 0; i < len; i += bpp) { \
+		v8i16 b = px_load(prev + i, bpp); \
+\
+		a = (px_load(cur + i, bpp) + ((a + b) >> 1)) & 0xff; \
+		px_store(cur + i, a, bpp); \
+	} \
+} \
+\
+static void unfilter_paeth_##bpp(uint8_t *cur, const uint8_t *prev, size_t len) \
+{ \
+	v8i16 a = {}, c = {}; \
+	size_t i; \
+\
+	for (i = 0; i < len; i += bpp) { \
+		v8i16 b = px_load(prev + i, bpp); \
+\
+		a = (px_load(cur + i, bpp) + px_paeth(a, b, c)) & 0xff; \
+		px_store(cur + i, a, bpp); \
+		c = b; \
+	} \
 }
 
-#define CHUNK_ID_TO_INT(c1, c2, c3, c4) (((uint32_t)c1) |       \
-		                         (((uint32_t)c2)<<8) |  \
-		                         (((uint32_t)c2)<<16) | \
-		                         (((uint32_t)c2)<<24))
+UNFILTER_VECTOR(3)
+UNFILTER_VECTOR(4)
+UNFILTER_VECTOR(6)
+UNFILTER_VECTOR(8)
 
-#define CHUNK_ID_HEADER_TO_INT(chunk_header) \
-	CHUNK_ID_TO_INT((chunk_header)->id[0], \
-	                (chunk_header)->id[1], \
-	                (chunk_header)->id[2], \
-	                (chunk_header)->id[3])
+typedef void (*unfilter_fn)(uint8_t *cur, const uint8_t *prev, size_t len);
 
-struct chunk_header {
-	char id[5];
-	uint32_t size;
+struct unfilter {
+	unfilter_fn sub;
+	unfilter_fn avg;
+	unfilter_fn paeth;
 };
 
-static int next_chunk(gp_io *io, struct chunk_header *chunk_header)
+#define UNFILTER(bpp) [bpp] = { \
+	unfilter_sub_##bpp, \
+	unfilter_avg_##bpp, \
+	unfilter_paeth_##bpp \
+}
+
+static const struct unfilter unfilters[] = {
+	UNFILTER(1),
+	UNFILTER(2),
+	UNFILTER(3),
+	UNFILTER(4),
+	UNFILTER(6),
+	UNFILTER(8),
+};
+
+static int unfilter_row(uint8_t filter_method, uint8_t *cur,
+                        const uint8_t *prev, size_t len, unsigned int bpp)
 {
-	const uint16_t chunk[] = {
-		GP_IO_B4,   /* Lenght */
-		GP_IO_BYTE, /* Chunk ID */
-		GP_IO_BYTE,
-		GP_IO_BYTE,
-		GP_IO_BYTE,
-		GP_IO_END
-	};
+	const struct unfilter *unfilter = &unfilters[bpp];
 
-	if (gp_io_readf(io, chunk, &chunk_header->size,
-			&chunk_header->id[0], &chunk_header->id[1],
-	                &chunk_header->id[2], &chunk_header->id[3]) != 5) {
-		GP_DEBUG(1, "Failed to read next chunk!");
+	GP_DEBUG(5, "Scanline filter method %s",
+	         filter_method_name(filter_method));
+
+	switch (filter_method) {
+	case FILTER_METHOD_NONE:
+	break;
+	case FILTER_METHOD_SUB:
+		unfilter->sub(cur, prev, len);
+	break;
+	case FILTER_METHOD_UP:
+		unfilter_up(cur, prev, len);
+	break;
+	case FILTER_METHOD_AVG:
+		unfilter->avg(cur, prev, len);
+	break;
+	case FILTER_METHOD_PAETH:
+		unfilter->paeth(cur, prev, len);
+	break;
+	default:
+		GP_DEBUG(1, "Invalid filter method %i", (int)filter_method);
 		return EINVAL;
 	}
 
 	return 0;
 }
 
-/* Creates a single continous IO stream from PNG IDAT chunks */
+/*
+ * Scanline to pixmap row conversions.
+ *
+ * The 16 and 32 bit pixels are stored as native endian values, 24 bit pixels
+ * are stored byte by byte, see the libpng code above.
+ */
+static inline void put_16(uint8_t *dst, uint16_t val)
+{
+	memcpy(dst, &val, 2);
+}
 
-struct idat_io {
-	struct gp_io out_io;
-	gp_io *in_io;
-	struct chunk_header *chunk_header;
-	size_t chunk_read;
-};
+static inline void put_32(uint8_t *dst, uint32_t val)
+{
+	memcpy(dst, &val, 4);
+}
 
-static ssize_t idat_read(gp_io *self, void *buf, size_t size)
+static inline uint16_t get_b2(const uint8_t *src)
 {
-	struct idat_io *idat_io = GP_CONTAINER_OF(self, struct idat_io, out_io);
-	ssize_t read;
-	size_t avail;
+	return ((uint16_t)src[0]<<8) | src[1];
+}
 
-	avail = idat_io->chunk_header->size - idat_io->chunk_read;
+static inline uint8_t conv_16(struct png_dec *dec, const uint8_t *src)
+{
+	if (dec->lin16)
+		return gp_lin16_to_srgb8(get_b2(src));
 
-	if (avail <= 0) {
-		/* Skip CRC */
-		gp_io_seek(idat_io->in_io, 4, GP_SEEK_CUR);
+	return src[0];
+}
 
-		int err = next_chunk(idat_io->in_io, idat_io->chunk_header);
-		if (err) {
-			errno = err;
-			return -1;
-		}
+static void conv_g16(struct png_dec GP_UNUSED(*dec), const uint8_t *src,
+                     uint8_t *dst, uint32_t w)
+{
+	uint32_t x;
 
-		switch (CHUNK_ID_HEADER_TO_INT(idat_io->chunk_header)) {
-		case CHUNK_ID_TO_INT('I', 'D', 'A', 'T'):
-			idat_io->chunk_read = 0;
-			avail = idat_io->chunk_header->size - idat_io->chunk_read;
-		break;
-		default:
-			return 0;
-		}
+	for (x = 0; x < w; x++)
+		put_16(dst + 2 * x, get_b2(src + 2 * x));
+}
+
+static void conv_ga88(struct png_dec GP_UNUSED(*dec), const uint8_t *src,
+                      uint8_t *dst, uint32_t w)
+{
+	uint32_t x;
+
+	for (x = 0; x < w; x++)
+		put_16(dst + 2 * x, src[2 * x] | (src[2 * x + 1]<<8));
+}
+
+static void conv_ga1616(struct png_dec GP_UNUSED(*dec), const uint8_t *src,
+                        uint8_t *dst, uint32_t w)
+{
+	uint32_t x;
+
+	for (x = 0; x < w; x++)
+		put_16(dst + 2 * x, src[4 * x] | (src[4 * x + 2]<<8));
+}
+
+static void conv_rgb888(struct png_dec GP_UNUSED(*dec), const uint8_t *src,
+                        uint8_t *dst, uint32_t w)
+{
+	uint32_t x;
+
+	for (x = 0; x < w; x++) {
+		dst[3 * x + 0] = src[3 * x + 2];
+		dst[3 * x + 1] = src[3 * x + 1];
+		dst[3 * x + 2] = src[3 * x + 0];
 	}
+}
 
-	read = gp_io_read(idat_io->in_io, buf, GP_MIN(size, avail));
-	if (read > 0)
-		idat_io->chunk_read += read;
+static void conv_rgb161616(struct png_dec *dec, const uint8_t *src,
+                           uint8_t *dst, uint32_t w)
+{
+	uint32_t x;
 
-	return read;
+	for (x = 0; x < w; x++) {
+		dst[3 * x + 0] = conv_16(dec, src + 6 * x + 4);
+		dst[3 * x + 1] = conv_16(dec, src + 6 * x + 2);
+		dst[3 * x + 2] = conv_16(dec, src + 6 * x + 0);
+	}
 }
 
-static off_t idat_seek(gp_io *self, off_t off, enum gp_seek_whence whence)
+static void conv_rgba8888(struct png_dec GP_UNUSED(*dec), const uint8_t *src,
+                          uint8_t *dst, uint32_t w)
 {
-	(void) self;
+	uint32_t x;
 
-	GP_DEBUG(1, "Dummy seek called off=%lu whence=%i", (long unsigned)off, whence);
+	for (x = 0; x < w; x++) {
+		const uint8_t *s = src + 4 * x;
 
-	return 0;
+		put_32(dst + 4 * x, ((uint32_t)s[0]<<24) | ((uint32_t)s[1]<<16) |
+		                    ((uint32_t)s[2]<<8) | s[3]);
+	}
 }
 
-static int load_image(gp_io *io, struct IHDR_chunk *IHDR,
-                      struct chunk_header *chunk_header,
-                      gp_pixmap **img, gp_progress_cb *callback)
+static void conv_rgba16161616(struct png_dec *dec, const uint8_t *src,
+                              uint8_t *dst, uint32_t w)
 {
-	gp_io *zlib_io;
-	uint8_t zlib_comp_method;
-	uint8_t flags;
-	int err = 0;
+	uint32_t x;
 
-	zlib_comp_method = gp_io_getb(io);
-	flags = gp_io_getb(io);
+	for (x = 0; x < w; x++) {
+		const uint8_t *s = src + 8 * x;
 
-	GP_DEBUG(1, "Zlib comp method %u flags %u", zlib_comp_method, flags);
+		put_32(dst + 4 * x, ((uint32_t)conv_16(dec, s)<<24) |
+		                    ((uint32_t)conv_16(dec, s + 2)<<16) |
+		                    ((uint32_t)conv_16(dec, s + 4)<<8) | s[6]);
+	}
+}
 
-	struct idat_io idat_io = {
-		.out_io = {
-			.read = idat_read,
-			.seek = idat_seek,
-		},
-		.in_io = io,
-		.chunk_header = chunk_header,
-		.chunk_read = 2,
-	};
+static inline uint8_t get_idx(const uint8_t *src, uint32_t x, uint8_t depth)
+{
+	switch (depth) {
+	case 1:
+		return (src[x>>3] >> (7 - (x & 7))) & 0x01;
+	case 2:
+		return (src[x>>2] >> (2 * (3 - (x & 3)))) & 0x03;
+	case 4:
+		return (src[x>>1] >> (4 * (1 - (x & 1)))) & 0x0f;
+	default:
+		return src[x];
+	}
+}
 
-	zlib_io = gp_io_zlib(&idat_io.out_io, 0);
-	if (!zlib_io)
-		return errno;
+static void conv_pal_rgb888(struct png_dec *dec, const uint8_t *src,
+                            uint8_t *dst, uint32_t w)
+{
+	uint8_t depth = dec->IHDR.bit_depth;
+	uint32_t x;
 
-	switch (IHDR->color_type) {
-	case COLOR_MASK_COLOR:
-		err = load_rgb888_image(zlib_io, IHDR, img, callback);
-		if (err)
-			goto ret;
-	break;
+	for (x = 0; x < w; x++) {
+		gp_pixel p = dec->palette[get_idx(src, x, depth)];
+
+		dst[3 * x + 0] = p>>8;
+		dst[3 * x + 1] = p>>16;
+		dst[3 * x + 2] = p>>24;
 	}
+}
 
-ret:
-	gp_io_close(zlib_io);
+static void conv_pal_rgba8888(struct png_dec *dec, const uint8_t *src,
+                              uint8_t *dst, uint32_t w)
+{
+	uint8_t depth = dec->IHDR.bit_depth;
+	uint32_t x;
 
-	return err;
+	for (x = 0; x < w; x++)
+		put_32(dst + 4 * x, dec->palette[get_idx(src, x, depth)]);
 }
 
-int gp_read_png_ex(gp_io *io, gp_pixmap **img,
-                   gp_storage GP_UNUSED(*storage),
-                   gp_progress_cb *callback)
+static int check_format(struct png_dec *dec)
 {
-	struct IHDR_chunk IHDR;
-	struct chunk_header chunk_header = {};
-	int ret, err;
+	uint8_t depth = dec->IHDR.bit_depth;
+	unsigned int channels;
 
-	const uint16_t header[] = {
-		0x89,
-		'P',
-		'N',
-		'G',
-		'\r',
-		'\n',
-		0x1a,
+	switch (dec->IHDR.color_type) {
+	case 0:
+		channels = 1;
+
+		switch (depth) {
+		case 1:
+			dec->pixel_type = GP_PIXEL_G1;
+		break;
+		case 2:
+			dec->pixel_type = GP_PIXEL_G2;
+		break;
+		case 4:
+			dec->pixel_type = GP_PIXEL_G4;
+		break;
+		case 8:
+			dec->pixel_type = GP_PIXEL_G8;
+		break;
+#ifdef GP_PIXEL_G16
+		case 16:
+			dec->pixel_type = GP_PIXEL_G16;
+			dec->conv = conv_g16;
+		break;
+#endif
+		default:
+			goto invalid;
+		}
+	break;
+	case COLOR_MASK_COLOR:
+		channels = 3;
+		dec->pixel_type = GP_PIXEL_RGB888;
+
+		switch (depth) {
+		case 8:
+			dec->conv = conv_rgb888;
+		break;
+		case 16:
+			dec->conv = conv_rgb161616;
+		break;
+		default:
+			goto invalid;
+		}
+	break;
+	case COLOR_MASK_PALETTE | COLOR_MASK_COLOR:
+		channels = 1;
+
+		if (depth != 1 && depth != 2 && depth != 4 && depth != 8)
+			goto invalid;
+
+		/* Set once we know if there is a tRNS chunk */
+		dec->pixel_type = GP_PIXEL_UNKNOWN;
+	break;
+	case COLOR_MASK_ALPHA:
+		channels = 2;
+		dec->pixel_type = GP_PIXEL_GA88;
+
+		switch (depth) {
+		case 8:
+			dec->conv = conv_ga88;
+		break;
+		case 16:
+			dec->conv = conv_ga1616;
+		break;
+		default:
+			goto invalid;
+		}
+	break;
+	case COLOR_MASK_COLOR | COLOR_MASK_ALPHA:
+		channels = 4;
+		dec->pixel_type = GP_PIXEL_RGBA8888;
+
+		switch (depth) {
+		case 8:
+			dec->conv = conv_rgba8888;
+		break;
+		case 16:
+			dec->conv = conv_rgba16161616;
+		break;
+		default:
+			goto invalid;
+		}
+	break;
+	default:
+		goto invalid;
+	}
+
+	dec->bpp = channels * depth;
+	dec->filter_bpp = GP_MAX(1u, dec->bpp / 8);
+
+	return 0;
+invalid:
+	GP_DEBUG(1, "Invalid or unsupported color type %u bit depth %u",
+	         (unsigned int)dec->IHDR.color_type, (unsigned int)depth);
+	return ENOSYS;
+}
+
+static const struct adam7_pass {
+	uint8_t x0, y0, dx, dy;
+} adam7_passes[] = {
+	{0, 0, 8, 8},
+	{4, 0, 8, 8},
+	{0, 4, 4, 8},
+	{2, 0, 4, 4},
+	{0, 2, 2, 4},
+	{1, 0, 2, 2},
+	{0, 1, 1, 2},
+};
+
+static const struct adam7_pass no_interlace = {0, 0, 1, 1};
+
+static uint32_t pass_size(uint32_t size, uint8_t start, uint8_t step)
+{
+	if (size <= start)
+		return 0;
+
+	return (size - start + step - 1) / step;
+}
+
+static size_t row_bytes(struct png_dec *dec, uint32_t w)
+{
+	return ((size_t)w * dec->bpp + 7) / 8;
+}
+
+static int read_row(gp_io *zlib_io, uint8_t *cur, const uint8_t *prev,
+                    size_t len, unsigned int bpp)
+{
+	uint8_t filter_method;
+
+	if (gp_io_fill(zlib_io, &filter_method, 1) ||
+	    gp_io_fill(zlib_io, cur, len)) {
+		GP_DEBUG(1, "Failed to read scanline");
+		return EIO;
+	}
+
+	return unfilter_row(filter_method, cur, prev, len, bpp);
+}
+
+/*
+ * The scanlines of formats without conversion are read and unfiltered right
+ * in the pixmap, the previous pixmap row is the previous scanline.
+ */
+static int decode_direct(gp_io *zlib_io, struct png_dec *dec, gp_pixmap *res,
+                         const uint8_t *zero, gp_progress_cb *callback)
+{
+	size_t len = row_bytes(dec, res->w);
+	const uint8_t *prev = zero;
+	uint32_t y;
+	int err;
+
+	for (y = 0; y < res->h; y++) {
+		uint8_t *row = GP_PIXEL_ADDR(res, 0, y);
+
+		if ((err = read_row(zlib_io, row, prev, len, dec->filter_bpp)))
+			return err;
+
+		prev = row;
+
+		if (gp_progress_cb_report(callback, y, res->h, res->w)) {
+			GP_DEBUG(1, "Operation aborted");
+			return ECANCELED;
+		}
+	}
+
+	return 0;
+}
+
+static int decode_passes(gp_io *zlib_io, struct png_dec *dec, gp_pixmap *res,
+                         uint8_t *buf, const uint8_t *zero,
+                         gp_progress_cb *callback)
+{
+	int interlaced = dec->IHDR.interlace_method == INTERLACE_ADAM7;
+	const struct adam7_pass *passes = interlaced ? adam7_passes : &no_interlace;
+	unsigned int p, pass_cnt = interlaced ? GP_ARRAY_SIZE(adam7_passes) : 1;
+	size_t buf_len = row_bytes(dec, res->w);
+	uint8_t *cur = buf, *prev = buf + buf_len;
+	gp_pixmap *tmp = NULL;
+	uint32_t rows = 0, rows_done = 0;
+	int err = 0;
+
+	for (p = 0; p < pass_cnt; p++)
+		rows += pass_size(res->h, passes[p].y0, passes[p].dy);
+
+	if (interlaced) {
+		tmp = gp_pixmap_alloc(res->w, 1, res->pixel_type);
+		if (!tmp)
+			return ENOMEM;
+	}
+
+	for (p = 0; p < pass_cnt; p++) {
+		const struct adam7_pass *pass = &passes[p];
+		uint32_t w = pass_size(res->w, pass->x0, pass->dx);
+		uint32_t h = pass_size(res->h, pass->y0, pass->dy);
+		size_t len = row_bytes(dec, w);
+		const uint8_t *prev_row = zero;
+		uint32_t x, y;
+
+		/* Empty passes have no scanlines at all */
+		if (!w || !h)
+			continue;
+
+		GP_DEBUG(3, "Pass %u size %ux%u", p, w, h);
+
+		for (y = 0; y < h; y++) {
+			uint32_t dst_y = pass->y0 + y * pass->dy;
+
+			err = read_row(zlib_io, cur, prev_row, len, dec->filter_bpp);
+			if (err)
+				goto exit;
+
+			if (!interlaced) {
+				dec->conv(dec, cur, GP_PIXEL_ADDR(res, 0, dst_y), w);
+			} else {
+				uint8_t *row = GP_PIXEL_ADDR(tmp, 0, 0);
+
+				if (dec->conv)
+					dec->conv(dec, cur, row, w);
+				else
+					memcpy(row, cur, len);
+
+				for (x = 0; x < w; x++) {
+					gp_putpixel_raw(res, pass->x0 + x * pass->dx, dst_y,
+					                gp_getpixel_raw(tmp, x, 0));
+				}
+			}
+
+			prev_row = cur;
+			GP_SWAP(cur, prev);
+
+			if (gp_progress_cb_report(callback, rows_done++, rows, res->w)) {
+				GP_DEBUG(1, "Operation aborted");
+				err = ECANCELED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(tmp);
+	return err;
+}
+
+static int decode_image(gp_io *zlib_io, struct png_dec *dec,
+                        uint32_t w, uint32_t h, gp_pixmap **img,
+                        gp_progress_cb *callback)
+{
+	size_t len;
+	uint8_t *buf;
+	gp_pixmap *res;
+	int err;
+
+	if (dec->IHDR.color_type == (COLOR_MASK_PALETTE | COLOR_MASK_COLOR)) {
+		if (!dec->palette_size) {
+			GP_DEBUG(1, "Missing PLTE chunk");
+			return EINVAL;
+		}
+
+		if (dec->has_trns) {
+			dec->pixel_type = GP_PIXEL_RGBA8888;
+			dec->conv = conv_pal_rgba8888;
+		} else {
+			dec->pixel_type = GP_PIXEL_RGB888;
+			dec->conv = conv_pal_rgb888;
+		}
+	}
+
+	res = gp_pixmap_alloc(w, h, dec->pixel_type);
+	if (!res)
+		return ENOMEM;
+
+	if (dec->has_srgb)
+		gp_pixmap_srgb_set(res);
+	else if (dec->has_gamma)
+		gp_pixmap_gamma_set(res, 100000.00 / dec->gamma);
+
+	/* Linear 16 bit samples are converted to sRGB, see the libpng code */
+	if (dec->IHDR.bit_depth == 16 && dec->IHDR.color_type == COLOR_MASK_COLOR &&
+	    !dec->has_srgb && !dec->has_gamma) {
+		dec->lin16 = 1;
+		gp_pixmap_srgb_set(res);
+	}
+
+	/* Two scanlines and a zeroed previous scanline for the first row */
+	len = row_bytes(dec, res->w);
+	buf = calloc(3, len);
+	if (!buf) {
+		err = ENOMEM;
+		goto err;
+	}
+
+	if (!dec->conv && dec->IHDR.interlace_method == INTERLACE_NONE)
+		err = decode_direct(zlib_io, dec, res, buf + 2 * len, callback);
+	else
+		err = decode_passes(zlib_io, dec, res, buf, buf + 2 * len, callback);
+
+	free(buf);
+
+	if (err)
+		goto err;
+
+	*img = res;
+	return 0;
+err:
+	gp_pixmap_free(res);
+	return err;
+}
+
+#define CHUNK_ID_TO_INT(c1, c2, c3, c4) (((uint32_t)c1) |       \
+		                         (((uint32_t)c2)<<8) |  \
+		                         (((uint32_t)c3)<<16) | \
+		                         (((uint32_t)c4)<<24))
+
+#define CHUNK_ID_HEADER_TO_INT(chunk_header) \
+	CHUNK_ID_TO_INT((chunk_header)->id[0], \
+	                (chunk_header)->id[1], \
+	                (chunk_header)->id[2], \
+	                (chunk_header)->id[3])
+
+struct chunk_header {
+	char id[5];
+	uint32_t size;
+};
+
+static int next_chunk(gp_io *io, struct chunk_header *chunk_header)
+{
+	const uint16_t chunk[] = {
+		GP_IO_B4,   /* Lenght */
+		GP_IO_BYTE, /* Chunk ID */
+		GP_IO_BYTE,
+		GP_IO_BYTE,
+		GP_IO_BYTE,
+		GP_IO_END
+	};
+
+	if (gp_io_readf(io, chunk, &chunk_header->size,
+			&chunk_header->id[0], &chunk_header->id[1],
+	                &chunk_header->id[2], &chunk_header->id[3]) != 5) {
+		GP_DEBUG(1, "Failed to read next chunk!");
+		return EINVAL;
+	}
+
+	return 0;
+}
+
+/*
+ * Creates a single continous IO stream from PNG IDAT or APNG fdAT chunks, the
+ * fdAT chunks start with a sequence number that is skipped.
+ */
+
+struct idat_io {
+	struct gp_io out_io;
+	gp_io *in_io;
+	struct chunk_header *chunk_header;
+	uint32_t chunk_id;
+	size_t chunk_read;
+	/* Set when we have read a header of chunk that follows the IDAT chunks */
+	int end;
+};
+
+static ssize_t idat_read(gp_io *self, void *buf, size_t size)
+{
+	struct idat_io *idat_io = GP_CONTAINER_OF(self, struct idat_io, out_io);
+	ssize_t read;
+	size_t avail;
+
+	avail = idat_io->chunk_header->size - idat_io->chunk_read;
+
+	while (!avail) {
+		if (idat_io->end)
+			return 0;
+
+		/* Skip CRC */
+		gp_io_seek(idat_io->in_io, 4, GP_SEEK_CUR);
+
+		int err = next_chunk(idat_io->in_io, idat_io->chunk_header);
+		if (err) {
+			errno = err;
+			return -1;
+		}
+
+		if (CHUNK_ID_HEADER_TO_INT(idat_io->chunk_header) != idat_io->chunk_id) {
+			idat_io->end = 1;
+			return 0;
+		}
+
+		idat_io->chunk_read = 0;
+
+		if (idat_io->chunk_id == CHUNK_ID_TO_INT('f', 'd', 'A', 'T')) {
+			if (idat_io->chunk_header->size < 4 ||
+			    gp_io_seek(idat_io->in_io, 4, GP_SEEK_CUR) == (off_t)-1) {
+				errno = EINVAL;
+				return -1;
+			}
+			idat_io->chunk_read = 4;
+		}
+
+		avail = idat_io->chunk_header->size - idat_io->chunk_read;
+	}
+
+	read = gp_io_read(idat_io->in_io, buf, GP_MIN(size, avail));
+	if (read > 0)
+		idat_io->chunk_read += read;
+
+	return read;
+}
+
+static off_t idat_seek(gp_io *self, off_t off, enum gp_seek_whence whence)
+{
+	(void) self;
+
+	GP_DEBUG(1, "Dummy seek called off=%lu whence=%i", (long unsigned)off, whence);
+
+	return 0;
+}
+
+/*
+ * Decodes the w x h image from the IDAT or fdAT chunks, the sequence number of
+ * the first fdAT chunk has to be read already. On return the io is either at
+ * the CRC of the last chunk or, if *next is set, chunk_header holds header of
+ * the chunk that follows the image data.
+ */
+static int load_image(gp_io *io, struct png_dec *dec,
+                      struct chunk_header *chunk_header,
+                      uint32_t w, uint32_t h,
+                      gp_pixmap **img, gp_progress_cb *callback, int *next)
+{
+	uint32_t chunk_id = CHUNK_ID_HEADER_TO_INT(chunk_header);
+	int fdat = chunk_id == CHUNK_ID_TO_INT('f', 'd', 'A', 'T');
+	gp_io *zlib_io;
+	uint8_t zlib_comp_method;
+	uint8_t flags;
+	int err = 0;
+
+	zlib_comp_method = gp_io_getb(io);
+	flags = gp_io_getb(io);
+
+	GP_DEBUG(1, "Zlib comp method %u flags %u", zlib_comp_method, flags);
+
+	struct idat_io idat_io = {
+		.out_io = {
+			.read = idat_read,
+			.seek = idat_seek,
+		},
+		.in_io = io,
+		.chunk_header = chunk_header,
+		.chunk_id = chunk_id,
+		.chunk_read = fdat ? 6 : 2,
+	};
+
+	zlib_io = gp_io_zlib(&idat_io.out_io, 0);
+	if (!zlib_io)
+		return errno;
+
+	err = decode_image(zlib_io, dec, w, h, img, callback);
+
+	gp_io_close(zlib_io);
+
+	if (err)
+		return err;
+
+	if (idat_io.end) {
+		*next = 1;
+		return 0;
+	}
+
+	/* Skip the rest of the chunk, i.e. zlib checksum */
+	if (gp_io_seek(io, chunk_header->size - idat_io.chunk_read, GP_SEEK_CUR) == (off_t)-1)
+		return EIO;
+
+	return 0;
+}
+
+static int read_plte(gp_io *io, struct png_dec *dec, uint32_t size)
+{
+	uint8_t buf[256 * 3];
+	unsigned int i;
+
+	if (size % 3 || size > sizeof(buf) || !size) {
+		GP_DEBUG(1, "Invalid PLTE chunk size %u", (unsigned int)size);
+		return EINVAL;
+	}
+
+	if (gp_io_fill(io, buf, size))
+		return EIO;
+
+	dec->palette_size = size / 3;
+
+	for (i = 0; i < dec->palette_size; i++) {
+		dec->palette[i] = GP_PIXEL_CREATE_RGB888(buf[3*i], buf[3*i+1], buf[3*i+2]);
+		/* Opaque unless there is tRNS */
+		dec->palette[i] = (dec->palette[i]<<8) | 0xff;
+	}
+
+	for (; i < 256; i++)
+		dec->palette[i] = 0xff;
+
+	return 0;
+}
+
+static int read_trns(gp_io *io, struct png_dec *dec, uint32_t size)
+{
+	uint8_t buf[256];
+	unsigned int i;
+
+	/* Transparency for non-palette images is ignored, as in libpng code */
+	if (dec->IHDR.color_type != (COLOR_MASK_PALETTE | COLOR_MASK_COLOR))
+		return gp_io_seek(io, size, GP_SEEK_CUR) == (off_t)-1 ? EIO : 0;
+
+	if (size > dec->palette_size) {
+		GP_DEBUG(1, "Invalid tRNS chunk size %u", (unsigned int)size);
+		return EINVAL;
+	}
+
+	if (gp_io_fill(io, buf, size))
+		return EIO;
+
+	for (i = 0; i < size; i++)
+		dec->palette[i] = (dec->palette[i] & ~0xffu) | buf[i];
+
+	dec->has_trns = 1;
+
+	return 0;
+}
+
+static int read_header(gp_io *io, struct png_dec *dec)
+{
+	struct IHDR_chunk *IHDR = &dec->IHDR;
+	int ret;
+
+	const uint16_t header[] = {
+		0x89,
+		'P',
+		'N',
+		'G',
+		'\r',
+		'\n',
+		0x1a,
 		'\n',
 		GP_IO_B4,
 		'I',
@@ -1011,72 +1748,110 @@ int gp_read_png_ex(gp_io *io, gp_pixmap **img,
 		GP_IO_END,
 	};
 
-	ret = gp_io_readf(io, header, &IHDR.size, &IHDR.width, &IHDR.height,
-	                  &IHDR.bit_depth, &IHDR.color_type,
-	                  &IHDR.compress_method,
-	                  &IHDR.filter_method,
-			  &IHDR.interlace_method);
+	ret = gp_io_readf(io, header, &IHDR->size, &IHDR->width, &IHDR->height,
+	                  &IHDR->bit_depth, &IHDR->color_type,
+	                  &IHDR->compress_method,
+	                  &IHDR->filter_method,
+			  &IHDR->interlace_method);
 
 	if (ret != GP_ARRAY_SIZE(header) - 1) {
 		GP_DEBUG(1, "Failed to read IHDR chunk");
-		errno = EIO;
-		return 1;
+		return EIO;
 	}
 
 	GP_DEBUG(2, "Interlace=%s%s %s PNG%s size %ux%u depth %i",
-	         interlace_type_name(IHDR.interlace_method),
-	         IHDR.color_type & COLOR_MASK_PALETTE ? " pallete" : "",
-	         IHDR.color_type & COLOR_MASK_COLOR ? "color" : "gray",
-		 IHDR.color_type & COLOR_MASK_ALPHA ? " with alpha channel" : "",
-		 (unsigned int)IHDR.width, (unsigned int)IHDR.height, IHDR.bit_depth);
-
-	switch (IHDR.compress_method) {
+	         interlace_type_name(IHDR->interlace_method),
+	         IHDR->color_type & COLOR_MASK_PALETTE ? " pallete" : "",
+	         IHDR->color_type & COLOR_MASK_COLOR ? "color" : "gray",
+		 IHDR->color_type & COLOR_MASK_ALPHA ? " with alpha channel" : "",
+		 (unsigned int)IHDR->width, (unsigned int)IHDR->height,
+		 IHDR->bit_depth);
+
+	switch (IHDR->compress_method) {
 	case COMP_METHOD_ZLIB:
 	break;
 	default:
 		GP_DEBUG(1, "Unknown/invalid compression method %u",
-		         (unsigned int)IHDR.compress_method);
-		err = EINVAL;
-		goto err;
+		         (unsigned int)IHDR->compress_method);
+		return EINVAL;
 	}
 
-	switch (IHDR.interlace_method) {
+	switch (IHDR->interlace_method) {
 	case INTERLACE_NONE:
-	break;
 	case INTERLACE_ADAM7:
-		GP_DEBUG(1, "Adam7 interalce not supported");
-		err = ENOSYS;
-		goto err;
 	break;
 	default:
 		GP_DEBUG(1, "Unknown/invalid interalce method");
-		err = EINVAL;
-		goto err;
-	break;
+		return EINVAL;
 	}
 
-	if (IHDR.filter_method != 0) {
+	if (IHDR->filter_method != 0) {
 		GP_DEBUG(1, "Unknown/invalid filter method");
-		err = EINVAL;
-		goto err;
+		return EINVAL;
 	}
 
-	switch (IHDR.color_type) {
-	case COLOR_MASK_COLOR:
-	break;
+	if (!IHDR->width || !IHDR->height) {
+		GP_DEBUG(1, "Invalid image size");
+		return EINVAL;
+	}
+
+	return check_format(dec);
+}
+
+/*
+ * Reads chunks that describe the image data, unknown chunks are skipped.
+ */
+static int read_common_chunk(gp_io *io, struct png_dec *dec,
+                             struct chunk_header *chunk_header)
+{
+	switch (CHUNK_ID_HEADER_TO_INT(chunk_header)) {
+	case CHUNK_ID_TO_INT('P', 'L', 'T', 'E'):
+		return read_plte(io, dec, chunk_header->size);
+	case CHUNK_ID_TO_INT('t', 'R', 'N', 'S'):
+		return read_trns(io, dec, chunk_header->size);
+	case CHUNK_ID_TO_INT('s', 'R', 'G', 'B'):
+		dec->has_srgb = 1;
+		gp_io_seek(io, chunk_header->size, GP_SEEK_CUR);
+		return 0;
+	case CHUNK_ID_TO_INT('g', 'A', 'M', 'A'):
+		if (chunk_header->size != 4 || gp_io_read_b4(io, &dec->gamma))
+			return EINVAL;
+		dec->has_gamma = !!dec->gamma;
+		return 0;
 	default:
-		GP_DEBUG(1, "Unsupported color type");
-		err = ENOSYS;
-		goto err;
+		GP_DEBUG(1, "Skipping chunk '%s'", chunk_header->id);
+		gp_io_seek(io, chunk_header->size, GP_SEEK_CUR);
+		return 0;
 	}
+}
+
+int gp_read_png_int_ex(gp_io *io, gp_pixmap **img,
+                       gp_storage GP_UNUSED(*storage),
+                       gp_progress_cb *callback)
+{
+	struct png_dec dec = {};
+	struct IHDR_chunk *IHDR = &dec.IHDR;
+	struct chunk_header chunk_header = {};
+	gp_pixmap *res = NULL;
+	int err, next = 0;
+
+	if ((err = read_header(io, &dec)))
+		goto err;
+
+	if (!img)
+		return 0;
 
 	/* skip CRC and get right to the next chunk */
-	gp_io_seek(io, IHDR.size - 13 + 4, GP_SEEK_CUR);
+	gp_io_seek(io, IHDR->size - 13 + 4, GP_SEEK_CUR);
 
 	for (;;) {
-		err = next_chunk(io, &chunk_header);
-		if (err)
-			goto err;
+		if (!next) {
+			err = next_chunk(io, &chunk_header);
+			if (err)
+				goto err;
+		}
+
+		next = 0;
 
 		GP_DEBUG(3, "Have chunk '%s' size %u",
 		         chunk_header.id, (unsigned int)chunk_header.size);
@@ -1085,41 +1860,373 @@ int gp_read_png_ex(gp_io *io, gp_pixmap **img,
 		case CHUNK_ID_TO_INT('I', 'E', 'N', 'D'):
 			goto ret;
 		case CHUNK_ID_TO_INT('I', 'D', 'A', 'T'):
-			err = load_image(io, &IHDR, &chunk_header, img, callback);
-			if (err)
-				goto err;
+			/* Trailing IDAT chunks after the image data */
+			if (res) {
+				gp_io_seek(io, chunk_header.size, GP_SEEK_CUR);
+				break;
+			}
+
+			err = load_image(io, &dec, &chunk_header, IHDR->width,
+			                 IHDR->height, &res, callback, &next);
 		break;
 		default:
-			GP_DEBUG(1, "Skipping chunk '%s'", chunk_header.id);
-			gp_io_seek(io, chunk_header.size, GP_SEEK_CUR);
+			err = read_common_chunk(io, &dec, &chunk_header);
 		}
 
+		if (err)
+			goto err;
+
+		/* Have header of the chunk after IDAT, CRC was skipped already */
+		if (next)
+			continue;
+
 		/* Skip CRC */
 		gp_io_seek(io, 4, GP_SEEK_CUR);
 	}
 
 ret:
-	if (*img)
+	if (res) {
+		gp_progress_cb_done(callback);
+		*img = res;
 		return 0;
+	}
 
-	err = ENOSYS;
+	GP_DEBUG(1, "No IDAT chunk found");
+	err = EINVAL;
 err:
+	gp_pixmap_free(res);
 	errno = err;
 	return 1;
 }
 
-int gp_write_png(const gp_pixmap GP_UNUSED(*src), gp_io GP_UNUSED(*io),
-                gp_progress_cb GP_UNUSED(*callback))
+/*
+ * APNG animation, frames are described by fcTL chunks and the frame data are
+ * stored in fdAT chunks. The IDAT image is the first frame only if preceded by
+ * fcTL. Still PNG images are animations with a single frame.
+ */
+
+enum apng_dispose_op {
+	APNG_DISPOSE_OP_NONE = 0,
+	APNG_DISPOSE_OP_BACKGROUND = 1,
+	APNG_DISPOSE_OP_PREVIOUS = 2,
+};
+
+enum apng_blend_op {
+	APNG_BLEND_OP_SOURCE = 0,
+	APNG_BLEND_OP_OVER = 1,
+};
+
+struct fctl_chunk {
+	uint32_t seq;
+	uint32_t w;
+	uint32_t h;
+	uint32_t x;
+	uint32_t y;
+	uint16_t delay_num;
+	uint16_t delay_den;
+	uint8_t dispose_op;
+	uint8_t blend_op;
+};
+
+struct apng {
+	gp_io *io;
+	struct png_dec dec;
+	/* Offset of the first chunk after IHDR */
+	off_t start;
+	/* Set if there was acTL chunk */
+	int animated;
+
+	struct chunk_header chunk_header;
+	/* chunk_header holds the chunk that follows image data */
+	int next;
+	int end;
+};
+
+static int read_actl(gp_io *io, uint32_t size, uint32_t *frames, uint32_t *plays)
 {
-	errno = ENOSYS;
+	const uint16_t actl[] = {
+		GP_IO_B4, /* Number of frames */
+		GP_IO_B4, /* Number of plays */
+		GP_IO_END
+	};
+
+	if (size != 8 || gp_io_readf(io, actl, frames, plays) != 2) {
+		GP_DEBUG(1, "Invalid acTL chunk");
+		return EINVAL;
+	}
+
+	return 0;
+}
+
+static int read_fctl(gp_io *io, struct IHDR_chunk *IHDR, uint32_t size,
+                     struct fctl_chunk *fctl)
+{
+	const uint16_t fctl_chunk[] = {
+		GP_IO_B4, /* Sequence number */
+		GP_IO_B4, /* Width */
+		GP_IO_B4, /* Height */
+		GP_IO_B4, /* X offset */
+		GP_IO_B4, /* Y offset */
+		GP_IO_B2, /* Delay numerator */
+		GP_IO_B2, /* Delay denominator */
+		GP_IO_BYTE, /* Dispose op */
+		GP_IO_BYTE, /* Blend op */
+		GP_IO_END
+	};
+
+	if (size != 26 || gp_io_readf(io, fctl_chunk, &fctl->seq, &fctl->w,
+	                              &fctl->h, &fctl->x, &fctl->y,
+	                              &fctl->delay_num, &fctl->delay_den,
+	                              &fctl->dispose_op, &fctl->blend_op) != 9) {
+		GP_DEBUG(1, "Failed to read fcTL chunk");
+		return EINVAL;
+	}
+
+	GP_DEBUG(2, "Frame %"PRIu32" %"PRIu32"x%"PRIu32"-%"PRIu32"x%"PRIu32
+	         " delay %u/%u dispose %u blend %u", fctl->seq,
+	         fctl->x, fctl->y, fctl->w, fctl->h, fctl->delay_num,
+	         fctl->delay_den, fctl->dispose_op, fctl->blend_op);
+
+	if (!fctl->w || !fctl->h ||
+	    fctl->x > IHDR->width || fctl->w > IHDR->width - fctl->x ||
+	    fctl->y > IHDR->height || fctl->h > IHDR->height - fctl->y) {
+		GP_DEBUG(1, "Frame outside of the image");
+		return EINVAL;
+	}
+
+	if (fctl->dispose_op > APNG_DISPOSE_OP_PREVIOUS ||
+	    fctl->blend_op > APNG_BLEND_OP_OVER) {
+		GP_DEBUG(1, "Invalid dispose or blend op");
+		return EINVAL;
+	}
+
+	return 0;
+}
+
+static int apng_compose(gp_anim *self, struct fctl_chunk *fctl,
+                        gp_pixmap *img, gp_anim_frame *frame)
+{
+	enum gp_anim_dispose dispose = GP_ANIM_DISPOSE_NONE;
+	enum gp_anim_blend blend = GP_ANIM_BLEND_SRC;
+	unsigned int den = fctl->delay_den ? fctl->delay_den : 100;
+
+	switch (fctl->dispose_op) {
+	case APNG_DISPOSE_OP_BACKGROUND:
+		dispose = GP_ANIM_DISPOSE_BG;
+	break;
+	case APNG_DISPOSE_OP_PREVIOUS:
+		/* Previous for the first frame is treated as background */
+		dispose = self->cur_frame ? GP_ANIM_DISPOSE_PREV : GP_ANIM_DISPOSE_BG;
+	break;
+	}
+
+	if (fctl->blend_op == APNG_BLEND_OP_OVER)
+		blend = GP_ANIM_BLEND_OVER;
+
+	frame->delay_ms = 1000u * fctl->delay_num / den;
+
+	return gp_anim_compose(self, img, fctl->x, fctl->y, blend, dispose, frame);
+}
+
+static int apng_next(gp_anim *self, gp_anim_frame *frame,
+                     gp_progress_cb *callback)
+{
+	struct apng *apng = GP_ANIM_PRIV(self);
+	struct chunk_header *chunk_header = &apng->chunk_header;
+	struct png_dec *dec = &apng->dec;
+	struct fctl_chunk fctl;
+	gp_io *io = apng->io;
+	gp_pixmap *img = NULL;
+	int err, have_fctl = 0;
+
+	if (apng->end) {
+		errno = ENOENT;
+		return 1;
+	}
+
+	for (;;) {
+		if (!apng->next) {
+			err = next_chunk(io, chunk_header);
+			if (err)
+				goto err;
+		}
+
+		apng->next = 0;
+
+		GP_DEBUG(3, "Have chunk '%s' size %u",
+		         chunk_header->id, (unsigned int)chunk_header->size);
+
+		switch (CHUNK_ID_HEADER_TO_INT(chunk_header)) {
+		case CHUNK_ID_TO_INT('I', 'E', 'N', 'D'):
+			apng->end = 1;
+			errno = ENOENT;
+			return 1;
+		case CHUNK_ID_TO_INT('f', 'c', 'T', 'L'):
+			err = read_fctl(io, &dec->IHDR, chunk_header->size, &fctl);
+			have_fctl = 1;
+		break;
+		case CHUNK_ID_TO_INT('I', 'D', 'A', 'T'):
+			/* Still image is a single frame animation */
+			if (!apng->animated && !self->cur_frame) {
+				fctl = (struct fctl_chunk) {
+					.w = dec->IHDR.width,
+					.h = dec->IHDR.height,
+				};
+				have_fctl = 1;
+			}
+		/* fallthrough */
+		case CHUNK_ID_TO_INT('f', 'd', 'A', 'T'):
+			if (!have_fctl) {
+				gp_io_seek(io, chunk_header->size, GP_SEEK_CUR);
+				break;
+			}
+
+			/* Skip fdAT sequence number */
+			if (chunk_header->id[0] == 'f' &&
+			    (chunk_header->size < 4 || gp_io_seek(io, 4, GP_SEEK_CUR) == (off_t)-1)) {
+				err = EINVAL;
+				break;
+			}
+
+			err = load_image(io, dec, chunk_header, fctl.w, fctl.h,
+			                 &img, callback, &apng->next);
+		break;
+		default:
+			err = read_common_chunk(io, dec, chunk_header);
+		}
+
+		if (err)
+			goto err;
+
+		/* Have header of the chunk after the image, CRC was skipped already */
+		if (!apng->next)
+			gp_io_seek(io, 4, GP_SEEK_CUR);
+
+		if (img)
+			break;
+	}
+
+	err = apng_compose(self, &fctl, img, frame);
+	gp_pixmap_free(img);
+
+	if (err)
+		return 1;
+
+	gp_progress_cb_done(callback);
+	return 0;
+err:
+	errno = err;
 	return 1;
 }
 
-#endif /* HAVE_LIBPNG */
+static int apng_rewind(gp_anim *self)
+{
+	struct apng *apng = GP_ANIM_PRIV(self);
+
+	if (gp_io_seek(apng->io, apng->start, GP_SEEK_SET) != apng->start)
+		return 1;
+
+	apng->next = 0;
+	apng->end = 0;
+
+	return 0;
+}
+
+static void apng_close(gp_anim *self)
+{
+	struct apng *apng = GP_ANIM_PRIV(self);
+
+	gp_io_close(apng->io);
+	gp_anim_free(self);
+}
+
+static gp_anim *apng_init(gp_io *io)
+{
+	struct png_dec dec = {};
+	struct chunk_header chunk_header;
+	uint32_t frames = 1, plays = 0;
+	struct apng *apng;
+	gp_anim *self;
+	int err, animated = 0;
+	off_t start;
+
+	if ((err = read_header(io, &dec)))
+		goto err;
+
+	/* Skip CRC */
+	start = gp_io_seek(io, dec.IHDR.size - 13 + 4, GP_SEEK_CUR);
+	if (start == (off_t)-1) {
+		err = EIO;
+		goto err;
+	}
+
+	/* acTL has to be before the image data */
+	for (;;) {
+		if ((err = next_chunk(io, &chunk_header)))
+			goto err;
+
+		switch (CHUNK_ID_HEADER_TO_INT(&chunk_header)) {
+		case CHUNK_ID_TO_INT('a', 'c', 'T', 'L'):
+			if ((err = read_actl(io, chunk_header.size, &frames, &plays)))
+				goto err;
+			animated = 1;
+		break;
+		case CHUNK_ID_TO_INT('I', 'D', 'A', 'T'):
+		case CHUNK_ID_TO_INT('I', 'E', 'N', 'D'):
+			goto done;
+		default:
+			gp_io_seek(io, chunk_header.size, GP_SEEK_CUR);
+		}
+
+		gp_io_seek(io, 4, GP_SEEK_CUR);
+	}
+done:
+	GP_DEBUG(1, "PNG %s with %"PRIu32" frames %"PRIu32" plays",
+	         animated ? "animation" : "still image", frames, plays);
+
+	if (gp_io_seek(io, start, GP_SEEK_SET) != start) {
+		err = EIO;
+		goto err;
+	}
+
+	self = gp_anim_alloc(&gp_apng_anim_ops, sizeof(struct apng),
+	                     dec.IHDR.width, dec.IHDR.height);
+	if (!self)
+		return NULL;
+
+	self->frame_cnt = frames;
+	self->loop_cnt = plays;
+
+	apng = GP_ANIM_PRIV(self);
+	apng->io = io;
+	apng->dec = dec;
+	apng->start = start;
+	apng->animated = animated;
+
+	return self;
+err:
+	errno = err;
+	return NULL;
+}
+
+static int match_png(const void *buf)
+{
+	return !memcmp(buf, "\x89PNG\r\n\x1a\n", 8);
+}
+
+const gp_anim_ops gp_apng_anim_ops = {
+	.next = apng_next,
+	.rewind = apng_rewind,
+	.close = apng_close,
+	.match = match_png,
+	.init = apng_init,
+	.fmt_name = "Animated Portable Network Graphics",
+};
 
 const gp_loader gp_png = {
 #ifdef HAVE_LIBPNG
 	.write = gp_write_png,
+	.write_ex = write_png,
 	.save_ptypes = save_ptypes,
 #endif
 	.read = gp_read_png_ex,
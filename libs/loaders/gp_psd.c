@@ -535,6 +535,10 @@ static gp_io *rle(gp_io *io)
 	rle->write = NULL;
 	rle->seek = NULL;
 	rle->close = rle_close;
+	rle->mark = 0;
+	rle->rbuf_pos = NULL;
+	rle->rbuf_end = NULL;
+	rle->map = NULL;
 
 	return rle;
 }
@@ -703,14 +707,8 @@ static void fill_metadata(struct psd_header *header, gp_storage *storage)
 	                        psd_color_mode_name(header->color_mode));
 }
 
-int gp_read_psd_ex(gp_io *io, gp_pixmap **img, gp_storage *storage,
-                   gp_progress_cb *callback)
+static int psd_read_header(gp_io *io, struct psd_header *header, uint32_t *len)
 {
-	int err;
-	uint32_t len, size, read_size = 0;
-	struct psd_header header;
-	gp_pixmap *thumbnail = NULL;
-
 	uint16_t psd_header[] = {
 	        '8', 'B', 'P', 'S',
 		0x00, 0x01,         /* Version always 1 */
@@ -724,26 +722,33 @@ int gp_read_psd_ex(gp_io *io, gp_pixmap **img, gp_storage *storage,
 		GP_IO_END
 	};
 
-	if (gp_io_readf(io, psd_header, &header.channels, &header.h, &header.w,
-	               &header.depth, &header.color_mode, &len) != 13) {
+	if (gp_io_readf(io, psd_header, &header->channels, &header->h, &header->w,
+	               &header->depth, &header->color_mode, len) != 13) {
 		GP_DEBUG(1, "Failed to read file header");
-		err = errno;
-		goto err;
+		return 1;
 	}
 
 	GP_DEBUG(1, "Have PSD %"PRIu32"x%"PRIu32" channels=%"PRIu16","
 	         " bpp=%"PRIu16" color_mode=%s (%"PRIu16") "
-	         " color_mode_data_len=%"PRIu32, header.w, header.h,
-	         header.channels, header.depth,
-	         psd_color_mode_name(header.color_mode), header.color_mode, len);
+	         " color_mode_data_len=%"PRIu32, header->w, header->h,
+	         header->channels, header->depth,
+	         psd_color_mode_name(header->color_mode), header->color_mode, *len);
 
-	if (storage)
-		fill_metadata(&header, storage);
+	return 0;
+}
 
-	if (!img)
-		return 0;
+/*
+ * Skips color mode data and reads the image resources section, the thumbnail
+ * is stored into the thumbnail pointer if found.
+ *
+ * Returns non-zero if the section couldn't be parsed till the end.
+ */
+static int psd_read_img_res(gp_io *io, struct psd_header *header, uint32_t len,
+                            gp_pixmap **thumbnail, int stop_on_thumbnail)
+{
+	uint32_t size, read_size = 0;
 
-	switch (header.color_mode) {
+	switch (header->color_mode) {
 	case PSD_INDEXED:
 	case PSD_DUOTONE:
 	break;
@@ -751,8 +756,8 @@ int gp_read_psd_ex(gp_io *io, gp_pixmap **img, gp_storage *storage,
 		if (len) {
 			GP_WARN("Color mode_mode_data_len != 0 (is %"PRIu32")"
 			        "for %s (%"PRIu16")", len,
-			        psd_color_mode_name(header.color_mode),
-		                header.color_mode);
+			        psd_color_mode_name(header->color_mode),
+		                header->color_mode);
 		}
 	}
 
@@ -770,16 +775,69 @@ int gp_read_psd_ex(gp_io *io, gp_pixmap **img, gp_storage *storage,
 	GP_DEBUG(1, "Image Resource Section length is %u", len);
 
 	do {
-		size = psd_next_img_res_block(io, &thumbnail, NULL);
+		size = psd_next_img_res_block(io, thumbnail, NULL);
+
+		if (size == 0)
+			return 1;
 
-		if (size == 0) {
-			*img = thumbnail;
+		if (stop_on_thumbnail && *thumbnail)
 			return 0;
-		}
 
 		read_size += size;
 	} while (read_size < len);
 
+	return 0;
+}
+
+static int read_psd_thumbnail(gp_io *io, gp_pixmap **img,
+                              gp_progress_cb GP_UNUSED(*callback))
+{
+	struct psd_header header;
+	gp_pixmap *thumbnail = NULL;
+	uint32_t len;
+
+	if (psd_read_header(io, &header, &len))
+		return 1;
+
+	psd_read_img_res(io, &header, len, &thumbnail, 1);
+
+	if (!thumbnail) {
+		GP_DEBUG(1, "No thumbnail found");
+		errno = ENOENT;
+		return 1;
+	}
+
+	*img = thumbnail;
+	return 0;
+}
+
+int gp_read_psd_ex(gp_io *io, gp_pixmap **img, gp_storage *storage,
+                   gp_progress_cb *callback)
+{
+	int err;
+	uint32_t len, size;
+	struct psd_header header;
+	gp_pixmap *thumbnail = NULL;
+
+	if (psd_read_header(io, &header, &len)) {
+		err = errno;
+		goto err;
+	}
+
+	if (storage)
+		fill_metadata(&header, storage);
+
+	if (!img)
+		return 0;
+
+	if (psd_read_img_res(io, &header, len, &thumbnail, 0)) {
+		if (!thumbnail)
+			return 1;
+
+		*img = thumbnail;
+		return 0;
+	}
+
 	/* Skip Layer and Mask information */
 	if (gp_io_read_b4(io, &size)) {
 		GP_DEBUG(1, "Failed to read Layer and Mask Section size");
@@ -820,6 +878,7 @@ err:
 
 const gp_loader gp_psd = {
 	.read = gp_read_psd_ex,
+	.read_thumbnail = read_psd_thumbnail,
 	.match = gp_match_psd,
 
 	.fmt_name = "Adobe Photoshop Image",
@@ -727,8 +727,46 @@ static gp_pixel_type save_ptypes[] = {
 	GP_PIXEL_UNKNOWN,
 };
 
-int gp_write_tiff(const gp_pixmap *src, gp_io *io,
-                 gp_progress_cb *callback)
+static void set_tiff_opts(TIFF *tiff, const gp_save_opts *opts)
+{
+	enum gp_save_compress compress = opts->compress;
+	int level = opts->compress_level;
+
+	if (compress == GP_SAVE_COMPRESS_DEFAULT) {
+		switch (opts->preset) {
+		case GP_SAVE_PRESET_DEFAULT:
+		case GP_SAVE_PRESET_FASTEST:
+			compress = GP_SAVE_COMPRESS_NONE;
+		break;
+		case GP_SAVE_PRESET_SMALLEST:
+			compress = GP_SAVE_COMPRESS_DEFLATE;
+			if (!level)
+				level = 9;
+		break;
+		}
+	}
+
+	switch (compress) {
+	case GP_SAVE_COMPRESS_DEFAULT:
+	case GP_SAVE_COMPRESS_NONE:
+		TIFFSetField(tiff, TIFFTAG_COMPRESSION, COMPRESSION_NONE);
+	break;
+	case GP_SAVE_COMPRESS_DEFLATE:
+		TIFFSetField(tiff, TIFFTAG_COMPRESSION, COMPRESSION_ADOBE_DEFLATE);
+		if (level)
+			TIFFSetField(tiff, TIFFTAG_ZIPQUALITY, level);
+	break;
+	case GP_SAVE_COMPRESS_LZW:
+		TIFFSetField(tiff, TIFFTAG_COMPRESSION, COMPRESSION_LZW);
+	break;
+	case GP_SAVE_COMPRESS_PACKBITS:
+		TIFFSetField(tiff, TIFFTAG_COMPRESSION, COMPRESSION_PACKBITS);
+	break;
+	}
+}
+
+static int write_tiff(const gp_pixmap *src, gp_io *io,
+                      const gp_save_opts *opts, gp_progress_cb *callback)
 {
 	TIFF *tiff;
 	int err = 0;
@@ -775,6 +813,9 @@ int gp_write_tiff(const gp_pixmap *src, gp_io *io,
 	TIFFSetField(tiff, TIFFTAG_ROWSPERSTRIP, 1);
 	TIFFSetField(tiff, TIFFTAG_PLANARCONFIG, PLANARCONFIG_CONTIG);
 
+	if (opts)
+		set_tiff_opts(tiff, opts);
+
 	switch (src->pixel_type) {
 	case GP_PIXEL_RGB888:
 	case GP_PIXEL_BGR888:
@@ -803,6 +844,12 @@ int gp_write_tiff(const gp_pixmap *src, gp_io *io,
 	return 0;
 }
 
+int gp_write_tiff(const gp_pixmap *src, gp_io *io,
+                 gp_progress_cb *callback)
+{
+	return write_tiff(src, io, NULL, callback);
+}
+
 #else
 
 int gp_read_tiff_ex(gp_io GP_UNUSED(*io), gp_pixmap GP_UNUSED(**img),
@@ -826,6 +873,7 @@ const struct gp_loader gp_tiff = {
 #ifdef HAVE_TIFF
 	.read = gp_read_tiff_ex,
 	.write = gp_write_tiff,
+	.write_ex = write_tiff,
 	.save_ptypes = save_ptypes,
 #endif
 	.match = gp_match_tiff,
@@ -40,23 +40,64 @@ static void fill_metadata(gp_storage *storage, int w, int h)
 	gp_storage_add_int(storage, NULL, "Height", h);
 }
 
+/*
+ * Maps the rest of the I/O data, returns NULL if I/O is not backed by memory.
+ */
+static const uint8_t *map_data(gp_io *io, size_t *size)
+{
+	const uint8_t *data;
+	off_t off, end;
+
+	if (!io->map)
+		return NULL;
+
+	off = gp_io_tell(io);
+	end = gp_io_seek(io, 0, GP_SEEK_END);
+
+	if (off == (off_t)-1 || end <= off)
+		goto restore;
+
+	data = gp_io_map(io, off, end - off);
+	if (!data)
+		goto restore;
+
+	*size = end - off;
+	return data;
+restore:
+	gp_io_seek(io, off, GP_SEEK_SET);
+	return NULL;
+}
+
+/* Mapped data are passed to the decoder in chunks for the progress callback */
+#define WEBP_MAP_CHUNK (64 * 1024)
+
 int gp_read_webp_ex(gp_io *io, gp_pixmap **img, gp_storage *storage,
                     gp_progress_cb *callback)
 {
 	unsigned char buf[1024];
 	WebPBitstreamFeatures features;
 	gp_pixel_type ptype;
+	const uint8_t *data;
+	size_t data_size = 0, data_pos = 0;
+	ssize_t ret = 0;
 	int err;
 
-	ssize_t ret = gp_io_read(io, buf, sizeof(buf));
+	data = map_data(io, &data_size);
 
-	if (ret <= 0) {
-		GP_DEBUG(1, "initial read failed");
-		errno = EINVAL;
-		return 1;
+	if (data) {
+		GP_DEBUG(1, "Decoding %zu bytes from memory", data_size);
+	} else {
+		ret = gp_io_read(io, buf, sizeof(buf));
+
+		if (ret <= 0) {
+			GP_DEBUG(1, "initial read failed");
+			errno = EINVAL;
+			return 1;
+		}
 	}
 
-	if (WebPGetFeatures(buf, ret, &features) != VP8_STATUS_OK) {
+	if (WebPGetFeatures(data ? data : buf, data ? data_size : (size_t)ret,
+	                    &features) != VP8_STATUS_OK) {
 		GP_DEBUG(1, "Failed to get webp features");
 		errno = EINVAL;
 		return 1;
@@ -106,8 +147,16 @@ int gp_read_webp_ex(gp_io *io, gp_pixmap **img, gp_storage *storage,
 
 	int ly=0;
 
-	do {
-		VP8StatusCode status = WebPIAppend(idec, buf, ret);
+	for (;;) {
+		VP8StatusCode status;
+
+		if (data) {
+			data_pos = GP_MIN(data_size, data_pos + WEBP_MAP_CHUNK);
+			/* Decodes in place, the data are not copied */
+			status = WebPIUpdate(idec, data, data_pos);
+		} else {
+			status = WebPIAppend(idec, buf, ret);
+		}
 
 		if (status != VP8_STATUS_OK && status != VP8_STATUS_SUSPENDED)
 		    break;
@@ -135,7 +184,16 @@ int gp_read_webp_ex(gp_io *io, gp_pixmap **img, gp_storage *storage,
 				}
 			}
 		}
-	} while ((ret = gp_io_read(io, buf, sizeof(buf))));
+
+		if (data) {
+			if (data_pos >= data_size)
+				break;
+		} else {
+			ret = gp_io_read(io, buf, sizeof(buf));
+			if (ret <= 0)
+				break;
+		}
+	}
 
 	WebPIDelete(idec);
 	WebPFreeDecBuffer(&config.output);
@@ -35,6 +35,23 @@ struct zip_priv {
 
 	/* Offsets to zip local headers */
 	long *offsets;
+
+	/*
+	 * Image entries parsed from the central directory, NULL if the archive
+	 * has no usable central directory and we fall back to a sequential
+	 * scan over the local headers.
+	 */
+	struct zip_entry *entries;
+	unsigned int entry_cnt;
+};
+
+/* Central directory record */
+struct zip_entry {
+	uint32_t offset;
+	uint32_t comp_size;
+	uint32_t uncomp_size;
+	uint16_t method;
+	uint16_t flags;
 };
 
 struct zip_local_header {
@@ -208,6 +225,295 @@ static int zip_read_data_desc(gp_io *io, struct zip_local_header *header)
 	return 0;
 }
 
+#define ZIP_EOCD_SIZE 22
+#define ZIP_CDIR_SIZE 46
+#define ZIP_MAX_COMMENT 0xffff
+
+static uint16_t get_l2(const uint8_t *buf)
+{
+	return buf[0] | (buf[1]<<8);
+}
+
+static uint32_t get_l4(const uint8_t *buf)
+{
+	return get_l2(buf) | ((uint32_t)get_l2(buf + 2)<<16);
+}
+
+/*
+ * Reads size bytes at offset, the data are mapped if possible and copied into
+ * a newly allocated buffer in *tmp otherwise.
+ */
+static const uint8_t *read_at(gp_io *io, off_t off, size_t size, uint8_t **tmp)
+{
+	const uint8_t *ret;
+
+	*tmp = NULL;
+
+	ret = gp_io_map(io, off, size);
+	if (ret)
+		return ret;
+
+	*tmp = malloc(size);
+	if (!*tmp)
+		return NULL;
+
+	if (gp_io_seek(io, off, GP_SEEK_SET) == (off_t)-1 ||
+	    gp_io_fill(io, *tmp, size)) {
+		free(*tmp);
+		*tmp = NULL;
+		return NULL;
+	}
+
+	return *tmp;
+}
+
+/*
+ * Only entries with an image extension and entries without any extension
+ * (which may be an image recognized by a signature) are indexed.
+ */
+static int maybe_image(const char *name, size_t len)
+{
+	char buf[256];
+	const char *ext = NULL;
+	size_t i;
+
+	/* Directory */
+	if (!len || name[len-1] == '/')
+		return 0;
+
+	for (i = len; i > 0; i--) {
+		if (name[i-1] == '/')
+			break;
+
+		if (name[i-1] == '.') {
+			ext = name + i;
+			break;
+		}
+	}
+
+	if (!ext)
+		return 1;
+
+	len = GP_MIN((size_t)(name + len - ext), sizeof(buf) - 2);
+
+	/* gp_loader_by_filename() wants a NULL terminated string */
+	buf[0] = '.';
+	memcpy(buf + 1, ext, len);
+	buf[len + 1] = 0;
+
+	return !!gp_loader_by_filename(buf);
+}
+
+static int parse_central_dir(struct zip_priv *priv, const uint8_t *cdir,
+                             size_t size, unsigned int entries)
+{
+	unsigned int i;
+	size_t pos = 0;
+
+	priv->entries = malloc(sizeof(struct zip_entry) * GP_MAX(entries, 1u));
+	if (!priv->entries)
+		return ENOMEM;
+
+	priv->entry_cnt = 0;
+
+	for (i = 0; i < entries; i++) {
+		const uint8_t *rec = cdir + pos;
+		uint16_t fname_len, extf_len, comment_len;
+		struct zip_entry *entry = &priv->entries[priv->entry_cnt];
+
+		if (pos + ZIP_CDIR_SIZE > size || memcmp(rec, "PK\1\2", 4))
+			goto err;
+
+		fname_len = get_l2(rec + 28);
+		extf_len = get_l2(rec + 30);
+		comment_len = get_l2(rec + 32);
+
+		pos += ZIP_CDIR_SIZE + fname_len + extf_len + comment_len;
+		if (pos > size)
+			goto err;
+
+		entry->flags = get_l2(rec + 8);
+		entry->method = get_l2(rec + 10);
+		entry->comp_size = get_l4(rec + 20);
+		entry->uncomp_size = get_l4(rec + 24);
+		entry->offset = get_l4(rec + 42);
+
+		if (entry->uncomp_size == 0 ||
+		    !maybe_image((const char*)rec + ZIP_CDIR_SIZE, fname_len)) {
+			GP_DEBUG(2, "Skipping entry %.*s", (int)fname_len,
+			         rec + ZIP_CDIR_SIZE);
+			continue;
+		}
+
+		GP_DEBUG(2, "Entry %u %.*s offset=%"PRIu32" compressed size=%"PRIu32,
+		         priv->entry_cnt, (int)fname_len, rec + ZIP_CDIR_SIZE,
+		         entry->offset, entry->comp_size);
+
+		priv->entry_cnt++;
+	}
+
+	return 0;
+err:
+	GP_DEBUG(1, "Corrupted central directory entry %u", i);
+	free(priv->entries);
+	priv->entries = NULL;
+	return EINVAL;
+}
+
+/*
+ * Looks up the end of central directory record at the end of the file and
+ * builds an index of image entries from the central directory.
+ */
+static int load_central_dir(struct zip_priv *priv)
+{
+	const uint8_t *tail, *eocd = NULL, *cdir;
+	uint8_t *tmp_tail, *tmp_cdir;
+	uint32_t cdir_size, cdir_off;
+	uint16_t entries;
+	off_t size, tail_off;
+	size_t tail_size, i;
+	int err;
+
+	size = gp_io_size(priv->io);
+	if (size == (off_t)-1 || size < ZIP_EOCD_SIZE)
+		return EINVAL;
+
+	tail_size = GP_MIN(size, (off_t)(ZIP_EOCD_SIZE + ZIP_MAX_COMMENT));
+	tail_off = size - tail_size;
+
+	tail = read_at(priv->io, tail_off, tail_size, &tmp_tail);
+	if (!tail)
+		return EIO;
+
+	for (i = tail_size - ZIP_EOCD_SIZE + 1; i > 0; i--) {
+		const uint8_t *rec = tail + i - 1;
+
+		if (memcmp(rec, "PK\5\6", 4))
+			continue;
+
+		if (i - 1 + ZIP_EOCD_SIZE + get_l2(rec + 20) <= tail_size) {
+			eocd = rec;
+			break;
+		}
+	}
+
+	if (!eocd) {
+		GP_DEBUG(1, "End of central directory not found");
+		err = EINVAL;
+		goto out;
+	}
+
+	entries = get_l2(eocd + 10);
+	cdir_size = get_l4(eocd + 12);
+	cdir_off = get_l4(eocd + 16);
+
+	if (entries == 0xffff || cdir_off == 0xffffffff) {
+		GP_DEBUG(1, "ZIP64 archives are not supported");
+		err = ENOSYS;
+		goto out;
+	}
+
+	if ((off_t)cdir_off + cdir_size > tail_off + (eocd - tail)) {
+		GP_DEBUG(1, "Central directory out of the file");
+		err = EINVAL;
+		goto out;
+	}
+
+	GP_DEBUG(1, "Central directory at %"PRIu32" size %"PRIu32" entries %u",
+	         cdir_off, cdir_size, (unsigned int)entries);
+
+	cdir = read_at(priv->io, cdir_off, cdir_size, &tmp_cdir);
+	if (!cdir) {
+		err = EIO;
+		goto out;
+	}
+
+	err = parse_central_dir(priv, cdir, cdir_size, entries);
+
+	free(tmp_cdir);
+out:
+	free(tmp_tail);
+	return err;
+}
+
+static int zip_read_entry(struct zip_priv *priv, struct zip_entry *entry,
+                          gp_pixmap **img, gp_storage *storage,
+                          gp_progress_cb *callback)
+{
+	struct zip_local_header header;
+	gp_io *io;
+	int err;
+
+	*img = NULL;
+
+	if (gp_io_seek(priv->io, entry->offset, GP_SEEK_SET) == (off_t)-1)
+		return errno;
+
+	if ((err = zip_load_header(priv->io, &header)))
+		return err == ENOENT ? EIO : err;
+
+	if (entry->flags & FLAG_ENCRYPTED) {
+		GP_DEBUG(1, "Can't handle encrypted files");
+		return ENOSYS;
+	}
+
+	/*
+	 * The sizes in local header may be zero when data descriptor is used,
+	 * hence we use the sizes from the central directory.
+	 */
+	if (seek_bytes(priv->io, (uint32_t)header.fname_len + header.extf_len))
+		return EIO;
+
+	switch (entry->method) {
+	case COMPRESS_STORED:
+		io = gp_io_sub_io(priv->io, entry->comp_size);
+	break;
+	case COMPRESS_DEFLATE:
+		io = gp_io_zlib(priv->io, entry->comp_size);
+	break;
+	default:
+		GP_DEBUG(1, "Unimplemented compression %s",
+		         compress_method_name(entry->method));
+		return ENOSYS;
+	}
+
+	if (!io)
+		return errno;
+
+	if (gp_read_image_ex(io, img, storage, callback))
+		err = errno == ECANCELED ? ECANCELED : EINVAL;
+
+	gp_io_close(io);
+
+	return err;
+}
+
+/*
+ * Loads an image at the current position or the first image after it in case
+ * that the entry couldn't be decoded. Returns ENOENT at the end.
+ */
+static int zip_index_load(struct zip_priv *priv, gp_pixmap **img,
+                          gp_storage *storage, gp_progress_cb *callback)
+{
+	int err;
+
+	for (; priv->cur_pos < priv->entry_cnt; priv->cur_pos++) {
+		err = zip_read_entry(priv, &priv->entries[priv->cur_pos],
+		                     img, storage, callback);
+
+		if (!err)
+			return 0;
+
+		if (err == ECANCELED)
+			return err;
+
+		GP_DEBUG(1, "Failed to load entry %u: %s",
+		         priv->cur_pos, strerror(err));
+	}
+
+	return ENOENT;
+}
+
 static int zip_next_file(struct zip_priv *priv, gp_pixmap **img,
                          gp_storage *storage,
                          gp_progress_cb *callback)
@@ -358,9 +664,13 @@ static int zip_load_next(gp_container *self, gp_pixmap **img,
 
 	*img = NULL;
 
-	do {
-		err = zip_next_file(priv, img, storage, callback);
-	} while (!*img && err == 0);
+	if (priv->entries) {
+		err = zip_index_load(priv, img, storage, callback);
+	} else {
+		do {
+			err = zip_next_file(priv, img, storage, callback);
+		} while (!*img && err == 0);
+	}
 
 	if (err == ENOENT)
 		errno = 0;
@@ -373,7 +683,8 @@ static int zip_load_next(gp_container *self, gp_pixmap **img,
 	priv->cur_pos++;
 	self->cur_img = priv->cur_pos;
 
-	record_offset(priv, priv->cur_pos, gp_io_tell(priv->io));
+	if (!priv->entries)
+		record_offset(priv, priv->cur_pos, gp_io_tell(priv->io));
 
 	return 0;
 }
@@ -484,10 +795,24 @@ static int zip_seek(gp_container *self, ssize_t offset,
 	case GP_SEEK_SET:
 		where = offset;
 	break;
+	case GP_SEEK_END:
+		if (!priv->entries)
+			return ENOSYS;
+		where = (ssize_t)priv->entry_cnt + offset;
+	break;
 	default:
 		return ENOSYS;
 	}
 
+	if (priv->entries) {
+		if (where < 0 || where >= priv->entry_cnt)
+			return ENOENT;
+
+		priv->cur_pos = where;
+		self->cur_img = where;
+		return 0;
+	}
+
 	ret = set_cur_pos(priv, where);
 
 	self->cur_img = priv->cur_pos;
@@ -498,6 +823,17 @@ static int zip_seek(gp_container *self, ssize_t offset,
 static int zip_load(gp_container *self, gp_pixmap **img,
                     gp_storage *storage, gp_progress_cb *callback)
 {
+	struct zip_priv *priv = GP_CONTAINER_PRIV(self);
+	int err;
+
+	if (priv->entries) {
+		*img = NULL;
+		err = zip_index_load(priv, img, storage, callback);
+		self->cur_img = priv->cur_pos;
+		errno = err == ENOENT ? 0 : err;
+		return !!err;
+	}
+
 	if (zip_load_next(self, img, storage, callback))
 		return 1;
 
@@ -513,6 +849,7 @@ static void zip_close(gp_container *self)
 	GP_DEBUG(1, "Closing ZIP container");
 
 	gp_vec_free(priv->offsets);
+	free(priv->entries);
 	gp_io_close(priv->io);
 	free(self);
 }
@@ -522,7 +859,10 @@ static gp_io *open_zip(const char *path)
 	gp_io *io;
 	int err = 0;
 
-	io = gp_io_file(path, GP_IO_RDONLY);
+	/* Entries are decoded directly from the mapping if possible */
+	io = gp_io_mmap(path);
+	if (!io)
+		io = gp_io_file(path, GP_IO_RDONLY);
 
 	if (!io) {
 		err = errno;
@@ -591,10 +931,26 @@ gp_container *gp_init_zip(gp_io *io)
 	priv->io = io;
 	priv->cur_pos = 0;
 	priv->offsets = offsets;
+	priv->entries = NULL;
+	priv->entry_cnt = 0;
+
+	if (!load_central_dir(priv)) {
+		ret->img_count = priv->entry_cnt;
+	} else {
+		GP_DEBUG(1, "Falling back to sequential local headers scan");
+		priv->entries = NULL;
+	}
+
+	if (gp_io_rewind(priv->io) == (off_t)-1) {
+		err = errno;
+		free(priv->entries);
+		gp_vec_free(offsets);
+		free(ret);
+		goto err0;
+	}
 
 	return ret;
 err0:
-	gp_io_close(io);
 	errno = err;
 	return NULL;
 }
@@ -7,6 +7,7 @@
 #include <utils/gp_utf.h>
 #include <text/gp_font.h>
 #include <text/gp_fonts.h>
+#include <text/gp_text_cache.h>
 
 static gp_glyph *get_glyph_from_table(const gp_glyphs *glyphs, uint32_t pos)
 {
@@ -113,6 +114,8 @@ void gp_font_face_free(gp_font_face *self)
 	if (!self)
 		return;
 
+	gp_text_cache_flush(self);
+
 	if (!self->ops->font_free)
 		return;
 
@@ -0,0 +1,5722 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_text.gen.c
+ *
+ * GENERATED on 2026 10 19 17:28:32 from gp_text.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Text rendering rutines.
+ *
+ * Copyright (C) 2009-2011 Jiri "BlueBear" Dluhos
+ *                         <jiri.bluebear.dluhos@gmail.com>
+ * Copyright (C) 2009-2024 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_mix_pixels.gen.h>
+#include <core/gp_transform.h>
+
+#include <gfx/gp_hline.h>
+
+#include <utils/gp_utf.h>
+
+#include <text/gp_text_style.h>
+#include <text/gp_font.h>
+#include <text/gp_text.h>
+#include <text/gp_text_cache.h>
+
+#define WIDTH_TO_1BPP_BPP(width) ((width)/8 + ((width)%8 != 0))
+
+/*
+ * Iterates over glyphs either from a cached run or from an UTF-8 string.
+ */
+struct glyph_iter {
+	const gp_font_face *font;
+	const gp_text_run *run;
+	const char *str;
+	size_t pos;
+	size_t max_chars;
+};
+
+static inline const gp_glyph *glyph_iter_next(struct glyph_iter *it)
+{
+	uint32_t ch;
+
+	if (it->pos >= it->max_chars)
+		return NULL;
+
+	if (it->run) {
+		if (it->pos >= it->run->len)
+			return NULL;
+
+		return gp_glyph_get(it->font, it->run->chars[it->pos++]);
+	}
+
+	ch = gp_utf8_next(&it->str);
+	if (!ch)
+		return NULL;
+
+	it->pos++;
+
+	return gp_glyph_get(it->font, ch);
+}
+
+static int get_width(const gp_text_style *style, int width)
+{
+	return width * style->pixel_xmul + (width - 1) * style->pixel_xspace;
+}
+
+static uint16_t bit_lookup[] = {
+	0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+};
+
+
+static void draw_1BPP_glyph_RGB101010(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_32BPP(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_RGB101010(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_32BPP(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_RGB101010(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGB101010(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGB101010(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_xRGB8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_32BPP(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_xRGB8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_32BPP(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_xRGB8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_xRGB8888(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_xRGB8888(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_RGBA8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_32BPP(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_RGBA8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_32BPP(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_RGBA8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGBA8888(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGBA8888(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_RGB888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_24BPP(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_RGB888(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_24BPP(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_RGB888(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGB888(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGB888(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_BGR888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_24BPP(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_BGR888(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_24BPP(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_BGR888(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_BGR888(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_BGR888(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_RGB555(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_16BPP(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_RGB555(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_16BPP(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_RGB555(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGB555(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGB555(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_RGB565(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_16BPP(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_RGB565(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_16BPP(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_RGB565(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGB565(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGB565(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_RGB666(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_18BPP_DB(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_RGB666(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_18BPP_DB(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_RGB666(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGB666(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGB666(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_RGB332(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_8BPP(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_RGB332(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_8BPP(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_RGB332(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGB332(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGB332(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_CMYK8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_32BPP(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_CMYK8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_32BPP(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_CMYK8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_CMYK8888(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_CMYK8888(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_P2(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_2BPP_UB(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_P2(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_2BPP_UB(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_P2(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_P2(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_P2(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_P4(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_4BPP_UB(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_P4(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_4BPP_UB(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_P4(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_P4(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_P4(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_P8(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_8BPP(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_P8(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_8BPP(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_P8(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_P8(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_P8(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_G1_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_1BPP_DB(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_G1_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_1BPP_DB(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_G1_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_G1_DB(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G1_DB(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_G2_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_2BPP_DB(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_G2_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_2BPP_DB(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_G2_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_G2_DB(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G2_DB(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_G4_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_4BPP_DB(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_G4_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_4BPP_DB(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_G4_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_G4_DB(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G4_DB(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_G1_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_1BPP_UB(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_G1_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_1BPP_UB(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_G1_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_G1_UB(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G1_UB(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_G2_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_2BPP_UB(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_G2_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_2BPP_UB(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_G2_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_G2_UB(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G2_UB(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_G4_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_4BPP_UB(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_G4_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_4BPP_UB(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_G4_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_G4_UB(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G4_UB(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_G8(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_8BPP(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_G8(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_8BPP(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_G8(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_G8(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G8(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_GA88(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_16BPP(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_GA88(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_16BPP(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_GA88(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_GA88(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_GA88(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_1BPP_glyph_G16(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j, k, l;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x + i * x_mul;
+
+			for (k = y; k < y + style->pixel_ymul; k++) {
+				for (l = px; l < px + style->pixel_xmul; l++) {
+					gp_coord sx = l;
+					gp_coord sy = k;
+					GP_TRANSFORM_POINT(pixmap, sx, sy);
+					if (!GP_PIXEL_IS_CLIPPED(pixmap, sx, sy))
+						gp_putpixel_raw_16BPP(pixmap, sx, sy, fg);
+				}
+			}
+		}
+		y += y_mul;
+	}
+}
+
+static void draw_1BPP_glyph_nomul_G16(gp_pixmap *pixmap, const gp_text_style *style,
+                                                gp_coord x, gp_coord y, gp_pixel fg, const gp_glyph *glyph)
+{
+	int i, j;
+
+	unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+	x += glyph->bearing_x;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font));
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & bit_lookup[i%8];
+
+			if (!bit)
+				continue;
+
+			gp_coord px = x+i;
+			gp_coord py = y;
+
+			GP_TRANSFORM_POINT(pixmap, px, py);
+
+			if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+				gp_putpixel_raw_16BPP(pixmap, px, py, fg);
+		}
+		y++;
+	}
+}
+
+static void text_draw_1BPP_G16(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		if (nomul)
+			draw_1BPP_glyph_nomul_G16(pixmap, style, gx, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G16(pixmap, style, gx, y, fg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP(gp_pixmap *pixmap, const gp_text_style *style,
+                           uint8_t bearing, int x, int y,
+                           gp_pixel fg, struct glyph_iter *it)
+{
+	switch (pixmap->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		text_draw_1BPP_RGB101010(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_xRGB8888:
+		text_draw_1BPP_xRGB8888(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_RGBA8888:
+		text_draw_1BPP_RGBA8888(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_RGB888:
+		text_draw_1BPP_RGB888(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_BGR888:
+		text_draw_1BPP_BGR888(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_RGB555:
+		text_draw_1BPP_RGB555(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_RGB565:
+		text_draw_1BPP_RGB565(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_RGB666:
+		text_draw_1BPP_RGB666(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_RGB332:
+		text_draw_1BPP_RGB332(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_CMYK8888:
+		text_draw_1BPP_CMYK8888(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_P2:
+		text_draw_1BPP_P2(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_P4:
+		text_draw_1BPP_P4(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_P8:
+		text_draw_1BPP_P8(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_G1_DB:
+		text_draw_1BPP_G1_DB(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_G2_DB:
+		text_draw_1BPP_G2_DB(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_G4_DB:
+		text_draw_1BPP_G4_DB(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_G1_UB:
+		text_draw_1BPP_G1_UB(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_G2_UB:
+		text_draw_1BPP_G2_UB(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_G4_UB:
+		text_draw_1BPP_G4_UB(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_G8:
+		text_draw_1BPP_G8(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_GA88:
+		text_draw_1BPP_GA88(pixmap, style, bearing, x, y, fg, it);
+	break;
+	case GP_PIXEL_G16:
+		text_draw_1BPP_G16(pixmap, style, bearing, x, y, fg, it);
+	break;
+	default:
+		GP_ABORT("Invalid pixmap->pixel_type");
+	}
+}
+
+
+
+static void draw_8BPP_glyph_bg_RGB101010(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_RGB101010(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_RGB101010(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGB101010(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_RGB101010(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_RGB101010(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGB101010(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_RGB101010(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_xRGB8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_xRGB8888(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_xRGB8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_xRGB8888(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_xRGB8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_xRGB8888(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_xRGB8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_xRGB8888(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_RGBA8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_RGBA8888(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_RGBA8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGBA8888(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_RGBA8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_RGBA8888(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGBA8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_RGBA8888(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_RGB888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_RGB888(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_RGB888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGB888(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_RGB888(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_RGB888(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGB888(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_RGB888(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_BGR888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_BGR888(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_BGR888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_BGR888(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_BGR888(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_BGR888(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_BGR888(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_BGR888(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_RGB555(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_RGB555(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_RGB555(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGB555(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_RGB555(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_RGB555(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGB555(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_RGB555(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_RGB565(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_RGB565(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_RGB565(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGB565(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_RGB565(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_RGB565(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGB565(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_RGB565(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_RGB666(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_RGB666(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_RGB666(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGB666(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_RGB666(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_RGB666(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGB666(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_RGB666(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_RGB332(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_RGB332(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_RGB332(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGB332(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_RGB332(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_RGB332(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGB332(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_RGB332(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_CMYK8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_CMYK8888(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_CMYK8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_CMYK8888(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_CMYK8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_CMYK8888(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_CMYK8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_CMYK8888(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_P2(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_P2(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_P2(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_P2(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_P2(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_P2(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_P2(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_P2(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_P4(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_P4(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_P4(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_P4(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_P4(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_P4(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_P4(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_P4(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_P8(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_P8(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_P8(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_P8(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_P8(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_P8(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_P8(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_P8(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_G1_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_G1_DB(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_G1_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_G1_DB(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_G1_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_G1_DB(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_G1_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_G1_DB(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_G2_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_G2_DB(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_G2_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_G2_DB(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_G2_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_G2_DB(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_G2_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_G2_DB(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_G4_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_G4_DB(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_G4_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_G4_DB(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_G4_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_G4_DB(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_G4_DB(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_G4_DB(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_G1_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_G1_UB(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_G1_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_G1_UB(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_G1_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_G1_UB(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_G1_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_G1_UB(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_G2_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_G2_UB(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_G2_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_G2_UB(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_G2_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_G2_UB(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_G2_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_G2_UB(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_G4_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_G4_UB(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_G4_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_G4_UB(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_G4_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_G4_UB(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_G4_UB(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_G4_UB(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_G8(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_G8(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_G8(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_G8(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_G8(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_G8(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_G8(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_G8(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_GA88(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_GA88(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_GA88(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_GA88(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_GA88(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_GA88(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_GA88(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_GA88(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void draw_8BPP_glyph_bg_G16(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x, x + style->pixel_xmul - 1, y + k,
+					GP_MIX_PIXELS_G16(fg, bg, gray));
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void draw_8BPP_glyph_G16(gp_pixmap *pixmap, const gp_text_style *style,
+                                          gp_coord x, gp_coord y,
+					  gp_pixel fg, gp_pixel bg,
+					  const gp_glyph *glyph)
+{
+	gp_coord i, j, k;
+
+	(void) bg;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+	unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+	x += glyph->bearing_x * x_mul;
+	y -= (glyph->bearing_y - gp_font_ascent(style->font)) * y_mul;
+
+	gp_coord x0 = x;
+
+	for (j = 0; j < glyph->height; j++) {
+		for (i = 0; i < glyph->width; i++) {
+			uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+			if (!gray) {
+				x += x_mul;
+				continue;
+			}
+
+			for (k = 0; k < style->pixel_ymul; k++) {
+					gp_coord l;
+
+					for (l = x; l < x + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_G16(pixmap, px, py, fg, gray);
+					}
+			}
+			x += x_mul;
+		}
+
+		x = x0;
+		y += style->pixel_ymul + style->pixel_yspace;
+	}
+}
+
+static void text_8BPP_bg_G16(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_bg_G16(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_G16(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, gp_pixel bg,
+				    struct glyph_iter *it)
+{
+	const gp_glyph *glyph;
+	size_t pos;
+
+	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
+		gp_coord gx = x;
+
+		if (!bearing && !pos)
+			gx -= glyph->bearing_x * x_mul;
+
+		draw_8BPP_glyph_G16(pixmap, style, gx, y, fg, bg, glyph);
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && !pos)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg(gp_pixmap *pixmap, const gp_text_style *style,
+                         uint8_t bearing, gp_coord x, gp_coord y,
+                         gp_pixel fg, gp_pixel bg,
+                         struct glyph_iter *it)
+{
+	switch (pixmap->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		text_8BPP_bg_RGB101010(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_xRGB8888:
+		text_8BPP_bg_xRGB8888(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_RGBA8888:
+		text_8BPP_bg_RGBA8888(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_RGB888:
+		text_8BPP_bg_RGB888(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_BGR888:
+		text_8BPP_bg_BGR888(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_RGB555:
+		text_8BPP_bg_RGB555(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_RGB565:
+		text_8BPP_bg_RGB565(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_RGB666:
+		text_8BPP_bg_RGB666(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_RGB332:
+		text_8BPP_bg_RGB332(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_CMYK8888:
+		text_8BPP_bg_CMYK8888(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_P2:
+		text_8BPP_bg_P2(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_P4:
+		text_8BPP_bg_P4(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_P8:
+		text_8BPP_bg_P8(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G1_DB:
+		text_8BPP_bg_G1_DB(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G2_DB:
+		text_8BPP_bg_G2_DB(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G4_DB:
+		text_8BPP_bg_G4_DB(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G1_UB:
+		text_8BPP_bg_G1_UB(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G2_UB:
+		text_8BPP_bg_G2_UB(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G4_UB:
+		text_8BPP_bg_G4_UB(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G8:
+		text_8BPP_bg_G8(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_GA88:
+		text_8BPP_bg_GA88(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G16:
+		text_8BPP_bg_G16(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	default:
+		GP_ABORT("Invalid pixmap->pixel_type");
+	}
+}
+
+static void text_8BPP(gp_pixmap *pixmap, const gp_text_style *style,
+                      uint8_t bearing, gp_coord x, gp_coord y,
+                      gp_pixel fg, gp_pixel bg, struct glyph_iter *it)
+{
+	switch (pixmap->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		text_8BPP_RGB101010(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_xRGB8888:
+		text_8BPP_xRGB8888(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_RGBA8888:
+		text_8BPP_RGBA8888(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_RGB888:
+		text_8BPP_RGB888(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_BGR888:
+		text_8BPP_BGR888(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_RGB555:
+		text_8BPP_RGB555(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_RGB565:
+		text_8BPP_RGB565(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_RGB666:
+		text_8BPP_RGB666(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_RGB332:
+		text_8BPP_RGB332(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_CMYK8888:
+		text_8BPP_CMYK8888(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_P2:
+		text_8BPP_P2(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_P4:
+		text_8BPP_P4(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_P8:
+		text_8BPP_P8(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G1_DB:
+		text_8BPP_G1_DB(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G2_DB:
+		text_8BPP_G2_DB(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G4_DB:
+		text_8BPP_G4_DB(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G1_UB:
+		text_8BPP_G1_UB(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G2_UB:
+		text_8BPP_G2_UB(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G4_UB:
+		text_8BPP_G4_UB(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G8:
+		text_8BPP_G8(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_GA88:
+		text_8BPP_GA88(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	case GP_PIXEL_G16:
+		text_8BPP_G16(pixmap, style, bearing, x, y, fg, bg, it);
+	break;
+	default:
+		GP_ABORT("Invalid pixmap->pixel_type");
+	}
+}
+
+gp_size gp_text_raw(gp_pixmap *pixmap, const gp_text_style *style,
+                    gp_coord x, gp_coord y, gp_text_flags flags,
+                    gp_pixel fg, gp_pixel bg,
+                    const char *str, size_t max_chars)
+{
+	uint8_t bearing = flags & GP_TEXT_BEARING;
+	struct glyph_iter it = {
+		.font = style->font,
+		.run = gp_text_run_get(style, str),
+		.str = str,
+		.max_chars = max_chars,
+	};
+
+	switch (style->font->glyph_bitmap_format) {
+	case GP_FONT_BITMAP_1BPP:
+		text_draw_1BPP(pixmap, style, bearing, x, y, fg, &it);
+	break;
+	case GP_FONT_BITMAP_8BPP:
+		if (flags & GP_TEXT_NOBG)
+			text_8BPP(pixmap, style, bearing, x, y, fg, bg, &it);
+		else
+			text_8BPP_bg(pixmap, style, bearing, x, y, fg, bg, &it);
+	break;
+	default:
+		GP_ABORT("Invalid font glyph bitmap format");
+	}
+
+	if (it.run)
+		return gp_text_run_width_len(it.run, GP_TEXT_LEN_BBOX, max_chars);
+
+	return gp_text_width_len(style, GP_TEXT_LEN_BBOX, str, max_chars);
+}
+
+static void glyph_1BPP(gp_pixmap *pixmap, const gp_text_style *style,
+                       gp_coord x, gp_coord y,
+                       gp_pixel fg, const gp_glyph *glyph)
+{
+	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
+                    style->pixel_xspace == 0 && style->pixel_yspace == 0;
+
+	switch (pixmap->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGB101010(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGB101010(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_xRGB8888:
+		if (nomul)
+			draw_1BPP_glyph_nomul_xRGB8888(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_xRGB8888(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_RGBA8888:
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGBA8888(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGBA8888(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_RGB888:
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGB888(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGB888(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_BGR888:
+		if (nomul)
+			draw_1BPP_glyph_nomul_BGR888(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_BGR888(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_RGB555:
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGB555(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGB555(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_RGB565:
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGB565(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGB565(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_RGB666:
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGB666(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGB666(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_RGB332:
+		if (nomul)
+			draw_1BPP_glyph_nomul_RGB332(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_RGB332(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_CMYK8888:
+		if (nomul)
+			draw_1BPP_glyph_nomul_CMYK8888(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_CMYK8888(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_P2:
+		if (nomul)
+			draw_1BPP_glyph_nomul_P2(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_P2(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_P4:
+		if (nomul)
+			draw_1BPP_glyph_nomul_P4(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_P4(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_P8:
+		if (nomul)
+			draw_1BPP_glyph_nomul_P8(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_P8(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_G1_DB:
+		if (nomul)
+			draw_1BPP_glyph_nomul_G1_DB(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G1_DB(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_G2_DB:
+		if (nomul)
+			draw_1BPP_glyph_nomul_G2_DB(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G2_DB(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_G4_DB:
+		if (nomul)
+			draw_1BPP_glyph_nomul_G4_DB(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G4_DB(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_G1_UB:
+		if (nomul)
+			draw_1BPP_glyph_nomul_G1_UB(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G1_UB(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_G2_UB:
+		if (nomul)
+			draw_1BPP_glyph_nomul_G2_UB(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G2_UB(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_G4_UB:
+		if (nomul)
+			draw_1BPP_glyph_nomul_G4_UB(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G4_UB(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_G8:
+		if (nomul)
+			draw_1BPP_glyph_nomul_G8(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G8(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_GA88:
+		if (nomul)
+			draw_1BPP_glyph_nomul_GA88(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_GA88(pixmap, style, x, y, fg, glyph);
+	break;
+	case GP_PIXEL_G16:
+		if (nomul)
+			draw_1BPP_glyph_nomul_G16(pixmap, style, x, y, fg, glyph);
+		else
+			draw_1BPP_glyph_G16(pixmap, style, x, y, fg, glyph);
+	break;
+	default:
+		GP_ABORT("Invalid pixmap->pixel_type");
+	}
+}
+
+static void glyph_8BPP(gp_pixmap *pixmap, const gp_text_style *style,
+                       gp_coord x, gp_coord y,
+                       gp_pixel fg, gp_pixel bg, const gp_glyph *glyph)
+{
+	switch (pixmap->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		draw_8BPP_glyph_RGB101010(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_xRGB8888:
+		draw_8BPP_glyph_xRGB8888(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_RGBA8888:
+		draw_8BPP_glyph_RGBA8888(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_RGB888:
+		draw_8BPP_glyph_RGB888(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_BGR888:
+		draw_8BPP_glyph_BGR888(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_RGB555:
+		draw_8BPP_glyph_RGB555(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_RGB565:
+		draw_8BPP_glyph_RGB565(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_RGB666:
+		draw_8BPP_glyph_RGB666(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_RGB332:
+		draw_8BPP_glyph_RGB332(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_CMYK8888:
+		draw_8BPP_glyph_CMYK8888(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_P2:
+		draw_8BPP_glyph_P2(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_P4:
+		draw_8BPP_glyph_P4(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_P8:
+		draw_8BPP_glyph_P8(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G1_DB:
+		draw_8BPP_glyph_G1_DB(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G2_DB:
+		draw_8BPP_glyph_G2_DB(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G4_DB:
+		draw_8BPP_glyph_G4_DB(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G1_UB:
+		draw_8BPP_glyph_G1_UB(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G2_UB:
+		draw_8BPP_glyph_G2_UB(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G4_UB:
+		draw_8BPP_glyph_G4_UB(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G8:
+		draw_8BPP_glyph_G8(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_GA88:
+		draw_8BPP_glyph_GA88(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G16:
+		draw_8BPP_glyph_G16(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	default:
+		GP_ABORT("Invalid pixmap->pixel_type");
+	}
+}
+
+static void glyph_8BPP_bg(gp_pixmap *pixmap, const gp_text_style *style,
+                          gp_coord x, gp_coord y,
+                          gp_pixel fg, gp_pixel bg, const gp_glyph *glyph)
+{
+	switch (pixmap->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		draw_8BPP_glyph_bg_RGB101010(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_xRGB8888:
+		draw_8BPP_glyph_bg_xRGB8888(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_RGBA8888:
+		draw_8BPP_glyph_bg_RGBA8888(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_RGB888:
+		draw_8BPP_glyph_bg_RGB888(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_BGR888:
+		draw_8BPP_glyph_bg_BGR888(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_RGB555:
+		draw_8BPP_glyph_bg_RGB555(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_RGB565:
+		draw_8BPP_glyph_bg_RGB565(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_RGB666:
+		draw_8BPP_glyph_bg_RGB666(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_RGB332:
+		draw_8BPP_glyph_bg_RGB332(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_CMYK8888:
+		draw_8BPP_glyph_bg_CMYK8888(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_P2:
+		draw_8BPP_glyph_bg_P2(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_P4:
+		draw_8BPP_glyph_bg_P4(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_P8:
+		draw_8BPP_glyph_bg_P8(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G1_DB:
+		draw_8BPP_glyph_bg_G1_DB(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G2_DB:
+		draw_8BPP_glyph_bg_G2_DB(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G4_DB:
+		draw_8BPP_glyph_bg_G4_DB(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G1_UB:
+		draw_8BPP_glyph_bg_G1_UB(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G2_UB:
+		draw_8BPP_glyph_bg_G2_UB(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G4_UB:
+		draw_8BPP_glyph_bg_G4_UB(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G8:
+		draw_8BPP_glyph_bg_G8(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_GA88:
+		draw_8BPP_glyph_bg_GA88(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	case GP_PIXEL_G16:
+		draw_8BPP_glyph_bg_G16(pixmap, style, x, y, fg, bg, glyph);
+	break;
+	default:
+		GP_ABORT("Invalid pixmap->pixel_type");
+	}
+}
+
+gp_size gp_glyph_draw(gp_pixmap *pixmap, const gp_text_style *style,
+                      gp_coord x, gp_coord y, int flags,
+                      gp_pixel fg_color, gp_pixel bg_color,
+                      uint32_t glyph)
+{
+	uint8_t bearing = flags & GP_TEXT_BEARING;
+
+	const gp_glyph *g = gp_glyph_get(style->font, glyph);
+
+	gp_coord gx = x;
+	gp_coord bearing_x = 0;
+
+	switch (flags & 0x70) {
+	case GP_VALIGN_ABOVE:
+		y = y - gp_text_height(style) + 1;
+	break;
+	case GP_VALIGN_CENTER:
+		y = y - gp_text_height(style)/2;
+	break;
+	case GP_VALIGN_BASELINE:
+		y = y - gp_text_ascent(style) + 1;
+	break;
+	case GP_VALIGN_BELOW:
+	break;
+	}
+
+	if (!bearing) {
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		bearing_x = g->bearing_x * x_mul;
+		gx -= bearing_x;
+	}
+
+	switch (style->font->glyph_bitmap_format) {
+	case GP_FONT_BITMAP_1BPP:
+		glyph_1BPP(pixmap, style, gx, y, fg_color, g);
+	break;
+	case GP_FONT_BITMAP_8BPP:
+		if (flags & GP_TEXT_NOBG)
+			glyph_8BPP(pixmap, style, gx, y, fg_color, bg_color, g);
+		else
+			glyph_8BPP_bg(pixmap, style, gx, y, fg_color, bg_color, g);
+	break;
+	default:
+		GP_ABORT("Invalid font glyph bitmap format");
+	}
+
+	return gp_glyph_advance_x(style, glyph) + style->char_xspace - (!bearing ? bearing_x : 0);
+}
@@ -18,9 +18,44 @@
 #include <text/gp_text_style.h>
 #include <text/gp_font.h>
 #include <text/gp_text.h>
+#include <text/gp_text_cache.h>
 
 #define WIDTH_TO_1BPP_BPP(width) ((width)/8 + ((width)%8 != 0))
 
+/*
+ * Iterates over glyphs either from a cached run or from an UTF-8 string.
+ */
+struct glyph_iter {
+	const gp_font_face *font;
+	const gp_text_run *run;
+	const char *str;
+	size_t pos;
+	size_t max_chars;
+};
+
+static inline const gp_glyph *glyph_iter_next(struct glyph_iter *it)
+{
+	uint32_t ch;
+
+	if (it->pos >= it->max_chars)
+		return NULL;
+
+	if (it->run) {
+		if (it->pos >= it->run->len)
+			return NULL;
+
+		return gp_glyph_get(it->font, it->run->chars[it->pos++]);
+	}
+
+	ch = gp_utf8_next(&it->str);
+	if (!ch)
+		return NULL;
+
+	it->pos++;
+
+	return gp_glyph_get(it->font, ch);
+}
+
 static int get_width(const gp_text_style *style, int width)
 {
 	return width * style->pixel_xmul + (width - 1) * style->pixel_xspace;
@@ -100,9 +135,9 @@ static void draw_1BPP_glyph_nomul_{{ pt.name }}(gp_pixmap *pixmap, const gp_text
 
 static void text_draw_1BPP_{{ pt.name }}(gp_pixmap *pixmap, const gp_text_style *style,
                                          uint8_t bearing, gp_coord x, gp_coord y,
-				         gp_pixel fg, const char *str, size_t max_chars)
+				         gp_pixel fg, struct glyph_iter *it)
 {
-	uint32_t ch;
+	const gp_glyph *glyph;
 	size_t pos;
 
 	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
@@ -110,9 +145,7 @@ static void text_draw_1BPP_{{ pt.name }}(gp_pixmap *pixmap, const gp_text_style
 	int nomul = style->pixel_xmul == 1 && style->pixel_ymul == 1 &&
                     style->pixel_xspace == 0 && style->pixel_yspace == 0;
 
-	for (pos = 0; pos < max_chars && (ch = gp_utf8_next(&str)); pos++) {
-		const gp_glyph *glyph = gp_glyph_get(style->font, ch);
-
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
 		gp_coord gx = x;
 
 		if (!bearing && !pos)
@@ -134,13 +167,13 @@ static void text_draw_1BPP_{{ pt.name }}(gp_pixmap *pixmap, const gp_text_style
 
 static void text_draw_1BPP(gp_pixmap *pixmap, const gp_text_style *style,
                            uint8_t bearing, int x, int y,
-                           gp_pixel fg, const char *str, size_t max_chars)
+                           gp_pixel fg, struct glyph_iter *it)
 {
 	switch (pixmap->pixel_type) {
 @ for pt in pixeltypes:
 @     if not pt.is_unknown():
 	case GP_PIXEL_{{ pt.name }}:
-		text_draw_1BPP_{{ pt.name }}(pixmap, style, bearing, x, y, fg, str, max_chars);
+		text_draw_1BPP_{{ pt.name }}(pixmap, style, bearing, x, y, fg, it);
 	break;
 @ end
 	default:
@@ -203,13 +236,12 @@ static void draw_8BPP_glyph{{ bg }}_{{ pt.name }}(gp_pixmap *pixmap, const gp_te
 @ end
 
 @ def text_8BPP(pt, bg):
-	uint32_t ch;
+	const gp_glyph *glyph;
 	size_t pos;
 
 	unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
 
-	for (pos = 0; pos < max_chars && (ch = gp_utf8_next(&str)); pos++) {
-		const gp_glyph *glyph = gp_glyph_get(style->font, ch);
+	for (pos = 0; (glyph = glyph_iter_next(it)); pos++) {
 		gp_coord gx = x;
 
 		if (!bearing && !pos)
@@ -234,7 +266,7 @@ static void draw_8BPP_glyph{{ bg }}_{{ pt.name }}(gp_pixmap *pixmap, const gp_te
 static void text_8BPP_bg_{{ pt.name }}(gp_pixmap *pixmap, const gp_text_style *style,
                                        uint8_t bearing, gp_coord x, gp_coord y,
 				       gp_pixel fg, gp_pixel bg,
-                                       const char *str, size_t max_chars)
+                                       struct glyph_iter *it)
 {
 @         text_8BPP(pt, "_bg")
 }
@@ -242,7 +274,7 @@ static void text_8BPP_bg_{{ pt.name }}(gp_pixmap *pixmap, const gp_text_style *s
 static void text_8BPP_{{ pt.name }}(gp_pixmap *pixmap, const gp_text_style *style,
                                     uint8_t bearing, gp_coord x, gp_coord y,
 				    gp_pixel fg, gp_pixel bg,
-				    const char *str, size_t max_chars)
+				    struct glyph_iter *it)
 {
 @         text_8BPP(pt, "")
 }
@@ -252,13 +284,13 @@ static void text_8BPP_{{ pt.name }}(gp_pixmap *pixmap, const gp_text_style *styl
 static void text_8BPP_bg(gp_pixmap *pixmap, const gp_text_style *style,
                          uint8_t bearing, gp_coord x, gp_coord y,
                          gp_pixel fg, gp_pixel bg,
-                         const char *str, size_t max_chars)
+                         struct glyph_iter *it)
 {
 	switch (pixmap->pixel_type) {
 @ for pt in pixeltypes:
 @     if not pt.is_unknown():
 	case GP_PIXEL_{{ pt.name }}:
-		text_8BPP_bg_{{ pt.name }}(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+		text_8BPP_bg_{{ pt.name }}(pixmap, style, bearing, x, y, fg, bg, it);
 	break;
 @ end
 	default:
@@ -268,13 +300,13 @@ static void text_8BPP_bg(gp_pixmap *pixmap, const gp_text_style *style,
 
 static void text_8BPP(gp_pixmap *pixmap, const gp_text_style *style,
                       uint8_t bearing, gp_coord x, gp_coord y,
-                      gp_pixel fg, gp_pixel bg, const char *str, size_t max_chars)
+                      gp_pixel fg, gp_pixel bg, struct glyph_iter *it)
 {
 	switch (pixmap->pixel_type) {
 @ for pt in pixeltypes:
 @     if not pt.is_unknown():
 	case GP_PIXEL_{{ pt.name }}:
-		text_8BPP_{{ pt.name }}(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+		text_8BPP_{{ pt.name }}(pixmap, style, bearing, x, y, fg, bg, it);
 	break;
 @ end
 	default:
@@ -288,21 +320,30 @@ gp_size gp_text_raw(gp_pixmap *pixmap, const gp_text_style *style,
                     const char *str, size_t max_chars)
 {
 	uint8_t bearing = flags & GP_TEXT_BEARING;
+	struct glyph_iter it = {
+		.font = style->font,
+		.run = gp_text_run_get(style, str),
+		.str = str,
+		.max_chars = max_chars,
+	};
 
 	switch (style->font->glyph_bitmap_format) {
 	case GP_FONT_BITMAP_1BPP:
-		text_draw_1BPP(pixmap, style, bearing, x, y, fg, str, max_chars);
+		text_draw_1BPP(pixmap, style, bearing, x, y, fg, &it);
 	break;
 	case GP_FONT_BITMAP_8BPP:
 		if (flags & GP_TEXT_NOBG)
-			text_8BPP(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+			text_8BPP(pixmap, style, bearing, x, y, fg, bg, &it);
 		else
-			text_8BPP_bg(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+			text_8BPP_bg(pixmap, style, bearing, x, y, fg, bg, &it);
 	break;
 	default:
 		GP_ABORT("Invalid font glyph bitmap format");
 	}
 
+	if (it.run)
+		return gp_text_run_width_len(it.run, GP_TEXT_LEN_BBOX, max_chars);
+
 	return gp_text_width_len(style, GP_TEXT_LEN_BBOX, str, max_chars);
 }
 
@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <core/gp_debug.h>
+#include <utils/gp_utf.h>
+#include <text/gp_font.h>
+#include <text/gp_text_cache.h>
+
+void __attribute__((visibility ("hidden"))) text_run_layout(gp_text_run *run);
+
+extern gp_text_style gp_default_style;
+
+struct text_cache {
+	unsigned int size;
+	unsigned int used;
+	unsigned long hits;
+	unsigned long misses;
+	unsigned int gen;
+	gp_text_run *runs[];
+};
+
+/*
+ * Per thread cache, text drawn from worker threads does not need locking.
+ */
+static __thread struct text_cache *cache;
+
+/*
+ * Bumped on each flush, caches of the other threads drop all their runs once
+ * they notice the change. A font face may be freed from any thread and a new
+ * one may be allocated at the very same address.
+ */
+static unsigned int flush_gen;
+
+static void cache_flush(const gp_font_face *font)
+{
+	unsigned int i;
+
+	for (i = 0; i < cache->size; i++) {
+		gp_text_run *run = cache->runs[i];
+
+		if (!run)
+			continue;
+
+		if (font && run->style.font != font)
+			continue;
+
+		free(run);
+		cache->runs[i] = NULL;
+		cache->used--;
+	}
+}
+
+int gp_text_cache_init(unsigned int order)
+{
+	unsigned int size;
+
+	if (cache)
+		return 0;
+
+	if (!order)
+		order = 8;
+
+	size = 1u << order;
+
+	cache = calloc(1, sizeof(*cache) + size * sizeof(gp_text_run *));
+	if (!cache) {
+		GP_WARN("Malloc failed :-(");
+		return 1;
+	}
+
+	cache->size = size;
+	cache->gen = __atomic_load_n(&flush_gen, __ATOMIC_ACQUIRE);
+
+	GP_DEBUG(1, "Text run cache with %u slots enabled", size);
+
+	return 0;
+}
+
+void gp_text_cache_exit(void)
+{
+	if (!cache)
+		return;
+
+	cache_flush(NULL);
+
+	free(cache);
+	cache = NULL;
+}
+
+void gp_text_cache_flush(const gp_font_face *font)
+{
+	unsigned int gen;
+
+	gen = __atomic_add_fetch(&flush_gen, 1, __ATOMIC_ACQ_REL);
+
+	if (!cache)
+		return;
+
+	/* Drop everything if we missed a flush from another thread */
+	if (cache->gen + 1 != gen)
+		font = NULL;
+
+	cache->gen = gen;
+
+	cache_flush(font);
+}
+
+static uint32_t fnv1a(uint32_t h, const void *data, size_t len)
+{
+	const uint8_t *buf = data;
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		h ^= buf[i];
+		h *= 16777619;
+	}
+
+	return h;
+}
+
+static uint32_t run_hash(const gp_text_style *style, const char *str, size_t len)
+{
+	uint32_t h = 2166136261u;
+
+	h = fnv1a(h, &style->font, sizeof(style->font));
+	h = fnv1a(h, &style->pixel_xspace, sizeof(style->pixel_xspace));
+	h = fnv1a(h, &style->pixel_yspace, sizeof(style->pixel_yspace));
+	h = fnv1a(h, &style->pixel_xmul, sizeof(style->pixel_xmul));
+	h = fnv1a(h, &style->pixel_ymul, sizeof(style->pixel_ymul));
+	h = fnv1a(h, &style->char_xspace, sizeof(style->char_xspace));
+
+	return fnv1a(h, str, len);
+}
+
+static int style_eq(const gp_text_style *a, const gp_text_style *b)
+{
+	return a->font == b->font &&
+	       a->pixel_xspace == b->pixel_xspace &&
+	       a->pixel_yspace == b->pixel_yspace &&
+	       a->pixel_xmul == b->pixel_xmul &&
+	       a->pixel_ymul == b->pixel_ymul &&
+	       a->char_xspace == b->char_xspace;
+}
+
+static gp_text_run *run_new(const gp_text_style *style, const char *str,
+                            size_t bytes, uint32_t hash)
+{
+	size_t len = gp_utf8_strlen(str);
+	size_t chars_size = len * sizeof(uint32_t);
+	size_t pos_size = (len + 1) * sizeof(gp_size);
+	gp_text_run *run;
+	const char *s = str;
+	size_t i;
+
+	/* The run, characters, glyph offsets and string in one chunk */
+	run = malloc(sizeof(*run) + chars_size + pos_size + bytes + 1);
+	if (!run) {
+		GP_WARN("Malloc failed :-(");
+		return NULL;
+	}
+
+	run->hash = hash;
+	run->len = len;
+	run->style = *style;
+	run->chars = (void*)run + sizeof(*run);
+	run->pos = (void*)run->chars + chars_size;
+	run->str = memcpy((void*)run->pos + pos_size, str, bytes + 1);
+
+	for (i = 0; i < len; i++)
+		run->chars[i] = gp_utf8_next(&s);
+
+	text_run_layout(run);
+
+	return run;
+}
+
+const gp_text_run *gp_text_run_get(const gp_text_style *style, const char *str)
+{
+	gp_text_run *run;
+	unsigned int slot, gen;
+	uint32_t hash;
+	size_t bytes;
+
+	if (!cache || !str || !*str)
+		return NULL;
+
+	if (!style)
+		style = &gp_default_style;
+
+	gen = __atomic_load_n(&flush_gen, __ATOMIC_ACQUIRE);
+	if (cache->gen != gen) {
+		cache->gen = gen;
+		cache_flush(NULL);
+	}
+
+	bytes = strnlen(str, GP_TEXT_RUN_MAX_BYTES);
+	if (bytes >= GP_TEXT_RUN_MAX_BYTES)
+		return NULL;
+
+	hash = run_hash(style, str, bytes);
+	slot = hash & (cache->size - 1);
+	run = cache->runs[slot];
+
+	if (run && run->hash == hash && style_eq(&run->style, style) &&
+	    !strcmp(run->str, str)) {
+		cache->hits++;
+		return run;
+	}
+
+	cache->misses++;
+
+	run = run_new(style, str, bytes, hash);
+	if (!run)
+		return NULL;
+
+	if (cache->runs[slot])
+		free(cache->runs[slot]);
+	else
+		cache->used++;
+
+	cache->runs[slot] = run;
+
+	return run;
+}
+
+void gp_text_cache_stats_get(gp_text_cache_stats *stats)
+{
+	if (!cache) {
+		memset(stats, 0, sizeof(*stats));
+		return;
+	}
+
+	stats->hits = cache->hits;
+	stats->misses = cache->misses;
+	stats->used = cache->used;
+	stats->size = cache->size;
+}
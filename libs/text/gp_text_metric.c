@@ -10,6 +10,7 @@
 #include <core/gp_common.h>
 #include <utils/gp_utf.h>
 #include <text/gp_text_metric.h>
+#include <text/gp_text_cache.h>
 
 extern gp_text_style gp_default_style;
 
@@ -18,16 +19,14 @@ static unsigned int multiply_width(const gp_text_style *style, unsigned int w)
 	return w * style->pixel_xmul + (w - 1) * style->pixel_xspace;
 }
 
-static gp_size glyph_advance_x(const gp_text_style *style, uint32_t ch)
+static gp_size glyph_advance_x(const gp_text_style *style, const gp_glyph *glyph)
 {
-	const gp_glyph *glyph = gp_glyph_get(style->font, ch);
-
 	return multiply_width(style, glyph->advance_x);
 }
 
 gp_size gp_glyph_advance_x(const gp_text_style *style, uint32_t ch)
 {
-	return glyph_advance_x(style, ch) + style->char_xspace;
+	return glyph_advance_x(style, gp_glyph_get(style->font, ch)) + style->char_xspace;
 }
 
 gp_ssize gp_glyph_bearing_x(const gp_text_style *style, uint32_t ch)
@@ -46,7 +45,7 @@ static unsigned int max_glyph_advance_x(const gp_text_style *style,
 	unsigned int max = 0, i;
 
 	for (i = 0; str[i] != '\0'; i++)
-		max = GP_MAX(max, glyph_advance_x(style, str[i]));
+		max = GP_MAX(max, glyph_advance_x(style, gp_glyph_get(style->font, str[i])));
 
 	return max;
 }
@@ -55,12 +54,10 @@ static unsigned int max_glyph_advance_x(const gp_text_style *style,
  * Returns _SINGLE_ glyph size, not including the bearing_x and including space
  * occupied by the glyph bitmap if the bitmap width overflows glyph advance_x.
  */
-static unsigned int glyph_width(const gp_text_style *style, uint32_t ch)
+static unsigned int glyph_width(const gp_text_style *style, const gp_glyph *glyph)
 {
 	unsigned int size, advance;
 
-	const gp_glyph *glyph = gp_glyph_get(style->font, ch);
-
 	advance = multiply_width(style, glyph->advance_x - glyph->bearing_x);
 	size    = multiply_width(style, glyph->width);
 
@@ -77,12 +74,10 @@ static unsigned int glyph_width(const gp_text_style *style, uint32_t ch)
  * the exact size of the glyph itself without advance before and space after is
  * not known), so we likely return some more pixels than is needed.
  */
-static unsigned int last_glyph_width(const gp_text_style *style, uint32_t ch)
+static unsigned int last_glyph_width(const gp_text_style *style, const gp_glyph *glyph)
 {
 	unsigned int size, advance;
 
-	const gp_glyph *glyph = gp_glyph_get(style->font, ch);
-
 	advance = multiply_width(style, glyph->advance_x);
 	size = multiply_width(style, glyph->width + glyph->bearing_x);
 
@@ -96,10 +91,8 @@ static unsigned int last_glyph_width(const gp_text_style *style, uint32_t ch)
  * bouding box and even in case it's possitive the returned size would be
  * slightly bigger.
  */
-static unsigned int first_glyph_width(const gp_text_style *style, uint32_t ch)
+static unsigned int first_glyph_width(const gp_text_style *style, const gp_glyph *glyph)
 {
-	const gp_glyph *glyph = gp_glyph_get(style->font, ch);
-
 	return multiply_width(style, glyph->advance_x - glyph->bearing_x);
 }
 
@@ -113,25 +106,20 @@ static const gp_text_style *assert_style(const gp_text_style *style)
 	return style;
 }
 
-gp_size gp_text_width_len(const gp_text_style *style, enum gp_text_len_type type,
-                          const char *str, size_t len)
+static gp_size text_width_len(const gp_text_style *style, enum gp_text_len_type type,
+                              const char *str, size_t len)
 {
 	size_t ret, cnt = 0;
 	uint32_t ch;
 
-	style = assert_style(style);
-
-	if (!str || !*str || !len)
-		return 0;
-
 	ch = gp_utf8_next(&str);
 
 	/* special case, single letter */
 	if (!*str || len == 1)
-		return glyph_width(style, ch);
+		return glyph_width(style, gp_glyph_get(style->font, ch));
 
 	/* first letter */
-	ret = first_glyph_width(style, ch) + style->char_xspace;
+	ret = first_glyph_width(style, gp_glyph_get(style->font, ch)) + style->char_xspace;
 
 	cnt++;
 
@@ -142,17 +130,17 @@ gp_size gp_text_width_len(const gp_text_style *style, enum gp_text_len_type type
 		if (!*str || ++cnt >= len)
 			break;
 
-		ret += glyph_advance_x(style, ch);
+		ret += glyph_advance_x(style, gp_glyph_get(style->font, ch));
 		ret += style->char_xspace;
 	}
 
 	/* last letter */
 	switch (type) {
 	case GP_TEXT_LEN_BBOX:
-		ret += last_glyph_width(style, ch);
+		ret += last_glyph_width(style, gp_glyph_get(style->font, ch));
 	break;
 	case GP_TEXT_LEN_ADVANCE:
-		ret += glyph_advance_x(style, ch) + style->char_xspace;
+		ret += glyph_advance_x(style, gp_glyph_get(style->font, ch)) + style->char_xspace;
 
 		if (*str) {
 			ch = gp_utf8_next(&str);
@@ -164,6 +152,72 @@ gp_size gp_text_width_len(const gp_text_style *style, enum gp_text_len_type type
 	return ret;
 }
 
+void __attribute__((visibility ("hidden"))) text_run_layout(gp_text_run *run)
+{
+	const gp_text_style *style = &run->style;
+	size_t i;
+
+	run->pos[0] = 0;
+
+	if (!run->len)
+		return;
+
+	run->pos[1] = first_glyph_width(style, gp_glyph_get(style->font, run->chars[0])) +
+	              style->char_xspace;
+
+	for (i = 1; i < run->len; i++) {
+		run->pos[i+1] = run->pos[i] + style->char_xspace +
+		                glyph_advance_x(style, gp_glyph_get(style->font, run->chars[i]));
+	}
+}
+
+gp_size gp_text_run_width_len(const gp_text_run *run,
+                              enum gp_text_len_type type, size_t len)
+{
+	const gp_text_style *style = &run->style;
+	size_t cnt = GP_MIN(len, run->len);
+	gp_size ret;
+
+	if (!cnt)
+		return 0;
+
+	/* special case, single letter */
+	if (cnt == 1)
+		return glyph_width(style, gp_glyph_get(style->font, run->chars[0]));
+
+	switch (type) {
+	case GP_TEXT_LEN_BBOX:
+		return run->pos[cnt-1] +
+		       last_glyph_width(style, gp_glyph_get(style->font, run->chars[cnt-1]));
+	case GP_TEXT_LEN_ADVANCE:
+		ret = run->pos[cnt];
+
+		if (cnt < run->len)
+			ret += gp_glyph_bearing_x(style, run->chars[cnt]);
+
+		return ret;
+	}
+
+	return 0;
+}
+
+gp_size gp_text_width_len(const gp_text_style *style, enum gp_text_len_type type,
+                          const char *str, size_t len)
+{
+	const gp_text_run *run;
+
+	style = assert_style(style);
+
+	if (!str || !*str || !len)
+		return 0;
+
+	run = gp_text_run_get(style, str);
+	if (run)
+		return gp_text_run_width_len(run, type, len);
+
+	return text_width_len(style, type, str, len);
+}
+
 gp_size gp_text_width(const gp_text_style *style, enum gp_text_len_type type,const char *str)
 {
 	return gp_text_width_len(style, type, str, SIZE_MAX);
@@ -239,12 +293,25 @@ gp_size gp_text_descent(const gp_text_style *style)
 	return multiply_height(style, gp_font_descent(style->font));
 }
 
+/*
+ * Uses the shaped run, if available, for repeated queries on a single string.
+ */
+static gp_size run_width_len(const gp_text_style *style, const gp_text_run *run,
+                             enum gp_text_len_type type, const char *str, size_t len)
+{
+	if (run)
+		return gp_text_run_width_len(run, type, len);
+
+	return gp_text_width_len(style, type, str, len);
+}
+
 size_t gp_text_fit_width(const gp_text_style *style, const char *str,
                          gp_size width)
 {
+	const gp_text_run *run = gp_text_run_get(assert_style(style), str);
 	size_t left = 0, right = strlen(str);
 	size_t mid = right;
-	gp_size wmid = gp_text_width_len(style, GP_TEXT_LEN_BBOX, str, right);
+	gp_size wmid = run_width_len(style, run, GP_TEXT_LEN_BBOX, str, right);
 
 	//TODO: special case for monospace
 
@@ -253,7 +320,7 @@ size_t gp_text_fit_width(const gp_text_style *style, const char *str,
 
 	while (right - left > 1) {
 		mid = (left + right)/2;
-		wmid = gp_text_width_len(style, GP_TEXT_LEN_BBOX, str, mid);
+		wmid = run_width_len(style, run, GP_TEXT_LEN_BBOX, str, mid);
 
 		if (wmid < width)
 			left = mid;
@@ -276,17 +343,19 @@ size_t gp_text_fit_width(const gp_text_style *style, const char *str,
 
 gp_size gp_text_cur_pos(const gp_text_style *style, const char *str, gp_coord x_off)
 {
+	const gp_text_run *run;
 	size_t len = 0;
 	gp_size last_advance = 0;
 
 	if (x_off <= 0)
 		return 0;
 
-	//TODO: Faster!
+	run = gp_text_run_get(assert_style(style), str);
+
 	while (str[len]) {
 		gp_size advance, half;
 
-		advance = gp_text_width_len(style, GP_TEXT_LEN_ADVANCE, str, len+1);
+		advance = run_width_len(style, run, GP_TEXT_LEN_ADVANCE, str, len+1);
 
 		half = (advance - last_advance)/2;
 
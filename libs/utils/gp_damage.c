@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdint.h>
+
+#include <core/gp_debug.h>
+#include <utils/gp_damage.h>
+
+/*
+ * Two rectangles are merged if the merged rectangle adds at most 1/WASTE_DIV
+ * of its area that was not damaged.
+ */
+#define WASTE_DIV 4
+
+static uint64_t area(gp_bbox box)
+{
+	return (uint64_t)box.w * box.h;
+}
+
+static uint64_t overlap(gp_bbox a, gp_bbox b)
+{
+	gp_coord x0 = GP_MAX(a.x, b.x);
+	gp_coord y0 = GP_MAX(a.y, b.y);
+	gp_coord x1 = GP_MIN(a.x + (gp_coord)a.w, b.x + (gp_coord)b.w);
+	gp_coord y1 = GP_MIN(a.y + (gp_coord)a.h, b.y + (gp_coord)b.h);
+
+	if (x1 <= x0 || y1 <= y0)
+		return 0;
+
+	return (uint64_t)(x1 - x0) * (y1 - y0);
+}
+
+/*
+ * Returns area that would be needlessly updated if a and b were merged.
+ */
+static uint64_t waste(gp_bbox a, gp_bbox b, gp_bbox merged)
+{
+	return area(merged) - area(a) - area(b) + overlap(a, b);
+}
+
+static int should_merge(gp_bbox a, gp_bbox b)
+{
+	gp_bbox merged = gp_bbox_merge(a, b);
+
+	if (overlap(a, b))
+		return 1;
+
+	return waste(a, b, merged) * WASTE_DIV <= area(merged);
+}
+
+static unsigned int least_waste(gp_damage *self, gp_bbox rect)
+{
+	uint64_t min_waste = UINT64_MAX;
+	unsigned int i, ret = 0;
+
+	for (i = 0; i < self->cnt; i++) {
+		gp_bbox merged = gp_bbox_merge(self->rects[i], rect);
+		uint64_t w = waste(self->rects[i], rect, merged);
+
+		if (w < min_waste) {
+			min_waste = w;
+			ret = i;
+		}
+	}
+
+	return ret;
+}
+
+static gp_bbox take(gp_damage *self, unsigned int i, gp_bbox rect)
+{
+	gp_bbox merged = gp_bbox_merge(self->rects[i], rect);
+
+	self->rects[i] = self->rects[--self->cnt];
+
+	return merged;
+}
+
+void gp_damage_add(gp_damage *self, gp_bbox rect)
+{
+	unsigned int i;
+
+	if (gp_bbox_empty(rect))
+		return;
+
+	/*
+	 * The merged rectangle is bigger and may overlap with rectangles that
+	 * were checked before, hence we start again after each merge.
+	 */
+	for (i = 0; i < self->cnt; i++) {
+		if (should_merge(self->rects[i], rect)) {
+			rect = take(self, i, rect);
+			i = -1;
+		}
+	}
+
+	while (self->cnt >= GP_DAMAGE_RECTS) {
+		rect = take(self, least_waste(self, rect), rect);
+
+		for (i = 0; i < self->cnt; i++) {
+			if (overlap(self->rects[i], rect)) {
+				rect = take(self, i, rect);
+				i = -1;
+			}
+		}
+	}
+
+	GP_DEBUG(4, "Adding damaged rect " GP_BBOX_FMT, GP_BBOX_PARS(rect));
+
+	self->rects[self->cnt++] = rect;
+}
+
+gp_bbox gp_damage_bbox(const gp_damage *self)
+{
+	gp_bbox ret = {};
+	unsigned int i;
+
+	for (i = 0; i < self->cnt; i++) {
+		if (i)
+			ret = gp_bbox_merge(ret, self->rects[i]);
+		else
+			ret = self->rects[i];
+	}
+
+	return ret;
+}
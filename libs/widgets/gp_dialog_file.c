@@ -34,17 +34,29 @@ struct file_dialog {
 	gp_widget *file_table;
 	gp_widget *open_save_btn;
 
+	/* Set when filter flags have to be updated before listing */
+	int refilter;
+
+	/* Loads large directories in the background */
+	gp_task populate_task;
+
 	const gp_dialog_file_opts *opts;
 };
 
-static int redraw_table(gp_widget_event *ev)
+static void refilter_table(struct file_dialog *dialog)
+{
+	dialog->refilter = 1;
+	gp_widget_redraw(dialog->file_table);
+}
+
+static int show_hidden_on_event(gp_widget_event *ev)
 {
 	struct file_dialog *dialog = ev->self->priv;
 
 	if (ev->type != GP_WIDGET_EVENT_WIDGET)
 		return 0;
 
-	gp_widget_redraw(dialog->file_table);
+	refilter_table(dialog);
 
 	return 0;
 }
@@ -65,37 +77,31 @@ static const char *dialog_filter(struct file_dialog *dialog)
 	return gp_widget_tbox_text(dialog->filter);
 }
 
-static int find_next(gp_widget *self)
+/*
+ * Updates filter flags for all entries so that the table rows can be accessed
+ * by an index into the filtered entries.
+ */
+static void filter_entries(struct file_dialog *dialog, gp_dir_cache *cache)
 {
-	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(self);
-	gp_dir_cache *cache = tbl_priv->priv;
-	int show_hidden = dialog_show_hidden(self->priv);
-	const char *str = dialog_filter(self->priv);
+	int show_hidden = dialog_show_hidden(dialog);
+	const char *str = dialog_filter(dialog);
 	size_t str_len = strlen(str);
-	gp_dir_entry *entry;
+	unsigned int i;
 
-	for (;;) {
+	for (i = 0; i < cache->used; i++) {
+		gp_dir_entry *entry = gp_dir_cache_get(cache, i);
 		int filter = 0;
 
-		if (tbl_priv->row_idx >= cache->used)
-			return 0;
-
-		entry = gp_dir_cache_get(cache, tbl_priv->row_idx);
-
 		if ((str_len) && !strstr(entry->name, str))
 			filter = 1;
 
 		if (!show_hidden && (entry->name[0] == '.' && entry->name[1] != '.'))
 			filter = 1;
 
-		if (filter) {
-			gp_dir_cache_set_filter(cache, tbl_priv->row_idx, 1);
-			tbl_priv->row_idx++;
-		} else {
-			gp_dir_cache_set_filter(cache, tbl_priv->row_idx, 0);
-			return 1;
-		}
+		gp_dir_cache_set_filter(cache, i, filter);
 	}
+
+	dialog->refilter = 0;
 }
 
 static enum gp_poll_event_ret notify_callback(gp_fd *self)
@@ -104,11 +110,27 @@ static enum gp_poll_event_ret notify_callback(gp_fd *self)
 	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(dialog->file_table);
 
 	if (gp_dir_cache_notify(tbl_priv->priv))
-		gp_widget_redraw(dialog->file_table);
+		refilter_table(dialog);
 
 	return 0;
 }
 
+static int populate_callback(gp_task *self)
+{
+	struct file_dialog *dialog = self->priv;
+	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(dialog->file_table);
+	gp_dir_cache *cache = tbl_priv->priv;
+	size_t used = gp_dir_cache_entries(cache);
+	int ret = gp_dir_cache_populate(cache);
+
+	if (used != gp_dir_cache_entries(cache))
+		refilter_table(dialog);
+	else
+		gp_widget_redraw(dialog->file_table);
+
+	return ret;
+}
+
 static gp_dir_cache *load_dir_cache(struct file_dialog *dialog)
 {
 	gp_dir_cache *cache;
@@ -125,6 +147,14 @@ static gp_dir_cache *load_dir_cache(struct file_dialog *dialog)
 		gp_widget_poll_add(notify_fd);
 	}
 
+	dialog->populate_task.id = "dir cache populate";
+	dialog->populate_task.prio = GP_TASK_MAX_PRIO;
+	dialog->populate_task.callback = populate_callback;
+	dialog->populate_task.priv = dialog;
+	gp_widgets_task_ins(&dialog->populate_task);
+
+	dialog->refilter = 1;
+
 	return cache;
 }
 
@@ -141,19 +171,33 @@ static void free_dir_cache(struct file_dialog *dialog)
 	if (notify_fd)
 		gp_widget_poll_rem(notify_fd);
 
+	if (dialog->populate_task.queued)
+		gp_widgets_task_rem(&dialog->populate_task);
+
 	gp_dir_cache_destroy(self);
 
 	tbl_priv->priv = NULL;
 }
 
-static int files_seek_row(gp_widget *self, int op, unsigned int pos)
+static gp_dir_cache *get_dir_cache(gp_widget *self)
 {
 	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(self);
 	gp_dir_cache *cache = tbl_priv->priv;
-	unsigned int i;
+	struct file_dialog *dialog = self->priv;
 
 	if (!cache)
-		cache = tbl_priv->priv = load_dir_cache(self->priv);
+		cache = tbl_priv->priv = load_dir_cache(dialog);
+
+	if (cache && dialog->refilter)
+		filter_entries(dialog, cache);
+
+	return cache;
+}
+
+static int files_seek_row(gp_widget *self, int op, unsigned int pos)
+{
+	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(self);
+	gp_dir_cache *cache = get_dir_cache(self);
 
 	if (!cache)
 		return 0;
@@ -161,23 +205,28 @@ static int files_seek_row(gp_widget *self, int op, unsigned int pos)
 	switch (op) {
 	case GP_TABLE_ROW_RESET:
 		tbl_priv->row_idx = 0;
-		find_next(self);
 	break;
 	case GP_TABLE_ROW_ADVANCE:
-		for (i = 0; i < pos; i++) {
-			tbl_priv->row_idx++;
-			if (!find_next(self))
-				return 0;
-		}
+		tbl_priv->row_idx += pos;
 	break;
 	case GP_TABLE_ROW_MAX:
-		return -1;
+		return gp_dir_cache_entries_filter(cache);
 	}
 
-	if (tbl_priv->row_idx < cache->used)
-		return 1;
+	return tbl_priv->row_idx < gp_dir_cache_entries_filter(cache);
+}
 
-	return 0;
+static int files_set_row(gp_widget *self, unsigned int row)
+{
+	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(self);
+	gp_dir_cache *cache = get_dir_cache(self);
+
+	if (!cache)
+		return 0;
+
+	tbl_priv->row_idx = row;
+
+	return row < gp_dir_cache_entries_filter(cache);
 }
 
 enum file_attr {
@@ -192,7 +241,7 @@ static int files_get_cell(gp_widget *self, gp_widget_table_cell *cell, unsigned
 	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(self);
 	gp_dir_cache *cache = tbl_priv->priv;
 
-	gp_dir_entry *ent = gp_dir_cache_get(cache, tbl_priv->row_idx);
+	gp_dir_entry *ent = gp_dir_cache_get_filtered(cache, tbl_priv->row_idx);
 
 	if (!ent)
 		return 0;
@@ -203,11 +252,17 @@ static int files_get_cell(gp_widget *self, gp_widget_table_cell *cell, unsigned
 		cell->tattr = GP_TATTR_LEFT;
 	break;
 	case FILE_SIZE:
-		cell->text = gp_str_file_size(buf, sizeof(buf), ent->size);
+		if (ent->stat_pending)
+			cell->text = "";
+		else
+			cell->text = gp_str_file_size(buf, sizeof(buf), ent->size);
 		cell->tattr = GP_TATTR_RIGHT | GP_TATTR_MONO;
 	break;
 	case FILE_MOD_TIME:
-		cell->text = gp_str_time_diff(buf, sizeof(buf), ent->mtime, time(NULL));
+		if (ent->stat_pending)
+			cell->text = "";
+		else
+			cell->text = gp_str_time_diff(buf, sizeof(buf), ent->mtime, time(NULL));
 		cell->tattr = GP_TATTR_LEFT;
 	break;
 	}
@@ -473,7 +528,7 @@ static int table_on_event(gp_widget_event *ev)
 				return 0;
 
 			gp_widget_tbox_clear(dialog->filter);
-			gp_widget_redraw(ev->self);
+			refilter_table(dialog);
 			return 1;
 		}
 
@@ -499,6 +554,7 @@ const gp_widget_table_col_ops gp_dialog_files_col_ops = {
 	.get_cell = files_get_cell,
 	.sort = files_sort,
 	.seek_row = files_seek_row,
+	.set_row = files_set_row,
 	.col_map = {
 		{.id = "name", .idx = FILE_NAME, .sortable = 1},
 		{.id = "size", .idx = FILE_SIZE, .sortable = 1},
@@ -571,6 +627,8 @@ static int new_dir_on_event(gp_widget_event *ev)
 		goto ret1;
 	}
 
+	filter_entries(dialog, cache);
+
 	pos = gp_dir_cache_pos_by_name_filtered(cache, dir_name);
 
 	gp_widget_table_off_set(dialog->file_table, pos);
@@ -622,7 +680,7 @@ static int filter_on_event(gp_widget_event *ev)
 		return !gp_dir_cache_entry_name_contains(cache, gp_widget_tbox_text(ev->self));
 	break;
 	case GP_WIDGET_TBOX_EDIT:
-		gp_widget_redraw(dialog->file_table);
+		refilter_table(dialog);
 		//TODO: We need stable selected row!!
 		//enable_disable_open_btn(dialog);
 	break;
@@ -729,7 +787,7 @@ gp_dialog *gp_dialog_file_save_new(const char *path,
 	}
 
 	if (dialog->show_hidden)
-		gp_widget_on_event_set(dialog->show_hidden, redraw_table, dialog);
+		gp_widget_on_event_set(dialog->show_hidden, show_hidden_on_event, dialog);
 
 	gp_widget_tbox_printf(dialog->dir_path, "%s", get_path(path));
 
@@ -794,7 +852,7 @@ gp_dialog *gp_dialog_file_open_new(const char *path,
 	}
 
 	if (dialog->show_hidden)
-		gp_widget_on_event_set(dialog->show_hidden, redraw_table, dialog);
+		gp_widget_on_event_set(dialog->show_hidden, show_hidden_on_event, dialog);
 
 	gp_widget_tbox_printf(dialog->dir_path, "%s", get_path(path));
 
@@ -14,6 +14,7 @@
 #include <stdio.h>
 #include <errno.h>
 
+#include <core/gp_common.h>
 #include <core/gp_debug.h>
 #include <utils/gp_block_alloc.h>
 #include <widgets/gp_dir_cache.h>
@@ -21,7 +22,7 @@
 static void add_entry(gp_dir_cache *self, gp_dir_entry *entry)
 {
 	if (self->used >= self->size) {
-		size_t new_size = self->size + 50;
+		size_t new_size = GP_MAX(64u, 2 * self->size);
 		void *entries;
 
 		entries = realloc(self->entries, new_size * sizeof(void*));
@@ -35,6 +36,7 @@ static void add_entry(gp_dir_cache *self, gp_dir_entry *entry)
 	}
 
 	self->entries[self->used++] = entry;
+	self->filtered_idx_valid = 0;
 }
 
 gp_dir_entry *gp_dir_cache_add_entry(gp_dir_cache *self, size_t size,
@@ -56,6 +58,8 @@ gp_dir_entry *gp_dir_cache_add_entry(gp_dir_cache *self, size_t size,
 
 	entry->size = size;
 	entry->is_dir = is_dir;
+	entry->filtered = 0;
+	entry->stat_pending = 0;
 	entry->name_len = name_len;
 	entry->mtime = mtime;
 	sprintf(entry->name, "%s%s", name, is_dir ? "/" : "");
@@ -73,7 +77,11 @@ int gp_dir_cache_rem_entry_by_name(gp_dir_cache *self, const char *name)
 
 	for (i = 0; i < self->used; i++) {
 		if (!strcmp(self->entries[i]->name, name)) {
+			if (self->entries[i]->filtered)
+				self->filtered--;
+
 			self->entries[i] = self->entries[--self->used];
+			self->filtered_idx_valid = 0;
 			return 0;
 		}
 	}
@@ -85,6 +93,7 @@ void gp_dir_cache_free_entries(gp_dir_cache *self)
 {
 	gp_bfree(&self->allocator);
 	free(self->entries);
+	free(self->filtered_idx);
 }
 
 static int cmp_asc_name(const void *a, const void *b)
@@ -164,6 +173,7 @@ void gp_dir_cache_sort(gp_dir_cache *self, gp_dir_cache_sort_type  sort_type)
 		return;
 
 	self->sort_type = sort_type;
+	self->filtered_idx_valid = 0;
 
 	if (strcmp(self->entries[0]->name, "../"))
 		qsort(self->entries, self->used, sizeof(void*), cmp_func);
@@ -171,19 +181,86 @@ void gp_dir_cache_sort(gp_dir_cache *self, gp_dir_cache_sort_type  sort_type)
 		qsort(self->entries+1, self->used-1, sizeof(void*), cmp_func);
 }
 
-gp_dir_entry *gp_dir_cache_get_filtered(gp_dir_cache *self, unsigned int pos)
+void gp_dir_cache_merge(gp_dir_cache *self, size_t first_new)
+{
+	int (*cmp_func)(const void *, const void *) = cmp_funcs[self->sort_type];
+	size_t start = 0, new_cnt = self->used - first_new;
+	gp_dir_entry **new;
+	size_t i, j, k;
+
+	if (!cmp_func || !new_cnt)
+		return;
+
+	self->filtered_idx_valid = 0;
+
+	/* The "../" entry is always first */
+	if (!strcmp(self->entries[0]->name, "../"))
+		start = 1;
+
+	if (first_new <= start) {
+		qsort(self->entries + start, self->used - start, sizeof(void*), cmp_func);
+		return;
+	}
+
+	qsort(self->entries + first_new, new_cnt, sizeof(void*), cmp_func);
+
+	new = malloc(new_cnt * sizeof(void*));
+	if (!new) {
+		GP_DEBUG(1, "Malloc failed :-(");
+		qsort(self->entries + start, self->used - start, sizeof(void*), cmp_func);
+		return;
+	}
+
+	memcpy(new, self->entries + first_new, new_cnt * sizeof(void*));
+
+	/* Merge from the end so that the sorted entries are moved only once */
+	i = first_new;
+	j = new_cnt;
+	k = self->used;
+
+	while (j) {
+		if (i > start && cmp_func(&self->entries[i-1], &new[j-1]) > 0)
+			self->entries[--k] = self->entries[--i];
+		else
+			self->entries[--k] = new[--j];
+	}
+
+	free(new);
+}
+
+static int build_filtered_idx(gp_dir_cache *self)
 {
 	unsigned int n, cur_pos = 0;
+	unsigned int *idx;
 
-	for (n = 0; n < self->used; n++) {
-		if (self->entries[n]->filtered)
-			continue;
+	idx = realloc(self->filtered_idx, GP_MAX(self->size, 1u) * sizeof(*idx));
+	if (!idx) {
+		GP_DEBUG(1, "Realloc failed :-(");
+		return 1;
+	}
 
-		if (cur_pos++ == pos)
-			return self->entries[n];
+	self->filtered_idx = idx;
+
+	for (n = 0; n < self->used; n++) {
+		if (!self->entries[n]->filtered)
+			idx[cur_pos++] = n;
 	}
 
-	return NULL;
+	self->filtered = self->used - cur_pos;
+	self->filtered_idx_valid = 1;
+
+	return 0;
+}
+
+gp_dir_entry *gp_dir_cache_get_filtered(gp_dir_cache *self, unsigned int pos)
+{
+	if (!self->filtered_idx_valid && build_filtered_idx(self))
+		return NULL;
+
+	if (pos >= self->used - self->filtered)
+		return NULL;
+
+	return self->entries[self->filtered_idx[pos]];
 }
 
 unsigned int gp_dir_cache_pos_by_name_filtered(gp_dir_cache *self, const char *name)
@@ -205,6 +282,23 @@ unsigned int gp_dir_cache_pos_by_name_filtered(gp_dir_cache *self, const char *n
 	return (unsigned int)-1;
 }
 
+gp_dir_entry *gp_dir_cache_entry_lookup(gp_dir_cache *self, const char *name)
+{
+	size_t n, len = strlen(name);
+
+	/* Directory names are stored with a trailing slash */
+	if (len && name[len-1] == '/')
+		len--;
+
+	for (n = 0; n < self->used; n++) {
+		if (len == self->entries[n]->name_len &&
+		    !strncmp(self->entries[n]->name, name, len))
+			return self->entries[n];
+	}
+
+	return NULL;
+}
+
 int gp_dir_cache_entry_name_contains(gp_dir_cache *self, const char *needle)
 {
 	unsigned int n;
@@ -255,6 +349,14 @@ gp_dir_cache *gp_dir_cache_new(const char *path)
 	return NULL;
 }
 
+__attribute__((weak))
+int gp_dir_cache_populate(gp_dir_cache *self)
+{
+	(void) self;
+
+	return 0;
+}
+
 __attribute__((weak))
 void gp_dir_cache_destroy(gp_dir_cache *self)
 {
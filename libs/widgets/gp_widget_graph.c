@@ -13,6 +13,41 @@
 #include <widgets/gp_widget_render.h>
 #include <widgets/gp_widget_json.h>
 
+/*
+ * A monotonic deque of point sequence numbers.
+ *
+ * The point values in the deque are increasing for a minimum and decreasing
+ * for a maximum, so the sliding window minimum or maximum is the first point.
+ * Each point is inserted and removed at most once so that an update is
+ * amortized O(1).
+ */
+struct minmax {
+	size_t *seq;
+	size_t first;
+	size_t used;
+	/* Set for y coordinate, x otherwise */
+	unsigned int y:1;
+	/* Set for maximum, minimum otherwise */
+	unsigned int max:1;
+};
+
+enum minmax_idx {
+	MIN_X,
+	MAX_X,
+	MIN_Y,
+	MAX_Y,
+	MINMAX_CNT,
+};
+
+/* Y values of points that map into a single pixel column */
+struct graph_col {
+	double first;
+	double last;
+	double min;
+	double max;
+	int used;
+};
+
 struct gp_widget_graph {
 	gp_widget_size min_w;
 	gp_widget_size min_h;
@@ -34,6 +69,30 @@ struct gp_widget_graph {
 	enum gp_widgets_color color;
 	gp_cbuffer data_idx;
 	struct gp_widget_graph_point *data;
+
+	/* Sequence number of the next point, data index is seq % size */
+	size_t seq;
+	/* Sequence number of the last point with x smaller than its predecessor */
+	size_t x_desc_seq;
+	struct minmax minmax[MINMAX_CNT];
+
+	/* Per pixel column data for graphs with more points than pixels */
+	struct graph_col *cols;
+	size_t cols_size;
+
+	/* Dense graph as rendered in the last frame */
+	struct {
+		int valid;
+		gp_coord x, y;
+		gp_size w, h;
+		enum gp_widget_graph_style style;
+		gp_pixel col;
+		double xpp;
+		double min_y;
+		double max_y;
+		long origin;
+		gp_coord last_col;
+	} rendered;
 };
 
 static unsigned int min_w(gp_widget *self, const gp_widget_render_ctx *ctx)
@@ -141,6 +200,357 @@ static void render_fill_graph(struct gp_widget_graph *graph,
 	gp_fill_polygon(pix, 0, 0, pos, poly, col);
 }
 
+/*
+ * Graphs with more points than pixel columns are rendered from per column
+ * minimum and maximum at a cost that depends on the widget width. Points, and
+ * line markers, are drawn only for the column minimum and maximum.
+ *
+ * The columns are aligned to multiples of x per pixel so that when the graph
+ * window slides to the right the columns stay the same and the plot can be
+ * moved instead of rendered again.
+ */
+struct dense_plot {
+	/* Margin around the plot area */
+	gp_size r;
+	/* Plot area size, columns are 0 to pw inclusive */
+	gp_size pw;
+	gp_size ph;
+	/* X per pixel column */
+	double xpp;
+	/* First column x / xpp */
+	long origin;
+};
+
+static void dense_plot_init(struct gp_widget_graph *graph, struct dense_plot *plot,
+                            gp_size w, gp_size h, const gp_widget_render_ctx *ctx)
+{
+	gp_size line_th = (ctx->fr_thick+1)/2;
+
+	switch (graph->graph_style) {
+	case GP_WIDGET_GRAPH_POINT:
+		plot->r = 2 * line_th;
+	break;
+	case GP_WIDGET_GRAPH_LINE:
+		plot->r = line_th;
+	break;
+	default:
+		plot->r = 0;
+	}
+
+	plot->pw = w - 2 * plot->r - 1;
+	plot->ph = h - 2 * plot->r - 1;
+	plot->xpp = (graph->max_x - graph->min_x) / plot->pw;
+}
+
+static int is_dense(struct gp_widget_graph *graph, gp_size w, gp_size h,
+                    const gp_widget_render_ctx *ctx)
+{
+	struct dense_plot plot;
+
+	if (graph->max_x <= graph->min_x)
+		return 0;
+
+	dense_plot_init(graph, &plot, w, h, ctx);
+
+	/* Widget is too small for the margins */
+	if (!plot.pw || plot.pw >= w || plot.ph >= h)
+		return 0;
+
+	return gp_cbuffer_used(&graph->data_idx) > plot.pw;
+}
+
+static gp_coord dense_col(struct dense_plot *plot, double x)
+{
+	long col = floor(x / plot->xpp) - plot->origin;
+
+	return GP_MAX(0, GP_MIN(col, (long)plot->pw));
+}
+
+static void col_add(struct graph_col *col, double y, int rev)
+{
+	if (!col->used) {
+		col->first = col->last = col->min = col->max = y;
+		col->used = 1;
+		return;
+	}
+
+	if (rev)
+		col->first = y;
+	else
+		col->last = y;
+
+	col->min = GP_MIN(col->min, y);
+	col->max = GP_MAX(col->max, y);
+}
+
+static int x_sorted(struct gp_widget_graph *graph)
+{
+	return graph->x_desc_seq <= graph->seq - gp_cbuffer_used(&graph->data_idx);
+}
+
+/*
+ * Fills in columns from col_from to col_to, if x values are sorted only points
+ * in these columns are visited.
+ */
+static int dense_cols(struct gp_widget_graph *graph, struct dense_plot *plot,
+                      gp_coord col_from, gp_coord col_to)
+{
+	int sorted = x_sorted(graph);
+	gp_cbuffer_iter iter;
+	gp_coord c;
+
+	if (graph->cols_size < plot->pw + 1u) {
+		void *cols = realloc(graph->cols, (plot->pw + 1) * sizeof(*graph->cols));
+
+		if (!cols) {
+			GP_WARN("Realloc failed :-(");
+			return 1;
+		}
+
+		graph->cols = cols;
+		graph->cols_size = plot->pw + 1;
+	}
+
+	for (c = col_from; c <= col_to; c++)
+		graph->cols[c].used = 0;
+
+	if (sorted && col_from > 0) {
+		GP_CBUFFER_FOREACH_REV(&graph->data_idx, &iter) {
+			c = dense_col(plot, graph->data[iter.idx].x);
+
+			if (c < col_from)
+				break;
+
+			if (c <= col_to)
+				col_add(&graph->cols[c], graph->data[iter.idx].y, 1);
+		}
+
+		return 0;
+	}
+
+	GP_CBUFFER_FOREACH(&graph->data_idx, &iter) {
+		c = dense_col(plot, graph->data[iter.idx].x);
+
+		if (sorted && c > col_to)
+			break;
+
+		if (c >= col_from && c <= col_to)
+			col_add(&graph->cols[c], graph->data[iter.idx].y, 0);
+	}
+
+	return 0;
+}
+
+/* Renders columns from col_from to col_to */
+static void render_dense(struct gp_widget_graph *graph, struct dense_plot *plot,
+                         gp_pixmap *pix, gp_coord col_from, gp_coord col_to,
+                         const gp_widget_render_ctx *ctx)
+{
+	gp_size line_th = (ctx->fr_thick+1)/2;
+	gp_pixel col = ctx->colors[graph->color];
+	gp_coord poly[2 * (col_to - col_from + 1) + 4];
+	gp_coord c, px, py = 0, off = plot->r;
+	size_t pos = 0;
+	int prev = 0;
+
+	if (graph->graph_style == GP_WIDGET_GRAPH_FILL) {
+		poly[pos++] = col_from + off;
+		poly[pos++] = pix->h - 1;
+	}
+
+	for (c = col_from; c <= col_to; c++) {
+		struct graph_col *gcol = &graph->cols[c];
+
+		if (!gcol->used)
+			continue;
+
+		gp_coord y_top = transform_y(graph, gcol->max, plot->ph) + plot->r;
+		gp_coord y_bot = transform_y(graph, gcol->min, plot->ph) + plot->r;
+
+		px = c + off;
+
+		switch (graph->graph_style) {
+		case GP_WIDGET_GRAPH_LINE:
+			if (prev) {
+				gp_line_th(pix, px - 1, py, px,
+				           transform_y(graph, gcol->first, plot->ph) + plot->r,
+				           line_th, col);
+			}
+
+			gp_line_th(pix, px, y_top, px, y_bot, line_th, col);
+			gp_fill_circle(pix, px, y_top, plot->r, col);
+			gp_fill_circle(pix, px, y_bot, plot->r, col);
+			py = transform_y(graph, gcol->last, plot->ph) + plot->r;
+			prev = 1;
+		break;
+		case GP_WIDGET_GRAPH_POINT:
+			gp_fill_circle(pix, px, y_top, plot->r, col);
+			gp_fill_circle(pix, px, y_bot, plot->r, col);
+		break;
+		case GP_WIDGET_GRAPH_FILL:
+			poly[pos++] = px;
+			poly[pos++] = y_top;
+		break;
+		default:
+		break;
+		}
+	}
+
+	if (graph->graph_style != GP_WIDGET_GRAPH_FILL)
+		return;
+
+	poly[pos++] = col_to + off;
+	poly[pos++] = pix->h - 1;
+
+	gp_fill_polygon(pix, 0, 0, pos/2, poly, col);
+}
+
+/*
+ * Moves the widget content left by mx pixels.
+ *
+ * Returns non-zero if the content cannot be moved and has to be redrawn.
+ */
+static int move_content(gp_pixmap *buf, gp_coord mx)
+{
+	gp_size bpp = gp_pixel_size(buf->pixel_type);
+	size_t len = (buf->w - mx) * (bpp / 8);
+	gp_coord y;
+
+	if (bpp % 8 || buf->axes_swap || buf->x_swap || buf->y_swap)
+		return 1;
+
+	for (y = 0; y < (gp_coord)buf->h; y++) {
+		memmove(GP_PIXEL_ADDR(buf, 0, y),
+		        GP_PIXEL_ADDR(buf, mx, y), len);
+	}
+
+	return 0;
+}
+
+/*
+ * Clears and renders columns that overlap pixels from pix_x to pix_x + w.
+ *
+ * The columns are drawn into the whole pixmap rather than into a subpixmap,
+ * since thick lines are clipped by their centers and would be rasterized
+ * differently. Columns next to the strip are complete and redrawing them only
+ * sets pixels that are already set.
+ */
+static int render_strip(struct gp_widget_graph *graph, gp_pixmap *pix,
+                        struct dense_plot *plot, gp_coord pix_x, gp_size w,
+                        const gp_widget_render_ctx *ctx)
+{
+	/* Column drawing overlaps its neighbours by up to 2 * r + 1 pixels */
+	gp_coord overlap = 2 * plot->r + 1;
+	gp_coord col_from = GP_MAX(0, pix_x - (gp_coord)plot->r - overlap);
+	gp_coord col_to = GP_MIN((gp_coord)plot->pw, pix_x + (gp_coord)w + overlap);
+
+	if (dense_cols(graph, plot, col_from, col_to))
+		return 1;
+
+	gp_fill_rect_xywh(pix, pix_x, 0, w, pix->h, ctx->fg_color);
+
+	render_dense(graph, plot, pix, col_from, col_to, ctx);
+
+	return 0;
+}
+
+/*
+ * If only new points were added to a dense graph and the window moved to the
+ * right, the plot is moved and only the columns that changed are rendered,
+ * i.e. columns after the last rendered column and the first column where
+ * old points expired.
+ *
+ * Returns non-zero if the whole graph has to be rendered.
+ */
+static int render_scroll(struct gp_widget_graph *graph, gp_pixmap *pix,
+                         struct dense_plot *plot, const gp_widget_render_ctx *ctx)
+{
+	gp_pixel col = ctx->colors[graph->color];
+	gp_coord mx, pix_x, strip_w;
+
+	if (!graph->rendered.valid || !x_sorted(graph))
+		return 1;
+
+	if (graph->rendered.style != graph->graph_style ||
+	    graph->rendered.col != col ||
+	    graph->rendered.min_y != graph->min_y ||
+	    graph->rendered.max_y != graph->max_y)
+		return 1;
+
+	/* The range stays the same but the computed value may be off a bit */
+	if (fabs(plot->xpp - graph->rendered.xpp) > 1e-9 * plot->xpp)
+		return 1;
+
+	plot->xpp = graph->rendered.xpp;
+	plot->origin = floor(graph->min_x / plot->xpp);
+
+	mx = plot->origin - graph->rendered.origin;
+	if (mx < 0 || mx >= graph->rendered.last_col)
+		return 1;
+
+	/*
+	 * New points may have been added to the last rendered column, which
+	 * is drawn from one pixel left of it, column zero is drawn up to 2 * r
+	 * + 1 pixels from the widget edge.
+	 */
+	pix_x = graph->rendered.last_col - mx - 1;
+	strip_w = 2 * plot->r + 2;
+
+	if (pix_x <= 2 * strip_w)
+		return 1;
+
+	if (mx && move_content(pix, mx))
+		return 1;
+
+	if (render_strip(graph, pix, plot, pix_x, pix->w - pix_x, ctx))
+		return 1;
+
+	if (render_strip(graph, pix, plot, 0, strip_w, ctx))
+		return 1;
+
+	return 0;
+}
+
+static void render_dense_graph(struct gp_widget_graph *graph, gp_pixmap *pix,
+                               gp_coord x, gp_coord y, int flags,
+                               const gp_widget_render_ctx *ctx)
+{
+	struct dense_plot plot;
+	int full = 1;
+
+	dense_plot_init(graph, &plot, pix->w, pix->h, ctx);
+
+	if (!(flags & (GP_WIDGET_REDRAW | GP_WIDGET_COLOR_SCHEME)) &&
+	    graph->rendered.x == x && graph->rendered.y == y &&
+	    graph->rendered.w == pix->w && graph->rendered.h == pix->h)
+		full = render_scroll(graph, pix, &plot, ctx);
+
+	if (full) {
+		plot.origin = floor(graph->min_x / plot.xpp);
+
+		if (dense_cols(graph, &plot, 0, plot.pw)) {
+			graph->rendered.valid = 0;
+			return;
+		}
+
+		gp_fill(pix, ctx->fg_color);
+		render_dense(graph, &plot, pix, 0, plot.pw, ctx);
+	}
+
+	graph->rendered.valid = 1;
+	graph->rendered.x = x;
+	graph->rendered.y = y;
+	graph->rendered.w = pix->w;
+	graph->rendered.h = pix->h;
+	graph->rendered.style = graph->graph_style;
+	graph->rendered.col = ctx->colors[graph->color];
+	graph->rendered.xpp = plot.xpp;
+	graph->rendered.min_y = graph->min_y;
+	graph->rendered.max_y = graph->max_y;
+	graph->rendered.origin = plot.origin;
+	graph->rendered.last_col = dense_col(&plot, graph->max_x);
+}
+
 static void render(gp_widget *self, const gp_offset *offset,
                    const gp_widget_render_ctx *ctx, int flags)
 {
@@ -151,12 +561,21 @@ static void render(gp_widget *self, const gp_offset *offset,
 	gp_size h = self->h;
 	gp_pixmap pix;
 
-	(void) flags;
+	gp_sub_pixmap(ctx->buf, &pix, x, y, w, h);
+
+	if (gp_cbuffer_used(&graph->data_idx) && is_dense(graph, w, h, ctx)) {
+		render_dense_graph(graph, &pix, x, y, flags, ctx);
+		gp_widget_ops_blit(ctx, x, y, w, h);
+		return;
+	}
+
+	graph->rendered.valid = 0;
 
 	gp_fill_rect_xywh(ctx->buf, x, y, w, h, ctx->fg_color);
         gp_widget_ops_blit(ctx, x, y, w, h);
 
-	gp_sub_pixmap(ctx->buf, &pix, x, y, w, h);
+	if (!gp_cbuffer_used(&graph->data_idx))
+		return;
 
 	switch (graph->graph_style) {
 	case GP_WIDGET_GRAPH_POINT:
@@ -173,6 +592,20 @@ static void render(gp_widget *self, const gp_offset *offset,
 	}
 }
 
+static void free_(gp_widget *self)
+{
+	struct gp_widget_graph *graph = GP_WIDGET_PAYLOAD(self);
+	int i;
+
+	for (i = 0; i < MINMAX_CNT; i++)
+		free(graph->minmax[i].seq);
+
+	free(graph->data);
+	free(graph->cols);
+	free((char *)graph->x_label);
+	free((char *)graph->y_label);
+}
+
 const char *gp_widget_graph_style_names[GP_WIDGET_GRAPH_STYLE_MAX] = {
 	"point",
 	"line",
@@ -296,6 +729,7 @@ struct gp_widget_ops gp_widget_graph_ops = {
 	.min_w = min_w,
 	.min_h = min_h,
 	.render = render,
+	.free = free_,
 	.from_json = json_to_graph,
 	.id = "graph",
 };
@@ -305,6 +739,7 @@ gp_widget *gp_widget_graph_new(gp_widget_size min_w, gp_widget_size min_h,
                                size_t max_data_points)
 {
 	gp_widget *ret;
+	int i;
 
 	ret = gp_widget_new(GP_WIDGET_GRAPH, GP_WIDGET_CLASS_NONE, sizeof(struct gp_widget_graph));
 	if (!ret)
@@ -313,11 +748,20 @@ gp_widget *gp_widget_graph_new(gp_widget_size min_w, gp_widget_size min_h,
 	struct gp_widget_graph *graph = GP_WIDGET_PAYLOAD(ret);
 
 	graph->data = malloc(sizeof(struct gp_widget_graph_point) * max_data_points);
-	if (!graph->data) {
-		free(ret);
-		return NULL;
+	if (!graph->data)
+		goto err;
+
+	for (i = 0; i < MINMAX_CNT; i++) {
+		graph->minmax[i].seq = malloc(sizeof(size_t) * max_data_points);
+		if (!graph->minmax[i].seq)
+			goto err;
 	}
 
+	graph->minmax[MAX_X].max = 1;
+	graph->minmax[MIN_Y].y = 1;
+	graph->minmax[MAX_Y].y = 1;
+	graph->minmax[MAX_Y].max = 1;
+
 	if (x_label)
 		graph->x_label = strdup(x_label);
 
@@ -330,34 +774,85 @@ gp_widget *gp_widget_graph_new(gp_widget_size min_w, gp_widget_size min_h,
 	gp_cbuffer_init(&graph->data_idx, max_data_points);
 
 	return ret;
+err:
+	free_(ret);
+	free(ret);
+	return NULL;
 }
 
-static void new_min_max(struct gp_widget_graph *graph)
+static double point_val(struct gp_widget_graph *graph, size_t seq, int y)
 {
-	gp_cbuffer_iter iter;
+	struct gp_widget_graph_point *point = &graph->data[seq % graph->data_idx.size];
 
-	size_t first = gp_cbuffer_first(&graph->data_idx);
+	return y ? point->y : point->x;
+}
 
-	graph->min_x = graph->data[first].x;
-	graph->max_x = graph->data[first].x;
+static void minmax_push(struct gp_widget_graph *graph, struct minmax *mm,
+                        size_t seq, size_t first_seq)
+{
+	size_t size = graph->data_idx.size;
+	double val = point_val(graph, seq, mm->y);
 
-	if (!graph->min_y_fixed)
-		graph->min_y = graph->data[first].y;
+	/* Drop points that are no longer in the window */
+	while (mm->used && mm->seq[mm->first] < first_seq) {
+		mm->first = (mm->first + 1) % size;
+		mm->used--;
+	}
 
-	if (!graph->max_y_fixed)
-		graph->max_y = graph->data[first].y;
+	/* Drop points that can't be minimum (maximum) while seq is in the window */
+	while (mm->used) {
+		size_t last = mm->seq[(mm->first + mm->used - 1) % size];
+		double last_val = point_val(graph, last, mm->y);
 
-	GP_CBUFFER_FOREACH(&graph->data_idx, &iter) {
-		double x = graph->data[iter.idx].x;
-		double y = graph->data[iter.idx].y;
-
-		graph->min_x = GP_MIN(graph->min_x, x);
-		graph->max_x = GP_MAX(graph->max_x, x);
-		if (!graph->min_y_fixed)
-			graph->min_y = GP_MIN(graph->min_y, y);
-		if (!graph->max_y_fixed)
-			graph->max_y = GP_MAX(graph->max_y, y);
+		if (mm->max ? last_val > val : last_val < val)
+			break;
+
+		mm->used--;
 	}
+
+	mm->seq[(mm->first + mm->used) % size] = seq;
+	mm->used++;
+}
+
+static double minmax_val(struct gp_widget_graph *graph, struct minmax *mm)
+{
+	return point_val(graph, mm->seq[mm->first], mm->y);
+}
+
+static void append_point(struct gp_widget_graph *graph, double x, double y)
+{
+	size_t size = graph->data_idx.size;
+	size_t seq = graph->seq++;
+	size_t first_seq = seq + 1 > size ? seq + 1 - size : 0;
+	size_t pos;
+	int i;
+
+	if (gp_cbuffer_used(&graph->data_idx) &&
+	    x < graph->data[gp_cbuffer_last(&graph->data_idx)].x)
+		graph->x_desc_seq = seq;
+
+	pos = gp_cbuffer_append(&graph->data_idx);
+
+	graph->data[pos].x = x;
+	graph->data[pos].y = y;
+
+	for (i = 0; i < MINMAX_CNT; i++)
+		minmax_push(graph, &graph->minmax[i], seq, first_seq);
+}
+
+static void new_min_max(struct gp_widget_graph *graph)
+{
+	if (!gp_cbuffer_used(&graph->data_idx))
+		return;
+
+	graph->min_x = minmax_val(graph, &graph->minmax[MIN_X]);
+	graph->max_x = minmax_val(graph, &graph->minmax[MAX_X]);
+
+	if (!graph->min_y_fixed)
+		graph->min_y = minmax_val(graph, &graph->minmax[MIN_Y]);
+
+	if (!graph->max_y_fixed)
+		graph->max_y = minmax_val(graph, &graph->minmax[MAX_Y]);
 }
 
 void gp_widget_graph_style_set(gp_widget *self, enum gp_widget_graph_style style)
@@ -383,10 +878,32 @@ void gp_widget_graph_point_add(gp_widget *self, double x, double y)
 	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_GRAPH, );
 	struct gp_widget_graph *graph = GP_WIDGET_PAYLOAD(self);
 
-	size_t pos = gp_cbuffer_append(&graph->data_idx);
+	append_point(graph, x, y);
 
-	graph->data[pos].x = x;
-	graph->data[pos].y = y;
+	new_min_max(graph);
+
+	gp_widget_redraw(self);
+}
+
+void gp_widget_graph_points_add(gp_widget *self,
+                                const struct gp_widget_graph_point *points,
+                                size_t cnt)
+{
+	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_GRAPH, );
+	struct gp_widget_graph *graph = GP_WIDGET_PAYLOAD(self);
+	size_t i;
+
+	if (!cnt)
+		return;
+
+	/* Only the last size points would stay in the buffer */
+	if (cnt > graph->data_idx.size) {
+		points += cnt - graph->data_idx.size;
+		cnt = graph->data_idx.size;
+	}
+
+	for (i = 0; i < cnt; i++)
+		append_point(graph, points[i].x, points[i].y);
 
 	new_min_max(graph);
 
@@ -8,19 +8,62 @@
 
 #include <string.h>
 
-#include <utils/gp_vec.h>
+#include <utils/gp_utf.h>
 
 #include <widgets/gp_widgets.h>
 #include <widgets/gp_widget_ops.h>
 #include <widgets/gp_widget_render.h>
 
+/*
+ * A log line, the text is stored in the log arena.
+ *
+ * The wrapped line breaks are cached until the text width or font changes,
+ * which is tracked by the log wrap_gen generation counter.
+ */
+struct log_line {
+	size_t off;
+	size_t len;
+
+	unsigned int wrap_gen;
+	unsigned int lines;
+	/* Start offsets of wrapped lines, the first line starts at 0 */
+	size_t *breaks;
+};
+
 struct gp_widget_log {
 	gp_widget_tattr tattr;
 	unsigned int min_width;
 	unsigned int min_lines;
 
 	gp_cbuffer log;
-	char **logs;
+	struct log_line *lines;
+
+	/*
+	 * Ring buffer of the log lines text, the lines are stored in the
+	 * same order as in the log and never wrap around the buffer end.
+	 */
+	char *arena;
+	size_t arena_size;
+	size_t arena_head;
+
+	/* Sequence number of the next appended line */
+	size_t seq;
+
+	/* Wrapped line breaks cache key */
+	const gp_text_style *wrap_font;
+	unsigned int wrap_w;
+	unsigned int wrap_gen;
+
+	/* Log as rendered in the last frame */
+	struct {
+		int valid;
+		gp_coord x, y;
+		gp_size w, h;
+		unsigned int line_h;
+		unsigned int wrap_gen;
+		size_t lines;
+		size_t seq;
+	} rendered;
 };
 
 static unsigned int min_w(gp_widget *self, const gp_widget_render_ctx *ctx)
@@ -39,29 +82,172 @@ static unsigned int min_h(gp_widget *self, const gp_widget_render_ctx *ctx)
 	return log->min_lines * (ctx->padd + gp_text_ascent(font)) + ctx->padd;
 }
 
+static void wrap_line(struct gp_widget_log *log, struct log_line *line)
+{
+	const char *text = log->arena + line->off;
+	size_t pos = 0;
+
+	line->wrap_gen = log->wrap_gen;
+	line->lines = 1;
+
+	if (!line->len)
+		return;
+
+	for (;;) {
+		size_t chars = gp_text_fit_width(log->wrap_font, text + pos, log->wrap_w);
+
+		/* Make progress even if a single character does not fit */
+		if (!chars) {
+			int8_t chsz = gp_utf8_next_chsz(text + pos, 0);
+
+			chars = chsz > 0 ? chsz : 1;
+		}
+
+		pos += chars;
+
+		if (pos >= line->len)
+			return;
+
+		size_t *breaks = realloc(line->breaks, line->lines * sizeof(size_t));
+		if (!breaks) {
+			GP_WARN("Realloc failed :-(");
+			return;
+		}
+
+		line->breaks = breaks;
+		line->breaks[line->lines - 1] = pos;
+		line->lines++;
+	}
+}
+
+static unsigned int line_lines(struct gp_widget_log *log, struct log_line *line)
+{
+	if (line->wrap_gen != log->wrap_gen)
+		wrap_line(log, line);
+
+	return line->lines;
+}
+
+/*
+ * Renders wrapped lines of a log line starting at skip line, renders at most
+ * max lines and returns the number of lines rendered.
+ */
+static size_t render_line(struct gp_widget_log *log, struct log_line *line,
+                          gp_coord x, gp_coord y, unsigned int line_h,
+                          size_t skip, size_t max, const gp_widget_render_ctx *ctx)
+{
+	const char *text = log->arena + line->off;
+	size_t i, cnt = 0;
+
+	for (i = skip; i < line->lines && cnt < max; i++, cnt++) {
+		size_t start = i ? line->breaks[i-1] : 0;
+		size_t end = i + 1 < line->lines ? line->breaks[i] : line->len;
+
+		gp_print(ctx->buf, log->wrap_font, x, y + cnt * line_h,
+		         GP_VALIGN_BELOW|GP_ALIGN_RIGHT,
+		         ctx->text_color, ctx->fg_color,
+		         "%.*s", (int)(end - start), text + start);
+	}
+
+	return cnt;
+}
+
+/*
+ * Moves the text area content up by my pixels.
+ *
+ * Returns non-zero if the content cannot be moved and has to be redrawn.
+ */
+static int move_content(gp_pixmap *buf, gp_coord my)
+{
+	gp_size bpp = gp_pixel_size(buf->pixel_type);
+	size_t len = buf->w * (bpp / 8);
+	gp_coord y;
+
+	if (bpp % 8 || buf->axes_swap || buf->x_swap || buf->y_swap)
+		return 1;
+
+	for (y = 0; y + my < (gp_coord)buf->h; y++) {
+		memmove(GP_PIXEL_ADDR(buf, 0, y),
+		        GP_PIXEL_ADDR(buf, 0, y + my), len);
+	}
+
+	return 0;
+}
+
+/*
+ * If lines were only appended since the last frame the text is moved up and
+ * only the new lines are rendered.
+ *
+ * Returns non-zero if the whole log has to be rendered.
+ */
+static int render_new(struct gp_widget_log *log, gp_coord x, gp_coord y,
+                      gp_pixmap *area, size_t render_lines, unsigned int line_h,
+                      const gp_widget_render_ctx *ctx)
+{
+	size_t new_cnt = log->seq - log->rendered.seq;
+	size_t new_lines = 0, old_lines;
+	gp_cbuffer_iter iter;
+
+	if (!new_cnt || new_cnt >= gp_cbuffer_used(&log->log))
+		return 1;
+
+	GP_CBUFFER_FOREACH_REV(&log->log, &iter) {
+		if (iter.cnt >= new_cnt)
+			break;
+
+		new_lines += line_lines(log, &log->lines[iter.idx]);
+	}
+
+	if (new_lines >= render_lines)
+		return 1;
+
+	/* Old lines that stay on the screen are the last old_lines of the last frame */
+	old_lines = render_lines - new_lines;
+
+	if (old_lines > log->rendered.lines)
+		return 1;
+
+	if (move_content(area, (log->rendered.lines - old_lines) * line_h))
+		return 1;
+
+	gp_fill_rect_xywh(area, 0, old_lines * line_h, area->w,
+	                  area->h - old_lines * line_h, ctx->fg_color);
+
+	size_t first = gp_cbuffer_used(&log->log) - new_cnt;
+
+	y += old_lines * line_h;
+
+	GP_CBUFFER_FORRANGE(&log->log, &iter, first, new_cnt) {
+		struct log_line *line = &log->lines[iter.idx];
+
+		y += render_line(log, line, x, y, line_h, 0, line->lines, ctx) * line_h;
+	}
+
+	return 0;
+}
+
 static void render(gp_widget *self, const gp_offset *offset,
                    const gp_widget_render_ctx *ctx, int flags)
 {
-	(void) flags;
-
 	struct gp_widget_log *log = GP_WIDGET_PAYLOAD(self);
 
-	unsigned int x = self->x + offset->x;
-	unsigned int y = self->y + offset->y;
-	unsigned int w = self->w;
-	unsigned int h = self->h;
+	gp_coord x = self->x + offset->x;
+	gp_coord y = self->y + offset->y;
+	gp_size w = self->w;
+	gp_size h = self->h;
 
 	const gp_text_style *font = gp_widget_tattr_font(log->tattr, ctx);
 
 	unsigned int line_h = gp_text_ascent(font) + ctx->padd;
 	unsigned int line_w = w - 2 * ctx->padd;
 
-	gp_widget_ops_blit(ctx, x, y, w, h);
-
-	gp_fill_rrect_xywh(ctx->buf, x, y, w, h, ctx->bg_color, ctx->fg_color, ctx->text_color);
+	if (log->wrap_font != font || log->wrap_w != line_w) {
+		log->wrap_font = font;
+		log->wrap_w = line_w;
+		log->wrap_gen++;
+	}
 
-	if (!gp_cbuffer_used(&log->log))
-		return;
+	gp_widget_ops_blit(ctx, x, y, w, h);
 
 	/* Figure out how many lines we can fit into the box first */
 	size_t box_lines = (h - ctx->padd) / line_h;
@@ -73,56 +259,62 @@ static void render(gp_widget *self, const gp_offset *offset,
 		if (cur_line >= box_lines)
 			break;
 
-		const char *text = log->logs[iter.idx];
-
-		size_t str_width = gp_text_wbbox(font, text);
-		size_t lines_per_str = GP_MAX((size_t)1, str_width / line_w + !!(str_width % line_w));
-
-		cur_line += lines_per_str;
+		cur_line += line_lines(log, &log->lines[iter.idx]);
 	}
 
 	size_t render_lines = GP_MIN(cur_line, box_lines);
 	size_t off_lines = cur_line - render_lines;
-
-	/* Then finally render it */
-	x += ctx->padd;
-	y += ctx->padd;
-
 	size_t count = iter.cnt;
 	size_t first = gp_cbuffer_used(&log->log) - count;
 
-	GP_CBUFFER_FORRANGE(&log->log, &iter, first, count) {
-		const char *line = log->logs[iter.idx];
-		size_t line_len = strlen(line);
-
-		for (;;) {
-			if (!render_lines)
-				return;
-
-			size_t chars = gp_text_fit_width(font, line, line_w);
+	x += ctx->padd;
+	y += ctx->padd;
 
-			if (off_lines) {
-				line_len -= chars;
-				line += chars;
-				off_lines--;
-				continue;
-			}
+	if (!(flags & (GP_WIDGET_REDRAW | GP_WIDGET_COLOR_SCHEME)) &&
+	    log->rendered.valid &&
+	    log->rendered.x == x && log->rendered.y == y &&
+	    log->rendered.w == w && log->rendered.h == h &&
+	    log->rendered.line_h == line_h &&
+	    log->rendered.wrap_gen == log->wrap_gen &&
+	    ctx->fr_round <= ctx->padd && h > ctx->padd + ctx->fr_thick) {
+		gp_pixmap area;
+
+		/*
+		 * The last line descent may overlap the bottom padding, so the
+		 * area spans up to the frame. Frame corners are outside of the
+		 * area as long as the frame roundness is smaller than padding.
+		 */
+		gp_sub_pixmap(ctx->buf, &area, x, y, line_w, h - ctx->padd - ctx->fr_thick);
+
+		if (!render_new(log, x, y, &area, render_lines, line_h, ctx))
+			goto done;
+	}
 
-			gp_print(ctx->buf, font, x, y,
-			         GP_VALIGN_BELOW|GP_ALIGN_RIGHT,
-				 ctx->text_color, ctx->fg_color,
-				 "%.*s", (int)chars, line);
+	gp_fill_rrect_xywh(ctx->buf, x - ctx->padd, y - ctx->padd, w, h,
+	                   ctx->bg_color, ctx->fg_color, ctx->text_color);
 
-			y += line_h;
-			render_lines--;
+	gp_coord line_y = y;
 
-			line_len -= chars;
-			line += chars;
+	GP_CBUFFER_FORRANGE(&log->log, &iter, first, count) {
+		struct log_line *line = &log->lines[iter.idx];
+		size_t lines = render_line(log, line, x, line_y, line_h, off_lines,
+		                           render_lines, ctx);
 
-			if (!line_len)
-				break;
-		}
+		line_y += lines * line_h;
+		render_lines -= lines;
+		off_lines = 0;
 	}
+
+done:
+	log->rendered.valid = 1;
+	log->rendered.x = x;
+	log->rendered.y = y;
+	log->rendered.w = w;
+	log->rendered.h = h;
+	log->rendered.line_h = line_h;
+	log->rendered.wrap_gen = log->wrap_gen;
+	log->rendered.lines = GP_MIN(cur_line, box_lines);
+	log->rendered.seq = log->seq;
 }
 
 enum keys {
@@ -193,13 +385,14 @@ static void free_(gp_widget *self)
 	struct gp_widget_log *log = GP_WIDGET_PAYLOAD(self);
 	gp_cbuffer_iter iter;
 
-	if (!log->logs)
+	if (!log->lines)
 		return;
 
 	GP_CBUFFER_FOREACH(&log->log, &iter)
-		free(log->logs[iter.idx]);
+		free(log->lines[iter.idx].breaks);
 
-	free(log->logs);
+	free(log->lines);
+	free(log->arena);
 }
 
 struct gp_widget_ops gp_widget_log_ops = {
@@ -211,24 +404,142 @@ struct gp_widget_ops gp_widget_log_ops = {
 	.id = "log",
 };
 
+/*
+ * Moves the log lines to the start of a new, larger, arena.
+ */
+static int arena_grow(struct gp_widget_log *log, size_t first, size_t cnt, size_t size)
+{
+	size_t new_size = GP_MAX(2 * log->arena_size, log->arena_size + size);
+	size_t i, idx, off = 0;
+	char *arena;
+
+	new_size = GP_MAX(new_size, (size_t)1024);
+
+	arena = malloc(new_size);
+
+	if (!arena) {
+		GP_WARN("Malloc failed :-(");
+		return 1;
+	}
+
+	for (i = 0, idx = first; i < cnt; i++, idx = gp_cbuffer_next(&log->log, idx)) {
+		struct log_line *line = &log->lines[idx];
+
+		memcpy(arena + off, log->arena + line->off, line->len + 1);
+		line->off = off;
+		off += line->len + 1;
+	}
+
+	free(log->arena);
+
+	log->arena = arena;
+	log->arena_size = new_size;
+	log->arena_head = off;
+
+	return 0;
+}
+
+/*
+ * Allocates size bytes after the last log line. If the log is full the first
+ * log line is about to be evicted and its space is reused as well.
+ */
+static char *arena_alloc(struct gp_widget_log *log, size_t size)
+{
+	size_t used = gp_cbuffer_used(&log->log);
+	size_t first = gp_cbuffer_first(&log->log);
+	size_t head = log->arena_head;
+	size_t tail;
+
+	if (used && used == log->log.size) {
+		first = gp_cbuffer_next(&log->log, first);
+		used--;
+	}
+
+	if (!used) {
+		head = 0;
+		tail = log->arena_size;
+	} else {
+		tail = log->lines[first].off;
+	}
+
+	if (head > tail) {
+		/* Wrap around to the arena start */
+		if (log->arena_size - head < size) {
+			head = 0;
+			if (tail < size)
+				goto grow;
+		}
+	} else if (tail - head < size) {
+		goto grow;
+	}
+
+	log->arena_head = head + size;
+
+	return log->arena + head;
+grow:
+	if (arena_grow(log, first, used, size))
+		return NULL;
+
+	head = log->arena_head;
+	log->arena_head += size;
+
+	return log->arena + head;
+}
+
+static void append(struct gp_widget_log *log, const char *text)
+{
+	size_t len = strlen(text);
+	char *str = arena_alloc(log, len + 1);
+
+	if (!str)
+		return;
+
+	memcpy(str, text, len + 1);
+
+	size_t idx = gp_cbuffer_append(&log->log);
+	struct log_line *line = &log->lines[idx];
+
+	free(line->breaks);
+
+	line->off = str - log->arena;
+	line->len = len;
+	line->wrap_gen = 0;
+	line->breaks = NULL;
+
+	log->seq++;
+}
+
 void gp_widget_log_append(gp_widget *self, const char *text)
 {
 	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_LOG, );
 	struct gp_widget_log *log = GP_WIDGET_PAYLOAD(self);
-	char *str;
 
 	GP_DEBUG(3, "Appending to log widget (%p) '%s'", self, text);
 
-	str = strdup(text);
-	if (!str) {
-		GP_DEBUG(3, "Malloc failed :(");
+	append(log, text);
+
+	gp_widget_redraw(self);
+}
+
+void gp_widget_log_append_lines(gp_widget *self, const char *const lines[], size_t cnt)
+{
+	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_LOG, );
+	struct gp_widget_log *log = GP_WIDGET_PAYLOAD(self);
+	size_t i;
+
+	GP_DEBUG(3, "Appending %zu lines to log widget (%p)", cnt, self);
+
+	if (!cnt)
 		return;
-	}
 
-	size_t idx = gp_cbuffer_append(&log->log);
+	/* Only the last size lines would stay in the log */
+	if (cnt > log->log.size) {
+		lines += cnt - log->log.size;
+		cnt = log->log.size;
+	}
 
-	free(log->logs[idx]);
-	log->logs[idx] = str;
+	for (i = 0; i < cnt; i++)
+		append(log, lines[i]);
 
 	gp_widget_redraw(self);
 }
@@ -258,14 +569,13 @@ gp_widget *gp_widget_log_new(gp_widget_tattr tattr,
 	log->tattr = tattr;
 	log->min_width = min_width;
 	log->min_lines = min_lines;
-	log->logs = malloc(sizeof(char **) * max_logs);
+	log->lines = calloc(max_logs, sizeof(struct log_line));
 
-	if (!log->logs) {
+	if (!log->lines) {
 		gp_widget_free(ret);
 		return NULL;
 	}
 
-	memset(log->logs, 0, sizeof(char **) * max_logs);
 	gp_cbuffer_init(&log->log, max_logs);
 
 	return ret;
@@ -416,8 +416,10 @@ void gp_widget_ops_render(gp_widget *self, const gp_offset *offset,
 
 	ops->render(self, offset, ctx, flags);
 
-	if (ctx->flip)
-		GP_DEBUG(3, "render bbox " GP_BBOX_FMT, GP_BBOX_PARS(*ctx->flip));
+	if (ctx->flip) {
+		GP_DEBUG(3, "render bbox " GP_BBOX_FMT " in %u rects",
+		         GP_BBOX_PARS(gp_damage_bbox(ctx->flip)), ctx->flip->cnt);
+	}
 
 	self->redraw = 0;
 	self->redraw_child = 0;
@@ -8,11 +8,13 @@
 
 #include <errno.h>
 #include <string.h>
+#include <time.h>
 
 #include <core/gp_debug.h>
 #include <core/gp_common.h>
 #include <utils/gp_poll.h>
 #include <utils/gp_user_path.h>
+#include <input/gp_time_stamp.h>
 #include <backends/gp_backends.h>
 
 #include <widgets/gp_widget_render.h>
@@ -271,12 +273,14 @@ static void gp_widget_render_ctx_init(void)
 
 	GP_DEBUG(1, "Initializing fonts and padding");
 	render_ctx_init(backend);
+	gp_text_cache_init(0);
 	initialized = 1;
 }
 
 static void render_and_flip(gp_widget *layout, int render_flags)
 {
-	gp_bbox flip = {};
+	gp_damage flip = {};
+	unsigned int i;
 
 	ctx.flip = &flip;
 	gp_widget_render(layout, &ctx, render_flags);
@@ -285,12 +289,13 @@ static void render_and_flip(gp_widget *layout, int render_flags)
 	if (cur_dialog)
 		gp_rect_xywh(ctx.buf, layout->x, layout->y, layout->w, layout->h, ctx.text_color);
 
-	if (gp_bbox_empty(flip))
+	if (gp_damage_empty(&flip))
 		return;
 
-	GP_DEBUG(1, "Updating area " GP_BBOX_FMT, GP_BBOX_PARS(flip));
+	for (i = 0; i < flip.cnt; i++)
+		GP_DEBUG(1, "Updating area " GP_BBOX_FMT, GP_BBOX_PARS(flip.rects[i]));
 
-	gp_backend_update_rect_xywh(backend, flip.x, flip.y, flip.w, flip.h);
+	gp_backend_update_rects(backend, flip.rects, flip.cnt);
 }
 
 void __attribute__ ((visibility ("hidden"))) widget_render_refresh(void)
@@ -406,6 +411,107 @@ void gp_widgets_redraw(struct gp_widget *layout)
 	render_and_flip(layout, 0);
 }
 
+static gp_widgets_frame_stats frame_stats;
+static uint32_t frame_interval_ms = 16;
+static int frame_immediate = 1;
+static int input_pending;
+static uint64_t last_frame;
+
+void gp_widgets_frame_interval_set(uint32_t interval_ms)
+{
+	frame_interval_ms = interval_ms;
+}
+
+void gp_widgets_frame_immediate_set(int immediate)
+{
+	frame_immediate = !!immediate;
+}
+
+const gp_widgets_frame_stats *gp_widgets_frame_stats_get(void)
+{
+	return &frame_stats;
+}
+
+static uint64_t time_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/*
+ * The timer only wakes up the main loop, the frame is rendered by
+ * gp_widgets_frame_redraw() called from the loop.
+ */
+static uint32_t frame_timer_callback(gp_timer *self)
+{
+	(void) self;
+	return GP_TIMER_STOP;
+}
+
+static gp_timer frame_timer = {
+	.id = "Frame",
+	.callback = frame_timer_callback,
+};
+
+static void frame_render(gp_widget *layout, uint64_t now)
+{
+	uint64_t start, dur;
+
+	if (frame_timer.running)
+		gp_backend_rem_timer(backend, &frame_timer);
+
+	start = time_us();
+	gp_widgets_redraw(layout);
+	dur = time_us() - start;
+
+	last_frame = now;
+	input_pending = 0;
+
+	frame_stats.frames++;
+	frame_stats.last_us = dur;
+	frame_stats.max_us = GP_MAX(frame_stats.max_us, (uint32_t)dur);
+	frame_stats.total_us += dur;
+
+	GP_DEBUG(4, "Frame %lu rendered in %luus",
+	         frame_stats.frames, (unsigned long)dur);
+}
+
+/*
+ * Renders the layout if the frame interval has passed since the last frame,
+ * otherwise schedules a timer to render the frame later.
+ */
+void gp_widgets_frame_redraw(gp_widget *layout)
+{
+	uint64_t now;
+
+	if (!layout->redraw && !layout->redraw_child)
+		return;
+
+	now = gp_time_stamp();
+
+	if (input_pending && frame_immediate) {
+		frame_stats.immediate++;
+		frame_render(layout, now);
+		return;
+	}
+
+	if (!frame_interval_ms || now - last_frame >= frame_interval_ms) {
+		frame_render(layout, now);
+		return;
+	}
+
+	frame_stats.coalesced++;
+
+	if (frame_timer.running)
+		return;
+
+	frame_timer.expires = last_frame + frame_interval_ms - now;
+	gp_backend_add_timer(backend, &frame_timer);
+}
+
 static char *backend_init_str = NULL;
 
 void gp_widget_timer_queue_switch(gp_timer **);
@@ -579,6 +685,10 @@ int gp_widgets_event(gp_event *ev, gp_widget *layout)
 
 	gp_handle_key_repeat_timer(ev);
 
+	/* Keys and buttons bypass the frame pacing, pointer motion does not */
+	if (ev->type == GP_EV_KEY)
+		input_pending = 1;
+
 	switch (ev->type) {
 	case GP_EV_KEY:
 		if (ev->code == GP_EV_KEY_DOWN) {
@@ -793,7 +903,7 @@ long gp_dialog_run(gp_dialog *dialog)
 			return dialog->retval;
 		}
 
-		gp_widgets_redraw(dialog->layout);
+		gp_widgets_frame_redraw(dialog->layout);
 	}
 }
 
@@ -828,7 +938,7 @@ void gp_widgets_main_loop(gp_widget *layout,
 	for (;;) {
 		gp_backend_wait(backend);
 		gp_widgets_process_events(win_layout);
-		gp_widgets_redraw(win_layout);
+		gp_widgets_frame_redraw(win_layout);
 	}
 }
 
@@ -848,6 +958,7 @@ void gp_widgets_quit(void)
 	gp_font_face_free(render_font_bold);
 	gp_font_face_free(render_font_big);
 	gp_font_face_free(render_font_big_bold);
+	gp_text_cache_exit();
 	gp_poll_clear(&backend->fds);
 }
 
@@ -18,6 +18,10 @@ struct scroll_area_payload {
 	gp_coord x_off;
 	gp_coord y_off;
 
+	/* offset the content in the buffer was rendered with */
+	gp_coord rendered_x_off;
+	gp_coord rendered_y_off;
+
 	/*
 	 * If non-zero the widget minimal size is set into the stone
 	 * and the content scrolls if the inner widget size is bigger.
@@ -208,6 +212,91 @@ static void draw_horiz_scroll_bar(gp_widget *self, const gp_widget_render_ctx *c
 	gp_fill_rrect_xywh(ctx->buf, x + pos, y + ctx->padd, asc, asc, ctx->bg_color, ctx->fg_color, col);
 }
 
+/*
+ * Moves already rendered content by mx, my pixels. The area frame is drawn over
+ * the buffer edges so only the inside is moved.
+ *
+ * Returns non-zero if the content cannot be moved and has to be redrawn.
+ */
+static int move_content(gp_pixmap *buf, gp_coord mx, gp_coord my)
+{
+	gp_size bpp = gp_pixel_size(buf->pixel_type);
+	gp_pixmap inner;
+	gp_coord y;
+
+	if (bpp % 8 || buf->axes_swap || buf->x_swap || buf->y_swap)
+		return 1;
+
+	if (buf->w <= 2 || buf->h <= 2)
+		return 1;
+
+	gp_sub_pixmap(buf, &inner, 1, 1, buf->w - 2, buf->h - 2);
+
+	if ((gp_size)GP_ABS(mx) >= inner.w || (gp_size)GP_ABS(my) >= inner.h)
+		return 1;
+
+	gp_coord src_x = GP_MAX(0, -mx);
+	gp_coord src_y = GP_MAX(0, -my);
+	gp_coord dst_x = GP_MAX(0, mx);
+	gp_coord dst_y = GP_MAX(0, my);
+	gp_coord h = inner.h - GP_ABS(my);
+	size_t len = (inner.w - GP_ABS(mx)) * (bpp / 8);
+
+	GP_DEBUG(3, "Moving scroll area content by %ix%i", mx, my);
+
+	if (my > 0) {
+		for (y = h - 1; y >= 0; y--) {
+			memmove(GP_PIXEL_ADDR(&inner, dst_x, dst_y + y),
+			        GP_PIXEL_ADDR(&inner, src_x, src_y + y), len);
+		}
+	} else {
+		for (y = 0; y < h; y++) {
+			memmove(GP_PIXEL_ADDR(&inner, dst_x, dst_y + y),
+			        GP_PIXEL_ADDR(&inner, src_x, src_y + y), len);
+		}
+	}
+
+	return 0;
+}
+
+static void render_strip(gp_widget *self, const gp_offset *child_offset,
+                         gp_widget_render_ctx *child_ctx, int flags,
+                         gp_coord x, gp_coord y, gp_size w, gp_size h)
+{
+	struct scroll_area_payload *scroll = GP_WIDGET_PAYLOAD(self);
+	gp_bbox strip = gp_bbox_pack(x, y, w, h);
+
+	child_ctx->bbox = &strip;
+	gp_widget_ops_render(scroll->child, child_offset, child_ctx, flags | GP_WIDGET_REDRAW);
+}
+
+/*
+ * Renders the child after the content has been moved by mx, my, only widgets
+ * in the newly exposed strips are redrawn.
+ */
+static void render_exposed(gp_widget *self, const gp_offset *child_offset,
+                           gp_widget_render_ctx *child_ctx, int flags,
+                           gp_coord mx, gp_coord my)
+{
+	struct scroll_area_payload *scroll = GP_WIDGET_PAYLOAD(self);
+	gp_size w = child_ctx->buf->w;
+	gp_size h = child_ctx->buf->h;
+
+	/* Widgets that changed since the last frame */
+	gp_widget_ops_render(scroll->child, child_offset, child_ctx, flags);
+
+	/* The strips include the edge that was covered by the frame */
+	if (mx > 0)
+		render_strip(self, child_offset, child_ctx, flags, 0, 0, mx + 1, h);
+	else if (mx < 0)
+		render_strip(self, child_offset, child_ctx, flags, w - 1 + mx, 0, 1 - mx, h);
+
+	if (my > 0)
+		render_strip(self, child_offset, child_ctx, flags, 0, 0, w, my + 1);
+	else if (my < 0)
+		render_strip(self, child_offset, child_ctx, flags, 0, h - 1 + my, w, 1 - my);
+}
+
 static void render(gp_widget *self, const gp_offset *offset,
                    const gp_widget_render_ctx *ctx, int flags)
 {
@@ -253,7 +342,30 @@ static void render(gp_widget *self, const gp_offset *offset,
 	//TODO: Propagate flip
 	child_ctx.flip = NULL;
 
-	gp_widget_ops_render(scroll->child, &child_offset, &child_ctx, flags);
+	/*
+	 * If only the offset has changed the content already in the buffer is
+	 * moved and only the exposed part is rendered.
+	 */
+	gp_coord mx = scroll->rendered_x_off - scroll->x_off;
+	gp_coord my = scroll->rendered_y_off - scroll->y_off;
+
+	int moved = 0;
+
+	if (!(flags & (GP_WIDGET_REDRAW | GP_WIDGET_REDRAW_CHILDREN)) && (mx || my)) {
+		if (move_content(&child_buf, mx, my))
+			flags |= GP_WIDGET_REDRAW_CHILDREN;
+		else
+			moved = 1;
+	}
+
+	if (moved)
+		render_exposed(self, &child_offset, &child_ctx, flags, mx, my);
+	else
+		gp_widget_ops_render(scroll->child, &child_offset, &child_ctx, flags);
+
+	scroll->rendered_x_off = scroll->x_off;
+	scroll->rendered_y_off = scroll->y_off;
+
 	gp_rect_xywh(ctx->buf, self->x + offset->x, self->y + offset->y, w, h, text_color);
 }
 
@@ -301,7 +413,6 @@ static void set_y_off(gp_widget *self, int y_off)
 	scroll->y_off = y_off;
 
 	gp_widget_redraw(self);
-	gp_widget_redraw_children(self);
 }
 
 static void set_x_off(gp_widget *self, int x_off)
@@ -324,7 +435,6 @@ static void set_x_off(gp_widget *self, int x_off)
 	scroll->x_off = x_off;
 
 	gp_widget_redraw(self);
-	gp_widget_redraw_children(self);
 }
 
 static void scrollbar_event_y(gp_widget *self, const gp_widget_render_ctx *ctx, gp_event *ev)
@@ -484,6 +594,14 @@ static int focus_child(gp_widget *self, gp_widget *child)
 	return 1;
 }
 
+static void for_each_child(gp_widget *self, void (*func)(gp_widget *child))
+{
+	struct scroll_area_payload *scroll = GP_WIDGET_PAYLOAD(self);
+
+	if (scroll->child)
+		func(scroll->child);
+}
+
 static void distribute_w(gp_widget *self, const gp_widget_render_ctx *ctx, int new_wh)
 {
 	struct scroll_area_payload *scroll = GP_WIDGET_PAYLOAD(self);
@@ -496,6 +614,9 @@ static void distribute_w(gp_widget *self, const gp_widget_render_ctx *ctx, int n
 
 	gp_size child_w = GP_MAX(child_min_w, w);
 
+	gp_widget_ops_distribute_w(scroll->child, ctx, child_w, new_wh);
+
+	/* The offset limit depends on the child size that was just set */
 	gp_coord x_off = max_x_off(self);
 
 	if (scroll->x_off > x_off)
@@ -505,8 +626,6 @@ static void distribute_w(gp_widget *self, const gp_widget_render_ctx *ctx, int n
 		scroll->scrollbar_y = 0;
 	else
 		scroll->scrollbar_y = 1;
-
-	gp_widget_ops_distribute_w(scroll->child, ctx, child_w, new_wh);
 }
 
 static void distribute_h(gp_widget *self, const gp_widget_render_ctx *ctx, int new_wh)
@@ -521,6 +640,9 @@ static void distribute_h(gp_widget *self, const gp_widget_render_ctx *ctx, int n
 
 	gp_size child_h = GP_MAX(child_min_h, h);
 
+	gp_widget_ops_distribute_h(scroll->child, ctx, child_h, new_wh);
+
+	/* The offset limit depends on the child size that was just set */
 	gp_coord y_off = max_y_off(self);
 
 	if (scroll->y_off > y_off)
@@ -530,8 +652,6 @@ static void distribute_h(gp_widget *self, const gp_widget_render_ctx *ctx, int n
 		scroll->scrollbar_x = 0;
 	else
 		scroll->scrollbar_x = 1;
-
-	gp_widget_ops_distribute_h(scroll->child, ctx, child_h, new_wh);
 }
 
 enum keys {
@@ -601,6 +721,7 @@ struct gp_widget_ops gp_widget_scroll_area_ops = {
 	.focus_xy = focus_xy,
 	.focus = focus,
 	.focus_child = focus_child,
+	.for_each_child = for_each_child,
 	.distribute_w = distribute_w,
 	.distribute_h = distribute_h,
 	.from_json = json_to_scroll,
@@ -687,7 +808,6 @@ int gp_widget_scroll_area_move(gp_widget *self, gp_coord x_off, gp_coord y_off)
 		return ret;
 
 	gp_widget_redraw(self);
-	gp_widget_redraw_children(self);
 
 	return 1;
 }
@@ -54,6 +54,19 @@ static inline int seek_row(gp_widget *self, int op, unsigned int pos)
 	return tbl->col_ops.seek_row(self, op, pos);
 }
 
+static int set_row(gp_widget *self, unsigned int row)
+{
+	gp_widget_table *tbl = GP_WIDGET_PAYLOAD(self);
+
+	if (tbl->col_ops.set_row)
+		return tbl->col_ops.set_row(self, row);
+
+	if (!seek_row(self, GP_TABLE_ROW_RESET, 0))
+		return 0;
+
+	return seek_row(self, GP_TABLE_ROW_ADVANCE, row);
+}
+
 static unsigned int header_min_w(gp_widget_table *tbl,
                                  const gp_widget_render_ctx *ctx,
                                  unsigned int col)
@@ -290,8 +303,7 @@ static void render(gp_widget *self, const gp_offset *offset,
 	if (tbl->start_row > tbl->last_rows)
 		tbl->start_row = 0;
 
-	seek_row(self, GP_TABLE_ROW_RESET, 0);
-	seek_row(self, GP_TABLE_ROW_ADVANCE, tbl->start_row);
+	set_row(self, tbl->start_row);
 
 	unsigned int cur_row = tbl->start_row;
 	unsigned int rows = display_rows(self, ctx);
@@ -1027,6 +1039,7 @@ gp_widget *gp_widget_table_new(unsigned int cols, unsigned int min_rows,
 	tbl->col_ops.sort = col_ops->sort;
 	tbl->col_ops.get_cell = col_ops->get_cell;
 	tbl->col_ops.seek_row = col_ops->seek_row;
+	tbl->col_ops.set_row = col_ops->set_row;
 
 	if (col_ops->on_event)
 		gp_widget_on_event_set(ret, col_ops->on_event, col_ops->on_event_priv);
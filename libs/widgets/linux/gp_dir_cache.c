@@ -16,6 +16,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <sys/inotify.h>
+#include <sys/syscall.h>
 
 #include <core/gp_common.h>
 #include <core/gp_debug.h>
@@ -23,11 +24,38 @@
 #include <utils/gp_poll.h>
 #include <widgets/gp_dir_cache.h>
 
+/* Directory entries are read by getdents64() in batches of this size */
+#define DENTS_BUF 32768
+
+/* Maximal number of entries to stat() in one gp_dir_cache_populate() call */
+#define STAT_BATCH 512
+
+struct linux_dirent64 {
+	uint64_t d_ino;
+	int64_t d_off;
+	unsigned short d_reclen;
+	unsigned char d_type;
+	char d_name[];
+};
+
 typedef struct gp_dir_cache_linux {
 	gp_dir_cache dir_cache;
-	DIR *dir;
 	int dirfd;
+	/* Set once all directory entries were read */
+	int eof;
+	/*
+	 * Names added by inotify before eof, getdents64() may return these
+	 * again and has to skip them.
+	 */
+	char **inotify_names;
+	size_t inotify_names_cnt;
 	gp_fd inotify_fd;
+
+	/* Entries waiting for size and mtime */
+	gp_dir_entry **stat_queue;
+	size_t stat_queue_size;
+	size_t stat_queue_used;
+	size_t stat_queue_pos;
 } gp_dir_cache_linux;
 
 static void add_entry(gp_dir_cache_linux *self, const char *name, int mode)
@@ -51,20 +79,172 @@ static void add_entry(gp_dir_cache_linux *self, const char *name, int mode)
 	                       buf.st_mode, buf.st_mtim.tv_sec);
 }
 
-static void populate(gp_dir_cache_linux *self)
+static void stat_queue_add(gp_dir_cache_linux *self, gp_dir_entry *entry)
 {
-	for (;;) {
-		struct dirent *ent;
+	if (self->stat_queue_used >= self->stat_queue_size) {
+		size_t new_size = GP_MAX((size_t)64, 2 * self->stat_queue_size);
+		void *queue;
 
-		ent = readdir(self->dir);
-		if (!ent)
+		queue = realloc(self->stat_queue, new_size * sizeof(void*));
+		if (!queue) {
+			GP_DEBUG(1, "Realloc failed :-(");
 			return;
+		}
+
+		self->stat_queue_size = new_size;
+		self->stat_queue = queue;
+	}
+
+	entry->stat_pending = 1;
+	self->stat_queue[self->stat_queue_used++] = entry;
+}
+
+/*
+ * Adds an entry without a stat() if the entry type is known. Symlinks may
+ * point to a directory and have to be looked up right away.
+ */
+static void add_dirent(gp_dir_cache_linux *self, const char *name, unsigned char type)
+{
+	gp_dir_entry *entry;
+	mode_t mode;
+
+	switch (type) {
+	case DT_DIR:
+		mode = S_IFDIR;
+	break;
+	case DT_REG:
+		mode = S_IFREG;
+	break;
+	default:
+		add_entry(self, name, 0);
+		return;
+	}
+
+	entry = gp_dir_cache_add_entry(&self->dir_cache, 0, name, mode, 0);
+	if (entry)
+		stat_queue_add(self, entry);
+}
+
+static void free_inotify_names(gp_dir_cache_linux *self)
+{
+	size_t i;
+
+	for (i = 0; i < self->inotify_names_cnt; i++)
+		free(self->inotify_names[i]);
+
+	free(self->inotify_names);
+	self->inotify_names = NULL;
+	self->inotify_names_cnt = 0;
+}
+
+/*
+ * Returns non-zero if the entry has been already added by inotify. Each name
+ * is returned by getdents64() once, so matched names are dropped from the list.
+ */
+static int inotify_added(gp_dir_cache_linux *self, const char *name)
+{
+	size_t i;
+
+	for (i = 0; i < self->inotify_names_cnt; i++) {
+		if (strcmp(self->inotify_names[i], name))
+			continue;
+
+		free(self->inotify_names[i]);
+		self->inotify_names[i] = self->inotify_names[--self->inotify_names_cnt];
+		return 1;
+	}
+
+	return 0;
+}
+
+static void populate(gp_dir_cache_linux *self)
+{
+	char buf[DENTS_BUF] __attribute__((aligned(8)));
+	size_t first_new = self->dir_cache.used;
+	long len, off;
+
+	len = syscall(SYS_getdents64, self->dirfd, buf, sizeof(buf));
+	if (len <= 0) {
+		if (len < 0)
+			GP_DEBUG(1, "getdents64(): %s", strerror(errno));
+
+		self->eof = 1;
+		free_inotify_names(self);
+		return;
+	}
+
+	for (off = 0; off < len; ) {
+		struct linux_dirent64 *ent = (void*)(buf + off);
+
+		off += ent->d_reclen;
 
 		if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, ".."))
 			continue;
 
-		add_entry(self, ent->d_name, 0);
+		if (self->inotify_names_cnt && inotify_added(self, ent->d_name))
+			continue;
+
+		add_dirent(self, ent->d_name, ent->d_type);
+	}
+
+	GP_DEBUG(3, "Dir cache %p read %zu entries",
+	         self, self->dir_cache.used - first_new);
+
+	gp_dir_cache_merge(&self->dir_cache, first_new);
+}
+
+static void stat_entries(gp_dir_cache_linux *self)
+{
+	size_t end = GP_MIN(self->stat_queue_used, self->stat_queue_pos + STAT_BATCH);
+	struct stat buf;
+
+	for (; self->stat_queue_pos < end; self->stat_queue_pos++) {
+		gp_dir_entry *entry = self->stat_queue[self->stat_queue_pos];
+
+		entry->stat_pending = 0;
+
+		/* Entries removed by inotify fail here, the memory is still valid */
+		if (fstatat(self->dirfd, entry->name, &buf, 0)) {
+			GP_DEBUG(3, "stat(%s): %s", entry->name, strerror(errno));
+			continue;
+		}
+
+		entry->size = buf.st_size;
+		entry->mtime = buf.st_mtim.tv_sec;
 	}
+
+	if (self->stat_queue_pos < self->stat_queue_used)
+		return;
+
+	free(self->stat_queue);
+	self->stat_queue = NULL;
+	self->stat_queue_size = 0;
+	self->stat_queue_used = 0;
+	self->stat_queue_pos = 0;
+}
+
+int gp_dir_cache_populate(gp_dir_cache *cache)
+{
+	gp_dir_cache_linux *self = GP_CONTAINER_OF(cache, gp_dir_cache_linux, dir_cache);
+
+	if (!self->eof) {
+		populate(self);
+		return 1;
+	}
+
+	if (!self->stat_queue_used)
+		return 0;
+
+	stat_entries(self);
+
+	if (self->stat_queue_used)
+		return 1;
+
+	/* The order was based on unknown values until now */
+	if ((cache->sort_type & ~GP_DIR_SORT_DESC) != GP_DIR_SORT_BY_NAME)
+		gp_dir_cache_sort(cache, cache->sort_type);
+
+	return 0;
 }
 
 static void open_inotify(gp_dir_cache_linux *self, const char *path)
@@ -108,6 +288,29 @@ static void append_slash(struct inotify_event *ev)
 	ev->name[len+1] = 0;
 }
 
+static void inotify_add_entry(gp_dir_cache_linux *self, const char *name, int mode)
+{
+	char **names;
+
+	add_entry(self, name, mode);
+
+	if (self->eof)
+		return;
+
+	names = realloc(self->inotify_names,
+	                (self->inotify_names_cnt + 1) * sizeof(char*));
+	if (!names) {
+		GP_DEBUG(1, "Realloc failed :-(");
+		return;
+	}
+
+	self->inotify_names = names;
+
+	names[self->inotify_names_cnt] = strdup(name);
+	if (names[self->inotify_names_cnt])
+		self->inotify_names_cnt++;
+}
+
 static int parse_inotify_event(gp_dir_cache_linux *self, const char *new_dir, struct inotify_event *ev)
 {
 	GP_DEBUG(3, "EV MASK %x NAME '%s'", ev->mask, ev->name);
@@ -142,12 +345,12 @@ static int parse_inotify_event(gp_dir_cache_linux *self, const char *new_dir, st
 			return 2;
 
 		GP_DEBUG(1, "Created dir '%s'", ev->name);
-		add_entry(self, ev->name, S_IFDIR);
+		inotify_add_entry(self, ev->name, S_IFDIR);
 	break;
 	case IN_MOVED_TO:
 	case IN_CREATE:
 		GP_DEBUG(1, "Created '%s'", ev->name);
-		add_entry(self, ev->name, S_IFREG);
+		inotify_add_entry(self, ev->name, S_IFREG);
 		return 1;
 	break;
 	}
@@ -233,28 +436,22 @@ gp_dir_cache *gp_dir_cache_new(const char *path)
 	open_inotify(cache, path);
 
 	cache->dirfd = open(path, O_DIRECTORY);
-	if (!cache->dirfd) {
+	if (cache->dirfd < 0) {
 		GP_DEBUG(1, "open(%s, O_DIRECTORY): %s", path, strerror(errno));
 		goto err0;
 	}
 
-	cache->dir = opendir(path);
-	if (!cache->dir) {
-		GP_DEBUG(1, "opendir(%s) failed: %s", path, strerror(errno));
-		goto err1;
-	}
-
 	//TODO: handle correctly all variants that resolve to "/"
 	if (strcmp(path, "/"))
 		add_entry(cache, "..", 0);
 
 	populate(cache);
 
-	gp_dir_cache_sort(&cache->dir_cache, cache->dir_cache.sort_type);
+	/* Small directories are loaded completely here */
+	while (cache->dir_cache.used < STAT_BATCH &&
+	       gp_dir_cache_populate(&cache->dir_cache));
 
 	return &cache->dir_cache;
-err1:
-	close(cache->dirfd);
 err0:
 	close_inotify(cache);
 	free(cache);
@@ -269,8 +466,9 @@ void gp_dir_cache_destroy(gp_dir_cache *cache)
 
 	close_inotify(self);
 
-	closedir(self->dir);
 	close(self->dirfd);
+	free(self->stat_queue);
+	free_inotify_names(self);
 	gp_dir_cache_free_entries(cache);
 	free(self);
 }
@@ -0,0 +1,443 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+ * E-ink repaint scheduler tests.
+ *
+ * The scheduler runs against a simulated SPI display driver that records the
+ * repaints it was asked for along with a simulated start and end time. The
+ * busy interrupt is simulated by calling the busy fd callback once the
+ * simulated clock reaches the end of the repaint in progress.
+ */
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <core/gp_core.h>
+#include <backends/gp_backend.h>
+#include "gp_display_eink.h"
+#include "tst_test.h"
+
+#define W 200
+#define H 200
+
+#define MAX_XFERS 64
+
+struct sim_xfer {
+	int full;
+	gp_bbox rect;
+	uint64_t start_us;
+	uint64_t end_us;
+};
+
+static struct sim {
+	gp_backend *backend;
+	struct gp_gpio_map gpio_map;
+	/* simulated time */
+	uint64_t clock_us;
+	/* repaints sent to the display */
+	unsigned int xfer_cnt;
+	struct sim_xfer xfers[MAX_XFERS];
+	int busy;
+	int exitted;
+} sim;
+
+static struct gp_display_eink *sim_eink(void)
+{
+	return GP_BACKEND_PRIV(sim.backend);
+}
+
+static void sim_xfer(int full, gp_bbox rect, uint64_t repaint_us)
+{
+	struct gp_display_eink *eink = sim_eink();
+	uint64_t px = (uint64_t)rect.w * rect.h;
+	struct sim_xfer *xfer;
+
+	if (sim.busy)
+		tst_msg("Repaint started while display is busy");
+
+	if (sim.xfer_cnt >= MAX_XFERS) {
+		tst_msg("Too many repaints");
+		return;
+	}
+
+	xfer = &sim.xfers[sim.xfer_cnt++];
+
+	xfer->full = full;
+	xfer->rect = rect;
+	xfer->start_us = sim.clock_us;
+	xfer->end_us = sim.clock_us + repaint_us + px * eink->xfer_us_per_kpx / 1000;
+
+	sim.busy = 1;
+}
+
+static void sim_repaint_full_start(gp_backend *self)
+{
+	struct gp_display_eink *eink = GP_BACKEND_PRIV(self);
+
+	sim_xfer(1, gp_bbox_pack(0, 0, W, H), 1000 * eink->full_repaint_ms);
+}
+
+static void sim_repaint_part_start(gp_backend *self, gp_coord x0, gp_coord y0,
+                                   gp_coord x1, gp_coord y1)
+{
+	struct gp_display_eink *eink = GP_BACKEND_PRIV(self);
+
+	sim_xfer(0, gp_bbox_pack(x0, y0, x1 - x0 + 1, y1 - y0 + 1),
+	         1000 * eink->part_repaint_ms);
+}
+
+static void sim_repaint_finish(gp_backend *self)
+{
+	(void) self;
+
+	sim.busy = 0;
+}
+
+static void sim_display_exit(gp_backend *self)
+{
+	(void) self;
+
+	sim.exitted = 1;
+}
+
+/*
+ * Advances the clock to the end of the repaint in progress and raises the
+ * busy interrupt.
+ */
+static int sim_busy_done(void)
+{
+	struct gp_display_eink *eink = sim_eink();
+
+	if (!sim.busy)
+		return 0;
+
+	sim.clock_us = sim.xfers[sim.xfer_cnt-1].end_us;
+	eink->busy_fd.event(&eink->busy_fd);
+
+	return 1;
+}
+
+static void sim_run(void)
+{
+	while (sim_busy_done());
+}
+
+static int sim_init(unsigned int part_repaint_ms, unsigned int xfer_us_per_kpx,
+                    unsigned int ghost_limit)
+{
+	size_t size = sizeof(gp_backend) + sizeof(struct gp_display_eink);
+	struct gp_display_eink *eink;
+	int fd;
+
+	memset(&sim, 0, sizeof(sim));
+
+	/* The busy GPIO value is read in the interrupt handler */
+	fd = open("busy", O_CREAT | O_RDWR, 0644);
+	if (fd < 0 || write(fd, "0\n", 2) != 2) {
+		tst_msg("Failed to create busy GPIO file");
+		return 1;
+	}
+
+	sim.gpio_map.busy.fd = fd;
+
+	sim.backend = malloc(size);
+	if (!sim.backend) {
+		tst_msg("Malloc failed");
+		return 1;
+	}
+
+	memset(sim.backend, 0, size);
+
+	sim.backend->pixmap = gp_pixmap_alloc(W, H, GP_PIXEL_G1);
+	if (!sim.backend->pixmap) {
+		tst_msg("Malloc failed");
+		return 1;
+	}
+
+	eink = sim_eink();
+
+	eink->spi.gpio_map = &sim.gpio_map;
+	eink->spi.w = W;
+	eink->spi.h = H;
+
+	eink->full_repaint_ms = 1000;
+	eink->part_repaint_ms = part_repaint_ms;
+	eink->xfer_us_per_kpx = xfer_us_per_kpx;
+	eink->ghost_limit = ghost_limit;
+
+	eink->repaint_full_start = sim_repaint_full_start;
+	eink->repaint_full_finish = sim_repaint_finish;
+	eink->repaint_part_start = sim_repaint_part_start;
+	eink->repaint_part_finish = sim_repaint_finish;
+	eink->display_exit = sim_display_exit;
+
+	gp_display_eink_init(sim.backend);
+
+	return 0;
+}
+
+static void sim_exit(void)
+{
+	if (!sim.backend)
+		return;
+
+	gp_backend_exit(sim.backend);
+	gp_poll_clear(&sim.backend->fds);
+	gp_pixmap_free(sim.backend->pixmap);
+	free(sim.backend);
+	close(sim.gpio_map.busy.fd);
+}
+
+static int check_xfer(unsigned int i, int full, gp_bbox rect)
+{
+	struct sim_xfer *xfer = &sim.xfers[i];
+
+	if (i >= sim.xfer_cnt) {
+		tst_msg("Repaint %u missing, only %u repaints", i, sim.xfer_cnt);
+		return 1;
+	}
+
+	if (xfer->full != full) {
+		tst_msg("Repaint %u is %s expected %s", i,
+		        xfer->full ? "full" : "partial", full ? "full" : "partial");
+		return 1;
+	}
+
+	if (!full && memcmp(&xfer->rect, &rect, sizeof(rect))) {
+		tst_msg("Repaint %u " GP_BBOX_FMT " expected " GP_BBOX_FMT,
+		        i, GP_BBOX_PARS(xfer->rect), GP_BBOX_PARS(rect));
+		return 1;
+	}
+
+	if (i && xfer->start_us < sim.xfers[i-1].end_us) {
+		tst_msg("Repaint %u started before previous one finished", i);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int check_xfer_cnt(unsigned int cnt)
+{
+	if (sim.xfer_cnt != cnt) {
+		tst_msg("Got %u repaints expected %u", sim.xfer_cnt, cnt);
+		return 1;
+	}
+
+	return 0;
+}
+
+static void update(gp_bbox rect)
+{
+	gp_backend_update_rect_xywh(sim.backend, rect.x, rect.y, rect.w, rect.h);
+}
+
+/*
+ * Updates that arrive while the display is busy are queued and repainted in
+ * order once the display is ready.
+ */
+static int eink_queue(void)
+{
+	gp_bbox a = gp_bbox_pack(0, 0, 10, 10);
+	gp_bbox b = gp_bbox_pack(150, 0, 10, 10);
+	gp_bbox c = gp_bbox_pack(0, 150, 10, 10);
+	int ret = TST_FAILED;
+
+	/* Merging anything far apart is more expensive than a repaint */
+	if (sim_init(10, 100000, 100))
+		goto exit;
+
+	update(a);
+	update(b);
+	update(c);
+
+	if (check_xfer_cnt(1) || check_xfer(0, 0, a))
+		goto exit;
+
+	if (sim_eink()->part_queue_cnt != 2) {
+		tst_msg("Expected 2 queued repaints got %u", sim_eink()->part_queue_cnt);
+		goto exit;
+	}
+
+	sim_run();
+
+	if (check_xfer_cnt(3) || check_xfer(1, 0, b) || check_xfer(2, 0, c))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	sim_exit();
+	return ret;
+}
+
+/*
+ * Queued areas are merged if a single repaint is estimated to be faster than
+ * two repaints and overlapping areas are always merged.
+ */
+static int eink_merge(void)
+{
+	gp_bbox busy = gp_bbox_pack(100, 100, 10, 10);
+	gp_bbox a = gp_bbox_pack(50, 50, 10, 10);
+	gp_bbox b = gp_bbox_pack(60, 50, 10, 10);
+	gp_bbox c = gp_bbox_pack(0, 150, 10, 10);
+	gp_bbox d = gp_bbox_pack(5, 155, 10, 10);
+	int ret = TST_FAILED;
+
+	if (sim_init(10, 100000, 100))
+		goto exit;
+
+	update(busy);
+	/* Adjacent, merging saves one repaint overhead */
+	update(a);
+	update(b);
+	/* Far away, merging would transfer too many pixels */
+	update(c);
+	/* Overlapping */
+	update(d);
+
+	sim_run();
+
+	if (check_xfer_cnt(3) ||
+	    check_xfer(0, 0, busy) ||
+	    check_xfer(1, 0, gp_bbox_merge(a, b)) ||
+	    check_xfer(2, 0, gp_bbox_merge(c, d)))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	sim_exit();
+	return ret;
+}
+
+/*
+ * A flip while the display is busy queues a full repaint that replaces all
+ * queued partial repaints as well as these requested later.
+ */
+static int eink_flip_queued(void)
+{
+	gp_bbox a = gp_bbox_pack(0, 0, 10, 10);
+	int ret = TST_FAILED;
+
+	if (sim_init(10, 100000, 100))
+		goto exit;
+
+	update(a);
+	update(gp_bbox_pack(150, 0, 10, 10));
+	gp_backend_flip(sim.backend);
+	update(gp_bbox_pack(0, 150, 10, 10));
+
+	sim_run();
+
+	if (check_xfer_cnt(2) || check_xfer(0, 0, a) ||
+	    check_xfer(1, 1, gp_bbox_pack(0, 0, W, H)))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	sim_exit();
+	return ret;
+}
+
+/*
+ * After ghost_limit partial repaints of a cell the next repaint touching the
+ * cell is a full repaint that resets the counters, other cells are not
+ * affected.
+ */
+static int eink_ghost_limit(void)
+{
+	gp_bbox a = gp_bbox_pack(0, 0, 10, 10);
+	gp_bbox b = gp_bbox_pack(150, 150, 10, 10);
+	int ret = TST_FAILED;
+	unsigned int i;
+
+	if (sim_init(100, 100, 3))
+		goto exit;
+
+	for (i = 0; i < 3; i++) {
+		update(a);
+		sim_run();
+	}
+
+	/* A different cell is still below the limit */
+	update(b);
+	sim_run();
+
+	if (check_xfer_cnt(4))
+		goto exit;
+
+	for (i = 0; i < 3; i++) {
+		if (check_xfer(i, 0, a))
+			goto exit;
+	}
+
+	if (check_xfer(3, 0, b))
+		goto exit;
+
+	update(a);
+	sim_run();
+
+	if (check_xfer_cnt(5) || check_xfer(4, 1, a))
+		goto exit;
+
+	/* Counters are reset by the full repaint */
+	update(a);
+	sim_run();
+
+	if (check_xfer_cnt(6) || check_xfer(5, 0, a))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	sim_exit();
+	return ret;
+}
+
+static int eink_exit(void)
+{
+	int ret = TST_FAILED;
+
+	if (sim_init(100, 100, 5))
+		goto exit;
+
+	update(gp_bbox_pack(0, 0, 10, 10));
+	sim_run();
+exit:
+	sim_exit();
+
+	if (!sim.exitted) {
+		tst_msg("Display exit was not called");
+		return ret;
+	}
+
+	return TST_PASSED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "E-ink repaint scheduler",
+	.tests = {
+		{.name = "eink queue",
+		 .tst_fn = eink_queue,
+		 .flags = TST_TMPDIR},
+
+		{.name = "eink merge",
+		 .tst_fn = eink_merge,
+		 .flags = TST_TMPDIR},
+
+		{.name = "eink flip while busy",
+		 .tst_fn = eink_flip_queued,
+		 .flags = TST_TMPDIR},
+
+		{.name = "eink ghost limit",
+		 .tst_fn = eink_ghost_limit,
+		 .flags = TST_TMPDIR},
+
+		{.name = "eink exit",
+		 .tst_fn = eink_exit,
+		 .flags = TST_TMPDIR},
+
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,322 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+ * Linux framebuffer shadow flush tests.
+ *
+ * The framebuffer is a regular file mmaped by the backend. The test defines
+ * ioctl() that fills in the framebuffer information and pretends that the
+ * console ioctls succeeded and open() that redirects the console to a regular
+ * file, these take precedence over the libc functions for the library calls.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/fb.h>
+#include <core/gp_core.h>
+#include <gfx/gp_gfx.h>
+#include <backends/gp_linux_fb.h>
+#include "tst_test.h"
+
+#define W 100
+#define H 20
+/* Padded rows */
+#define LINE_LENGTH (W * 4 + 32)
+#define FB_SIZE (LINE_LENGTH * H)
+
+int open(const char *path, int flags, ...)
+{
+	mode_t mode = 0;
+	va_list va;
+
+	if (flags & O_CREAT) {
+		va_start(va, flags);
+		mode = va_arg(va, int);
+		va_end(va);
+	}
+
+	if (!strncmp(path, "/dev/tty", 8))
+		path = "tty";
+
+	return openat(AT_FDCWD, path, flags, mode);
+}
+
+int ioctl(int fd, unsigned long request, ...)
+{
+	struct fb_fix_screeninfo *fscri;
+	struct fb_var_screeninfo *vscri;
+	va_list va;
+
+	(void) fd;
+
+	va_start(va, request);
+
+	switch (request) {
+	case FBIOGET_FSCREENINFO:
+		fscri = va_arg(va, struct fb_fix_screeninfo *);
+		memset(fscri, 0, sizeof(*fscri));
+		fscri->smem_len = FB_SIZE;
+		fscri->line_length = LINE_LENGTH;
+	break;
+	case FBIOGET_VSCREENINFO:
+		vscri = va_arg(va, struct fb_var_screeninfo *);
+		memset(vscri, 0, sizeof(*vscri));
+		vscri->xres = W;
+		vscri->yres = H;
+		vscri->bits_per_pixel = 32;
+		vscri->red = (struct fb_bitfield){.offset = 16, .length = 8};
+		vscri->green = (struct fb_bitfield){.offset = 8, .length = 8};
+		vscri->blue = (struct fb_bitfield){.offset = 0, .length = 8};
+	break;
+	}
+
+	va_end(va);
+
+	return 0;
+}
+
+static uint8_t buf[FB_SIZE];
+
+static gp_backend *fb_init(int flags)
+{
+	gp_backend *backend;
+	int fd;
+
+	memset(buf, 0xff, sizeof(buf));
+
+	fd = open("fb", O_CREAT | O_RDWR, 0644);
+	if (fd < 0 || write(fd, buf, sizeof(buf)) != sizeof(buf)) {
+		tst_msg("Failed to create framebuffer file");
+		return NULL;
+	}
+
+	close(fd);
+
+	fd = open("tty", O_CREAT | O_RDWR, 0644);
+	if (fd < 0) {
+		tst_msg("Failed to create console file");
+		return NULL;
+	}
+
+	close(fd);
+
+	backend = gp_linux_fb_init("fb", flags);
+	if (!backend) {
+		tst_msg("Failed to initialize framebuffer");
+		return NULL;
+	}
+
+	if (backend->pixmap->pixel_type != GP_PIXEL_xRGB8888) {
+		tst_msg("Wrong pixel type %s",
+		        gp_pixel_type_name(backend->pixmap->pixel_type));
+		gp_backend_exit(backend);
+		return NULL;
+	}
+
+	return backend;
+}
+
+static int fb_read(void)
+{
+	int fd = open("fb", O_RDONLY);
+	int ret = 0;
+
+	if (fd < 0 || read(fd, buf, sizeof(buf)) != sizeof(buf)) {
+		tst_msg("Failed to read framebuffer file");
+		ret = 1;
+	}
+
+	close(fd);
+	return ret;
+}
+
+/*
+ * Compares the framebuffer with the shadow inside of the rectangle and with
+ * the initial content outside of it.
+ */
+static int check_fb(gp_backend *backend, gp_coord x0, gp_coord y0,
+                    gp_coord x1, gp_coord y1)
+{
+	const uint8_t *shadow = backend->pixmap->pixels;
+	gp_coord x, y;
+
+	if (fb_read())
+		return 1;
+
+	for (y = 0; y < H; y++) {
+		for (x = 0; x < W; x++) {
+			size_t off = (size_t)y * LINE_LENGTH + 4 * x;
+			int in_rect = x >= x0 && x <= x1 && y >= y0 && y <= y1;
+			uint32_t exp = 0xffffffff;
+			uint32_t val;
+
+			if (in_rect)
+				memcpy(&exp, shadow + off, 4);
+
+			memcpy(&val, buf + off, 4);
+
+			if (val != exp) {
+				tst_msg("Pixel %ix%i %08x expected %08x",
+				        x, y, val, exp);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int check_stats(gp_backend *backend, unsigned long flushes,
+                       unsigned long spans, uint64_t bytes_written,
+                       uint64_t bytes_skipped)
+{
+	gp_linux_fb_stats stats;
+
+	if (gp_linux_fb_stats_get(backend, &stats)) {
+		tst_msg("gp_linux_fb_stats_get() failed: %s", strerror(errno));
+		return 1;
+	}
+
+	if (stats.flushes != flushes || stats.spans != spans ||
+	    stats.bytes_written != bytes_written ||
+	    stats.bytes_skipped != bytes_skipped) {
+		tst_msg("Got flushes=%lu spans=%lu written=%llu skipped=%llu "
+		        "expected %lu %lu %llu %llu",
+		        stats.flushes, stats.spans,
+		        (unsigned long long)stats.bytes_written,
+		        (unsigned long long)stats.bytes_skipped,
+		        flushes, spans, (unsigned long long)bytes_written,
+		        (unsigned long long)bytes_skipped);
+		return 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Before the first flip the framebuffer content is unknown, black areas must
+ * not be skipped as unchanged.
+ */
+static int fb_update_rect_first(void)
+{
+	gp_backend *backend = fb_init(GP_FB_SHADOW);
+	int ret = TST_FAILED;
+
+	if (!backend)
+		return TST_UNTESTED;
+
+	gp_fill(backend->pixmap, 0);
+	gp_fill_rect_xyxy(backend->pixmap, 15, 5, 20, 6, 0x00ff00);
+
+	gp_backend_update_rect_xyxy(backend, 10, 2, 29, 9);
+
+	if (check_fb(backend, 10, 2, 29, 9) ||
+	    check_stats(backend, 1, 8, 8 * 20 * 4, 0))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	gp_backend_exit(backend);
+	return ret;
+}
+
+/*
+ * After the first flip only the changed blocks are written.
+ */
+static int fb_flip_spans(void)
+{
+	gp_backend *backend = fb_init(GP_FB_SHADOW);
+	int ret = TST_FAILED;
+
+	if (!backend)
+		return TST_UNTESTED;
+
+	gp_fill(backend->pixmap, 0);
+	gp_backend_flip(backend);
+
+	if (check_fb(backend, 0, 0, W-1, H-1) ||
+	    check_stats(backend, 1, 0, FB_SIZE, 0))
+		goto exit;
+
+	/* Nothing changed */
+	gp_backend_flip(backend);
+
+	if (check_stats(backend, 2, 0, FB_SIZE, H * W * 4))
+		goto exit;
+
+	/* Pixels in the first and the second 64 byte block of a row */
+	gp_putpixel(backend->pixmap, 1, 3, 0xff0000);
+	gp_putpixel(backend->pixmap, 17, 3, 0xff0000);
+	/* A single pixel in the last, partial, block of a row */
+	gp_putpixel(backend->pixmap, W-1, 7, 0x0000ff);
+
+	gp_backend_flip(backend);
+
+	if (check_fb(backend, 0, 0, W-1, H-1) ||
+	    check_stats(backend, 3, 2, FB_SIZE + 128 + 16,
+	                2 * H * W * 4 - 128 - 16))
+		goto exit;
+
+	/* Update rect compares only the rectangle */
+	gp_fill_rect_xyxy(backend->pixmap, 40, 10, 50, 10, 0xffffff);
+	gp_backend_update_rect_xyxy(backend, 32, 10, 47, 10);
+
+	if (check_stats(backend, 4, 3, FB_SIZE + 128 + 16 + 64,
+	                2 * H * W * 4 - 128 - 16))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	gp_backend_exit(backend);
+	return ret;
+}
+
+static int fb_stats_no_shadow(void)
+{
+	gp_backend *backend = fb_init(0);
+	gp_linux_fb_stats stats;
+	int ret = TST_FAILED;
+
+	if (!backend)
+		return TST_UNTESTED;
+
+	if (!gp_linux_fb_stats_get(backend, &stats)) {
+		tst_msg("gp_linux_fb_stats_get() succeeded without shadow");
+		goto exit;
+	}
+
+	if (errno != ENOSYS) {
+		tst_msg("Wrong errno %s", strerror(errno));
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_backend_exit(backend);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Linux framebuffer",
+	.tests = {
+		{.name = "fb update_rect before first flip",
+		 .tst_fn = fb_update_rect_first,
+		 .flags = TST_TMPDIR},
+
+		{.name = "fb flip writes changed spans",
+		 .tst_fn = fb_flip_spans,
+		 .flags = TST_TMPDIR},
+
+		{.name = "fb stats without shadow",
+		 .tst_fn = fb_stats_no_shadow,
+		 .flags = TST_TMPDIR},
+
+		{.name = NULL},
+	}
+};
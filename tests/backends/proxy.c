@@ -0,0 +1,414 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+ * Proxy backend protocol tests.
+ *
+ * The test defines gp_proxy_client_connect() that returns one end of a socket
+ * pair, it takes precedence over the library function. The other end is used
+ * as a server connection.
+ */
+
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <core/gp_core.h>
+#include <gfx/gp_gfx.h>
+#include <backends/gp_backend.h>
+#include <backends/gp_proxy.h>
+#include <backends/gp_proxy_shm.h>
+#include <backends/gp_proxy_cli.h>
+#include "tst_test.h"
+
+#define W 64
+#define H 32
+
+static int cli_fd = -1;
+
+int gp_proxy_client_connect(const char *path)
+{
+	(void) path;
+
+	return cli_fd;
+}
+
+struct server {
+	gp_dlist clients;
+	gp_proxy_cli *cli;
+	gp_proxy_shm *shm;
+	gp_backend *backend;
+};
+
+static void server_exit(struct server *srv)
+{
+	if (srv->backend)
+		gp_backend_exit(srv->backend);
+
+	if (srv->cli) {
+		close(srv->cli->fd.fd);
+		gp_proxy_cli_rem(&srv->clients, srv->cli);
+	}
+
+	if (srv->shm)
+		gp_proxy_shm_exit(srv->shm);
+}
+
+/*
+ * Returns next message from the application or NULL if there is none.
+ */
+static gp_proxy_msg *server_msg(struct server *srv)
+{
+	gp_proxy_msg *msg;
+
+	if (gp_proxy_cli_read(srv->cli))
+		return NULL;
+
+	if (gp_proxy_cli_msg(srv->cli, &msg))
+		return NULL;
+
+	return msg;
+}
+
+static gp_proxy_msg *server_expect(struct server *srv, enum gp_proxy_msg_types type)
+{
+	gp_proxy_msg *msg = server_msg(srv);
+
+	if (!msg) {
+		tst_msg("Expected %s got nothing", gp_proxy_msg_type_name(type));
+		return NULL;
+	}
+
+	if (msg->type != type) {
+		tst_msg("Expected %s got %s", gp_proxy_msg_type_name(type),
+		        gp_proxy_msg_type_name(msg->type));
+		return NULL;
+	}
+
+	return msg;
+}
+
+/*
+ * Connects an application to the server, maps the SHM and shows the
+ * application.
+ *
+ * With buffers set to zero the server sends CLI_INIT without the number of
+ * buffers as older servers did.
+ */
+static int server_init(struct server *srv, unsigned int buffers)
+{
+	int fds[2];
+
+	memset(srv, 0, sizeof(*srv));
+
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds)) {
+		tst_msg("socketpair() failed");
+		return 1;
+	}
+
+	cli_fd = fds[1];
+
+	srv->cli = gp_proxy_cli_add(&srv->clients, fds[0]);
+	if (!srv->cli) {
+		tst_msg("Failed to add client");
+		close(fds[0]);
+		close(fds[1]);
+		return 1;
+	}
+
+	srv->shm = gp_proxy_shm_init_bufs("shm", W, H, GP_PIXEL_RGB888,
+	                                  buffers ? buffers : 1);
+	if (!srv->shm) {
+		tst_msg("Failed to create SHM");
+		goto err;
+	}
+
+	if (buffers) {
+		struct gp_proxy_cli_init_ init = {
+			.pixel_type = GP_PIXEL_RGB888,
+			.dpi = 100,
+			.buffers = buffers,
+		};
+
+		gp_proxy_cli_send(srv->cli, GP_PROXY_CLI_INIT, &init);
+	} else {
+		uint32_t init[] = {GP_PROXY_CLI_INIT, 16, GP_PIXEL_RGB888, 100};
+
+		if (write(srv->cli->fd.fd, init, sizeof(init)) != sizeof(init)) {
+			tst_msg("Failed to write CLI_INIT");
+			goto err;
+		}
+	}
+
+	srv->backend = gp_proxy_init(NULL, "proxy test");
+	if (!srv->backend) {
+		tst_msg("Failed to initialize proxy backend");
+		goto err;
+	}
+
+	if (!server_expect(srv, GP_PROXY_NAME))
+		goto err;
+
+	gp_proxy_cli_send(srv->cli, GP_PROXY_MAP, &srv->shm->path);
+	gp_proxy_cli_send(srv->cli, GP_PROXY_PIXMAP, &srv->shm->pixmap);
+	gp_proxy_cli_send(srv->cli, GP_PROXY_SHOW, NULL);
+
+	gp_backend_poll(srv->backend);
+
+	if (!server_expect(srv, GP_PROXY_MAP))
+		goto err;
+
+	if (srv->backend->pixmap->w != W || srv->backend->pixmap->h != H) {
+		tst_msg("Wrong pixmap size %ux%u", srv->backend->pixmap->w,
+		        srv->backend->pixmap->h);
+		goto err;
+	}
+
+	return 0;
+err:
+	server_exit(srv);
+	return 1;
+}
+
+static int check_present(gp_proxy_msg *msg, uint32_t buf,
+                         gp_coord x, gp_coord y, gp_size w, gp_size h)
+{
+	struct gp_proxy_present_ *present = &msg->present.present;
+	struct gp_proxy_rect_ *r = &present->rects[0];
+
+	if (present->buf != buf) {
+		tst_msg("Presented buffer %u expected %u", present->buf, buf);
+		return 1;
+	}
+
+	if (present->cnt != 1 || r->x != (uint32_t)x || r->y != (uint32_t)y ||
+	    r->w != w || r->h != h) {
+		tst_msg("Presented %u rects %ux%u-%ux%u expected %ix%i-%ux%u",
+		        present->cnt, r->x, r->y, r->w, r->h, x, y, w, h);
+		return 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Checks that the pixels inside of the rectangle in the SHM buffer match the
+ * application pixmap.
+ */
+static int check_buf(struct server *srv, unsigned int buf,
+                     gp_coord x, gp_coord y, gp_size w, gp_size h)
+{
+	gp_pixmap *app = srv->backend->pixmap;
+	gp_pixmap shm;
+	gp_coord i, j;
+
+	gp_proxy_shm_buf(srv->shm, buf, &shm);
+
+	for (j = y; j < y + (gp_coord)h; j++) {
+		for (i = x; i < x + (gp_coord)w; i++) {
+			gp_pixel p = gp_getpixel_raw(&shm, i, j);
+			gp_pixel exp = gp_getpixel_raw(app, i, j);
+
+			if (p != exp) {
+				tst_msg("Buffer %u pixel %ix%i %06x expected %06x",
+				        buf, i, j, p, exp);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int no_msg(struct server *srv)
+{
+	gp_proxy_msg *msg = server_msg(srv);
+
+	if (msg) {
+		tst_msg("Unexpected %s", gp_proxy_msg_type_name(msg->type));
+		return 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Updates are copied into a free buffer and presented, once all buffers are
+ * owned by the server updates wait for a release.
+ */
+static int proxy_present_release(void)
+{
+	struct server srv;
+	gp_backend *backend;
+	gp_proxy_msg *msg;
+	gp_pixmap shm;
+	int ret = TST_FAILED;
+
+	if (server_init(&srv, 2))
+		return TST_UNTESTED;
+
+	backend = srv.backend;
+
+	gp_proxy_shm_buf(srv.shm, 0, &shm);
+
+	gp_fill(backend->pixmap, 0x0000ff);
+
+	if (gp_getpixel(&shm, 0, 0)) {
+		tst_msg("Application renders into the SHM buffer");
+		goto exit;
+	}
+
+	gp_backend_flip(backend);
+
+	msg = server_expect(&srv, GP_PROXY_PRESENT);
+	if (!msg || check_present(msg, 0, 0, 0, W, H) ||
+	    check_buf(&srv, 0, 0, 0, W, H))
+		goto exit;
+
+	gp_fill_rect_xywh(backend->pixmap, 10, 5, 4, 3, 0xff0000);
+	gp_backend_update_rect_xywh(backend, 10, 5, 4, 3);
+
+	msg = server_expect(&srv, GP_PROXY_PRESENT);
+	if (!msg || check_present(msg, 1, 10, 5, 4, 3) ||
+	    check_buf(&srv, 1, 10, 5, 4, 3))
+		goto exit;
+
+	/* Both buffers are owned by the server now */
+	gp_fill_rect_xywh(backend->pixmap, 20, 10, 2, 2, 0x00ff00);
+	gp_backend_update_rect_xywh(backend, 20, 10, 2, 2);
+	gp_fill_rect_xywh(backend->pixmap, 21, 11, 2, 2, 0xffff00);
+	gp_backend_update_rect_xywh(backend, 21, 11, 2, 2);
+
+	if (no_msg(&srv))
+		goto exit;
+
+	gp_proxy_cli_release(srv.cli, 1);
+	gp_backend_poll(backend);
+
+	/* Both updates merged and copied into the released buffer */
+	msg = server_expect(&srv, GP_PROXY_PRESENT);
+	if (!msg || check_present(msg, 1, 20, 10, 3, 3) ||
+	    check_buf(&srv, 1, 20, 10, 3, 3))
+		goto exit;
+
+	/* Nothing is lost in the application pixmap */
+	if (gp_getpixel(backend->pixmap, 0, 0) != 0x0000ff ||
+	    gp_getpixel(backend->pixmap, 10, 5) != 0xff0000 ||
+	    gp_getpixel(backend->pixmap, 20, 10) != 0x00ff00 ||
+	    gp_getpixel(backend->pixmap, 22, 12) != 0xffff00) {
+		tst_msg("Application pixmap content lost");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	server_exit(&srv);
+	return ret;
+}
+
+/*
+ * With a single buffer, or a server that does not announce the buffer ring,
+ * the application renders into the SHM and sends updates.
+ */
+static int proxy_update(unsigned int *buffers)
+{
+	struct server srv;
+	gp_backend *backend;
+	gp_proxy_msg *msg;
+	int ret = TST_FAILED;
+
+	if (server_init(&srv, *buffers))
+		return TST_UNTESTED;
+
+	backend = srv.backend;
+
+	gp_putpixel(backend->pixmap, 1, 2, 0xff0000);
+
+	if (gp_getpixel(&srv.shm->pixmap, 1, 2) != 0xff0000) {
+		tst_msg("Application does not render into the SHM buffer");
+		goto exit;
+	}
+
+	gp_backend_update_rect_xywh(backend, 1, 2, 3, 4);
+
+	msg = server_expect(&srv, GP_PROXY_UPDATE);
+	if (!msg)
+		goto exit;
+
+	if (msg->rect.rect.x != 1 || msg->rect.rect.y != 2 ||
+	    msg->rect.rect.w != 3 || msg->rect.rect.h != 4) {
+		tst_msg("Wrong update rect %ux%u-%ux%u",
+		        msg->rect.rect.x, msg->rect.rect.y,
+		        msg->rect.rect.w, msg->rect.rect.h);
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	server_exit(&srv);
+	return ret;
+}
+
+/*
+ * Present with a message size that does not match the number of rectangles
+ * is rejected by the server.
+ */
+static int proxy_present_invalid(void)
+{
+	struct server srv;
+	gp_proxy_msg *msg;
+	uint32_t present[] = {GP_PROXY_PRESENT, 8 + 8 + 16, 0, 2, 0, 0, 1, 1};
+	int ret = TST_FAILED;
+
+	if (server_init(&srv, 2))
+		return TST_UNTESTED;
+
+	if (write(cli_fd, present, sizeof(present)) != sizeof(present)) {
+		tst_msg("Failed to write PRESENT");
+		goto exit;
+	}
+
+	if (gp_proxy_cli_read(srv.cli)) {
+		tst_msg("Failed to read PRESENT");
+		goto exit;
+	}
+
+	if (!gp_proxy_cli_msg(srv.cli, &msg)) {
+		tst_msg("Invalid PRESENT accepted");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	server_exit(&srv);
+	return ret;
+}
+
+static unsigned int single_buffer = 1;
+static unsigned int old_server = 0;
+
+const struct tst_suite tst_suite = {
+	.suite_name = "proxy backend",
+	.tests = {
+		{.name = "proxy present release",
+		 .tst_fn = proxy_present_release,
+		 .flags = TST_TMPDIR},
+
+		{.name = "proxy update single buffer",
+		 .tst_fn = proxy_update,
+		 .data = &single_buffer,
+		 .flags = TST_TMPDIR},
+
+		{.name = "proxy update old server",
+		 .tst_fn = proxy_update,
+		 .data = &old_server,
+		 .flags = TST_TMPDIR},
+
+		{.name = "proxy present invalid size",
+		 .tst_fn = proxy_present_invalid,
+		 .flags = TST_TMPDIR},
+
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+ * Virtual backend tests, the parent backend is a dummy that only holds a
+ * pixmap, after each flip the parent pixmap has to match the whole virtual
+ * backend pixmap converted by gp_blit().
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <core/gp_core.h>
+#include <gfx/gp_gfx.h>
+#include <backends/gp_backend_virtual.h>
+#include "tst_test.h"
+
+#define W 200
+#define H 50
+
+static void dummy_flip(gp_backend *self)
+{
+	(void) self;
+}
+
+static void dummy_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
+                              gp_coord x1, gp_coord y1)
+{
+	(void) self; (void) x0; (void) y0; (void) x1; (void) y1;
+}
+
+static void dummy_update_rects(gp_backend *self, const gp_bbox *rects,
+                               unsigned int cnt)
+{
+	(void) self; (void) rects; (void) cnt;
+}
+
+struct virt_test {
+	gp_backend parent;
+	gp_backend *virt;
+	gp_pixmap *ref;
+};
+
+static int virt_test_init(struct virt_test *t, gp_pixel_type pixel_type, int rects)
+{
+	memset(t, 0, sizeof(*t));
+
+	t->parent.pixmap = gp_pixmap_alloc(W, H, GP_PIXEL_RGB888);
+	t->ref = gp_pixmap_alloc(W, H, GP_PIXEL_RGB888);
+
+	t->parent.flip = dummy_flip;
+	t->parent.update_rect = dummy_update_rect;
+	t->parent.update_rects = rects ? dummy_update_rects : NULL;
+
+	if (t->parent.pixmap)
+		t->virt = gp_backend_virt_init(&t->parent, pixel_type, 0);
+
+	if (!t->virt || !t->ref) {
+		tst_msg("Allocation failure");
+		return 1;
+	}
+
+	gp_fill(t->virt->pixmap, 0);
+	gp_backend_flip(t->virt);
+
+	return 0;
+}
+
+static void virt_test_exit(struct virt_test *t)
+{
+	if (t->virt)
+		gp_backend_exit(t->virt);
+
+	gp_pixmap_free(t->parent.pixmap);
+	gp_pixmap_free(t->ref);
+}
+
+static int virt_test_check(struct virt_test *t)
+{
+	gp_coord x, y;
+
+	gp_blit(t->virt->pixmap, 0, 0, W, H, t->ref, 0, 0);
+
+	for (y = 0; y < H; y++) {
+		for (x = 0; x < W; x++) {
+			gp_pixel p = gp_getpixel(t->parent.pixmap, x, y);
+			gp_pixel ref_p = gp_getpixel(t->ref, x, y);
+
+			if (p != ref_p) {
+				tst_msg("Pixel %ix%i %06x expected %06x", x, y, p, ref_p);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Pixels that share a byte with an updated rectangle were not converted and
+ * have to be converted on the next flip.
+ */
+static int virt_update_rect_partial_byte(void)
+{
+	struct virt_test t;
+	int ret = TST_FAILED;
+	gp_pixel white;
+
+	if (virt_test_init(&t, GP_PIXEL_G1, 0))
+		goto exit;
+
+	white = gp_rgb_to_pixmap_pixel(0xff, 0xff, 0xff, t.virt->pixmap);
+
+	gp_putpixel(t.virt->pixmap, 0, 0, white);
+	gp_putpixel(t.virt->pixmap, 3, 0, white);
+
+	gp_backend_update_rect_xyxy(t.virt, 3, 0, 3, 0);
+	gp_backend_flip(t.virt);
+
+	if (virt_test_check(&t))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	virt_test_exit(&t);
+	return ret;
+}
+
+struct virt_params {
+	gp_pixel_type pixel_type;
+	int rects;
+};
+
+/*
+ * Draws random rectangles, updates some of them, randomly sized, and flips.
+ */
+static int virt_random_updates(struct virt_params *p)
+{
+	struct virt_test t;
+	int ret = TST_FAILED;
+	unsigned int i;
+
+	if (virt_test_init(&t, p->pixel_type, p->rects))
+		goto exit;
+
+	srandom(0);
+
+	for (i = 0; i < 200; i++) {
+		gp_coord x = random() % W;
+		gp_coord y = random() % H;
+		gp_size w = 1 + random() % (W - x);
+		gp_size h = 1 + random() % (H - y);
+		gp_pixel pixel = random() & 0xffffff;
+
+		gp_fill_rect_xywh(t.virt->pixmap, x, y, w, h, pixel);
+
+		x = random() % W;
+		y = random() % H;
+		w = 1 + random() % (W - x);
+		h = 1 + random() % (H - y);
+
+		if (p->rects) {
+			gp_bbox r = gp_bbox_pack(x, y, w, h);
+
+			gp_backend_update_rects(t.virt, &r, 1);
+		} else {
+			gp_backend_update_rect_xywh(t.virt, x, y, w, h);
+		}
+
+		if (random() % 3)
+			continue;
+
+		gp_backend_flip(t.virt);
+
+		if (virt_test_check(&t)) {
+			tst_msg("After %u iterations", i);
+			goto exit;
+		}
+	}
+
+	ret = TST_PASSED;
+exit:
+	virt_test_exit(&t);
+	return ret;
+}
+
+static struct virt_params g1 = {GP_PIXEL_G1, 0};
+static struct virt_params g2 = {GP_PIXEL_G2, 0};
+static struct virt_params g4 = {GP_PIXEL_G4, 1};
+static struct virt_params rgb565 = {GP_PIXEL_RGB565, 1};
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Virtual backend",
+	.tests = {
+		{.name = "virtual update_rect partial byte",
+		 .tst_fn = virt_update_rect_partial_byte},
+
+		{.name = "virtual random updates G1",
+		 .tst_fn = virt_random_updates,
+		 .data = &g1},
+
+		{.name = "virtual random updates G2",
+		 .tst_fn = virt_random_updates,
+		 .data = &g2},
+
+		{.name = "virtual random updates G4 rects",
+		 .tst_fn = virt_random_updates,
+		 .data = &g4},
+
+		{.name = "virtual random updates RGB565 rects",
+		 .tst_fn = virt_random_updates,
+		 .data = &rgb565},
+
+		{.name = NULL},
+	}
+};
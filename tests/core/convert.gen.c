@@ -0,0 +1,4163 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * convert.gen.c
+ *
+ * GENERATED on 2026 10 19 15:08:57 from convert.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Pixel conversions tests.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+#include <stdio.h>
+#include <core/gp_convert.h>
+
+#include "tst_test.h"
+
+/*
+ * Returns black color for particular pixel type.
+ */
+static gp_pixel get_black(gp_pixel_type pixel_type)
+{
+	switch (pixel_type) {
+	case GP_PIXEL_UNKNOWN:
+		return 0;
+	case GP_PIXEL_RGB101010:
+		return 0;
+	case GP_PIXEL_xRGB8888:
+		return 0;
+	case GP_PIXEL_RGBA8888:
+		/* Black with Alpha channel is full A rest zero */
+		return 0xff;
+	case GP_PIXEL_RGB888:
+		return 0;
+	case GP_PIXEL_BGR888:
+		return 0;
+	case GP_PIXEL_RGB555:
+		return 0;
+	case GP_PIXEL_RGB565:
+		return 0;
+	case GP_PIXEL_RGB666:
+		return 0;
+	case GP_PIXEL_RGB332:
+		return 0;
+	case GP_PIXEL_CMYK8888:
+		/* Black in CMYK is full K rest zero */
+		return 0xff000000;
+	case GP_PIXEL_P2:
+		return 0;
+	case GP_PIXEL_P4:
+		return 0;
+	case GP_PIXEL_P8:
+		return 0;
+	case GP_PIXEL_G1_DB:
+		return 0;
+	case GP_PIXEL_G2_DB:
+		return 0;
+	case GP_PIXEL_G4_DB:
+		return 0;
+	case GP_PIXEL_G1_UB:
+		return 0;
+	case GP_PIXEL_G2_UB:
+		return 0;
+	case GP_PIXEL_G4_UB:
+		return 0;
+	case GP_PIXEL_G8:
+		return 0;
+	case GP_PIXEL_GA88:
+		/* Black with Alpha channel is full A rest zero */
+		return 0xff00;
+	case GP_PIXEL_G16:
+		return 0;
+	default:
+		tst_msg("Invalid pixel type %i", pixel_type);
+		exit(TST_INTERR);
+	}
+}
+
+/*
+ * Returns white color for particular pixel type.
+ */
+static gp_pixel get_white(gp_pixel_type pixel_type)
+{
+	switch (pixel_type) {
+	case GP_PIXEL_UNKNOWN:
+		tst_msg("FIXME: Unsupported conversion to %s",
+		        gp_pixel_type_name(pixel_type));
+		exit(TST_INTERR);
+	case GP_PIXEL_RGB101010:
+		/* Plain old RGB */
+		return 0x3ff00000 | 0xffc00 | 0x3ff;
+	case GP_PIXEL_xRGB8888:
+		/* Plain old RGB */
+		return 0xff0000 | 0xff00 | 0xff;
+	case GP_PIXEL_RGBA8888:
+		/* White in RGBA */
+		return 0xff | 0xff000000 | 0xff0000 | 0xff00;
+	case GP_PIXEL_RGB888:
+		/* Plain old RGB */
+		return 0xff0000 | 0xff00 | 0xff;
+	case GP_PIXEL_BGR888:
+		/* Plain old RGB */
+		return 0xff | 0xff00 | 0xff0000;
+	case GP_PIXEL_RGB555:
+		/* Plain old RGB */
+		return 0x7c00 | 0x3e0 | 0x1f;
+	case GP_PIXEL_RGB565:
+		/* Plain old RGB */
+		return 0xf800 | 0x7e0 | 0x1f;
+	case GP_PIXEL_RGB666:
+		/* Plain old RGB */
+		return 0x3f000 | 0xfc0 | 0x3f;
+	case GP_PIXEL_RGB332:
+		/* Plain old RGB */
+		return 0xe0 | 0x1c | 0x3;
+	case GP_PIXEL_CMYK8888:
+		/* White in CMYK is zero */
+		return 0x0;
+	case GP_PIXEL_P2:
+		tst_msg("FIXME: Unsupported conversion to %s",
+		        gp_pixel_type_name(pixel_type));
+		exit(TST_INTERR);
+	case GP_PIXEL_P4:
+		tst_msg("FIXME: Unsupported conversion to %s",
+		        gp_pixel_type_name(pixel_type));
+		exit(TST_INTERR);
+	case GP_PIXEL_P8:
+		tst_msg("FIXME: Unsupported conversion to %s",
+		        gp_pixel_type_name(pixel_type));
+		exit(TST_INTERR);
+	case GP_PIXEL_G1_DB:
+		/* Grayscale */
+		return 0x1;
+	case GP_PIXEL_G2_DB:
+		/* Grayscale */
+		return 0x3;
+	case GP_PIXEL_G4_DB:
+		/* Grayscale */
+		return 0xf;
+	case GP_PIXEL_G1_UB:
+		/* Grayscale */
+		return 0x1;
+	case GP_PIXEL_G2_UB:
+		/* Grayscale */
+		return 0x3;
+	case GP_PIXEL_G4_UB:
+		/* Grayscale */
+		return 0xf;
+	case GP_PIXEL_G8:
+		/* Grayscale */
+		return 0xff;
+	case GP_PIXEL_GA88:
+		/* Grayscale with Alpha */
+		return 0xff | 0xff00;
+	case GP_PIXEL_G16:
+		/* Grayscale */
+		return 0xffff;
+	default:
+		tst_msg("Invalid pixel type %i", pixel_type);
+		exit(TST_INTERR);
+	}
+}
+
+/*
+ * Returns red color for particular pixel type.
+ */
+static gp_pixel get_red(gp_pixel_type pixel_type)
+{
+	switch (pixel_type) {
+	case GP_PIXEL_UNKNOWN:
+		tst_msg("FIXME: Unsupported conversion to %s",
+		        gp_pixel_type_name(pixel_type));
+		exit(TST_INTERR);
+	case GP_PIXEL_RGB101010:
+		/* Plain old RGB */
+		return 0x3ff00000;
+	case GP_PIXEL_xRGB8888:
+		/* Plain old RGB */
+		return 0xff0000;
+	case GP_PIXEL_RGBA8888:
+		/* Red with Alpha channel is full Alpha and R rest zero */
+		return 0xff | 0xff000000;
+	case GP_PIXEL_RGB888:
+		/* Plain old RGB */
+		return 0xff0000;
+	case GP_PIXEL_BGR888:
+		/* Plain old RGB */
+		return 0xff;
+	case GP_PIXEL_RGB555:
+		/* Plain old RGB */
+		return 0x7c00;
+	case GP_PIXEL_RGB565:
+		/* Plain old RGB */
+		return 0xf800;
+	case GP_PIXEL_RGB666:
+		/* Plain old RGB */
+		return 0x3f000;
+	case GP_PIXEL_RGB332:
+		/* Plain old RGB */
+		return 0xe0;
+	case GP_PIXEL_CMYK8888:
+		/* Red in CMYK is full M and Y rest zero */
+		return 0xff00 | 0xff0000;
+	case GP_PIXEL_P2:
+		tst_msg("FIXME: Unsupported conversion to %s",
+		        gp_pixel_type_name(pixel_type));
+		exit(TST_INTERR);
+	case GP_PIXEL_P4:
+		tst_msg("FIXME: Unsupported conversion to %s",
+		        gp_pixel_type_name(pixel_type));
+		exit(TST_INTERR);
+	case GP_PIXEL_P8:
+		tst_msg("FIXME: Unsupported conversion to %s",
+		        gp_pixel_type_name(pixel_type));
+		exit(TST_INTERR);
+	case GP_PIXEL_G1_DB:
+		/* Grayscale is 1/3 Gray */
+		return 0x0 << 0x0;
+	case GP_PIXEL_G2_DB:
+		/* Grayscale is 1/3 Gray */
+		return 0x1 << 0x0;
+	case GP_PIXEL_G4_DB:
+		/* Grayscale is 1/3 Gray */
+		return 0x5 << 0x0;
+	case GP_PIXEL_G1_UB:
+		/* Grayscale is 1/3 Gray */
+		return 0x0 << 0x0;
+	case GP_PIXEL_G2_UB:
+		/* Grayscale is 1/3 Gray */
+		return 0x1 << 0x0;
+	case GP_PIXEL_G4_UB:
+		/* Grayscale is 1/3 Gray */
+		return 0x5 << 0x0;
+	case GP_PIXEL_G8:
+		/* Grayscale is 1/3 Gray */
+		return 0x55 << 0x0;
+	case GP_PIXEL_GA88:
+		/* Grayscale with Alpha channel is full Alpha + 1/3 Gray */
+		return (0x55 << 0x0) | 0xff00;
+	case GP_PIXEL_G16:
+		/* Grayscale is 1/3 Gray */
+		return 0x5555 << 0x0;
+	default:
+		tst_msg("Invalid pixel type %i", pixel_type);
+		exit(TST_INTERR);
+	}
+}
+
+static int convert_and_check_white_RGB101010_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB101010);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("RGB101010 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB101010_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB101010_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB101010);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB101010 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB101010_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_RGB101010(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB101010);
+
+	tst_msg("RGB888 %08x -> RGB101010 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB101010(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_RGB101010(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB101010);
+
+	tst_msg("RGBA8888 %08x -> RGB101010 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB101010(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB101010_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB101010);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("RGB101010 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB101010_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB101010_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB101010);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB101010 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB101010_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_RGB101010(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB101010);
+
+	tst_msg("RGB888 %08x -> RGB101010 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB101010(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_RGB101010(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB101010);
+
+	tst_msg("RGBA8888 %08x -> RGB101010 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB101010(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB101010_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB101010);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB888);
+
+	tst_msg("RGB101010 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB101010_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB101010_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB101010);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB101010 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB101010_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_RGB101010(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB101010);
+
+	tst_msg("RGB888 %08x -> RGB101010 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB101010(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_RGB101010(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB101010);
+
+	tst_msg("RGBA8888 %08x -> RGB101010 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB101010(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_xRGB8888_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_xRGB8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("xRGB8888 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_xRGB8888_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_xRGB8888_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_xRGB8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("xRGB8888 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_xRGB8888_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_xRGB8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_xRGB8888);
+
+	tst_msg("RGB888 %08x -> xRGB8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_xRGB8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_xRGB8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_xRGB8888);
+
+	tst_msg("RGBA8888 %08x -> xRGB8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_xRGB8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_xRGB8888_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_xRGB8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("xRGB8888 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_xRGB8888_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_xRGB8888_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_xRGB8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("xRGB8888 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_xRGB8888_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_xRGB8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_xRGB8888);
+
+	tst_msg("RGB888 %08x -> xRGB8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_xRGB8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_xRGB8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_xRGB8888);
+
+	tst_msg("RGBA8888 %08x -> xRGB8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_xRGB8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_xRGB8888_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_xRGB8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB888);
+
+	tst_msg("xRGB8888 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_xRGB8888_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_xRGB8888_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_xRGB8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGBA8888);
+
+	tst_msg("xRGB8888 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_xRGB8888_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_xRGB8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_xRGB8888);
+
+	tst_msg("RGB888 %08x -> xRGB8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_xRGB8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_xRGB8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_xRGB8888);
+
+	tst_msg("RGBA8888 %08x -> xRGB8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_xRGB8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_BGR888_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_BGR888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("BGR888 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_BGR888_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_BGR888_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_BGR888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("BGR888 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_BGR888_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_BGR888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_BGR888);
+
+	tst_msg("RGB888 %08x -> BGR888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_BGR888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_BGR888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_BGR888);
+
+	tst_msg("RGBA8888 %08x -> BGR888 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_BGR888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_BGR888_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_BGR888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("BGR888 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_BGR888_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_BGR888_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_BGR888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("BGR888 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_BGR888_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_BGR888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_BGR888);
+
+	tst_msg("RGB888 %08x -> BGR888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_BGR888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_BGR888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_BGR888);
+
+	tst_msg("RGBA8888 %08x -> BGR888 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_BGR888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_BGR888_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_BGR888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB888);
+
+	tst_msg("BGR888 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_BGR888_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_BGR888_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_BGR888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGBA8888);
+
+	tst_msg("BGR888 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_BGR888_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_BGR888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_BGR888);
+
+	tst_msg("RGB888 %08x -> BGR888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_BGR888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_BGR888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_BGR888);
+
+	tst_msg("RGBA8888 %08x -> BGR888 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_BGR888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB555_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB555);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("RGB555 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB555_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB555_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB555);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB555 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB555_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_RGB555(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB555);
+
+	tst_msg("RGB888 %08x -> RGB555 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB555(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_RGB555(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB555);
+
+	tst_msg("RGBA8888 %08x -> RGB555 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB555(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB555_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB555);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("RGB555 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB555_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB555_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB555);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB555 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB555_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_RGB555(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB555);
+
+	tst_msg("RGB888 %08x -> RGB555 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB555(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_RGB555(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB555);
+
+	tst_msg("RGBA8888 %08x -> RGB555 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB555(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB555_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB555);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB888);
+
+	tst_msg("RGB555 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB555_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB555_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB555);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB555 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB555_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_RGB555(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB555);
+
+	tst_msg("RGB888 %08x -> RGB555 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB555(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_RGB555(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB555);
+
+	tst_msg("RGBA8888 %08x -> RGB555 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB555(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB565_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB565);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("RGB565 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB565_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB565_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB565);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB565 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB565_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_RGB565(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB565);
+
+	tst_msg("RGB888 %08x -> RGB565 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB565(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_RGB565(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB565);
+
+	tst_msg("RGBA8888 %08x -> RGB565 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB565(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB565_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB565);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("RGB565 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB565_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB565_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB565);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB565 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB565_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_RGB565(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB565);
+
+	tst_msg("RGB888 %08x -> RGB565 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB565(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_RGB565(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB565);
+
+	tst_msg("RGBA8888 %08x -> RGB565 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB565(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB565_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB565);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB888);
+
+	tst_msg("RGB565 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB565_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB565_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB565);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB565 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB565_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_RGB565(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB565);
+
+	tst_msg("RGB888 %08x -> RGB565 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB565(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_RGB565(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB565);
+
+	tst_msg("RGBA8888 %08x -> RGB565 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB565(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB666_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB666);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("RGB666 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB666_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB666_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB666);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB666 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB666_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_RGB666(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB666);
+
+	tst_msg("RGB888 %08x -> RGB666 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB666(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_RGB666(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB666);
+
+	tst_msg("RGBA8888 %08x -> RGB666 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB666(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB666_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB666);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("RGB666 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB666_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB666_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB666);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB666 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB666_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_RGB666(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB666);
+
+	tst_msg("RGB888 %08x -> RGB666 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB666(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_RGB666(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB666);
+
+	tst_msg("RGBA8888 %08x -> RGB666 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB666(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB666_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB666);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB888);
+
+	tst_msg("RGB666 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB666_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB666_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB666);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB666 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB666_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_RGB666(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB666);
+
+	tst_msg("RGB888 %08x -> RGB666 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB666(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_RGB666(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB666);
+
+	tst_msg("RGBA8888 %08x -> RGB666 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB666(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB332_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB332);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("RGB332 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB332_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB332_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB332);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB332 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB332_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_RGB332(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB332);
+
+	tst_msg("RGB888 %08x -> RGB332 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB332(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_RGB332(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB332);
+
+	tst_msg("RGBA8888 %08x -> RGB332 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB332(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB332_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB332);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("RGB332 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB332_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB332_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB332);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB332 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB332_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_RGB332(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB332);
+
+	tst_msg("RGB888 %08x -> RGB332 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB332(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_RGB332(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB332);
+
+	tst_msg("RGBA8888 %08x -> RGB332 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB332(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB332_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB332);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB888);
+
+	tst_msg("RGB332 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB332_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB332_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB332);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGBA8888);
+
+	tst_msg("RGB332 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB332_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_RGB332(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB332);
+
+	tst_msg("RGB888 %08x -> RGB332 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_RGB332(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_RGB332(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB332);
+
+	tst_msg("RGBA8888 %08x -> RGB332 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_RGB332(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_CMYK8888_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_CMYK8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("CMYK8888 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_CMYK8888_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_CMYK8888_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_CMYK8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("CMYK8888 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_CMYK8888_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_CMYK8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_CMYK8888);
+
+	tst_msg("RGB888 %08x -> CMYK8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_CMYK8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_CMYK8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_CMYK8888);
+
+	tst_msg("RGBA8888 %08x -> CMYK8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_CMYK8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_CMYK8888_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_CMYK8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("CMYK8888 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_CMYK8888_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_CMYK8888_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_CMYK8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("CMYK8888 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_CMYK8888_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_CMYK8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_CMYK8888);
+
+	tst_msg("RGB888 %08x -> CMYK8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_CMYK8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_CMYK8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_CMYK8888);
+
+	tst_msg("RGBA8888 %08x -> CMYK8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_CMYK8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_CMYK8888_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_CMYK8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGB888);
+
+	tst_msg("CMYK8888 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_CMYK8888_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_CMYK8888_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_CMYK8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_RGBA8888);
+
+	tst_msg("CMYK8888 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_CMYK8888_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_CMYK8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_CMYK8888);
+
+	tst_msg("RGB888 %08x -> CMYK8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_CMYK8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_CMYK8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_CMYK8888);
+
+	tst_msg("RGBA8888 %08x -> CMYK8888 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_CMYK8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G1_DB_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G1_DB);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("G1_DB %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G1_DB_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G1_DB_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G1_DB);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("G1_DB %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G1_DB_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_G1_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G1_DB);
+
+	tst_msg("RGB888 %08x -> G1_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G1_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_G1_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G1_DB);
+
+	tst_msg("RGBA8888 %08x -> G1_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G1_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G1_DB_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G1_DB);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("G1_DB %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G1_DB_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G1_DB_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G1_DB);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("G1_DB %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G1_DB_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_G1_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G1_DB);
+
+	tst_msg("RGB888 %08x -> G1_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G1_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_G1_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G1_DB);
+
+	tst_msg("RGBA8888 %08x -> G1_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G1_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_G1_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G1_DB);
+
+	tst_msg("RGB888 %08x -> G1_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G1_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_G1_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G1_DB);
+
+	tst_msg("RGBA8888 %08x -> G1_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G1_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G2_DB_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G2_DB);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("G2_DB %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G2_DB_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G2_DB_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G2_DB);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("G2_DB %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G2_DB_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_G2_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G2_DB);
+
+	tst_msg("RGB888 %08x -> G2_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G2_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_G2_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G2_DB);
+
+	tst_msg("RGBA8888 %08x -> G2_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G2_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G2_DB_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G2_DB);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("G2_DB %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G2_DB_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G2_DB_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G2_DB);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("G2_DB %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G2_DB_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_G2_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G2_DB);
+
+	tst_msg("RGB888 %08x -> G2_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G2_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_G2_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G2_DB);
+
+	tst_msg("RGBA8888 %08x -> G2_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G2_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_G2_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G2_DB);
+
+	tst_msg("RGB888 %08x -> G2_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G2_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_G2_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G2_DB);
+
+	tst_msg("RGBA8888 %08x -> G2_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G2_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G4_DB_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G4_DB);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("G4_DB %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G4_DB_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G4_DB_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G4_DB);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("G4_DB %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G4_DB_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_G4_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G4_DB);
+
+	tst_msg("RGB888 %08x -> G4_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G4_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_G4_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G4_DB);
+
+	tst_msg("RGBA8888 %08x -> G4_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G4_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G4_DB_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G4_DB);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("G4_DB %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G4_DB_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G4_DB_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G4_DB);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("G4_DB %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G4_DB_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_G4_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G4_DB);
+
+	tst_msg("RGB888 %08x -> G4_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G4_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_G4_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G4_DB);
+
+	tst_msg("RGBA8888 %08x -> G4_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G4_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_G4_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G4_DB);
+
+	tst_msg("RGB888 %08x -> G4_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G4_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_G4_DB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G4_DB);
+
+	tst_msg("RGBA8888 %08x -> G4_DB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G4_DB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G1_UB_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G1_UB);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("G1_UB %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G1_UB_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G1_UB_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G1_UB);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("G1_UB %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G1_UB_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_G1_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G1_UB);
+
+	tst_msg("RGB888 %08x -> G1_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G1_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_G1_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G1_UB);
+
+	tst_msg("RGBA8888 %08x -> G1_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G1_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G1_UB_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G1_UB);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("G1_UB %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G1_UB_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G1_UB_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G1_UB);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("G1_UB %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G1_UB_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_G1_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G1_UB);
+
+	tst_msg("RGB888 %08x -> G1_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G1_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_G1_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G1_UB);
+
+	tst_msg("RGBA8888 %08x -> G1_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G1_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_G1_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G1_UB);
+
+	tst_msg("RGB888 %08x -> G1_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G1_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_G1_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G1_UB);
+
+	tst_msg("RGBA8888 %08x -> G1_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G1_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G2_UB_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G2_UB);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("G2_UB %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G2_UB_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G2_UB_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G2_UB);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("G2_UB %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G2_UB_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_G2_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G2_UB);
+
+	tst_msg("RGB888 %08x -> G2_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G2_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_G2_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G2_UB);
+
+	tst_msg("RGBA8888 %08x -> G2_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G2_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G2_UB_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G2_UB);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("G2_UB %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G2_UB_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G2_UB_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G2_UB);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("G2_UB %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G2_UB_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_G2_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G2_UB);
+
+	tst_msg("RGB888 %08x -> G2_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G2_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_G2_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G2_UB);
+
+	tst_msg("RGBA8888 %08x -> G2_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G2_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_G2_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G2_UB);
+
+	tst_msg("RGB888 %08x -> G2_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G2_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_G2_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G2_UB);
+
+	tst_msg("RGBA8888 %08x -> G2_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G2_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G4_UB_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G4_UB);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("G4_UB %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G4_UB_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G4_UB_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G4_UB);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("G4_UB %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G4_UB_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_G4_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G4_UB);
+
+	tst_msg("RGB888 %08x -> G4_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G4_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_G4_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G4_UB);
+
+	tst_msg("RGBA8888 %08x -> G4_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G4_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G4_UB_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G4_UB);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("G4_UB %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G4_UB_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G4_UB_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G4_UB);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("G4_UB %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G4_UB_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_G4_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G4_UB);
+
+	tst_msg("RGB888 %08x -> G4_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G4_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_G4_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G4_UB);
+
+	tst_msg("RGBA8888 %08x -> G4_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G4_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_G4_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G4_UB);
+
+	tst_msg("RGB888 %08x -> G4_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G4_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_G4_UB(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G4_UB);
+
+	tst_msg("RGBA8888 %08x -> G4_UB %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G4_UB(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G8_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G8);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("G8 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G8_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G8_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G8);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("G8 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G8_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_G8(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G8);
+
+	tst_msg("RGB888 %08x -> G8 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G8(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_G8(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G8);
+
+	tst_msg("RGBA8888 %08x -> G8 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G8(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G8_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G8);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("G8 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G8_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G8_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G8);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("G8 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G8_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_G8(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G8);
+
+	tst_msg("RGB888 %08x -> G8 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G8(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_G8(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G8);
+
+	tst_msg("RGBA8888 %08x -> G8 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G8(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_G8(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G8);
+
+	tst_msg("RGB888 %08x -> G8 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G8(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_G8(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G8);
+
+	tst_msg("RGBA8888 %08x -> G8 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G8(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_GA88_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_GA88);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("GA88 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_GA88_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_GA88_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_GA88);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("GA88 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_GA88_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_GA88(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_GA88);
+
+	tst_msg("RGB888 %08x -> GA88 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_GA88(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_GA88(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_GA88);
+
+	tst_msg("RGBA8888 %08x -> GA88 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_GA88(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_GA88_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_GA88);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("GA88 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_GA88_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_GA88_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_GA88);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("GA88 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_GA88_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_GA88(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_GA88);
+
+	tst_msg("RGB888 %08x -> GA88 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_GA88(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_GA88(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_GA88);
+
+	tst_msg("RGBA8888 %08x -> GA88 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_GA88(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_GA88(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_GA88);
+
+	tst_msg("RGB888 %08x -> GA88 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_GA88(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_GA88(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_GA88);
+
+	tst_msg("RGBA8888 %08x -> GA88 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_GA88(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G16_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G16);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGB888);
+
+	tst_msg("G16 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G16_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_G16_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_G16);
+	gp_pixel out_exp = get_white(GP_PIXEL_RGBA8888);
+
+	tst_msg("G16 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G16_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGB888_to_G16(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G16);
+
+	tst_msg("RGB888 %08x -> G16 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G16(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_white_RGBA8888_to_G16(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_white(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_white(GP_PIXEL_G16);
+
+	tst_msg("RGBA8888 %08x -> G16 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G16(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G16_to_RGB888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G16);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGB888);
+
+	tst_msg("G16 %08x -> RGB888 %08x", in, out_exp);
+
+	GP_PIXEL_G16_TO_RGB888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_G16_to_RGBA8888(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_G16);
+	gp_pixel out_exp = get_black(GP_PIXEL_RGBA8888);
+
+	tst_msg("G16 %08x -> RGBA8888 %08x", in, out_exp);
+
+	GP_PIXEL_G16_TO_RGBA8888(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGB888_to_G16(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G16);
+
+	tst_msg("RGB888 %08x -> G16 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G16(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_black_RGBA8888_to_G16(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_black(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_black(GP_PIXEL_G16);
+
+	tst_msg("RGBA8888 %08x -> G16 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G16(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGB888_to_G16(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGB888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G16);
+
+	tst_msg("RGB888 %08x -> G16 %08x", in, out_exp);
+
+	GP_PIXEL_RGB888_TO_G16(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int convert_and_check_red_RGBA8888_to_G16(void)
+{
+	gp_pixel out = 0;
+	gp_pixel in = get_red(GP_PIXEL_RGBA8888);
+	gp_pixel out_exp = get_red(GP_PIXEL_G16);
+
+	tst_msg("RGBA8888 %08x -> G16 %08x", in, out_exp);
+
+	GP_PIXEL_RGBA8888_TO_G16(in, out);
+
+	if (out_exp != out) {
+		tst_msg("Pixels are different have %08x, expected %08x",
+		        out, out_exp);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Pixel Conversions Testsuite",
+	.tests = {
+		{.name = "Convert white RGB101010 -> RGB888",
+		 .tst_fn = convert_and_check_white_RGB101010_to_RGB888},
+		{.name = "Convert white RGB101010 -> RGBA8888",
+		 .tst_fn = convert_and_check_white_RGB101010_to_RGBA8888},
+		{.name = "Convert white RGB888 -> RGB101010",
+		 .tst_fn = convert_and_check_white_RGB888_to_RGB101010},
+		{.name = "Convert white RGBA8888 -> RGB101010",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_RGB101010},
+		{.name = "Convert black RGB101010 -> RGB888",
+		 .tst_fn = convert_and_check_black_RGB101010_to_RGB888},
+		{.name = "Convert black RGB101010 -> RGBA8888",
+		 .tst_fn = convert_and_check_black_RGB101010_to_RGBA8888},
+		{.name = "Convert black RGB888 -> RGB101010",
+		 .tst_fn = convert_and_check_black_RGB888_to_RGB101010},
+		{.name = "Convert black RGBA8888 -> RGB101010",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_RGB101010},
+		{.name = "Convert red RGB101010 -> RGB888",
+		 .tst_fn = convert_and_check_red_RGB101010_to_RGB888},
+		{.name = "Convert red RGB101010 -> RGBA8888",
+		 .tst_fn = convert_and_check_red_RGB101010_to_RGBA8888},
+		{.name = "Convert red RGB888 -> RGB101010",
+		 .tst_fn = convert_and_check_red_RGB888_to_RGB101010},
+		{.name = "Convert red RGBA8888 -> RGB101010",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_RGB101010},
+		{.name = "Convert white xRGB8888 -> RGB888",
+		 .tst_fn = convert_and_check_white_xRGB8888_to_RGB888},
+		{.name = "Convert white xRGB8888 -> RGBA8888",
+		 .tst_fn = convert_and_check_white_xRGB8888_to_RGBA8888},
+		{.name = "Convert white RGB888 -> xRGB8888",
+		 .tst_fn = convert_and_check_white_RGB888_to_xRGB8888},
+		{.name = "Convert white RGBA8888 -> xRGB8888",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_xRGB8888},
+		{.name = "Convert black xRGB8888 -> RGB888",
+		 .tst_fn = convert_and_check_black_xRGB8888_to_RGB888},
+		{.name = "Convert black xRGB8888 -> RGBA8888",
+		 .tst_fn = convert_and_check_black_xRGB8888_to_RGBA8888},
+		{.name = "Convert black RGB888 -> xRGB8888",
+		 .tst_fn = convert_and_check_black_RGB888_to_xRGB8888},
+		{.name = "Convert black RGBA8888 -> xRGB8888",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_xRGB8888},
+		{.name = "Convert red xRGB8888 -> RGB888",
+		 .tst_fn = convert_and_check_red_xRGB8888_to_RGB888},
+		{.name = "Convert red xRGB8888 -> RGBA8888",
+		 .tst_fn = convert_and_check_red_xRGB8888_to_RGBA8888},
+		{.name = "Convert red RGB888 -> xRGB8888",
+		 .tst_fn = convert_and_check_red_RGB888_to_xRGB8888},
+		{.name = "Convert red RGBA8888 -> xRGB8888",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_xRGB8888},
+		{.name = "Convert white BGR888 -> RGB888",
+		 .tst_fn = convert_and_check_white_BGR888_to_RGB888},
+		{.name = "Convert white BGR888 -> RGBA8888",
+		 .tst_fn = convert_and_check_white_BGR888_to_RGBA8888},
+		{.name = "Convert white RGB888 -> BGR888",
+		 .tst_fn = convert_and_check_white_RGB888_to_BGR888},
+		{.name = "Convert white RGBA8888 -> BGR888",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_BGR888},
+		{.name = "Convert black BGR888 -> RGB888",
+		 .tst_fn = convert_and_check_black_BGR888_to_RGB888},
+		{.name = "Convert black BGR888 -> RGBA8888",
+		 .tst_fn = convert_and_check_black_BGR888_to_RGBA8888},
+		{.name = "Convert black RGB888 -> BGR888",
+		 .tst_fn = convert_and_check_black_RGB888_to_BGR888},
+		{.name = "Convert black RGBA8888 -> BGR888",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_BGR888},
+		{.name = "Convert red BGR888 -> RGB888",
+		 .tst_fn = convert_and_check_red_BGR888_to_RGB888},
+		{.name = "Convert red BGR888 -> RGBA8888",
+		 .tst_fn = convert_and_check_red_BGR888_to_RGBA8888},
+		{.name = "Convert red RGB888 -> BGR888",
+		 .tst_fn = convert_and_check_red_RGB888_to_BGR888},
+		{.name = "Convert red RGBA8888 -> BGR888",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_BGR888},
+		{.name = "Convert white RGB555 -> RGB888",
+		 .tst_fn = convert_and_check_white_RGB555_to_RGB888},
+		{.name = "Convert white RGB555 -> RGBA8888",
+		 .tst_fn = convert_and_check_white_RGB555_to_RGBA8888},
+		{.name = "Convert white RGB888 -> RGB555",
+		 .tst_fn = convert_and_check_white_RGB888_to_RGB555},
+		{.name = "Convert white RGBA8888 -> RGB555",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_RGB555},
+		{.name = "Convert black RGB555 -> RGB888",
+		 .tst_fn = convert_and_check_black_RGB555_to_RGB888},
+		{.name = "Convert black RGB555 -> RGBA8888",
+		 .tst_fn = convert_and_check_black_RGB555_to_RGBA8888},
+		{.name = "Convert black RGB888 -> RGB555",
+		 .tst_fn = convert_and_check_black_RGB888_to_RGB555},
+		{.name = "Convert black RGBA8888 -> RGB555",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_RGB555},
+		{.name = "Convert red RGB555 -> RGB888",
+		 .tst_fn = convert_and_check_red_RGB555_to_RGB888},
+		{.name = "Convert red RGB555 -> RGBA8888",
+		 .tst_fn = convert_and_check_red_RGB555_to_RGBA8888},
+		{.name = "Convert red RGB888 -> RGB555",
+		 .tst_fn = convert_and_check_red_RGB888_to_RGB555},
+		{.name = "Convert red RGBA8888 -> RGB555",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_RGB555},
+		{.name = "Convert white RGB565 -> RGB888",
+		 .tst_fn = convert_and_check_white_RGB565_to_RGB888},
+		{.name = "Convert white RGB565 -> RGBA8888",
+		 .tst_fn = convert_and_check_white_RGB565_to_RGBA8888},
+		{.name = "Convert white RGB888 -> RGB565",
+		 .tst_fn = convert_and_check_white_RGB888_to_RGB565},
+		{.name = "Convert white RGBA8888 -> RGB565",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_RGB565},
+		{.name = "Convert black RGB565 -> RGB888",
+		 .tst_fn = convert_and_check_black_RGB565_to_RGB888},
+		{.name = "Convert black RGB565 -> RGBA8888",
+		 .tst_fn = convert_and_check_black_RGB565_to_RGBA8888},
+		{.name = "Convert black RGB888 -> RGB565",
+		 .tst_fn = convert_and_check_black_RGB888_to_RGB565},
+		{.name = "Convert black RGBA8888 -> RGB565",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_RGB565},
+		{.name = "Convert red RGB565 -> RGB888",
+		 .tst_fn = convert_and_check_red_RGB565_to_RGB888},
+		{.name = "Convert red RGB565 -> RGBA8888",
+		 .tst_fn = convert_and_check_red_RGB565_to_RGBA8888},
+		{.name = "Convert red RGB888 -> RGB565",
+		 .tst_fn = convert_and_check_red_RGB888_to_RGB565},
+		{.name = "Convert red RGBA8888 -> RGB565",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_RGB565},
+		{.name = "Convert white RGB666 -> RGB888",
+		 .tst_fn = convert_and_check_white_RGB666_to_RGB888},
+		{.name = "Convert white RGB666 -> RGBA8888",
+		 .tst_fn = convert_and_check_white_RGB666_to_RGBA8888},
+		{.name = "Convert white RGB888 -> RGB666",
+		 .tst_fn = convert_and_check_white_RGB888_to_RGB666},
+		{.name = "Convert white RGBA8888 -> RGB666",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_RGB666},
+		{.name = "Convert black RGB666 -> RGB888",
+		 .tst_fn = convert_and_check_black_RGB666_to_RGB888},
+		{.name = "Convert black RGB666 -> RGBA8888",
+		 .tst_fn = convert_and_check_black_RGB666_to_RGBA8888},
+		{.name = "Convert black RGB888 -> RGB666",
+		 .tst_fn = convert_and_check_black_RGB888_to_RGB666},
+		{.name = "Convert black RGBA8888 -> RGB666",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_RGB666},
+		{.name = "Convert red RGB666 -> RGB888",
+		 .tst_fn = convert_and_check_red_RGB666_to_RGB888},
+		{.name = "Convert red RGB666 -> RGBA8888",
+		 .tst_fn = convert_and_check_red_RGB666_to_RGBA8888},
+		{.name = "Convert red RGB888 -> RGB666",
+		 .tst_fn = convert_and_check_red_RGB888_to_RGB666},
+		{.name = "Convert red RGBA8888 -> RGB666",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_RGB666},
+		{.name = "Convert white RGB332 -> RGB888",
+		 .tst_fn = convert_and_check_white_RGB332_to_RGB888},
+		{.name = "Convert white RGB332 -> RGBA8888",
+		 .tst_fn = convert_and_check_white_RGB332_to_RGBA8888},
+		{.name = "Convert white RGB888 -> RGB332",
+		 .tst_fn = convert_and_check_white_RGB888_to_RGB332},
+		{.name = "Convert white RGBA8888 -> RGB332",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_RGB332},
+		{.name = "Convert black RGB332 -> RGB888",
+		 .tst_fn = convert_and_check_black_RGB332_to_RGB888},
+		{.name = "Convert black RGB332 -> RGBA8888",
+		 .tst_fn = convert_and_check_black_RGB332_to_RGBA8888},
+		{.name = "Convert black RGB888 -> RGB332",
+		 .tst_fn = convert_and_check_black_RGB888_to_RGB332},
+		{.name = "Convert black RGBA8888 -> RGB332",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_RGB332},
+		{.name = "Convert red RGB332 -> RGB888",
+		 .tst_fn = convert_and_check_red_RGB332_to_RGB888},
+		{.name = "Convert red RGB332 -> RGBA8888",
+		 .tst_fn = convert_and_check_red_RGB332_to_RGBA8888},
+		{.name = "Convert red RGB888 -> RGB332",
+		 .tst_fn = convert_and_check_red_RGB888_to_RGB332},
+		{.name = "Convert red RGBA8888 -> RGB332",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_RGB332},
+		{.name = "Convert white CMYK8888 -> RGB888",
+		 .tst_fn = convert_and_check_white_CMYK8888_to_RGB888},
+		{.name = "Convert white CMYK8888 -> RGBA8888",
+		 .tst_fn = convert_and_check_white_CMYK8888_to_RGBA8888},
+		{.name = "Convert white RGB888 -> CMYK8888",
+		 .tst_fn = convert_and_check_white_RGB888_to_CMYK8888},
+		{.name = "Convert white RGBA8888 -> CMYK8888",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_CMYK8888},
+		{.name = "Convert black CMYK8888 -> RGB888",
+		 .tst_fn = convert_and_check_black_CMYK8888_to_RGB888},
+		{.name = "Convert black CMYK8888 -> RGBA8888",
+		 .tst_fn = convert_and_check_black_CMYK8888_to_RGBA8888},
+		{.name = "Convert black RGB888 -> CMYK8888",
+		 .tst_fn = convert_and_check_black_RGB888_to_CMYK8888},
+		{.name = "Convert black RGBA8888 -> CMYK8888",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_CMYK8888},
+		{.name = "Convert red CMYK8888 -> RGB888",
+		 .tst_fn = convert_and_check_red_CMYK8888_to_RGB888},
+		{.name = "Convert red CMYK8888 -> RGBA8888",
+		 .tst_fn = convert_and_check_red_CMYK8888_to_RGBA8888},
+		{.name = "Convert red RGB888 -> CMYK8888",
+		 .tst_fn = convert_and_check_red_RGB888_to_CMYK8888},
+		{.name = "Convert red RGBA8888 -> CMYK8888",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_CMYK8888},
+		{.name = "Convert white G1_DB -> RGB888",
+		 .tst_fn = convert_and_check_white_G1_DB_to_RGB888},
+		{.name = "Convert white G1_DB -> RGBA8888",
+		 .tst_fn = convert_and_check_white_G1_DB_to_RGBA8888},
+		{.name = "Convert white RGB888 -> G1_DB",
+		 .tst_fn = convert_and_check_white_RGB888_to_G1_DB},
+		{.name = "Convert white RGBA8888 -> G1_DB",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_G1_DB},
+		{.name = "Convert black G1_DB -> RGB888",
+		 .tst_fn = convert_and_check_black_G1_DB_to_RGB888},
+		{.name = "Convert black G1_DB -> RGBA8888",
+		 .tst_fn = convert_and_check_black_G1_DB_to_RGBA8888},
+		{.name = "Convert black RGB888 -> G1_DB",
+		 .tst_fn = convert_and_check_black_RGB888_to_G1_DB},
+		{.name = "Convert black RGBA8888 -> G1_DB",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_G1_DB},
+		{.name = "Convert red RGB888 -> G1_DB",
+		 .tst_fn = convert_and_check_red_RGB888_to_G1_DB},
+		{.name = "Convert red RGBA8888 -> G1_DB",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_G1_DB},
+		{.name = "Convert white G2_DB -> RGB888",
+		 .tst_fn = convert_and_check_white_G2_DB_to_RGB888},
+		{.name = "Convert white G2_DB -> RGBA8888",
+		 .tst_fn = convert_and_check_white_G2_DB_to_RGBA8888},
+		{.name = "Convert white RGB888 -> G2_DB",
+		 .tst_fn = convert_and_check_white_RGB888_to_G2_DB},
+		{.name = "Convert white RGBA8888 -> G2_DB",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_G2_DB},
+		{.name = "Convert black G2_DB -> RGB888",
+		 .tst_fn = convert_and_check_black_G2_DB_to_RGB888},
+		{.name = "Convert black G2_DB -> RGBA8888",
+		 .tst_fn = convert_and_check_black_G2_DB_to_RGBA8888},
+		{.name = "Convert black RGB888 -> G2_DB",
+		 .tst_fn = convert_and_check_black_RGB888_to_G2_DB},
+		{.name = "Convert black RGBA8888 -> G2_DB",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_G2_DB},
+		{.name = "Convert red RGB888 -> G2_DB",
+		 .tst_fn = convert_and_check_red_RGB888_to_G2_DB},
+		{.name = "Convert red RGBA8888 -> G2_DB",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_G2_DB},
+		{.name = "Convert white G4_DB -> RGB888",
+		 .tst_fn = convert_and_check_white_G4_DB_to_RGB888},
+		{.name = "Convert white G4_DB -> RGBA8888",
+		 .tst_fn = convert_and_check_white_G4_DB_to_RGBA8888},
+		{.name = "Convert white RGB888 -> G4_DB",
+		 .tst_fn = convert_and_check_white_RGB888_to_G4_DB},
+		{.name = "Convert white RGBA8888 -> G4_DB",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_G4_DB},
+		{.name = "Convert black G4_DB -> RGB888",
+		 .tst_fn = convert_and_check_black_G4_DB_to_RGB888},
+		{.name = "Convert black G4_DB -> RGBA8888",
+		 .tst_fn = convert_and_check_black_G4_DB_to_RGBA8888},
+		{.name = "Convert black RGB888 -> G4_DB",
+		 .tst_fn = convert_and_check_black_RGB888_to_G4_DB},
+		{.name = "Convert black RGBA8888 -> G4_DB",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_G4_DB},
+		{.name = "Convert red RGB888 -> G4_DB",
+		 .tst_fn = convert_and_check_red_RGB888_to_G4_DB},
+		{.name = "Convert red RGBA8888 -> G4_DB",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_G4_DB},
+		{.name = "Convert white G1_UB -> RGB888",
+		 .tst_fn = convert_and_check_white_G1_UB_to_RGB888},
+		{.name = "Convert white G1_UB -> RGBA8888",
+		 .tst_fn = convert_and_check_white_G1_UB_to_RGBA8888},
+		{.name = "Convert white RGB888 -> G1_UB",
+		 .tst_fn = convert_and_check_white_RGB888_to_G1_UB},
+		{.name = "Convert white RGBA8888 -> G1_UB",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_G1_UB},
+		{.name = "Convert black G1_UB -> RGB888",
+		 .tst_fn = convert_and_check_black_G1_UB_to_RGB888},
+		{.name = "Convert black G1_UB -> RGBA8888",
+		 .tst_fn = convert_and_check_black_G1_UB_to_RGBA8888},
+		{.name = "Convert black RGB888 -> G1_UB",
+		 .tst_fn = convert_and_check_black_RGB888_to_G1_UB},
+		{.name = "Convert black RGBA8888 -> G1_UB",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_G1_UB},
+		{.name = "Convert red RGB888 -> G1_UB",
+		 .tst_fn = convert_and_check_red_RGB888_to_G1_UB},
+		{.name = "Convert red RGBA8888 -> G1_UB",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_G1_UB},
+		{.name = "Convert white G2_UB -> RGB888",
+		 .tst_fn = convert_and_check_white_G2_UB_to_RGB888},
+		{.name = "Convert white G2_UB -> RGBA8888",
+		 .tst_fn = convert_and_check_white_G2_UB_to_RGBA8888},
+		{.name = "Convert white RGB888 -> G2_UB",
+		 .tst_fn = convert_and_check_white_RGB888_to_G2_UB},
+		{.name = "Convert white RGBA8888 -> G2_UB",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_G2_UB},
+		{.name = "Convert black G2_UB -> RGB888",
+		 .tst_fn = convert_and_check_black_G2_UB_to_RGB888},
+		{.name = "Convert black G2_UB -> RGBA8888",
+		 .tst_fn = convert_and_check_black_G2_UB_to_RGBA8888},
+		{.name = "Convert black RGB888 -> G2_UB",
+		 .tst_fn = convert_and_check_black_RGB888_to_G2_UB},
+		{.name = "Convert black RGBA8888 -> G2_UB",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_G2_UB},
+		{.name = "Convert red RGB888 -> G2_UB",
+		 .tst_fn = convert_and_check_red_RGB888_to_G2_UB},
+		{.name = "Convert red RGBA8888 -> G2_UB",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_G2_UB},
+		{.name = "Convert white G4_UB -> RGB888",
+		 .tst_fn = convert_and_check_white_G4_UB_to_RGB888},
+		{.name = "Convert white G4_UB -> RGBA8888",
+		 .tst_fn = convert_and_check_white_G4_UB_to_RGBA8888},
+		{.name = "Convert white RGB888 -> G4_UB",
+		 .tst_fn = convert_and_check_white_RGB888_to_G4_UB},
+		{.name = "Convert white RGBA8888 -> G4_UB",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_G4_UB},
+		{.name = "Convert black G4_UB -> RGB888",
+		 .tst_fn = convert_and_check_black_G4_UB_to_RGB888},
+		{.name = "Convert black G4_UB -> RGBA8888",
+		 .tst_fn = convert_and_check_black_G4_UB_to_RGBA8888},
+		{.name = "Convert black RGB888 -> G4_UB",
+		 .tst_fn = convert_and_check_black_RGB888_to_G4_UB},
+		{.name = "Convert black RGBA8888 -> G4_UB",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_G4_UB},
+		{.name = "Convert red RGB888 -> G4_UB",
+		 .tst_fn = convert_and_check_red_RGB888_to_G4_UB},
+		{.name = "Convert red RGBA8888 -> G4_UB",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_G4_UB},
+		{.name = "Convert white G8 -> RGB888",
+		 .tst_fn = convert_and_check_white_G8_to_RGB888},
+		{.name = "Convert white G8 -> RGBA8888",
+		 .tst_fn = convert_and_check_white_G8_to_RGBA8888},
+		{.name = "Convert white RGB888 -> G8",
+		 .tst_fn = convert_and_check_white_RGB888_to_G8},
+		{.name = "Convert white RGBA8888 -> G8",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_G8},
+		{.name = "Convert black G8 -> RGB888",
+		 .tst_fn = convert_and_check_black_G8_to_RGB888},
+		{.name = "Convert black G8 -> RGBA8888",
+		 .tst_fn = convert_and_check_black_G8_to_RGBA8888},
+		{.name = "Convert black RGB888 -> G8",
+		 .tst_fn = convert_and_check_black_RGB888_to_G8},
+		{.name = "Convert black RGBA8888 -> G8",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_G8},
+		{.name = "Convert red RGB888 -> G8",
+		 .tst_fn = convert_and_check_red_RGB888_to_G8},
+		{.name = "Convert red RGBA8888 -> G8",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_G8},
+		{.name = "Convert white GA88 -> RGB888",
+		 .tst_fn = convert_and_check_white_GA88_to_RGB888},
+		{.name = "Convert white GA88 -> RGBA8888",
+		 .tst_fn = convert_and_check_white_GA88_to_RGBA8888},
+		{.name = "Convert white RGB888 -> GA88",
+		 .tst_fn = convert_and_check_white_RGB888_to_GA88},
+		{.name = "Convert white RGBA8888 -> GA88",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_GA88},
+		{.name = "Convert black GA88 -> RGB888",
+		 .tst_fn = convert_and_check_black_GA88_to_RGB888},
+		{.name = "Convert black GA88 -> RGBA8888",
+		 .tst_fn = convert_and_check_black_GA88_to_RGBA8888},
+		{.name = "Convert black RGB888 -> GA88",
+		 .tst_fn = convert_and_check_black_RGB888_to_GA88},
+		{.name = "Convert black RGBA8888 -> GA88",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_GA88},
+		{.name = "Convert red RGB888 -> GA88",
+		 .tst_fn = convert_and_check_red_RGB888_to_GA88},
+		{.name = "Convert red RGBA8888 -> GA88",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_GA88},
+		{.name = "Convert white G16 -> RGB888",
+		 .tst_fn = convert_and_check_white_G16_to_RGB888},
+		{.name = "Convert white G16 -> RGBA8888",
+		 .tst_fn = convert_and_check_white_G16_to_RGBA8888},
+		{.name = "Convert white RGB888 -> G16",
+		 .tst_fn = convert_and_check_white_RGB888_to_G16},
+		{.name = "Convert white RGBA8888 -> G16",
+		 .tst_fn = convert_and_check_white_RGBA8888_to_G16},
+		{.name = "Convert black G16 -> RGB888",
+		 .tst_fn = convert_and_check_black_G16_to_RGB888},
+		{.name = "Convert black G16 -> RGBA8888",
+		 .tst_fn = convert_and_check_black_G16_to_RGBA8888},
+		{.name = "Convert black RGB888 -> G16",
+		 .tst_fn = convert_and_check_black_RGB888_to_G16},
+		{.name = "Convert black RGBA8888 -> G16",
+		 .tst_fn = convert_and_check_black_RGBA8888_to_G16},
+		{.name = "Convert red RGB888 -> G16",
+		 .tst_fn = convert_and_check_red_RGB888_to_G16},
+		{.name = "Convert red RGBA8888 -> G16",
+		 .tst_fn = convert_and_check_red_RGBA8888_to_G16},
+		{.name = NULL}
+	}
+};
@@ -0,0 +1,13108 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * convert_scale.gen.c
+ *
+ * GENERATED on 2026 10 19 15:08:57 from convert_scale.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * ConvertScale tests.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <stdint.h>
+
+#include <core/gp_convert_scale.gen.h>
+
+#include "tst_test.h"
+
+static int check_convert_1_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_1(v);
+		/*
+		 * We have 2 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_2(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 4 values while making sure 0 -> 0
+		 * and 1 -> 3 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 3.
+		 */
+		fres = (v / 1.0) * 3.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_3(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 8 values while making sure 0 -> 0
+		 * and 1 -> 7 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 7.
+		 */
+		fres = (v / 1.0) * 7.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_4(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 16 values while making sure 0 -> 0
+		 * and 1 -> 15 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 15.
+		 */
+		fres = (v / 1.0) * 15.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_5(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 32 values while making sure 0 -> 0
+		 * and 1 -> 31 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 31.
+		 */
+		fres = (v / 1.0) * 31.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_6(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 64 values while making sure 0 -> 0
+		 * and 1 -> 63 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 63.
+		 */
+		fres = (v / 1.0) * 63.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_7(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 128 values while making sure 0 -> 0
+		 * and 1 -> 127 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 127.
+		 */
+		fres = (v / 1.0) * 127.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_8(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 256 values while making sure 0 -> 0
+		 * and 1 -> 255 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 255.
+		 */
+		fres = (v / 1.0) * 255.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_9(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 512 values while making sure 0 -> 0
+		 * and 1 -> 511 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 511.
+		 */
+		fres = (v / 1.0) * 511.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_10(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 1024 values while making sure 0 -> 0
+		 * and 1 -> 1023 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 1023.
+		 */
+		fres = (v / 1.0) * 1023.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_11(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 2048 values while making sure 0 -> 0
+		 * and 1 -> 2047 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 2047.
+		 */
+		fres = (v / 1.0) * 2047.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_12(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 4096 values while making sure 0 -> 0
+		 * and 1 -> 4095 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 4095.
+		 */
+		fres = (v / 1.0) * 4095.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_13(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 8192 values while making sure 0 -> 0
+		 * and 1 -> 8191 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 8191.
+		 */
+		fres = (v / 1.0) * 8191.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_14(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 16384 values while making sure 0 -> 0
+		 * and 1 -> 16383 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 16383.
+		 */
+		fres = (v / 1.0) * 16383.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_1_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1; v++) {
+		res = GP_SCALE_VAL_1_15(v);
+		/*
+		 * We have 2 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 1 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 1.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_1_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_1(v);
+		/*
+		 * We have 4 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 3 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_2(v);
+		/*
+		 * We have 4 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 3 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_3(v);
+		/*
+		 * We have 4 values and we need to map them to
+		 * subset of 8 values while making sure 0 -> 0
+		 * and 3 -> 7 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 3 and then multiply
+		 * it by output maximal value 7.
+		 */
+		fres = (v / 3.0) * 7.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_4(v);
+		/*
+		 * We have 4 values and we need to map them to
+		 * subset of 16 values while making sure 0 -> 0
+		 * and 3 -> 15 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 3 and then multiply
+		 * it by output maximal value 15.
+		 */
+		fres = (v / 3.0) * 15.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_5(v);
+		/*
+		 * We have 4 values and we need to map them to
+		 * subset of 32 values while making sure 0 -> 0
+		 * and 3 -> 31 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 3 and then multiply
+		 * it by output maximal value 31.
+		 */
+		fres = (v / 3.0) * 31.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_6(v);
+		/*
+		 * We have 4 values and we need to map them to
+		 * subset of 64 values while making sure 0 -> 0
+		 * and 3 -> 63 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 3 and then multiply
+		 * it by output maximal value 63.
+		 */
+		fres = (v / 3.0) * 63.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_7(v);
+		/*
+		 * We have 4 values and we need to map them to
+		 * subset of 128 values while making sure 0 -> 0
+		 * and 3 -> 127 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 3 and then multiply
+		 * it by output maximal value 127.
+		 */
+		fres = (v / 3.0) * 127.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_8(v);
+		/*
+		 * We have 4 values and we need to map them to
+		 * subset of 256 values while making sure 0 -> 0
+		 * and 3 -> 255 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 3 and then multiply
+		 * it by output maximal value 255.
+		 */
+		fres = (v / 3.0) * 255.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_9(v);
+		/*
+		 * We have 4 values and we need to map them to
+		 * subset of 512 values while making sure 0 -> 0
+		 * and 3 -> 511 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 3 and then multiply
+		 * it by output maximal value 511.
+		 */
+		fres = (v / 3.0) * 511.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_10(v);
+		/*
+		 * We have 4 values and we need to map them to
+		 * subset of 1024 values while making sure 0 -> 0
+		 * and 3 -> 1023 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 3 and then multiply
+		 * it by output maximal value 1023.
+		 */
+		fres = (v / 3.0) * 1023.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_11(v);
+		/*
+		 * We have 4 values and we need to map them to
+		 * subset of 2048 values while making sure 0 -> 0
+		 * and 3 -> 2047 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 3 and then multiply
+		 * it by output maximal value 2047.
+		 */
+		fres = (v / 3.0) * 2047.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_12(v);
+		/*
+		 * We have 4 values and we need to map them to
+		 * subset of 4096 values while making sure 0 -> 0
+		 * and 3 -> 4095 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 3 and then multiply
+		 * it by output maximal value 4095.
+		 */
+		fres = (v / 3.0) * 4095.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_13(v);
+		/*
+		 * We have 4 values and we need to map them to
+		 * subset of 8192 values while making sure 0 -> 0
+		 * and 3 -> 8191 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 3 and then multiply
+		 * it by output maximal value 8191.
+		 */
+		fres = (v / 3.0) * 8191.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_14(v);
+		/*
+		 * We have 4 values and we need to map them to
+		 * subset of 16384 values while making sure 0 -> 0
+		 * and 3 -> 16383 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 3 and then multiply
+		 * it by output maximal value 16383.
+		 */
+		fres = (v / 3.0) * 16383.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_2_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 3; v++) {
+		res = GP_SCALE_VAL_2_15(v);
+		/*
+		 * We have 4 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 3 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 3 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 3.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_2_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_1(v);
+		/*
+		 * We have 8 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 7 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_2(v);
+		/*
+		 * We have 8 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 7 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_3(v);
+		/*
+		 * We have 8 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 7 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_4(v);
+		/*
+		 * We have 8 values and we need to map them to
+		 * subset of 16 values while making sure 0 -> 0
+		 * and 7 -> 15 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 7 and then multiply
+		 * it by output maximal value 15.
+		 */
+		fres = (v / 7.0) * 15.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_5(v);
+		/*
+		 * We have 8 values and we need to map them to
+		 * subset of 32 values while making sure 0 -> 0
+		 * and 7 -> 31 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 7 and then multiply
+		 * it by output maximal value 31.
+		 */
+		fres = (v / 7.0) * 31.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_6(v);
+		/*
+		 * We have 8 values and we need to map them to
+		 * subset of 64 values while making sure 0 -> 0
+		 * and 7 -> 63 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 7 and then multiply
+		 * it by output maximal value 63.
+		 */
+		fres = (v / 7.0) * 63.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_7(v);
+		/*
+		 * We have 8 values and we need to map them to
+		 * subset of 128 values while making sure 0 -> 0
+		 * and 7 -> 127 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 7 and then multiply
+		 * it by output maximal value 127.
+		 */
+		fres = (v / 7.0) * 127.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_8(v);
+		/*
+		 * We have 8 values and we need to map them to
+		 * subset of 256 values while making sure 0 -> 0
+		 * and 7 -> 255 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 7 and then multiply
+		 * it by output maximal value 255.
+		 */
+		fres = (v / 7.0) * 255.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_9(v);
+		/*
+		 * We have 8 values and we need to map them to
+		 * subset of 512 values while making sure 0 -> 0
+		 * and 7 -> 511 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 7 and then multiply
+		 * it by output maximal value 511.
+		 */
+		fres = (v / 7.0) * 511.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_10(v);
+		/*
+		 * We have 8 values and we need to map them to
+		 * subset of 1024 values while making sure 0 -> 0
+		 * and 7 -> 1023 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 7 and then multiply
+		 * it by output maximal value 1023.
+		 */
+		fres = (v / 7.0) * 1023.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_11(v);
+		/*
+		 * We have 8 values and we need to map them to
+		 * subset of 2048 values while making sure 0 -> 0
+		 * and 7 -> 2047 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 7 and then multiply
+		 * it by output maximal value 2047.
+		 */
+		fres = (v / 7.0) * 2047.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_12(v);
+		/*
+		 * We have 8 values and we need to map them to
+		 * subset of 4096 values while making sure 0 -> 0
+		 * and 7 -> 4095 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 7 and then multiply
+		 * it by output maximal value 4095.
+		 */
+		fres = (v / 7.0) * 4095.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_13(v);
+		/*
+		 * We have 8 values and we need to map them to
+		 * subset of 8192 values while making sure 0 -> 0
+		 * and 7 -> 8191 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 7 and then multiply
+		 * it by output maximal value 8191.
+		 */
+		fres = (v / 7.0) * 8191.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_14(v);
+		/*
+		 * We have 8 values and we need to map them to
+		 * subset of 16384 values while making sure 0 -> 0
+		 * and 7 -> 16383 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 7 and then multiply
+		 * it by output maximal value 16383.
+		 */
+		fres = (v / 7.0) * 16383.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_3_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 7; v++) {
+		res = GP_SCALE_VAL_3_15(v);
+		/*
+		 * We have 8 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 7 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 7 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 7.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_3_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_1(v);
+		/*
+		 * We have 16 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 15 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_2(v);
+		/*
+		 * We have 16 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 15 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_3(v);
+		/*
+		 * We have 16 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 15 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_4(v);
+		/*
+		 * We have 16 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 15 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_5(v);
+		/*
+		 * We have 16 values and we need to map them to
+		 * subset of 32 values while making sure 0 -> 0
+		 * and 15 -> 31 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 15 and then multiply
+		 * it by output maximal value 31.
+		 */
+		fres = (v / 15.0) * 31.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_6(v);
+		/*
+		 * We have 16 values and we need to map them to
+		 * subset of 64 values while making sure 0 -> 0
+		 * and 15 -> 63 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 15 and then multiply
+		 * it by output maximal value 63.
+		 */
+		fres = (v / 15.0) * 63.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_7(v);
+		/*
+		 * We have 16 values and we need to map them to
+		 * subset of 128 values while making sure 0 -> 0
+		 * and 15 -> 127 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 15 and then multiply
+		 * it by output maximal value 127.
+		 */
+		fres = (v / 15.0) * 127.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_8(v);
+		/*
+		 * We have 16 values and we need to map them to
+		 * subset of 256 values while making sure 0 -> 0
+		 * and 15 -> 255 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 15 and then multiply
+		 * it by output maximal value 255.
+		 */
+		fres = (v / 15.0) * 255.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_9(v);
+		/*
+		 * We have 16 values and we need to map them to
+		 * subset of 512 values while making sure 0 -> 0
+		 * and 15 -> 511 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 15 and then multiply
+		 * it by output maximal value 511.
+		 */
+		fres = (v / 15.0) * 511.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_10(v);
+		/*
+		 * We have 16 values and we need to map them to
+		 * subset of 1024 values while making sure 0 -> 0
+		 * and 15 -> 1023 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 15 and then multiply
+		 * it by output maximal value 1023.
+		 */
+		fres = (v / 15.0) * 1023.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_11(v);
+		/*
+		 * We have 16 values and we need to map them to
+		 * subset of 2048 values while making sure 0 -> 0
+		 * and 15 -> 2047 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 15 and then multiply
+		 * it by output maximal value 2047.
+		 */
+		fres = (v / 15.0) * 2047.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_12(v);
+		/*
+		 * We have 16 values and we need to map them to
+		 * subset of 4096 values while making sure 0 -> 0
+		 * and 15 -> 4095 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 15 and then multiply
+		 * it by output maximal value 4095.
+		 */
+		fres = (v / 15.0) * 4095.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_13(v);
+		/*
+		 * We have 16 values and we need to map them to
+		 * subset of 8192 values while making sure 0 -> 0
+		 * and 15 -> 8191 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 15 and then multiply
+		 * it by output maximal value 8191.
+		 */
+		fres = (v / 15.0) * 8191.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_14(v);
+		/*
+		 * We have 16 values and we need to map them to
+		 * subset of 16384 values while making sure 0 -> 0
+		 * and 15 -> 16383 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 15 and then multiply
+		 * it by output maximal value 16383.
+		 */
+		fres = (v / 15.0) * 16383.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_4_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 15; v++) {
+		res = GP_SCALE_VAL_4_15(v);
+		/*
+		 * We have 16 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 15 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 15 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 15.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_4_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_1(v);
+		/*
+		 * We have 32 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 31 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_2(v);
+		/*
+		 * We have 32 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 31 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_3(v);
+		/*
+		 * We have 32 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 31 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_4(v);
+		/*
+		 * We have 32 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 31 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_5(v);
+		/*
+		 * We have 32 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 31 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_6(v);
+		/*
+		 * We have 32 values and we need to map them to
+		 * subset of 64 values while making sure 0 -> 0
+		 * and 31 -> 63 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 31 and then multiply
+		 * it by output maximal value 63.
+		 */
+		fres = (v / 31.0) * 63.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_7(v);
+		/*
+		 * We have 32 values and we need to map them to
+		 * subset of 128 values while making sure 0 -> 0
+		 * and 31 -> 127 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 31 and then multiply
+		 * it by output maximal value 127.
+		 */
+		fres = (v / 31.0) * 127.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_8(v);
+		/*
+		 * We have 32 values and we need to map them to
+		 * subset of 256 values while making sure 0 -> 0
+		 * and 31 -> 255 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 31 and then multiply
+		 * it by output maximal value 255.
+		 */
+		fres = (v / 31.0) * 255.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_9(v);
+		/*
+		 * We have 32 values and we need to map them to
+		 * subset of 512 values while making sure 0 -> 0
+		 * and 31 -> 511 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 31 and then multiply
+		 * it by output maximal value 511.
+		 */
+		fres = (v / 31.0) * 511.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_10(v);
+		/*
+		 * We have 32 values and we need to map them to
+		 * subset of 1024 values while making sure 0 -> 0
+		 * and 31 -> 1023 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 31 and then multiply
+		 * it by output maximal value 1023.
+		 */
+		fres = (v / 31.0) * 1023.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_11(v);
+		/*
+		 * We have 32 values and we need to map them to
+		 * subset of 2048 values while making sure 0 -> 0
+		 * and 31 -> 2047 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 31 and then multiply
+		 * it by output maximal value 2047.
+		 */
+		fres = (v / 31.0) * 2047.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_12(v);
+		/*
+		 * We have 32 values and we need to map them to
+		 * subset of 4096 values while making sure 0 -> 0
+		 * and 31 -> 4095 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 31 and then multiply
+		 * it by output maximal value 4095.
+		 */
+		fres = (v / 31.0) * 4095.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_13(v);
+		/*
+		 * We have 32 values and we need to map them to
+		 * subset of 8192 values while making sure 0 -> 0
+		 * and 31 -> 8191 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 31 and then multiply
+		 * it by output maximal value 8191.
+		 */
+		fres = (v / 31.0) * 8191.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_14(v);
+		/*
+		 * We have 32 values and we need to map them to
+		 * subset of 16384 values while making sure 0 -> 0
+		 * and 31 -> 16383 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 31 and then multiply
+		 * it by output maximal value 16383.
+		 */
+		fres = (v / 31.0) * 16383.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_5_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 31; v++) {
+		res = GP_SCALE_VAL_5_15(v);
+		/*
+		 * We have 32 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 31 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 31 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 31.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_5_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_1(v);
+		/*
+		 * We have 64 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 63 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_2(v);
+		/*
+		 * We have 64 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 63 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_3(v);
+		/*
+		 * We have 64 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 63 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_4(v);
+		/*
+		 * We have 64 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 63 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_5(v);
+		/*
+		 * We have 64 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 63 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_6(v);
+		/*
+		 * We have 64 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 63 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_7(v);
+		/*
+		 * We have 64 values and we need to map them to
+		 * subset of 128 values while making sure 0 -> 0
+		 * and 63 -> 127 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 63 and then multiply
+		 * it by output maximal value 127.
+		 */
+		fres = (v / 63.0) * 127.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_8(v);
+		/*
+		 * We have 64 values and we need to map them to
+		 * subset of 256 values while making sure 0 -> 0
+		 * and 63 -> 255 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 63 and then multiply
+		 * it by output maximal value 255.
+		 */
+		fres = (v / 63.0) * 255.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_9(v);
+		/*
+		 * We have 64 values and we need to map them to
+		 * subset of 512 values while making sure 0 -> 0
+		 * and 63 -> 511 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 63 and then multiply
+		 * it by output maximal value 511.
+		 */
+		fres = (v / 63.0) * 511.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_10(v);
+		/*
+		 * We have 64 values and we need to map them to
+		 * subset of 1024 values while making sure 0 -> 0
+		 * and 63 -> 1023 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 63 and then multiply
+		 * it by output maximal value 1023.
+		 */
+		fres = (v / 63.0) * 1023.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_11(v);
+		/*
+		 * We have 64 values and we need to map them to
+		 * subset of 2048 values while making sure 0 -> 0
+		 * and 63 -> 2047 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 63 and then multiply
+		 * it by output maximal value 2047.
+		 */
+		fres = (v / 63.0) * 2047.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_12(v);
+		/*
+		 * We have 64 values and we need to map them to
+		 * subset of 4096 values while making sure 0 -> 0
+		 * and 63 -> 4095 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 63 and then multiply
+		 * it by output maximal value 4095.
+		 */
+		fres = (v / 63.0) * 4095.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_13(v);
+		/*
+		 * We have 64 values and we need to map them to
+		 * subset of 8192 values while making sure 0 -> 0
+		 * and 63 -> 8191 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 63 and then multiply
+		 * it by output maximal value 8191.
+		 */
+		fres = (v / 63.0) * 8191.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_14(v);
+		/*
+		 * We have 64 values and we need to map them to
+		 * subset of 16384 values while making sure 0 -> 0
+		 * and 63 -> 16383 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 63 and then multiply
+		 * it by output maximal value 16383.
+		 */
+		fres = (v / 63.0) * 16383.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_6_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 63; v++) {
+		res = GP_SCALE_VAL_6_15(v);
+		/*
+		 * We have 64 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 63 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 63 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 63.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_6_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_1(v);
+		/*
+		 * We have 128 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 127 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_2(v);
+		/*
+		 * We have 128 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 127 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_3(v);
+		/*
+		 * We have 128 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 127 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_4(v);
+		/*
+		 * We have 128 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 127 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_5(v);
+		/*
+		 * We have 128 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 127 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_6(v);
+		/*
+		 * We have 128 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 127 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_7(v);
+		/*
+		 * We have 128 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 127 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_8(v);
+		/*
+		 * We have 128 values and we need to map them to
+		 * subset of 256 values while making sure 0 -> 0
+		 * and 127 -> 255 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 127 and then multiply
+		 * it by output maximal value 255.
+		 */
+		fres = (v / 127.0) * 255.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_9(v);
+		/*
+		 * We have 128 values and we need to map them to
+		 * subset of 512 values while making sure 0 -> 0
+		 * and 127 -> 511 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 127 and then multiply
+		 * it by output maximal value 511.
+		 */
+		fres = (v / 127.0) * 511.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_10(v);
+		/*
+		 * We have 128 values and we need to map them to
+		 * subset of 1024 values while making sure 0 -> 0
+		 * and 127 -> 1023 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 127 and then multiply
+		 * it by output maximal value 1023.
+		 */
+		fres = (v / 127.0) * 1023.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_11(v);
+		/*
+		 * We have 128 values and we need to map them to
+		 * subset of 2048 values while making sure 0 -> 0
+		 * and 127 -> 2047 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 127 and then multiply
+		 * it by output maximal value 2047.
+		 */
+		fres = (v / 127.0) * 2047.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_12(v);
+		/*
+		 * We have 128 values and we need to map them to
+		 * subset of 4096 values while making sure 0 -> 0
+		 * and 127 -> 4095 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 127 and then multiply
+		 * it by output maximal value 4095.
+		 */
+		fres = (v / 127.0) * 4095.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_13(v);
+		/*
+		 * We have 128 values and we need to map them to
+		 * subset of 8192 values while making sure 0 -> 0
+		 * and 127 -> 8191 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 127 and then multiply
+		 * it by output maximal value 8191.
+		 */
+		fres = (v / 127.0) * 8191.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_14(v);
+		/*
+		 * We have 128 values and we need to map them to
+		 * subset of 16384 values while making sure 0 -> 0
+		 * and 127 -> 16383 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 127 and then multiply
+		 * it by output maximal value 16383.
+		 */
+		fres = (v / 127.0) * 16383.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_7_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 127; v++) {
+		res = GP_SCALE_VAL_7_15(v);
+		/*
+		 * We have 128 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 127 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 127 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 127.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_7_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_1(v);
+		/*
+		 * We have 256 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 255 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_2(v);
+		/*
+		 * We have 256 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 255 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_3(v);
+		/*
+		 * We have 256 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 255 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_4(v);
+		/*
+		 * We have 256 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 255 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_5(v);
+		/*
+		 * We have 256 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 255 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_6(v);
+		/*
+		 * We have 256 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 255 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_7(v);
+		/*
+		 * We have 256 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 255 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_8(v);
+		/*
+		 * We have 256 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 255 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_9(v);
+		/*
+		 * We have 256 values and we need to map them to
+		 * subset of 512 values while making sure 0 -> 0
+		 * and 255 -> 511 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 255 and then multiply
+		 * it by output maximal value 511.
+		 */
+		fres = (v / 255.0) * 511.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_10(v);
+		/*
+		 * We have 256 values and we need to map them to
+		 * subset of 1024 values while making sure 0 -> 0
+		 * and 255 -> 1023 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 255 and then multiply
+		 * it by output maximal value 1023.
+		 */
+		fres = (v / 255.0) * 1023.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_11(v);
+		/*
+		 * We have 256 values and we need to map them to
+		 * subset of 2048 values while making sure 0 -> 0
+		 * and 255 -> 2047 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 255 and then multiply
+		 * it by output maximal value 2047.
+		 */
+		fres = (v / 255.0) * 2047.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_12(v);
+		/*
+		 * We have 256 values and we need to map them to
+		 * subset of 4096 values while making sure 0 -> 0
+		 * and 255 -> 4095 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 255 and then multiply
+		 * it by output maximal value 4095.
+		 */
+		fres = (v / 255.0) * 4095.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_13(v);
+		/*
+		 * We have 256 values and we need to map them to
+		 * subset of 8192 values while making sure 0 -> 0
+		 * and 255 -> 8191 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 255 and then multiply
+		 * it by output maximal value 8191.
+		 */
+		fres = (v / 255.0) * 8191.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_14(v);
+		/*
+		 * We have 256 values and we need to map them to
+		 * subset of 16384 values while making sure 0 -> 0
+		 * and 255 -> 16383 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 255 and then multiply
+		 * it by output maximal value 16383.
+		 */
+		fres = (v / 255.0) * 16383.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_8_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 255; v++) {
+		res = GP_SCALE_VAL_8_15(v);
+		/*
+		 * We have 256 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 255 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 255 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 255.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_8_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_1(v);
+		/*
+		 * We have 512 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 511 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_2(v);
+		/*
+		 * We have 512 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 511 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_3(v);
+		/*
+		 * We have 512 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 511 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_4(v);
+		/*
+		 * We have 512 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 511 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_5(v);
+		/*
+		 * We have 512 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 511 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_6(v);
+		/*
+		 * We have 512 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 511 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_7(v);
+		/*
+		 * We have 512 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 511 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_8(v);
+		/*
+		 * We have 512 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 511 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_9(v);
+		/*
+		 * We have 512 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 511 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_10(v);
+		/*
+		 * We have 512 values and we need to map them to
+		 * subset of 1024 values while making sure 0 -> 0
+		 * and 511 -> 1023 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 511 and then multiply
+		 * it by output maximal value 1023.
+		 */
+		fres = (v / 511.0) * 1023.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_11(v);
+		/*
+		 * We have 512 values and we need to map them to
+		 * subset of 2048 values while making sure 0 -> 0
+		 * and 511 -> 2047 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 511 and then multiply
+		 * it by output maximal value 2047.
+		 */
+		fres = (v / 511.0) * 2047.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_12(v);
+		/*
+		 * We have 512 values and we need to map them to
+		 * subset of 4096 values while making sure 0 -> 0
+		 * and 511 -> 4095 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 511 and then multiply
+		 * it by output maximal value 4095.
+		 */
+		fres = (v / 511.0) * 4095.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_13(v);
+		/*
+		 * We have 512 values and we need to map them to
+		 * subset of 8192 values while making sure 0 -> 0
+		 * and 511 -> 8191 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 511 and then multiply
+		 * it by output maximal value 8191.
+		 */
+		fres = (v / 511.0) * 8191.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_14(v);
+		/*
+		 * We have 512 values and we need to map them to
+		 * subset of 16384 values while making sure 0 -> 0
+		 * and 511 -> 16383 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 511 and then multiply
+		 * it by output maximal value 16383.
+		 */
+		fres = (v / 511.0) * 16383.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_9_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 511; v++) {
+		res = GP_SCALE_VAL_9_15(v);
+		/*
+		 * We have 512 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 511 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 511 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 511.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_9_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_1(v);
+		/*
+		 * We have 1024 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1023 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_2(v);
+		/*
+		 * We have 1024 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1023 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_3(v);
+		/*
+		 * We have 1024 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1023 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_4(v);
+		/*
+		 * We have 1024 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1023 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_5(v);
+		/*
+		 * We have 1024 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1023 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_6(v);
+		/*
+		 * We have 1024 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1023 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_7(v);
+		/*
+		 * We have 1024 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1023 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_8(v);
+		/*
+		 * We have 1024 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1023 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_9(v);
+		/*
+		 * We have 1024 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1023 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_10(v);
+		/*
+		 * We have 1024 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1023 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_11(v);
+		/*
+		 * We have 1024 values and we need to map them to
+		 * subset of 2048 values while making sure 0 -> 0
+		 * and 1023 -> 2047 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1023 and then multiply
+		 * it by output maximal value 2047.
+		 */
+		fres = (v / 1023.0) * 2047.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_12(v);
+		/*
+		 * We have 1024 values and we need to map them to
+		 * subset of 4096 values while making sure 0 -> 0
+		 * and 1023 -> 4095 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1023 and then multiply
+		 * it by output maximal value 4095.
+		 */
+		fres = (v / 1023.0) * 4095.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_13(v);
+		/*
+		 * We have 1024 values and we need to map them to
+		 * subset of 8192 values while making sure 0 -> 0
+		 * and 1023 -> 8191 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1023 and then multiply
+		 * it by output maximal value 8191.
+		 */
+		fres = (v / 1023.0) * 8191.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_14(v);
+		/*
+		 * We have 1024 values and we need to map them to
+		 * subset of 16384 values while making sure 0 -> 0
+		 * and 1023 -> 16383 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1023 and then multiply
+		 * it by output maximal value 16383.
+		 */
+		fres = (v / 1023.0) * 16383.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_10_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1023; v++) {
+		res = GP_SCALE_VAL_10_15(v);
+		/*
+		 * We have 1024 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 1023 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 1023 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 1023.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_10_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_1(v);
+		/*
+		 * We have 2048 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2047 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0009765625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_2(v);
+		/*
+		 * We have 2048 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2047 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_3(v);
+		/*
+		 * We have 2048 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2047 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_4(v);
+		/*
+		 * We have 2048 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2047 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_5(v);
+		/*
+		 * We have 2048 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2047 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_6(v);
+		/*
+		 * We have 2048 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2047 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_7(v);
+		/*
+		 * We have 2048 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2047 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_8(v);
+		/*
+		 * We have 2048 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2047 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_9(v);
+		/*
+		 * We have 2048 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2047 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_10(v);
+		/*
+		 * We have 2048 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2047 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_11(v);
+		/*
+		 * We have 2048 values that must be mapped to 2048
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2047 -> 2047.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_12(v);
+		/*
+		 * We have 2048 values and we need to map them to
+		 * subset of 4096 values while making sure 0 -> 0
+		 * and 2047 -> 4095 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 2047 and then multiply
+		 * it by output maximal value 4095.
+		 */
+		fres = (v / 2047.0) * 4095.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_13(v);
+		/*
+		 * We have 2048 values and we need to map them to
+		 * subset of 8192 values while making sure 0 -> 0
+		 * and 2047 -> 8191 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 2047 and then multiply
+		 * it by output maximal value 8191.
+		 */
+		fres = (v / 2047.0) * 8191.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_14(v);
+		/*
+		 * We have 2048 values and we need to map them to
+		 * subset of 16384 values while making sure 0 -> 0
+		 * and 2047 -> 16383 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 2047 and then multiply
+		 * it by output maximal value 16383.
+		 */
+		fres = (v / 2047.0) * 16383.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_11_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2047; v++) {
+		res = GP_SCALE_VAL_11_15(v);
+		/*
+		 * We have 2048 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 2047 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 2047 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 2047.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_11_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_1(v);
+		/*
+		 * We have 4096 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4095 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00048828125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_2(v);
+		/*
+		 * We have 4096 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4095 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0009765625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_3(v);
+		/*
+		 * We have 4096 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4095 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_4(v);
+		/*
+		 * We have 4096 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4095 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_5(v);
+		/*
+		 * We have 4096 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4095 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_6(v);
+		/*
+		 * We have 4096 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4095 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_7(v);
+		/*
+		 * We have 4096 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4095 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_8(v);
+		/*
+		 * We have 4096 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4095 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_9(v);
+		/*
+		 * We have 4096 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4095 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_10(v);
+		/*
+		 * We have 4096 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4095 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_11(v);
+		/*
+		 * We have 4096 values that must be mapped to 2048
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4095 -> 2047.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_12(v);
+		/*
+		 * We have 4096 values that must be mapped to 4096
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4095 -> 4095.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_13(v);
+		/*
+		 * We have 4096 values and we need to map them to
+		 * subset of 8192 values while making sure 0 -> 0
+		 * and 4095 -> 8191 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 4095 and then multiply
+		 * it by output maximal value 8191.
+		 */
+		fres = (v / 4095.0) * 8191.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_14(v);
+		/*
+		 * We have 4096 values and we need to map them to
+		 * subset of 16384 values while making sure 0 -> 0
+		 * and 4095 -> 16383 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 4095 and then multiply
+		 * it by output maximal value 16383.
+		 */
+		fres = (v / 4095.0) * 16383.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_12_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4095; v++) {
+		res = GP_SCALE_VAL_12_15(v);
+		/*
+		 * We have 4096 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 4095 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 4095 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 4095.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_12_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_1(v);
+		/*
+		 * We have 8192 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8191 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.000244140625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_2(v);
+		/*
+		 * We have 8192 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8191 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00048828125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_3(v);
+		/*
+		 * We have 8192 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8191 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0009765625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_4(v);
+		/*
+		 * We have 8192 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8191 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_5(v);
+		/*
+		 * We have 8192 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8191 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_6(v);
+		/*
+		 * We have 8192 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8191 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_7(v);
+		/*
+		 * We have 8192 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8191 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_8(v);
+		/*
+		 * We have 8192 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8191 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_9(v);
+		/*
+		 * We have 8192 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8191 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_10(v);
+		/*
+		 * We have 8192 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8191 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_11(v);
+		/*
+		 * We have 8192 values that must be mapped to 2048
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8191 -> 2047.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_12(v);
+		/*
+		 * We have 8192 values that must be mapped to 4096
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8191 -> 4095.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_13(v);
+		/*
+		 * We have 8192 values that must be mapped to 8192
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8191 -> 8191.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_14(v);
+		/*
+		 * We have 8192 values and we need to map them to
+		 * subset of 16384 values while making sure 0 -> 0
+		 * and 8191 -> 16383 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 8191 and then multiply
+		 * it by output maximal value 16383.
+		 */
+		fres = (v / 8191.0) * 16383.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_13_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8191; v++) {
+		res = GP_SCALE_VAL_13_15(v);
+		/*
+		 * We have 8192 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 8191 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 8191 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 8191.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_13_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_1(v);
+		/*
+		 * We have 16384 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0001220703125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_2(v);
+		/*
+		 * We have 16384 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.000244140625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_3(v);
+		/*
+		 * We have 16384 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00048828125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_4(v);
+		/*
+		 * We have 16384 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0009765625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_5(v);
+		/*
+		 * We have 16384 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_6(v);
+		/*
+		 * We have 16384 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_7(v);
+		/*
+		 * We have 16384 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_8(v);
+		/*
+		 * We have 16384 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_9(v);
+		/*
+		 * We have 16384 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_10(v);
+		/*
+		 * We have 16384 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_11(v);
+		/*
+		 * We have 16384 values that must be mapped to 2048
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 2047.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_12(v);
+		/*
+		 * We have 16384 values that must be mapped to 4096
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 4095.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_13(v);
+		/*
+		 * We have 16384 values that must be mapped to 8192
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 8191.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_14(v);
+		/*
+		 * We have 16384 values that must be mapped to 16384
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 16383 -> 16383.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_14_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 16383; v++) {
+		res = GP_SCALE_VAL_14_15(v);
+		/*
+		 * We have 16384 values and we need to map them to
+		 * subset of 32768 values while making sure 0 -> 0
+		 * and 16383 -> 32767 and that the
+		 * mapping is as evenly distributed as possible.
+		 *
+		 * So we map the input to 0-1 interval by dividing it by
+		 * maximal input value 16383 and then multiply
+		 * it by output maximal value 32767.
+		 */
+		fres = (v / 16383.0) * 32767.0;
+		exp_res = round(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_14_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_1(v);
+		/*
+		 * We have 32768 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 6.103515625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_2(v);
+		/*
+		 * We have 32768 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0001220703125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_3(v);
+		/*
+		 * We have 32768 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.000244140625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_4(v);
+		/*
+		 * We have 32768 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00048828125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_5(v);
+		/*
+		 * We have 32768 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0009765625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_6(v);
+		/*
+		 * We have 32768 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_7(v);
+		/*
+		 * We have 32768 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_8(v);
+		/*
+		 * We have 32768 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_9(v);
+		/*
+		 * We have 32768 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_10(v);
+		/*
+		 * We have 32768 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_11(v);
+		/*
+		 * We have 32768 values that must be mapped to 2048
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 2047.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_12(v);
+		/*
+		 * We have 32768 values that must be mapped to 4096
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 4095.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_13(v);
+		/*
+		 * We have 32768 values that must be mapped to 8192
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 8191.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_14(v);
+		/*
+		 * We have 32768 values that must be mapped to 16384
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 16383.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_15_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 32767; v++) {
+		res = GP_SCALE_VAL_15_15(v);
+		/*
+		 * We have 32768 values that must be mapped to 32768
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 32767 -> 32767.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.0;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_15_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_1(v);
+		/*
+		 * We have 65536 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 3.0517578125e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_2(v);
+		/*
+		 * We have 65536 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 6.103515625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_3(v);
+		/*
+		 * We have 65536 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0001220703125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_4(v);
+		/*
+		 * We have 65536 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.000244140625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_5(v);
+		/*
+		 * We have 65536 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00048828125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_6(v);
+		/*
+		 * We have 65536 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0009765625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_7(v);
+		/*
+		 * We have 65536 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_8(v);
+		/*
+		 * We have 65536 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_9(v);
+		/*
+		 * We have 65536 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_10(v);
+		/*
+		 * We have 65536 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_11(v);
+		/*
+		 * We have 65536 values that must be mapped to 2048
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 2047.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_12(v);
+		/*
+		 * We have 65536 values that must be mapped to 4096
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 4095.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_13(v);
+		/*
+		 * We have 65536 values that must be mapped to 8192
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 8191.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_14(v);
+		/*
+		 * We have 65536 values that must be mapped to 16384
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 16383.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_16_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 65535; v++) {
+		res = GP_SCALE_VAL_16_15(v);
+		/*
+		 * We have 65536 values that must be mapped to 32768
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 65535 -> 32767.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.5;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_16_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_1(v);
+		/*
+		 * We have 131072 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.52587890625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_2(v);
+		/*
+		 * We have 131072 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 3.0517578125e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_3(v);
+		/*
+		 * We have 131072 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 6.103515625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_4(v);
+		/*
+		 * We have 131072 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0001220703125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_5(v);
+		/*
+		 * We have 131072 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.000244140625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_6(v);
+		/*
+		 * We have 131072 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00048828125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_7(v);
+		/*
+		 * We have 131072 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0009765625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_8(v);
+		/*
+		 * We have 131072 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_9(v);
+		/*
+		 * We have 131072 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_10(v);
+		/*
+		 * We have 131072 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_11(v);
+		/*
+		 * We have 131072 values that must be mapped to 2048
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 2047.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_12(v);
+		/*
+		 * We have 131072 values that must be mapped to 4096
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 4095.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_13(v);
+		/*
+		 * We have 131072 values that must be mapped to 8192
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 8191.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_14(v);
+		/*
+		 * We have 131072 values that must be mapped to 16384
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 16383.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_17_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 131071; v++) {
+		res = GP_SCALE_VAL_17_15(v);
+		/*
+		 * We have 131072 values that must be mapped to 32768
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 131071 -> 32767.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.25;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_17_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_1(v);
+		/*
+		 * We have 262144 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 7.62939453125e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_2(v);
+		/*
+		 * We have 262144 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.52587890625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_3(v);
+		/*
+		 * We have 262144 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 3.0517578125e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_4(v);
+		/*
+		 * We have 262144 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 6.103515625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_5(v);
+		/*
+		 * We have 262144 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0001220703125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_6(v);
+		/*
+		 * We have 262144 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.000244140625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_7(v);
+		/*
+		 * We have 262144 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00048828125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_8(v);
+		/*
+		 * We have 262144 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0009765625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_9(v);
+		/*
+		 * We have 262144 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_10(v);
+		/*
+		 * We have 262144 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_11(v);
+		/*
+		 * We have 262144 values that must be mapped to 2048
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 2047.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_12(v);
+		/*
+		 * We have 262144 values that must be mapped to 4096
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 4095.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_13(v);
+		/*
+		 * We have 262144 values that must be mapped to 8192
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 8191.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_14(v);
+		/*
+		 * We have 262144 values that must be mapped to 16384
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 16383.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_18_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 262143; v++) {
+		res = GP_SCALE_VAL_18_15(v);
+		/*
+		 * We have 262144 values that must be mapped to 32768
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 262143 -> 32767.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_18_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_1(v);
+		/*
+		 * We have 524288 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 3.814697265625e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_2(v);
+		/*
+		 * We have 524288 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 7.62939453125e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_3(v);
+		/*
+		 * We have 524288 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.52587890625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_4(v);
+		/*
+		 * We have 524288 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 3.0517578125e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_5(v);
+		/*
+		 * We have 524288 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 6.103515625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_6(v);
+		/*
+		 * We have 524288 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0001220703125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_7(v);
+		/*
+		 * We have 524288 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.000244140625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_8(v);
+		/*
+		 * We have 524288 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00048828125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_9(v);
+		/*
+		 * We have 524288 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0009765625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_10(v);
+		/*
+		 * We have 524288 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_11(v);
+		/*
+		 * We have 524288 values that must be mapped to 2048
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 2047.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_12(v);
+		/*
+		 * We have 524288 values that must be mapped to 4096
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 4095.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_13(v);
+		/*
+		 * We have 524288 values that must be mapped to 8192
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 8191.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_14(v);
+		/*
+		 * We have 524288 values that must be mapped to 16384
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 16383.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_19_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 524287; v++) {
+		res = GP_SCALE_VAL_19_15(v);
+		/*
+		 * We have 524288 values that must be mapped to 32768
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 524287 -> 32767.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_19_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_1(v);
+		/*
+		 * We have 1048576 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.9073486328125e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_2(v);
+		/*
+		 * We have 1048576 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 3.814697265625e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_3(v);
+		/*
+		 * We have 1048576 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 7.62939453125e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_4(v);
+		/*
+		 * We have 1048576 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.52587890625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_5(v);
+		/*
+		 * We have 1048576 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 3.0517578125e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_6(v);
+		/*
+		 * We have 1048576 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 6.103515625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_7(v);
+		/*
+		 * We have 1048576 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0001220703125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_8(v);
+		/*
+		 * We have 1048576 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.000244140625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_9(v);
+		/*
+		 * We have 1048576 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00048828125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_10(v);
+		/*
+		 * We have 1048576 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0009765625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_11(v);
+		/*
+		 * We have 1048576 values that must be mapped to 2048
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 2047.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_12(v);
+		/*
+		 * We have 1048576 values that must be mapped to 4096
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 4095.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_13(v);
+		/*
+		 * We have 1048576 values that must be mapped to 8192
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 8191.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_14(v);
+		/*
+		 * We have 1048576 values that must be mapped to 16384
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 16383.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_20_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 1048575; v++) {
+		res = GP_SCALE_VAL_20_15(v);
+		/*
+		 * We have 1048576 values that must be mapped to 32768
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 1048575 -> 32767.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.03125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_20_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_1(v);
+		/*
+		 * We have 2097152 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 9.5367431640625e-07;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_2(v);
+		/*
+		 * We have 2097152 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.9073486328125e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_3(v);
+		/*
+		 * We have 2097152 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 3.814697265625e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_4(v);
+		/*
+		 * We have 2097152 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 7.62939453125e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_5(v);
+		/*
+		 * We have 2097152 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.52587890625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_6(v);
+		/*
+		 * We have 2097152 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 3.0517578125e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_7(v);
+		/*
+		 * We have 2097152 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 6.103515625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_8(v);
+		/*
+		 * We have 2097152 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0001220703125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_9(v);
+		/*
+		 * We have 2097152 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.000244140625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_10(v);
+		/*
+		 * We have 2097152 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00048828125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_11(v);
+		/*
+		 * We have 2097152 values that must be mapped to 2048
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 2047.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0009765625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_12(v);
+		/*
+		 * We have 2097152 values that must be mapped to 4096
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 4095.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_13(v);
+		/*
+		 * We have 2097152 values that must be mapped to 8192
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 8191.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_14(v);
+		/*
+		 * We have 2097152 values that must be mapped to 16384
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 16383.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_21_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 2097151; v++) {
+		res = GP_SCALE_VAL_21_15(v);
+		/*
+		 * We have 2097152 values that must be mapped to 32768
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 2097151 -> 32767.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.015625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_21_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_1(v);
+		/*
+		 * We have 4194304 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 4.76837158203125e-07;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_2(v);
+		/*
+		 * We have 4194304 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 9.5367431640625e-07;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_3(v);
+		/*
+		 * We have 4194304 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.9073486328125e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_4(v);
+		/*
+		 * We have 4194304 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 3.814697265625e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_5(v);
+		/*
+		 * We have 4194304 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 7.62939453125e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_6(v);
+		/*
+		 * We have 4194304 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.52587890625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_7(v);
+		/*
+		 * We have 4194304 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 3.0517578125e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_8(v);
+		/*
+		 * We have 4194304 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 6.103515625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_9(v);
+		/*
+		 * We have 4194304 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0001220703125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_10(v);
+		/*
+		 * We have 4194304 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.000244140625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_11(v);
+		/*
+		 * We have 4194304 values that must be mapped to 2048
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 2047.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00048828125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_12(v);
+		/*
+		 * We have 4194304 values that must be mapped to 4096
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 4095.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0009765625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_13(v);
+		/*
+		 * We have 4194304 values that must be mapped to 8192
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 8191.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_14(v);
+		/*
+		 * We have 4194304 values that must be mapped to 16384
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 16383.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_22_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 4194303; v++) {
+		res = GP_SCALE_VAL_22_15(v);
+		/*
+		 * We have 4194304 values that must be mapped to 32768
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 4194303 -> 32767.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0078125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_22_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_1(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_1(v);
+		/*
+		 * We have 8388608 values that must be mapped to 2
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 1.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 2.384185791015625e-07;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_1(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_2(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_2(v);
+		/*
+		 * We have 8388608 values that must be mapped to 4
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 3.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 4.76837158203125e-07;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_2(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_3(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_3(v);
+		/*
+		 * We have 8388608 values that must be mapped to 8
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 7.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 9.5367431640625e-07;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_3(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_4(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_4(v);
+		/*
+		 * We have 8388608 values that must be mapped to 16
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 15.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.9073486328125e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_4(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_5(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_5(v);
+		/*
+		 * We have 8388608 values that must be mapped to 32
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 31.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 3.814697265625e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_5(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_6(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_6(v);
+		/*
+		 * We have 8388608 values that must be mapped to 64
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 63.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 7.62939453125e-06;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_6(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_7(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_7(v);
+		/*
+		 * We have 8388608 values that must be mapped to 128
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 127.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 1.52587890625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_7(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_8(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_8(v);
+		/*
+		 * We have 8388608 values that must be mapped to 256
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 255.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 3.0517578125e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_8(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_9(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_9(v);
+		/*
+		 * We have 8388608 values that must be mapped to 512
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 511.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 6.103515625e-05;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_9(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_10(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_10(v);
+		/*
+		 * We have 8388608 values that must be mapped to 1024
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 1023.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0001220703125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_10(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_11(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_11(v);
+		/*
+		 * We have 8388608 values that must be mapped to 2048
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 2047.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.000244140625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_11(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_12(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_12(v);
+		/*
+		 * We have 8388608 values that must be mapped to 4096
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 4095.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00048828125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_12(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_13(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_13(v);
+		/*
+		 * We have 8388608 values that must be mapped to 8192
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 8191.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.0009765625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_13(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_14(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_14(v);
+		/*
+		 * We have 8388608 values that must be mapped to 16384
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 16383.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.001953125;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_14(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int check_convert_23_15(void)
+{
+	unsigned int v, fail = 0;
+	uint32_t res, exp_res;
+	float fres;
+
+	for (v = 0; v < 8388607; v++) {
+		res = GP_SCALE_VAL_23_15(v);
+		/*
+		 * We have 8388608 values that must be mapped to 32768
+		 * so we do simple division and floor() which maps the values
+		 * evenly, 0 -> 0 and 8388607 -> 32767.
+		 *
+		 * In terms for implementation this is just bitshift.
+		 */
+		fres = v * 0.00390625;
+		exp_res = floor(fres);
+
+		if (res != exp_res) {
+			if (fail < 5)
+				tst_msg("GP_SCALE_23_15(%i) = %i, "
+				        "expected %i %f", v, res, exp_res, fres);
+			fail++;
+		}
+	}
+
+	if (fail) {
+		if (fail > 5)
+			tst_msg("+ next %u failures", fail - 5);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Convert Scale Testsuite",
+	.tests = {
+		{.name = "SCALE_1_1()",
+		 .tst_fn = check_convert_1_1},
+		{.name = "SCALE_1_2()",
+		 .tst_fn = check_convert_1_2},
+		{.name = "SCALE_1_3()",
+		 .tst_fn = check_convert_1_3},
+		{.name = "SCALE_1_4()",
+		 .tst_fn = check_convert_1_4},
+		{.name = "SCALE_1_5()",
+		 .tst_fn = check_convert_1_5},
+		{.name = "SCALE_1_6()",
+		 .tst_fn = check_convert_1_6},
+		{.name = "SCALE_1_7()",
+		 .tst_fn = check_convert_1_7},
+		{.name = "SCALE_1_8()",
+		 .tst_fn = check_convert_1_8},
+		{.name = "SCALE_1_9()",
+		 .tst_fn = check_convert_1_9},
+		{.name = "SCALE_1_10()",
+		 .tst_fn = check_convert_1_10},
+		{.name = "SCALE_1_11()",
+		 .tst_fn = check_convert_1_11},
+		{.name = "SCALE_1_12()",
+		 .tst_fn = check_convert_1_12},
+		{.name = "SCALE_1_13()",
+		 .tst_fn = check_convert_1_13},
+		{.name = "SCALE_1_14()",
+		 .tst_fn = check_convert_1_14},
+		{.name = "SCALE_1_15()",
+		 .tst_fn = check_convert_1_15},
+		{.name = "SCALE_2_1()",
+		 .tst_fn = check_convert_2_1},
+		{.name = "SCALE_2_2()",
+		 .tst_fn = check_convert_2_2},
+		{.name = "SCALE_2_3()",
+		 .tst_fn = check_convert_2_3},
+		{.name = "SCALE_2_4()",
+		 .tst_fn = check_convert_2_4},
+		{.name = "SCALE_2_5()",
+		 .tst_fn = check_convert_2_5},
+		{.name = "SCALE_2_6()",
+		 .tst_fn = check_convert_2_6},
+		{.name = "SCALE_2_7()",
+		 .tst_fn = check_convert_2_7},
+		{.name = "SCALE_2_8()",
+		 .tst_fn = check_convert_2_8},
+		{.name = "SCALE_2_9()",
+		 .tst_fn = check_convert_2_9},
+		{.name = "SCALE_2_10()",
+		 .tst_fn = check_convert_2_10},
+		{.name = "SCALE_2_11()",
+		 .tst_fn = check_convert_2_11},
+		{.name = "SCALE_2_12()",
+		 .tst_fn = check_convert_2_12},
+		{.name = "SCALE_2_13()",
+		 .tst_fn = check_convert_2_13},
+		{.name = "SCALE_2_14()",
+		 .tst_fn = check_convert_2_14},
+		{.name = "SCALE_2_15()",
+		 .tst_fn = check_convert_2_15},
+		{.name = "SCALE_3_1()",
+		 .tst_fn = check_convert_3_1},
+		{.name = "SCALE_3_2()",
+		 .tst_fn = check_convert_3_2},
+		{.name = "SCALE_3_3()",
+		 .tst_fn = check_convert_3_3},
+		{.name = "SCALE_3_4()",
+		 .tst_fn = check_convert_3_4},
+		{.name = "SCALE_3_5()",
+		 .tst_fn = check_convert_3_5},
+		{.name = "SCALE_3_6()",
+		 .tst_fn = check_convert_3_6},
+		{.name = "SCALE_3_7()",
+		 .tst_fn = check_convert_3_7},
+		{.name = "SCALE_3_8()",
+		 .tst_fn = check_convert_3_8},
+		{.name = "SCALE_3_9()",
+		 .tst_fn = check_convert_3_9},
+		{.name = "SCALE_3_10()",
+		 .tst_fn = check_convert_3_10},
+		{.name = "SCALE_3_11()",
+		 .tst_fn = check_convert_3_11},
+		{.name = "SCALE_3_12()",
+		 .tst_fn = check_convert_3_12},
+		{.name = "SCALE_3_13()",
+		 .tst_fn = check_convert_3_13},
+		{.name = "SCALE_3_14()",
+		 .tst_fn = check_convert_3_14},
+		{.name = "SCALE_3_15()",
+		 .tst_fn = check_convert_3_15},
+		{.name = "SCALE_4_1()",
+		 .tst_fn = check_convert_4_1},
+		{.name = "SCALE_4_2()",
+		 .tst_fn = check_convert_4_2},
+		{.name = "SCALE_4_3()",
+		 .tst_fn = check_convert_4_3},
+		{.name = "SCALE_4_4()",
+		 .tst_fn = check_convert_4_4},
+		{.name = "SCALE_4_5()",
+		 .tst_fn = check_convert_4_5},
+		{.name = "SCALE_4_6()",
+		 .tst_fn = check_convert_4_6},
+		{.name = "SCALE_4_7()",
+		 .tst_fn = check_convert_4_7},
+		{.name = "SCALE_4_8()",
+		 .tst_fn = check_convert_4_8},
+		{.name = "SCALE_4_9()",
+		 .tst_fn = check_convert_4_9},
+		{.name = "SCALE_4_10()",
+		 .tst_fn = check_convert_4_10},
+		{.name = "SCALE_4_11()",
+		 .tst_fn = check_convert_4_11},
+		{.name = "SCALE_4_12()",
+		 .tst_fn = check_convert_4_12},
+		{.name = "SCALE_4_13()",
+		 .tst_fn = check_convert_4_13},
+		{.name = "SCALE_4_14()",
+		 .tst_fn = check_convert_4_14},
+		{.name = "SCALE_4_15()",
+		 .tst_fn = check_convert_4_15},
+		{.name = "SCALE_5_1()",
+		 .tst_fn = check_convert_5_1},
+		{.name = "SCALE_5_2()",
+		 .tst_fn = check_convert_5_2},
+		{.name = "SCALE_5_3()",
+		 .tst_fn = check_convert_5_3},
+		{.name = "SCALE_5_4()",
+		 .tst_fn = check_convert_5_4},
+		{.name = "SCALE_5_5()",
+		 .tst_fn = check_convert_5_5},
+		{.name = "SCALE_5_6()",
+		 .tst_fn = check_convert_5_6},
+		{.name = "SCALE_5_7()",
+		 .tst_fn = check_convert_5_7},
+		{.name = "SCALE_5_8()",
+		 .tst_fn = check_convert_5_8},
+		{.name = "SCALE_5_9()",
+		 .tst_fn = check_convert_5_9},
+		{.name = "SCALE_5_10()",
+		 .tst_fn = check_convert_5_10},
+		{.name = "SCALE_5_11()",
+		 .tst_fn = check_convert_5_11},
+		{.name = "SCALE_5_12()",
+		 .tst_fn = check_convert_5_12},
+		{.name = "SCALE_5_13()",
+		 .tst_fn = check_convert_5_13},
+		{.name = "SCALE_5_14()",
+		 .tst_fn = check_convert_5_14},
+		{.name = "SCALE_5_15()",
+		 .tst_fn = check_convert_5_15},
+		{.name = "SCALE_6_1()",
+		 .tst_fn = check_convert_6_1},
+		{.name = "SCALE_6_2()",
+		 .tst_fn = check_convert_6_2},
+		{.name = "SCALE_6_3()",
+		 .tst_fn = check_convert_6_3},
+		{.name = "SCALE_6_4()",
+		 .tst_fn = check_convert_6_4},
+		{.name = "SCALE_6_5()",
+		 .tst_fn = check_convert_6_5},
+		{.name = "SCALE_6_6()",
+		 .tst_fn = check_convert_6_6},
+		{.name = "SCALE_6_7()",
+		 .tst_fn = check_convert_6_7},
+		{.name = "SCALE_6_8()",
+		 .tst_fn = check_convert_6_8},
+		{.name = "SCALE_6_9()",
+		 .tst_fn = check_convert_6_9},
+		{.name = "SCALE_6_10()",
+		 .tst_fn = check_convert_6_10},
+		{.name = "SCALE_6_11()",
+		 .tst_fn = check_convert_6_11},
+		{.name = "SCALE_6_12()",
+		 .tst_fn = check_convert_6_12},
+		{.name = "SCALE_6_13()",
+		 .tst_fn = check_convert_6_13},
+		{.name = "SCALE_6_14()",
+		 .tst_fn = check_convert_6_14},
+		{.name = "SCALE_6_15()",
+		 .tst_fn = check_convert_6_15},
+		{.name = "SCALE_7_1()",
+		 .tst_fn = check_convert_7_1},
+		{.name = "SCALE_7_2()",
+		 .tst_fn = check_convert_7_2},
+		{.name = "SCALE_7_3()",
+		 .tst_fn = check_convert_7_3},
+		{.name = "SCALE_7_4()",
+		 .tst_fn = check_convert_7_4},
+		{.name = "SCALE_7_5()",
+		 .tst_fn = check_convert_7_5},
+		{.name = "SCALE_7_6()",
+		 .tst_fn = check_convert_7_6},
+		{.name = "SCALE_7_7()",
+		 .tst_fn = check_convert_7_7},
+		{.name = "SCALE_7_8()",
+		 .tst_fn = check_convert_7_8},
+		{.name = "SCALE_7_9()",
+		 .tst_fn = check_convert_7_9},
+		{.name = "SCALE_7_10()",
+		 .tst_fn = check_convert_7_10},
+		{.name = "SCALE_7_11()",
+		 .tst_fn = check_convert_7_11},
+		{.name = "SCALE_7_12()",
+		 .tst_fn = check_convert_7_12},
+		{.name = "SCALE_7_13()",
+		 .tst_fn = check_convert_7_13},
+		{.name = "SCALE_7_14()",
+		 .tst_fn = check_convert_7_14},
+		{.name = "SCALE_7_15()",
+		 .tst_fn = check_convert_7_15},
+		{.name = "SCALE_8_1()",
+		 .tst_fn = check_convert_8_1},
+		{.name = "SCALE_8_2()",
+		 .tst_fn = check_convert_8_2},
+		{.name = "SCALE_8_3()",
+		 .tst_fn = check_convert_8_3},
+		{.name = "SCALE_8_4()",
+		 .tst_fn = check_convert_8_4},
+		{.name = "SCALE_8_5()",
+		 .tst_fn = check_convert_8_5},
+		{.name = "SCALE_8_6()",
+		 .tst_fn = check_convert_8_6},
+		{.name = "SCALE_8_7()",
+		 .tst_fn = check_convert_8_7},
+		{.name = "SCALE_8_8()",
+		 .tst_fn = check_convert_8_8},
+		{.name = "SCALE_8_9()",
+		 .tst_fn = check_convert_8_9},
+		{.name = "SCALE_8_10()",
+		 .tst_fn = check_convert_8_10},
+		{.name = "SCALE_8_11()",
+		 .tst_fn = check_convert_8_11},
+		{.name = "SCALE_8_12()",
+		 .tst_fn = check_convert_8_12},
+		{.name = "SCALE_8_13()",
+		 .tst_fn = check_convert_8_13},
+		{.name = "SCALE_8_14()",
+		 .tst_fn = check_convert_8_14},
+		{.name = "SCALE_8_15()",
+		 .tst_fn = check_convert_8_15},
+		{.name = "SCALE_9_1()",
+		 .tst_fn = check_convert_9_1},
+		{.name = "SCALE_9_2()",
+		 .tst_fn = check_convert_9_2},
+		{.name = "SCALE_9_3()",
+		 .tst_fn = check_convert_9_3},
+		{.name = "SCALE_9_4()",
+		 .tst_fn = check_convert_9_4},
+		{.name = "SCALE_9_5()",
+		 .tst_fn = check_convert_9_5},
+		{.name = "SCALE_9_6()",
+		 .tst_fn = check_convert_9_6},
+		{.name = "SCALE_9_7()",
+		 .tst_fn = check_convert_9_7},
+		{.name = "SCALE_9_8()",
+		 .tst_fn = check_convert_9_8},
+		{.name = "SCALE_9_9()",
+		 .tst_fn = check_convert_9_9},
+		{.name = "SCALE_9_10()",
+		 .tst_fn = check_convert_9_10},
+		{.name = "SCALE_9_11()",
+		 .tst_fn = check_convert_9_11},
+		{.name = "SCALE_9_12()",
+		 .tst_fn = check_convert_9_12},
+		{.name = "SCALE_9_13()",
+		 .tst_fn = check_convert_9_13},
+		{.name = "SCALE_9_14()",
+		 .tst_fn = check_convert_9_14},
+		{.name = "SCALE_9_15()",
+		 .tst_fn = check_convert_9_15},
+		{.name = "SCALE_10_1()",
+		 .tst_fn = check_convert_10_1},
+		{.name = "SCALE_10_2()",
+		 .tst_fn = check_convert_10_2},
+		{.name = "SCALE_10_3()",
+		 .tst_fn = check_convert_10_3},
+		{.name = "SCALE_10_4()",
+		 .tst_fn = check_convert_10_4},
+		{.name = "SCALE_10_5()",
+		 .tst_fn = check_convert_10_5},
+		{.name = "SCALE_10_6()",
+		 .tst_fn = check_convert_10_6},
+		{.name = "SCALE_10_7()",
+		 .tst_fn = check_convert_10_7},
+		{.name = "SCALE_10_8()",
+		 .tst_fn = check_convert_10_8},
+		{.name = "SCALE_10_9()",
+		 .tst_fn = check_convert_10_9},
+		{.name = "SCALE_10_10()",
+		 .tst_fn = check_convert_10_10},
+		{.name = "SCALE_10_11()",
+		 .tst_fn = check_convert_10_11},
+		{.name = "SCALE_10_12()",
+		 .tst_fn = check_convert_10_12},
+		{.name = "SCALE_10_13()",
+		 .tst_fn = check_convert_10_13},
+		{.name = "SCALE_10_14()",
+		 .tst_fn = check_convert_10_14},
+		{.name = "SCALE_10_15()",
+		 .tst_fn = check_convert_10_15},
+		{.name = "SCALE_11_1()",
+		 .tst_fn = check_convert_11_1},
+		{.name = "SCALE_11_2()",
+		 .tst_fn = check_convert_11_2},
+		{.name = "SCALE_11_3()",
+		 .tst_fn = check_convert_11_3},
+		{.name = "SCALE_11_4()",
+		 .tst_fn = check_convert_11_4},
+		{.name = "SCALE_11_5()",
+		 .tst_fn = check_convert_11_5},
+		{.name = "SCALE_11_6()",
+		 .tst_fn = check_convert_11_6},
+		{.name = "SCALE_11_7()",
+		 .tst_fn = check_convert_11_7},
+		{.name = "SCALE_11_8()",
+		 .tst_fn = check_convert_11_8},
+		{.name = "SCALE_11_9()",
+		 .tst_fn = check_convert_11_9},
+		{.name = "SCALE_11_10()",
+		 .tst_fn = check_convert_11_10},
+		{.name = "SCALE_11_11()",
+		 .tst_fn = check_convert_11_11},
+		{.name = "SCALE_11_12()",
+		 .tst_fn = check_convert_11_12},
+		{.name = "SCALE_11_13()",
+		 .tst_fn = check_convert_11_13},
+		{.name = "SCALE_11_14()",
+		 .tst_fn = check_convert_11_14},
+		{.name = "SCALE_11_15()",
+		 .tst_fn = check_convert_11_15},
+		{.name = "SCALE_12_1()",
+		 .tst_fn = check_convert_12_1},
+		{.name = "SCALE_12_2()",
+		 .tst_fn = check_convert_12_2},
+		{.name = "SCALE_12_3()",
+		 .tst_fn = check_convert_12_3},
+		{.name = "SCALE_12_4()",
+		 .tst_fn = check_convert_12_4},
+		{.name = "SCALE_12_5()",
+		 .tst_fn = check_convert_12_5},
+		{.name = "SCALE_12_6()",
+		 .tst_fn = check_convert_12_6},
+		{.name = "SCALE_12_7()",
+		 .tst_fn = check_convert_12_7},
+		{.name = "SCALE_12_8()",
+		 .tst_fn = check_convert_12_8},
+		{.name = "SCALE_12_9()",
+		 .tst_fn = check_convert_12_9},
+		{.name = "SCALE_12_10()",
+		 .tst_fn = check_convert_12_10},
+		{.name = "SCALE_12_11()",
+		 .tst_fn = check_convert_12_11},
+		{.name = "SCALE_12_12()",
+		 .tst_fn = check_convert_12_12},
+		{.name = "SCALE_12_13()",
+		 .tst_fn = check_convert_12_13},
+		{.name = "SCALE_12_14()",
+		 .tst_fn = check_convert_12_14},
+		{.name = "SCALE_12_15()",
+		 .tst_fn = check_convert_12_15},
+		{.name = "SCALE_13_1()",
+		 .tst_fn = check_convert_13_1},
+		{.name = "SCALE_13_2()",
+		 .tst_fn = check_convert_13_2},
+		{.name = "SCALE_13_3()",
+		 .tst_fn = check_convert_13_3},
+		{.name = "SCALE_13_4()",
+		 .tst_fn = check_convert_13_4},
+		{.name = "SCALE_13_5()",
+		 .tst_fn = check_convert_13_5},
+		{.name = "SCALE_13_6()",
+		 .tst_fn = check_convert_13_6},
+		{.name = "SCALE_13_7()",
+		 .tst_fn = check_convert_13_7},
+		{.name = "SCALE_13_8()",
+		 .tst_fn = check_convert_13_8},
+		{.name = "SCALE_13_9()",
+		 .tst_fn = check_convert_13_9},
+		{.name = "SCALE_13_10()",
+		 .tst_fn = check_convert_13_10},
+		{.name = "SCALE_13_11()",
+		 .tst_fn = check_convert_13_11},
+		{.name = "SCALE_13_12()",
+		 .tst_fn = check_convert_13_12},
+		{.name = "SCALE_13_13()",
+		 .tst_fn = check_convert_13_13},
+		{.name = "SCALE_13_14()",
+		 .tst_fn = check_convert_13_14},
+		{.name = "SCALE_13_15()",
+		 .tst_fn = check_convert_13_15},
+		{.name = "SCALE_14_1()",
+		 .tst_fn = check_convert_14_1},
+		{.name = "SCALE_14_2()",
+		 .tst_fn = check_convert_14_2},
+		{.name = "SCALE_14_3()",
+		 .tst_fn = check_convert_14_3},
+		{.name = "SCALE_14_4()",
+		 .tst_fn = check_convert_14_4},
+		{.name = "SCALE_14_5()",
+		 .tst_fn = check_convert_14_5},
+		{.name = "SCALE_14_6()",
+		 .tst_fn = check_convert_14_6},
+		{.name = "SCALE_14_7()",
+		 .tst_fn = check_convert_14_7},
+		{.name = "SCALE_14_8()",
+		 .tst_fn = check_convert_14_8},
+		{.name = "SCALE_14_9()",
+		 .tst_fn = check_convert_14_9},
+		{.name = "SCALE_14_10()",
+		 .tst_fn = check_convert_14_10},
+		{.name = "SCALE_14_11()",
+		 .tst_fn = check_convert_14_11},
+		{.name = "SCALE_14_12()",
+		 .tst_fn = check_convert_14_12},
+		{.name = "SCALE_14_13()",
+		 .tst_fn = check_convert_14_13},
+		{.name = "SCALE_14_14()",
+		 .tst_fn = check_convert_14_14},
+		{.name = "SCALE_14_15()",
+		 .tst_fn = check_convert_14_15},
+		{.name = "SCALE_15_1()",
+		 .tst_fn = check_convert_15_1},
+		{.name = "SCALE_15_2()",
+		 .tst_fn = check_convert_15_2},
+		{.name = "SCALE_15_3()",
+		 .tst_fn = check_convert_15_3},
+		{.name = "SCALE_15_4()",
+		 .tst_fn = check_convert_15_4},
+		{.name = "SCALE_15_5()",
+		 .tst_fn = check_convert_15_5},
+		{.name = "SCALE_15_6()",
+		 .tst_fn = check_convert_15_6},
+		{.name = "SCALE_15_7()",
+		 .tst_fn = check_convert_15_7},
+		{.name = "SCALE_15_8()",
+		 .tst_fn = check_convert_15_8},
+		{.name = "SCALE_15_9()",
+		 .tst_fn = check_convert_15_9},
+		{.name = "SCALE_15_10()",
+		 .tst_fn = check_convert_15_10},
+		{.name = "SCALE_15_11()",
+		 .tst_fn = check_convert_15_11},
+		{.name = "SCALE_15_12()",
+		 .tst_fn = check_convert_15_12},
+		{.name = "SCALE_15_13()",
+		 .tst_fn = check_convert_15_13},
+		{.name = "SCALE_15_14()",
+		 .tst_fn = check_convert_15_14},
+		{.name = "SCALE_15_15()",
+		 .tst_fn = check_convert_15_15},
+		{.name = "SCALE_16_1()",
+		 .tst_fn = check_convert_16_1},
+		{.name = "SCALE_16_2()",
+		 .tst_fn = check_convert_16_2},
+		{.name = "SCALE_16_3()",
+		 .tst_fn = check_convert_16_3},
+		{.name = "SCALE_16_4()",
+		 .tst_fn = check_convert_16_4},
+		{.name = "SCALE_16_5()",
+		 .tst_fn = check_convert_16_5},
+		{.name = "SCALE_16_6()",
+		 .tst_fn = check_convert_16_6},
+		{.name = "SCALE_16_7()",
+		 .tst_fn = check_convert_16_7},
+		{.name = "SCALE_16_8()",
+		 .tst_fn = check_convert_16_8},
+		{.name = "SCALE_16_9()",
+		 .tst_fn = check_convert_16_9},
+		{.name = "SCALE_16_10()",
+		 .tst_fn = check_convert_16_10},
+		{.name = "SCALE_16_11()",
+		 .tst_fn = check_convert_16_11},
+		{.name = "SCALE_16_12()",
+		 .tst_fn = check_convert_16_12},
+		{.name = "SCALE_16_13()",
+		 .tst_fn = check_convert_16_13},
+		{.name = "SCALE_16_14()",
+		 .tst_fn = check_convert_16_14},
+		{.name = "SCALE_16_15()",
+		 .tst_fn = check_convert_16_15},
+		{.name = "SCALE_17_1()",
+		 .tst_fn = check_convert_17_1},
+		{.name = "SCALE_17_2()",
+		 .tst_fn = check_convert_17_2},
+		{.name = "SCALE_17_3()",
+		 .tst_fn = check_convert_17_3},
+		{.name = "SCALE_17_4()",
+		 .tst_fn = check_convert_17_4},
+		{.name = "SCALE_17_5()",
+		 .tst_fn = check_convert_17_5},
+		{.name = "SCALE_17_6()",
+		 .tst_fn = check_convert_17_6},
+		{.name = "SCALE_17_7()",
+		 .tst_fn = check_convert_17_7},
+		{.name = "SCALE_17_8()",
+		 .tst_fn = check_convert_17_8},
+		{.name = "SCALE_17_9()",
+		 .tst_fn = check_convert_17_9},
+		{.name = "SCALE_17_10()",
+		 .tst_fn = check_convert_17_10},
+		{.name = "SCALE_17_11()",
+		 .tst_fn = check_convert_17_11},
+		{.name = "SCALE_17_12()",
+		 .tst_fn = check_convert_17_12},
+		{.name = "SCALE_17_13()",
+		 .tst_fn = check_convert_17_13},
+		{.name = "SCALE_17_14()",
+		 .tst_fn = check_convert_17_14},
+		{.name = "SCALE_17_15()",
+		 .tst_fn = check_convert_17_15},
+		{.name = "SCALE_18_1()",
+		 .tst_fn = check_convert_18_1},
+		{.name = "SCALE_18_2()",
+		 .tst_fn = check_convert_18_2},
+		{.name = "SCALE_18_3()",
+		 .tst_fn = check_convert_18_3},
+		{.name = "SCALE_18_4()",
+		 .tst_fn = check_convert_18_4},
+		{.name = "SCALE_18_5()",
+		 .tst_fn = check_convert_18_5},
+		{.name = "SCALE_18_6()",
+		 .tst_fn = check_convert_18_6},
+		{.name = "SCALE_18_7()",
+		 .tst_fn = check_convert_18_7},
+		{.name = "SCALE_18_8()",
+		 .tst_fn = check_convert_18_8},
+		{.name = "SCALE_18_9()",
+		 .tst_fn = check_convert_18_9},
+		{.name = "SCALE_18_10()",
+		 .tst_fn = check_convert_18_10},
+		{.name = "SCALE_18_11()",
+		 .tst_fn = check_convert_18_11},
+		{.name = "SCALE_18_12()",
+		 .tst_fn = check_convert_18_12},
+		{.name = "SCALE_18_13()",
+		 .tst_fn = check_convert_18_13},
+		{.name = "SCALE_18_14()",
+		 .tst_fn = check_convert_18_14},
+		{.name = "SCALE_18_15()",
+		 .tst_fn = check_convert_18_15},
+		{.name = "SCALE_19_1()",
+		 .tst_fn = check_convert_19_1},
+		{.name = "SCALE_19_2()",
+		 .tst_fn = check_convert_19_2},
+		{.name = "SCALE_19_3()",
+		 .tst_fn = check_convert_19_3},
+		{.name = "SCALE_19_4()",
+		 .tst_fn = check_convert_19_4},
+		{.name = "SCALE_19_5()",
+		 .tst_fn = check_convert_19_5},
+		{.name = "SCALE_19_6()",
+		 .tst_fn = check_convert_19_6},
+		{.name = "SCALE_19_7()",
+		 .tst_fn = check_convert_19_7},
+		{.name = "SCALE_19_8()",
+		 .tst_fn = check_convert_19_8},
+		{.name = "SCALE_19_9()",
+		 .tst_fn = check_convert_19_9},
+		{.name = "SCALE_19_10()",
+		 .tst_fn = check_convert_19_10},
+		{.name = "SCALE_19_11()",
+		 .tst_fn = check_convert_19_11},
+		{.name = "SCALE_19_12()",
+		 .tst_fn = check_convert_19_12},
+		{.name = "SCALE_19_13()",
+		 .tst_fn = check_convert_19_13},
+		{.name = "SCALE_19_14()",
+		 .tst_fn = check_convert_19_14},
+		{.name = "SCALE_19_15()",
+		 .tst_fn = check_convert_19_15},
+		{.name = "SCALE_20_1()",
+		 .tst_fn = check_convert_20_1},
+		{.name = "SCALE_20_2()",
+		 .tst_fn = check_convert_20_2},
+		{.name = "SCALE_20_3()",
+		 .tst_fn = check_convert_20_3},
+		{.name = "SCALE_20_4()",
+		 .tst_fn = check_convert_20_4},
+		{.name = "SCALE_20_5()",
+		 .tst_fn = check_convert_20_5},
+		{.name = "SCALE_20_6()",
+		 .tst_fn = check_convert_20_6},
+		{.name = "SCALE_20_7()",
+		 .tst_fn = check_convert_20_7},
+		{.name = "SCALE_20_8()",
+		 .tst_fn = check_convert_20_8},
+		{.name = "SCALE_20_9()",
+		 .tst_fn = check_convert_20_9},
+		{.name = "SCALE_20_10()",
+		 .tst_fn = check_convert_20_10},
+		{.name = "SCALE_20_11()",
+		 .tst_fn = check_convert_20_11},
+		{.name = "SCALE_20_12()",
+		 .tst_fn = check_convert_20_12},
+		{.name = "SCALE_20_13()",
+		 .tst_fn = check_convert_20_13},
+		{.name = "SCALE_20_14()",
+		 .tst_fn = check_convert_20_14},
+		{.name = "SCALE_20_15()",
+		 .tst_fn = check_convert_20_15},
+		{.name = "SCALE_21_1()",
+		 .tst_fn = check_convert_21_1},
+		{.name = "SCALE_21_2()",
+		 .tst_fn = check_convert_21_2},
+		{.name = "SCALE_21_3()",
+		 .tst_fn = check_convert_21_3},
+		{.name = "SCALE_21_4()",
+		 .tst_fn = check_convert_21_4},
+		{.name = "SCALE_21_5()",
+		 .tst_fn = check_convert_21_5},
+		{.name = "SCALE_21_6()",
+		 .tst_fn = check_convert_21_6},
+		{.name = "SCALE_21_7()",
+		 .tst_fn = check_convert_21_7},
+		{.name = "SCALE_21_8()",
+		 .tst_fn = check_convert_21_8},
+		{.name = "SCALE_21_9()",
+		 .tst_fn = check_convert_21_9},
+		{.name = "SCALE_21_10()",
+		 .tst_fn = check_convert_21_10},
+		{.name = "SCALE_21_11()",
+		 .tst_fn = check_convert_21_11},
+		{.name = "SCALE_21_12()",
+		 .tst_fn = check_convert_21_12},
+		{.name = "SCALE_21_13()",
+		 .tst_fn = check_convert_21_13},
+		{.name = "SCALE_21_14()",
+		 .tst_fn = check_convert_21_14},
+		{.name = "SCALE_21_15()",
+		 .tst_fn = check_convert_21_15},
+		{.name = "SCALE_22_1()",
+		 .tst_fn = check_convert_22_1},
+		{.name = "SCALE_22_2()",
+		 .tst_fn = check_convert_22_2},
+		{.name = "SCALE_22_3()",
+		 .tst_fn = check_convert_22_3},
+		{.name = "SCALE_22_4()",
+		 .tst_fn = check_convert_22_4},
+		{.name = "SCALE_22_5()",
+		 .tst_fn = check_convert_22_5},
+		{.name = "SCALE_22_6()",
+		 .tst_fn = check_convert_22_6},
+		{.name = "SCALE_22_7()",
+		 .tst_fn = check_convert_22_7},
+		{.name = "SCALE_22_8()",
+		 .tst_fn = check_convert_22_8},
+		{.name = "SCALE_22_9()",
+		 .tst_fn = check_convert_22_9},
+		{.name = "SCALE_22_10()",
+		 .tst_fn = check_convert_22_10},
+		{.name = "SCALE_22_11()",
+		 .tst_fn = check_convert_22_11},
+		{.name = "SCALE_22_12()",
+		 .tst_fn = check_convert_22_12},
+		{.name = "SCALE_22_13()",
+		 .tst_fn = check_convert_22_13},
+		{.name = "SCALE_22_14()",
+		 .tst_fn = check_convert_22_14},
+		{.name = "SCALE_22_15()",
+		 .tst_fn = check_convert_22_15},
+		{.name = "SCALE_23_1()",
+		 .tst_fn = check_convert_23_1},
+		{.name = "SCALE_23_2()",
+		 .tst_fn = check_convert_23_2},
+		{.name = "SCALE_23_3()",
+		 .tst_fn = check_convert_23_3},
+		{.name = "SCALE_23_4()",
+		 .tst_fn = check_convert_23_4},
+		{.name = "SCALE_23_5()",
+		 .tst_fn = check_convert_23_5},
+		{.name = "SCALE_23_6()",
+		 .tst_fn = check_convert_23_6},
+		{.name = "SCALE_23_7()",
+		 .tst_fn = check_convert_23_7},
+		{.name = "SCALE_23_8()",
+		 .tst_fn = check_convert_23_8},
+		{.name = "SCALE_23_9()",
+		 .tst_fn = check_convert_23_9},
+		{.name = "SCALE_23_10()",
+		 .tst_fn = check_convert_23_10},
+		{.name = "SCALE_23_11()",
+		 .tst_fn = check_convert_23_11},
+		{.name = "SCALE_23_12()",
+		 .tst_fn = check_convert_23_12},
+		{.name = "SCALE_23_13()",
+		 .tst_fn = check_convert_23_13},
+		{.name = "SCALE_23_14()",
+		 .tst_fn = check_convert_23_14},
+		{.name = "SCALE_23_15()",
+		 .tst_fn = check_convert_23_15},
+		{.name = NULL}
+	}
+};
@@ -0,0 +1,1719 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * get_put_pixel.gen.c
+ *
+ * GENERATED on 2026 10 19 15:08:57 from get_put_pixel.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * get_put_pixel tests.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+
+#include "tst_test.h"
+
+static void fill_pixmap(gp_pixmap *c, gp_pixel p)
+{
+	gp_coord x, y;
+
+	for (x = 0; x < (gp_coord)c->w; x++)
+		for (y = 0; y < (gp_coord)c->h; y++)
+			gp_putpixel(c, x, y, p);
+}
+
+static int check_filled(gp_pixmap *c)
+{
+	gp_coord x, y;
+	gp_pixel p;
+
+	p = gp_getpixel(c, 0, 0);
+
+	for (x = 0; x < (gp_coord)c->w; x++)
+		for (y = 0; y < (gp_coord)c->h; y++)
+			if (p != gp_getpixel(c, x, y)) {
+				tst_msg("Pixels different %i %i", x, y);
+				return 1;
+			}
+
+	return 0;
+}
+
+static int try_pattern(gp_pixmap *c, gp_pixel p)
+{
+	fill_pixmap(c, p);
+
+	tst_msg("Filling pattern 0x%x", p);
+
+	if (check_filled(c))
+		return 1;
+
+	return 0;
+}
+
+static int get_put_pixel_RGB101010(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 4294967295U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_xRGB8888(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 4294967295U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_RGBA8888(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 4294967295U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_RGB888(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 16777215U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 16777215U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 16777215U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 16777215U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_BGR888(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 16777215U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 16777215U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 16777215U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 16777215U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_RGB555(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 65535U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 65535U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_RGB565(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 65535U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 65535U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_RGB666(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 262143U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 262143U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 262143U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 262143U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_RGB332(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 255U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 255U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 255U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 255U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_CMYK8888(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 4294967295U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_P2(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_P2);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 3U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 3U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 3U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 3U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_P4(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_P4);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 15U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 15U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 15U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 15U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_P8(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_P8);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 255U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 255U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 255U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 255U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_G1_DB(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 1U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 1U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 1U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 1U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_G2_DB(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 3U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 3U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 3U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 3U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_G4_DB(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 15U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 15U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 15U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 15U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_G1_UB(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 1U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 1U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 1U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 1U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_G2_UB(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 3U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 3U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 3U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 3U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_G4_UB(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 15U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 15U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 15U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 15U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_G8(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 255U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 255U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 255U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 255U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_GA88(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 65535U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 65535U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_G16(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 65535U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 65535U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int get_put_pixel_clipping_RGB101010(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_xRGB8888(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_RGBA8888(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_RGB888(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_BGR888(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_RGB555(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_RGB565(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_RGB666(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_RGB332(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_CMYK8888(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_P2(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_P2);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_P4(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_P4);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_P8(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_P8);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_G1_DB(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_G2_DB(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_G4_DB(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_G1_UB(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_G2_UB(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_G4_UB(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_G8(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_GA88(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+static int get_put_pixel_clipping_G16(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "get_put_pixel Testsuite",
+	.tests = {
+		{.name = "get_put_pixel RGB101010",
+		 .tst_fn = get_put_pixel_RGB101010},
+		{.name = "get_put_pixel xRGB8888",
+		 .tst_fn = get_put_pixel_xRGB8888},
+		{.name = "get_put_pixel RGBA8888",
+		 .tst_fn = get_put_pixel_RGBA8888},
+		{.name = "get_put_pixel RGB888",
+		 .tst_fn = get_put_pixel_RGB888},
+		{.name = "get_put_pixel BGR888",
+		 .tst_fn = get_put_pixel_BGR888},
+		{.name = "get_put_pixel RGB555",
+		 .tst_fn = get_put_pixel_RGB555},
+		{.name = "get_put_pixel RGB565",
+		 .tst_fn = get_put_pixel_RGB565},
+		{.name = "get_put_pixel RGB666",
+		 .tst_fn = get_put_pixel_RGB666},
+		{.name = "get_put_pixel RGB332",
+		 .tst_fn = get_put_pixel_RGB332},
+		{.name = "get_put_pixel CMYK8888",
+		 .tst_fn = get_put_pixel_CMYK8888},
+		{.name = "get_put_pixel P2",
+		 .tst_fn = get_put_pixel_P2},
+		{.name = "get_put_pixel P4",
+		 .tst_fn = get_put_pixel_P4},
+		{.name = "get_put_pixel P8",
+		 .tst_fn = get_put_pixel_P8},
+		{.name = "get_put_pixel G1_DB",
+		 .tst_fn = get_put_pixel_G1_DB},
+		{.name = "get_put_pixel G2_DB",
+		 .tst_fn = get_put_pixel_G2_DB},
+		{.name = "get_put_pixel G4_DB",
+		 .tst_fn = get_put_pixel_G4_DB},
+		{.name = "get_put_pixel G1_UB",
+		 .tst_fn = get_put_pixel_G1_UB},
+		{.name = "get_put_pixel G2_UB",
+		 .tst_fn = get_put_pixel_G2_UB},
+		{.name = "get_put_pixel G4_UB",
+		 .tst_fn = get_put_pixel_G4_UB},
+		{.name = "get_put_pixel G8",
+		 .tst_fn = get_put_pixel_G8},
+		{.name = "get_put_pixel GA88",
+		 .tst_fn = get_put_pixel_GA88},
+		{.name = "get_put_pixel G16",
+		 .tst_fn = get_put_pixel_G16},
+
+		{.name = "get_put_pixel clipping RGB101010",
+		 .tst_fn = get_put_pixel_clipping_RGB101010},
+		{.name = "get_put_pixel clipping xRGB8888",
+		 .tst_fn = get_put_pixel_clipping_xRGB8888},
+		{.name = "get_put_pixel clipping RGBA8888",
+		 .tst_fn = get_put_pixel_clipping_RGBA8888},
+		{.name = "get_put_pixel clipping RGB888",
+		 .tst_fn = get_put_pixel_clipping_RGB888},
+		{.name = "get_put_pixel clipping BGR888",
+		 .tst_fn = get_put_pixel_clipping_BGR888},
+		{.name = "get_put_pixel clipping RGB555",
+		 .tst_fn = get_put_pixel_clipping_RGB555},
+		{.name = "get_put_pixel clipping RGB565",
+		 .tst_fn = get_put_pixel_clipping_RGB565},
+		{.name = "get_put_pixel clipping RGB666",
+		 .tst_fn = get_put_pixel_clipping_RGB666},
+		{.name = "get_put_pixel clipping RGB332",
+		 .tst_fn = get_put_pixel_clipping_RGB332},
+		{.name = "get_put_pixel clipping CMYK8888",
+		 .tst_fn = get_put_pixel_clipping_CMYK8888},
+		{.name = "get_put_pixel clipping P2",
+		 .tst_fn = get_put_pixel_clipping_P2},
+		{.name = "get_put_pixel clipping P4",
+		 .tst_fn = get_put_pixel_clipping_P4},
+		{.name = "get_put_pixel clipping P8",
+		 .tst_fn = get_put_pixel_clipping_P8},
+		{.name = "get_put_pixel clipping G1_DB",
+		 .tst_fn = get_put_pixel_clipping_G1_DB},
+		{.name = "get_put_pixel clipping G2_DB",
+		 .tst_fn = get_put_pixel_clipping_G2_DB},
+		{.name = "get_put_pixel clipping G4_DB",
+		 .tst_fn = get_put_pixel_clipping_G4_DB},
+		{.name = "get_put_pixel clipping G1_UB",
+		 .tst_fn = get_put_pixel_clipping_G1_UB},
+		{.name = "get_put_pixel clipping G2_UB",
+		 .tst_fn = get_put_pixel_clipping_G2_UB},
+		{.name = "get_put_pixel clipping G4_UB",
+		 .tst_fn = get_put_pixel_clipping_G4_UB},
+		{.name = "get_put_pixel clipping G8",
+		 .tst_fn = get_put_pixel_clipping_G8},
+		{.name = "get_put_pixel clipping GA88",
+		 .tst_fn = get_put_pixel_clipping_GA88},
+		{.name = "get_put_pixel clipping G16",
+		 .tst_fn = get_put_pixel_clipping_G16},
+
+		{.name = NULL}
+	}
+};
@@ -0,0 +1,11830 @@
+/*
+ * write_pixel tests.
+ *
+ * Copyright (C) 2023 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <core/gp_write_pixels.gen.h>
+
+#include "tst_test.h"
+
+static void dump_buffers(uint8_t *exp, uint8_t *res, unsigned int len)
+{
+	unsigned int i;
+
+	printf("exp: ");
+
+	for (i = 0; i < len; i++)
+		printf("%02x ", exp[i]);
+
+	printf("\n");
+
+	printf("res: ");
+
+	for (i = 0; i < len; i++)
+		printf("%02x ", res[i]);
+
+	printf("\n");
+}
+
+static int compare_buffers(uint8_t *exp, uint8_t *res, unsigned int len)
+{
+	unsigned int i;
+
+	for (i = 0; i < len; i++) {
+		if (exp[i] != res[i]) {
+			dump_buffers(exp, res, len);
+			return TST_FAILED;
+		}
+	}
+
+	return TST_PASSED;
+}
+
+static int write_pixels_1BPP_DB_0_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_0_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 0, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x02,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x06,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0e,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1e,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3e,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7e,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_1_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 1, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x04,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0c,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1c,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3c,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7c,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_2_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0xff,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 2, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x08,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x18,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x38,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x78,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_3_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0xff,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 3, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x10,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x30,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x70,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_4_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0xff,
+		0xff,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 4, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x20,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x60,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0xff,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_5_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0xff,
+		0xff,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 5, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x40,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_6_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0xff,
+		0xff,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 6, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0xff,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0xff,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0xff,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0xff,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0xff,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_DB_7_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0xff,
+		0xff,
+		0xff,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_DB(res+2, 7, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_0_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0xff,
+		0xff,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 0, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x40,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x60,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x70,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x78,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7c,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7e,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_1_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x7f,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 1, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x20,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x30,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x38,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3c,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3e,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_2_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x3f,
+		0xff,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 2, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x10,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x18,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1c,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1e,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_3_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x1f,
+		0xff,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 3, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x08,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0c,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0e,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_4_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x0f,
+		0xff,
+		0xff,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 4, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x04,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x06,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xff,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_5_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x07,
+		0xff,
+		0xff,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 5, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x02,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_6_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x03,
+		0xff,
+		0xff,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 6, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_0(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 0, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_1(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 1, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_2(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 2, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_3(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 3, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_4(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 4, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_5(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 5, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_6(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 6, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_7(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 7, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_8(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 8, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_9(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 9, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_10(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 10, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_11(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 11, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_12(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 12, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_13(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 13, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_14(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 14, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_15(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 15, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_16(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 16, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_17(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 17, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_18(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 18, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_19(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 19, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_20(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 20, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_21(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 21, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_22(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 22, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_23(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 23, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_24(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0xfe,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 24, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_25(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0xff,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 25, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_26(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0xff,
+		0x80,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 26, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_27(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0xff,
+		0xc0,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 27, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_28(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0xff,
+		0xe0,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 28, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_29(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0xff,
+		0xf0,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 29, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_30(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0xff,
+		0xf8,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 30, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+static int write_pixels_1BPP_UB_7_31(void)
+{
+	uint8_t exp[] = {
+		0x00,
+		0x00,
+		0x01,
+		0xff,
+		0xff,
+		0xff,
+		0xfc,
+		0x00,
+		0x00,
+		0x00,
+	};
+
+	uint8_t res[10] = {};
+
+	gp_write_pixels_1BPP_UB(res+2, 7, 31, 1);
+
+	return compare_buffers(exp, res, 10);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "write_pixels 1BPP tests",
+	.tests = {
+		{.name = "write_pixels 1BPP_DB 0 0",
+		 .tst_fn = write_pixels_1BPP_DB_0_0},
+		{.name = "write_pixels 1BPP_DB 0 1",
+		 .tst_fn = write_pixels_1BPP_DB_0_1},
+		{.name = "write_pixels 1BPP_DB 0 2",
+		 .tst_fn = write_pixels_1BPP_DB_0_2},
+		{.name = "write_pixels 1BPP_DB 0 3",
+		 .tst_fn = write_pixels_1BPP_DB_0_3},
+		{.name = "write_pixels 1BPP_DB 0 4",
+		 .tst_fn = write_pixels_1BPP_DB_0_4},
+		{.name = "write_pixels 1BPP_DB 0 5",
+		 .tst_fn = write_pixels_1BPP_DB_0_5},
+		{.name = "write_pixels 1BPP_DB 0 6",
+		 .tst_fn = write_pixels_1BPP_DB_0_6},
+		{.name = "write_pixels 1BPP_DB 0 7",
+		 .tst_fn = write_pixels_1BPP_DB_0_7},
+		{.name = "write_pixels 1BPP_DB 0 8",
+		 .tst_fn = write_pixels_1BPP_DB_0_8},
+		{.name = "write_pixels 1BPP_DB 0 9",
+		 .tst_fn = write_pixels_1BPP_DB_0_9},
+		{.name = "write_pixels 1BPP_DB 0 10",
+		 .tst_fn = write_pixels_1BPP_DB_0_10},
+		{.name = "write_pixels 1BPP_DB 0 11",
+		 .tst_fn = write_pixels_1BPP_DB_0_11},
+		{.name = "write_pixels 1BPP_DB 0 12",
+		 .tst_fn = write_pixels_1BPP_DB_0_12},
+		{.name = "write_pixels 1BPP_DB 0 13",
+		 .tst_fn = write_pixels_1BPP_DB_0_13},
+		{.name = "write_pixels 1BPP_DB 0 14",
+		 .tst_fn = write_pixels_1BPP_DB_0_14},
+		{.name = "write_pixels 1BPP_DB 0 15",
+		 .tst_fn = write_pixels_1BPP_DB_0_15},
+		{.name = "write_pixels 1BPP_DB 0 16",
+		 .tst_fn = write_pixels_1BPP_DB_0_16},
+		{.name = "write_pixels 1BPP_DB 0 17",
+		 .tst_fn = write_pixels_1BPP_DB_0_17},
+		{.name = "write_pixels 1BPP_DB 0 18",
+		 .tst_fn = write_pixels_1BPP_DB_0_18},
+		{.name = "write_pixels 1BPP_DB 0 19",
+		 .tst_fn = write_pixels_1BPP_DB_0_19},
+		{.name = "write_pixels 1BPP_DB 0 20",
+		 .tst_fn = write_pixels_1BPP_DB_0_20},
+		{.name = "write_pixels 1BPP_DB 0 21",
+		 .tst_fn = write_pixels_1BPP_DB_0_21},
+		{.name = "write_pixels 1BPP_DB 0 22",
+		 .tst_fn = write_pixels_1BPP_DB_0_22},
+		{.name = "write_pixels 1BPP_DB 0 23",
+		 .tst_fn = write_pixels_1BPP_DB_0_23},
+		{.name = "write_pixels 1BPP_DB 0 24",
+		 .tst_fn = write_pixels_1BPP_DB_0_24},
+		{.name = "write_pixels 1BPP_DB 0 25",
+		 .tst_fn = write_pixels_1BPP_DB_0_25},
+		{.name = "write_pixels 1BPP_DB 0 26",
+		 .tst_fn = write_pixels_1BPP_DB_0_26},
+		{.name = "write_pixels 1BPP_DB 0 27",
+		 .tst_fn = write_pixels_1BPP_DB_0_27},
+		{.name = "write_pixels 1BPP_DB 0 28",
+		 .tst_fn = write_pixels_1BPP_DB_0_28},
+		{.name = "write_pixels 1BPP_DB 0 29",
+		 .tst_fn = write_pixels_1BPP_DB_0_29},
+		{.name = "write_pixels 1BPP_DB 0 30",
+		 .tst_fn = write_pixels_1BPP_DB_0_30},
+		{.name = "write_pixels 1BPP_DB 0 31",
+		 .tst_fn = write_pixels_1BPP_DB_0_31},
+		{.name = "write_pixels 1BPP_DB 1 0",
+		 .tst_fn = write_pixels_1BPP_DB_1_0},
+		{.name = "write_pixels 1BPP_DB 1 1",
+		 .tst_fn = write_pixels_1BPP_DB_1_1},
+		{.name = "write_pixels 1BPP_DB 1 2",
+		 .tst_fn = write_pixels_1BPP_DB_1_2},
+		{.name = "write_pixels 1BPP_DB 1 3",
+		 .tst_fn = write_pixels_1BPP_DB_1_3},
+		{.name = "write_pixels 1BPP_DB 1 4",
+		 .tst_fn = write_pixels_1BPP_DB_1_4},
+		{.name = "write_pixels 1BPP_DB 1 5",
+		 .tst_fn = write_pixels_1BPP_DB_1_5},
+		{.name = "write_pixels 1BPP_DB 1 6",
+		 .tst_fn = write_pixels_1BPP_DB_1_6},
+		{.name = "write_pixels 1BPP_DB 1 7",
+		 .tst_fn = write_pixels_1BPP_DB_1_7},
+		{.name = "write_pixels 1BPP_DB 1 8",
+		 .tst_fn = write_pixels_1BPP_DB_1_8},
+		{.name = "write_pixels 1BPP_DB 1 9",
+		 .tst_fn = write_pixels_1BPP_DB_1_9},
+		{.name = "write_pixels 1BPP_DB 1 10",
+		 .tst_fn = write_pixels_1BPP_DB_1_10},
+		{.name = "write_pixels 1BPP_DB 1 11",
+		 .tst_fn = write_pixels_1BPP_DB_1_11},
+		{.name = "write_pixels 1BPP_DB 1 12",
+		 .tst_fn = write_pixels_1BPP_DB_1_12},
+		{.name = "write_pixels 1BPP_DB 1 13",
+		 .tst_fn = write_pixels_1BPP_DB_1_13},
+		{.name = "write_pixels 1BPP_DB 1 14",
+		 .tst_fn = write_pixels_1BPP_DB_1_14},
+		{.name = "write_pixels 1BPP_DB 1 15",
+		 .tst_fn = write_pixels_1BPP_DB_1_15},
+		{.name = "write_pixels 1BPP_DB 1 16",
+		 .tst_fn = write_pixels_1BPP_DB_1_16},
+		{.name = "write_pixels 1BPP_DB 1 17",
+		 .tst_fn = write_pixels_1BPP_DB_1_17},
+		{.name = "write_pixels 1BPP_DB 1 18",
+		 .tst_fn = write_pixels_1BPP_DB_1_18},
+		{.name = "write_pixels 1BPP_DB 1 19",
+		 .tst_fn = write_pixels_1BPP_DB_1_19},
+		{.name = "write_pixels 1BPP_DB 1 20",
+		 .tst_fn = write_pixels_1BPP_DB_1_20},
+		{.name = "write_pixels 1BPP_DB 1 21",
+		 .tst_fn = write_pixels_1BPP_DB_1_21},
+		{.name = "write_pixels 1BPP_DB 1 22",
+		 .tst_fn = write_pixels_1BPP_DB_1_22},
+		{.name = "write_pixels 1BPP_DB 1 23",
+		 .tst_fn = write_pixels_1BPP_DB_1_23},
+		{.name = "write_pixels 1BPP_DB 1 24",
+		 .tst_fn = write_pixels_1BPP_DB_1_24},
+		{.name = "write_pixels 1BPP_DB 1 25",
+		 .tst_fn = write_pixels_1BPP_DB_1_25},
+		{.name = "write_pixels 1BPP_DB 1 26",
+		 .tst_fn = write_pixels_1BPP_DB_1_26},
+		{.name = "write_pixels 1BPP_DB 1 27",
+		 .tst_fn = write_pixels_1BPP_DB_1_27},
+		{.name = "write_pixels 1BPP_DB 1 28",
+		 .tst_fn = write_pixels_1BPP_DB_1_28},
+		{.name = "write_pixels 1BPP_DB 1 29",
+		 .tst_fn = write_pixels_1BPP_DB_1_29},
+		{.name = "write_pixels 1BPP_DB 1 30",
+		 .tst_fn = write_pixels_1BPP_DB_1_30},
+		{.name = "write_pixels 1BPP_DB 1 31",
+		 .tst_fn = write_pixels_1BPP_DB_1_31},
+		{.name = "write_pixels 1BPP_DB 2 0",
+		 .tst_fn = write_pixels_1BPP_DB_2_0},
+		{.name = "write_pixels 1BPP_DB 2 1",
+		 .tst_fn = write_pixels_1BPP_DB_2_1},
+		{.name = "write_pixels 1BPP_DB 2 2",
+		 .tst_fn = write_pixels_1BPP_DB_2_2},
+		{.name = "write_pixels 1BPP_DB 2 3",
+		 .tst_fn = write_pixels_1BPP_DB_2_3},
+		{.name = "write_pixels 1BPP_DB 2 4",
+		 .tst_fn = write_pixels_1BPP_DB_2_4},
+		{.name = "write_pixels 1BPP_DB 2 5",
+		 .tst_fn = write_pixels_1BPP_DB_2_5},
+		{.name = "write_pixels 1BPP_DB 2 6",
+		 .tst_fn = write_pixels_1BPP_DB_2_6},
+		{.name = "write_pixels 1BPP_DB 2 7",
+		 .tst_fn = write_pixels_1BPP_DB_2_7},
+		{.name = "write_pixels 1BPP_DB 2 8",
+		 .tst_fn = write_pixels_1BPP_DB_2_8},
+		{.name = "write_pixels 1BPP_DB 2 9",
+		 .tst_fn = write_pixels_1BPP_DB_2_9},
+		{.name = "write_pixels 1BPP_DB 2 10",
+		 .tst_fn = write_pixels_1BPP_DB_2_10},
+		{.name = "write_pixels 1BPP_DB 2 11",
+		 .tst_fn = write_pixels_1BPP_DB_2_11},
+		{.name = "write_pixels 1BPP_DB 2 12",
+		 .tst_fn = write_pixels_1BPP_DB_2_12},
+		{.name = "write_pixels 1BPP_DB 2 13",
+		 .tst_fn = write_pixels_1BPP_DB_2_13},
+		{.name = "write_pixels 1BPP_DB 2 14",
+		 .tst_fn = write_pixels_1BPP_DB_2_14},
+		{.name = "write_pixels 1BPP_DB 2 15",
+		 .tst_fn = write_pixels_1BPP_DB_2_15},
+		{.name = "write_pixels 1BPP_DB 2 16",
+		 .tst_fn = write_pixels_1BPP_DB_2_16},
+		{.name = "write_pixels 1BPP_DB 2 17",
+		 .tst_fn = write_pixels_1BPP_DB_2_17},
+		{.name = "write_pixels 1BPP_DB 2 18",
+		 .tst_fn = write_pixels_1BPP_DB_2_18},
+		{.name = "write_pixels 1BPP_DB 2 19",
+		 .tst_fn = write_pixels_1BPP_DB_2_19},
+		{.name = "write_pixels 1BPP_DB 2 20",
+		 .tst_fn = write_pixels_1BPP_DB_2_20},
+		{.name = "write_pixels 1BPP_DB 2 21",
+		 .tst_fn = write_pixels_1BPP_DB_2_21},
+		{.name = "write_pixels 1BPP_DB 2 22",
+		 .tst_fn = write_pixels_1BPP_DB_2_22},
+		{.name = "write_pixels 1BPP_DB 2 23",
+		 .tst_fn = write_pixels_1BPP_DB_2_23},
+		{.name = "write_pixels 1BPP_DB 2 24",
+		 .tst_fn = write_pixels_1BPP_DB_2_24},
+		{.name = "write_pixels 1BPP_DB 2 25",
+		 .tst_fn = write_pixels_1BPP_DB_2_25},
+		{.name = "write_pixels 1BPP_DB 2 26",
+		 .tst_fn = write_pixels_1BPP_DB_2_26},
+		{.name = "write_pixels 1BPP_DB 2 27",
+		 .tst_fn = write_pixels_1BPP_DB_2_27},
+		{.name = "write_pixels 1BPP_DB 2 28",
+		 .tst_fn = write_pixels_1BPP_DB_2_28},
+		{.name = "write_pixels 1BPP_DB 2 29",
+		 .tst_fn = write_pixels_1BPP_DB_2_29},
+		{.name = "write_pixels 1BPP_DB 2 30",
+		 .tst_fn = write_pixels_1BPP_DB_2_30},
+		{.name = "write_pixels 1BPP_DB 2 31",
+		 .tst_fn = write_pixels_1BPP_DB_2_31},
+		{.name = "write_pixels 1BPP_DB 3 0",
+		 .tst_fn = write_pixels_1BPP_DB_3_0},
+		{.name = "write_pixels 1BPP_DB 3 1",
+		 .tst_fn = write_pixels_1BPP_DB_3_1},
+		{.name = "write_pixels 1BPP_DB 3 2",
+		 .tst_fn = write_pixels_1BPP_DB_3_2},
+		{.name = "write_pixels 1BPP_DB 3 3",
+		 .tst_fn = write_pixels_1BPP_DB_3_3},
+		{.name = "write_pixels 1BPP_DB 3 4",
+		 .tst_fn = write_pixels_1BPP_DB_3_4},
+		{.name = "write_pixels 1BPP_DB 3 5",
+		 .tst_fn = write_pixels_1BPP_DB_3_5},
+		{.name = "write_pixels 1BPP_DB 3 6",
+		 .tst_fn = write_pixels_1BPP_DB_3_6},
+		{.name = "write_pixels 1BPP_DB 3 7",
+		 .tst_fn = write_pixels_1BPP_DB_3_7},
+		{.name = "write_pixels 1BPP_DB 3 8",
+		 .tst_fn = write_pixels_1BPP_DB_3_8},
+		{.name = "write_pixels 1BPP_DB 3 9",
+		 .tst_fn = write_pixels_1BPP_DB_3_9},
+		{.name = "write_pixels 1BPP_DB 3 10",
+		 .tst_fn = write_pixels_1BPP_DB_3_10},
+		{.name = "write_pixels 1BPP_DB 3 11",
+		 .tst_fn = write_pixels_1BPP_DB_3_11},
+		{.name = "write_pixels 1BPP_DB 3 12",
+		 .tst_fn = write_pixels_1BPP_DB_3_12},
+		{.name = "write_pixels 1BPP_DB 3 13",
+		 .tst_fn = write_pixels_1BPP_DB_3_13},
+		{.name = "write_pixels 1BPP_DB 3 14",
+		 .tst_fn = write_pixels_1BPP_DB_3_14},
+		{.name = "write_pixels 1BPP_DB 3 15",
+		 .tst_fn = write_pixels_1BPP_DB_3_15},
+		{.name = "write_pixels 1BPP_DB 3 16",
+		 .tst_fn = write_pixels_1BPP_DB_3_16},
+		{.name = "write_pixels 1BPP_DB 3 17",
+		 .tst_fn = write_pixels_1BPP_DB_3_17},
+		{.name = "write_pixels 1BPP_DB 3 18",
+		 .tst_fn = write_pixels_1BPP_DB_3_18},
+		{.name = "write_pixels 1BPP_DB 3 19",
+		 .tst_fn = write_pixels_1BPP_DB_3_19},
+		{.name = "write_pixels 1BPP_DB 3 20",
+		 .tst_fn = write_pixels_1BPP_DB_3_20},
+		{.name = "write_pixels 1BPP_DB 3 21",
+		 .tst_fn = write_pixels_1BPP_DB_3_21},
+		{.name = "write_pixels 1BPP_DB 3 22",
+		 .tst_fn = write_pixels_1BPP_DB_3_22},
+		{.name = "write_pixels 1BPP_DB 3 23",
+		 .tst_fn = write_pixels_1BPP_DB_3_23},
+		{.name = "write_pixels 1BPP_DB 3 24",
+		 .tst_fn = write_pixels_1BPP_DB_3_24},
+		{.name = "write_pixels 1BPP_DB 3 25",
+		 .tst_fn = write_pixels_1BPP_DB_3_25},
+		{.name = "write_pixels 1BPP_DB 3 26",
+		 .tst_fn = write_pixels_1BPP_DB_3_26},
+		{.name = "write_pixels 1BPP_DB 3 27",
+		 .tst_fn = write_pixels_1BPP_DB_3_27},
+		{.name = "write_pixels 1BPP_DB 3 28",
+		 .tst_fn = write_pixels_1BPP_DB_3_28},
+		{.name = "write_pixels 1BPP_DB 3 29",
+		 .tst_fn = write_pixels_1BPP_DB_3_29},
+		{.name = "write_pixels 1BPP_DB 3 30",
+		 .tst_fn = write_pixels_1BPP_DB_3_30},
+		{.name = "write_pixels 1BPP_DB 3 31",
+		 .tst_fn = write_pixels_1BPP_DB_3_31},
+		{.name = "write_pixels 1BPP_DB 4 0",
+		 .tst_fn = write_pixels_1BPP_DB_4_0},
+		{.name = "write_pixels 1BPP_DB 4 1",
+		 .tst_fn = write_pixels_1BPP_DB_4_1},
+		{.name = "write_pixels 1BPP_DB 4 2",
+		 .tst_fn = write_pixels_1BPP_DB_4_2},
+		{.name = "write_pixels 1BPP_DB 4 3",
+		 .tst_fn = write_pixels_1BPP_DB_4_3},
+		{.name = "write_pixels 1BPP_DB 4 4",
+		 .tst_fn = write_pixels_1BPP_DB_4_4},
+		{.name = "write_pixels 1BPP_DB 4 5",
+		 .tst_fn = write_pixels_1BPP_DB_4_5},
+		{.name = "write_pixels 1BPP_DB 4 6",
+		 .tst_fn = write_pixels_1BPP_DB_4_6},
+		{.name = "write_pixels 1BPP_DB 4 7",
+		 .tst_fn = write_pixels_1BPP_DB_4_7},
+		{.name = "write_pixels 1BPP_DB 4 8",
+		 .tst_fn = write_pixels_1BPP_DB_4_8},
+		{.name = "write_pixels 1BPP_DB 4 9",
+		 .tst_fn = write_pixels_1BPP_DB_4_9},
+		{.name = "write_pixels 1BPP_DB 4 10",
+		 .tst_fn = write_pixels_1BPP_DB_4_10},
+		{.name = "write_pixels 1BPP_DB 4 11",
+		 .tst_fn = write_pixels_1BPP_DB_4_11},
+		{.name = "write_pixels 1BPP_DB 4 12",
+		 .tst_fn = write_pixels_1BPP_DB_4_12},
+		{.name = "write_pixels 1BPP_DB 4 13",
+		 .tst_fn = write_pixels_1BPP_DB_4_13},
+		{.name = "write_pixels 1BPP_DB 4 14",
+		 .tst_fn = write_pixels_1BPP_DB_4_14},
+		{.name = "write_pixels 1BPP_DB 4 15",
+		 .tst_fn = write_pixels_1BPP_DB_4_15},
+		{.name = "write_pixels 1BPP_DB 4 16",
+		 .tst_fn = write_pixels_1BPP_DB_4_16},
+		{.name = "write_pixels 1BPP_DB 4 17",
+		 .tst_fn = write_pixels_1BPP_DB_4_17},
+		{.name = "write_pixels 1BPP_DB 4 18",
+		 .tst_fn = write_pixels_1BPP_DB_4_18},
+		{.name = "write_pixels 1BPP_DB 4 19",
+		 .tst_fn = write_pixels_1BPP_DB_4_19},
+		{.name = "write_pixels 1BPP_DB 4 20",
+		 .tst_fn = write_pixels_1BPP_DB_4_20},
+		{.name = "write_pixels 1BPP_DB 4 21",
+		 .tst_fn = write_pixels_1BPP_DB_4_21},
+		{.name = "write_pixels 1BPP_DB 4 22",
+		 .tst_fn = write_pixels_1BPP_DB_4_22},
+		{.name = "write_pixels 1BPP_DB 4 23",
+		 .tst_fn = write_pixels_1BPP_DB_4_23},
+		{.name = "write_pixels 1BPP_DB 4 24",
+		 .tst_fn = write_pixels_1BPP_DB_4_24},
+		{.name = "write_pixels 1BPP_DB 4 25",
+		 .tst_fn = write_pixels_1BPP_DB_4_25},
+		{.name = "write_pixels 1BPP_DB 4 26",
+		 .tst_fn = write_pixels_1BPP_DB_4_26},
+		{.name = "write_pixels 1BPP_DB 4 27",
+		 .tst_fn = write_pixels_1BPP_DB_4_27},
+		{.name = "write_pixels 1BPP_DB 4 28",
+		 .tst_fn = write_pixels_1BPP_DB_4_28},
+		{.name = "write_pixels 1BPP_DB 4 29",
+		 .tst_fn = write_pixels_1BPP_DB_4_29},
+		{.name = "write_pixels 1BPP_DB 4 30",
+		 .tst_fn = write_pixels_1BPP_DB_4_30},
+		{.name = "write_pixels 1BPP_DB 4 31",
+		 .tst_fn = write_pixels_1BPP_DB_4_31},
+		{.name = "write_pixels 1BPP_DB 5 0",
+		 .tst_fn = write_pixels_1BPP_DB_5_0},
+		{.name = "write_pixels 1BPP_DB 5 1",
+		 .tst_fn = write_pixels_1BPP_DB_5_1},
+		{.name = "write_pixels 1BPP_DB 5 2",
+		 .tst_fn = write_pixels_1BPP_DB_5_2},
+		{.name = "write_pixels 1BPP_DB 5 3",
+		 .tst_fn = write_pixels_1BPP_DB_5_3},
+		{.name = "write_pixels 1BPP_DB 5 4",
+		 .tst_fn = write_pixels_1BPP_DB_5_4},
+		{.name = "write_pixels 1BPP_DB 5 5",
+		 .tst_fn = write_pixels_1BPP_DB_5_5},
+		{.name = "write_pixels 1BPP_DB 5 6",
+		 .tst_fn = write_pixels_1BPP_DB_5_6},
+		{.name = "write_pixels 1BPP_DB 5 7",
+		 .tst_fn = write_pixels_1BPP_DB_5_7},
+		{.name = "write_pixels 1BPP_DB 5 8",
+		 .tst_fn = write_pixels_1BPP_DB_5_8},
+		{.name = "write_pixels 1BPP_DB 5 9",
+		 .tst_fn = write_pixels_1BPP_DB_5_9},
+		{.name = "write_pixels 1BPP_DB 5 10",
+		 .tst_fn = write_pixels_1BPP_DB_5_10},
+		{.name = "write_pixels 1BPP_DB 5 11",
+		 .tst_fn = write_pixels_1BPP_DB_5_11},
+		{.name = "write_pixels 1BPP_DB 5 12",
+		 .tst_fn = write_pixels_1BPP_DB_5_12},
+		{.name = "write_pixels 1BPP_DB 5 13",
+		 .tst_fn = write_pixels_1BPP_DB_5_13},
+		{.name = "write_pixels 1BPP_DB 5 14",
+		 .tst_fn = write_pixels_1BPP_DB_5_14},
+		{.name = "write_pixels 1BPP_DB 5 15",
+		 .tst_fn = write_pixels_1BPP_DB_5_15},
+		{.name = "write_pixels 1BPP_DB 5 16",
+		 .tst_fn = write_pixels_1BPP_DB_5_16},
+		{.name = "write_pixels 1BPP_DB 5 17",
+		 .tst_fn = write_pixels_1BPP_DB_5_17},
+		{.name = "write_pixels 1BPP_DB 5 18",
+		 .tst_fn = write_pixels_1BPP_DB_5_18},
+		{.name = "write_pixels 1BPP_DB 5 19",
+		 .tst_fn = write_pixels_1BPP_DB_5_19},
+		{.name = "write_pixels 1BPP_DB 5 20",
+		 .tst_fn = write_pixels_1BPP_DB_5_20},
+		{.name = "write_pixels 1BPP_DB 5 21",
+		 .tst_fn = write_pixels_1BPP_DB_5_21},
+		{.name = "write_pixels 1BPP_DB 5 22",
+		 .tst_fn = write_pixels_1BPP_DB_5_22},
+		{.name = "write_pixels 1BPP_DB 5 23",
+		 .tst_fn = write_pixels_1BPP_DB_5_23},
+		{.name = "write_pixels 1BPP_DB 5 24",
+		 .tst_fn = write_pixels_1BPP_DB_5_24},
+		{.name = "write_pixels 1BPP_DB 5 25",
+		 .tst_fn = write_pixels_1BPP_DB_5_25},
+		{.name = "write_pixels 1BPP_DB 5 26",
+		 .tst_fn = write_pixels_1BPP_DB_5_26},
+		{.name = "write_pixels 1BPP_DB 5 27",
+		 .tst_fn = write_pixels_1BPP_DB_5_27},
+		{.name = "write_pixels 1BPP_DB 5 28",
+		 .tst_fn = write_pixels_1BPP_DB_5_28},
+		{.name = "write_pixels 1BPP_DB 5 29",
+		 .tst_fn = write_pixels_1BPP_DB_5_29},
+		{.name = "write_pixels 1BPP_DB 5 30",
+		 .tst_fn = write_pixels_1BPP_DB_5_30},
+		{.name = "write_pixels 1BPP_DB 5 31",
+		 .tst_fn = write_pixels_1BPP_DB_5_31},
+		{.name = "write_pixels 1BPP_DB 6 0",
+		 .tst_fn = write_pixels_1BPP_DB_6_0},
+		{.name = "write_pixels 1BPP_DB 6 1",
+		 .tst_fn = write_pixels_1BPP_DB_6_1},
+		{.name = "write_pixels 1BPP_DB 6 2",
+		 .tst_fn = write_pixels_1BPP_DB_6_2},
+		{.name = "write_pixels 1BPP_DB 6 3",
+		 .tst_fn = write_pixels_1BPP_DB_6_3},
+		{.name = "write_pixels 1BPP_DB 6 4",
+		 .tst_fn = write_pixels_1BPP_DB_6_4},
+		{.name = "write_pixels 1BPP_DB 6 5",
+		 .tst_fn = write_pixels_1BPP_DB_6_5},
+		{.name = "write_pixels 1BPP_DB 6 6",
+		 .tst_fn = write_pixels_1BPP_DB_6_6},
+		{.name = "write_pixels 1BPP_DB 6 7",
+		 .tst_fn = write_pixels_1BPP_DB_6_7},
+		{.name = "write_pixels 1BPP_DB 6 8",
+		 .tst_fn = write_pixels_1BPP_DB_6_8},
+		{.name = "write_pixels 1BPP_DB 6 9",
+		 .tst_fn = write_pixels_1BPP_DB_6_9},
+		{.name = "write_pixels 1BPP_DB 6 10",
+		 .tst_fn = write_pixels_1BPP_DB_6_10},
+		{.name = "write_pixels 1BPP_DB 6 11",
+		 .tst_fn = write_pixels_1BPP_DB_6_11},
+		{.name = "write_pixels 1BPP_DB 6 12",
+		 .tst_fn = write_pixels_1BPP_DB_6_12},
+		{.name = "write_pixels 1BPP_DB 6 13",
+		 .tst_fn = write_pixels_1BPP_DB_6_13},
+		{.name = "write_pixels 1BPP_DB 6 14",
+		 .tst_fn = write_pixels_1BPP_DB_6_14},
+		{.name = "write_pixels 1BPP_DB 6 15",
+		 .tst_fn = write_pixels_1BPP_DB_6_15},
+		{.name = "write_pixels 1BPP_DB 6 16",
+		 .tst_fn = write_pixels_1BPP_DB_6_16},
+		{.name = "write_pixels 1BPP_DB 6 17",
+		 .tst_fn = write_pixels_1BPP_DB_6_17},
+		{.name = "write_pixels 1BPP_DB 6 18",
+		 .tst_fn = write_pixels_1BPP_DB_6_18},
+		{.name = "write_pixels 1BPP_DB 6 19",
+		 .tst_fn = write_pixels_1BPP_DB_6_19},
+		{.name = "write_pixels 1BPP_DB 6 20",
+		 .tst_fn = write_pixels_1BPP_DB_6_20},
+		{.name = "write_pixels 1BPP_DB 6 21",
+		 .tst_fn = write_pixels_1BPP_DB_6_21},
+		{.name = "write_pixels 1BPP_DB 6 22",
+		 .tst_fn = write_pixels_1BPP_DB_6_22},
+		{.name = "write_pixels 1BPP_DB 6 23",
+		 .tst_fn = write_pixels_1BPP_DB_6_23},
+		{.name = "write_pixels 1BPP_DB 6 24",
+		 .tst_fn = write_pixels_1BPP_DB_6_24},
+		{.name = "write_pixels 1BPP_DB 6 25",
+		 .tst_fn = write_pixels_1BPP_DB_6_25},
+		{.name = "write_pixels 1BPP_DB 6 26",
+		 .tst_fn = write_pixels_1BPP_DB_6_26},
+		{.name = "write_pixels 1BPP_DB 6 27",
+		 .tst_fn = write_pixels_1BPP_DB_6_27},
+		{.name = "write_pixels 1BPP_DB 6 28",
+		 .tst_fn = write_pixels_1BPP_DB_6_28},
+		{.name = "write_pixels 1BPP_DB 6 29",
+		 .tst_fn = write_pixels_1BPP_DB_6_29},
+		{.name = "write_pixels 1BPP_DB 6 30",
+		 .tst_fn = write_pixels_1BPP_DB_6_30},
+		{.name = "write_pixels 1BPP_DB 6 31",
+		 .tst_fn = write_pixels_1BPP_DB_6_31},
+		{.name = "write_pixels 1BPP_DB 7 0",
+		 .tst_fn = write_pixels_1BPP_DB_7_0},
+		{.name = "write_pixels 1BPP_DB 7 1",
+		 .tst_fn = write_pixels_1BPP_DB_7_1},
+		{.name = "write_pixels 1BPP_DB 7 2",
+		 .tst_fn = write_pixels_1BPP_DB_7_2},
+		{.name = "write_pixels 1BPP_DB 7 3",
+		 .tst_fn = write_pixels_1BPP_DB_7_3},
+		{.name = "write_pixels 1BPP_DB 7 4",
+		 .tst_fn = write_pixels_1BPP_DB_7_4},
+		{.name = "write_pixels 1BPP_DB 7 5",
+		 .tst_fn = write_pixels_1BPP_DB_7_5},
+		{.name = "write_pixels 1BPP_DB 7 6",
+		 .tst_fn = write_pixels_1BPP_DB_7_6},
+		{.name = "write_pixels 1BPP_DB 7 7",
+		 .tst_fn = write_pixels_1BPP_DB_7_7},
+		{.name = "write_pixels 1BPP_DB 7 8",
+		 .tst_fn = write_pixels_1BPP_DB_7_8},
+		{.name = "write_pixels 1BPP_DB 7 9",
+		 .tst_fn = write_pixels_1BPP_DB_7_9},
+		{.name = "write_pixels 1BPP_DB 7 10",
+		 .tst_fn = write_pixels_1BPP_DB_7_10},
+		{.name = "write_pixels 1BPP_DB 7 11",
+		 .tst_fn = write_pixels_1BPP_DB_7_11},
+		{.name = "write_pixels 1BPP_DB 7 12",
+		 .tst_fn = write_pixels_1BPP_DB_7_12},
+		{.name = "write_pixels 1BPP_DB 7 13",
+		 .tst_fn = write_pixels_1BPP_DB_7_13},
+		{.name = "write_pixels 1BPP_DB 7 14",
+		 .tst_fn = write_pixels_1BPP_DB_7_14},
+		{.name = "write_pixels 1BPP_DB 7 15",
+		 .tst_fn = write_pixels_1BPP_DB_7_15},
+		{.name = "write_pixels 1BPP_DB 7 16",
+		 .tst_fn = write_pixels_1BPP_DB_7_16},
+		{.name = "write_pixels 1BPP_DB 7 17",
+		 .tst_fn = write_pixels_1BPP_DB_7_17},
+		{.name = "write_pixels 1BPP_DB 7 18",
+		 .tst_fn = write_pixels_1BPP_DB_7_18},
+		{.name = "write_pixels 1BPP_DB 7 19",
+		 .tst_fn = write_pixels_1BPP_DB_7_19},
+		{.name = "write_pixels 1BPP_DB 7 20",
+		 .tst_fn = write_pixels_1BPP_DB_7_20},
+		{.name = "write_pixels 1BPP_DB 7 21",
+		 .tst_fn = write_pixels_1BPP_DB_7_21},
+		{.name = "write_pixels 1BPP_DB 7 22",
+		 .tst_fn = write_pixels_1BPP_DB_7_22},
+		{.name = "write_pixels 1BPP_DB 7 23",
+		 .tst_fn = write_pixels_1BPP_DB_7_23},
+		{.name = "write_pixels 1BPP_DB 7 24",
+		 .tst_fn = write_pixels_1BPP_DB_7_24},
+		{.name = "write_pixels 1BPP_DB 7 25",
+		 .tst_fn = write_pixels_1BPP_DB_7_25},
+		{.name = "write_pixels 1BPP_DB 7 26",
+		 .tst_fn = write_pixels_1BPP_DB_7_26},
+		{.name = "write_pixels 1BPP_DB 7 27",
+		 .tst_fn = write_pixels_1BPP_DB_7_27},
+		{.name = "write_pixels 1BPP_DB 7 28",
+		 .tst_fn = write_pixels_1BPP_DB_7_28},
+		{.name = "write_pixels 1BPP_DB 7 29",
+		 .tst_fn = write_pixels_1BPP_DB_7_29},
+		{.name = "write_pixels 1BPP_DB 7 30",
+		 .tst_fn = write_pixels_1BPP_DB_7_30},
+		{.name = "write_pixels 1BPP_DB 7 31",
+		 .tst_fn = write_pixels_1BPP_DB_7_31},
+		{.name = "write_pixels 1BPP_UB 0 0",
+		 .tst_fn = write_pixels_1BPP_UB_0_0},
+		{.name = "write_pixels 1BPP_UB 0 1",
+		 .tst_fn = write_pixels_1BPP_UB_0_1},
+		{.name = "write_pixels 1BPP_UB 0 2",
+		 .tst_fn = write_pixels_1BPP_UB_0_2},
+		{.name = "write_pixels 1BPP_UB 0 3",
+		 .tst_fn = write_pixels_1BPP_UB_0_3},
+		{.name = "write_pixels 1BPP_UB 0 4",
+		 .tst_fn = write_pixels_1BPP_UB_0_4},
+		{.name = "write_pixels 1BPP_UB 0 5",
+		 .tst_fn = write_pixels_1BPP_UB_0_5},
+		{.name = "write_pixels 1BPP_UB 0 6",
+		 .tst_fn = write_pixels_1BPP_UB_0_6},
+		{.name = "write_pixels 1BPP_UB 0 7",
+		 .tst_fn = write_pixels_1BPP_UB_0_7},
+		{.name = "write_pixels 1BPP_UB 0 8",
+		 .tst_fn = write_pixels_1BPP_UB_0_8},
+		{.name = "write_pixels 1BPP_UB 0 9",
+		 .tst_fn = write_pixels_1BPP_UB_0_9},
+		{.name = "write_pixels 1BPP_UB 0 10",
+		 .tst_fn = write_pixels_1BPP_UB_0_10},
+		{.name = "write_pixels 1BPP_UB 0 11",
+		 .tst_fn = write_pixels_1BPP_UB_0_11},
+		{.name = "write_pixels 1BPP_UB 0 12",
+		 .tst_fn = write_pixels_1BPP_UB_0_12},
+		{.name = "write_pixels 1BPP_UB 0 13",
+		 .tst_fn = write_pixels_1BPP_UB_0_13},
+		{.name = "write_pixels 1BPP_UB 0 14",
+		 .tst_fn = write_pixels_1BPP_UB_0_14},
+		{.name = "write_pixels 1BPP_UB 0 15",
+		 .tst_fn = write_pixels_1BPP_UB_0_15},
+		{.name = "write_pixels 1BPP_UB 0 16",
+		 .tst_fn = write_pixels_1BPP_UB_0_16},
+		{.name = "write_pixels 1BPP_UB 0 17",
+		 .tst_fn = write_pixels_1BPP_UB_0_17},
+		{.name = "write_pixels 1BPP_UB 0 18",
+		 .tst_fn = write_pixels_1BPP_UB_0_18},
+		{.name = "write_pixels 1BPP_UB 0 19",
+		 .tst_fn = write_pixels_1BPP_UB_0_19},
+		{.name = "write_pixels 1BPP_UB 0 20",
+		 .tst_fn = write_pixels_1BPP_UB_0_20},
+		{.name = "write_pixels 1BPP_UB 0 21",
+		 .tst_fn = write_pixels_1BPP_UB_0_21},
+		{.name = "write_pixels 1BPP_UB 0 22",
+		 .tst_fn = write_pixels_1BPP_UB_0_22},
+		{.name = "write_pixels 1BPP_UB 0 23",
+		 .tst_fn = write_pixels_1BPP_UB_0_23},
+		{.name = "write_pixels 1BPP_UB 0 24",
+		 .tst_fn = write_pixels_1BPP_UB_0_24},
+		{.name = "write_pixels 1BPP_UB 0 25",
+		 .tst_fn = write_pixels_1BPP_UB_0_25},
+		{.name = "write_pixels 1BPP_UB 0 26",
+		 .tst_fn = write_pixels_1BPP_UB_0_26},
+		{.name = "write_pixels 1BPP_UB 0 27",
+		 .tst_fn = write_pixels_1BPP_UB_0_27},
+		{.name = "write_pixels 1BPP_UB 0 28",
+		 .tst_fn = write_pixels_1BPP_UB_0_28},
+		{.name = "write_pixels 1BPP_UB 0 29",
+		 .tst_fn = write_pixels_1BPP_UB_0_29},
+		{.name = "write_pixels 1BPP_UB 0 30",
+		 .tst_fn = write_pixels_1BPP_UB_0_30},
+		{.name = "write_pixels 1BPP_UB 0 31",
+		 .tst_fn = write_pixels_1BPP_UB_0_31},
+		{.name = "write_pixels 1BPP_UB 1 0",
+		 .tst_fn = write_pixels_1BPP_UB_1_0},
+		{.name = "write_pixels 1BPP_UB 1 1",
+		 .tst_fn = write_pixels_1BPP_UB_1_1},
+		{.name = "write_pixels 1BPP_UB 1 2",
+		 .tst_fn = write_pixels_1BPP_UB_1_2},
+		{.name = "write_pixels 1BPP_UB 1 3",
+		 .tst_fn = write_pixels_1BPP_UB_1_3},
+		{.name = "write_pixels 1BPP_UB 1 4",
+		 .tst_fn = write_pixels_1BPP_UB_1_4},
+		{.name = "write_pixels 1BPP_UB 1 5",
+		 .tst_fn = write_pixels_1BPP_UB_1_5},
+		{.name = "write_pixels 1BPP_UB 1 6",
+		 .tst_fn = write_pixels_1BPP_UB_1_6},
+		{.name = "write_pixels 1BPP_UB 1 7",
+		 .tst_fn = write_pixels_1BPP_UB_1_7},
+		{.name = "write_pixels 1BPP_UB 1 8",
+		 .tst_fn = write_pixels_1BPP_UB_1_8},
+		{.name = "write_pixels 1BPP_UB 1 9",
+		 .tst_fn = write_pixels_1BPP_UB_1_9},
+		{.name = "write_pixels 1BPP_UB 1 10",
+		 .tst_fn = write_pixels_1BPP_UB_1_10},
+		{.name = "write_pixels 1BPP_UB 1 11",
+		 .tst_fn = write_pixels_1BPP_UB_1_11},
+		{.name = "write_pixels 1BPP_UB 1 12",
+		 .tst_fn = write_pixels_1BPP_UB_1_12},
+		{.name = "write_pixels 1BPP_UB 1 13",
+		 .tst_fn = write_pixels_1BPP_UB_1_13},
+		{.name = "write_pixels 1BPP_UB 1 14",
+		 .tst_fn = write_pixels_1BPP_UB_1_14},
+		{.name = "write_pixels 1BPP_UB 1 15",
+		 .tst_fn = write_pixels_1BPP_UB_1_15},
+		{.name = "write_pixels 1BPP_UB 1 16",
+		 .tst_fn = write_pixels_1BPP_UB_1_16},
+		{.name = "write_pixels 1BPP_UB 1 17",
+		 .tst_fn = write_pixels_1BPP_UB_1_17},
+		{.name = "write_pixels 1BPP_UB 1 18",
+		 .tst_fn = write_pixels_1BPP_UB_1_18},
+		{.name = "write_pixels 1BPP_UB 1 19",
+		 .tst_fn = write_pixels_1BPP_UB_1_19},
+		{.name = "write_pixels 1BPP_UB 1 20",
+		 .tst_fn = write_pixels_1BPP_UB_1_20},
+		{.name = "write_pixels 1BPP_UB 1 21",
+		 .tst_fn = write_pixels_1BPP_UB_1_21},
+		{.name = "write_pixels 1BPP_UB 1 22",
+		 .tst_fn = write_pixels_1BPP_UB_1_22},
+		{.name = "write_pixels 1BPP_UB 1 23",
+		 .tst_fn = write_pixels_1BPP_UB_1_23},
+		{.name = "write_pixels 1BPP_UB 1 24",
+		 .tst_fn = write_pixels_1BPP_UB_1_24},
+		{.name = "write_pixels 1BPP_UB 1 25",
+		 .tst_fn = write_pixels_1BPP_UB_1_25},
+		{.name = "write_pixels 1BPP_UB 1 26",
+		 .tst_fn = write_pixels_1BPP_UB_1_26},
+		{.name = "write_pixels 1BPP_UB 1 27",
+		 .tst_fn = write_pixels_1BPP_UB_1_27},
+		{.name = "write_pixels 1BPP_UB 1 28",
+		 .tst_fn = write_pixels_1BPP_UB_1_28},
+		{.name = "write_pixels 1BPP_UB 1 29",
+		 .tst_fn = write_pixels_1BPP_UB_1_29},
+		{.name = "write_pixels 1BPP_UB 1 30",
+		 .tst_fn = write_pixels_1BPP_UB_1_30},
+		{.name = "write_pixels 1BPP_UB 1 31",
+		 .tst_fn = write_pixels_1BPP_UB_1_31},
+		{.name = "write_pixels 1BPP_UB 2 0",
+		 .tst_fn = write_pixels_1BPP_UB_2_0},
+		{.name = "write_pixels 1BPP_UB 2 1",
+		 .tst_fn = write_pixels_1BPP_UB_2_1},
+		{.name = "write_pixels 1BPP_UB 2 2",
+		 .tst_fn = write_pixels_1BPP_UB_2_2},
+		{.name = "write_pixels 1BPP_UB 2 3",
+		 .tst_fn = write_pixels_1BPP_UB_2_3},
+		{.name = "write_pixels 1BPP_UB 2 4",
+		 .tst_fn = write_pixels_1BPP_UB_2_4},
+		{.name = "write_pixels 1BPP_UB 2 5",
+		 .tst_fn = write_pixels_1BPP_UB_2_5},
+		{.name = "write_pixels 1BPP_UB 2 6",
+		 .tst_fn = write_pixels_1BPP_UB_2_6},
+		{.name = "write_pixels 1BPP_UB 2 7",
+		 .tst_fn = write_pixels_1BPP_UB_2_7},
+		{.name = "write_pixels 1BPP_UB 2 8",
+		 .tst_fn = write_pixels_1BPP_UB_2_8},
+		{.name = "write_pixels 1BPP_UB 2 9",
+		 .tst_fn = write_pixels_1BPP_UB_2_9},
+		{.name = "write_pixels 1BPP_UB 2 10",
+		 .tst_fn = write_pixels_1BPP_UB_2_10},
+		{.name = "write_pixels 1BPP_UB 2 11",
+		 .tst_fn = write_pixels_1BPP_UB_2_11},
+		{.name = "write_pixels 1BPP_UB 2 12",
+		 .tst_fn = write_pixels_1BPP_UB_2_12},
+		{.name = "write_pixels 1BPP_UB 2 13",
+		 .tst_fn = write_pixels_1BPP_UB_2_13},
+		{.name = "write_pixels 1BPP_UB 2 14",
+		 .tst_fn = write_pixels_1BPP_UB_2_14},
+		{.name = "write_pixels 1BPP_UB 2 15",
+		 .tst_fn = write_pixels_1BPP_UB_2_15},
+		{.name = "write_pixels 1BPP_UB 2 16",
+		 .tst_fn = write_pixels_1BPP_UB_2_16},
+		{.name = "write_pixels 1BPP_UB 2 17",
+		 .tst_fn = write_pixels_1BPP_UB_2_17},
+		{.name = "write_pixels 1BPP_UB 2 18",
+		 .tst_fn = write_pixels_1BPP_UB_2_18},
+		{.name = "write_pixels 1BPP_UB 2 19",
+		 .tst_fn = write_pixels_1BPP_UB_2_19},
+		{.name = "write_pixels 1BPP_UB 2 20",
+		 .tst_fn = write_pixels_1BPP_UB_2_20},
+		{.name = "write_pixels 1BPP_UB 2 21",
+		 .tst_fn = write_pixels_1BPP_UB_2_21},
+		{.name = "write_pixels 1BPP_UB 2 22",
+		 .tst_fn = write_pixels_1BPP_UB_2_22},
+		{.name = "write_pixels 1BPP_UB 2 23",
+		 .tst_fn = write_pixels_1BPP_UB_2_23},
+		{.name = "write_pixels 1BPP_UB 2 24",
+		 .tst_fn = write_pixels_1BPP_UB_2_24},
+		{.name = "write_pixels 1BPP_UB 2 25",
+		 .tst_fn = write_pixels_1BPP_UB_2_25},
+		{.name = "write_pixels 1BPP_UB 2 26",
+		 .tst_fn = write_pixels_1BPP_UB_2_26},
+		{.name = "write_pixels 1BPP_UB 2 27",
+		 .tst_fn = write_pixels_1BPP_UB_2_27},
+		{.name = "write_pixels 1BPP_UB 2 28",
+		 .tst_fn = write_pixels_1BPP_UB_2_28},
+		{.name = "write_pixels 1BPP_UB 2 29",
+		 .tst_fn = write_pixels_1BPP_UB_2_29},
+		{.name = "write_pixels 1BPP_UB 2 30",
+		 .tst_fn = write_pixels_1BPP_UB_2_30},
+		{.name = "write_pixels 1BPP_UB 2 31",
+		 .tst_fn = write_pixels_1BPP_UB_2_31},
+		{.name = "write_pixels 1BPP_UB 3 0",
+		 .tst_fn = write_pixels_1BPP_UB_3_0},
+		{.name = "write_pixels 1BPP_UB 3 1",
+		 .tst_fn = write_pixels_1BPP_UB_3_1},
+		{.name = "write_pixels 1BPP_UB 3 2",
+		 .tst_fn = write_pixels_1BPP_UB_3_2},
+		{.name = "write_pixels 1BPP_UB 3 3",
+		 .tst_fn = write_pixels_1BPP_UB_3_3},
+		{.name = "write_pixels 1BPP_UB 3 4",
+		 .tst_fn = write_pixels_1BPP_UB_3_4},
+		{.name = "write_pixels 1BPP_UB 3 5",
+		 .tst_fn = write_pixels_1BPP_UB_3_5},
+		{.name = "write_pixels 1BPP_UB 3 6",
+		 .tst_fn = write_pixels_1BPP_UB_3_6},
+		{.name = "write_pixels 1BPP_UB 3 7",
+		 .tst_fn = write_pixels_1BPP_UB_3_7},
+		{.name = "write_pixels 1BPP_UB 3 8",
+		 .tst_fn = write_pixels_1BPP_UB_3_8},
+		{.name = "write_pixels 1BPP_UB 3 9",
+		 .tst_fn = write_pixels_1BPP_UB_3_9},
+		{.name = "write_pixels 1BPP_UB 3 10",
+		 .tst_fn = write_pixels_1BPP_UB_3_10},
+		{.name = "write_pixels 1BPP_UB 3 11",
+		 .tst_fn = write_pixels_1BPP_UB_3_11},
+		{.name = "write_pixels 1BPP_UB 3 12",
+		 .tst_fn = write_pixels_1BPP_UB_3_12},
+		{.name = "write_pixels 1BPP_UB 3 13",
+		 .tst_fn = write_pixels_1BPP_UB_3_13},
+		{.name = "write_pixels 1BPP_UB 3 14",
+		 .tst_fn = write_pixels_1BPP_UB_3_14},
+		{.name = "write_pixels 1BPP_UB 3 15",
+		 .tst_fn = write_pixels_1BPP_UB_3_15},
+		{.name = "write_pixels 1BPP_UB 3 16",
+		 .tst_fn = write_pixels_1BPP_UB_3_16},
+		{.name = "write_pixels 1BPP_UB 3 17",
+		 .tst_fn = write_pixels_1BPP_UB_3_17},
+		{.name = "write_pixels 1BPP_UB 3 18",
+		 .tst_fn = write_pixels_1BPP_UB_3_18},
+		{.name = "write_pixels 1BPP_UB 3 19",
+		 .tst_fn = write_pixels_1BPP_UB_3_19},
+		{.name = "write_pixels 1BPP_UB 3 20",
+		 .tst_fn = write_pixels_1BPP_UB_3_20},
+		{.name = "write_pixels 1BPP_UB 3 21",
+		 .tst_fn = write_pixels_1BPP_UB_3_21},
+		{.name = "write_pixels 1BPP_UB 3 22",
+		 .tst_fn = write_pixels_1BPP_UB_3_22},
+		{.name = "write_pixels 1BPP_UB 3 23",
+		 .tst_fn = write_pixels_1BPP_UB_3_23},
+		{.name = "write_pixels 1BPP_UB 3 24",
+		 .tst_fn = write_pixels_1BPP_UB_3_24},
+		{.name = "write_pixels 1BPP_UB 3 25",
+		 .tst_fn = write_pixels_1BPP_UB_3_25},
+		{.name = "write_pixels 1BPP_UB 3 26",
+		 .tst_fn = write_pixels_1BPP_UB_3_26},
+		{.name = "write_pixels 1BPP_UB 3 27",
+		 .tst_fn = write_pixels_1BPP_UB_3_27},
+		{.name = "write_pixels 1BPP_UB 3 28",
+		 .tst_fn = write_pixels_1BPP_UB_3_28},
+		{.name = "write_pixels 1BPP_UB 3 29",
+		 .tst_fn = write_pixels_1BPP_UB_3_29},
+		{.name = "write_pixels 1BPP_UB 3 30",
+		 .tst_fn = write_pixels_1BPP_UB_3_30},
+		{.name = "write_pixels 1BPP_UB 3 31",
+		 .tst_fn = write_pixels_1BPP_UB_3_31},
+		{.name = "write_pixels 1BPP_UB 4 0",
+		 .tst_fn = write_pixels_1BPP_UB_4_0},
+		{.name = "write_pixels 1BPP_UB 4 1",
+		 .tst_fn = write_pixels_1BPP_UB_4_1},
+		{.name = "write_pixels 1BPP_UB 4 2",
+		 .tst_fn = write_pixels_1BPP_UB_4_2},
+		{.name = "write_pixels 1BPP_UB 4 3",
+		 .tst_fn = write_pixels_1BPP_UB_4_3},
+		{.name = "write_pixels 1BPP_UB 4 4",
+		 .tst_fn = write_pixels_1BPP_UB_4_4},
+		{.name = "write_pixels 1BPP_UB 4 5",
+		 .tst_fn = write_pixels_1BPP_UB_4_5},
+		{.name = "write_pixels 1BPP_UB 4 6",
+		 .tst_fn = write_pixels_1BPP_UB_4_6},
+		{.name = "write_pixels 1BPP_UB 4 7",
+		 .tst_fn = write_pixels_1BPP_UB_4_7},
+		{.name = "write_pixels 1BPP_UB 4 8",
+		 .tst_fn = write_pixels_1BPP_UB_4_8},
+		{.name = "write_pixels 1BPP_UB 4 9",
+		 .tst_fn = write_pixels_1BPP_UB_4_9},
+		{.name = "write_pixels 1BPP_UB 4 10",
+		 .tst_fn = write_pixels_1BPP_UB_4_10},
+		{.name = "write_pixels 1BPP_UB 4 11",
+		 .tst_fn = write_pixels_1BPP_UB_4_11},
+		{.name = "write_pixels 1BPP_UB 4 12",
+		 .tst_fn = write_pixels_1BPP_UB_4_12},
+		{.name = "write_pixels 1BPP_UB 4 13",
+		 .tst_fn = write_pixels_1BPP_UB_4_13},
+		{.name = "write_pixels 1BPP_UB 4 14",
+		 .tst_fn = write_pixels_1BPP_UB_4_14},
+		{.name = "write_pixels 1BPP_UB 4 15",
+		 .tst_fn = write_pixels_1BPP_UB_4_15},
+		{.name = "write_pixels 1BPP_UB 4 16",
+		 .tst_fn = write_pixels_1BPP_UB_4_16},
+		{.name = "write_pixels 1BPP_UB 4 17",
+		 .tst_fn = write_pixels_1BPP_UB_4_17},
+		{.name = "write_pixels 1BPP_UB 4 18",
+		 .tst_fn = write_pixels_1BPP_UB_4_18},
+		{.name = "write_pixels 1BPP_UB 4 19",
+		 .tst_fn = write_pixels_1BPP_UB_4_19},
+		{.name = "write_pixels 1BPP_UB 4 20",
+		 .tst_fn = write_pixels_1BPP_UB_4_20},
+		{.name = "write_pixels 1BPP_UB 4 21",
+		 .tst_fn = write_pixels_1BPP_UB_4_21},
+		{.name = "write_pixels 1BPP_UB 4 22",
+		 .tst_fn = write_pixels_1BPP_UB_4_22},
+		{.name = "write_pixels 1BPP_UB 4 23",
+		 .tst_fn = write_pixels_1BPP_UB_4_23},
+		{.name = "write_pixels 1BPP_UB 4 24",
+		 .tst_fn = write_pixels_1BPP_UB_4_24},
+		{.name = "write_pixels 1BPP_UB 4 25",
+		 .tst_fn = write_pixels_1BPP_UB_4_25},
+		{.name = "write_pixels 1BPP_UB 4 26",
+		 .tst_fn = write_pixels_1BPP_UB_4_26},
+		{.name = "write_pixels 1BPP_UB 4 27",
+		 .tst_fn = write_pixels_1BPP_UB_4_27},
+		{.name = "write_pixels 1BPP_UB 4 28",
+		 .tst_fn = write_pixels_1BPP_UB_4_28},
+		{.name = "write_pixels 1BPP_UB 4 29",
+		 .tst_fn = write_pixels_1BPP_UB_4_29},
+		{.name = "write_pixels 1BPP_UB 4 30",
+		 .tst_fn = write_pixels_1BPP_UB_4_30},
+		{.name = "write_pixels 1BPP_UB 4 31",
+		 .tst_fn = write_pixels_1BPP_UB_4_31},
+		{.name = "write_pixels 1BPP_UB 5 0",
+		 .tst_fn = write_pixels_1BPP_UB_5_0},
+		{.name = "write_pixels 1BPP_UB 5 1",
+		 .tst_fn = write_pixels_1BPP_UB_5_1},
+		{.name = "write_pixels 1BPP_UB 5 2",
+		 .tst_fn = write_pixels_1BPP_UB_5_2},
+		{.name = "write_pixels 1BPP_UB 5 3",
+		 .tst_fn = write_pixels_1BPP_UB_5_3},
+		{.name = "write_pixels 1BPP_UB 5 4",
+		 .tst_fn = write_pixels_1BPP_UB_5_4},
+		{.name = "write_pixels 1BPP_UB 5 5",
+		 .tst_fn = write_pixels_1BPP_UB_5_5},
+		{.name = "write_pixels 1BPP_UB 5 6",
+		 .tst_fn = write_pixels_1BPP_UB_5_6},
+		{.name = "write_pixels 1BPP_UB 5 7",
+		 .tst_fn = write_pixels_1BPP_UB_5_7},
+		{.name = "write_pixels 1BPP_UB 5 8",
+		 .tst_fn = write_pixels_1BPP_UB_5_8},
+		{.name = "write_pixels 1BPP_UB 5 9",
+		 .tst_fn = write_pixels_1BPP_UB_5_9},
+		{.name = "write_pixels 1BPP_UB 5 10",
+		 .tst_fn = write_pixels_1BPP_UB_5_10},
+		{.name = "write_pixels 1BPP_UB 5 11",
+		 .tst_fn = write_pixels_1BPP_UB_5_11},
+		{.name = "write_pixels 1BPP_UB 5 12",
+		 .tst_fn = write_pixels_1BPP_UB_5_12},
+		{.name = "write_pixels 1BPP_UB 5 13",
+		 .tst_fn = write_pixels_1BPP_UB_5_13},
+		{.name = "write_pixels 1BPP_UB 5 14",
+		 .tst_fn = write_pixels_1BPP_UB_5_14},
+		{.name = "write_pixels 1BPP_UB 5 15",
+		 .tst_fn = write_pixels_1BPP_UB_5_15},
+		{.name = "write_pixels 1BPP_UB 5 16",
+		 .tst_fn = write_pixels_1BPP_UB_5_16},
+		{.name = "write_pixels 1BPP_UB 5 17",
+		 .tst_fn = write_pixels_1BPP_UB_5_17},
+		{.name = "write_pixels 1BPP_UB 5 18",
+		 .tst_fn = write_pixels_1BPP_UB_5_18},
+		{.name = "write_pixels 1BPP_UB 5 19",
+		 .tst_fn = write_pixels_1BPP_UB_5_19},
+		{.name = "write_pixels 1BPP_UB 5 20",
+		 .tst_fn = write_pixels_1BPP_UB_5_20},
+		{.name = "write_pixels 1BPP_UB 5 21",
+		 .tst_fn = write_pixels_1BPP_UB_5_21},
+		{.name = "write_pixels 1BPP_UB 5 22",
+		 .tst_fn = write_pixels_1BPP_UB_5_22},
+		{.name = "write_pixels 1BPP_UB 5 23",
+		 .tst_fn = write_pixels_1BPP_UB_5_23},
+		{.name = "write_pixels 1BPP_UB 5 24",
+		 .tst_fn = write_pixels_1BPP_UB_5_24},
+		{.name = "write_pixels 1BPP_UB 5 25",
+		 .tst_fn = write_pixels_1BPP_UB_5_25},
+		{.name = "write_pixels 1BPP_UB 5 26",
+		 .tst_fn = write_pixels_1BPP_UB_5_26},
+		{.name = "write_pixels 1BPP_UB 5 27",
+		 .tst_fn = write_pixels_1BPP_UB_5_27},
+		{.name = "write_pixels 1BPP_UB 5 28",
+		 .tst_fn = write_pixels_1BPP_UB_5_28},
+		{.name = "write_pixels 1BPP_UB 5 29",
+		 .tst_fn = write_pixels_1BPP_UB_5_29},
+		{.name = "write_pixels 1BPP_UB 5 30",
+		 .tst_fn = write_pixels_1BPP_UB_5_30},
+		{.name = "write_pixels 1BPP_UB 5 31",
+		 .tst_fn = write_pixels_1BPP_UB_5_31},
+		{.name = "write_pixels 1BPP_UB 6 0",
+		 .tst_fn = write_pixels_1BPP_UB_6_0},
+		{.name = "write_pixels 1BPP_UB 6 1",
+		 .tst_fn = write_pixels_1BPP_UB_6_1},
+		{.name = "write_pixels 1BPP_UB 6 2",
+		 .tst_fn = write_pixels_1BPP_UB_6_2},
+		{.name = "write_pixels 1BPP_UB 6 3",
+		 .tst_fn = write_pixels_1BPP_UB_6_3},
+		{.name = "write_pixels 1BPP_UB 6 4",
+		 .tst_fn = write_pixels_1BPP_UB_6_4},
+		{.name = "write_pixels 1BPP_UB 6 5",
+		 .tst_fn = write_pixels_1BPP_UB_6_5},
+		{.name = "write_pixels 1BPP_UB 6 6",
+		 .tst_fn = write_pixels_1BPP_UB_6_6},
+		{.name = "write_pixels 1BPP_UB 6 7",
+		 .tst_fn = write_pixels_1BPP_UB_6_7},
+		{.name = "write_pixels 1BPP_UB 6 8",
+		 .tst_fn = write_pixels_1BPP_UB_6_8},
+		{.name = "write_pixels 1BPP_UB 6 9",
+		 .tst_fn = write_pixels_1BPP_UB_6_9},
+		{.name = "write_pixels 1BPP_UB 6 10",
+		 .tst_fn = write_pixels_1BPP_UB_6_10},
+		{.name = "write_pixels 1BPP_UB 6 11",
+		 .tst_fn = write_pixels_1BPP_UB_6_11},
+		{.name = "write_pixels 1BPP_UB 6 12",
+		 .tst_fn = write_pixels_1BPP_UB_6_12},
+		{.name = "write_pixels 1BPP_UB 6 13",
+		 .tst_fn = write_pixels_1BPP_UB_6_13},
+		{.name = "write_pixels 1BPP_UB 6 14",
+		 .tst_fn = write_pixels_1BPP_UB_6_14},
+		{.name = "write_pixels 1BPP_UB 6 15",
+		 .tst_fn = write_pixels_1BPP_UB_6_15},
+		{.name = "write_pixels 1BPP_UB 6 16",
+		 .tst_fn = write_pixels_1BPP_UB_6_16},
+		{.name = "write_pixels 1BPP_UB 6 17",
+		 .tst_fn = write_pixels_1BPP_UB_6_17},
+		{.name = "write_pixels 1BPP_UB 6 18",
+		 .tst_fn = write_pixels_1BPP_UB_6_18},
+		{.name = "write_pixels 1BPP_UB 6 19",
+		 .tst_fn = write_pixels_1BPP_UB_6_19},
+		{.name = "write_pixels 1BPP_UB 6 20",
+		 .tst_fn = write_pixels_1BPP_UB_6_20},
+		{.name = "write_pixels 1BPP_UB 6 21",
+		 .tst_fn = write_pixels_1BPP_UB_6_21},
+		{.name = "write_pixels 1BPP_UB 6 22",
+		 .tst_fn = write_pixels_1BPP_UB_6_22},
+		{.name = "write_pixels 1BPP_UB 6 23",
+		 .tst_fn = write_pixels_1BPP_UB_6_23},
+		{.name = "write_pixels 1BPP_UB 6 24",
+		 .tst_fn = write_pixels_1BPP_UB_6_24},
+		{.name = "write_pixels 1BPP_UB 6 25",
+		 .tst_fn = write_pixels_1BPP_UB_6_25},
+		{.name = "write_pixels 1BPP_UB 6 26",
+		 .tst_fn = write_pixels_1BPP_UB_6_26},
+		{.name = "write_pixels 1BPP_UB 6 27",
+		 .tst_fn = write_pixels_1BPP_UB_6_27},
+		{.name = "write_pixels 1BPP_UB 6 28",
+		 .tst_fn = write_pixels_1BPP_UB_6_28},
+		{.name = "write_pixels 1BPP_UB 6 29",
+		 .tst_fn = write_pixels_1BPP_UB_6_29},
+		{.name = "write_pixels 1BPP_UB 6 30",
+		 .tst_fn = write_pixels_1BPP_UB_6_30},
+		{.name = "write_pixels 1BPP_UB 6 31",
+		 .tst_fn = write_pixels_1BPP_UB_6_31},
+		{.name = "write_pixels 1BPP_UB 7 0",
+		 .tst_fn = write_pixels_1BPP_UB_7_0},
+		{.name = "write_pixels 1BPP_UB 7 1",
+		 .tst_fn = write_pixels_1BPP_UB_7_1},
+		{.name = "write_pixels 1BPP_UB 7 2",
+		 .tst_fn = write_pixels_1BPP_UB_7_2},
+		{.name = "write_pixels 1BPP_UB 7 3",
+		 .tst_fn = write_pixels_1BPP_UB_7_3},
+		{.name = "write_pixels 1BPP_UB 7 4",
+		 .tst_fn = write_pixels_1BPP_UB_7_4},
+		{.name = "write_pixels 1BPP_UB 7 5",
+		 .tst_fn = write_pixels_1BPP_UB_7_5},
+		{.name = "write_pixels 1BPP_UB 7 6",
+		 .tst_fn = write_pixels_1BPP_UB_7_6},
+		{.name = "write_pixels 1BPP_UB 7 7",
+		 .tst_fn = write_pixels_1BPP_UB_7_7},
+		{.name = "write_pixels 1BPP_UB 7 8",
+		 .tst_fn = write_pixels_1BPP_UB_7_8},
+		{.name = "write_pixels 1BPP_UB 7 9",
+		 .tst_fn = write_pixels_1BPP_UB_7_9},
+		{.name = "write_pixels 1BPP_UB 7 10",
+		 .tst_fn = write_pixels_1BPP_UB_7_10},
+		{.name = "write_pixels 1BPP_UB 7 11",
+		 .tst_fn = write_pixels_1BPP_UB_7_11},
+		{.name = "write_pixels 1BPP_UB 7 12",
+		 .tst_fn = write_pixels_1BPP_UB_7_12},
+		{.name = "write_pixels 1BPP_UB 7 13",
+		 .tst_fn = write_pixels_1BPP_UB_7_13},
+		{.name = "write_pixels 1BPP_UB 7 14",
+		 .tst_fn = write_pixels_1BPP_UB_7_14},
+		{.name = "write_pixels 1BPP_UB 7 15",
+		 .tst_fn = write_pixels_1BPP_UB_7_15},
+		{.name = "write_pixels 1BPP_UB 7 16",
+		 .tst_fn = write_pixels_1BPP_UB_7_16},
+		{.name = "write_pixels 1BPP_UB 7 17",
+		 .tst_fn = write_pixels_1BPP_UB_7_17},
+		{.name = "write_pixels 1BPP_UB 7 18",
+		 .tst_fn = write_pixels_1BPP_UB_7_18},
+		{.name = "write_pixels 1BPP_UB 7 19",
+		 .tst_fn = write_pixels_1BPP_UB_7_19},
+		{.name = "write_pixels 1BPP_UB 7 20",
+		 .tst_fn = write_pixels_1BPP_UB_7_20},
+		{.name = "write_pixels 1BPP_UB 7 21",
+		 .tst_fn = write_pixels_1BPP_UB_7_21},
+		{.name = "write_pixels 1BPP_UB 7 22",
+		 .tst_fn = write_pixels_1BPP_UB_7_22},
+		{.name = "write_pixels 1BPP_UB 7 23",
+		 .tst_fn = write_pixels_1BPP_UB_7_23},
+		{.name = "write_pixels 1BPP_UB 7 24",
+		 .tst_fn = write_pixels_1BPP_UB_7_24},
+		{.name = "write_pixels 1BPP_UB 7 25",
+		 .tst_fn = write_pixels_1BPP_UB_7_25},
+		{.name = "write_pixels 1BPP_UB 7 26",
+		 .tst_fn = write_pixels_1BPP_UB_7_26},
+		{.name = "write_pixels 1BPP_UB 7 27",
+		 .tst_fn = write_pixels_1BPP_UB_7_27},
+		{.name = "write_pixels 1BPP_UB 7 28",
+		 .tst_fn = write_pixels_1BPP_UB_7_28},
+		{.name = "write_pixels 1BPP_UB 7 29",
+		 .tst_fn = write_pixels_1BPP_UB_7_29},
+		{.name = "write_pixels 1BPP_UB 7 30",
+		 .tst_fn = write_pixels_1BPP_UB_7_30},
+		{.name = "write_pixels 1BPP_UB 7 31",
+		 .tst_fn = write_pixels_1BPP_UB_7_31},
+		{}
+	}
+};
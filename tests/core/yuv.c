@@ -0,0 +1,311 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+#include <core/gp_yuv.h>
+#include "tst_test.h"
+
+/* Odd sizes so that the last chroma sample is shared by a single pixel */
+#define W 37
+#define H 13
+
+struct yuv_test {
+	enum gp_yuv_fmt fmt;
+	enum gp_yuv_flags flags;
+	gp_pixel_type pixel_type;
+	/* Stride padding in bytes */
+	size_t pad;
+};
+
+struct samples {
+	uint8_t y[H][W];
+	uint8_t u[(H+1)/2][(W+1)/2];
+	uint8_t v[(H+1)/2][(W+1)/2];
+};
+
+static void gen_samples(struct samples *s)
+{
+	unsigned int x, y;
+
+	srand(42);
+
+	for (y = 0; y < H; y++) {
+		for (x = 0; x < W; x++)
+			s->y[y][x] = rand();
+	}
+
+	for (y = 0; y < (H+1)/2; y++) {
+		for (x = 0; x < (W+1)/2; x++) {
+			s->u[y][x] = rand();
+			s->v[y][x] = rand();
+		}
+	}
+}
+
+/* Packs samples into a buffer, 4:2:2 formats use every other chroma row */
+static void pack(const struct samples *s, enum gp_yuv_fmt fmt,
+                 uint8_t *buf, size_t stride)
+{
+	size_t c_stride = (stride + 1) / 2;
+	uint8_t *planes = buf + H * stride;
+	unsigned int x, y;
+
+	for (y = 0; y < H; y++) {
+		uint8_t *line = buf + y * stride;
+
+		for (x = 0; x < W; x++) {
+			uint8_t u = s->u[y/2][x/2];
+			uint8_t v = s->v[y/2][x/2];
+
+			switch (fmt) {
+			case GP_YUV_YUYV:
+				line[2*x] = s->y[y][x];
+				line[4*(x/2) + 1] = u;
+				line[4*(x/2) + 3] = v;
+			break;
+			case GP_YUV_UYVY:
+				line[2*x + 1] = s->y[y][x];
+				line[4*(x/2)] = u;
+				line[4*(x/2) + 2] = v;
+			break;
+			case GP_YUV_NV12:
+				line[x] = s->y[y][x];
+				planes[(y/2) * stride + 2*(x/2)] = u;
+				planes[(y/2) * stride + 2*(x/2) + 1] = v;
+			break;
+			case GP_YUV_I420:
+				line[x] = s->y[y][x];
+				planes[(y/2) * c_stride + x/2] = u;
+				planes[((H+1)/2 + y/2) * c_stride + x/2] = v;
+			break;
+			}
+		}
+	}
+}
+
+static int ref_clamp(double val)
+{
+	int ret = val + 0.5;
+
+	return GP_MAX(0, GP_MIN(255, ret));
+}
+
+static gp_pixel ref_pixel(uint8_t Y, uint8_t U, uint8_t V, enum gp_yuv_flags flags)
+{
+	double kr = 0.299, kb = 0.114;
+	double y = Y, u = U - 128.0, v = V - 128.0;
+
+	if (flags & GP_YUV_BT709) {
+		kr = 0.2126;
+		kb = 0.0722;
+	}
+
+	if (!(flags & GP_YUV_FULL_RANGE)) {
+		y = (y - 16) * 255 / 219;
+		u = u * 255 / 224;
+		v = v * 255 / 224;
+	}
+
+	double r = y + 2 * (1 - kr) * v;
+	double b = y + 2 * (1 - kb) * u;
+	double g = (y - kr * r - kb * b) / (1 - kr - kb);
+
+	return (ref_clamp(r) << 16) | (ref_clamp(g) << 8) | ref_clamp(b);
+}
+
+static int chan_diff(gp_pixel a, gp_pixel b, unsigned int shift)
+{
+	return abs((int)((a >> shift) & 0xff) - (int)((b >> shift) & 0xff));
+}
+
+static int yuv_convert(struct yuv_test *test)
+{
+	struct samples s;
+	size_t stride, size;
+	uint8_t *buf;
+	gp_pixmap *dst;
+	unsigned int x, y;
+	int ret = TST_PASSED;
+
+	if (test->fmt == GP_YUV_NV12 || test->fmt == GP_YUV_I420)
+		stride = ((W + 1) & ~1) + test->pad;
+	else
+		stride = 4 * ((W + 1) / 2) + test->pad;
+
+	size = gp_yuv_buf_size(test->fmt, W, H, stride);
+
+	buf = calloc(1, size);
+	dst = gp_pixmap_alloc(W, H, test->pixel_type);
+
+	if (!buf || !dst) {
+		tst_msg("Allocation failed");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gen_samples(&s);
+	pack(&s, test->fmt, buf, stride);
+
+	if (gp_yuv_convert(buf, test->pad ? stride : 0, test->fmt, test->flags, dst)) {
+		tst_msg("Conversion failed: %s", strerror(errno));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	for (y = 0; y < H; y++) {
+		for (x = 0; x < W; x++) {
+			gp_pixel exp = ref_pixel(s.y[y][x], s.u[y/2][x/2],
+			                         s.v[y/2][x/2], test->flags);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			if (test->pixel_type == GP_PIXEL_BGR888)
+				p = ((p & 0xff) << 16) | (p & 0xff00) | ((p >> 16) & 0xff);
+
+			if (chan_diff(p, exp, 0) > 1 || chan_diff(p, exp, 8) > 1 ||
+			    chan_diff(p, exp, 16) > 1 || (p & 0xff000000)) {
+				tst_msg("Pixel %ux%u %06x expected %06x",
+				        x, y, p, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	free(buf);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+static int yuv_convert_threads(struct yuv_test *test)
+{
+	int ret;
+
+	gp_nr_threads_set(4);
+	ret = yuv_convert(test);
+	gp_nr_threads_set(1);
+
+	return ret;
+}
+
+static int yuv_limited_range(void)
+{
+	/* Black, white and gray in a YUYV limited range */
+	static const uint8_t buf[] = {
+		16, 128, 235, 128,
+		126, 128, 126, 128,
+	};
+	gp_pixmap *dst = gp_pixmap_alloc(2, 2, GP_PIXEL_RGB888);
+	int ret = TST_PASSED;
+
+	if (!dst)
+		return TST_UNTESTED;
+
+	gp_yuv_convert(buf, 4, GP_YUV_YUYV, GP_YUV_BT601, dst);
+
+	if (gp_getpixel_raw(dst, 0, 0) != 0x000000 ||
+	    gp_getpixel_raw(dst, 1, 0) != 0xffffff ||
+	    gp_getpixel_raw(dst, 0, 1) != 0x808080) {
+		tst_msg("Wrong pixels %06x %06x %06x",
+		        gp_getpixel_raw(dst, 0, 0), gp_getpixel_raw(dst, 1, 0),
+		        gp_getpixel_raw(dst, 0, 1));
+		ret = TST_FAILED;
+	}
+
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+static int yuv_invalid_pixel_type(void)
+{
+	static const uint8_t buf[4];
+	gp_pixmap *dst = gp_pixmap_alloc(2, 1, GP_PIXEL_G8);
+	int ret = TST_PASSED;
+
+	if (!dst)
+		return TST_UNTESTED;
+
+	if (!gp_yuv_convert(buf, 0, GP_YUV_YUYV, GP_YUV_BT601, dst)) {
+		tst_msg("Conversion to G8 succeeded");
+		ret = TST_FAILED;
+	} else if (errno != EINVAL) {
+		tst_msg("Wrong errno %s", strerror(errno));
+		ret = TST_FAILED;
+	}
+
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+static struct yuv_test yuyv_601 = {GP_YUV_YUYV, GP_YUV_BT601, GP_PIXEL_RGB888, 0};
+static struct yuv_test uyvy_709 = {GP_YUV_UYVY, GP_YUV_BT709, GP_PIXEL_RGB888, 0};
+static struct yuv_test nv12_601_full = {GP_YUV_NV12, GP_YUV_BT601 | GP_YUV_FULL_RANGE, GP_PIXEL_RGB888, 0};
+static struct yuv_test i420_709_full = {GP_YUV_I420, GP_YUV_BT709 | GP_YUV_FULL_RANGE, GP_PIXEL_RGB888, 0};
+static struct yuv_test yuyv_bgr = {GP_YUV_YUYV, GP_YUV_BT601, GP_PIXEL_BGR888, 0};
+static struct yuv_test nv12_xrgb = {GP_YUV_NV12, GP_YUV_BT709, GP_PIXEL_xRGB8888, 0};
+static struct yuv_test i420_stride = {GP_YUV_I420, GP_YUV_BT601, GP_PIXEL_RGB888, 10};
+static struct yuv_test uyvy_stride = {GP_YUV_UYVY, GP_YUV_BT601 | GP_YUV_FULL_RANGE, GP_PIXEL_xRGB8888, 8};
+
+const struct tst_suite tst_suite = {
+	.suite_name = "YUV testsuite",
+	.tests = {
+		{.name = "YUYV BT.601 limited",
+		 .tst_fn = yuv_convert,
+		 .data = &yuyv_601,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "UYVY BT.709 limited",
+		 .tst_fn = yuv_convert,
+		 .data = &uyvy_709,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "NV12 BT.601 full",
+		 .tst_fn = yuv_convert,
+		 .data = &nv12_601_full,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "I420 BT.709 full",
+		 .tst_fn = yuv_convert,
+		 .data = &i420_709_full,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "YUYV to BGR888",
+		 .tst_fn = yuv_convert,
+		 .data = &yuyv_bgr,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "NV12 to xRGB8888",
+		 .tst_fn = yuv_convert,
+		 .data = &nv12_xrgb,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "I420 with stride",
+		 .tst_fn = yuv_convert,
+		 .data = &i420_stride,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "UYVY with stride",
+		 .tst_fn = yuv_convert,
+		 .data = &uyvy_stride,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "NV12 threads",
+		 .tst_fn = yuv_convert_threads,
+		 .data = &nv12_601_full},
+
+		{.name = "YUYV limited range",
+		 .tst_fn = yuv_limited_range},
+
+		{.name = "Invalid pixel type",
+		 .tst_fn = yuv_invalid_pixel_type},
+
+		{.name = NULL},
+	}
+};
@@ -65,7 +65,7 @@ int main(void)
 	gp_line(pixmap, 0, 0, pixmap->w, pixmap->h, black);
 	gp_line(pixmap, 0, pixmap->h, pixmap->w, 0, black);
 	gp_text(pixmap, NULL,
-	        (pixmap->w - gp_text_width(NULL, text))/2,
+	        (pixmap->w - gp_text_wbbox(NULL, text))/2,
 		16, GP_ALIGN_RIGHT|GP_VALIGN_BELOW, black, gray, text);
 
 
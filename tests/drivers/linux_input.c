@@ -11,14 +11,20 @@
 
 #include <gfxprim.h>
 
-#include <input/gp_input_driver_linux.h>
+#include <backends/gp_linux_input.h>
+
+static gp_ev_queue event_queue;
+
+static gp_backend backend = {
+	.name = "Linux input",
+	.event_queue = &event_queue,
+};
 
 int main(int argc, char *argv[])
 {
-	gp_input_linux *drv;
-	gp_ev_queue event_queue;
+	gp_event *ev;
 
-	gp_ev_queue_init(&event_queue, 640, 480, 0);
+	gp_ev_queue_init(&event_queue, 640, 480, 0, 0);
 
 	gp_set_debug_level(2);
 
@@ -27,22 +33,16 @@ int main(int argc, char *argv[])
 		return 1;
 	}
 
-	drv = gp_input_linux_open(argv[1]);
-
-	if (!drv) {
+	if (gp_linux_input_new(argv[1], &backend)) {
 		printf("Failed to open input device\n");
 		return 1;
 	}
 
 	for (;;) {
-		while (gp_input_linux_read(drv, &event_queue) >= 1);
-
-		gp_event *ev;
+		gp_poll_wait(&backend.fds, -1);
 
 		while ((ev = gp_ev_queue_get(&event_queue)))
-			gp_event_dump(ev);
-
-		usleep(1000);
+			gp_ev_dump(ev);
 	}
 
 	return 0;
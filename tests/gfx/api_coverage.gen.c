@@ -0,0 +1,6805 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * api_coverage.gen.c
+ *
+ * GENERATED on 2026 10 19 15:09:26 from api_coverage.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * The purpose of this test is to exercise as much codepaths as possible
+ * without checking for result corectness.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+
+#include <core/gp_pixmap.h>
+#include <gfx/gp_gfx.h>
+
+#include "common.h"
+#include "tst_test.h"
+
+static int gfx_fill_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int pixel = 2;
+
+	gp_fill(in, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_hline_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int x0 = 2;
+	int x1 = 2;
+	int y = 2;
+	int pixel = 2;
+
+	gp_hline(in, x0, x1, y, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_vline_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int x = 2;
+	int y0 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_vline(in, x, y0, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_line_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_line(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_circle_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_circle_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int xcenter = 2;
+	int ycenter = 2;
+	int r = 2;
+	int pixel = 2;
+
+	gp_fill_circle(in, xcenter, ycenter, r, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ellipse_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ellipse_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int xcenter = 2;
+	int ycenter = 2;
+	int a = 2;
+	int b = 2;
+	int pixel = 2;
+
+	gp_fill_ellipse(in, xcenter, ycenter, a, b, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_ring_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_ring_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int xc = 2;
+	int yc = 2;
+	int r1 = 2;
+	int r2 = 2;
+	int pixel = 2;
+
+	gp_fill_ring(in, xc, yc, r1, r2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_rect_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_rect_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int pixel = 2;
+
+	gp_fill_rect(in, x0, y0, x1, y1, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_triangle_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_triangle_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int pixel = 2;
+
+	gp_fill_triangle(in, x0, y0, x1, y1, x2, y2, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_tetragon_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_RGB101010(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB101010);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_xRGB8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_xRGB8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_RGBA8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGBA8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_RGB888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_BGR888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_BGR888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_RGB555(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB555);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_RGB565(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB565);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_RGB666(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB666);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_RGB332(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_RGB332);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_CMYK8888(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_CMYK8888);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_P2(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P2);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_P4(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P4);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_P8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_P8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_G1_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_G2_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_G4_DB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_DB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_G1_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G1_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_G2_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G2_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_G4_UB(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G4_UB);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_G8(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G8);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_GA88(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_GA88);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int gfx_fill_tetragon_G16(void)
+{
+	gp_pixmap *in = pixmap_alloc_canary(331, 331, GP_PIXEL_G16);
+	int x0 = 2;
+	int y0 = 2;
+	int x1 = 2;
+	int y1 = 2;
+	int x2 = 2;
+	int y2 = 2;
+	int x3 = 2;
+	int y3 = 2;
+	int pixel = 2;
+
+	gp_fill_tetragon(in, x0, y0, x1, y1, x2, y2, x3, y3, pixel);
+
+	if (check_canary(in))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Gfx API Coverage",
+	.tests = {
+		{.name = "fill RGB101010",
+		 .tst_fn = gfx_fill_RGB101010},
+		{.name = "fill xRGB8888",
+		 .tst_fn = gfx_fill_xRGB8888},
+		{.name = "fill RGBA8888",
+		 .tst_fn = gfx_fill_RGBA8888},
+		{.name = "fill RGB888",
+		 .tst_fn = gfx_fill_RGB888},
+		{.name = "fill BGR888",
+		 .tst_fn = gfx_fill_BGR888},
+		{.name = "fill RGB555",
+		 .tst_fn = gfx_fill_RGB555},
+		{.name = "fill RGB565",
+		 .tst_fn = gfx_fill_RGB565},
+		{.name = "fill RGB666",
+		 .tst_fn = gfx_fill_RGB666},
+		{.name = "fill RGB332",
+		 .tst_fn = gfx_fill_RGB332},
+		{.name = "fill CMYK8888",
+		 .tst_fn = gfx_fill_CMYK8888},
+		{.name = "fill P2",
+		 .tst_fn = gfx_fill_P2},
+		{.name = "fill P4",
+		 .tst_fn = gfx_fill_P4},
+		{.name = "fill P8",
+		 .tst_fn = gfx_fill_P8},
+		{.name = "fill G1_DB",
+		 .tst_fn = gfx_fill_G1_DB},
+		{.name = "fill G2_DB",
+		 .tst_fn = gfx_fill_G2_DB},
+		{.name = "fill G4_DB",
+		 .tst_fn = gfx_fill_G4_DB},
+		{.name = "fill G1_UB",
+		 .tst_fn = gfx_fill_G1_UB},
+		{.name = "fill G2_UB",
+		 .tst_fn = gfx_fill_G2_UB},
+		{.name = "fill G4_UB",
+		 .tst_fn = gfx_fill_G4_UB},
+		{.name = "fill G8",
+		 .tst_fn = gfx_fill_G8},
+		{.name = "fill GA88",
+		 .tst_fn = gfx_fill_GA88},
+		{.name = "fill G16",
+		 .tst_fn = gfx_fill_G16},
+		{.name = "hline RGB101010",
+		 .tst_fn = gfx_hline_RGB101010},
+		{.name = "hline xRGB8888",
+		 .tst_fn = gfx_hline_xRGB8888},
+		{.name = "hline RGBA8888",
+		 .tst_fn = gfx_hline_RGBA8888},
+		{.name = "hline RGB888",
+		 .tst_fn = gfx_hline_RGB888},
+		{.name = "hline BGR888",
+		 .tst_fn = gfx_hline_BGR888},
+		{.name = "hline RGB555",
+		 .tst_fn = gfx_hline_RGB555},
+		{.name = "hline RGB565",
+		 .tst_fn = gfx_hline_RGB565},
+		{.name = "hline RGB666",
+		 .tst_fn = gfx_hline_RGB666},
+		{.name = "hline RGB332",
+		 .tst_fn = gfx_hline_RGB332},
+		{.name = "hline CMYK8888",
+		 .tst_fn = gfx_hline_CMYK8888},
+		{.name = "hline P2",
+		 .tst_fn = gfx_hline_P2},
+		{.name = "hline P4",
+		 .tst_fn = gfx_hline_P4},
+		{.name = "hline P8",
+		 .tst_fn = gfx_hline_P8},
+		{.name = "hline G1_DB",
+		 .tst_fn = gfx_hline_G1_DB},
+		{.name = "hline G2_DB",
+		 .tst_fn = gfx_hline_G2_DB},
+		{.name = "hline G4_DB",
+		 .tst_fn = gfx_hline_G4_DB},
+		{.name = "hline G1_UB",
+		 .tst_fn = gfx_hline_G1_UB},
+		{.name = "hline G2_UB",
+		 .tst_fn = gfx_hline_G2_UB},
+		{.name = "hline G4_UB",
+		 .tst_fn = gfx_hline_G4_UB},
+		{.name = "hline G8",
+		 .tst_fn = gfx_hline_G8},
+		{.name = "hline GA88",
+		 .tst_fn = gfx_hline_GA88},
+		{.name = "hline G16",
+		 .tst_fn = gfx_hline_G16},
+		{.name = "vline RGB101010",
+		 .tst_fn = gfx_vline_RGB101010},
+		{.name = "vline xRGB8888",
+		 .tst_fn = gfx_vline_xRGB8888},
+		{.name = "vline RGBA8888",
+		 .tst_fn = gfx_vline_RGBA8888},
+		{.name = "vline RGB888",
+		 .tst_fn = gfx_vline_RGB888},
+		{.name = "vline BGR888",
+		 .tst_fn = gfx_vline_BGR888},
+		{.name = "vline RGB555",
+		 .tst_fn = gfx_vline_RGB555},
+		{.name = "vline RGB565",
+		 .tst_fn = gfx_vline_RGB565},
+		{.name = "vline RGB666",
+		 .tst_fn = gfx_vline_RGB666},
+		{.name = "vline RGB332",
+		 .tst_fn = gfx_vline_RGB332},
+		{.name = "vline CMYK8888",
+		 .tst_fn = gfx_vline_CMYK8888},
+		{.name = "vline P2",
+		 .tst_fn = gfx_vline_P2},
+		{.name = "vline P4",
+		 .tst_fn = gfx_vline_P4},
+		{.name = "vline P8",
+		 .tst_fn = gfx_vline_P8},
+		{.name = "vline G1_DB",
+		 .tst_fn = gfx_vline_G1_DB},
+		{.name = "vline G2_DB",
+		 .tst_fn = gfx_vline_G2_DB},
+		{.name = "vline G4_DB",
+		 .tst_fn = gfx_vline_G4_DB},
+		{.name = "vline G1_UB",
+		 .tst_fn = gfx_vline_G1_UB},
+		{.name = "vline G2_UB",
+		 .tst_fn = gfx_vline_G2_UB},
+		{.name = "vline G4_UB",
+		 .tst_fn = gfx_vline_G4_UB},
+		{.name = "vline G8",
+		 .tst_fn = gfx_vline_G8},
+		{.name = "vline GA88",
+		 .tst_fn = gfx_vline_GA88},
+		{.name = "vline G16",
+		 .tst_fn = gfx_vline_G16},
+		{.name = "line RGB101010",
+		 .tst_fn = gfx_line_RGB101010},
+		{.name = "line xRGB8888",
+		 .tst_fn = gfx_line_xRGB8888},
+		{.name = "line RGBA8888",
+		 .tst_fn = gfx_line_RGBA8888},
+		{.name = "line RGB888",
+		 .tst_fn = gfx_line_RGB888},
+		{.name = "line BGR888",
+		 .tst_fn = gfx_line_BGR888},
+		{.name = "line RGB555",
+		 .tst_fn = gfx_line_RGB555},
+		{.name = "line RGB565",
+		 .tst_fn = gfx_line_RGB565},
+		{.name = "line RGB666",
+		 .tst_fn = gfx_line_RGB666},
+		{.name = "line RGB332",
+		 .tst_fn = gfx_line_RGB332},
+		{.name = "line CMYK8888",
+		 .tst_fn = gfx_line_CMYK8888},
+		{.name = "line P2",
+		 .tst_fn = gfx_line_P2},
+		{.name = "line P4",
+		 .tst_fn = gfx_line_P4},
+		{.name = "line P8",
+		 .tst_fn = gfx_line_P8},
+		{.name = "line G1_DB",
+		 .tst_fn = gfx_line_G1_DB},
+		{.name = "line G2_DB",
+		 .tst_fn = gfx_line_G2_DB},
+		{.name = "line G4_DB",
+		 .tst_fn = gfx_line_G4_DB},
+		{.name = "line G1_UB",
+		 .tst_fn = gfx_line_G1_UB},
+		{.name = "line G2_UB",
+		 .tst_fn = gfx_line_G2_UB},
+		{.name = "line G4_UB",
+		 .tst_fn = gfx_line_G4_UB},
+		{.name = "line G8",
+		 .tst_fn = gfx_line_G8},
+		{.name = "line GA88",
+		 .tst_fn = gfx_line_GA88},
+		{.name = "line G16",
+		 .tst_fn = gfx_line_G16},
+		{.name = "circle RGB101010",
+		 .tst_fn = gfx_circle_RGB101010},
+		{.name = "circle xRGB8888",
+		 .tst_fn = gfx_circle_xRGB8888},
+		{.name = "circle RGBA8888",
+		 .tst_fn = gfx_circle_RGBA8888},
+		{.name = "circle RGB888",
+		 .tst_fn = gfx_circle_RGB888},
+		{.name = "circle BGR888",
+		 .tst_fn = gfx_circle_BGR888},
+		{.name = "circle RGB555",
+		 .tst_fn = gfx_circle_RGB555},
+		{.name = "circle RGB565",
+		 .tst_fn = gfx_circle_RGB565},
+		{.name = "circle RGB666",
+		 .tst_fn = gfx_circle_RGB666},
+		{.name = "circle RGB332",
+		 .tst_fn = gfx_circle_RGB332},
+		{.name = "circle CMYK8888",
+		 .tst_fn = gfx_circle_CMYK8888},
+		{.name = "circle P2",
+		 .tst_fn = gfx_circle_P2},
+		{.name = "circle P4",
+		 .tst_fn = gfx_circle_P4},
+		{.name = "circle P8",
+		 .tst_fn = gfx_circle_P8},
+		{.name = "circle G1_DB",
+		 .tst_fn = gfx_circle_G1_DB},
+		{.name = "circle G2_DB",
+		 .tst_fn = gfx_circle_G2_DB},
+		{.name = "circle G4_DB",
+		 .tst_fn = gfx_circle_G4_DB},
+		{.name = "circle G1_UB",
+		 .tst_fn = gfx_circle_G1_UB},
+		{.name = "circle G2_UB",
+		 .tst_fn = gfx_circle_G2_UB},
+		{.name = "circle G4_UB",
+		 .tst_fn = gfx_circle_G4_UB},
+		{.name = "circle G8",
+		 .tst_fn = gfx_circle_G8},
+		{.name = "circle GA88",
+		 .tst_fn = gfx_circle_GA88},
+		{.name = "circle G16",
+		 .tst_fn = gfx_circle_G16},
+		{.name = "fill_circle RGB101010",
+		 .tst_fn = gfx_fill_circle_RGB101010},
+		{.name = "fill_circle xRGB8888",
+		 .tst_fn = gfx_fill_circle_xRGB8888},
+		{.name = "fill_circle RGBA8888",
+		 .tst_fn = gfx_fill_circle_RGBA8888},
+		{.name = "fill_circle RGB888",
+		 .tst_fn = gfx_fill_circle_RGB888},
+		{.name = "fill_circle BGR888",
+		 .tst_fn = gfx_fill_circle_BGR888},
+		{.name = "fill_circle RGB555",
+		 .tst_fn = gfx_fill_circle_RGB555},
+		{.name = "fill_circle RGB565",
+		 .tst_fn = gfx_fill_circle_RGB565},
+		{.name = "fill_circle RGB666",
+		 .tst_fn = gfx_fill_circle_RGB666},
+		{.name = "fill_circle RGB332",
+		 .tst_fn = gfx_fill_circle_RGB332},
+		{.name = "fill_circle CMYK8888",
+		 .tst_fn = gfx_fill_circle_CMYK8888},
+		{.name = "fill_circle P2",
+		 .tst_fn = gfx_fill_circle_P2},
+		{.name = "fill_circle P4",
+		 .tst_fn = gfx_fill_circle_P4},
+		{.name = "fill_circle P8",
+		 .tst_fn = gfx_fill_circle_P8},
+		{.name = "fill_circle G1_DB",
+		 .tst_fn = gfx_fill_circle_G1_DB},
+		{.name = "fill_circle G2_DB",
+		 .tst_fn = gfx_fill_circle_G2_DB},
+		{.name = "fill_circle G4_DB",
+		 .tst_fn = gfx_fill_circle_G4_DB},
+		{.name = "fill_circle G1_UB",
+		 .tst_fn = gfx_fill_circle_G1_UB},
+		{.name = "fill_circle G2_UB",
+		 .tst_fn = gfx_fill_circle_G2_UB},
+		{.name = "fill_circle G4_UB",
+		 .tst_fn = gfx_fill_circle_G4_UB},
+		{.name = "fill_circle G8",
+		 .tst_fn = gfx_fill_circle_G8},
+		{.name = "fill_circle GA88",
+		 .tst_fn = gfx_fill_circle_GA88},
+		{.name = "fill_circle G16",
+		 .tst_fn = gfx_fill_circle_G16},
+		{.name = "ellipse RGB101010",
+		 .tst_fn = gfx_ellipse_RGB101010},
+		{.name = "ellipse xRGB8888",
+		 .tst_fn = gfx_ellipse_xRGB8888},
+		{.name = "ellipse RGBA8888",
+		 .tst_fn = gfx_ellipse_RGBA8888},
+		{.name = "ellipse RGB888",
+		 .tst_fn = gfx_ellipse_RGB888},
+		{.name = "ellipse BGR888",
+		 .tst_fn = gfx_ellipse_BGR888},
+		{.name = "ellipse RGB555",
+		 .tst_fn = gfx_ellipse_RGB555},
+		{.name = "ellipse RGB565",
+		 .tst_fn = gfx_ellipse_RGB565},
+		{.name = "ellipse RGB666",
+		 .tst_fn = gfx_ellipse_RGB666},
+		{.name = "ellipse RGB332",
+		 .tst_fn = gfx_ellipse_RGB332},
+		{.name = "ellipse CMYK8888",
+		 .tst_fn = gfx_ellipse_CMYK8888},
+		{.name = "ellipse P2",
+		 .tst_fn = gfx_ellipse_P2},
+		{.name = "ellipse P4",
+		 .tst_fn = gfx_ellipse_P4},
+		{.name = "ellipse P8",
+		 .tst_fn = gfx_ellipse_P8},
+		{.name = "ellipse G1_DB",
+		 .tst_fn = gfx_ellipse_G1_DB},
+		{.name = "ellipse G2_DB",
+		 .tst_fn = gfx_ellipse_G2_DB},
+		{.name = "ellipse G4_DB",
+		 .tst_fn = gfx_ellipse_G4_DB},
+		{.name = "ellipse G1_UB",
+		 .tst_fn = gfx_ellipse_G1_UB},
+		{.name = "ellipse G2_UB",
+		 .tst_fn = gfx_ellipse_G2_UB},
+		{.name = "ellipse G4_UB",
+		 .tst_fn = gfx_ellipse_G4_UB},
+		{.name = "ellipse G8",
+		 .tst_fn = gfx_ellipse_G8},
+		{.name = "ellipse GA88",
+		 .tst_fn = gfx_ellipse_GA88},
+		{.name = "ellipse G16",
+		 .tst_fn = gfx_ellipse_G16},
+		{.name = "fill_ellipse RGB101010",
+		 .tst_fn = gfx_fill_ellipse_RGB101010},
+		{.name = "fill_ellipse xRGB8888",
+		 .tst_fn = gfx_fill_ellipse_xRGB8888},
+		{.name = "fill_ellipse RGBA8888",
+		 .tst_fn = gfx_fill_ellipse_RGBA8888},
+		{.name = "fill_ellipse RGB888",
+		 .tst_fn = gfx_fill_ellipse_RGB888},
+		{.name = "fill_ellipse BGR888",
+		 .tst_fn = gfx_fill_ellipse_BGR888},
+		{.name = "fill_ellipse RGB555",
+		 .tst_fn = gfx_fill_ellipse_RGB555},
+		{.name = "fill_ellipse RGB565",
+		 .tst_fn = gfx_fill_ellipse_RGB565},
+		{.name = "fill_ellipse RGB666",
+		 .tst_fn = gfx_fill_ellipse_RGB666},
+		{.name = "fill_ellipse RGB332",
+		 .tst_fn = gfx_fill_ellipse_RGB332},
+		{.name = "fill_ellipse CMYK8888",
+		 .tst_fn = gfx_fill_ellipse_CMYK8888},
+		{.name = "fill_ellipse P2",
+		 .tst_fn = gfx_fill_ellipse_P2},
+		{.name = "fill_ellipse P4",
+		 .tst_fn = gfx_fill_ellipse_P4},
+		{.name = "fill_ellipse P8",
+		 .tst_fn = gfx_fill_ellipse_P8},
+		{.name = "fill_ellipse G1_DB",
+		 .tst_fn = gfx_fill_ellipse_G1_DB},
+		{.name = "fill_ellipse G2_DB",
+		 .tst_fn = gfx_fill_ellipse_G2_DB},
+		{.name = "fill_ellipse G4_DB",
+		 .tst_fn = gfx_fill_ellipse_G4_DB},
+		{.name = "fill_ellipse G1_UB",
+		 .tst_fn = gfx_fill_ellipse_G1_UB},
+		{.name = "fill_ellipse G2_UB",
+		 .tst_fn = gfx_fill_ellipse_G2_UB},
+		{.name = "fill_ellipse G4_UB",
+		 .tst_fn = gfx_fill_ellipse_G4_UB},
+		{.name = "fill_ellipse G8",
+		 .tst_fn = gfx_fill_ellipse_G8},
+		{.name = "fill_ellipse GA88",
+		 .tst_fn = gfx_fill_ellipse_GA88},
+		{.name = "fill_ellipse G16",
+		 .tst_fn = gfx_fill_ellipse_G16},
+		{.name = "ring RGB101010",
+		 .tst_fn = gfx_ring_RGB101010},
+		{.name = "ring xRGB8888",
+		 .tst_fn = gfx_ring_xRGB8888},
+		{.name = "ring RGBA8888",
+		 .tst_fn = gfx_ring_RGBA8888},
+		{.name = "ring RGB888",
+		 .tst_fn = gfx_ring_RGB888},
+		{.name = "ring BGR888",
+		 .tst_fn = gfx_ring_BGR888},
+		{.name = "ring RGB555",
+		 .tst_fn = gfx_ring_RGB555},
+		{.name = "ring RGB565",
+		 .tst_fn = gfx_ring_RGB565},
+		{.name = "ring RGB666",
+		 .tst_fn = gfx_ring_RGB666},
+		{.name = "ring RGB332",
+		 .tst_fn = gfx_ring_RGB332},
+		{.name = "ring CMYK8888",
+		 .tst_fn = gfx_ring_CMYK8888},
+		{.name = "ring P2",
+		 .tst_fn = gfx_ring_P2},
+		{.name = "ring P4",
+		 .tst_fn = gfx_ring_P4},
+		{.name = "ring P8",
+		 .tst_fn = gfx_ring_P8},
+		{.name = "ring G1_DB",
+		 .tst_fn = gfx_ring_G1_DB},
+		{.name = "ring G2_DB",
+		 .tst_fn = gfx_ring_G2_DB},
+		{.name = "ring G4_DB",
+		 .tst_fn = gfx_ring_G4_DB},
+		{.name = "ring G1_UB",
+		 .tst_fn = gfx_ring_G1_UB},
+		{.name = "ring G2_UB",
+		 .tst_fn = gfx_ring_G2_UB},
+		{.name = "ring G4_UB",
+		 .tst_fn = gfx_ring_G4_UB},
+		{.name = "ring G8",
+		 .tst_fn = gfx_ring_G8},
+		{.name = "ring GA88",
+		 .tst_fn = gfx_ring_GA88},
+		{.name = "ring G16",
+		 .tst_fn = gfx_ring_G16},
+		{.name = "fill_ring RGB101010",
+		 .tst_fn = gfx_fill_ring_RGB101010},
+		{.name = "fill_ring xRGB8888",
+		 .tst_fn = gfx_fill_ring_xRGB8888},
+		{.name = "fill_ring RGBA8888",
+		 .tst_fn = gfx_fill_ring_RGBA8888},
+		{.name = "fill_ring RGB888",
+		 .tst_fn = gfx_fill_ring_RGB888},
+		{.name = "fill_ring BGR888",
+		 .tst_fn = gfx_fill_ring_BGR888},
+		{.name = "fill_ring RGB555",
+		 .tst_fn = gfx_fill_ring_RGB555},
+		{.name = "fill_ring RGB565",
+		 .tst_fn = gfx_fill_ring_RGB565},
+		{.name = "fill_ring RGB666",
+		 .tst_fn = gfx_fill_ring_RGB666},
+		{.name = "fill_ring RGB332",
+		 .tst_fn = gfx_fill_ring_RGB332},
+		{.name = "fill_ring CMYK8888",
+		 .tst_fn = gfx_fill_ring_CMYK8888},
+		{.name = "fill_ring P2",
+		 .tst_fn = gfx_fill_ring_P2},
+		{.name = "fill_ring P4",
+		 .tst_fn = gfx_fill_ring_P4},
+		{.name = "fill_ring P8",
+		 .tst_fn = gfx_fill_ring_P8},
+		{.name = "fill_ring G1_DB",
+		 .tst_fn = gfx_fill_ring_G1_DB},
+		{.name = "fill_ring G2_DB",
+		 .tst_fn = gfx_fill_ring_G2_DB},
+		{.name = "fill_ring G4_DB",
+		 .tst_fn = gfx_fill_ring_G4_DB},
+		{.name = "fill_ring G1_UB",
+		 .tst_fn = gfx_fill_ring_G1_UB},
+		{.name = "fill_ring G2_UB",
+		 .tst_fn = gfx_fill_ring_G2_UB},
+		{.name = "fill_ring G4_UB",
+		 .tst_fn = gfx_fill_ring_G4_UB},
+		{.name = "fill_ring G8",
+		 .tst_fn = gfx_fill_ring_G8},
+		{.name = "fill_ring GA88",
+		 .tst_fn = gfx_fill_ring_GA88},
+		{.name = "fill_ring G16",
+		 .tst_fn = gfx_fill_ring_G16},
+		{.name = "rect RGB101010",
+		 .tst_fn = gfx_rect_RGB101010},
+		{.name = "rect xRGB8888",
+		 .tst_fn = gfx_rect_xRGB8888},
+		{.name = "rect RGBA8888",
+		 .tst_fn = gfx_rect_RGBA8888},
+		{.name = "rect RGB888",
+		 .tst_fn = gfx_rect_RGB888},
+		{.name = "rect BGR888",
+		 .tst_fn = gfx_rect_BGR888},
+		{.name = "rect RGB555",
+		 .tst_fn = gfx_rect_RGB555},
+		{.name = "rect RGB565",
+		 .tst_fn = gfx_rect_RGB565},
+		{.name = "rect RGB666",
+		 .tst_fn = gfx_rect_RGB666},
+		{.name = "rect RGB332",
+		 .tst_fn = gfx_rect_RGB332},
+		{.name = "rect CMYK8888",
+		 .tst_fn = gfx_rect_CMYK8888},
+		{.name = "rect P2",
+		 .tst_fn = gfx_rect_P2},
+		{.name = "rect P4",
+		 .tst_fn = gfx_rect_P4},
+		{.name = "rect P8",
+		 .tst_fn = gfx_rect_P8},
+		{.name = "rect G1_DB",
+		 .tst_fn = gfx_rect_G1_DB},
+		{.name = "rect G2_DB",
+		 .tst_fn = gfx_rect_G2_DB},
+		{.name = "rect G4_DB",
+		 .tst_fn = gfx_rect_G4_DB},
+		{.name = "rect G1_UB",
+		 .tst_fn = gfx_rect_G1_UB},
+		{.name = "rect G2_UB",
+		 .tst_fn = gfx_rect_G2_UB},
+		{.name = "rect G4_UB",
+		 .tst_fn = gfx_rect_G4_UB},
+		{.name = "rect G8",
+		 .tst_fn = gfx_rect_G8},
+		{.name = "rect GA88",
+		 .tst_fn = gfx_rect_GA88},
+		{.name = "rect G16",
+		 .tst_fn = gfx_rect_G16},
+		{.name = "fill_rect RGB101010",
+		 .tst_fn = gfx_fill_rect_RGB101010},
+		{.name = "fill_rect xRGB8888",
+		 .tst_fn = gfx_fill_rect_xRGB8888},
+		{.name = "fill_rect RGBA8888",
+		 .tst_fn = gfx_fill_rect_RGBA8888},
+		{.name = "fill_rect RGB888",
+		 .tst_fn = gfx_fill_rect_RGB888},
+		{.name = "fill_rect BGR888",
+		 .tst_fn = gfx_fill_rect_BGR888},
+		{.name = "fill_rect RGB555",
+		 .tst_fn = gfx_fill_rect_RGB555},
+		{.name = "fill_rect RGB565",
+		 .tst_fn = gfx_fill_rect_RGB565},
+		{.name = "fill_rect RGB666",
+		 .tst_fn = gfx_fill_rect_RGB666},
+		{.name = "fill_rect RGB332",
+		 .tst_fn = gfx_fill_rect_RGB332},
+		{.name = "fill_rect CMYK8888",
+		 .tst_fn = gfx_fill_rect_CMYK8888},
+		{.name = "fill_rect P2",
+		 .tst_fn = gfx_fill_rect_P2},
+		{.name = "fill_rect P4",
+		 .tst_fn = gfx_fill_rect_P4},
+		{.name = "fill_rect P8",
+		 .tst_fn = gfx_fill_rect_P8},
+		{.name = "fill_rect G1_DB",
+		 .tst_fn = gfx_fill_rect_G1_DB},
+		{.name = "fill_rect G2_DB",
+		 .tst_fn = gfx_fill_rect_G2_DB},
+		{.name = "fill_rect G4_DB",
+		 .tst_fn = gfx_fill_rect_G4_DB},
+		{.name = "fill_rect G1_UB",
+		 .tst_fn = gfx_fill_rect_G1_UB},
+		{.name = "fill_rect G2_UB",
+		 .tst_fn = gfx_fill_rect_G2_UB},
+		{.name = "fill_rect G4_UB",
+		 .tst_fn = gfx_fill_rect_G4_UB},
+		{.name = "fill_rect G8",
+		 .tst_fn = gfx_fill_rect_G8},
+		{.name = "fill_rect GA88",
+		 .tst_fn = gfx_fill_rect_GA88},
+		{.name = "fill_rect G16",
+		 .tst_fn = gfx_fill_rect_G16},
+		{.name = "triangle RGB101010",
+		 .tst_fn = gfx_triangle_RGB101010},
+		{.name = "triangle xRGB8888",
+		 .tst_fn = gfx_triangle_xRGB8888},
+		{.name = "triangle RGBA8888",
+		 .tst_fn = gfx_triangle_RGBA8888},
+		{.name = "triangle RGB888",
+		 .tst_fn = gfx_triangle_RGB888},
+		{.name = "triangle BGR888",
+		 .tst_fn = gfx_triangle_BGR888},
+		{.name = "triangle RGB555",
+		 .tst_fn = gfx_triangle_RGB555},
+		{.name = "triangle RGB565",
+		 .tst_fn = gfx_triangle_RGB565},
+		{.name = "triangle RGB666",
+		 .tst_fn = gfx_triangle_RGB666},
+		{.name = "triangle RGB332",
+		 .tst_fn = gfx_triangle_RGB332},
+		{.name = "triangle CMYK8888",
+		 .tst_fn = gfx_triangle_CMYK8888},
+		{.name = "triangle P2",
+		 .tst_fn = gfx_triangle_P2},
+		{.name = "triangle P4",
+		 .tst_fn = gfx_triangle_P4},
+		{.name = "triangle P8",
+		 .tst_fn = gfx_triangle_P8},
+		{.name = "triangle G1_DB",
+		 .tst_fn = gfx_triangle_G1_DB},
+		{.name = "triangle G2_DB",
+		 .tst_fn = gfx_triangle_G2_DB},
+		{.name = "triangle G4_DB",
+		 .tst_fn = gfx_triangle_G4_DB},
+		{.name = "triangle G1_UB",
+		 .tst_fn = gfx_triangle_G1_UB},
+		{.name = "triangle G2_UB",
+		 .tst_fn = gfx_triangle_G2_UB},
+		{.name = "triangle G4_UB",
+		 .tst_fn = gfx_triangle_G4_UB},
+		{.name = "triangle G8",
+		 .tst_fn = gfx_triangle_G8},
+		{.name = "triangle GA88",
+		 .tst_fn = gfx_triangle_GA88},
+		{.name = "triangle G16",
+		 .tst_fn = gfx_triangle_G16},
+		{.name = "fill_triangle RGB101010",
+		 .tst_fn = gfx_fill_triangle_RGB101010},
+		{.name = "fill_triangle xRGB8888",
+		 .tst_fn = gfx_fill_triangle_xRGB8888},
+		{.name = "fill_triangle RGBA8888",
+		 .tst_fn = gfx_fill_triangle_RGBA8888},
+		{.name = "fill_triangle RGB888",
+		 .tst_fn = gfx_fill_triangle_RGB888},
+		{.name = "fill_triangle BGR888",
+		 .tst_fn = gfx_fill_triangle_BGR888},
+		{.name = "fill_triangle RGB555",
+		 .tst_fn = gfx_fill_triangle_RGB555},
+		{.name = "fill_triangle RGB565",
+		 .tst_fn = gfx_fill_triangle_RGB565},
+		{.name = "fill_triangle RGB666",
+		 .tst_fn = gfx_fill_triangle_RGB666},
+		{.name = "fill_triangle RGB332",
+		 .tst_fn = gfx_fill_triangle_RGB332},
+		{.name = "fill_triangle CMYK8888",
+		 .tst_fn = gfx_fill_triangle_CMYK8888},
+		{.name = "fill_triangle P2",
+		 .tst_fn = gfx_fill_triangle_P2},
+		{.name = "fill_triangle P4",
+		 .tst_fn = gfx_fill_triangle_P4},
+		{.name = "fill_triangle P8",
+		 .tst_fn = gfx_fill_triangle_P8},
+		{.name = "fill_triangle G1_DB",
+		 .tst_fn = gfx_fill_triangle_G1_DB},
+		{.name = "fill_triangle G2_DB",
+		 .tst_fn = gfx_fill_triangle_G2_DB},
+		{.name = "fill_triangle G4_DB",
+		 .tst_fn = gfx_fill_triangle_G4_DB},
+		{.name = "fill_triangle G1_UB",
+		 .tst_fn = gfx_fill_triangle_G1_UB},
+		{.name = "fill_triangle G2_UB",
+		 .tst_fn = gfx_fill_triangle_G2_UB},
+		{.name = "fill_triangle G4_UB",
+		 .tst_fn = gfx_fill_triangle_G4_UB},
+		{.name = "fill_triangle G8",
+		 .tst_fn = gfx_fill_triangle_G8},
+		{.name = "fill_triangle GA88",
+		 .tst_fn = gfx_fill_triangle_GA88},
+		{.name = "fill_triangle G16",
+		 .tst_fn = gfx_fill_triangle_G16},
+		{.name = "tetragon RGB101010",
+		 .tst_fn = gfx_tetragon_RGB101010},
+		{.name = "tetragon xRGB8888",
+		 .tst_fn = gfx_tetragon_xRGB8888},
+		{.name = "tetragon RGBA8888",
+		 .tst_fn = gfx_tetragon_RGBA8888},
+		{.name = "tetragon RGB888",
+		 .tst_fn = gfx_tetragon_RGB888},
+		{.name = "tetragon BGR888",
+		 .tst_fn = gfx_tetragon_BGR888},
+		{.name = "tetragon RGB555",
+		 .tst_fn = gfx_tetragon_RGB555},
+		{.name = "tetragon RGB565",
+		 .tst_fn = gfx_tetragon_RGB565},
+		{.name = "tetragon RGB666",
+		 .tst_fn = gfx_tetragon_RGB666},
+		{.name = "tetragon RGB332",
+		 .tst_fn = gfx_tetragon_RGB332},
+		{.name = "tetragon CMYK8888",
+		 .tst_fn = gfx_tetragon_CMYK8888},
+		{.name = "tetragon P2",
+		 .tst_fn = gfx_tetragon_P2},
+		{.name = "tetragon P4",
+		 .tst_fn = gfx_tetragon_P4},
+		{.name = "tetragon P8",
+		 .tst_fn = gfx_tetragon_P8},
+		{.name = "tetragon G1_DB",
+		 .tst_fn = gfx_tetragon_G1_DB},
+		{.name = "tetragon G2_DB",
+		 .tst_fn = gfx_tetragon_G2_DB},
+		{.name = "tetragon G4_DB",
+		 .tst_fn = gfx_tetragon_G4_DB},
+		{.name = "tetragon G1_UB",
+		 .tst_fn = gfx_tetragon_G1_UB},
+		{.name = "tetragon G2_UB",
+		 .tst_fn = gfx_tetragon_G2_UB},
+		{.name = "tetragon G4_UB",
+		 .tst_fn = gfx_tetragon_G4_UB},
+		{.name = "tetragon G8",
+		 .tst_fn = gfx_tetragon_G8},
+		{.name = "tetragon GA88",
+		 .tst_fn = gfx_tetragon_GA88},
+		{.name = "tetragon G16",
+		 .tst_fn = gfx_tetragon_G16},
+		{.name = "fill_tetragon RGB101010",
+		 .tst_fn = gfx_fill_tetragon_RGB101010},
+		{.name = "fill_tetragon xRGB8888",
+		 .tst_fn = gfx_fill_tetragon_xRGB8888},
+		{.name = "fill_tetragon RGBA8888",
+		 .tst_fn = gfx_fill_tetragon_RGBA8888},
+		{.name = "fill_tetragon RGB888",
+		 .tst_fn = gfx_fill_tetragon_RGB888},
+		{.name = "fill_tetragon BGR888",
+		 .tst_fn = gfx_fill_tetragon_BGR888},
+		{.name = "fill_tetragon RGB555",
+		 .tst_fn = gfx_fill_tetragon_RGB555},
+		{.name = "fill_tetragon RGB565",
+		 .tst_fn = gfx_fill_tetragon_RGB565},
+		{.name = "fill_tetragon RGB666",
+		 .tst_fn = gfx_fill_tetragon_RGB666},
+		{.name = "fill_tetragon RGB332",
+		 .tst_fn = gfx_fill_tetragon_RGB332},
+		{.name = "fill_tetragon CMYK8888",
+		 .tst_fn = gfx_fill_tetragon_CMYK8888},
+		{.name = "fill_tetragon P2",
+		 .tst_fn = gfx_fill_tetragon_P2},
+		{.name = "fill_tetragon P4",
+		 .tst_fn = gfx_fill_tetragon_P4},
+		{.name = "fill_tetragon P8",
+		 .tst_fn = gfx_fill_tetragon_P8},
+		{.name = "fill_tetragon G1_DB",
+		 .tst_fn = gfx_fill_tetragon_G1_DB},
+		{.name = "fill_tetragon G2_DB",
+		 .tst_fn = gfx_fill_tetragon_G2_DB},
+		{.name = "fill_tetragon G4_DB",
+		 .tst_fn = gfx_fill_tetragon_G4_DB},
+		{.name = "fill_tetragon G1_UB",
+		 .tst_fn = gfx_fill_tetragon_G1_UB},
+		{.name = "fill_tetragon G2_UB",
+		 .tst_fn = gfx_fill_tetragon_G2_UB},
+		{.name = "fill_tetragon G4_UB",
+		 .tst_fn = gfx_fill_tetragon_G4_UB},
+		{.name = "fill_tetragon G8",
+		 .tst_fn = gfx_fill_tetragon_G8},
+		{.name = "fill_tetragon GA88",
+		 .tst_fn = gfx_fill_tetragon_GA88},
+		{.name = "fill_tetragon G16",
+		 .tst_fn = gfx_fill_tetragon_G16},
+		{.name = NULL}
+	}
+};
@@ -248,6 +248,93 @@ static int queue_events_test(void)
 	return TST_PASSED;
 }
 
+static int coalesce_test(void)
+{
+	gp_ev_queue queue;
+	gp_event *ev;
+
+	gp_ev_queue_init(&queue, 100, 100, 0, GP_EVENT_QUEUE_COALESCE_MOTION);
+
+	gp_ev_queue_push_rel(&queue, 1, 2, 0);
+	gp_ev_queue_push_rel(&queue, 3, 4, 0);
+	gp_ev_queue_push_wheel(&queue, 1, 0);
+	gp_ev_queue_push_wheel(&queue, 1, 0);
+	gp_ev_queue_push_key(&queue, GP_BTN_LEFT, GP_EV_KEY_DOWN, 0);
+	gp_ev_queue_push_abs(&queue, 1, 1, 0, 10, 10, 0, 0);
+	gp_ev_queue_push_abs(&queue, 5, 5, 0, 10, 10, 0, 0);
+
+	if (gp_ev_queue_events(&queue) != 4 || queue.coalesced != 3) {
+		tst_msg("Wrong number of events %u coalesced %lu",
+		        gp_ev_queue_events(&queue), queue.coalesced);
+		return TST_FAILED;
+	}
+
+	ev = gp_ev_queue_get(&queue);
+	if (ev->type != GP_EV_REL || ev->rel.rx != 4 || ev->rel.ry != 6) {
+		tst_msg("Wrong relative event");
+		return TST_FAILED;
+	}
+
+	ev = gp_ev_queue_get(&queue);
+	if (ev->code != GP_EV_REL_WHEEL || ev->val != 2) {
+		tst_msg("Wrong wheel event");
+		return TST_FAILED;
+	}
+
+	gp_ev_queue_get(&queue);
+
+	ev = gp_ev_queue_get(&queue);
+	if (ev->type != GP_EV_ABS || ev->abs.x != 5 || ev->abs.y != 5) {
+		tst_msg("Wrong absolute event");
+		return TST_FAILED;
+	}
+
+	/* The event returned by get is not modified */
+	gp_ev_queue_push_abs(&queue, 7, 7, 0, 10, 10, 0, 0);
+
+	if (ev->abs.x != 5 || gp_ev_queue_events(&queue) != 1) {
+		tst_msg("Fetched event was coalesced");
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int queue_full_test(void)
+{
+	unsigned int i;
+	gp_ev_queue queue;
+	gp_event *ev;
+
+	gp_ev_queue_init(&queue, 100, 100, 0, 0);
+
+	for (i = 0; i < queue.queue_size - 2; i++)
+		gp_ev_queue_push_key(&queue, GP_KEY_A, GP_EV_KEY_DOWN, 0);
+
+	gp_ev_queue_push_rel(&queue, 1, 1, 0);
+
+	/* Queue is full, motion is merged, key is dropped */
+	gp_ev_queue_push_rel(&queue, 1, 1, 0);
+	gp_ev_queue_push_key(&queue, GP_KEY_A, GP_EV_KEY_DOWN, 0);
+
+	if (queue.dropped != 1 || queue.coalesced != 1) {
+		tst_msg("Wrong counters dropped %lu coalesced %lu",
+		        queue.dropped, queue.coalesced);
+		return TST_FAILED;
+	}
+
+	for (i = 0; i < queue.queue_size - 2; i++)
+		gp_ev_queue_get(&queue);
+
+	ev = gp_ev_queue_get(&queue);
+	if (!ev || ev->type != GP_EV_REL || ev->rel.rx != 2) {
+		tst_msg("Wrong relative event");
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
 const struct tst_suite tst_suite = {
 	.suite_name = "Event Queue Testsuite",
 	.tests = {
@@ -263,6 +350,10 @@ const struct tst_suite tst_suite = {
 		 .tst_fn = get_pointer_preserved},
 		{.name = "Queue events",
 		 .tst_fn = queue_events_test},
+		{.name = "Motion coalescing",
+		 .tst_fn = coalesce_test},
+		{.name = "Queue full",
+		 .tst_fn = queue_full_test},
 		{.name = NULL},
 	}
 };
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Task queue tests.
+
+ */
+
+#include <input/gp_task.h>
+
+#include "tst_test.h"
+
+static unsigned int runs;
+
+static int task_callback(gp_task *self)
+{
+	(void) self;
+
+	runs++;
+
+	return 0;
+}
+
+static int check_queue(gp_task_queue *queue, unsigned int task_cnt,
+                       unsigned int min_prio)
+{
+	unsigned int prio, cnt = 0;
+
+	if (queue->task_cnt != task_cnt || queue->min_prio != min_prio) {
+		tst_msg("Queue task_cnt=%u min_prio=%u expected %u %u",
+		        queue->task_cnt, queue->min_prio, task_cnt, min_prio);
+		return 1;
+	}
+
+	for (prio = GP_TASK_MIN_PRIO; prio <= GP_TASK_MAX_PRIO; prio++)
+		cnt += queue->queues[prio - GP_TASK_MIN_PRIO].cnt;
+
+	if (cnt != task_cnt) {
+		tst_msg("Tasks linked in queues %u expected %u", cnt, task_cnt);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int task_queue_rem(void)
+{
+	gp_task_queue queue = {};
+	gp_task min = {.prio = GP_TASK_MIN_PRIO, .id = "min", .callback = task_callback};
+	gp_task max = {.prio = GP_TASK_MAX_PRIO, .id = "max", .callback = task_callback};
+
+	gp_task_queue_ins(&queue, &max);
+	gp_task_queue_ins(&queue, &min);
+
+	if (check_queue(&queue, 2, GP_TASK_MIN_PRIO))
+		return TST_FAILED;
+
+	gp_task_queue_rem(&queue, &max);
+
+	if (max.queued) {
+		tst_msg("Removed task still marked as queued");
+		return TST_FAILED;
+	}
+
+	if (check_queue(&queue, 1, GP_TASK_MIN_PRIO))
+		return TST_FAILED;
+
+	gp_task_queue_rem(&queue, &min);
+
+	if (check_queue(&queue, 0, GP_TASK_NONE_PRIO))
+		return TST_FAILED;
+
+	if (gp_task_queue_process(&queue) || runs) {
+		tst_msg("Removed task was executed");
+		return TST_FAILED;
+	}
+
+	/* Removed task can be inserted again */
+	gp_task_queue_ins(&queue, &max);
+
+	if (check_queue(&queue, 1, GP_TASK_MAX_PRIO))
+		return TST_FAILED;
+
+	if (!gp_task_queue_process(&queue) || runs != 1) {
+		tst_msg("Task was not executed");
+		return TST_FAILED;
+	}
+
+	if (check_queue(&queue, 0, GP_TASK_NONE_PRIO))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Task queue testsuite",
+	.tests = {
+		{.name = "Task queue remove",
+		 .tst_fn = task_queue_rem},
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <loaders/gp_loaders.h>
+
+#include "tst_test.h"
+
+/*
+ * 16x16 APNG with three frames:
+ *
+ * 0: opaque red IDAT image
+ * 1: 4x4 green at 2,2 with 50% alpha blended over, disposed to background
+ * 2: 2x2 opaque blue at 10,10, disposed to previous
+ */
+#define APNG "16x16-apng.png"
+
+#define RED   0xff0000ff
+#define BLUE  0x0000ffff
+
+struct frame_check {
+	gp_anim_frame frame;
+	gp_coord x, y;
+	gp_pixel pixel;
+};
+
+static const struct frame_check frames[] = {
+	{{.delay_ms = 100, .x = 0, .y = 0, .w = 16, .h = 16}, 3, 3, RED},
+	{{.delay_ms = 200, .x = 2, .y = 2, .w = 4, .h = 4}, 3, 3, 0x7f8000ff},
+	{{.delay_ms = 0, .x = 2, .y = 2, .w = 10, .h = 10}, 10, 10, BLUE},
+};
+
+static int check_frame(gp_anim *anim, const struct frame_check *check)
+{
+	gp_anim_frame frame;
+	gp_pixel p;
+
+	if (gp_anim_next(anim, &frame, NULL)) {
+		tst_msg("Failed to decode frame %u: %s",
+		        anim->cur_frame, strerror(errno));
+		return 1;
+	}
+
+	if (frame.delay_ms != check->frame.delay_ms ||
+	    frame.x != check->frame.x || frame.y != check->frame.y ||
+	    frame.w != check->frame.w || frame.h != check->frame.h) {
+		tst_msg("Frame %u delay %u rect %ix%i-%ux%u expected %u %ix%i-%ux%u",
+		        anim->cur_frame - 1, frame.delay_ms, frame.x, frame.y,
+		        frame.w, frame.h, check->frame.delay_ms,
+		        check->frame.x, check->frame.y,
+		        check->frame.w, check->frame.h);
+		return 1;
+	}
+
+	p = gp_getpixel_raw_32BPP(anim->canvas, check->x, check->y);
+
+	if (p != check->pixel) {
+		tst_msg("Frame %u pixel %ix%i = %08x expected %08x",
+		        anim->cur_frame - 1, check->x, check->y, p, check->pixel);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int anim_apng(void)
+{
+	gp_anim_frame frame;
+	gp_anim *anim;
+	unsigned int i;
+	int ret = TST_FAILED;
+
+	anim = gp_anim_open(APNG);
+	if (!anim) {
+		tst_msg("Failed to open animation: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (anim->canvas->w != 16 || anim->canvas->h != 16 ||
+	    anim->frame_cnt != 3 || anim->loop_cnt != 0) {
+		tst_msg("Wrong canvas %ux%u frames %u loops %u",
+		        anim->canvas->w, anim->canvas->h,
+		        anim->frame_cnt, anim->loop_cnt);
+		goto exit;
+	}
+
+	for (i = 0; i < GP_ARRAY_SIZE(frames); i++) {
+		if (check_frame(anim, &frames[i]))
+			goto exit;
+	}
+
+	/* Disposed to background by frame 2 */
+	if (gp_getpixel_raw_32BPP(anim->canvas, 3, 3)) {
+		tst_msg("Frame 1 was not disposed");
+		goto exit;
+	}
+
+	if (!gp_anim_next(anim, &frame, NULL) || errno != ENOENT) {
+		tst_msg("Expected ENOENT after last frame");
+		goto exit;
+	}
+
+	if (gp_anim_rewind(anim)) {
+		tst_msg("Failed to rewind: %s", strerror(errno));
+		goto exit;
+	}
+
+	for (i = 0; i < GP_ARRAY_SIZE(frames); i++) {
+		if (check_frame(anim, &frames[i]))
+			goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_anim_close(anim);
+	return ret;
+}
+
+static int anim_still(void)
+{
+	gp_anim_frame frame;
+	gp_anim *anim;
+	int ret = TST_FAILED;
+
+	anim = gp_anim_open("100x100-red.png");
+	if (!anim) {
+		tst_msg("Failed to open image: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (anim->frame_cnt != 1) {
+		tst_msg("Wrong number of frames %u", anim->frame_cnt);
+		goto exit;
+	}
+
+	if (gp_anim_next(anim, &frame, NULL)) {
+		tst_msg("Failed to decode frame: %s", strerror(errno));
+		goto exit;
+	}
+
+	if (frame.w != 100 || frame.h != 100 ||
+	    gp_getpixel_raw_32BPP(anim->canvas, 50, 50) != RED) {
+		tst_msg("Wrong frame");
+		goto exit;
+	}
+
+	if (!gp_anim_next(anim, &frame, NULL) || errno != ENOENT) {
+		tst_msg("Expected ENOENT after single frame");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_anim_close(anim);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Animation",
+	.tests = {
+		{.name = "anim APNG",
+		 .tst_fn = anim_apng,
+		 .res_path = "data/png/valid/" APNG,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "anim still PNG",
+		 .tst_fn = anim_still,
+		 .res_path = "data/png/valid/100x100-red.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = NULL},
+	}
+};
@@ -295,6 +295,170 @@ static int test_IOFile(void)
 	return TST_PASSED;
 }
 
+static int check_map(gp_io *io, off_t off, size_t size, uint8_t first)
+{
+	const uint8_t *data = gp_io_map(io, off, size);
+	size_t i;
+
+	if (!data) {
+		tst_msg("Failed to map %zu bytes at %li: %s",
+		        size, (long)off, strerror(errno));
+		return 1;
+	}
+
+	for (i = 0; i < size; i++) {
+		if (data[i] != (uint8_t)(first + i)) {
+			tst_msg("Wrong mapped data at %zu", i);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int check_map_fail(gp_io *io, off_t off, size_t size)
+{
+	if (gp_io_map(io, off, size)) {
+		tst_msg("Mapped %zu bytes at %li past the end",
+		        size, (long)off);
+		return 1;
+	}
+
+	if (errno != EINVAL) {
+		tst_msg("Expected EINVAL got %s", strerror(errno));
+		return 1;
+	}
+
+	return 0;
+}
+
+static int test_IOMap(void)
+{
+	uint8_t buffer[128];
+	unsigned int i;
+	gp_io *io, *sub_io;
+	int ret = TST_FAILED;
+
+	for (i = 0; i < sizeof(buffer); i++)
+		buffer[i] = i;
+
+	io = gp_io_mem(buffer, sizeof(buffer), NULL);
+
+	if (!io) {
+		tst_msg("Failed to initialize memory I/O");
+		return TST_FAILED;
+	}
+
+	if (gp_io_seek(io, 10, GP_SEEK_SET) != 10) {
+		tst_msg("Failed to seek");
+		goto exit;
+	}
+
+	sub_io = gp_io_sub_io(io, 100);
+	if (!sub_io) {
+		tst_msg("Failed to initialize sub I/O");
+		goto exit;
+	}
+
+	if (check_map(io, 0, sizeof(buffer), 0) ||
+	    check_map(io, 100, 28, 100) ||
+	    check_map(sub_io, 0, 100, 10) ||
+	    check_map(sub_io, 50, 10, 60) ||
+	    check_map_fail(io, 100, 29) ||
+	    check_map_fail(io, -1, 1) ||
+	    check_map_fail(sub_io, 50, 51))
+		goto exit_sub;
+
+	if (gp_io_tell(io) != 10) {
+		tst_msg("Map moved the I/O offset");
+		goto exit_sub;
+	}
+
+	ret = TST_PASSED;
+exit_sub:
+	gp_io_close(sub_io);
+exit:
+	gp_io_close(io);
+	return ret;
+}
+
+static int test_IOMmap(void)
+{
+	uint8_t buffer[128];
+	unsigned int i;
+	int ret;
+	gp_io *io;
+
+	for (i = 0; i < sizeof(buffer); i++)
+		buffer[i] = i;
+
+	io = gp_io_file(TFILE, GP_IO_WRONLY);
+
+	if (!io) {
+		tst_msg("Failed to open file I/O for writing: %s",
+		        strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (gp_io_flush(io, buffer, sizeof(buffer))) {
+		tst_msg("Failed to write: %s", strerror(errno));
+		gp_io_close(io);
+		return TST_FAILED;
+	}
+
+	if (gp_io_close(io)) {
+		tst_msg("Failed to close file I/O: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	io = gp_io_file(TFILE, GP_IO_RDONLY);
+	if (!io) {
+		tst_msg("Failed to open file I/O for reading: %s",
+		        strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (gp_io_map(io, 0, 1) || errno != ENOSYS) {
+		tst_msg("File I/O map did not fail with ENOSYS");
+		gp_io_close(io);
+		return TST_FAILED;
+	}
+
+	gp_io_close(io);
+
+	io = gp_io_mmap(TFILE);
+
+	if (!io) {
+		if (errno == ENOSYS) {
+			tst_msg("mmap() not supported");
+			return TST_SKIPPED;
+		}
+
+		tst_msg("Failed to map file: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	ret = do_test(io, sizeof(buffer), 0);
+	if (ret)
+		goto exit;
+
+	ret = TST_FAILED;
+
+	if (check_map(io, 0, sizeof(buffer), 0) ||
+	    check_map(io, 64, 64, 64) ||
+	    check_map_fail(io, 0, sizeof(buffer) + 1))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	if (gp_io_close(io)) {
+		tst_msg("Failed to close mmap I/O: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	return ret;
+}
+
 static int test_IOSubIO(void)
 {
 	uint8_t buffer[128];
@@ -366,6 +530,90 @@ failed:
 	return TST_FAILED;
 }
 
+static int test_IORBuffer(void)
+{
+	uint8_t buffer[128];
+	unsigned int i;
+	gp_io *io, *pio;
+	int ret;
+
+	for (i = 0; i < sizeof(buffer); i++)
+		buffer[i] = i;
+
+	pio = gp_io_mem(buffer, sizeof(buffer), NULL);
+
+	if (!pio) {
+		tst_msg("Failed to initialize memory I/O");
+		return TST_FAILED;
+	}
+
+	io = gp_io_rbuffer(pio, 16);
+
+	if (!io) {
+		tst_msg("Failed to initialize read buffer I/O");
+		gp_io_close(pio);
+		return TST_FAILED;
+	}
+
+	ret = do_test(io, sizeof(buffer), 0);
+	if (ret)
+		goto exit;
+
+	ret = TST_FAILED;
+
+	if (gp_io_rewind(io)) {
+		tst_msg("Failed to rewind to start");
+		goto exit;
+	}
+
+	for (i = 0; i < sizeof(buffer); i++) {
+		uint8_t peek[3];
+		int b;
+
+		if (i + sizeof(peek) <= sizeof(buffer)) {
+			if (gp_io_peek(io, peek, sizeof(peek)) != (off_t)i) {
+				tst_msg("Peek failed at %u", i);
+				goto exit;
+			}
+
+			if (peek[0] != i || peek[2] != i + 2) {
+				tst_msg("Peeked wrong data at %u", i);
+				goto exit;
+			}
+		}
+
+		b = gp_io_getb(io);
+		if (b != (int)i) {
+			tst_msg("Read wrong byte %i expected %u", b, i);
+			goto exit;
+		}
+
+		if (i % 9 == 0 && i + 1 < sizeof(buffer)) {
+			if (gp_io_skip(io, 1)) {
+				tst_msg("Skip failed at %u", i);
+				goto exit;
+			}
+			i++;
+		}
+	}
+
+	if (gp_io_getb(io) != -1) {
+		tst_msg("Read byte past the end of I/O");
+		goto exit;
+	}
+
+	if (gp_io_tell(io) != sizeof(buffer)) {
+		tst_msg("Wrong offset at the end of I/O");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_io_close(io);
+	gp_io_close(pio);
+	return ret;
+}
+
 static ssize_t test_IOFill_read(gp_io GP_UNUSED(*io), void *buf, size_t size)
 {
 	ssize_t ret = GP_MIN(7u, size);
@@ -542,10 +790,22 @@ const struct tst_suite tst_suite = {
 		 .tst_fn = test_IOSubIO,
 		 .flags = TST_CHECK_MALLOC},
 
+		{.name = "IORBuffer",
+		 .tst_fn = test_IORBuffer,
+		 .flags = TST_CHECK_MALLOC},
+
 		{.name = "IOFile",
 		 .tst_fn = test_IOFile,
 		 .flags = TST_CHECK_MALLOC | TST_TMPDIR},
 
+		{.name = "IOMap",
+		 .tst_fn = test_IOMap,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "IOMmap",
+		 .tst_fn = test_IOMmap,
+		 .flags = TST_CHECK_MALLOC | TST_TMPDIR},
+
 		{.name = "IOFill",
 		 .tst_fn = test_IOFill},
 
@@ -9,6 +9,7 @@
 
 #include <core/gp_pixmap.h>
 #include <core/gp_get_put_pixel.h>
+#include <core/gp_convert.h>
 #include <loaders/gp_loaders.h>
 
 #include "tst_test.h"
@@ -41,6 +42,48 @@ static int test_load_jpg(const char *path)
 	return TST_PASSED;
 }
 
+struct scaled_test {
+	const char *path;
+	gp_size w, h;
+	gp_size exp_w, exp_h;
+};
+
+static int test_load_jpg_scaled(struct scaled_test *test)
+{
+	gp_pixmap *img;
+	int ret = TST_PASSED;
+
+	errno = 0;
+
+	img = gp_load_image_scaled(test->path, test->w, test->h, NULL);
+
+	if (img == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Got %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	if (img->w != test->exp_w || img->h != test->exp_h) {
+		tst_msg("Got %ux%u expected %ux%u",
+		        img->w, img->h, test->exp_w, test->exp_h);
+		ret = TST_FAILED;
+	}
+
+	gp_pixmap_free(img);
+
+	return ret;
+}
+
+static struct scaled_test scaled_1_2 = {"100x100-red.jpeg", 40, 40, 50, 50};
+static struct scaled_test scaled_1_8 = {"100x100-red.jpeg", 10, 5, 13, 13};
+static struct scaled_test scaled_w = {"100x100-red.jpeg", 30, 0, 50, 50};
+static struct scaled_test scaled_none = {"100x100-red.jpeg", 60, 60, 100, 100};
+
 static int test_save_jpg(gp_pixel_type pixel_type)
 {
 	gp_pixmap *pixmap;
@@ -75,6 +118,146 @@ static int test_save_jpg(gp_pixel_type pixel_type)
 	}
 }
 
+struct thumbnail_test {
+	const char *path;
+	gp_size min_w, min_h;
+	gp_size exp_w, exp_h;
+	/* Embedded thumbnail is green, the image is red */
+	int embedded;
+};
+
+static int test_load_thumbnail(struct thumbnail_test *test)
+{
+	gp_pixmap *img;
+	gp_pixel pixel;
+	int ret = TST_PASSED;
+	int is_green;
+
+	errno = 0;
+
+	img = gp_load_thumbnail(test->path, test->min_w, test->min_h, NULL);
+
+	if (img == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Got %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	if (img->w != test->exp_w || img->h != test->exp_h) {
+		tst_msg("Got %ux%u expected %ux%u",
+		        img->w, img->h, test->exp_w, test->exp_h);
+		ret = TST_FAILED;
+	}
+
+	pixel = gp_getpixel(img, img->w/2, img->h/2);
+	is_green = GP_PIXEL_GET_G_RGB888(pixel) > 0xf0;
+
+	if (is_green != test->embedded) {
+		tst_msg("Expected %s got pixel %08x",
+		        test->embedded ? "embedded thumbnail" : "image", pixel);
+		ret = TST_FAILED;
+	}
+
+	gp_pixmap_free(img);
+
+	return ret;
+}
+
+static struct thumbnail_test thumbnail_any = {
+	"320x240-exif-thumbnail.jpeg", 0, 0, 160, 120, 1
+};
+
+static struct thumbnail_test thumbnail_fits = {
+	"320x240-exif-thumbnail.jpeg", 150, 100, 160, 120, 1
+};
+
+static struct thumbnail_test thumbnail_small = {
+	"320x240-exif-thumbnail.jpeg", 200, 150, 320, 240, 0
+};
+
+static struct thumbnail_test thumbnail_none = {
+	"100x100-red.jpeg", 10, 10, 13, 13, 0
+};
+
+static off_t save_quality(gp_pixmap *pixmap, const char *path,
+                          const gp_save_opts *opts)
+{
+	gp_pixmap *res;
+	struct stat st;
+	off_t ret = -1;
+
+	if (gp_save_jpg_ex(pixmap, path, opts, NULL)) {
+		tst_msg("Failed to save '%s': %s", path, strerror(errno));
+		return -1;
+	}
+
+	res = gp_load_jpg(path, NULL);
+	if (!res) {
+		tst_msg("Failed to load '%s': %s", path, strerror(errno));
+		return -1;
+	}
+
+	if (res->w != pixmap->w || res->h != pixmap->h)
+		tst_msg("Wrong size %ux%u of '%s'", res->w, res->h, path);
+	else if (!stat(path, &st))
+		ret = st.st_size;
+
+	gp_pixmap_free(res);
+	return ret;
+}
+
+static int test_save_jpg_opts(void)
+{
+	gp_save_opts low = {.quality = 10, .subsampling = GP_SAVE_SUBSAMPLING_420};
+	gp_save_opts high = {.quality = 95, .subsampling = GP_SAVE_SUBSAMPLING_444};
+	gp_save_opts prog = {.flags = GP_SAVE_PROGRESSIVE};
+	gp_pixmap *pixmap;
+	gp_coord x, y;
+	off_t low_size, high_size;
+	int ret = TST_FAILED;
+
+	pixmap = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	if (!pixmap) {
+		tst_msg("Failed to allocate pixmap");
+		return TST_UNTESTED;
+	}
+
+	for (y = 0; y < 100; y++) {
+		for (x = 0; x < 100; x++)
+			gp_putpixel_raw(pixmap, x, y, gp_rgb_to_pixmap_pixel(2*x, 2*y, (x*y)%256, pixmap));
+	}
+
+	low_size = save_quality(pixmap, "low.jpg", &low);
+	high_size = save_quality(pixmap, "high.jpg", &high);
+
+	if (low_size < 0 || high_size < 0)
+		goto exit;
+
+	tst_msg("Quality 10 %lli bytes, quality 95 %lli bytes",
+	        (long long)low_size, (long long)high_size);
+
+	if (low_size >= high_size) {
+		tst_msg("Low quality file is not smaller");
+		goto exit;
+	}
+
+	if (save_quality(pixmap, "progressive.jpg", &prog) < 0)
+		goto exit;
+
+	if (save_quality(pixmap, "fastest.jpg", GP_SAVE_OPTS_FASTEST) < 0)
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	gp_pixmap_free(pixmap);
+	return ret;
+}
+
 const struct tst_suite tst_suite = {
 	.suite_name = "JPEG",
 	.tests = {
@@ -103,6 +286,55 @@ const struct tst_suite tst_suite = {
 		 .data = "100x100-grayscale-black.jpeg",
 		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
 
+		/* JPEG scaled loader tests */
+		{.name = "JPEG Load scaled 1/2",
+		 .tst_fn = test_load_jpg_scaled,
+		 .res_path = "data/jpeg/valid/100x100-red.jpeg",
+		 .data = &scaled_1_2,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "JPEG Load scaled 1/8",
+		 .tst_fn = test_load_jpg_scaled,
+		 .res_path = "data/jpeg/valid/100x100-red.jpeg",
+		 .data = &scaled_1_8,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "JPEG Load scaled width only",
+		 .tst_fn = test_load_jpg_scaled,
+		 .res_path = "data/jpeg/valid/100x100-red.jpeg",
+		 .data = &scaled_w,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "JPEG Load scaled full size",
+		 .tst_fn = test_load_jpg_scaled,
+		 .res_path = "data/jpeg/valid/100x100-red.jpeg",
+		 .data = &scaled_none,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "JPEG Load thumbnail any size",
+		 .tst_fn = test_load_thumbnail,
+		 .res_path = "data/jpeg/valid/320x240-exif-thumbnail.jpeg",
+		 .data = &thumbnail_any,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "JPEG Load thumbnail embedded",
+		 .tst_fn = test_load_thumbnail,
+		 .res_path = "data/jpeg/valid/320x240-exif-thumbnail.jpeg",
+		 .data = &thumbnail_fits,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "JPEG Load thumbnail too small",
+		 .tst_fn = test_load_thumbnail,
+		 .res_path = "data/jpeg/valid/320x240-exif-thumbnail.jpeg",
+		 .data = &thumbnail_small,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "JPEG Load thumbnail none",
+		 .tst_fn = test_load_thumbnail,
+		 .res_path = "data/jpeg/valid/100x100-red.jpeg",
+		 .data = &thumbnail_none,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
 		/* JPEG save tests */
 		{.name = "JPEG Save 100x100 G8",
 		 .tst_fn = test_save_jpg,
@@ -119,6 +351,10 @@ const struct tst_suite tst_suite = {
 		 .data = (void*)GP_PIXEL_BGR888,
 		 .flags = TST_CHECK_MALLOC},
 
+		{.name = "JPEG Save with options",
+		 .tst_fn = test_save_jpg_opts,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
 		{.name = NULL},
 	}
 };
@@ -0,0 +1,276 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <poll.h>
+
+#include <core/gp_core.h>
+#include <loaders/gp_loaders.h>
+
+#include "tst_test.h"
+
+#define IMAGES 8
+
+static char paths[IMAGES][32];
+
+static int create_images(void)
+{
+	unsigned int i;
+
+	for (i = 0; i < IMAGES; i++) {
+		gp_pixmap *img = gp_pixmap_alloc(10 + i, 20 + i, GP_PIXEL_RGB888);
+
+		if (!img) {
+			tst_msg("Failed to allocate pixmap");
+			return 1;
+		}
+
+		gp_fill(img, i);
+		snprintf(paths[i], sizeof(paths[i]), "img%u.ppm", i);
+
+		if (gp_save_image(img, paths[i], NULL)) {
+			tst_msg("Failed to save '%s': %s", paths[i], strerror(errno));
+			gp_pixmap_free(img);
+			return 1;
+		}
+
+		gp_pixmap_free(img);
+	}
+
+	return 0;
+}
+
+static gp_load_req *wait_req(gp_load_queue *queue)
+{
+	struct pollfd fd = {.fd = gp_load_queue_fd(queue), .events = POLLIN};
+
+	if (poll(&fd, 1, 10000) != 1) {
+		tst_msg("Timeouted while waiting for load queue fd");
+		return NULL;
+	}
+
+	return gp_load_queue_get(queue);
+}
+
+static int load_queue_load(void)
+{
+	gp_load_req reqs[IMAGES + 1] = {};
+	gp_load_queue *queue;
+	unsigned int i, done = 0;
+	int ret = TST_FAILED;
+
+	if (create_images())
+		return TST_UNTESTED;
+
+	queue = gp_load_queue_create(2, 0);
+	if (!queue) {
+		int err = errno;
+
+		tst_msg("Failed to create load queue: %s", strerror(err));
+		return err == ENOSYS ? TST_SKIPPED : TST_FAILED;
+	}
+
+	for (i = 0; i < IMAGES; i++) {
+		reqs[i].path = paths[i];
+		reqs[i].priv = (void*)(uintptr_t)i;
+		gp_load_queue_add(queue, &reqs[i]);
+	}
+
+	reqs[IMAGES].path = "nonexistent.ppm";
+	reqs[IMAGES].priv = (void*)(uintptr_t)IMAGES;
+	gp_load_queue_add(queue, &reqs[IMAGES]);
+
+	while (done < IMAGES + 1) {
+		gp_load_req *req = wait_req(queue);
+
+		if (!req)
+			goto exit;
+
+		i = (uintptr_t)req->priv;
+		done++;
+
+		if (i == IMAGES) {
+			if (req->img || req->err != ENOENT) {
+				tst_msg("Wrong result for nonexistent file %s",
+				        strerror(req->err));
+				goto exit;
+			}
+			continue;
+		}
+
+		if (!req->img) {
+			tst_msg("Failed to load '%s': %s", req->path, strerror(req->err));
+			goto exit;
+		}
+
+		if (req->img->w != 10 + i || req->img->h != 20 + i) {
+			tst_msg("Wrong image size %ux%u for '%s'",
+			        req->img->w, req->img->h, req->path);
+			goto exit;
+		}
+	}
+
+	if (gp_load_queue_get(queue)) {
+		tst_msg("Got more requests than added");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_load_queue_destroy(queue);
+
+	for (i = 0; i < IMAGES; i++)
+		gp_pixmap_free(reqs[i].img);
+
+	return ret;
+}
+
+static int load_queue_priority(void)
+{
+	gp_load_req blocker = {}, reqs[3] = {};
+	gp_load_queue_stats stats;
+	gp_load_queue *queue;
+	gp_load_req *req;
+	int prios[] = {1, 10, 5};
+	unsigned int order[] = {1, 2, 0};
+	unsigned int i;
+	int ret = TST_FAILED;
+
+	if (create_images())
+		return TST_UNTESTED;
+
+	/* Single byte limit, worker stops after each image */
+	queue = gp_load_queue_create(1, 1);
+	if (!queue) {
+		int err = errno;
+
+		tst_msg("Failed to create load queue: %s", strerror(err));
+		return err == ENOSYS ? TST_SKIPPED : TST_FAILED;
+	}
+
+	blocker.path = paths[0];
+	gp_load_queue_add(queue, &blocker);
+
+	/* Wait for the blocker but do not fetch it */
+	struct pollfd fd = {.fd = gp_load_queue_fd(queue), .events = POLLIN};
+
+	if (poll(&fd, 1, 10000) != 1) {
+		tst_msg("Timeouted while waiting for load queue fd");
+		goto exit;
+	}
+
+	for (i = 0; i < 3; i++) {
+		reqs[i].path = paths[i + 1];
+		reqs[i].priority = prios[i];
+		gp_load_queue_add(queue, &reqs[i]);
+	}
+
+	gp_load_queue_stats_get(queue, &stats);
+
+	if (stats.pending != 3 || stats.done != 1 || !stats.done_bytes) {
+		tst_msg("Wrong stats pending=%zu done=%zu done_bytes=%zu",
+		        stats.pending, stats.done, stats.done_bytes);
+		goto exit;
+	}
+
+	req = gp_load_queue_get(queue);
+	if (req != &blocker) {
+		tst_msg("Expected blocker request");
+		goto exit;
+	}
+
+	for (i = 0; i < 3; i++) {
+		req = wait_req(queue);
+
+		if (req != &reqs[order[i]]) {
+			tst_msg("Wrong request order at %u", i);
+			goto exit;
+		}
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_load_queue_destroy(queue);
+
+	gp_pixmap_free(blocker.img);
+	for (i = 0; i < 3; i++)
+		gp_pixmap_free(reqs[i].img);
+
+	return ret;
+}
+
+static int load_queue_cancel(void)
+{
+	gp_load_token token = {};
+	gp_load_req reqs[IMAGES] = {};
+	gp_load_queue *queue;
+	unsigned int i;
+	int ret = TST_FAILED;
+
+	if (create_images())
+		return TST_UNTESTED;
+
+	queue = gp_load_queue_create(1, 0);
+	if (!queue) {
+		int err = errno;
+
+		tst_msg("Failed to create load queue: %s", strerror(err));
+		return err == ENOSYS ? TST_SKIPPED : TST_FAILED;
+	}
+
+	gp_load_token_cancel(&token);
+
+	for (i = 0; i < IMAGES; i++) {
+		reqs[i].path = paths[i];
+		reqs[i].token = &token;
+		gp_load_queue_add(queue, &reqs[i]);
+	}
+
+	for (i = 0; i < IMAGES; i++) {
+		gp_load_req *req = wait_req(queue);
+
+		if (!req)
+			goto exit;
+
+		if (req->img || req->err != ECANCELED) {
+			tst_msg("Cancelled request finished with %s",
+			        strerror(req->err));
+			goto exit;
+		}
+	}
+
+	/* Requests not fetched before destroy are freed */
+	for (i = 0; i < IMAGES; i++) {
+		reqs[i].path = paths[i];
+		reqs[i].token = NULL;
+		gp_load_queue_add(queue, &reqs[i]);
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_load_queue_destroy(queue);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Load queue",
+	.tests = {
+		{.name = "load queue load",
+		 .tst_fn = load_queue_load,
+		 .flags = TST_TMPDIR},
+
+		{.name = "load queue priority",
+		 .tst_fn = load_queue_priority,
+		 .flags = TST_TMPDIR},
+
+		{.name = "load queue cancel",
+		 .tst_fn = load_queue_cancel,
+		 .flags = TST_TMPDIR},
+
+		{.name = NULL},
+	}
+};
@@ -5,11 +5,14 @@
 
 #include <string.h>
 #include <errno.h>
+#include <unistd.h>
 #include <sys/stat.h>
 
 #include <core/gp_pixmap.h>
 #include <core/gp_get_put_pixel.h>
+#include <core/gp_convert.h>
 #include <loaders/gp_loaders.h>
+#include <loaders/gp_png.h>
 
 #include "tst_test.h"
 
@@ -106,6 +109,79 @@ static struct check_color_test red = {
 	.pixel = 0xff0000,
 };
 
+static gp_pixmap *read_png(const char *path,
+                           int (*read)(gp_io *, gp_pixmap **, gp_storage *,
+                                       gp_progress_cb *))
+{
+	gp_pixmap *img = NULL;
+	gp_io *io;
+	int err;
+
+	io = gp_io_file(path, GP_IO_RDONLY);
+	if (!io)
+		return NULL;
+
+	if (read(io, &img, NULL, NULL))
+		img = NULL;
+
+	err = errno;
+	gp_io_close(io);
+	errno = err;
+
+	return img;
+}
+
+/*
+ * Compares the internal decoder against the libpng one, which is also the
+ * internal decoder when gfxprim is compiled without libpng.
+ */
+static int test_load_PNG_internal(const char *path)
+{
+	gp_pixmap *img, *ref;
+	unsigned int x, y;
+	int ret = TST_FAILED;
+
+	img = read_png(path, gp_read_png_int_ex);
+	if (!img) {
+		tst_msg("Internal decoder failed: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	ref = read_png(path, gp_read_png_ex);
+	if (!ref) {
+		tst_msg("Failed to load reference image: %s", strerror(errno));
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	if (img->pixel_type != ref->pixel_type ||
+	    img->w != ref->w || img->h != ref->h) {
+		tst_msg("Got %s %ux%u expected %s %ux%u",
+		        gp_pixel_type_name(img->pixel_type), img->w, img->h,
+		        gp_pixel_type_name(ref->pixel_type), ref->w, ref->h);
+		goto exit;
+	}
+
+	for (y = 0; y < img->h; y++) {
+		for (x = 0; x < img->w; x++) {
+			gp_pixel p = gp_getpixel_raw(img, x, y);
+			gp_pixel r = gp_getpixel_raw(ref, x, y);
+
+			if (p != r) {
+				tst_msg("Pixel at %u,%u %08x expected %08x",
+				        x, y, p, r);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_pixmap_free(img);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
 static int test_save_PNG(gp_pixel_type pixel_type)
 {
 	gp_pixmap *pixmap;
@@ -140,6 +216,111 @@ static int test_save_PNG(gp_pixel_type pixel_type)
 	}
 }
 
+static gp_pixmap *gradient(gp_pixel_type pixel_type)
+{
+	gp_pixmap *pixmap = gp_pixmap_alloc(100, 100, pixel_type);
+	gp_coord x, y;
+
+	if (!pixmap)
+		return NULL;
+
+	for (y = 0; y < 100; y++) {
+		for (x = 0; x < 100; x++)
+			gp_putpixel_raw(pixmap, x, y, gp_rgb_to_pixmap_pixel(2*x, 2*y, x+y, pixmap));
+	}
+
+	return pixmap;
+}
+
+static off_t save_opts_size(gp_pixmap *pixmap, const char *path,
+                            const gp_save_opts *opts)
+{
+	gp_pixmap *res;
+	struct stat st;
+	off_t ret = -1;
+
+	if (gp_save_png_ex(pixmap, path, opts, NULL)) {
+		tst_msg("Failed to save '%s': %s", path, strerror(errno));
+		return -1;
+	}
+
+	res = gp_load_png(path, NULL);
+	if (!res) {
+		tst_msg("Failed to load '%s': %s", path, strerror(errno));
+		return -1;
+	}
+
+	if (gp_pixmap_equal(pixmap, res) && !stat(path, &st))
+		ret = st.st_size;
+	else
+		tst_msg("Pixmap loaded from '%s' differs", path);
+
+	gp_pixmap_free(res);
+	return ret;
+}
+
+static int test_save_PNG_opts(void)
+{
+	gp_save_opts smallest = {.preset = GP_SAVE_PRESET_SMALLEST};
+	gp_pixmap *pixmap;
+	off_t fast, small;
+	int ret = TST_FAILED;
+
+	pixmap = gradient(GP_PIXEL_RGB888);
+	if (!pixmap) {
+		tst_msg("Failed to allocate pixmap");
+		return TST_UNTESTED;
+	}
+
+	fast = save_opts_size(pixmap, "fastest.png", GP_SAVE_OPTS_FASTEST);
+	small = save_opts_size(pixmap, "smallest.png", &smallest);
+
+	if (fast < 0 || small < 0)
+		goto exit;
+
+	tst_msg("Fastest %lli bytes, smallest %lli bytes",
+	        (long long)fast, (long long)small);
+
+	if (small > fast) {
+		tst_msg("Smallest preset produced larger file");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_pixmap_free(pixmap);
+	return ret;
+}
+
+static int test_save_PNG_opts_inval(void)
+{
+	gp_save_opts opts = {.compress_level = 10};
+	gp_pixmap *pixmap;
+	int ret;
+
+	pixmap = gp_pixmap_alloc(10, 10, GP_PIXEL_RGB888);
+	if (!pixmap) {
+		tst_msg("Failed to allocate pixmap");
+		return TST_UNTESTED;
+	}
+
+	errno = 0;
+	ret = gp_save_png_ex(pixmap, "inval.png", &opts, NULL);
+	gp_pixmap_free(pixmap);
+
+	if (!ret || errno != EINVAL) {
+		tst_msg("Invalid level returned %i errno %s", ret, strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (!access("inval.png", F_OK)) {
+		tst_msg("File created for invalid options");
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
 const struct tst_suite tst_suite = {
 	.suite_name = "PNG",
 	.tests = {
@@ -186,6 +367,108 @@ const struct tst_suite tst_suite = {
 		 .data = &white_adam7,
 		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
 
+		{.name = "PNG internal 1 bit Grayscale",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-g1.png",
+		 .data = "17x13-g1.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal 2 bit Grayscale Adam7",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-g2-adam7.png",
+		 .data = "17x13-g2-adam7.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal 4 bit Grayscale",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-g4.png",
+		 .data = "17x13-g4.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal 8 bit Grayscale Adam7",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-g8-adam7.png",
+		 .data = "17x13-g8-adam7.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal 16 bit Grayscale",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-g16.png",
+		 .data = "17x13-g16.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal 8 bit Grayscale + alpha",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-ga8.png",
+		 .data = "17x13-ga8.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal RGB",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-rgb8.png",
+		 .data = "17x13-rgb8.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal RGB Adam7",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-rgb8-adam7.png",
+		 .data = "17x13-rgb8-adam7.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal 16 bit RGB",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-rgb16.png",
+		 .data = "17x13-rgb16.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal 16 bit RGB sRGB",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-rgb16-srgb.png",
+		 .data = "17x13-rgb16-srgb.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal RGBA Adam7",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-rgba8-adam7.png",
+		 .data = "17x13-rgba8-adam7.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal 1 bit Palette",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-p1.png",
+		 .data = "17x13-p1.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal 2 bit Palette Adam7",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-p2-adam7.png",
+		 .data = "17x13-p2-adam7.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal 4 bit Palette",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-p4.png",
+		 .data = "17x13-p4.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal 8 bit Palette + tRNS",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/17x13-p8-trns.png",
+		 .data = "17x13-p8-trns.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal 100x100 RGB Adam7",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/100x100-white-adam7.png",
+		 .data = "100x100-white-adam7.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG internal 100x100 Palette + alpha",
+		 .tst_fn = test_load_PNG_internal,
+		 .res_path = "data/png/valid/100x100-palette-alpha.png",
+		 .data = "100x100-palette-alpha.png",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
 		{.name = "PNG Save 100x100 G1",
 		 .tst_fn = test_save_PNG,
 		 .data = (void*)GP_PIXEL_G1,
@@ -231,6 +514,14 @@ const struct tst_suite tst_suite = {
 		 .data = (void*)GP_PIXEL_xRGB8888,
 		 .flags = TST_CHECK_MALLOC},
 
+		{.name = "PNG Save fastest and smallest preset",
+		 .tst_fn = test_save_PNG_opts,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "PNG Save invalid options",
+		 .tst_fn = test_save_PNG_opts_inval,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
 		{.name = NULL},
 	}
 };
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <core/gp_core.h>
+#include <loaders/gp_loaders.h>
+#include <loaders/gp_png.h>
+
+#include "tst_test.h"
+
+#define W 1024
+#define H 768
+
+typedef int (*read_fn)(gp_io *, gp_pixmap **, gp_storage *, gp_progress_cb *);
+
+/* Encoded once in the warm up run and kept for the benchmark iterations */
+static void *data;
+static size_t data_size;
+
+static int encode(gp_pixel_type pixel_type)
+{
+	gp_pixmap *img;
+	unsigned int x, y;
+	gp_io *io;
+	int ret = 1;
+
+	if (data)
+		return 0;
+
+	img = gp_pixmap_alloc(W, H, pixel_type);
+	if (!img)
+		return 1;
+
+	/* Gradients with a bit of noise, so that all filters are used */
+	for (y = 0; y < H; y++) {
+		for (x = 0; x < W; x++) {
+			gp_pixel p = gp_rgb_to_pixmap_pixel(x / 4, y / 3, (x ^ y) + random() % 8, img);
+
+			gp_putpixel_raw(img, x, y, p);
+		}
+	}
+
+	if (gp_save_png(img, "bench.png", NULL)) {
+		tst_msg("Failed to save PNG: %s", strerror(errno));
+		goto exit;
+	}
+
+	io = gp_io_file("bench.png", GP_IO_RDONLY);
+	if (!io)
+		goto exit;
+
+	data_size = gp_io_size(io);
+	data = malloc(data_size);
+
+	if (data && !gp_io_fill(io, data, data_size))
+		ret = 0;
+
+	gp_io_close(io);
+exit:
+	gp_pixmap_free(img);
+	return ret;
+}
+
+static int decode(gp_pixel_type pixel_type, read_fn read)
+{
+	gp_pixmap *img = NULL;
+	gp_io *io;
+	int ret;
+
+	if (encode(pixel_type))
+		return TST_UNTESTED;
+
+	io = gp_io_mem(data, data_size, NULL);
+	if (!io)
+		return TST_UNTESTED;
+
+	ret = read(io, &img, NULL, NULL);
+
+	gp_io_close(io);
+
+	if (ret) {
+		tst_msg("Failed to decode PNG: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	gp_pixmap_free(img);
+
+	return TST_PASSED;
+}
+
+static int png_bench_rgb888_libpng(void)
+{
+	return decode(GP_PIXEL_RGB888, gp_read_png_ex);
+}
+
+static int png_bench_rgb888_internal(void)
+{
+	return decode(GP_PIXEL_RGB888, gp_read_png_int_ex);
+}
+
+static int png_bench_rgba8888_libpng(void)
+{
+	return decode(GP_PIXEL_RGBA8888, gp_read_png_ex);
+}
+
+static int png_bench_rgba8888_internal(void)
+{
+	return decode(GP_PIXEL_RGBA8888, gp_read_png_int_ex);
+}
+
+static int png_bench_g8_libpng(void)
+{
+	return decode(GP_PIXEL_G8, gp_read_png_ex);
+}
+
+static int png_bench_g8_internal(void)
+{
+	return decode(GP_PIXEL_G8, gp_read_png_int_ex);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "PNG decode benchmark",
+	.tests = {
+		{.name = "PNG decode RGB888 libpng",
+		 .tst_fn = png_bench_rgb888_libpng,
+		 .flags = TST_TMPDIR,
+		 .bench_iter = 20},
+
+		{.name = "PNG decode RGB888 internal",
+		 .tst_fn = png_bench_rgb888_internal,
+		 .flags = TST_TMPDIR,
+		 .bench_iter = 20},
+
+		{.name = "PNG decode RGBA8888 libpng",
+		 .tst_fn = png_bench_rgba8888_libpng,
+		 .flags = TST_TMPDIR,
+		 .bench_iter = 20},
+
+		{.name = "PNG decode RGBA8888 internal",
+		 .tst_fn = png_bench_rgba8888_internal,
+		 .flags = TST_TMPDIR,
+		 .bench_iter = 20},
+
+		{.name = "PNG decode G8 libpng",
+		 .tst_fn = png_bench_g8_libpng,
+		 .flags = TST_TMPDIR,
+		 .bench_iter = 20},
+
+		{.name = "PNG decode G8 internal",
+		 .tst_fn = png_bench_g8_internal,
+		 .flags = TST_TMPDIR,
+		 .bench_iter = 20},
+
+		{},
+	}
+};
@@ -110,6 +110,96 @@ static int no_images(const char *path)
 	return ret;
 }
 
+/*
+ * ZIP written with data descriptors, i.e. zero sizes in the local headers,
+ * containing a directory, a text file and four images.
+ */
+static struct test data_desc_imgs[] = {
+	{10, 20, "pages/01.ppm"},
+	{11, 21, "pages/02.ppm"},
+	{100, 100, "pages/03.jpeg"},
+	{12, 22, "pages/04.ppm"},
+};
+
+static int check_img(gp_container *zip, unsigned int i)
+{
+	struct test *test = &data_desc_imgs[i];
+	gp_pixmap *img = gp_container_load(zip, NULL);
+	int ret = 0;
+
+	if (!img) {
+		tst_msg("Failed to load '%s': %s", test->path, strerror(errno));
+		return 1;
+	}
+
+	if (img->w != test->w || img->h != test->h) {
+		tst_msg("Image '%s' has wrong size, expected %ux%u have %ux%u",
+		        test->path, test->w, test->h, img->w, img->h);
+		ret = 1;
+	}
+
+	if (zip->cur_img != i) {
+		tst_msg("Wrong current image %u expected %u", zip->cur_img, i);
+		ret = 1;
+	}
+
+	gp_pixmap_free(img);
+
+	return ret;
+}
+
+static int data_desc_seek(const char *path)
+{
+	gp_container *zip = gp_open_zip(path);
+	unsigned int i;
+	int ret = TST_FAILED;
+
+	if (!zip) {
+		if (errno == ENOSYS) {
+			tst_msg("Zlib support not compiled in?");
+			return TST_UNTESTED;
+		}
+
+		tst_msg("Failed to open zip");
+		return TST_FAILED;
+	}
+
+	if (zip->img_count != 4) {
+		tst_msg("Wrong image count %u", zip->img_count);
+		goto exit;
+	}
+
+	/* Backwards from the end */
+	for (i = 4; i > 0; i--) {
+		if (gp_container_seek(zip, (ssize_t)i - 5, GP_SEEK_END)) {
+			tst_msg("Failed to seek to %u: %s", i - 1, strerror(errno));
+			goto exit;
+		}
+
+		if (check_img(zip, i - 1))
+			goto exit;
+	}
+
+	if (gp_container_seek(zip, 2, GP_SEEK_SET) ||
+	    gp_container_seek(zip, 1, GP_SEEK_CUR)) {
+		tst_msg("Failed to seek: %s", strerror(errno));
+		goto exit;
+	}
+
+	if (check_img(zip, 3))
+		goto exit;
+
+	if (!gp_container_seek(zip, 1, GP_SEEK_CUR)) {
+		tst_msg("Seek past the last image succeeded");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_container_close(zip);
+	return ret;
+}
+
 const struct tst_suite tst_suite = {
 	.suite_name = "ZIP",
 	.tests = {
@@ -137,6 +227,12 @@ const struct tst_suite tst_suite = {
 		 .data = "no_images.zip",
 		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
 
+		{.name = "Seek in ZIP with data descriptors",
+		 .tst_fn = data_desc_seek,
+		 .res_path = "data/zip/valid/data_desc.zip",
+		 .data = "data_desc.zip",
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
 		{.name = NULL},
 	}
 };
@@ -32,6 +32,20 @@ static int render_text_1bpp(void)
 	return render_text(NULL);
 }
 
+static int render_text_1bpp_cached(void)
+{
+	int ret;
+
+	if (gp_text_cache_init(0))
+		return TST_UNTESTED;
+
+	ret = render_text(NULL);
+
+	gp_text_cache_exit();
+
+	return ret;
+}
+
 static int render_text_1bpp_mul(void)
 {
 	gp_text_style style = {
@@ -69,6 +83,10 @@ const struct tst_suite tst_suite = {
 		 .flags = TST_TMPDIR | TST_CHECK_MALLOC,
 	         .bench_iter = 25},
 
+		{.name = "text 1BPP cached", .tst_fn = render_text_1bpp_cached,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC,
+	         .bench_iter = 25},
+
 		{.name = "text 1BPP xmul ymul", .tst_fn = render_text_1bpp_mul,
 		 .flags = TST_TMPDIR | TST_CHECK_MALLOC,
 	         .bench_iter = 25},
@@ -0,0 +1,329 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <string.h>
+#include <pthread.h>
+#include <core/gp_core.h>
+#include <text/gp_text.h>
+#include "tst_test.h"
+
+static const char *strs[] = {
+	"a",
+	"Hello World!",
+	"jJ_.,;{}|",
+	" Příliš žluťoučký kůň",
+	"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ1234567890",
+};
+
+static gp_text_style styles[] = {
+	GP_DEFAULT_TEXT_STYLE,
+	{
+		.font = &gp_default_font,
+		.pixel_xmul = 2,
+		.pixel_ymul = 2,
+		.pixel_xspace = 1,
+		.pixel_yspace = 1,
+		.char_xspace = 1,
+	},
+	{
+		.font = &gp_default_font,
+		.pixel_xmul = 3,
+		.pixel_ymul = 3,
+		.pixel_xspace = -1,
+		.pixel_yspace = -1,
+	},
+};
+
+struct metrics {
+	gp_size wbbox[64];
+	gp_size wadv[64];
+	size_t fit[64];
+	gp_size cur_pos[64];
+};
+
+static void get_metrics(const gp_text_style *style, const char *str, struct metrics *m)
+{
+	unsigned int i;
+
+	for (i = 0; i < 64; i++) {
+		m->wbbox[i] = gp_text_width_len(style, GP_TEXT_LEN_BBOX, str, i);
+		m->wadv[i] = gp_text_width_len(style, GP_TEXT_LEN_ADVANCE, str, i);
+		m->fit[i] = gp_text_fit_width(style, str, 10 * i);
+		m->cur_pos[i] = gp_text_cur_pos(style, str, 10 * i);
+	}
+}
+
+static int text_cache_metric(void)
+{
+	unsigned int i, j;
+	struct metrics ref, cached;
+	gp_text_cache_stats stats;
+
+	for (i = 0; i < GP_ARRAY_SIZE(styles); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(strs); j++) {
+			get_metrics(&styles[i], strs[j], &ref);
+
+			if (gp_text_cache_init(0)) {
+				tst_msg("Failed to initialize text cache");
+				return TST_UNTESTED;
+			}
+
+			/* Fills the cache then hits it */
+			get_metrics(&styles[i], strs[j], &cached);
+			get_metrics(&styles[i], strs[j], &cached);
+
+			gp_text_cache_stats_get(&stats);
+			gp_text_cache_exit();
+
+			if (memcmp(&ref, &cached, sizeof(ref))) {
+				tst_msg("Metrics differ for style %u string '%s'", i, strs[j]);
+				return TST_FAILED;
+			}
+
+			if (!stats.hits) {
+				tst_msg("No cache hits for style %u string '%s'", i, strs[j]);
+				return TST_FAILED;
+			}
+		}
+	}
+
+	return TST_PASSED;
+}
+
+static void render(gp_pixmap *pix, const gp_text_style *style)
+{
+	unsigned int i;
+
+	gp_fill(pix, 0);
+
+	for (i = 0; i < GP_ARRAY_SIZE(strs); i++) {
+		gp_text(pix, style, 5, 5 + 30 * i, GP_ALIGN_RIGHT | GP_VALIGN_BELOW,
+		        0xffffff, 0x000000, strs[i]);
+		gp_text_ext(pix, style, 5, 150 + 30 * i, GP_ALIGN_RIGHT | GP_VALIGN_BELOW,
+		            0xffffff, 0x000000, strs[i], 3);
+	}
+}
+
+static int text_cache_render(void)
+{
+	unsigned int i;
+	int ret = TST_PASSED;
+	gp_pixmap *ref = gp_pixmap_alloc(800, 300, GP_PIXEL_RGB888);
+	gp_pixmap *cached = gp_pixmap_alloc(800, 300, GP_PIXEL_RGB888);
+
+	if (!ref || !cached) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	for (i = 0; i < GP_ARRAY_SIZE(styles); i++) {
+		render(ref, &styles[i]);
+
+		gp_text_cache_init(0);
+		render(cached, &styles[i]);
+		render(cached, &styles[i]);
+		gp_text_cache_exit();
+
+		if (!gp_pixmap_equal(ref, cached)) {
+			tst_msg("Rendered text differs for style %u", i);
+			ret = TST_FAILED;
+			goto exit;
+		}
+	}
+
+exit:
+	gp_pixmap_free(ref);
+	gp_pixmap_free(cached);
+	return ret;
+}
+
+static int text_cache_style_change(void)
+{
+	gp_text_style style = GP_DEFAULT_TEXT_STYLE;
+	gp_text_cache_stats stats;
+	gp_size ref1, ref2, w1, w2;
+	int ret = TST_PASSED;
+
+	ref1 = gp_text_wbbox(&style, "Hello World!");
+	style.pixel_xmul = 2;
+	ref2 = gp_text_wbbox(&style, "Hello World!");
+	style.pixel_xmul = 1;
+
+	gp_text_cache_init(0);
+
+	/* Style modified in place must not hit the stale run */
+	w1 = gp_text_wbbox(&style, "Hello World!");
+	style.pixel_xmul = 2;
+	w2 = gp_text_wbbox(&style, "Hello World!");
+
+	if (w1 != ref1 || w2 != ref2) {
+		tst_msg("Wrong width after style change %u %u expected %u %u",
+		        w1, w2, ref1, ref2);
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	gp_text_cache_flush(&gp_default_font);
+	gp_text_cache_stats_get(&stats);
+
+	if (stats.used) {
+		tst_msg("Runs for font not dropped on flush");
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_text_cache_exit();
+	return ret;
+}
+
+/*
+ * NULL style is the default style and shares the runs with it.
+ */
+static int text_cache_null_style(void)
+{
+	gp_text_style style = GP_DEFAULT_TEXT_STYLE;
+	gp_text_cache_stats stats;
+	int ret = TST_PASSED;
+
+	gp_text_cache_init(0);
+
+	if (!gp_text_run_get(NULL, "Hello World!")) {
+		tst_msg("Run for NULL style not shaped");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	gp_text_run_get(&style, "Hello World!");
+	gp_text_cache_stats_get(&stats);
+
+	if (stats.hits != 1 || stats.misses != 1 || stats.used != 1) {
+		tst_msg("Got hits=%lu misses=%lu used=%u expected 1 1 1",
+		        stats.hits, stats.misses, stats.used);
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_text_cache_exit();
+	return ret;
+}
+
+static void *flush_thread(void *font)
+{
+	gp_text_cache_flush(font);
+
+	return NULL;
+}
+
+static int text_cache_flush_thread(void)
+{
+	gp_text_cache_stats stats;
+	pthread_t thread;
+	int ret = TST_PASSED;
+
+	gp_text_cache_init(0);
+
+	gp_text_wbbox(NULL, "Hello World!");
+	gp_text_wbbox(NULL, "Hello");
+
+	/* A font freed from a different thread has to invalidate our runs */
+	if (pthread_create(&thread, NULL, flush_thread, (void*)&gp_default_font)) {
+		tst_msg("Failed to create thread");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	pthread_join(thread, NULL);
+
+	gp_text_wbbox(NULL, "World");
+	gp_text_cache_stats_get(&stats);
+
+	if (stats.used != 1) {
+		tst_msg("Stale runs kept after flush from other thread, used %u",
+		        stats.used);
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_text_cache_exit();
+	return ret;
+}
+
+#define FT_FONT "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf"
+
+/*
+ * FreeType font faces keep only a few glyphs rendered and free the glyphs they
+ * evict, strings with many distinct glyphs must not hold on the freed ones.
+ */
+static const char *ft_strs[] = {
+	"ěščřžýáíéůú",
+	"ĚŠČŘŽÝÁÍÉŮÚ ěščřžýáíéůú",
+	"ΑΒΓΔΕΖΗΘΙΚΛΜΝΞΟΠΡΣΤΥΦΧΨΩ",
+};
+
+static int text_cache_free_type(void)
+{
+	gp_text_style style = GP_DEFAULT_TEXT_STYLE;
+	gp_size ref_bbox[GP_ARRAY_SIZE(ft_strs)], ref_adv[GP_ARRAY_SIZE(ft_strs)];
+	gp_font_face *font;
+	unsigned int i, j;
+	int ret = TST_PASSED;
+
+	font = gp_font_face_load(FT_FONT, 0, 16);
+	if (!font) {
+		tst_msg("Failed to load " FT_FONT);
+		return TST_SKIPPED;
+	}
+
+	style.font = font;
+
+	for (i = 0; i < GP_ARRAY_SIZE(ft_strs); i++) {
+		ref_bbox[i] = gp_text_wbbox(&style, ft_strs[i]);
+		ref_adv[i] = gp_text_width_len(&style, GP_TEXT_LEN_ADVANCE, ft_strs[i], 100);
+	}
+
+	gp_text_cache_init(0);
+
+	for (j = 0; j < 3; j++) {
+		for (i = 0; i < GP_ARRAY_SIZE(ft_strs); i++) {
+			gp_size bbox = gp_text_wbbox(&style, ft_strs[i]);
+			gp_size adv = gp_text_width_len(&style, GP_TEXT_LEN_ADVANCE, ft_strs[i], 100);
+
+			if (bbox != ref_bbox[i] || adv != ref_adv[i]) {
+				tst_msg("Width differs for '%s' %u %u expected %u %u",
+				        ft_strs[i], bbox, adv, ref_bbox[i], ref_adv[i]);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_text_cache_exit();
+	gp_font_face_free(font);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Text run cache",
+	.tests = {
+		{.name = "text cache metric", .tst_fn = text_cache_metric,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "text cache render", .tst_fn = text_cache_render,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "text cache style change", .tst_fn = text_cache_style_change,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "text cache NULL style", .tst_fn = text_cache_null_style,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "text cache flush from thread", .tst_fn = text_cache_flush_thread},
+
+		{.name = "text cache FreeType", .tst_fn = text_cache_free_type},
+
+		{.name = NULL},
+	}
+};
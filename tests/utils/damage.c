@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <utils/gp_damage.h>
+#include "tst_test.h"
+
+static int rects_overlap(gp_bbox a, gp_bbox b)
+{
+	gp_bbox i = gp_bbox_intersection(a, b);
+
+	return (gp_coord)i.w > 0 && (gp_coord)i.h > 0;
+}
+
+static int contains(gp_bbox a, gp_bbox b)
+{
+	return a.x <= b.x && a.y <= b.y &&
+	       a.x + (gp_coord)a.w >= b.x + (gp_coord)b.w &&
+	       a.y + (gp_coord)a.h >= b.y + (gp_coord)b.h;
+}
+
+/*
+ * Checks that rectangles do not overlap and that each of the added rectangles
+ * is covered by one of them.
+ */
+static int check_damage(gp_damage *damage, const gp_bbox *added, unsigned int cnt)
+{
+	unsigned int i, j;
+
+	for (i = 0; i < damage->cnt; i++) {
+		for (j = i + 1; j < damage->cnt; j++) {
+			if (rects_overlap(damage->rects[i], damage->rects[j])) {
+				tst_msg("Rects " GP_BBOX_FMT " and " GP_BBOX_FMT " overlap",
+				        GP_BBOX_PARS(damage->rects[i]),
+				        GP_BBOX_PARS(damage->rects[j]));
+				return 1;
+			}
+		}
+	}
+
+	for (i = 0; i < cnt; i++) {
+		if (gp_bbox_empty(added[i]))
+			continue;
+
+		for (j = 0; j < damage->cnt; j++) {
+			if (contains(damage->rects[j], added[i]))
+				break;
+		}
+
+		if (j == damage->cnt) {
+			tst_msg("Rect " GP_BBOX_FMT " not covered",
+			        GP_BBOX_PARS(added[i]));
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int damage_add(const gp_bbox *rects, unsigned int cnt,
+                      unsigned int exp_cnt)
+{
+	gp_damage damage = {};
+	unsigned int i;
+
+	for (i = 0; i < cnt; i++)
+		gp_damage_add(&damage, rects[i]);
+
+	if (damage.cnt != exp_cnt) {
+		tst_msg("Wrong number of rects %u expected %u", damage.cnt, exp_cnt);
+		return TST_FAILED;
+	}
+
+	if (check_damage(&damage, rects, cnt))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int damage_corners(void)
+{
+	static const gp_bbox rects[] = {
+		{.x = 0, .y = 0, .w = 10, .h = 10},
+		{.x = 990, .y = 990, .w = 10, .h = 10},
+	};
+
+	return damage_add(rects, GP_ARRAY_SIZE(rects), 2);
+}
+
+static int damage_overlap(void)
+{
+	static const gp_bbox rects[] = {
+		{.x = 0, .y = 0, .w = 100, .h = 10},
+		{.x = 500, .y = 0, .w = 10, .h = 100},
+		{.x = 0, .y = 500, .w = 100, .h = 10},
+		/* Overlaps the first and the third, the result overlaps second */
+		{.x = 50, .y = 5, .w = 500, .h = 500},
+	};
+
+	return damage_add(rects, GP_ARRAY_SIZE(rects), 1);
+}
+
+static int damage_adjacent(void)
+{
+	static const gp_bbox rects[] = {
+		{.x = 0, .y = 0, .w = 100, .h = 20},
+		{.x = 0, .y = 20, .w = 100, .h = 20},
+		{.x = 100, .y = 0, .w = 50, .h = 40},
+		{.x = 500, .y = 500, .w = 1, .h = 1},
+	};
+
+	return damage_add(rects, GP_ARRAY_SIZE(rects), 2);
+}
+
+static int damage_empty(void)
+{
+	static const gp_bbox rects[] = {
+		{.x = 0, .y = 0, .w = 0, .h = 20},
+		{.x = 10, .y = 10, .w = 20, .h = 0},
+	};
+
+	return damage_add(rects, GP_ARRAY_SIZE(rects), 0);
+}
+
+static int damage_full(void)
+{
+	gp_bbox rects[GP_DAMAGE_RECTS + 1];
+	unsigned int i;
+
+	/* Rectangles far apart, the last one has to be merged */
+	for (i = 0; i < GP_ARRAY_SIZE(rects); i++)
+		rects[i] = gp_bbox_pack(100 * i, 100 * i, 10, 10);
+
+	return damage_add(rects, GP_ARRAY_SIZE(rects), GP_DAMAGE_RECTS);
+}
+
+static int damage_bbox(void)
+{
+	gp_damage damage = {};
+	gp_bbox bbox;
+
+	gp_damage_add(&damage, gp_bbox_pack(10, 20, 10, 10));
+	gp_damage_add(&damage, gp_bbox_pack(100, 5, 10, 10));
+
+	bbox = gp_damage_bbox(&damage);
+
+	if (bbox.x != 10 || bbox.y != 5 || bbox.w != 100 || bbox.h != 25) {
+		tst_msg("Wrong bbox " GP_BBOX_FMT, GP_BBOX_PARS(bbox));
+		return TST_FAILED;
+	}
+
+	gp_damage_clear(&damage);
+
+	if (!gp_damage_empty(&damage)) {
+		tst_msg("Damage not empty after clear");
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "damage testsuite",
+	.tests = {
+		{.name = "damage corners",
+		 .tst_fn = damage_corners},
+
+		{.name = "damage overlap",
+		 .tst_fn = damage_overlap},
+
+		{.name = "damage adjacent",
+		 .tst_fn = damage_adjacent},
+
+		{.name = "damage empty",
+		 .tst_fn = damage_empty},
+
+		{.name = "damage full",
+		 .tst_fn = damage_full},
+
+		{.name = "damage bbox",
+		 .tst_fn = damage_bbox},
+
+		{.name = NULL},
+	}
+};
@@ -8,6 +8,7 @@
 
 #include <backends/gp_backend.h>
 #include <backends/gp_clipboard.h>
+#include "tst_test.h"
 
 static gp_events_state events_state = {};
 
@@ -27,6 +28,55 @@ static inline void dummy_render(gp_widget *widget)
 	gp_widget_ops_render(widget, &dummy_offset, &dummy_ctx, 0);
 }
 
+/* A color that is not used by the widgets */
+#define MARKER 0x00ff00
+
+static inline gp_pixmap *render_buf_new(gp_size w, gp_size h)
+{
+	gp_pixmap *buf = gp_pixmap_alloc(w, h, GP_PIXEL_RGB888);
+
+	if (buf)
+		gp_fill(buf, 0);
+
+	return buf;
+}
+
+static inline int render_buf_cmp(gp_pixmap *buf, gp_pixmap *ref_buf)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)buf->h; y++) {
+		for (x = 0; x < (gp_coord)buf->w; x++) {
+			gp_pixel p = gp_getpixel(buf, x, y);
+			gp_pixel ref_p = gp_getpixel(ref_buf, x, y);
+
+			if (p != ref_p) {
+				tst_msg("Pixel %ix%i %06x expected %06x",
+				        x, y, p, ref_p);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Checks that a marker put into the buffer before rendering was moved along
+ * with the content rather than rendered over.
+ */
+static inline int marker_check(gp_pixmap *buf, gp_coord x, gp_coord y)
+{
+	gp_pixel p = gp_getpixel(buf, x, y);
+
+	if (p != MARKER) {
+		tst_msg("Marker not moved, pixel %06x", p);
+		return 1;
+	}
+
+	return 0;
+}
+
 static inline void state_press(int key)
 {
 	gp_events_state_press(&events_state, key);
@@ -116,4 +166,28 @@ static inline void paste_event(gp_widget *widget)
  */
 void gp_widgets_backend_set(gp_backend *backend);
 
+/**
+ * @brief Runs the frame scheduler.
+ *
+ * Renders the layout or schedules the frame timer, this is what the widgets
+ * main loop does after the events were processed. This function is useful
+ * only for testing.
+ *
+ * @layout A widget layout.
+ */
+void gp_widgets_frame_redraw(gp_widget *layout);
+
+/**
+ * @brief Passes an input event to the widgets.
+ *
+ * This is what the widgets main loop does for each event. This function is
+ * useful only for testing.
+ *
+ * @ev An input event.
+ * @layout A widget layout.
+ *
+ * @return Non-zero if application should exit.
+ */
+int gp_widgets_event(gp_event *ev, gp_widget *layout);
+
 #endif /* TESTS_COMMON_H__ */
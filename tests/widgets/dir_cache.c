@@ -0,0 +1,293 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <widgets/gp_dir_cache.h>
+#include "tst_test.h"
+
+#define FILES 5000
+#define DIRS 10
+#define NEW_FILES 200
+
+static int create_files(void)
+{
+	char name[64];
+	unsigned int i;
+
+	for (i = 0; i < FILES; i++) {
+		FILE *f;
+
+		snprintf(name, sizeof(name), "file_%05u_with_a_long_name", i);
+
+		f = fopen(name, "w");
+		if (!f) {
+			tst_msg("fopen(%s): %s", name, strerror(errno));
+			return 1;
+		}
+
+		/* File size is the file number, checks that stat() was done */
+		fprintf(f, "%*s", (int)i, "");
+		fclose(f);
+	}
+
+	for (i = 0; i < DIRS; i++) {
+		snprintf(name, sizeof(name), "dir_%02u", i);
+
+		if (mkdir(name, 0755)) {
+			tst_msg("mkdir(%s): %s", name, strerror(errno));
+			return 1;
+		}
+	}
+
+	/* A symlink to a directory has to be listed as a directory */
+	if (symlink("dir_00", "link_dir")) {
+		tst_msg("symlink(): %s", strerror(errno));
+		return 1;
+	}
+
+	return 0;
+}
+
+static int check_entries(gp_dir_cache *cache, int sort_type)
+{
+	size_t i, entries = gp_dir_cache_entries(cache);
+
+	if (entries != FILES + DIRS + 2) {
+		tst_msg("Wrong number of entries %zu expected %u",
+		        entries, FILES + DIRS + 2);
+		return 1;
+	}
+
+	if (strcmp(gp_dir_cache_get(cache, 0)->name, "../")) {
+		tst_msg("First entry '%s' expected '../'",
+		        gp_dir_cache_get(cache, 0)->name);
+		return 1;
+	}
+
+	for (i = 1; i < entries; i++) {
+		gp_dir_entry *entry = gp_dir_cache_get(cache, i);
+		unsigned int nr;
+
+		if (entry->stat_pending) {
+			tst_msg("Entry '%s' stat pending", entry->name);
+			return 1;
+		}
+
+		if (sscanf(entry->name, "file_%u", &nr) == 1 && entry->size != nr) {
+			tst_msg("Entry '%s' has size %zu", entry->name, entry->size);
+			return 1;
+		}
+
+		if (!strcmp(entry->name, "link_dir") || !strcmp(entry->name, "link_dir/")) {
+			if (!entry->is_dir) {
+				tst_msg("Symlink to directory is not a directory");
+				return 1;
+			}
+		}
+
+		if (i < 2)
+			continue;
+
+		gp_dir_entry *prev = gp_dir_cache_get(cache, i-1);
+		int wrong_order = 0;
+
+		switch (sort_type) {
+		case GP_DIR_SORT_ASC | GP_DIR_SORT_BY_NAME:
+			wrong_order = strcmp(prev->name, entry->name) > 0;
+		break;
+		case GP_DIR_SORT_DESC | GP_DIR_SORT_BY_NAME:
+			wrong_order = strcmp(prev->name, entry->name) < 0;
+		break;
+		case GP_DIR_SORT_DESC | GP_DIR_SORT_BY_SIZE:
+			wrong_order = prev->size < entry->size;
+		break;
+		default:
+		break;
+		}
+
+		if (wrong_order) {
+			tst_msg("Wrong order '%s' '%s'", prev->name, entry->name);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int dir_cache_populate(gp_dir_cache_sort_type *sort_type)
+{
+	gp_dir_cache *cache;
+	unsigned int calls = 0;
+	int ret = TST_PASSED;
+
+	if (create_files())
+		return TST_UNTESTED;
+
+	cache = gp_dir_cache_new(".");
+	if (!cache) {
+		tst_msg("Failed to create dir cache");
+		return TST_FAILED;
+	}
+
+	if (gp_dir_cache_entries(cache) >= FILES) {
+		tst_msg("Whole directory was loaded in gp_dir_cache_new()");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	/* The sort order is kept while the rest of entries is merged in */
+	gp_dir_cache_sort(cache, *sort_type);
+
+	while (gp_dir_cache_populate(cache))
+		calls++;
+
+	tst_msg("Loaded in %u gp_dir_cache_populate() calls", calls);
+
+	if (check_entries(cache, *sort_type))
+		ret = TST_FAILED;
+
+exit:
+	gp_dir_cache_destroy(cache);
+	return ret;
+}
+
+/*
+ * Files created while the directory is being loaded are reported by inotify
+ * and may be returned by getdents64() as well, they must not be duplicated.
+ */
+static int dir_cache_created_while_loading(void)
+{
+	gp_dir_cache *cache;
+	char name[64];
+	unsigned int i;
+	size_t entries;
+	int ret = TST_PASSED;
+
+	if (create_files())
+		return TST_UNTESTED;
+
+	cache = gp_dir_cache_new(".");
+	if (!cache) {
+		tst_msg("Failed to create dir cache");
+		return TST_FAILED;
+	}
+
+	for (i = 0; i < NEW_FILES; i++) {
+		FILE *f;
+
+		snprintf(name, sizeof(name), "new_%03u", i);
+
+		f = fopen(name, "w");
+		if (!f) {
+			tst_msg("fopen(%s): %s", name, strerror(errno));
+			ret = TST_UNTESTED;
+			goto exit;
+		}
+
+		fclose(f);
+	}
+
+	gp_dir_cache_notify(cache);
+
+	while (gp_dir_cache_populate(cache));
+
+	gp_dir_cache_sort(cache, GP_DIR_SORT_ASC | GP_DIR_SORT_BY_NAME);
+
+	entries = gp_dir_cache_entries(cache);
+
+	for (i = 1; i < entries; i++) {
+		const char *prev = gp_dir_cache_get(cache, i-1)->name;
+		const char *cur = gp_dir_cache_get(cache, i)->name;
+
+		if (!strcmp(prev, cur)) {
+			tst_msg("Duplicate entry '%s'", cur);
+			ret = TST_FAILED;
+			goto exit;
+		}
+	}
+
+	if (entries != FILES + DIRS + 2 + NEW_FILES) {
+		tst_msg("Wrong number of entries %zu expected %u",
+		        entries, FILES + DIRS + 2 + NEW_FILES);
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_dir_cache_destroy(cache);
+	return ret;
+}
+
+static int dir_cache_small(void)
+{
+	gp_dir_cache *cache;
+	gp_dir_entry *entry;
+	int ret = TST_PASSED;
+	FILE *f;
+
+	f = fopen("file", "w");
+	if (!f)
+		return TST_UNTESTED;
+
+	fprintf(f, "0123456789");
+	fclose(f);
+
+	cache = gp_dir_cache_new(".");
+	if (!cache) {
+		tst_msg("Failed to create dir cache");
+		return TST_FAILED;
+	}
+
+	if (gp_dir_cache_populate(cache)) {
+		tst_msg("Small directory was not loaded in gp_dir_cache_new()");
+		ret = TST_FAILED;
+	}
+
+	entry = gp_dir_cache_get(cache, 1);
+	if (!entry || strcmp(entry->name, "file") || entry->size != 10) {
+		tst_msg("Wrong entry");
+		ret = TST_FAILED;
+	}
+
+	gp_dir_cache_destroy(cache);
+	return ret;
+}
+
+static gp_dir_cache_sort_type asc_name = GP_DIR_SORT_ASC | GP_DIR_SORT_BY_NAME;
+static gp_dir_cache_sort_type desc_name = GP_DIR_SORT_DESC | GP_DIR_SORT_BY_NAME;
+static gp_dir_cache_sort_type desc_size = GP_DIR_SORT_DESC | GP_DIR_SORT_BY_SIZE;
+
+const struct tst_suite tst_suite = {
+	.suite_name = "dir cache testsuite",
+	.tests = {
+		{.name = "dir cache small",
+		 .tst_fn = dir_cache_small,
+		 .flags = TST_TMPDIR},
+
+		{.name = "dir cache populate name asc",
+		 .tst_fn = dir_cache_populate,
+		 .data = &asc_name,
+		 .flags = TST_TMPDIR},
+
+		{.name = "dir cache populate name desc",
+		 .tst_fn = dir_cache_populate,
+		 .data = &desc_name,
+		 .flags = TST_TMPDIR},
+
+		{.name = "dir cache populate size desc",
+		 .tst_fn = dir_cache_populate,
+		 .data = &desc_size,
+		 .flags = TST_TMPDIR},
+
+		{.name = "dir cache files created while loading",
+		 .tst_fn = dir_cache_created_while_loading,
+		 .flags = TST_TMPDIR},
+
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+ * Frame scheduler tests.
+ *
+ * The scheduler runs against a fake clock, the test defines gp_time_stamp()
+ * which takes precedence over the library one. The backend pixmap is empty so
+ * that the frames are accounted for but nothing is rendered.
+ */
+
+#include <string.h>
+#include <input/gp_time_stamp.h>
+#include <widgets/gp_widgets.h>
+#include "tst_test.h"
+#include "common.h"
+
+static uint64_t fake_clock = 1000;
+
+uint64_t gp_time_stamp(void)
+{
+	return fake_clock;
+}
+
+static gp_pixmap empty_pixmap;
+
+static gp_backend frame_backend = {
+	.name = "Frame backend",
+	.pixmap = &empty_pixmap,
+};
+
+static gp_widget *frame_sched_init(void)
+{
+	gp_widget *layout;
+
+	gp_widgets_backend_set(&frame_backend);
+
+	layout = gp_widget_label_new("Frame", 0, 0);
+	if (!layout) {
+		tst_msg("Allocation failure");
+		return NULL;
+	}
+
+	layout->redraw = 1;
+
+	return layout;
+}
+
+static int check_stats(unsigned long frames, unsigned long immediate,
+                       unsigned long coalesced)
+{
+	const gp_widgets_frame_stats *stats = gp_widgets_frame_stats_get();
+
+	if (stats->frames != frames || stats->immediate != immediate ||
+	    stats->coalesced != coalesced) {
+		tst_msg("Got frames=%lu immediate=%lu coalesced=%lu "
+		        "expected %lu %lu %lu", stats->frames, stats->immediate,
+		        stats->coalesced, frames, immediate, coalesced);
+		return 1;
+	}
+
+	if (stats->last_us > stats->max_us || stats->max_us > stats->total_us) {
+		tst_msg("Wrong frame times last=%u max=%u total=%llu",
+		        stats->last_us, stats->max_us,
+		        (unsigned long long)stats->total_us);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int check_timer(uint64_t expires)
+{
+	if (!frame_backend.timers) {
+		if (expires) {
+			tst_msg("Frame timer not running");
+			return 1;
+		}
+
+		return 0;
+	}
+
+	if (!expires) {
+		tst_msg("Frame timer running");
+		return 1;
+	}
+
+	if (frame_backend.timers->expires != expires) {
+		tst_msg("Frame timer expires at %llu expected %llu",
+		        (unsigned long long)frame_backend.timers->expires,
+		        (unsigned long long)expires);
+		return 1;
+	}
+
+	return 0;
+}
+
+static void advance(uint64_t ms)
+{
+	fake_clock += ms;
+	gp_timer_queue_process(&frame_backend.timers, fake_clock);
+}
+
+/*
+ * Redraw requests that come in before the frame interval has passed are
+ * merged into a frame rendered by the frame timer.
+ */
+static int frame_interval(void)
+{
+	gp_widget *layout = frame_sched_init();
+	int ret = TST_FAILED;
+
+	if (!layout)
+		return TST_FAILED;
+
+	gp_widgets_frame_interval_set(20);
+
+	gp_widgets_frame_redraw(layout);
+	if (check_stats(1, 0, 0) || check_timer(0))
+		goto exit;
+
+	advance(5);
+	gp_widgets_frame_redraw(layout);
+	if (check_stats(1, 0, 1) || check_timer(1020))
+		goto exit;
+
+	advance(5);
+	gp_widgets_frame_redraw(layout);
+	if (check_stats(1, 0, 2) || check_timer(1020))
+		goto exit;
+
+	advance(10);
+	gp_widgets_frame_redraw(layout);
+	if (check_stats(2, 0, 2) || check_timer(0))
+		goto exit;
+
+	/* Zero interval renders on each wakeup */
+	gp_widgets_frame_interval_set(0);
+
+	advance(1);
+	gp_widgets_frame_redraw(layout);
+	if (check_stats(3, 0, 2) || check_timer(0))
+		goto exit;
+
+	/* Nothing to redraw, nothing rendered */
+	layout->redraw = 0;
+	gp_widgets_frame_redraw(layout);
+	if (check_stats(3, 0, 2))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(layout);
+	return ret;
+}
+
+static void send_event(gp_widget *layout, uint16_t type, uint16_t code, int32_t val)
+{
+	gp_event ev = {
+		.type = type,
+		.code = code,
+		.val = val,
+		.time = fake_clock,
+		.st = &events_state,
+	};
+
+	gp_widgets_event(&ev, layout);
+}
+
+/*
+ * Key and button events are rendered right away in the immediate mode,
+ * pointer motion is paced.
+ */
+static int frame_immediate(int *immediate)
+{
+	gp_widget *layout = frame_sched_init();
+	int ret = TST_FAILED;
+	unsigned long imm = *immediate ? 1 : 0;
+
+	if (!layout)
+		return TST_FAILED;
+
+	gp_widgets_frame_interval_set(20);
+	gp_widgets_frame_immediate_set(*immediate);
+
+	gp_widgets_frame_redraw(layout);
+	if (check_stats(1, 0, 0))
+		goto exit;
+
+	advance(1);
+	send_event(layout, GP_EV_REL, GP_EV_REL_POS, 0);
+	gp_widgets_frame_redraw(layout);
+	if (check_stats(1, 0, 1) || check_timer(1020))
+		goto exit;
+
+	advance(1);
+	send_event(layout, GP_EV_KEY, GP_EV_KEY_DOWN, GP_BTN_RIGHT);
+	gp_widgets_frame_redraw(layout);
+	if (check_stats(1 + imm, imm, 2 - imm) || check_timer(imm ? 0 : 1020))
+		goto exit;
+
+	advance(1);
+	send_event(layout, GP_EV_KEY, GP_EV_KEY_UP, GP_KEY_A);
+	gp_widgets_frame_redraw(layout);
+	if (check_stats(1 + 2 * imm, 2 * imm, 3 - 2 * imm))
+		goto exit;
+
+	advance(1);
+	send_event(layout, GP_EV_ABS, GP_EV_ABS_POS, 0);
+	gp_widgets_frame_redraw(layout);
+	if (check_stats(1 + 2 * imm, 2 * imm, 4 - 2 * imm))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(layout);
+	return ret;
+}
+
+static int immediate_on = 1;
+static int immediate_off = 0;
+
+const struct tst_suite tst_suite = {
+	.suite_name = "frame scheduler testsuite",
+	.tests = {
+		{.name = "frame interval",
+		 .tst_fn = frame_interval},
+
+		{.name = "frame immediate",
+		 .tst_fn = frame_immediate,
+		 .data = &immediate_on},
+
+		{.name = "frame immediate disabled",
+		 .tst_fn = frame_immediate,
+		 .data = &immediate_off},
+
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,277 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <math.h>
+#include <widgets/gp_widgets.h>
+#include "tst_test.h"
+#include "common.h"
+
+#define W 120
+#define H 60
+#define POINTS 1000
+
+static gp_text_style font = {
+	.pixel_xmul = 1,
+	.pixel_ymul = 1,
+	.font = &gp_default_font,
+};
+
+static gp_widget_render_ctx ctx = {
+	.pixel_type = GP_PIXEL_RGB888,
+	.font = &font,
+	.padd = 2,
+	.text_color = 0xffffff,
+	.fg_color = 0x202020,
+	.fr_thick = 1,
+};
+
+struct graph_test {
+	enum gp_widget_graph_style style;
+	/* Points added between renders */
+	unsigned int step;
+	/* Set for a fixed y range */
+	int yrange;
+};
+
+static struct gp_widget_graph_point point(unsigned int i)
+{
+	struct gp_widget_graph_point ret = {
+		.x = i,
+		.y = sin(i * 0.05) + 0.3 * sin(i * 1.7),
+	};
+
+	return ret;
+}
+
+static gp_widget *graph_new(struct graph_test *t)
+{
+	gp_widget_size size_w = GP_WIDGET_SIZE(W, 0, 0);
+	gp_widget_size size_h = GP_WIDGET_SIZE(H, 0, 0);
+	gp_widget *graph = gp_widget_graph_new(size_w, size_h, NULL, NULL, POINTS);
+
+	if (!graph)
+		return NULL;
+
+	gp_widget_graph_style_set(graph, t->style);
+
+	if (t->yrange)
+		gp_widget_graph_yrange_set(graph, -1.5, 1.5);
+
+	return graph;
+}
+
+/*
+ * Renders a graph after every step points are added. If full is set the graph
+ * is rendered only once after all points are added.
+ */
+static gp_pixmap *render_graph(gp_widget *graph, unsigned int points,
+                               unsigned int step, int full)
+{
+	gp_pixmap *buf = render_buf_new(W, H);
+	unsigned int i;
+
+	if (!buf)
+		return NULL;
+
+	ctx.buf = buf;
+
+	for (i = 0; i < points; i++) {
+		gp_widget_graph_point_add(graph, point(i).x, point(i).y);
+
+		if (i == 0)
+			gp_widget_render(graph, &ctx, GP_WIDGET_RESIZE | GP_WIDGET_REDRAW);
+		else if (!full && (i % step) == 0)
+			gp_widget_render(graph, &ctx, 0);
+	}
+
+	gp_widget_render(graph, &ctx, full ? GP_WIDGET_REDRAW : 0);
+
+	return buf;
+}
+
+static int graph_scroll(struct graph_test *t)
+{
+	gp_widget *graph = graph_new(t);
+	gp_widget *ref_graph = graph_new(t);
+	gp_pixmap *buf = NULL, *ref_buf = NULL;
+	int ret = TST_FAILED;
+
+	if (!graph || !ref_graph) {
+		tst_msg("Allocation failure");
+		goto exit;
+	}
+
+	/* Fill the buffer and scroll it over twice */
+	buf = render_graph(graph, 3 * POINTS, t->step, 0);
+	ref_buf = render_graph(ref_graph, 3 * POINTS, t->step, 1);
+
+	if (!buf || !ref_buf) {
+		tst_msg("Allocation failure");
+		goto exit;
+	}
+
+	if (render_buf_cmp(buf, ref_buf))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(graph);
+	gp_widget_free(ref_graph);
+	gp_pixmap_free(buf);
+	gp_pixmap_free(ref_buf);
+	return ret;
+}
+
+/*
+ * With a fixed y range adding points only scrolls the graph, so a marker put
+ * into the middle of the graph has to be moved with the content.
+ */
+static int graph_content_moved(void)
+{
+	struct graph_test t = {.style = GP_WIDGET_GRAPH_LINE, .yrange = 1};
+	gp_widget *graph = graph_new(&t);
+	gp_pixmap *buf = NULL;
+	int ret = TST_FAILED;
+	unsigned int i;
+
+	if (!graph) {
+		tst_msg("Allocation failure");
+		goto exit;
+	}
+
+	buf = render_graph(graph, POINTS, POINTS, 1);
+	if (!buf) {
+		tst_msg("Allocation failure");
+		goto exit;
+	}
+
+	gp_putpixel(buf, W/2, 1, MARKER);
+
+	/* With 999/117 x per column 77 new points move the graph by 9 columns */
+	for (i = POINTS; i < POINTS + 77; i++)
+		gp_widget_graph_point_add(graph, point(i).x, point(i).y);
+
+	gp_widget_render(graph, &ctx, 0);
+
+	if (marker_check(buf, W/2 - 9, 1))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(graph);
+	gp_pixmap_free(buf);
+	return ret;
+}
+
+static int graph_points_add(void)
+{
+	struct graph_test t = {.style = GP_WIDGET_GRAPH_LINE};
+	struct gp_widget_graph_point points[2 * POINTS];
+	gp_widget *graph = graph_new(&t);
+	gp_widget *ref_graph = graph_new(&t);
+	gp_pixmap *buf = NULL, *ref_buf = NULL;
+	int ret = TST_FAILED;
+	unsigned int i;
+
+	if (!graph || !ref_graph) {
+		tst_msg("Allocation failure");
+		goto exit;
+	}
+
+	for (i = 0; i < 2 * POINTS; i++)
+		points[i] = point(i);
+
+	buf = render_buf_new(W, H);
+	ref_buf = render_graph(ref_graph, 2 * POINTS, POINTS, 1);
+
+	if (!buf || !ref_buf) {
+		tst_msg("Allocation failure");
+		goto exit;
+	}
+
+	/* Points that do not fit into the buffer are skipped */
+	gp_widget_graph_points_add(graph, points, 2 * POINTS);
+
+	ctx.buf = buf;
+	gp_widget_render(graph, &ctx, GP_WIDGET_RESIZE | GP_WIDGET_REDRAW);
+
+	if (render_buf_cmp(buf, ref_buf)) {
+		tst_msg("Batch added points differ");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(graph);
+	gp_widget_free(ref_graph);
+	gp_pixmap_free(buf);
+	gp_pixmap_free(ref_buf);
+	return ret;
+}
+
+static int graph_append_bench(void)
+{
+	static gp_widget *graph;
+	static unsigned int i;
+	unsigned int j;
+
+	if (!graph) {
+		graph = gp_widget_graph_new(GP_WIDGET_SIZE(W, 0, 0),
+		                            GP_WIDGET_SIZE(H, 0, 0),
+		                            NULL, NULL, 100000);
+		if (!graph)
+			return TST_UNTESTED;
+
+		gp_widget_graph_style_set(graph, GP_WIDGET_GRAPH_LINE);
+	}
+
+	for (j = 0; j < 1000; j++, i++)
+		gp_widget_graph_point_add(graph, point(i).x, point(i).y);
+
+	return TST_PASSED;
+}
+
+static struct graph_test line = {.style = GP_WIDGET_GRAPH_LINE, .step = 37, .yrange = 1};
+static struct graph_test point_ = {.style = GP_WIDGET_GRAPH_POINT, .step = 37, .yrange = 1};
+static struct graph_test fill = {.style = GP_WIDGET_GRAPH_FILL, .step = 37, .yrange = 1};
+static struct graph_test line_step = {.style = GP_WIDGET_GRAPH_LINE, .step = 1, .yrange = 1};
+static struct graph_test line_auto = {.style = GP_WIDGET_GRAPH_LINE, .step = 37};
+
+const struct tst_suite tst_suite = {
+	.suite_name = "graph testsuite",
+	.tests = {
+		{.name = "graph scroll line",
+		 .tst_fn = graph_scroll,
+		 .data = &line},
+
+		{.name = "graph scroll point",
+		 .tst_fn = graph_scroll,
+		 .data = &point_},
+
+		{.name = "graph scroll fill",
+		 .tst_fn = graph_scroll,
+		 .data = &fill},
+
+		{.name = "graph scroll line every point",
+		 .tst_fn = graph_scroll,
+		 .data = &line_step},
+
+		{.name = "graph scroll line autorange",
+		 .tst_fn = graph_scroll,
+		 .data = &line_auto},
+
+		{.name = "graph content moved",
+		 .tst_fn = graph_content_moved},
+
+		{.name = "graph points add",
+		 .tst_fn = graph_points_add},
+
+		{.name = "graph append 100k window",
+		 .tst_fn = graph_append_bench,
+		 .bench_iter = 100},
+
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <widgets/gp_widgets.h>
+#include "tst_test.h"
+#include "common.h"
+
+#define LINES 200
+#define MAX_LOGS 20
+
+static gp_text_style font = {
+	.pixel_xmul = 1,
+	.pixel_ymul = 1,
+	.font = &gp_default_font,
+};
+
+static gp_widget_render_ctx ctx = {
+	.pixel_type = GP_PIXEL_RGB888,
+	.font = &font,
+	.padd = 4,
+	.text_color = 0xffffff,
+	.fg_color = 0x202020,
+	.bg_color = 0x404040,
+	.fr_thick = 1,
+	.fr_round = 3,
+};
+
+static const char *line(unsigned int i)
+{
+	static char buf[128];
+
+	/* Every fifth line is long enough to be wrapped, some are empty */
+	switch (i % 5) {
+	case 0:
+		snprintf(buf, sizeof(buf), "Line %u is long enough to be wrapped %u times", i, i % 3 + 1);
+	break;
+	case 4:
+		buf[0] = 0;
+	break;
+	default:
+		snprintf(buf, sizeof(buf), "Line %u", i);
+	}
+
+	return buf;
+}
+
+static gp_widget *log_new(void)
+{
+	return gp_widget_log_new(0, 30, 8, MAX_LOGS);
+}
+
+static gp_pixmap *pixmap_new(void)
+{
+	return render_buf_new(300, 200);
+}
+
+static int log_append(unsigned int *step)
+{
+	gp_widget *log = log_new();
+	gp_widget *ref_log = log_new();
+	gp_pixmap *buf = pixmap_new();
+	gp_pixmap *ref_buf = pixmap_new();
+	int ret = TST_FAILED;
+	unsigned int i;
+
+	if (!log || !ref_log || !buf || !ref_buf) {
+		tst_msg("Allocation failure");
+		goto exit;
+	}
+
+	ctx.buf = buf;
+	gp_widget_render(log, &ctx, GP_WIDGET_RESIZE | GP_WIDGET_REDRAW);
+
+	for (i = 0; i < LINES; i++) {
+		gp_widget_log_append(log, line(i));
+		gp_widget_log_append(ref_log, line(i));
+
+		if (i % *step)
+			continue;
+
+		ctx.buf = buf;
+		gp_widget_render(log, &ctx, 0);
+
+		ctx.buf = ref_buf;
+		gp_widget_render(ref_log, &ctx, GP_WIDGET_RESIZE | GP_WIDGET_REDRAW);
+
+		if (render_buf_cmp(buf, ref_buf)) {
+			tst_msg("After %u lines", i + 1);
+			goto exit;
+		}
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(log);
+	gp_widget_free(ref_log);
+	gp_pixmap_free(buf);
+	gp_pixmap_free(ref_buf);
+	return ret;
+}
+
+static int log_content_moved(void)
+{
+	gp_widget *log = log_new();
+	gp_pixmap *buf = pixmap_new();
+	int ret = TST_FAILED;
+	gp_coord marker_x, marker_y;
+	unsigned int i;
+
+	if (!log || !buf) {
+		tst_msg("Allocation failure");
+		goto exit;
+	}
+
+	for (i = 0; i < MAX_LOGS; i++)
+		gp_widget_log_append(log, "Line");
+
+	ctx.buf = buf;
+	gp_widget_render(log, &ctx, GP_WIDGET_RESIZE | GP_WIDGET_REDRAW);
+
+	marker_x = log->x + log->w / 2;
+	marker_y = log->y + log->h / 2;
+	gp_putpixel(buf, marker_x, marker_y, MARKER);
+
+	/* A single short line moves the content by one line */
+	gp_widget_log_append(log, "Line");
+	gp_widget_render(log, &ctx, 0);
+
+	marker_y -= gp_text_ascent(&font) + ctx.padd;
+
+	if (marker_check(buf, marker_x, marker_y))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(log);
+	gp_pixmap_free(buf);
+	return ret;
+}
+
+static int log_append_lines(void)
+{
+	const char *strs[LINES];
+	gp_widget *log = log_new();
+	gp_widget *ref_log = log_new();
+	gp_pixmap *buf = pixmap_new();
+	gp_pixmap *ref_buf = pixmap_new();
+	int ret = TST_FAILED;
+	char (*copy)[128] = NULL;
+	unsigned int i;
+
+	copy = malloc(sizeof(*copy) * LINES);
+
+	if (!log || !ref_log || !buf || !ref_buf || !copy) {
+		tst_msg("Allocation failure");
+		goto exit;
+	}
+
+	for (i = 0; i < LINES; i++) {
+		strcpy(copy[i], line(i));
+		strs[i] = copy[i];
+		gp_widget_log_append(ref_log, strs[i]);
+	}
+
+	/* Lines that do not fit into the log are skipped */
+	gp_widget_log_append_lines(log, strs, LINES);
+
+	ctx.buf = buf;
+	gp_widget_render(log, &ctx, GP_WIDGET_RESIZE | GP_WIDGET_REDRAW);
+
+	ctx.buf = ref_buf;
+	gp_widget_render(ref_log, &ctx, GP_WIDGET_RESIZE | GP_WIDGET_REDRAW);
+
+	if (render_buf_cmp(buf, ref_buf)) {
+		tst_msg("Appended lines differ");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	free(copy);
+	gp_widget_free(log);
+	gp_widget_free(ref_log);
+	gp_pixmap_free(buf);
+	gp_pixmap_free(ref_buf);
+	return ret;
+}
+
+static unsigned int step_1 = 1;
+static unsigned int step_3 = 3;
+static unsigned int step_7 = 7;
+
+const struct tst_suite tst_suite = {
+	.suite_name = "log testsuite",
+	.tests = {
+		{.name = "log append every line",
+		 .tst_fn = log_append,
+		 .data = &step_1},
+
+		{.name = "log append 3 lines",
+		 .tst_fn = log_append,
+		 .data = &step_3},
+
+		{.name = "log append 7 lines",
+		 .tst_fn = log_append,
+		 .data = &step_7},
+
+		{.name = "log content moved",
+		 .tst_fn = log_content_moved},
+
+		{.name = "log append lines",
+		 .tst_fn = log_append_lines},
+
+		{.name = NULL},
+	}
+};
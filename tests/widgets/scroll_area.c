@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <string.h>
+#include <widgets/gp_widgets.h>
+#include "tst_test.h"
+#include "common.h"
+
+#define LABELS 20
+#define MARKER 0x00ff00
+
+static gp_text_style font = {
+	.pixel_xmul = 1,
+	.pixel_ymul = 1,
+	.font = &gp_default_font,
+};
+
+static gp_widget_render_ctx ctx = {
+	.pixel_type = GP_PIXEL_RGB888,
+	.font = &font,
+	.padd = 2,
+	.text_color = 0xffffff,
+};
+
+static gp_widget *scroll_area_new(void)
+{
+	gp_widget *grid, *scroll;
+	unsigned int i;
+
+	grid = gp_widget_grid_new(1, LABELS, 0);
+	if (!grid)
+		return NULL;
+
+	/* No padding so that the whole content is covered by the labels */
+	gp_widget_grid_no_border(grid);
+
+	for (i = 0; i < LABELS; i++) {
+		gp_widget *label = gp_widget_label_printf_new(0, "A long label number %02u", i);
+
+		if (!label) {
+			gp_widget_free(grid);
+			return NULL;
+		}
+
+		gp_widget_grid_put(grid, 0, i, label);
+	}
+
+	scroll = gp_widget_scroll_area_new(60, 60, grid);
+	if (!scroll)
+		gp_widget_free(grid);
+
+	return scroll;
+}
+
+struct move {
+	gp_coord x_off;
+	gp_coord y_off;
+};
+
+/*
+ * Renders the scroll area, moves it and renders it after each move. If full is
+ * set the area is rendered only after the last move with a full redraw.
+ */
+static gp_pixmap *render_moved(gp_widget *scroll, const struct move *moves,
+                               unsigned int moves_cnt, int full)
+{
+	gp_pixmap *buf = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	unsigned int i;
+
+	if (!buf)
+		return NULL;
+
+	gp_fill(buf, 0);
+
+	ctx.buf = buf;
+
+	gp_widget_render(scroll, &ctx, GP_WIDGET_RESIZE | GP_WIDGET_REDRAW);
+
+	for (i = 0; i < moves_cnt; i++) {
+		gp_widget_scroll_area_move(scroll, moves[i].x_off, moves[i].y_off);
+
+		if (full && i + 1 < moves_cnt)
+			continue;
+
+		gp_widget_render(scroll, &ctx, full ? GP_WIDGET_REDRAW : 0);
+	}
+
+	return buf;
+}
+
+static int scroll_area_move(const struct move *moves, unsigned int moves_cnt)
+{
+	gp_widget *scroll = scroll_area_new();
+	gp_widget *ref_scroll = scroll_area_new();
+	gp_pixmap *buf = NULL, *ref_buf = NULL;
+	int ret = TST_FAILED;
+
+	if (!scroll || !ref_scroll) {
+		tst_msg("Allocation failure");
+		goto exit;
+	}
+
+	buf = render_moved(scroll, moves, moves_cnt, 0);
+	ref_buf = render_moved(ref_scroll, moves, moves_cnt, 1);
+
+	if (!buf || !ref_buf) {
+		tst_msg("Allocation failure");
+		goto exit;
+	}
+
+	if (memcmp(buf->pixels, ref_buf->pixels, buf->bytes_per_row * buf->h)) {
+		tst_msg("Scrolled content differs from full redraw");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(scroll);
+	gp_widget_free(ref_scroll);
+	gp_pixmap_free(buf);
+	gp_pixmap_free(ref_buf);
+	return ret;
+}
+
+static int scroll_area_move_down(void)
+{
+	static const struct move moves[] = {{0, 13}};
+
+	return scroll_area_move(moves, GP_ARRAY_SIZE(moves));
+}
+
+static int scroll_area_move_diag(void)
+{
+	static const struct move moves[] = {{20, 7}};
+
+	return scroll_area_move(moves, GP_ARRAY_SIZE(moves));
+}
+
+static int scroll_area_move_back(void)
+{
+	static const struct move moves[] = {{30, 30}, {-10, -3}};
+
+	return scroll_area_move(moves, GP_ARRAY_SIZE(moves));
+}
+
+static int scroll_area_move_far(void)
+{
+	static const struct move moves[] = {{0, 20}, {0, 100}};
+
+	return scroll_area_move(moves, GP_ARRAY_SIZE(moves));
+}
+
+/*
+ * Content that is not exposed by the scrolling is moved rather than rendered,
+ * so a marker put into the buffer has to move with the content.
+ */
+static int scroll_area_content_moved(void)
+{
+	gp_widget *scroll = scroll_area_new();
+	gp_pixmap *buf = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	int ret = TST_FAILED;
+	gp_coord x, y;
+	gp_pixel p;
+
+	if (!scroll || !buf) {
+		tst_msg("Allocation failure");
+		goto exit;
+	}
+
+	ctx.buf = buf;
+
+	gp_widget_render(scroll, &ctx, GP_WIDGET_RESIZE | GP_WIDGET_REDRAW);
+
+	x = scroll->x + 20;
+	y = scroll->y + 40;
+
+	gp_putpixel(buf, x, y, MARKER);
+
+	gp_widget_scroll_area_move(scroll, 0, 13);
+	gp_widget_render(scroll, &ctx, 0);
+
+	p = gp_getpixel(buf, x, y - 13);
+	if (p != MARKER) {
+		tst_msg("Marker not moved, pixel %06x", p);
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(scroll);
+	gp_pixmap_free(buf);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "scroll area testsuite",
+	.tests = {
+		{.name = "scroll area move down",
+		 .tst_fn = scroll_area_move_down,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "scroll area move diagonal",
+		 .tst_fn = scroll_area_move_diag,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "scroll area move back",
+		 .tst_fn = scroll_area_move_back,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "scroll area move far",
+		 .tst_fn = scroll_area_move_far,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "scroll area content moved",
+		 .tst_fn = scroll_area_content_moved,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = NULL},
+	}
+};
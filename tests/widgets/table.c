@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+#include <widgets/gp_widgets.h>
+#include "tst_test.h"
+#include "common.h"
+
+#define TABLE_ROWS 200000
+#define TABLE_OFF 150000
+
+enum table_cols {
+	COL_ROW,
+	COL_SQUARE,
+};
+
+/* Number of rows the table iterated over and the first row it asked for */
+static unsigned long rows_seeked;
+static long first_row;
+
+static int tbl_seek_row(gp_widget *self, int op, unsigned int pos)
+{
+	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(self);
+
+	switch (op) {
+	case GP_TABLE_ROW_RESET:
+		tbl_priv->row_idx = 0;
+	break;
+	case GP_TABLE_ROW_ADVANCE:
+		tbl_priv->row_idx += pos;
+		rows_seeked += pos;
+	break;
+	case GP_TABLE_ROW_MAX:
+		return TABLE_ROWS;
+	}
+
+	return tbl_priv->row_idx < TABLE_ROWS;
+}
+
+static int tbl_set_row(gp_widget *self, unsigned int row)
+{
+	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(self);
+
+	tbl_priv->row_idx = row;
+
+	return row < TABLE_ROWS;
+}
+
+static int tbl_get_cell(gp_widget *self, gp_widget_table_cell *cell, unsigned int col)
+{
+	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(self);
+	static char buf[32];
+	unsigned long row = tbl_priv->row_idx;
+
+	if (first_row < 0)
+		first_row = row;
+
+	switch (col) {
+	case COL_ROW:
+		snprintf(buf, sizeof(buf), "%lu", row);
+	break;
+	case COL_SQUARE:
+		snprintf(buf, sizeof(buf), "%llu", (unsigned long long)row * row);
+	break;
+	}
+
+	cell->text = buf;
+
+	return 1;
+}
+
+static gp_widget_table_col_ops seek_col_ops = {
+	.seek_row = tbl_seek_row,
+	.get_cell = tbl_get_cell,
+	.col_map = {
+		{.id = "row", .idx = COL_ROW},
+		{.id = "square", .idx = COL_SQUARE},
+		{}
+	}
+};
+
+static gp_widget_table_col_ops set_col_ops = {
+	.seek_row = tbl_seek_row,
+	.set_row = tbl_set_row,
+	.get_cell = tbl_get_cell,
+	.col_map = {
+		{.id = "row", .idx = COL_ROW},
+		{.id = "square", .idx = COL_SQUARE},
+		{}
+	}
+};
+
+static const char *table_json =
+	"{\"info\": {\"version\": 1, \"license\": \"GPL-2.1-or-later\"},\n"
+	" \"layout\": {\"widgets\": [\n"
+	"  {\"type\": \"table\", \"uid\": \"table\", \"min_rows\": 25,\n"
+	"   \"col_ops\": \"table_col_ops\", \"header\": [\n"
+	"    {\"label\": \"Row\", \"min_size\": 8, \"id\": \"row\"},\n"
+	"    {\"label\": \"Square\", \"min_size\": 12, \"id\": \"square\"}\n"
+	"   ]}\n"
+	" ]}}";
+
+static gp_widget *load_table(gp_widget_table_col_ops *col_ops, gp_widget **table)
+{
+	gp_htable *uids = NULL;
+	gp_widget *layout;
+
+	const gp_widget_json_addr addrs[] = {
+		{.id = "table_col_ops", .table_col_ops = col_ops},
+		{}
+	};
+
+	gp_widget_json_callbacks callbacks = {
+		.addrs = addrs,
+	};
+
+	layout = gp_widget_from_json_str(table_json, &callbacks, &uids);
+	if (!layout)
+		return NULL;
+
+	*table = gp_widget_by_uid(uids, "table", GP_WIDGET_TABLE);
+	gp_htable_free(uids);
+
+	gp_widget_calc_size(layout, &dummy_ctx, 0, 0, 1);
+
+	return layout;
+}
+
+static int render_offset(gp_widget_table_col_ops *col_ops)
+{
+	gp_widget *layout, *table;
+	int ret = TST_PASSED;
+
+	layout = load_table(col_ops, &table);
+	if (!layout || !table) {
+		tst_msg("Failed to load table layout");
+		return TST_FAILED;
+	}
+
+	gp_widget_table_off_set(table, TABLE_OFF);
+
+	rows_seeked = 0;
+	first_row = -1;
+
+	dummy_render(layout);
+
+	if (first_row != TABLE_OFF) {
+		tst_msg("First rendered row %li expected %i", first_row, TABLE_OFF);
+		ret = TST_FAILED;
+	}
+
+	/* Only rows on the screen should be iterated over */
+	if (col_ops->set_row && rows_seeked > 100) {
+		tst_msg("Render seeked over %lu rows", rows_seeked);
+		ret = TST_FAILED;
+	}
+
+	gp_widget_free(layout);
+
+	return ret;
+}
+
+static int render_bench(gp_widget_table_col_ops *col_ops)
+{
+	static gp_widget *layout, *table;
+
+	/* Layout is loaded once, the benchmark measures rendering */
+	if (!layout) {
+		layout = load_table(col_ops, &table);
+		if (!layout)
+			return TST_UNTESTED;
+	}
+
+	gp_widget_table_off_set(table, TABLE_OFF);
+	dummy_render(layout);
+
+	return TST_PASSED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "table testsuite",
+	.tests = {
+		{.name = "render offset seek_row",
+		 .tst_fn = render_offset,
+		 .data = &seek_col_ops},
+
+		{.name = "render offset set_row",
+		 .tst_fn = render_offset,
+		 .data = &set_col_ops},
+
+		{.name = "render 200k rows seek_row",
+		 .tst_fn = render_bench,
+		 .data = &seek_col_ops,
+		 .bench_iter = 100},
+
+		{.name = "render 200k rows set_row",
+		 .tst_fn = render_bench,
+		 .data = &set_col_ops,
+		 .bench_iter = 100},
+
+		{.name = NULL},
+	}
+};